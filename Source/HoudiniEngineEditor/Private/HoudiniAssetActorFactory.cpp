@@ -35,6 +35,7 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniAssetActor.h"
 #include "HoudiniAsset.h"
+#include "HoudiniEngine.h"
 
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "Internationalization/Internationalization.h"
@@ -84,8 +85,9 @@ UHoudiniAssetActorFactory::PostSpawnActor( UObject * Asset, AActor * NewActor )
         // Mark this component as native.
         HoudiniAssetComponent->SetNative( true );
 
+        // Actors placed together are instantiated in one batch on the next tick.
         HoudiniAssetComponent->UnregisterComponent();
-        HoudiniAssetComponent->SetHoudiniAsset( HoudiniAsset );
+        FHoudiniEngine::Get().GetInstantiationBatch().AssignAsset( HoudiniAssetComponent, HoudiniAsset );
         HoudiniAssetComponent->RegisterComponent();
     }
 }
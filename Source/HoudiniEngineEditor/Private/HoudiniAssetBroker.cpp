@@ -34,6 +34,7 @@
 #include "HoudiniEngineEditorPrivatePCH.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniAsset.h"
+#include "HoudiniEngine.h"
 
 FHoudiniAssetBroker::~FHoudiniAssetBroker()
 {
@@ -55,7 +56,8 @@ FHoudiniAssetBroker::AssignAssetToComponent( UActorComponent * InComponent, UObj
 
         if ( HoudiniAsset || !InAsset )
         {
-            HoudiniAssetComponent->SetHoudiniAsset( HoudiniAsset );
+            // Components assigned together are instantiated in one batch on the next tick.
+            FHoudiniEngine::Get().GetInstantiationBatch().AssignAsset( HoudiniAssetComponent, HoudiniAsset );
             return true;
         }
     }
@@ -34,6 +34,7 @@
 #include "HoudiniParameterDetails.h"
 #include "HoudiniAssetInput.h"
 #include "HoudiniAssetInstanceInput.h"
+#include "HoudiniOutputMemoryUsage.h"
 
 #include "Components/InstancedStaticMeshComponent.h"
 #include "ContentBrowserModule.h"
@@ -49,6 +50,9 @@
 #include "Widgets/Layout/SSeparator.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Images/SImage.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STableRow.h"
+#include "AssetThumbnail.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Materials/Material.h"
 
@@ -110,6 +114,27 @@ FHoudiniAssetComponentDetails::CustomizeDetails( IDetailLayoutBuilder & DetailBu
         }
     }
 
+    // When several components are selected, a parameter change made on one of them is applied to all,
+    // each of them cooks once and the details are refreshed when the last one is done.
+    if ( HoudiniAssetComponents.Num() > 1 )
+    {
+        MultiEditGroup = MakeShareable( new FHoudiniMultiEditGroup() );
+        for ( UHoudiniAssetComponent * HoudiniAssetComponent : HoudiniAssetComponents )
+        {
+            if ( HoudiniAssetComponent && !HoudiniAssetComponent->IsPendingKill() )
+                MultiEditGroup->Components.Add( HoudiniAssetComponent );
+        }
+    }
+
+    for ( UHoudiniAssetComponent * HoudiniAssetComponent : HoudiniAssetComponents )
+    {
+        if ( HoudiniAssetComponent && !HoudiniAssetComponent->IsPendingKill() )
+            HoudiniAssetComponent->SetMultiEditGroup( MultiEditGroup );
+    }
+
+    // Drop the cached parameter rows of destroyed components and parameters.
+    FHoudiniParameterDetails::PruneRowCache();
+
     // Create Houdini parameters.
     {
         IDetailCategoryBuilder & DetailCategoryBuilder =
@@ -225,6 +250,7 @@ FHoudiniAssetComponentDetails::CustomizeDetails( IDetailLayoutBuilder & DetailBu
     {
         IDetailCategoryBuilder & DetailCategoryBuilder =
             DetailBuilder.EditCategory( "HoudiniGeneratedMeshes", FText::GetEmpty(), ECategoryPriority::Important );
+        CreateOutputMemoryWidgets( DetailCategoryBuilder );
         CreateStaticMeshAndMaterialWidgets( DetailCategoryBuilder );
     }
 
@@ -232,6 +258,49 @@ FHoudiniAssetComponentDetails::CustomizeDetails( IDetailLayoutBuilder & DetailBu
     DetailBuilder.EditCategory( "HoudiniGeneratedStaticMeshSettings", FText::GetEmpty(), ECategoryPriority::Important );
 }
 
+void
+FHoudiniAssetComponentDetails::CreateOutputMemoryWidgets( IDetailCategoryBuilder & DetailCategoryBuilder )
+{
+    // The usage of all selected components is combined, outputs they share are counted once.
+    FHoudiniOutputMemoryUsage MemoryUsage;
+    for ( UHoudiniAssetComponent * HoudiniAssetComponent : HoudiniAssetComponents )
+    {
+        if ( HoudiniAssetComponent && !HoudiniAssetComponent->IsPendingKill() )
+            HoudiniAssetComponent->GetOutputMemoryUsage( MemoryUsage );
+    }
+
+    if ( MemoryUsage.CountedObjects.Num() <= 0 )
+        return;
+
+    IDetailGroup & MemoryGroup = DetailCategoryBuilder.AddGroup(
+        TEXT( "OutputMemory" ), FText::Format( LOCTEXT( "OutputMemoryGroup", "Output Memory ({0})" ),
+            FText::AsMemory( MemoryUsage.GetTotalBytes() ) ) );
+
+    for ( int32 CategoryIdx = 0; CategoryIdx < EHoudiniOutputMemoryCategory::MAX; ++CategoryIdx )
+    {
+        if ( MemoryUsage.ObjectCounts[ CategoryIdx ] <= 0 )
+            continue;
+
+        MemoryGroup.AddWidgetRow()
+        .NameContent()
+        [
+            SNew( STextBlock )
+            .Text( FText::FromString( FHoudiniOutputMemoryUsage::GetCategoryName( (EHoudiniOutputMemoryCategory::Type) CategoryIdx ) ) )
+            .Font( IDetailLayoutBuilder::GetDetailFont() )
+        ]
+        .ValueContent()
+        .MinDesiredWidth( HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH )
+        [
+            SNew( STextBlock )
+            .Text( FText::Format( LOCTEXT( "OutputMemoryRow", "CPU {0}, GPU {1} ({2} objects)" ),
+                FText::AsMemory( MemoryUsage.CpuBytes[ CategoryIdx ] ),
+                FText::AsMemory( MemoryUsage.GpuBytes[ CategoryIdx ] ),
+                FText::AsNumber( MemoryUsage.ObjectCounts[ CategoryIdx ] ) ) )
+            .Font( IDetailLayoutBuilder::GetDetailFont() )
+        ];
+    }
+}
+
 void
 FHoudiniAssetComponentDetails::CreateStaticMeshAndMaterialWidgets( IDetailCategoryBuilder & DetailCategoryBuilder )
 {
@@ -244,6 +313,17 @@ FHoudiniAssetComponentDetails::CreateStaticMeshAndMaterialWidgets( IDetailCatego
     IDetailLayoutBuilder & DetailLayoutBuilder = DetailCategoryBuilder.GetParentLayout();
     TSharedPtr< FAssetThumbnailPool > AssetThumbnailPool = DetailLayoutBuilder.GetThumbnailPool();
 
+    // Outputs with many static meshes are shown in a list, which only builds the rows that are in view.
+    int32 NumberOfStaticMeshes = 0;
+    for ( UHoudiniAssetComponent * HoudiniAssetComponent : HoudiniAssetComponents )
+    {
+        if ( HoudiniAssetComponent && !HoudiniAssetComponent->IsPendingKill() )
+            NumberOfStaticMeshes += HoudiniAssetComponent->StaticMeshes.Num();
+    }
+
+    const bool bUseStaticMeshOutputList = NumberOfStaticMeshes > HAPI_UNREAL_DETAILS_STATIC_MESH_LIST_THRESHOLD;
+    StaticMeshOutputItems.Empty();
+
     int32 NumberOfGeneratedMeshes = 0;
     for ( TArray< UHoudiniAssetComponent * >::TIterator
         IterComponents( HoudiniAssetComponents ); IterComponents; ++IterComponents)
@@ -264,15 +344,18 @@ FHoudiniAssetComponentDetails::CreateStaticMeshAndMaterialWidgets( IDetailCatego
 
             NumberOfGeneratedMeshes++;
 
-            FString Label = HoudiniAssetComponent->GetBakingBaseName( HoudiniGeoPartObject);
-
-            // Create thumbnail for this mesh.
-            TSharedPtr< FAssetThumbnail > StaticMeshThumbnail =
-                MakeShareable( new FAssetThumbnail( StaticMesh, 64, 64, AssetThumbnailPool ) );
+            if ( bUseStaticMeshOutputList )
+            {
+                // The rows of the list are only built once they are scrolled into view.
+                TSharedPtr< FHoudiniStaticMeshOutputItem > OutputItem = MakeShareable( new FHoudiniStaticMeshOutputItem );
+                OutputItem->HoudiniAssetComponent = HoudiniAssetComponent;
+                OutputItem->StaticMesh = StaticMesh;
+                OutputItem->HoudiniGeoPartObject = HoudiniGeoPartObject;
+                StaticMeshOutputItems.Add( OutputItem );
+                continue;
+            }
 
-            TSharedPtr< SBorder > StaticMeshThumbnailBorder;
-            TSharedRef< SVerticalBox > VerticalBox = SNew( SVerticalBox );
-            
+            FString Label = HoudiniAssetComponent->GetBakingBaseName( HoudiniGeoPartObject );
             IDetailGroup& StaticMeshGrp = DetailCategoryBuilder.AddGroup(FName(*Label), FText::FromString(Label));
 
             StaticMeshGrp.AddWidgetRow()
@@ -285,263 +368,21 @@ FHoudiniAssetComponentDetails::CreateStaticMeshAndMaterialWidgets( IDetailCatego
             .ValueContent()
             .MinDesiredWidth( HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH )
             [
-                SNew( SHorizontalBox )
-                +SHorizontalBox::Slot()
-                .Padding( 2.0f, 0.0f )
-                .VAlign( VAlign_Center )
-                .FillWidth( 1 )
-                [
-                    SNew( SEditableTextBox )
-                    .Text( FText::FromString(Label) )
-                    .Font( IDetailLayoutBuilder::GetDetailFont() )
-                    .OnTextCommitted( this, &FHoudiniAssetComponentDetails::OnBakeNameCommited, HoudiniAssetComponent, HoudiniGeoPartObject )
-                    .ToolTipText( LOCTEXT( "BakeNameTip", "The base name of the baked asset") )
-                ]
-                +SHorizontalBox::Slot()
-                .Padding( 2.0f, 0.0f )
-                .VAlign( VAlign_Center )
-                .AutoWidth()
-                [
-                    SNew( SButton )
-                    .ToolTipText( LOCTEXT( "RevertNameOverride", "Revert bake name override" ) )
-                    .ButtonStyle( FEditorStyle::Get(), "NoBorder" )
-                    .ContentPadding( 0 )
-                    .Visibility( EVisibility::Visible )
-                    .OnClicked( this, &FHoudiniAssetComponentDetails::OnRemoveBakingBaseNameOverride, HoudiniAssetComponent, HoudiniGeoPartObject )
-                    [
-                        SNew( SImage )
-                        .Image( FEditorStyle::GetBrush( "PropertyWindow.DiffersFromDefault" ) )
-                    ]
-                ]
+                CreateBakeNameWidget( HoudiniAssetComponent, HoudiniGeoPartObject )
             ];
 
-            FString MeshLabel = TEXT( "Static Mesh" );
-            if( HoudiniGeoPartObject.bHasCollisionBeenAdded )
-            {
-                int32 NumColliders = 1;
-                if ( StaticMesh->BodySetup && !StaticMesh->BodySetup->IsPendingKill() )
-                    NumColliders = StaticMesh->BodySetup->AggGeom.GetElementCount();
-
-                MeshLabel += TEXT( "\n(") + FString::FromInt( NumColliders ) + TEXT(" Simple Collider" );
-                if ( NumColliders > 1 )
-                    MeshLabel += TEXT("s");
-                MeshLabel += TEXT(")");
-            }
-            else if( HoudiniGeoPartObject.bIsRenderCollidable )
-            {
-                MeshLabel += TEXT( "\n(Rendered Complex Collider)" );
-            }
-            else if( HoudiniGeoPartObject.bIsCollidable )
-            {
-                MeshLabel += TEXT( "\n(Invisible Complex Collider)" );
-            }
-
-            if ( StaticMesh->GetNumLODs() > 1 )
-                MeshLabel += TEXT("\n(") + FString::FromInt( StaticMesh->GetNumLODs() ) + TEXT(" LODs)");
-
-            if ( StaticMesh->Sockets.Num() > 0 )
-                MeshLabel += TEXT("\n(") + FString::FromInt( StaticMesh->Sockets.Num() ) + TEXT(" sockets)");
-
             StaticMeshGrp.AddWidgetRow()
             .NameContent()
             [
                 SNew( STextBlock )
-                .Text( FText::FromString(MeshLabel) )
+                .Text( FText::FromString( GetStaticMeshLabel( StaticMesh, HoudiniGeoPartObject ) ) )
                 .Font( IDetailLayoutBuilder::GetDetailFont() )
             ]
             .ValueContent()
             .MinDesiredWidth(HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH)
             [
-                VerticalBox
-            ];
-            
-            VerticalBox->AddSlot().Padding( 0, 2 ).AutoHeight()
-            [
-                SNew( SHorizontalBox )
-                +SHorizontalBox::Slot()
-                .Padding( 0.0f, 0.0f, 2.0f, 0.0f )
-                .AutoWidth()
-                [
-                    SAssignNew( StaticMeshThumbnailBorder, SBorder )
-                    .Padding( 5.0f )
-                    .BorderImage( this, &FHoudiniAssetComponentDetails::GetStaticMeshThumbnailBorder, StaticMesh )
-                    .OnMouseDoubleClick( this, &FHoudiniAssetComponentDetails::OnThumbnailDoubleClick, (UObject *) StaticMesh )
-                    [
-                        SNew( SBox )
-                        .WidthOverride( 64 )
-                        .HeightOverride( 64 )
-                        .ToolTipText( FText::FromString( StaticMesh->GetPathName() ) )
-                        [
-                            StaticMeshThumbnail->MakeThumbnailWidget()
-                        ]
-                    ]
-                ]
-                +SHorizontalBox::Slot()
-                .FillWidth( 1.0f )
-                .Padding( 0.0f, 4.0f, 4.0f, 4.0f )
-                .VAlign( VAlign_Center )
-                [
-                    SNew( SVerticalBox )
-                    +SVerticalBox::Slot()
-                    [
-                        SNew( SHorizontalBox )
-                        +SHorizontalBox::Slot()
-                        .MaxWidth( 80.0f )
-                        [
-                            SNew( SButton )
-                            .VAlign( VAlign_Center )
-                            .HAlign( HAlign_Center )
-                            .Text( LOCTEXT( "Bake", "Bake" ) )
-                            .OnClicked( this, &FHoudiniAssetComponentDetails::OnBakeStaticMesh, StaticMesh, HoudiniAssetComponent )
-                            .ToolTipText( LOCTEXT( "HoudiniStaticMeshBakeButton", "Bake this generated static mesh" ) )
-                        ]
-                    ]
-                ]
+                CreateStaticMeshWidget( HoudiniAssetComponent, StaticMesh, HoudiniGeoPartObject, AssetThumbnailPool )
             ];
-
-            // Store thumbnail for this mesh.
-            StaticMeshThumbnailBorders.Add( StaticMesh, StaticMeshThumbnailBorder );
-
-            // We need to add material box for each material present in this static mesh.
-            auto & StaticMeshMaterials = StaticMesh->StaticMaterials;
-            for ( int32 MaterialIdx = 0; MaterialIdx < StaticMeshMaterials.Num(); ++MaterialIdx )
-            {
-                UMaterialInterface * MaterialInterface = StaticMeshMaterials[ MaterialIdx ].MaterialInterface;
-                TSharedPtr< SBorder > MaterialThumbnailBorder;
-                TSharedPtr< SHorizontalBox > HorizontalBox = NULL;
-
-                FString MaterialName, MaterialPathName;
-                if ( MaterialInterface && !MaterialInterface->IsPendingKill()
-                    && MaterialInterface->GetOuter() && !MaterialInterface->GetOuter()->IsPendingKill() )
-                {
-                    MaterialName = MaterialInterface->GetName();
-                    MaterialPathName = MaterialInterface->GetPathName();
-                }
-                else
-                {
-                    MaterialInterface = nullptr;
-                    MaterialName = TEXT("Material (invalid)") + FString::FromInt( MaterialIdx ) ;
-                    MaterialPathName = TEXT("Material (invalid)") + FString::FromInt(MaterialIdx);
-                }
-
-                // Create thumbnail for this material.
-                TSharedPtr< FAssetThumbnail > MaterialInterfaceThumbnail =
-                    MakeShareable( new FAssetThumbnail( MaterialInterface, 64, 64, AssetThumbnailPool ) );
-
-                VerticalBox->AddSlot().Padding( 0, 2 )
-                [
-                    SNew( SAssetDropTarget )
-                    .OnIsAssetAcceptableForDrop( this, &FHoudiniAssetComponentDetails::OnMaterialInterfaceDraggedOver )
-                    .OnAssetDropped(
-                        this, &FHoudiniAssetComponentDetails::OnMaterialInterfaceDropped,
-                        StaticMesh, &HoudiniGeoPartObject, MaterialIdx )
-                    [
-                        SAssignNew( HorizontalBox, SHorizontalBox )
-                    ]
-                ];
-
-                HorizontalBox->AddSlot().Padding( 0.0f, 0.0f, 2.0f, 0.0f ).AutoWidth()
-                [
-                    SAssignNew( MaterialThumbnailBorder, SBorder )
-                    .Padding( 5.0f )
-                    .BorderImage(
-                        this, &FHoudiniAssetComponentDetails::GetMaterialInterfaceThumbnailBorder, StaticMesh, MaterialIdx )
-                    .OnMouseDoubleClick(
-                        this, &FHoudiniAssetComponentDetails::OnThumbnailDoubleClick, (UObject *) MaterialInterface )
-                    [
-                        SNew( SBox )
-                        .WidthOverride( 64 )
-                        .HeightOverride( 64 )
-                        .ToolTipText( FText::FromString( MaterialPathName ) )
-                        [
-                            MaterialInterfaceThumbnail->MakeThumbnailWidget()
-                        ]
-                    ]
-                ];
-
-                // Store thumbnail for this mesh and material index.
-                {
-                    TPairInitializer< UStaticMesh *, int32 > Pair( StaticMesh, MaterialIdx );
-                    MaterialInterfaceThumbnailBorders.Add( Pair, MaterialThumbnailBorder );
-                }
-
-                TSharedPtr< SComboButton > AssetComboButton;
-                TSharedPtr< SHorizontalBox > ButtonBox;
-
-                HorizontalBox->AddSlot()
-                .FillWidth( 1.0f )
-                .Padding( 0.0f, 4.0f, 4.0f, 4.0f )
-                .VAlign( VAlign_Center )
-                [
-                    SNew( SVerticalBox )
-                    +SVerticalBox::Slot()
-                    .HAlign( HAlign_Fill )
-                    [
-                        SAssignNew( ButtonBox, SHorizontalBox )
-                        +SHorizontalBox::Slot()
-                        [
-                            SAssignNew( AssetComboButton, SComboButton )
-                            //.ToolTipText( this, &FHoudiniAssetComponentDetails::OnGetToolTip )
-                            .ButtonStyle( FEditorStyle::Get(), "PropertyEditor.AssetComboStyle" )
-                            .ForegroundColor( FEditorStyle::GetColor("PropertyEditor.AssetName.ColorAndOpacity" ) )
-                            .OnGetMenuContent( this, &FHoudiniAssetComponentDetails::OnGetMaterialInterfaceMenuContent,
-                                MaterialInterface, StaticMesh, &HoudiniGeoPartObject, MaterialIdx )
-                            .ContentPadding( 2.0f )
-                            .ButtonContent()
-                            [
-                                SNew( STextBlock )
-                                .TextStyle( FEditorStyle::Get(), "PropertyEditor.AssetClass" )
-                                .Font( FEditorStyle::GetFontStyle( FName( TEXT( "PropertyWindow.NormalFont" ) ) ) )
-                                .Text( FText::FromString( MaterialName ) )
-                            ]
-                        ]
-                    ]
-                ];
-
-                // Create tooltip.
-                FFormatNamedArguments Args;
-                Args.Add( TEXT( "Asset" ), FText::FromString( MaterialName ) );
-                FText MaterialTooltip = FText::Format(
-                    LOCTEXT( "BrowseToSpecificAssetInContentBrowser", "Browse to '{Asset}' in Content Browser" ), Args );
-
-                ButtonBox->AddSlot()
-                .AutoWidth()
-                .Padding( 2.0f, 0.0f )
-                .VAlign( VAlign_Center )
-                [
-                    PropertyCustomizationHelpers::MakeBrowseButton(
-                        FSimpleDelegate::CreateSP(
-                            this, &FHoudiniAssetComponentDetails::OnMaterialInterfaceBrowse, MaterialInterface ),
-                            TAttribute< FText >( MaterialTooltip ) )
-                ];
-
-                ButtonBox->AddSlot()
-                .AutoWidth()
-                .Padding( 2.0f, 0.0f )
-                .VAlign( VAlign_Center )
-                [
-                    SNew( SButton )
-                    .ToolTipText( LOCTEXT( "ResetToBaseMaterial", "Reset to base material" ) )
-                    .ButtonStyle( FEditorStyle::Get(), "NoBorder" )
-                    .ContentPadding( 0 )
-                    .Visibility( EVisibility::Visible )
-                    .OnClicked(
-                        this, &FHoudiniAssetComponentDetails::OnResetMaterialInterfaceClicked,
-                        StaticMesh, &HoudiniGeoPartObject, MaterialIdx )
-                    [
-                        SNew( SImage )
-                        .Image( FEditorStyle::GetBrush( "PropertyWindow.DiffersFromDefault" ) )
-                    ]
-                ];
-
-                // Store combo button for this mesh and index.
-                {
-                    TPairInitializer< UStaticMesh *, int32 > Pair( StaticMesh, MaterialIdx );
-                    MaterialInterfaceComboButtons.Add( Pair, AssetComboButton );
-                }
-            }
-
-            MeshIdx++;
         }
 
         // Do the same for the Landscape components
@@ -558,7 +399,7 @@ FHoudiniAssetComponentDetails::CreateStaticMeshAndMaterialWidgets( IDetailCatego
 
             FString Label = TEXT("");
             if (HoudiniGeoPartObject.HasCustomName())
-                Label = HoudiniGeoPartObject.PartName;
+                Label = HoudiniGeoPartObject.GetPartName();
             else
                 Label = Landscape->GetName();
 
@@ -771,6 +612,30 @@ FHoudiniAssetComponentDetails::CreateStaticMeshAndMaterialWidgets( IDetailCatego
         }
     }
 
+    if ( StaticMeshOutputItems.Num() > 0 )
+    {
+        // Thumbnails of the list have their own pool, which renders them with a smaller per frame budget.
+        if ( !StaticMeshOutputThumbnailPool.IsValid() )
+        {
+            StaticMeshOutputThumbnailPool = MakeShareable( new FAssetThumbnailPool(
+                HAPI_UNREAL_DETAILS_STATIC_MESH_LIST_THUMBNAIL_POOL_SIZE, false,
+                HAPI_UNREAL_DETAILS_STATIC_MESH_LIST_THUMBNAIL_FRAME_TIME ) );
+        }
+
+        DetailCategoryBuilder.AddCustomRow( LOCTEXT( "GeneratedStaticMeshes", "Generated Static Meshes" ) )
+        .WholeRowContent()
+        [
+            SNew( SBox )
+            .HeightOverride( HAPI_UNREAL_DETAILS_STATIC_MESH_LIST_HEIGHT )
+            [
+                SNew( SListView< TSharedPtr< FHoudiniStaticMeshOutputItem > > )
+                .ListItemsSource( &StaticMeshOutputItems )
+                .SelectionMode( ESelectionMode::None )
+                .OnGenerateRow( this, &FHoudiniAssetComponentDetails::OnGenerateStaticMeshOutputRow )
+            ]
+        ];
+    }
+
     if (NumberOfGeneratedMeshes > 1)
     {
         // Add the BakeAll button
@@ -803,6 +668,345 @@ FHoudiniAssetComponentDetails::CreateStaticMeshAndMaterialWidgets( IDetailCatego
     }
 }
 
+TSharedRef< SWidget >
+FHoudiniAssetComponentDetails::CreateBakeNameWidget(
+    UHoudiniAssetComponent * HoudiniAssetComponent, const FHoudiniGeoPartObject & HoudiniGeoPartObject )
+{
+    FString Label = HoudiniAssetComponent->GetBakingBaseName( HoudiniGeoPartObject );
+
+    return SNew( SHorizontalBox )
+    +SHorizontalBox::Slot()
+    .Padding( 2.0f, 0.0f )
+    .VAlign( VAlign_Center )
+    .FillWidth( 1 )
+    [
+        SNew( SEditableTextBox )
+        .Text( FText::FromString(Label) )
+        .Font( IDetailLayoutBuilder::GetDetailFont() )
+        .OnTextCommitted( this, &FHoudiniAssetComponentDetails::OnBakeNameCommited, HoudiniAssetComponent, HoudiniGeoPartObject )
+        .ToolTipText( LOCTEXT( "BakeNameTip", "The base name of the baked asset") )
+    ]
+    +SHorizontalBox::Slot()
+    .Padding( 2.0f, 0.0f )
+    .VAlign( VAlign_Center )
+    .AutoWidth()
+    [
+        SNew( SButton )
+        .ToolTipText( LOCTEXT( "RevertNameOverride", "Revert bake name override" ) )
+        .ButtonStyle( FEditorStyle::Get(), "NoBorder" )
+        .ContentPadding( 0 )
+        .Visibility( EVisibility::Visible )
+        .OnClicked( this, &FHoudiniAssetComponentDetails::OnRemoveBakingBaseNameOverride, HoudiniAssetComponent, HoudiniGeoPartObject )
+        [
+            SNew( SImage )
+            .Image( FEditorStyle::GetBrush( "PropertyWindow.DiffersFromDefault" ) )
+        ]
+    ];
+}
+
+FString
+FHoudiniAssetComponentDetails::GetStaticMeshLabel(
+    UStaticMesh * StaticMesh, const FHoudiniGeoPartObject & HoudiniGeoPartObject ) const
+{
+    FString MeshLabel = TEXT( "Static Mesh" );
+    if( HoudiniGeoPartObject.bHasCollisionBeenAdded )
+    {
+        int32 NumColliders = 1;
+        if ( StaticMesh->BodySetup && !StaticMesh->BodySetup->IsPendingKill() )
+            NumColliders = StaticMesh->BodySetup->AggGeom.GetElementCount();
+
+        MeshLabel += TEXT( "\n(") + FString::FromInt( NumColliders ) + TEXT(" Simple Collider" );
+        if ( NumColliders > 1 )
+            MeshLabel += TEXT("s");
+        MeshLabel += TEXT(")");
+    }
+    else if( HoudiniGeoPartObject.bIsRenderCollidable )
+    {
+        MeshLabel += TEXT( "\n(Rendered Complex Collider)" );
+    }
+    else if( HoudiniGeoPartObject.bIsCollidable )
+    {
+        MeshLabel += TEXT( "\n(Invisible Complex Collider)" );
+    }
+
+    if ( StaticMesh->GetNumLODs() > 1 )
+        MeshLabel += TEXT("\n(") + FString::FromInt( StaticMesh->GetNumLODs() ) + TEXT(" LODs)");
+
+    if ( StaticMesh->Sockets.Num() > 0 )
+        MeshLabel += TEXT("\n(") + FString::FromInt( StaticMesh->Sockets.Num() ) + TEXT(" sockets)");
+
+    return MeshLabel;
+}
+
+TSharedRef< SWidget >
+FHoudiniAssetComponentDetails::CreateStaticMeshWidget(
+    UHoudiniAssetComponent * HoudiniAssetComponent, UStaticMesh * StaticMesh,
+    FHoudiniGeoPartObject & HoudiniGeoPartObject, TSharedPtr< FAssetThumbnailPool > AssetThumbnailPool )
+{
+    // Create thumbnail for this mesh.
+    TSharedPtr< FAssetThumbnail > StaticMeshThumbnail =
+        MakeShareable( new FAssetThumbnail( StaticMesh, 64, 64, AssetThumbnailPool ) );
+
+    TSharedPtr< SBorder > StaticMeshThumbnailBorder;
+    TSharedRef< SVerticalBox > VerticalBox = SNew( SVerticalBox );
+
+    VerticalBox->AddSlot().Padding( 0, 2 ).AutoHeight()
+    [
+        SNew( SHorizontalBox )
+        +SHorizontalBox::Slot()
+        .Padding( 0.0f, 0.0f, 2.0f, 0.0f )
+        .AutoWidth()
+        [
+            SAssignNew( StaticMeshThumbnailBorder, SBorder )
+            .Padding( 5.0f )
+            .BorderImage( this, &FHoudiniAssetComponentDetails::GetStaticMeshThumbnailBorder, StaticMesh )
+            .OnMouseDoubleClick( this, &FHoudiniAssetComponentDetails::OnThumbnailDoubleClick, (UObject *) StaticMesh )
+            [
+                SNew( SBox )
+                .WidthOverride( 64 )
+                .HeightOverride( 64 )
+                .ToolTipText( FText::FromString( StaticMesh->GetPathName() ) )
+                [
+                    StaticMeshThumbnail->MakeThumbnailWidget()
+                ]
+            ]
+        ]
+        +SHorizontalBox::Slot()
+        .FillWidth( 1.0f )
+        .Padding( 0.0f, 4.0f, 4.0f, 4.0f )
+        .VAlign( VAlign_Center )
+        [
+            SNew( SVerticalBox )
+            +SVerticalBox::Slot()
+            [
+                SNew( SHorizontalBox )
+                +SHorizontalBox::Slot()
+                .MaxWidth( 80.0f )
+                [
+                    SNew( SButton )
+                    .VAlign( VAlign_Center )
+                    .HAlign( HAlign_Center )
+                    .Text( LOCTEXT( "Bake", "Bake" ) )
+                    .OnClicked( this, &FHoudiniAssetComponentDetails::OnBakeStaticMesh, StaticMesh, HoudiniAssetComponent )
+                    .ToolTipText( LOCTEXT( "HoudiniStaticMeshBakeButton", "Bake this generated static mesh" ) )
+                ]
+            ]
+        ]
+    ];
+
+    // Store thumbnail for this mesh.
+    StaticMeshThumbnailBorders.Add( StaticMesh, StaticMeshThumbnailBorder );
+
+    // We need to add material box for each material present in this static mesh.
+    auto & StaticMeshMaterials = StaticMesh->StaticMaterials;
+    for ( int32 MaterialIdx = 0; MaterialIdx < StaticMeshMaterials.Num(); ++MaterialIdx )
+    {
+        UMaterialInterface * MaterialInterface = StaticMeshMaterials[ MaterialIdx ].MaterialInterface;
+        TSharedPtr< SBorder > MaterialThumbnailBorder;
+        TSharedPtr< SHorizontalBox > HorizontalBox = NULL;
+
+        FString MaterialName, MaterialPathName;
+        if ( MaterialInterface && !MaterialInterface->IsPendingKill()
+            && MaterialInterface->GetOuter() && !MaterialInterface->GetOuter()->IsPendingKill() )
+        {
+            MaterialName = MaterialInterface->GetName();
+            MaterialPathName = MaterialInterface->GetPathName();
+        }
+        else
+        {
+            MaterialInterface = nullptr;
+            MaterialName = TEXT("Material (invalid)") + FString::FromInt( MaterialIdx ) ;
+            MaterialPathName = TEXT("Material (invalid)") + FString::FromInt(MaterialIdx);
+        }
+
+        // Create thumbnail for this material.
+        TSharedPtr< FAssetThumbnail > MaterialInterfaceThumbnail =
+            MakeShareable( new FAssetThumbnail( MaterialInterface, 64, 64, AssetThumbnailPool ) );
+
+        VerticalBox->AddSlot().Padding( 0, 2 )
+        [
+            SNew( SAssetDropTarget )
+            .OnIsAssetAcceptableForDrop( this, &FHoudiniAssetComponentDetails::OnMaterialInterfaceDraggedOver )
+            .OnAssetDropped(
+                this, &FHoudiniAssetComponentDetails::OnMaterialInterfaceDropped,
+                StaticMesh, &HoudiniGeoPartObject, MaterialIdx )
+            [
+                SAssignNew( HorizontalBox, SHorizontalBox )
+            ]
+        ];
+
+        HorizontalBox->AddSlot().Padding( 0.0f, 0.0f, 2.0f, 0.0f ).AutoWidth()
+        [
+            SAssignNew( MaterialThumbnailBorder, SBorder )
+            .Padding( 5.0f )
+            .BorderImage(
+                this, &FHoudiniAssetComponentDetails::GetMaterialInterfaceThumbnailBorder, StaticMesh, MaterialIdx )
+            .OnMouseDoubleClick(
+                this, &FHoudiniAssetComponentDetails::OnThumbnailDoubleClick, (UObject *) MaterialInterface )
+            [
+                SNew( SBox )
+                .WidthOverride( 64 )
+                .HeightOverride( 64 )
+                .ToolTipText( FText::FromString( MaterialPathName ) )
+                [
+                    MaterialInterfaceThumbnail->MakeThumbnailWidget()
+                ]
+            ]
+        ];
+
+        // Store thumbnail for this mesh and material index.
+        {
+            TPairInitializer< UStaticMesh *, int32 > Pair( StaticMesh, MaterialIdx );
+            MaterialInterfaceThumbnailBorders.Add( Pair, MaterialThumbnailBorder );
+        }
+
+        TSharedPtr< SComboButton > AssetComboButton;
+        TSharedPtr< SHorizontalBox > ButtonBox;
+
+        HorizontalBox->AddSlot()
+        .FillWidth( 1.0f )
+        .Padding( 0.0f, 4.0f, 4.0f, 4.0f )
+        .VAlign( VAlign_Center )
+        [
+            SNew( SVerticalBox )
+            +SVerticalBox::Slot()
+            .HAlign( HAlign_Fill )
+            [
+                SAssignNew( ButtonBox, SHorizontalBox )
+                +SHorizontalBox::Slot()
+                [
+                    SAssignNew( AssetComboButton, SComboButton )
+                    //.ToolTipText( this, &FHoudiniAssetComponentDetails::OnGetToolTip )
+                    .ButtonStyle( FEditorStyle::Get(), "PropertyEditor.AssetComboStyle" )
+                    .ForegroundColor( FEditorStyle::GetColor("PropertyEditor.AssetName.ColorAndOpacity" ) )
+                    .OnGetMenuContent( this, &FHoudiniAssetComponentDetails::OnGetMaterialInterfaceMenuContent,
+                        MaterialInterface, StaticMesh, &HoudiniGeoPartObject, MaterialIdx )
+                    .ContentPadding( 2.0f )
+                    .ButtonContent()
+                    [
+                        SNew( STextBlock )
+                        .TextStyle( FEditorStyle::Get(), "PropertyEditor.AssetClass" )
+                        .Font( FEditorStyle::GetFontStyle( FName( TEXT( "PropertyWindow.NormalFont" ) ) ) )
+                        .Text( FText::FromString( MaterialName ) )
+                    ]
+                ]
+            ]
+        ];
+
+        // Create tooltip.
+        FFormatNamedArguments Args;
+        Args.Add( TEXT( "Asset" ), FText::FromString( MaterialName ) );
+        FText MaterialTooltip = FText::Format(
+            LOCTEXT( "BrowseToSpecificAssetInContentBrowser", "Browse to '{Asset}' in Content Browser" ), Args );
+
+        ButtonBox->AddSlot()
+        .AutoWidth()
+        .Padding( 2.0f, 0.0f )
+        .VAlign( VAlign_Center )
+        [
+            PropertyCustomizationHelpers::MakeBrowseButton(
+                FSimpleDelegate::CreateSP(
+                    this, &FHoudiniAssetComponentDetails::OnMaterialInterfaceBrowse, MaterialInterface ),
+                    TAttribute< FText >( MaterialTooltip ) )
+        ];
+
+        ButtonBox->AddSlot()
+        .AutoWidth()
+        .Padding( 2.0f, 0.0f )
+        .VAlign( VAlign_Center )
+        [
+            SNew( SButton )
+            .ToolTipText( LOCTEXT( "ResetToBaseMaterial", "Reset to base material" ) )
+            .ButtonStyle( FEditorStyle::Get(), "NoBorder" )
+            .ContentPadding( 0 )
+            .Visibility( EVisibility::Visible )
+            .OnClicked(
+                this, &FHoudiniAssetComponentDetails::OnResetMaterialInterfaceClicked,
+                StaticMesh, &HoudiniGeoPartObject, MaterialIdx )
+            [
+                SNew( SImage )
+                .Image( FEditorStyle::GetBrush( "PropertyWindow.DiffersFromDefault" ) )
+            ]
+        ];
+
+        // Store combo button for this mesh and index.
+        {
+            TPairInitializer< UStaticMesh *, int32 > Pair( StaticMesh, MaterialIdx );
+            MaterialInterfaceComboButtons.Add( Pair, AssetComboButton );
+        }
+    }
+
+    return VerticalBox;
+}
+
+TSharedRef< ITableRow >
+FHoudiniAssetComponentDetails::OnGenerateStaticMeshOutputRow(
+    TSharedPtr< FHoudiniStaticMeshOutputItem > OutputItem, const TSharedRef< STableViewBase > & OwnerTable )
+{
+    UHoudiniAssetComponent * HoudiniAssetComponent = OutputItem.IsValid() ? OutputItem->HoudiniAssetComponent.Get() : nullptr;
+    UStaticMesh * StaticMesh = OutputItem.IsValid() ? OutputItem->StaticMesh.Get() : nullptr;
+    if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() || !StaticMesh || StaticMesh->IsPendingKill() )
+    {
+        // The output has been replaced since the panel was built, it will be gone once the panel refreshes.
+        return SNew( STableRow< TSharedPtr< FHoudiniStaticMeshOutputItem > >, OwnerTable );
+    }
+
+    FHoudiniGeoPartObject & HoudiniGeoPartObject = OutputItem->HoudiniGeoPartObject;
+    FString Label = HoudiniAssetComponent->GetBakingBaseName( HoudiniGeoPartObject );
+
+    return SNew( STableRow< TSharedPtr< FHoudiniStaticMeshOutputItem > >, OwnerTable )
+    .Padding( FMargin( 0.0f, 4.0f ) )
+    [
+        SNew( SVerticalBox )
+        +SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding( 2.0f )
+        [
+            SNew( STextBlock )
+            .Text( FText::FromString( Label ) )
+            .Font( IDetailLayoutBuilder::GetDetailFontBold() )
+        ]
+        +SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding( 2.0f )
+        [
+            SNew( SHorizontalBox )
+            +SHorizontalBox::Slot()
+            .FillWidth( 1.0f )
+            .VAlign( VAlign_Center )
+            [
+                SNew( STextBlock )
+                .Text( LOCTEXT( "BakeBaseName", "Bake Name" ) )
+                .Font( IDetailLayoutBuilder::GetDetailFont() )
+            ]
+            +SHorizontalBox::Slot()
+            .FillWidth( 1.0f )
+            [
+                CreateBakeNameWidget( HoudiniAssetComponent, HoudiniGeoPartObject )
+            ]
+        ]
+        +SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding( 2.0f )
+        [
+            SNew( SHorizontalBox )
+            +SHorizontalBox::Slot()
+            .FillWidth( 1.0f )
+            [
+                SNew( STextBlock )
+                .Text( FText::FromString( GetStaticMeshLabel( StaticMesh, HoudiniGeoPartObject ) ) )
+                .Font( IDetailLayoutBuilder::GetDetailFont() )
+            ]
+            +SHorizontalBox::Slot()
+            .FillWidth( 1.0f )
+            [
+                CreateStaticMeshWidget( HoudiniAssetComponent, StaticMesh, HoudiniGeoPartObject, StaticMeshOutputThumbnailPool )
+            ]
+        ]
+    ];
+}
+
+
 void
 FHoudiniAssetComponentDetails::CreateHoudiniAssetWidget( IDetailCategoryBuilder & DetailCategoryBuilder )
 {
@@ -953,6 +1157,10 @@ FHoudiniAssetComponentDetails::CreateHoudiniAssetWidget( IDetailCategoryBuilder
         LOCTEXT("HoudiniTransformChangeTriggersCooks", "Transform Change Triggers Cooks"),
         FOnCheckStateChanged::CreateSP(this, &FHoudiniAssetComponentDetails::CheckStateChangedComponentSettingTransformCooking, HoudiniAssetComponent),
         TAttribute<ECheckBoxState>::Create(TAttribute<ECheckBoxState>::FGetter::CreateSP(this, &FHoudiniAssetComponentDetails::IsCheckedComponentSettingTransformCooking, HoudiniAssetComponent)));
+    AddOptionRow(
+        LOCTEXT("HoudiniSliderDragTriggersCooks", "Slider Drag Triggers Cooks"),
+        FOnCheckStateChanged::CreateSP(this, &FHoudiniAssetComponentDetails::CheckStateChangedComponentSettingSliderDragCooking, HoudiniAssetComponent),
+        TAttribute<ECheckBoxState>::Create(TAttribute<ECheckBoxState>::FGetter::CreateSP(this, &FHoudiniAssetComponentDetails::IsCheckedComponentSettingSliderDragCooking, HoudiniAssetComponent)));
     AddOptionRow(
         LOCTEXT("HoudiniUseHoudiniMaterials", "Use Native Houdini Materials"),
         FOnCheckStateChanged::CreateSP(this, &FHoudiniAssetComponentDetails::CheckStateChangedComponentSettingUseHoudiniMaterials, HoudiniAssetComponent),
@@ -961,6 +1169,10 @@ FHoudiniAssetComponentDetails::CreateHoudiniAssetWidget( IDetailCategoryBuilder
         LOCTEXT("HoudiniCookingTriggersDownstreamCooks", "Cooking Triggers Downstream Cooks"),
         FOnCheckStateChanged::CreateSP(this, &FHoudiniAssetComponentDetails::CheckStateChangedComponentSettingCookingTriggersDownstreamCooks, HoudiniAssetComponent),
         TAttribute<ECheckBoxState>::Create(TAttribute<ECheckBoxState>::FGetter::CreateSP(this, &FHoudiniAssetComponentDetails::IsCheckedComponentSettingCookingTriggersDownstreamCooks, HoudiniAssetComponent)));
+    AddOptionRow(
+        LOCTEXT("HoudiniPassThroughOnly", "Pass-Through Only (No Unreal Outputs)"),
+        FOnCheckStateChanged::CreateSP(this, &FHoudiniAssetComponentDetails::CheckStateChangedComponentSettingPassThroughOnly, HoudiniAssetComponent),
+        TAttribute<ECheckBoxState>::Create(TAttribute<ECheckBoxState>::FGetter::CreateSP(this, &FHoudiniAssetComponentDetails::IsCheckedComponentSettingPassThroughOnly, HoudiniAssetComponent)));
 
     auto ActionButtonSlot = [&](const FText& InText, const FText& InToolTipText, FOnClicked InOnClicked) -> SHorizontalBox::FSlot&
     {
@@ -1453,9 +1665,6 @@ FHoudiniAssetComponentDetails::OnFetchCookLog()
 {
     TSharedPtr< SWindow > ParentWindow;
 
-    // Get fetch cook status.
-    const FString CookLogString = FHoudiniEngineUtils::GetCookResult();
-
     // Check if the main frame is loaded. When using the old main frame it may not be.
     if ( FModuleManager::Get().IsModuleLoaded( "MainFrame" ) )
     {
@@ -1472,9 +1681,15 @@ FHoudiniAssetComponentDetails::OnFetchCookLog()
                 .Title( LOCTEXT( "WindowTitle", "Houdini Cook Log" ) )
                 .ClientSize( FVector2D( 640, 480 ) );
 
+        // The cook result can be very large, fetch it in the background on the current session.
+        int32 SessionIndex = FHoudiniScopedSession::GetCurrentSessionIndex();
         Window->SetContent( 
             SAssignNew( HoudiniAssetCookLog, SHoudiniAssetLogWidget )
-            .LogText( CookLogString ) );
+            .LogFetcher( [ SessionIndex ]()
+            {
+                FHoudiniScopedSession ScopedSession( SessionIndex );
+                return FHoudiniEngineUtils::GetCookResult();
+            } ) );
 
         FSlateApplication::Get().AddModalWindow( Window, ParentWindow, false );
     }
@@ -1487,6 +1702,8 @@ FHoudiniAssetComponentDetails::OnFetchAssetHelp( UHoudiniAssetComponent * Houdin
 {
     if ( HoudiniAssetComponent )
     {
+        FHoudiniScopedSession ScopedSession( HoudiniAssetComponent->GetSessionIndex() );
+
         HAPI_AssetInfo AssetInfo;
         HAPI_NodeId AssetId = HoudiniAssetComponent->GetAssetId();
 
@@ -1522,7 +1739,8 @@ FHoudiniAssetComponentDetails::OnFetchAssetHelp( UHoudiniAssetComponent * Houdin
 
                         Window->SetContent( 
                             SAssignNew( HoudiniAssetHelpLog, SHoudiniAssetLogWidget )
-                            .LogText( HelpLogString ) );
+                            .LogText( HelpLogString )
+                            .ShowSeverityFilter( false ) );
 
                         FSlateApplication::Get().AddModalWindow( Window, ParentWindow, false );
                     }
@@ -1565,8 +1783,11 @@ FHoudiniAssetComponentDetails::OnMaterialInterfaceDropped(
         if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() )
             continue;
 
+        // The material is replaced on the mesh itself, which must not be shared with a copied component.
+        UStaticMesh * ComponentStaticMesh = HoudiniAssetComponent->UnshareStaticMesh( StaticMesh );
+
         // Retrieve material interface which is being replaced.
-        UMaterialInterface * OldMaterialInterface = StaticMesh->StaticMaterials[ MaterialIdx ].MaterialInterface;
+        UMaterialInterface * OldMaterialInterface = ComponentStaticMesh->StaticMaterials[ MaterialIdx ].MaterialInterface;
 
         if ( OldMaterialInterface == MaterialInterface )
             continue;
@@ -1583,11 +1804,11 @@ FHoudiniAssetComponentDetails::OnMaterialInterfaceDropped(
                 LOCTEXT( "HoudiniMaterialReplacement", "Houdini Material Replacement" ), HoudiniAssetComponent );
 
             // Replace material on static mesh.
-            StaticMesh->Modify();
-            StaticMesh->StaticMaterials[ MaterialIdx ].MaterialInterface = MaterialInterface;
+            ComponentStaticMesh->Modify();
+            ComponentStaticMesh->StaticMaterials[ MaterialIdx ].MaterialInterface = MaterialInterface;
 
             UStaticMeshComponent * StaticMeshComponent =
-                HoudiniAssetComponent->LocateStaticMeshComponent( StaticMesh );
+                HoudiniAssetComponent->LocateStaticMeshComponent( ComponentStaticMesh );
             if ( StaticMeshComponent && !StaticMeshComponent->IsPendingKill() )
             {
                 StaticMeshComponent->Modify();
@@ -1597,7 +1818,7 @@ FHoudiniAssetComponentDetails::OnMaterialInterfaceDropped(
             }
                         
             TArray< UInstancedStaticMeshComponent * > InstancedStaticMeshComponents;
-            if ( HoudiniAssetComponent->LocateInstancedStaticMeshComponents( StaticMesh, InstancedStaticMeshComponents ) )
+            if ( HoudiniAssetComponent->LocateInstancedStaticMeshComponents( ComponentStaticMesh, InstancedStaticMeshComponents ) )
             {
                 for ( int32 Idx = 0; Idx < InstancedStaticMeshComponents.Num(); ++Idx )
                 {
@@ -1822,11 +2043,14 @@ FHoudiniAssetComponentDetails::OnResetMaterialInterfaceClicked(
         if ( AssignedMaterial )
             MaterialInterfaceReplacement = AssignedMaterial;
 
+        // The material is replaced on the mesh itself, which must not be shared with a copied component.
+        UStaticMesh * ComponentStaticMesh = HoudiniAssetComponent->UnshareStaticMesh( StaticMesh );
+
         // Replace material on static mesh.
-        StaticMesh->Modify();
-        StaticMesh->StaticMaterials[ MaterialIdx ].MaterialInterface = MaterialInterfaceReplacement;
+        ComponentStaticMesh->Modify();
+        ComponentStaticMesh->StaticMaterials[ MaterialIdx ].MaterialInterface = MaterialInterfaceReplacement;
 
-        UStaticMeshComponent * StaticMeshComponent = HoudiniAssetComponent->LocateStaticMeshComponent( StaticMesh );
+        UStaticMeshComponent * StaticMeshComponent = HoudiniAssetComponent->LocateStaticMeshComponent( ComponentStaticMesh );
         if ( StaticMeshComponent )
         {
             StaticMeshComponent->Modify();
@@ -1836,7 +2060,7 @@ FHoudiniAssetComponentDetails::OnResetMaterialInterfaceClicked(
         }
 
         TArray< UInstancedStaticMeshComponent * > InstancedStaticMeshComponents;
-        if ( HoudiniAssetComponent->LocateInstancedStaticMeshComponents( StaticMesh, InstancedStaticMeshComponents ) )
+        if ( HoudiniAssetComponent->LocateInstancedStaticMeshComponents( ComponentStaticMesh, InstancedStaticMeshComponents ) )
         {
             for ( int32 Idx = 0; Idx < InstancedStaticMeshComponents.Num(); ++Idx )
             {
@@ -2075,6 +2299,16 @@ FHoudiniAssetComponentDetails::IsCheckedComponentSettingTransformCooking(
     return ECheckBoxState::Unchecked;
 }
 
+ECheckBoxState
+FHoudiniAssetComponentDetails::IsCheckedComponentSettingSliderDragCooking(
+    UHoudiniAssetComponent * HoudiniAssetComponent ) const
+{
+    if ( HoudiniAssetComponent && HoudiniAssetComponent->bSliderDragTriggersCooks )
+        return ECheckBoxState::Checked;
+
+    return ECheckBoxState::Unchecked;
+}
+
 ECheckBoxState
 FHoudiniAssetComponentDetails::IsCheckedComponentSettingUseHoudiniMaterials(
     UHoudiniAssetComponent * HoudiniAssetComponent ) const
@@ -2095,6 +2329,16 @@ FHoudiniAssetComponentDetails::IsCheckedComponentSettingCookingTriggersDownstrea
     return ECheckBoxState::Unchecked;
 }
 
+ECheckBoxState
+FHoudiniAssetComponentDetails::IsCheckedComponentSettingPassThroughOnly(
+    UHoudiniAssetComponent * HoudiniAssetComponent ) const
+{
+    if ( HoudiniAssetComponent && HoudiniAssetComponent->bPassThroughOnly )
+        return ECheckBoxState::Checked;
+
+    return ECheckBoxState::Unchecked;
+}
+
 void
 FHoudiniAssetComponentDetails::CheckStateChangedComponentSettingCooking(
     ECheckBoxState NewState,
@@ -2122,6 +2366,24 @@ FHoudiniAssetComponentDetails::CheckStateChangedComponentSettingTransformCooking
         HoudiniAssetComponent->bTransformChangeTriggersCooks = ( NewState == ECheckBoxState::Checked );
 }
 
+void
+FHoudiniAssetComponentDetails::CheckStateChangedComponentSettingSliderDragCooking(
+    ECheckBoxState NewState,
+    UHoudiniAssetComponent * HoudiniAssetComponent )
+{
+    if ( HoudiniAssetComponent )
+        HoudiniAssetComponent->bSliderDragTriggersCooks = ( NewState == ECheckBoxState::Checked );
+}
+
+void
+FHoudiniAssetComponentDetails::CheckStateChangedComponentSettingPassThroughOnly(
+    ECheckBoxState NewState,
+    UHoudiniAssetComponent * HoudiniAssetComponent )
+{
+    if ( HoudiniAssetComponent )
+        HoudiniAssetComponent->SetPassThroughOnly( NewState == ECheckBoxState::Checked );
+}
+
 void
 FHoudiniAssetComponentDetails::CheckStateChangedComponentSettingUseHoudiniMaterials(
     ECheckBoxState NewState,
@@ -39,6 +39,8 @@
 #include "Materials/MaterialInterface.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Input/SComboButton.h"
+#include "Widgets/Views/STableViewBase.h"
+#include "Widgets/Views/ITableRow.h"
 
 
 struct FGeometry;
@@ -50,12 +52,26 @@ class UStaticMesh;
 class IDetailLayoutBuilder;
 class UHoudiniAssetComponent;
 class ALandscape;
+class FAssetThumbnailPool;
 
 
 /** Hashing function for our pair. **/
 uint32 GetTypeHash( TPair< UStaticMesh *, int32 > Pair );
 uint32 GetTypeHash( TPair< ALandscape *, int32 > Pair );
 
+/** Generated static mesh shown in the output list of the details panel. **/
+struct FHoudiniStaticMeshOutputItem
+{
+    /** Component which generated the static mesh. **/
+    TWeakObjectPtr< UHoudiniAssetComponent > HoudiniAssetComponent;
+
+    /** Generated static mesh. **/
+    TWeakObjectPtr< UStaticMesh > StaticMesh;
+
+    /** Geo part the static mesh was generated from. **/
+    FHoudiniGeoPartObject HoudiniGeoPartObject;
+};
+
 class FHoudiniAssetComponentDetails : public IDetailCustomization
 {
     public:
@@ -81,6 +97,23 @@ class FHoudiniAssetComponentDetails : public IDetailCustomization
         /** Helper method used to create widgets for generated static meshes. **/
         void CreateStaticMeshAndMaterialWidgets( IDetailCategoryBuilder & DetailCategoryBuilder );
 
+        /** Create the rows showing the memory used by the cooked outputs, per category. **/
+        void CreateOutputMemoryWidgets( IDetailCategoryBuilder & DetailCategoryBuilder );
+
+        /** Helper methods used to create the widgets of a single generated static mesh. **/
+        TSharedRef< SWidget > CreateBakeNameWidget(
+            UHoudiniAssetComponent * HoudiniAssetComponent, const FHoudiniGeoPartObject & HoudiniGeoPartObject );
+        TSharedRef< SWidget > CreateStaticMeshWidget(
+            UHoudiniAssetComponent * HoudiniAssetComponent, UStaticMesh * StaticMesh,
+            FHoudiniGeoPartObject & HoudiniGeoPartObject, TSharedPtr< FAssetThumbnailPool > AssetThumbnailPool );
+
+        /** Returns the label describing the collision, LODs and sockets of a generated static mesh. **/
+        FString GetStaticMeshLabel( UStaticMesh * StaticMesh, const FHoudiniGeoPartObject & HoudiniGeoPartObject ) const;
+
+        /** Builds the row of a generated static mesh once it is scrolled into view in the output list. **/
+        TSharedRef< ITableRow > OnGenerateStaticMeshOutputRow(
+            TSharedPtr< FHoudiniStaticMeshOutputItem > OutputItem, const TSharedRef< STableViewBase > & OwnerTable );
+
         /** Helper method used to create widget for Houdini asset. **/
         void CreateHoudiniAssetWidget( IDetailCategoryBuilder & DetailCategoryBuilder );
 
@@ -220,12 +253,18 @@ class FHoudiniAssetComponentDetails : public IDetailCustomization
         ECheckBoxState IsCheckedComponentSettingTransformCooking(
             UHoudiniAssetComponent * HoudiniAssetComponent ) const;
 
+        ECheckBoxState IsCheckedComponentSettingSliderDragCooking(
+            UHoudiniAssetComponent * HoudiniAssetComponent ) const;
+
         ECheckBoxState IsCheckedComponentSettingUseHoudiniMaterials(
             UHoudiniAssetComponent * HoudiniAssetComponent ) const;
 
         ECheckBoxState IsCheckedComponentSettingCookingTriggersDownstreamCooks(
             UHoudiniAssetComponent * HoudiniAssetComponent ) const;
 
+        ECheckBoxState IsCheckedComponentSettingPassThroughOnly(
+            UHoudiniAssetComponent * HoudiniAssetComponent ) const;
+
         /** Handle change in Checkbox. **/
         void CheckStateChangedComponentSettingCooking(
             ECheckBoxState NewState, UHoudiniAssetComponent * HoudiniAssetComponent );
@@ -238,6 +277,10 @@ class FHoudiniAssetComponentDetails : public IDetailCustomization
             ECheckBoxState NewState,
             UHoudiniAssetComponent * HoudiniAssetComponent );
 
+        void CheckStateChangedComponentSettingSliderDragCooking(
+            ECheckBoxState NewState,
+            UHoudiniAssetComponent * HoudiniAssetComponent );
+
         void CheckStateChangedComponentSettingUseHoudiniMaterials(
             ECheckBoxState NewState,
             UHoudiniAssetComponent * HoudiniAssetComponent );
@@ -246,11 +289,18 @@ class FHoudiniAssetComponentDetails : public IDetailCustomization
             ECheckBoxState NewState,
             UHoudiniAssetComponent * HoudiniAssetComponent );
 
+        void CheckStateChangedComponentSettingPassThroughOnly(
+            ECheckBoxState NewState,
+            UHoudiniAssetComponent * HoudiniAssetComponent );
+
     private:
 
         /** Components which are being customized. **/
         TArray< UHoudiniAssetComponent * > HoudiniAssetComponents;
 
+        /** Group of the customized components when several are edited together, released with the customization. **/
+        TSharedPtr< struct FHoudiniMultiEditGroup > MultiEditGroup;
+
         /** Map of static meshes and corresponding thumbnail borders. **/
         TMap< UStaticMesh *, TSharedPtr< SBorder > > StaticMeshThumbnailBorders;
 
@@ -260,6 +310,12 @@ class FHoudiniAssetComponentDetails : public IDetailCustomization
         /** Map of static meshes / material indices to thumbnail borders. **/
         TMap< TPair< UStaticMesh *, int32 >, TSharedPtr< SBorder > > MaterialInterfaceThumbnailBorders;
 
+        /** Generated static meshes shown in the output list, when there are too many for individual groups. **/
+        TArray< TSharedPtr< FHoudiniStaticMeshOutputItem > > StaticMeshOutputItems;
+
+        /** Thumbnail pool used by the output list. **/
+        TSharedPtr< FAssetThumbnailPool > StaticMeshOutputThumbnailPool;
+
         /** Map of Landscapes and corresponding thumbnail borders. **/
         TMap< ALandscape *, TSharedPtr< SBorder > > LandscapeThumbnailBorders;
 
@@ -146,6 +146,20 @@ UHoudiniAssetFactory::Reimport( UObject * Obj )
         if ( !Filename.Len() || IFileManager::Get().FileSize( *Filename ) == INDEX_NONE )
             return EReimportResult::Failed;
 
+        // Skip the reimport when the file content is identical, it would recreate the asset and
+        // reinstantiate and recook every component using it for nothing.
+        TArray< uint8 > FileBytes;
+        if ( FFileHelper::LoadFileToArray( FileBytes, *Filename ) )
+        {
+            const FString FileBytesHash = UHoudiniAsset::ComputeAssetBytesHash( FileBytes.GetData(), FileBytes.Num() );
+            if ( !FileBytesHash.IsEmpty() && FileBytesHash == HoudiniAsset->GetAssetBytesHash() )
+            {
+                HOUDINI_LOG_MESSAGE( TEXT( "Houdini Asset %s is unchanged, skipping reimport." ), *HoudiniAsset->GetName() );
+                HoudiniAsset->AssetImportData->Update( Filename );
+                return EReimportResult::Succeeded;
+            }
+        }
+
         if ( UFactory::StaticImportObject(
             HoudiniAsset->GetClass(), HoudiniAsset->GetOuter(), *HoudiniAsset->GetName(),
             RF_Public | RF_Standalone, *Filename, NULL, this ) )
@@ -32,27 +32,284 @@
 #include "HoudiniApi.h"
 #include "HoudiniAssetLogWidget.h"
 #include "HoudiniEngineEditorPrivatePCH.h"
-#include "Widgets/Layout/SScrollBox.h"
-#include "Widgets/Input/SMultiLineEditableTextBox.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/SBoxPanel.h"
+#include "HAL/PlatformApplicationMisc.h"
+#include "Async/Async.h"
 #include "EditorStyleSet.h"
 
+#define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
+
 void
 SHoudiniAssetLogWidget::Construct( const FArguments & InArgs )
 {
+    bShowSeverity[ (uint8)EHoudiniAssetLogSeverity::Message ] = true;
+    bShowSeverity[ (uint8)EHoudiniAssetLogSeverity::Warning ] = true;
+    bShowSeverity[ (uint8)EHoudiniAssetLogSeverity::Error ] = true;
+
+    FetchState = MakeShareable( new FHoudiniAssetLogFetchState() );
+    if ( InArgs._LogFetcher )
+    {
+        // Fetch the log on a worker thread, the lines are picked up by UpdateLogLines.
+        TSharedPtr< FHoudiniAssetLogFetchState, ESPMode::ThreadSafe > State = FetchState;
+        TFunction< FString() > LogFetcher = InArgs._LogFetcher;
+        Async< void >( EAsyncExecution::ThreadPool, [ State, LogFetcher ]()
+        {
+            if ( !State->bCancelled )
+                AddLogLines( LogFetcher(), *State );
+
+            State->bFetchComplete = true;
+        } );
+    }
+    else
+    {
+        AddLogLines( InArgs._LogText, *FetchState );
+        FetchState->bFetchComplete = true;
+    }
+
+    TSharedRef< SHorizontalBox > FilterBox = SNew( SHorizontalBox );
+    if ( InArgs._ShowSeverityFilter )
+    {
+        auto AddSeverityFilter = [ this, &FilterBox ]( EHoudiniAssetLogSeverity Severity, const FText & Label )
+        {
+            FilterBox->AddSlot()
+            .AutoWidth()
+            .Padding( 2.0f, 0.0f, 8.0f, 0.0f )
+            [
+                SNew( SCheckBox )
+                .IsChecked( this, &SHoudiniAssetLogWidget::IsSeverityShown, Severity )
+                .OnCheckStateChanged( this, &SHoudiniAssetLogWidget::OnSeverityShownChanged, Severity )
+                [
+                    SNew( STextBlock )
+                    .Text( Label )
+                ]
+            ];
+        };
+
+        AddSeverityFilter( EHoudiniAssetLogSeverity::Error, LOCTEXT( "LogShowErrors", "Errors" ) );
+        AddSeverityFilter( EHoudiniAssetLogSeverity::Warning, LOCTEXT( "LogShowWarnings", "Warnings" ) );
+        AddSeverityFilter( EHoudiniAssetLogSeverity::Message, LOCTEXT( "LogShowMessages", "Messages" ) );
+    }
+
+    FilterBox->AddSlot()
+    .FillWidth( 1.0f )
+    .HAlign( HAlign_Right )
+    [
+        SNew( STextBlock )
+        .Text( this, &SHoudiniAssetLogWidget::GetStatusText )
+    ];
+
     this->ChildSlot
     [
         SNew( SBorder )
         .BorderImage( FEditorStyle::GetBrush( TEXT( "Menu.Background" ) ) )
         .Content()
         [
-            SNew( SScrollBox )
-            + SScrollBox::Slot()
+            SNew( SVerticalBox )
+            + SVerticalBox::Slot()
+            .AutoHeight()
+            .Padding( 2.0f )
+            [
+                FilterBox
+            ]
+            + SVerticalBox::Slot()
+            .FillHeight( 1.0f )
             [
-                SNew( SMultiLineEditableTextBox )
-                .Text( FText::FromString( InArgs._LogText ) )
-                .AutoWrapText( true )
-                .IsReadOnly( true )
+                SAssignNew( LogListView, SListView< TSharedPtr< FHoudiniAssetLogLine > > )
+                .ListItemsSource( &FilteredLogLines )
+                .SelectionMode( ESelectionMode::Multi )
+                .OnGenerateRow( this, &SHoudiniAssetLogWidget::OnGenerateLogLineRow )
             ]
         ]
     ];
+
+    // Pick up the lines right away so short logs show up without waiting a frame.
+    UpdateLogLines( 0.0, 0.0f );
+    if ( !FetchState->bFetchComplete || FetchState->PendingLines.Num() > 0 )
+        RegisterActiveTimer( 0.0f, FWidgetActiveTimerDelegate::CreateSP( this, &SHoudiniAssetLogWidget::UpdateLogLines ) );
+}
+
+SHoudiniAssetLogWidget::~SHoudiniAssetLogWidget()
+{
+    // Let the worker skip its work if it has not started yet.
+    if ( FetchState.IsValid() )
+        FetchState->bCancelled = true;
+}
+
+void
+SHoudiniAssetLogWidget::AddLogLines( const FString & LogText, FHoudiniAssetLogFetchState & State )
+{
+    TArray< TSharedPtr< FHoudiniAssetLogLine > > Chunk;
+    Chunk.Reserve( HAPI_UNREAL_LOG_WIDGET_LINES_PER_TICK );
+
+    const TCHAR * LineStart = *LogText;
+    while ( *LineStart && !State.bCancelled )
+    {
+        const TCHAR * LineEnd = LineStart;
+        while ( *LineEnd && *LineEnd != TEXT( '\n' ) )
+            LineEnd++;
+
+        int32 LineLength = LineEnd - LineStart;
+        if ( LineLength > 0 && LineStart[ LineLength - 1 ] == TEXT( '\r' ) )
+            LineLength--;
+
+        FString Line( LineLength, LineStart );
+        EHoudiniAssetLogSeverity Severity = GetLogLineSeverity( Line );
+        Chunk.Add( MakeShareable( new FHoudiniAssetLogLine( Line, Severity ) ) );
+
+        if ( Chunk.Num() >= HAPI_UNREAL_LOG_WIDGET_LINES_PER_TICK )
+        {
+            FScopeLock ScopeLock( &State.Lock );
+            State.PendingLines.Append( MoveTemp( Chunk ) );
+            Chunk.Reset();
+        }
+
+        LineStart = *LineEnd ? LineEnd + 1 : LineEnd;
+    }
+
+    FScopeLock ScopeLock( &State.Lock );
+    State.PendingLines.Append( MoveTemp( Chunk ) );
+}
+
+EHoudiniAssetLogSeverity
+SHoudiniAssetLogWidget::GetLogLineSeverity( const FString & Line )
+{
+    FString TrimmedLine = Line.TrimStart();
+    if ( TrimmedLine.StartsWith( TEXT( "Error" ) ) || TrimmedLine.StartsWith( TEXT( "Fatal" ) ) )
+        return EHoudiniAssetLogSeverity::Error;
+
+    if ( TrimmedLine.StartsWith( TEXT( "Warning" ) ) )
+        return EHoudiniAssetLogSeverity::Warning;
+
+    return EHoudiniAssetLogSeverity::Message;
+}
+
+EActiveTimerReturnType
+SHoudiniAssetLogWidget::UpdateLogLines( double InCurrentTime, float InDeltaTime )
+{
+    // Check for completion before taking the lines, so none are left behind once we stop.
+    bool bFetchComplete = FetchState->bFetchComplete;
+
+    TArray< TSharedPtr< FHoudiniAssetLogLine > > NewLines;
+    bool bHasMoreLines = false;
+    {
+        FScopeLock ScopeLock( &FetchState->Lock );
+        int32 NumLines = FMath::Min( FetchState->PendingLines.Num(), HAPI_UNREAL_LOG_WIDGET_LINES_PER_TICK );
+        NewLines.Append( FetchState->PendingLines.GetData(), NumLines );
+        FetchState->PendingLines.RemoveAt( 0, NumLines, false );
+        bHasMoreLines = FetchState->PendingLines.Num() > 0;
+    }
+
+    if ( NewLines.Num() > 0 )
+    {
+        LogLines.Append( NewLines );
+        for ( const TSharedPtr< FHoudiniAssetLogLine > & Line : NewLines )
+        {
+            if ( IsLineVisible( Line ) )
+                FilteredLogLines.Add( Line );
+        }
+
+        if ( LogListView.IsValid() )
+            LogListView->RequestListRefresh();
+    }
+
+    if ( bFetchComplete && !bHasMoreLines )
+    {
+        FetchState->PendingLines.Empty();
+        return EActiveTimerReturnType::Stop;
+    }
+
+    return EActiveTimerReturnType::Continue;
+}
+
+bool
+SHoudiniAssetLogWidget::IsLineVisible( const TSharedPtr< FHoudiniAssetLogLine > & Line ) const
+{
+    return Line.IsValid() && bShowSeverity[ (uint8)Line->Severity ];
+}
+
+void
+SHoudiniAssetLogWidget::RefreshFilteredLines()
+{
+    FilteredLogLines.Reset();
+    for ( const TSharedPtr< FHoudiniAssetLogLine > & Line : LogLines )
+    {
+        if ( IsLineVisible( Line ) )
+            FilteredLogLines.Add( Line );
+    }
+
+    if ( LogListView.IsValid() )
+        LogListView->RequestListRefresh();
+}
+
+ECheckBoxState
+SHoudiniAssetLogWidget::IsSeverityShown( EHoudiniAssetLogSeverity Severity ) const
+{
+    return bShowSeverity[ (uint8)Severity ] ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void
+SHoudiniAssetLogWidget::OnSeverityShownChanged( ECheckBoxState NewState, EHoudiniAssetLogSeverity Severity )
+{
+    bShowSeverity[ (uint8)Severity ] = ( NewState == ECheckBoxState::Checked );
+    RefreshFilteredLines();
+}
+
+FText
+SHoudiniAssetLogWidget::GetStatusText() const
+{
+    if ( !FetchState->bFetchComplete && LogLines.Num() <= 0 )
+        return LOCTEXT( "LogFetching", "Fetching..." );
+
+    return FText::Format(
+        LOCTEXT( "LogLineCount", "{0} of {1} lines" ),
+        FText::AsNumber( FilteredLogLines.Num() ), FText::AsNumber( LogLines.Num() ) );
+}
+
+TSharedRef< ITableRow >
+SHoudiniAssetLogWidget::OnGenerateLogLineRow(
+    TSharedPtr< FHoudiniAssetLogLine > Line, const TSharedRef< STableViewBase > & OwnerTable )
+{
+    FSlateColor LineColor = FSlateColor::UseForeground();
+    if ( Line.IsValid() && Line->Severity == EHoudiniAssetLogSeverity::Error )
+        LineColor = FLinearColor( 1.0f, 0.25f, 0.25f );
+    else if ( Line.IsValid() && Line->Severity == EHoudiniAssetLogSeverity::Warning )
+        LineColor = FLinearColor( 1.0f, 0.8f, 0.2f );
+
+    return SNew( STableRow< TSharedPtr< FHoudiniAssetLogLine > >, OwnerTable )
+    [
+        SNew( STextBlock )
+        .Text( FText::FromString( Line.IsValid() ? Line->Text : FString() ) )
+        .ColorAndOpacity( LineColor )
+        .AutoWrapText( true )
+    ];
+}
+
+FReply
+SHoudiniAssetLogWidget::OnKeyDown( const FGeometry & MyGeometry, const FKeyEvent & InKeyEvent )
+{
+    if ( InKeyEvent.IsControlDown() && InKeyEvent.GetKey() == EKeys::C && LogListView.IsValid() )
+    {
+        // Keep the lines in the log's order rather than in selection order.
+        TSet< TSharedPtr< FHoudiniAssetLogLine > > SelectedLines( LogListView->GetSelectedItems() );
+        FString SelectedText;
+        for ( const TSharedPtr< FHoudiniAssetLogLine > & Line : FilteredLogLines )
+        {
+            if ( SelectedLines.Contains( Line ) )
+            {
+                SelectedText += Line->Text;
+                SelectedText += LINE_TERMINATOR;
+            }
+        }
+
+        FPlatformApplicationMisc::ClipboardCopy( *SelectedText );
+        return FReply::Handled();
+    }
+
+    return SCompoundWidget::OnKeyDown( MyGeometry, InKeyEvent );
 }
+
+#undef LOCTEXT_NAMESPACE
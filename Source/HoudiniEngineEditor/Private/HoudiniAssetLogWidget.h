@@ -32,19 +32,110 @@
 #pragma once
 #include "Widgets/DeclarativeSyntaxSupport.h"
 #include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "Styling/SlateTypes.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/ThreadSafeBool.h"
 
 
+/** Severity of a log line, used for filtering. **/
+enum class EHoudiniAssetLogSeverity : uint8
+{
+    Message,
+    Warning,
+    Error
+};
+
+/** A single line of a log. **/
+struct FHoudiniAssetLogLine
+{
+    FHoudiniAssetLogLine( const FString & InText, EHoudiniAssetLogSeverity InSeverity )
+        : Text( InText )
+        , Severity( InSeverity )
+    {}
+
+    FString Text;
+    EHoudiniAssetLogSeverity Severity;
+};
+
+/** Lines produced by a background fetch, waiting to be added to the widget. **/
+struct FHoudiniAssetLogFetchState
+{
+    FHoudiniAssetLogFetchState()
+        : bFetchComplete( false )
+        , bCancelled( false )
+    {}
+
+    FCriticalSection Lock;
+    TArray< TSharedPtr< FHoudiniAssetLogLine > > PendingLines;
+    FThreadSafeBool bFetchComplete;
+    FThreadSafeBool bCancelled;
+};
+
 class SHoudiniAssetLogWidget : public SCompoundWidget
 {
 public:
 
     SLATE_BEGIN_ARGS( SHoudiniAssetLogWidget )
         : _LogText( TEXT( "" ) )
+        , _ShowSeverityFilter( true )
     {}
 
     SLATE_ARGUMENT( FString, LogText )
+
+    /** If set, the log is fetched with this function on a worker thread instead of using LogText. **/
+    SLATE_ARGUMENT( TFunction< FString() >, LogFetcher )
+
+    /** Whether to show the severity filter. **/
+    SLATE_ARGUMENT( bool, ShowSeverityFilter )
         SLATE_END_ARGS()
 
     /** Widget construct. **/
     void Construct( const FArguments & InArgs );
+
+    virtual ~SHoudiniAssetLogWidget();
+
+    /** Copies the selected lines to the clipboard on Ctrl+C. **/
+    virtual FReply OnKeyDown( const FGeometry & MyGeometry, const FKeyEvent & InKeyEvent ) override;
+
+protected:
+
+    /** Splits a log into lines and appends them to the fetch state in chunks. **/
+    static void AddLogLines( const FString & LogText, FHoudiniAssetLogFetchState & FetchState );
+
+    /** Guesses the severity of a log line from its prefix. **/
+    static EHoudiniAssetLogSeverity GetLogLineSeverity( const FString & Line );
+
+    /** Moves a limited number of fetched lines into the list view every frame. **/
+    EActiveTimerReturnType UpdateLogLines( double InCurrentTime, float InDeltaTime );
+
+    /** Returns true if the line passes the severity filter. **/
+    bool IsLineVisible( const TSharedPtr< FHoudiniAssetLogLine > & Line ) const;
+
+    /** Rebuilds the filtered lines after the severity filter changed. **/
+    void RefreshFilteredLines();
+
+    /** Handlers for the severity filter. **/
+    ECheckBoxState IsSeverityShown( EHoudiniAssetLogSeverity Severity ) const;
+    void OnSeverityShownChanged( ECheckBoxState NewState, EHoudiniAssetLogSeverity Severity );
+
+    /** Text of the status line, line count and fetch progress. **/
+    FText GetStatusText() const;
+
+    TSharedRef< ITableRow > OnGenerateLogLineRow(
+        TSharedPtr< FHoudiniAssetLogLine > Line, const TSharedRef< STableViewBase > & OwnerTable );
+
+protected:
+
+    /** All the lines of the log, and the lines passing the filter. **/
+    TArray< TSharedPtr< FHoudiniAssetLogLine > > LogLines;
+    TArray< TSharedPtr< FHoudiniAssetLogLine > > FilteredLogLines;
+
+    /** Lines fetched in the background, shared with the worker thread. **/
+    TSharedPtr< FHoudiniAssetLogFetchState, ESPMode::ThreadSafe > FetchState;
+
+    TSharedPtr< SListView< TSharedPtr< FHoudiniAssetLogLine > > > LogListView;
+
+    /** Whether the lines of each severity are shown, indexed by severity. **/
+    bool bShowSeverity[ 3 ];
 };
@@ -73,6 +73,12 @@ UHoudiniAssetThumbnailRenderer::Draw(
     }
 }
 
+bool
+UHoudiniAssetThumbnailRenderer::AllowsRealtimeThumbnails( UObject * Object ) const
+{
+    return false;
+}
+
 void
 UHoudiniAssetThumbnailRenderer::BeginDestroy()
 {
@@ -54,6 +54,9 @@ class UHoudiniAssetThumbnailRenderer : public UDefaultSizedThumbnailRenderer
             FRenderTarget * RenderTarget,
             FCanvas * Canvas) override;
 
+        /** Houdini asset thumbnails never change on their own, they don't have to be redrawn every frame. **/
+        virtual bool AllowsRealtimeThumbnails( UObject * Object ) const override;
+
     /** UObject methods. **/
     public:
 
@@ -39,6 +39,7 @@
 
 FHoudiniAssetThumbnailScene::FHoudiniAssetThumbnailScene()
     : FThumbnailPreviewScene()
+    , bPreviewGeometryPlaced( false )
 {
     bForceAllUsedMipsResident = false;
 
@@ -74,18 +75,24 @@ FHoudiniAssetThumbnailScene::SetHoudiniAsset( UHoudiniAsset * HoudiniAsset )
     if (!PreviewHoudiniAssetActor->HoudiniAssetComponent || !PreviewHoudiniAssetActor->HoudiniAssetComponent->IsValidLowLevel())
         return;
 
+    // Preview components never instantiate their asset, so every thumbnail shows the same Houdini logo geometry.
+    // Only the asset's thumbnail info differs, handing the asset to the component would rebuild the logo each time.
+    PreviewHoudiniAsset = HoudiniAsset;
+
+    if ( bPreviewGeometryPlaced )
+        return;
+
     if ( PreviewHoudiniAssetComponent->ContainsHoudiniLogoGeometry() )
     {
+        PreviewHoudiniAssetComponent->UpdateBounds();
         float BoundsZOffset = GetBoundsZOffset( PreviewHoudiniAssetComponent->Bounds );
 
         PreviewHoudiniAssetActor->SetActorLocation( FVector( 0.0f, 0.0f, BoundsZOffset ), false );
         PreviewHoudiniAssetActor->SetActorRotation( FRotator( 0.0f, 175.0f, 0.0f ) );
     }
 
-    PreviewHoudiniAssetComponent->SetHoudiniAsset( HoudiniAsset );
-    PreviewHoudiniAssetComponent->UpdateBounds();
-
     PreviewHoudiniAssetComponent->RecreateRenderState_Concurrent();
+    bPreviewGeometryPlaced = true;
 }
 
 void
@@ -108,8 +115,8 @@ FHoudiniAssetThumbnailScene::GetViewMatrixParameters(
     const float BoundsZOffset = GetBoundsZOffset( PreviewHoudiniAssetComponent->Bounds );
     const float TargetDistance = HalfMeshSize / FMath::Tan( HalfFOVRadians );
 
-    UHoudiniAsset * PreviewHoudiniAsset = PreviewHoudiniAssetComponent->GetHoudiniAsset();
-    USceneThumbnailInfo * ThumbnailInfo = Cast<USceneThumbnailInfo>( PreviewHoudiniAsset->ThumbnailInfo );
+    USceneThumbnailInfo * ThumbnailInfo =
+        PreviewHoudiniAsset.IsValid() ? Cast<USceneThumbnailInfo>( PreviewHoudiniAsset->ThumbnailInfo ) : nullptr;
 
     if ( ThumbnailInfo )
     {
@@ -60,4 +60,10 @@ class FHoudiniAssetThumbnailScene : public FThumbnailPreviewScene
 
         /** The Houdini asset actor used to display all Houdini asset thumbnails */
         AHoudiniAssetActor* PreviewHoudiniAssetActor;
+
+        /** Houdini asset whose thumbnail info is used by the next GetView(). **/
+        TWeakObjectPtr< UHoudiniAsset > PreviewHoudiniAsset;
+
+        /** Whether the preview geometry has been placed and its render state created. **/
+        bool bPreviewGeometryPlaced;
 };
@@ -41,6 +41,7 @@
 #include "HoudiniAssetActorFactory.h"
 #include "HoudiniShelfEdMode.h"
 #include "HoudiniEngineBakeUtils.h"
+#include "HoudiniEngineScheduler.h"
 
 #include "UnrealEdGlobals.h"
 #include "Editor/UnrealEdEngine.h"
@@ -50,6 +51,8 @@
 #include "SHoudiniToolPalette.h"
 #include "IPlacementModeModule.h"
 #include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
 #include "AssetRegistryModule.h"
 #include "Engine/Selection.h"
 #include "ContentBrowserModule.h"
@@ -62,6 +65,9 @@
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Interfaces/IPluginManager.h"
+#include "Async/Async.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
 
@@ -287,6 +293,10 @@ FHoudiniEngineEditor::StartupModule()
     // Store the instance.
     FHoudiniEngineEditor::HoudiniEngineEditorInstance = this;
 
+    // Read the tool index from the last session and bring it up to date in the background.
+    LoadHoudiniToolIndex();
+    StartHoudiniToolScan();
+
     HOUDINI_LOG_MESSAGE( TEXT("Houdini Engine Editor module startup complete." ) );
 }
 
@@ -295,9 +305,23 @@ FHoudiniEngineEditor::ShutdownModule()
 {
     HOUDINI_LOG_MESSAGE( TEXT( "Shutting down the Houdini Engine Editor module." ) );
 
+    // Wait for the tool directories scan to finish.
+    if ( HoudiniToolScanFuture.IsValid() )
+        HoudiniToolScanFuture.Wait();
+
     // Remove the level viewport Menu extender%
     RemoveLevelViewportMenuExtender();
 
+    // Remove the scheduler status from the toolbar, its widget is bound to us.
+    if ( ToolBarExtender.IsValid() )
+    {
+        FLevelEditorModule * LevelEditorModule = FModuleManager::Get().GetModulePtr< FLevelEditorModule >( "LevelEditor" );
+        if ( LevelEditorModule )
+            LevelEditorModule->GetToolBarExtensibilityManager()->RemoveExtender( ToolBarExtender );
+
+        ToolBarExtender.Reset();
+    }
+
     // Unregister asset type actions.
     UnregisterAssetTypeActions();
 
@@ -474,9 +498,102 @@ FHoudiniEngineEditor::ExtendMenu()
             FMenuExtensionDelegate::CreateRaw( this, &FHoudiniEngineEditor::AddHoudiniMenuExtension ) );
         FLevelEditorModule& LevelEditorModule = FModuleManager::LoadModuleChecked< FLevelEditorModule >( "LevelEditor" );
         LevelEditorModule.GetMenuExtensibilityManager()->AddExtender( MainMenuExtender );
+
+        // Show the scheduler status at the end of the level editor toolbar.
+        ToolBarExtender = MakeShareable( new FExtender );
+        ToolBarExtender->AddToolBarExtension(
+            "Game", EExtensionHook::After, HEngineCommands,
+            FToolBarExtensionDelegate::CreateRaw( this, &FHoudiniEngineEditor::AddSchedulerStatusToolBarExtension ) );
+        LevelEditorModule.GetToolBarExtensibilityManager()->AddExtender( ToolBarExtender );
     }
 }
 
+void
+FHoudiniEngineEditor::AddSchedulerStatusToolBarExtension( FToolBarBuilder & ToolBarBuilder )
+{
+    ToolBarBuilder.AddWidget(
+        SNew( SBox )
+        .VAlign( VAlign_Center )
+        .Padding( FMargin( 4.0f, 0.0f ) )
+        [
+            SNew( STextBlock )
+            .Text_Raw( this, &FHoudiniEngineEditor::GetSchedulerStatusText )
+            .ToolTipText_Raw( this, &FHoudiniEngineEditor::GetSchedulerStatusToolTipText )
+        ] );
+}
+
+FText
+FHoudiniEngineEditor::GetSchedulerStatusText() const
+{
+    if ( !FHoudiniEngine::IsInitialized() )
+        return FText::GetEmpty();
+
+    TArray< FHoudiniEngineSchedulerTelemetry > SchedulerTelemetry;
+    FHoudiniEngine::Get().GetSchedulerTelemetry( SchedulerTelemetry );
+
+    const double Now = FPlatformTime::Seconds();
+    int32 PendingTaskCount = 0;
+    double OldestTaskAge = 0.0;
+    float Utilization = 0.0f;
+    for ( const FHoudiniEngineSchedulerTelemetry & Telemetry : SchedulerTelemetry )
+    {
+        for ( int32 TaskType = 0; TaskType < EHoudiniEngineTaskType::MAX; ++TaskType )
+            PendingTaskCount += Telemetry.PendingTaskCounts[ TaskType ];
+
+        if ( Telemetry.OldestTaskQueuedTime > 0.0 )
+            OldestTaskAge = FMath::Max( OldestTaskAge, Now - Telemetry.OldestTaskQueuedTime );
+
+        Utilization += Telemetry.Utilization / SchedulerTelemetry.Num();
+    }
+
+    if ( PendingTaskCount <= 0 )
+        return LOCTEXT( "SchedulerStatusIdle", "Houdini: idle" );
+
+    FFormatNamedArguments Args;
+    Args.Add( TEXT( "PendingTaskCount" ), PendingTaskCount );
+    Args.Add( TEXT( "OldestTaskAge" ), FText::AsNumber( OldestTaskAge, &FNumberFormattingOptions().SetMaximumFractionalDigits( 1 ) ) );
+    Args.Add( TEXT( "Utilization" ), FText::AsPercent( Utilization ) );
+    return FText::Format(
+        LOCTEXT( "SchedulerStatus", "Houdini: {PendingTaskCount} pending, oldest {OldestTaskAge}s, {Utilization} busy" ), Args );
+}
+
+FText
+FHoudiniEngineEditor::GetSchedulerStatusToolTipText() const
+{
+    if ( !FHoudiniEngine::IsInitialized() )
+        return FText::GetEmpty();
+
+    TArray< FHoudiniEngineSchedulerTelemetry > SchedulerTelemetry;
+    FHoudiniEngine::Get().GetSchedulerTelemetry( SchedulerTelemetry );
+
+    const double Now = FPlatformTime::Seconds();
+    FString ToolTip;
+    for ( int32 SessionIndex = 0; SessionIndex < SchedulerTelemetry.Num(); ++SessionIndex )
+    {
+        const FHoudiniEngineSchedulerTelemetry & Telemetry = SchedulerTelemetry[ SessionIndex ];
+        if ( !ToolTip.IsEmpty() )
+            ToolTip += TEXT( "\n" );
+
+        ToolTip += FString::Printf(
+            TEXT( "Session %d: %d instantiations, %d cooks, %d deletions pending, %.0f%% busy, %.0f%% waiting on cook status" ),
+            SessionIndex,
+            Telemetry.PendingTaskCounts[ EHoudiniEngineTaskType::AssetInstantiation ],
+            Telemetry.PendingTaskCounts[ EHoudiniEngineTaskType::AssetCooking ],
+            Telemetry.PendingTaskCounts[ EHoudiniEngineTaskType::AssetDeletion ],
+            Telemetry.Utilization * 100.0f, Telemetry.StatusPollFraction * 100.0f );
+
+        if ( Telemetry.CurrentTaskStartTime > 0.0 )
+        {
+            ToolTip += FString::Printf(
+                TEXT( "\n    Running %s for %.1f s" ),
+                Telemetry.CurrentTaskActorName.IsEmpty() ? TEXT( "a task" ) : *Telemetry.CurrentTaskActorName,
+                Now - Telemetry.CurrentTaskStartTime );
+        }
+    }
+
+    return FText::FromString( ToolTip );
+}
+
 void
 FHoudiniEngineEditor::AddHoudiniMenuExtension( FMenuBuilder & MenuBuilder )
 {
@@ -625,6 +742,17 @@ FHoudiniEngineEditor::CanSaveHIPFile() const
     return FHoudiniEngine::IsInitialized();
 }
 
+/** Return the session indices separated by commas, for the messages listing skipped sessions. **/
+static FString
+HoudiniEngineEditorJoinSessionIndices( const TArray< int32 > & SessionIndices )
+{
+    TArray< FString > SessionStrings;
+    for ( int32 SessionIndex : SessionIndices )
+        SessionStrings.Add( FString::FromInt( SessionIndex ) );
+
+    return FString::Join( SessionStrings, TEXT( ", " ) );
+}
+
 void
 FHoudiniEngineEditor::SaveHIPFile()
 {
@@ -655,16 +783,51 @@ FHoudiniEngineEditor::SaveHIPFile()
             FString Notification = TEXT("Saving internal Houdini scene...");
             FHoudiniEngineUtils::CreateSlateNotification(Notification);
 
+            // Save HIP file of each session through Engine.
+            TArray< int32 > SkippedSessions;
+            TArray< FString > SavedPaths = SaveSessionHIPFiles( SaveFilenames[ 0 ], SkippedSessions );
+
             // ... and a log message
-            HOUDINI_LOG_MESSAGE(TEXT("Saved Houdini scene to %s"), *SaveFilenames[ 0 ] );
+            for ( const FString & SavedPath : SavedPaths )
+                HOUDINI_LOG_MESSAGE( TEXT( "Saved Houdini scene to %s" ), *SavedPath );
+
+            if ( SkippedSessions.Num() > 0 )
+            {
+                FString SkippedString = HoudiniEngineEditorJoinSessionIndices( SkippedSessions );
+                HOUDINI_LOG_WARNING( TEXT( "Could not save the Houdini scene of sessions %s." ), *SkippedString );
+                FHoudiniEngineUtils::CreateSlateNotification(
+                    FString::Printf( TEXT( "Could not save the Houdini scene of sessions %s." ), *SkippedString ) );
+            }
+        }
+    }
+}
 
-            // Get first path.
-			std::string HIPPathConverted( TCHAR_TO_UTF8(*SaveFilenames[0]) );
+TArray< FString >
+FHoudiniEngineEditor::SaveSessionHIPFiles( const FString & HIPPath, TArray< int32 > & SkippedSessions ) const
+{
+    TArray< FString > SavedPaths;
 
-            // Save HIP file through Engine.
-            FHoudiniApi::SaveHIPFile( FHoudiniEngine::Get().GetSession(), HIPPathConverted.c_str(), false );
+    const FString BasePath = FPaths::Combine( FPaths::GetPath( HIPPath ), FPaths::GetBaseFilename( HIPPath ) );
+    const FString Extension = FPaths::GetExtension( HIPPath, true );
+
+    const int32 PoolSize = FHoudiniEngine::Get().GetSessionPoolSize();
+    for ( int32 SessionIndex = 0; SessionIndex < PoolSize; ++SessionIndex )
+    {
+        const HAPI_Session * SessionToSave = FHoudiniEngine::Get().GetPooledSession( SessionIndex );
+        const FString SessionPath = SessionIndex == 0 ? HIPPath : FString::Printf( TEXT( "%s_%d%s" ), *BasePath, SessionIndex, *Extension );
+
+        std::string SessionPathConverted( TCHAR_TO_UTF8( *SessionPath ) );
+        if ( !SessionToSave
+            || FHoudiniApi::SaveHIPFile( SessionToSave, SessionPathConverted.c_str(), false ) != HAPI_RESULT_SUCCESS )
+        {
+            SkippedSessions.Add( SessionIndex );
+            continue;
         }
+
+        SavedPaths.Add( SessionPath );
     }
+
+    return SavedPaths;
 }
 
 bool
@@ -685,13 +848,19 @@ FHoudiniEngineEditor::OpenInHoudini()
         FPlatformProcess::UserTempDir(), 
         TEXT( "HoudiniEngine" ), TEXT( ".hip" ) );
         
-    // Save HIP file through Engine.
-    std::string TempPathConverted( TCHAR_TO_UTF8( *UserTempPath ) );
-    FHoudiniApi::SaveHIPFile(
-        FHoudiniEngine::Get().GetSession(), 
-        TempPathConverted.c_str(), false);
+    // Save HIP file of each session through Engine.
+    TArray< int32 > SkippedSessions;
+    TArray< FString > SavedPaths = SaveSessionHIPFiles( UserTempPath, SkippedSessions );
 
-    if ( !FPaths::FileExists( UserTempPath ) )
+    if ( SkippedSessions.Num() > 0 )
+    {
+        FString SkippedString = HoudiniEngineEditorJoinSessionIndices( SkippedSessions );
+        HOUDINI_LOG_WARNING( TEXT( "Could not open the Houdini scene of sessions %s." ), *SkippedString );
+        FHoudiniEngineUtils::CreateSlateNotification(
+            FString::Printf( TEXT( "Could not open the Houdini scene of sessions %s." ), *SkippedString ) );
+    }
+
+    if ( SavedPaths.Num() <= 0 )
         return;
     
     // Add a slate notification
@@ -701,18 +870,24 @@ FHoudiniEngineEditor::OpenInHoudini()
     // ... and a log message
     HOUDINI_LOG_MESSAGE( TEXT("Opened scene in Houdini.") );
 
-        // Add quotes to the path to avoid issues with spaces
-        UserTempPath = TEXT("\"") + UserTempPath + TEXT("\"");
-    // Then open the hip file in Houdini
+    // Then open the hip file of each session in its own Houdini
     FString LibHAPILocation = FHoudiniEngine::Get().GetLibHAPILocation();
     FString HoudiniLocation = LibHAPILocation + TEXT("//houdini");
-    FPlatformProcess::CreateProc( 
-        *HoudiniLocation, 
-        *UserTempPath, 
-        true, false, false, 
-        nullptr, 0,
-        FPlatformProcess::UserTempDir(),
-        nullptr, nullptr );
+    for ( const FString & SavedPath : SavedPaths )
+    {
+        if ( !FPaths::FileExists( SavedPath ) )
+            continue;
+
+        // Add quotes to the path to avoid issues with spaces
+        FString QuotedPath = TEXT("\"") + SavedPath + TEXT("\"");
+        FPlatformProcess::CreateProc( 
+            *HoudiniLocation, 
+            *QuotedPath, 
+            true, false, false, 
+            nullptr, 0,
+            FPlatformProcess::UserTempDir(),
+            nullptr, nullptr );
+    }
 
     // Unfortunately, LaunchFileInDefaultExternalApplication doesn't seem to be working properly
     //FPlatformProcess::LaunchFileInDefaultExternalApplication( UserTempPath.GetCharArray().GetData(), nullptr, ELaunchVerb::Open );
@@ -1378,7 +1553,7 @@ FHoudiniEngineEditor::GetWorldSelection( TArray< UObject* >& WorldSelection, boo
 bool
 FHoudiniEngineEditor::CanRestartSession() const
 {
-    return true;
+    return !FHoudiniEngine::Get().IsSessionStarting();
 }
 
 void
@@ -1388,18 +1563,8 @@ FHoudiniEngineEditor::RestartSession()
     FString Notification = TEXT("Restarting Current Houdini Session");
     FHoudiniEngineUtils::CreateSlateNotification( Notification );
 
-    // Restart the current Houdini Engine Session
-    bool bSuccess = FHoudiniEngine::Get().RestartSession();
-
-    // Notify all the HoudiniAssetComponent that they need to reinstantiate themselves in the new session.
-    for ( TObjectIterator<UHoudiniAssetComponent> Itr; Itr; ++Itr )
-    {
-        UHoudiniAssetComponent * HoudiniAssetComponent = *Itr;
-        if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() )
-            continue;
-
-        HoudiniAssetComponent->NotifyAssetNeedsToBeReinstantiated();
-    }
+    // Restart the current Houdini Engine Session, all the HoudiniAssetComponents are restored in the new session.
+    bool bSuccess = FHoudiniEngine::Get().RecoverSession();
 
     // Add a slate notification
     if ( bSuccess )
@@ -1606,32 +1771,38 @@ FHoudiniEngineEditor::UpdateHoudiniToolList(const FHoudiniToolDirectory& Houdini
     ToolPath = FPaths::Combine(ToolPath, HoudiniToolsDirectory.ContentDirID );
     ToolPath = ObjectTools::SanitizeObjectPath(ToolPath);
 
-    // List all the json files in the current directory
-    TArray<FString> JSONFiles;
-    IFileManager::Get().FindFiles(JSONFiles, *ToolDirPath, TEXT(".json"));
-    for ( const FString& CurrentJsonFile : JSONFiles )
-    {
-        FString CurrentToolName;
-        EHoudiniToolType CurrentToolType;
-        EHoudiniToolSelectionType CurrentToolSelectionType;
-        FString CurrentToolToolTip;
-        FFilePath CurrentToolIconPath;
-        FFilePath CurrentToolAssetPath;
-        FString CurrentToolHelpURL;
-
-        // Extract the Tool info from the JSON file
-        FString CurrentJsonFilePath = ToolDirPath / CurrentJsonFile;
-        if ( !GetHoudiniToolDescriptionFromJSON(
-            CurrentJsonFilePath, CurrentToolName, CurrentToolType, CurrentToolSelectionType,
-            CurrentToolToolTip, CurrentToolIconPath, CurrentToolAssetPath, CurrentToolHelpURL))
+    // Without a scan in progress, only re-read the json files that changed since they were indexed.
+    // While scanning, the directory's last index is used and the list is rebuilt once the scan is done.
+    if ( !bIsScanningHoudiniTools && RefreshHoudiniToolIndex( ToolDirPath ) )
+        SaveHoudiniToolIndex();
+
+    TMap< FString, FHoudiniToolIndexEntry > ToolEntries;
+    {
+        FScopeLock ScopeLock( &HoudiniToolIndexLock );
+        if ( const TMap< FString, FHoudiniToolIndexEntry > * FoundEntries = HoudiniToolIndex.Find( ToolDirPath ) )
+            ToolEntries = *FoundEntries;
+    }
+
+    // Keep the json files' order stable
+    ToolEntries.KeySort( TLess< FString >() );
+    for ( const auto& CurrentPair : ToolEntries )
+    {
+        const FString& CurrentJsonFile = CurrentPair.Key;
+        const FHoudiniToolIndexEntry& CurrentEntry = CurrentPair.Value;
+        if ( !CurrentEntry.bValid )
             continue;
 
-        FText ToolName = FText::FromString(CurrentToolName);
-        FText ToolTip = FText::FromString(CurrentToolToolTip);
+        EHoudiniToolType CurrentToolType = CurrentEntry.Type;
+        EHoudiniToolSelectionType CurrentToolSelectionType = CurrentEntry.SelectionType;
+        FFilePath CurrentToolAssetPath = FFilePath{ CurrentEntry.AssetPath };
+        FString CurrentToolHelpURL = CurrentEntry.HelpURL;
+
+        FText ToolName = FText::FromString(CurrentEntry.Name);
+        FText ToolTip = FText::FromString(CurrentEntry.ToolTip);
 
-        FString IconPath = FPaths::ConvertRelativePathToFull(CurrentToolIconPath.FilePath);
+        FString IconPath = FPaths::ConvertRelativePathToFull(CurrentEntry.IconPath);
         const FSlateBrush* CustomIconBrush = nullptr;
-        if (FPaths::FileExists(IconPath))
+        if ( CurrentEntry.bIconExists )
         {
             FName BrushName = *IconPath;
             CustomIconBrush = new FSlateDynamicImageBrush(BrushName, FVector2D(40.f, 40.f));
@@ -1695,6 +1866,190 @@ FHoudiniEngineEditor::UpdateHoudiniToolList(const FHoudiniToolDirectory& Houdini
     }
 }
 
+FArchive &
+operator<<( FArchive & Ar, FHoudiniToolIndexEntry & Entry )
+{
+    uint8 Type = (uint8)Entry.Type;
+    uint8 SelectionType = (uint8)Entry.SelectionType;
+
+    Ar << Entry.TimeStamp;
+    Ar << Entry.FileSize;
+    Ar << Entry.bValid;
+    Ar << Entry.Name;
+    Ar << Type;
+    Ar << SelectionType;
+    Ar << Entry.ToolTip;
+    Ar << Entry.IconPath;
+    Ar << Entry.bIconExists;
+    Ar << Entry.AssetPath;
+    Ar << Entry.HelpURL;
+
+    if ( Ar.IsLoading() )
+    {
+        Entry.Type = (EHoudiniToolType)Type;
+        Entry.SelectionType = (EHoudiniToolSelectionType)SelectionType;
+    }
+
+    return Ar;
+}
+
+static FString
+GetHoudiniToolIndexFilePath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("HoudiniEngine") / TEXT("HoudiniToolIndex.bin");
+}
+
+void
+FHoudiniEngineEditor::LoadHoudiniToolIndex()
+{
+    TArray< uint8 > IndexData;
+    if ( !FFileHelper::LoadFileToArray( IndexData, *GetHoudiniToolIndexFilePath(), FILEREAD_Silent ) )
+        return;
+
+    FMemoryReader Reader( IndexData );
+
+    int32 IndexVersion = 0;
+    Reader << IndexVersion;
+    if ( IndexVersion != HAPI_UNREAL_HOUDINI_TOOL_INDEX_VERSION )
+        return;
+
+    TMap< FString, TMap< FString, FHoudiniToolIndexEntry > > LoadedIndex;
+    Reader << LoadedIndex;
+    if ( Reader.IsError() )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "Failed to read the Houdini Tool index, the tool directories will be fully rescanned." ) );
+        return;
+    }
+
+    FScopeLock ScopeLock( &HoudiniToolIndexLock );
+    HoudiniToolIndex = MoveTemp( LoadedIndex );
+}
+
+void
+FHoudiniEngineEditor::SaveHoudiniToolIndex()
+{
+    TArray< uint8 > IndexData;
+    FMemoryWriter Writer( IndexData );
+
+    int32 IndexVersion = HAPI_UNREAL_HOUDINI_TOOL_INDEX_VERSION;
+    Writer << IndexVersion;
+    {
+        FScopeLock ScopeLock( &HoudiniToolIndexLock );
+        Writer << HoudiniToolIndex;
+    }
+
+    if ( !FFileHelper::SaveArrayToFile( IndexData, *GetHoudiniToolIndexFilePath() ) )
+        HOUDINI_LOG_WARNING( TEXT( "Failed to save the Houdini Tool index." ) );
+}
+
+bool
+FHoudiniEngineEditor::RefreshHoudiniToolIndex( const FString & ToolDirPath )
+{
+    if ( ToolDirPath.IsEmpty() )
+        return false;
+
+    TMap< FString, FHoudiniToolIndexEntry > PreviousEntries;
+    {
+        FScopeLock ScopeLock( &HoudiniToolIndexLock );
+        if ( const TMap< FString, FHoudiniToolIndexEntry > * FoundEntries = HoudiniToolIndex.Find( ToolDirPath ) )
+            PreviousEntries = *FoundEntries;
+    }
+
+    // List the json files with their stats in a single pass over the directory
+    TMap< FString, FFileStatData > JSONFiles;
+    IPlatformFile & PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    PlatformFile.IterateDirectoryStat( *ToolDirPath,
+        [ &JSONFiles ]( const TCHAR * FilenameOrDirectory, const FFileStatData & StatData )
+        {
+            if ( !StatData.bIsDirectory && FPaths::GetExtension( FilenameOrDirectory ).Equals( TEXT( "json" ), ESearchCase::IgnoreCase ) )
+                JSONFiles.Add( FPaths::GetCleanFilename( FilenameOrDirectory ), StatData );
+
+            return true;
+        } );
+
+    bool bIndexChanged = JSONFiles.Num() != PreviousEntries.Num();
+    TMap< FString, FHoudiniToolIndexEntry > NewEntries;
+    for ( const auto & CurrentPair : JSONFiles )
+    {
+        const FString & CurrentJsonFile = CurrentPair.Key;
+        const FFileStatData & StatData = CurrentPair.Value;
+
+        // Files that are unchanged since they were indexed are not read again
+        const FHoudiniToolIndexEntry * PreviousEntry = PreviousEntries.Find( CurrentJsonFile );
+        if ( PreviousEntry && PreviousEntry->TimeStamp == StatData.ModificationTime && PreviousEntry->FileSize == StatData.FileSize )
+        {
+            NewEntries.Add( CurrentJsonFile, *PreviousEntry );
+            continue;
+        }
+
+        FHoudiniToolIndexEntry & NewEntry = NewEntries.Add( CurrentJsonFile );
+        NewEntry.TimeStamp = StatData.ModificationTime;
+        NewEntry.FileSize = StatData.FileSize;
+
+        FFilePath IconPath;
+        FFilePath AssetPath;
+        NewEntry.bValid = GetHoudiniToolDescriptionFromJSON(
+            ToolDirPath / CurrentJsonFile, NewEntry.Name, NewEntry.Type, NewEntry.SelectionType,
+            NewEntry.ToolTip, IconPath, AssetPath, NewEntry.HelpURL );
+
+        NewEntry.IconPath = IconPath.FilePath;
+        NewEntry.AssetPath = AssetPath.FilePath;
+        NewEntry.bIconExists = NewEntry.bValid && PlatformFile.FileExists( *FPaths::ConvertRelativePathToFull( NewEntry.IconPath ) );
+
+        bIndexChanged = true;
+    }
+
+    if ( !bIndexChanged )
+        return false;
+
+    FScopeLock ScopeLock( &HoudiniToolIndexLock );
+    HoudiniToolIndex.Add( ToolDirPath, MoveTemp( NewEntries ) );
+
+    return true;
+}
+
+void
+FHoudiniEngineEditor::StartHoudiniToolScan()
+{
+    if ( bIsScanningHoudiniTools )
+        return;
+
+    // The directories are fetched here, as reading the settings has to be done on the game thread
+    TArray< FHoudiniToolDirectory > HoudiniToolsDirectoryArray;
+    GetAllHoudiniToolDirectories( HoudiniToolsDirectoryArray );
+
+    TArray< FString > ToolDirPaths;
+    for ( const FHoudiniToolDirectory & ToolDir : HoudiniToolsDirectoryArray )
+    {
+        if ( !ToolDir.Path.Path.IsEmpty() )
+            ToolDirPaths.AddUnique( ToolDir.Path.Path );
+    }
+
+    bIsScanningHoudiniTools = true;
+    HoudiniToolScanFuture = Async< void >( EAsyncExecution::ThreadPool, [ this, ToolDirPaths ]()
+    {
+        bool bIndexChanged = false;
+        for ( const FString & ToolDirPath : ToolDirPaths )
+            bIndexChanged |= RefreshHoudiniToolIndex( ToolDirPath );
+
+        AsyncTask( ENamedThreads::GameThread, [ bIndexChanged ]()
+        {
+            // The module may have been shut down while the scan was finishing
+            if ( !FModuleManager::Get().IsModuleLoaded( "HoudiniEngineEditor" ) || !FHoudiniEngineEditor::IsInitialized() )
+                return;
+
+            FHoudiniEngineEditor & HoudiniEngineEditor = FHoudiniEngineEditor::Get();
+            HoudiniEngineEditor.bIsScanningHoudiniTools = false;
+
+            if ( !bIndexChanged )
+                return;
+
+            HoudiniEngineEditor.SaveHoudiniToolIndex();
+            HoudiniEngineEditor.HoudiniToolIndexUpdatedDelegate.Broadcast();
+        } );
+    } );
+}
+
 bool
 FHoudiniEngineEditor::GetHoudiniToolDescriptionFromJSON(const FString& JsonFilePath,
     FString& OutName, EHoudiniToolType& OutType, EHoudiniToolSelectionType& OutSelectionType,
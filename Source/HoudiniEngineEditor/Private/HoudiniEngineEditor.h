@@ -29,6 +29,8 @@
 #include "Framework/MultiBox/MultiBoxExtender.h"
 #include "HoudiniRuntimeSettings.h"
 #include "Framework/Commands/Commands.h"
+#include "Async/Future.h"
+#include "HAL/ThreadSafeBool.h"
 #include "HAPI.h"
 
 
@@ -115,6 +117,37 @@ struct FHoudiniTool
     FString GetJSonFilePath() { return ToolDirectory.Path.Path / JSONFile; };
 };
 
+/** Description of a Houdini Tool read from its JSON file, kept in the tool index between sessions. **/
+struct FHoudiniToolIndexEntry
+{
+    FHoudiniToolIndexEntry()
+        : FileSize( -1 )
+        , bValid( false )
+        , Type( EHoudiniToolType::HTOOLTYPE_OPERATOR_SINGLE )
+        , SelectionType( EHoudiniToolSelectionType::HTOOL_SELECTION_ALL )
+        , bIconExists( false )
+    {
+    }
+
+    /** Time stamp and size of the JSON file when it was read. **/
+    FDateTime TimeStamp;
+    int64 FileSize;
+
+    /** Whether the JSON file describes a tool usable in Unreal. **/
+    bool bValid;
+
+    FString Name;
+    EHoudiniToolType Type;
+    EHoudiniToolSelectionType SelectionType;
+    FString ToolTip;
+    FString IconPath;
+    bool bIconExists;
+    FString AssetPath;
+    FString HelpURL;
+
+    friend FArchive & operator<<( FArchive & Ar, FHoudiniToolIndexEntry & Entry );
+};
+
 class FHoudiniEngineStyle
 {
 public:
@@ -291,6 +324,15 @@ class FHoudiniEngineEditor : public IHoudiniEngineEditor, public FEditorUndoClie
         /** Return the directories where we should look for houdini tools**/
         void GetHoudiniToolDirectories(const int32& SelectedIndex, TArray<FHoudiniToolDirectory>& HoudiniToolsDirectoryArray) const;
 
+        /** Refreshes the tool index of all the tool directories on a worker thread. **/
+        void StartHoudiniToolScan();
+
+        /** Returns true while the tool directories are scanned, the tool list is then built from the last index. **/
+        bool IsScanningHoudiniTools() const { return bIsScanningHoudiniTools; }
+
+        /** Broadcast on the game thread once a scan has updated the tool index. **/
+        FSimpleMulticastDelegate & OnHoudiniToolIndexUpdated() { return HoudiniToolIndexUpdatedDelegate; }
+
     protected:
 
         /** Register AssetType action. **/
@@ -302,6 +344,23 @@ class FHoudiniEngineEditor : public IHoudiniEngineEditor, public FEditorUndoClie
         /** Add menu extension for our module. **/
         void AddHoudiniMenuExtension( FMenuBuilder & MenuBuilder );
 
+        /** Add the scheduler status widget to the level editor toolbar. **/
+        void AddSchedulerStatusToolBarExtension( FToolBarBuilder & ToolBarBuilder );
+
+        /** Save a .hip file per session of the pool, session N > 0 gets a _N suffix. Return the saved paths. **/
+        TArray< FString > SaveSessionHIPFiles( const FString & HIPPath, TArray< int32 > & SkippedSessions ) const;
+
+        /** Return the summary of the scheduler telemetry shown by the status widget, and its per session details. **/
+        FText GetSchedulerStatusText() const;
+        FText GetSchedulerStatusToolTipText() const;
+
+        /** Re-reads the JSON files of a tool directory that changed since they were indexed, returns true if the index changed. **/
+        bool RefreshHoudiniToolIndex( const FString & ToolDirPath );
+
+        /** Loads and saves the tool index from the project's saved directory. **/
+        void LoadHoudiniToolIndex();
+        void SaveHoudiniToolIndex();
+
         /** Add the default Houdini Tools to the Houdini Engine Shelft tool **/
         void AddDefaultHoudiniToolToArray( TArray< FHoudiniToolDescription >& ToolArray );
 
@@ -340,11 +399,26 @@ class FHoudiniEngineEditor : public IHoudiniEngineEditor, public FEditorUndoClie
         /** The extender to pass to the level editor to extend it's window menu. **/
         TSharedPtr< FExtender > MainMenuExtender;
 
+        /** The extender adding the scheduler status to the level editor toolbar. **/
+        TSharedPtr< FExtender > ToolBarExtender;
+
         /** Stored last used Houdini component which was involved in undo. **/
         mutable UHoudiniAssetComponent * LastHoudiniAssetComponentUndoObject;
 
         TArray< TSharedPtr<FHoudiniTool> > HoudiniTools;
 
+        /** Indexed tool descriptions, per tool directory then per JSON file name. **/
+        TMap< FString, TMap< FString, FHoudiniToolIndexEntry > > HoudiniToolIndex;
+
+        /** Guards the tool index, which is refreshed by the background scan. **/
+        FCriticalSection HoudiniToolIndexLock;
+
+        /** Background scan of the tool directories. **/
+        TFuture< void > HoudiniToolScanFuture;
+        FThreadSafeBool bIsScanningHoudiniTools;
+
+        FSimpleMulticastDelegate HoudiniToolIndexUpdatedDelegate;
+
         TSharedPtr<class FUICommandList> HEngineCommands;
 
         FDelegateHandle LevelViewportExtenderHandle;
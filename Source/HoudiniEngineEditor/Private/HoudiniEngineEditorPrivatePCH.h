@@ -38,6 +38,15 @@
  /** Houdini Engine Editor Module Localization. **/
 #include "HoudiniEngineEditorLocalization.h"
 
+ /** Version of the Houdini Tool index saved between sessions. **/
+#define HAPI_UNREAL_HOUDINI_TOOL_INDEX_VERSION 1
+
+ /** Minimum distance in pixels between the drawn control point handles of a curve. **/
+#define HAPI_UNREAL_SPLINE_HANDLE_MIN_PIXEL_DISTANCE 6.0f
+
+ /** Maximum number of log lines added to the log widget per frame. **/
+#define HAPI_UNREAL_LOG_WIDGET_LINES_PER_TICK 2000
+
  /** URL used for bug reporting. **/
 #define HAPI_UNREAL_BUG_REPORT_URL \
     TEXT("https://www.sidefx.com/bugs/submit/")
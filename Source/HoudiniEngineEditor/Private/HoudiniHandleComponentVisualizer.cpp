@@ -61,7 +61,9 @@ FHoudiniHandleComponentVisualizerCommands::RegisterCommands()
 FHoudiniHandleComponentVisualizer::FHoudiniHandleComponentVisualizer()
     : FComponentVisualizer()
     , EditedComponent( nullptr )
+    , LastUpdateTime( 0.0 )
     , bEditing( false )
+    , bDragRecorded( false )
 {
     FHoudiniHandleComponentVisualizerCommands::Register();
     VisualizerActions = MakeShareable( new FUICommandList );
@@ -82,7 +84,9 @@ FHoudiniHandleComponentVisualizer::HandleInputKey( FEditorViewportClient* Viewpo
             if( GEditor )
                 GEditor->RedrawLevelEditingViewports( true );
 
-            EditedComponent->UpdateTransformParameters();
+            // The final values are always set on release, undo restores the values from before the drag.
+            EditedComponent->UpdateTransformParameters( !bDragRecorded );
+            bDragRecorded = false;
         }
     }
     return false;
@@ -221,6 +225,18 @@ FHoudiniHandleComponentVisualizer::HandleInputDelta(
         EditedComponent->SetWorldScale3D( EditedComponent->GetComponentTransform().GetScale3D() + DeltaScale );
     }
 
+    // Moves made during a drag are coalesced, the bound parameters are updated together once the interval has elapsed.
+    // Only the first update of a drag is recorded for undo.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    const float UpdateInterval = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->HandleDragUpdateInterval : 0.0f;
+    const double CurrentTime = FPlatformTime::Seconds();
+    if ( CurrentTime - LastUpdateTime >= UpdateInterval )
+    {
+        LastUpdateTime = CurrentTime;
+        if ( EditedComponent->UpdateTransformParameters( !bDragRecorded ) )
+            bDragRecorded = true;
+    }
+
     return true;
 }
 
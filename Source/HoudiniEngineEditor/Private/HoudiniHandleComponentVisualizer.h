@@ -107,9 +107,15 @@ class FHoudiniHandleComponentVisualizer : public FComponentVisualizer
         /** Houdini component which is being edited. **/
         UHoudiniHandleComponent * EditedComponent;
 
+        /** Time of the last parameter update made while dragging the handle. **/
+        double LastUpdateTime;
+
         /** Is set to true if we are editing. **/
         uint32 bEditing : 1;
         uint32 bAllowTranslate : 1;
         uint32 bAllowRotation : 1;
         uint32 bAllowScale : 1;
+
+        /** Is set to true once the parameter values before the current drag have been recorded for undo. **/
+        uint32 bDragRecorded : 1;
 };
@@ -189,12 +189,124 @@ FHoudiniParameterDetails::GetParameterTooltip( UHoudiniAssetParameter* InParam )
         return FText::FromString( InParam->GetParameterLabel() + TEXT( " (" ) + InParam->GetParameterName() + TEXT( ")" ) );
 }
 
+TMap< TWeakObjectPtr< UObject >, TMap< TWeakObjectPtr< UHoudiniAssetParameter >, FHoudiniParameterRowCacheEntry > >
+FHoudiniParameterDetails::RowCache;
+
+void
+FHoudiniParameterDetails::PruneRowCache()
+{
+    for ( auto IterComponent = RowCache.CreateIterator(); IterComponent; ++IterComponent )
+    {
+        if ( !IterComponent.Key().IsValid() )
+        {
+            IterComponent.RemoveCurrent();
+            continue;
+        }
+
+        for ( auto IterParam = IterComponent.Value().CreateIterator(); IterParam; ++IterParam )
+        {
+            if ( !IterParam.Key().IsValid() || IterParam.Key()->IsPendingKill() )
+                IterParam.RemoveCurrent();
+        }
+    }
+}
+
+uint32
+FHoudiniParameterDetails::GetRowLayoutHash( UHoudiniAssetParameter* InParam )
+{
+    uint32 Hash = GetTypeHash( InParam->GetParameterLabel() );
+    Hash = HashCombine( Hash, GetTypeHash( InParam->GetParameterHelp() ) );
+    Hash = HashCombine( Hash, GetTypeHash( InParam->GetParameterName() ) );
+    Hash = HashCombine( Hash, GetTypeHash( InParam->GetTupleSize() ) );
+    Hash = HashCombine( Hash, GetTypeHash( (bool) InParam->bIsDisabled ) );
+    Hash = HashCombine( Hash, GetTypeHash( (bool) InParam->bIsChildOfMultiparm ) );
+    Hash = HashCombine( Hash, GetTypeHash( InParam->ChildIndex ) );
+    Hash = HashCombine( Hash, GetTypeHash( InParam->MultiparmInstanceIndex ) );
+    Hash = HashCombine( Hash, PointerHash( InParam->ParentParameter ) );
+
+    // Ranges, units and axis swapping are baked into the numeric widgets.
+    if ( auto ParamFloat = Cast< UHoudiniAssetParameterFloat >( InParam ) )
+    {
+        Hash = HashCombine( Hash, GetTypeHash( ParamFloat->ValueMin ) );
+        Hash = HashCombine( Hash, GetTypeHash( ParamFloat->ValueMax ) );
+        Hash = HashCombine( Hash, GetTypeHash( ParamFloat->ValueUIMin ) );
+        Hash = HashCombine( Hash, GetTypeHash( ParamFloat->ValueUIMax ) );
+        Hash = HashCombine( Hash, GetTypeHash( ParamFloat->ValueUnit ) );
+        Hash = HashCombine( Hash, GetTypeHash( ParamFloat->NoSwap ) );
+    }
+    else if ( auto ParamInt = Cast< UHoudiniAssetParameterInt >( InParam ) )
+    {
+        Hash = HashCombine( Hash, GetTypeHash( ParamInt->ValueMin ) );
+        Hash = HashCombine( Hash, GetTypeHash( ParamInt->ValueMax ) );
+        Hash = HashCombine( Hash, GetTypeHash( ParamInt->ValueUIMin ) );
+        Hash = HashCombine( Hash, GetTypeHash( ParamInt->ValueUIMax ) );
+        Hash = HashCombine( Hash, GetTypeHash( ParamInt->ValueUnit ) );
+    }
+
+    if ( const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >() )
+        Hash = HashCombine( Hash, GetTypeHash( (int32) HoudiniRuntimeSettings->ImportAxis ) );
+
+    Hash = HashCombine( Hash, GetTypeHash( FUnitConversion::Settings().ShouldDisplayUnits() ) );
+
+    return Hash;
+}
+
+bool
+FHoudiniParameterDetails::CreateCachedRow( IDetailCategoryBuilder & LocalDetailCategoryBuilder, UHoudiniAssetParameter* InParam )
+{
+    TMap< TWeakObjectPtr< UHoudiniAssetParameter >, FHoudiniParameterRowCacheEntry > * ComponentRows =
+        RowCache.Find( InParam->PrimaryObject );
+    if ( !ComponentRows )
+        return false;
+
+    FHoudiniParameterRowCacheEntry * CacheEntry = ComponentRows->Find( InParam );
+    if ( !CacheEntry || !CacheEntry->NameWidget.IsValid() || !CacheEntry->ValueWidget.IsValid() )
+        return false;
+
+    if ( CacheEntry->LayoutHash != GetRowLayoutHash( InParam ) )
+        return false;
+
+    // The widgets are already shown by another details panel refreshed this frame.
+    if ( CacheEntry->LastUsedFrame == GFrameCounter )
+        return false;
+
+    CacheEntry->LastUsedFrame = GFrameCounter;
+
+    FDetailWidgetRow & Row = LocalDetailCategoryBuilder.AddCustomRow( FText::GetEmpty() );
+    Row.NameWidget.Widget = CacheEntry->NameWidget.ToSharedRef();
+    Row.ValueWidget.Widget = CacheEntry->ValueWidget.ToSharedRef();
+    Row.ValueWidget.MinDesiredWidth( HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH );
+
+    return true;
+}
+
+void
+FHoudiniParameterDetails::CacheRow( UHoudiniAssetParameter* InParam, const FDetailWidgetRow & Row )
+{
+    if ( !InParam->PrimaryObject )
+        return;
+
+    FHoudiniParameterRowCacheEntry & CacheEntry = RowCache.FindOrAdd( InParam->PrimaryObject ).FindOrAdd( InParam );
+    CacheEntry.LayoutHash = GetRowLayoutHash( InParam );
+    CacheEntry.LastUsedFrame = GFrameCounter;
+    CacheEntry.NameWidget = Row.NameWidget.Widget;
+    CacheEntry.ValueWidget = Row.ValueWidget.Widget;
+}
+
 void 
 FHoudiniParameterDetails::CreateWidget( IDetailCategoryBuilder & LocalDetailCategoryBuilder, UHoudiniAssetParameter* InParam )
 {
     if( !InParam || InParam->IsPendingKill() )
         return;
 
+    // Value parameters read their values through attributes, so their rows are reused until their layout changes.
+    if ( InParam->IsA< UHoudiniAssetParameterFloat >() || InParam->IsA< UHoudiniAssetParameterInt >()
+        || InParam->IsA< UHoudiniAssetParameterToggle >() || InParam->IsA< UHoudiniAssetParameterColor >() )
+    {
+        if ( CreateCachedRow( LocalDetailCategoryBuilder, InParam ) )
+            return;
+    }
+
     if ( auto ParamFloat = Cast<UHoudiniAssetParameterFloat>( InParam ) )
     {
         CreateWidgetFloat( LocalDetailCategoryBuilder, *ParamFloat );
@@ -383,8 +495,7 @@ FHoudiniParameterDetails::CreateWidgetFolderList( IDetailCategoryBuilder & Local
                 .OnClicked( FOnClicked::CreateLambda( [=]() {
                     if ( MyParam.IsValid() )
                     {
-                        MyParam->ActiveChildParameter = ParameterIdx;
-                        MyParam->OnParamStateChanged();
+                        MyParam->SetActiveChildParameter( ParameterIdx );
                     }
                     return FReply::Handled();
                 }))
@@ -439,6 +550,12 @@ FHoudiniParameterDetails::CreateWidgetMultiparm( IDetailCategoryBuilder & LocalD
         .Value( TAttribute< TOptional< int32 > >::Create( TAttribute< TOptional< int32 > >::FGetter::CreateUObject(
             &InParam, &UHoudiniAssetParameterMultiparm::GetValue ) ) )
         .OnValueChanged( SNumericEntryBox<int32>::FOnValueChanged::CreateUObject(
+            &InParam, &UHoudiniAssetParameterMultiparm::SetPendingValue ) )
+        .OnValueCommitted( SNumericEntryBox< int32 >::FOnValueCommitted::CreateLambda(
+            [ &InParam ]( int32 Val, ETextCommit::Type TextCommitType ) {
+            InParam.SetValue( Val );
+        } ) )
+        .OnEndSliderMovement( SNumericEntryBox< int32 >::FOnValueChanged::CreateUObject(
             &InParam, &UHoudiniAssetParameterMultiparm::SetValue ) )
     ];
 
@@ -892,6 +1009,8 @@ FHoudiniParameterDetails::CreateWidgetColor( IDetailCategoryBuilder & LocalDetai
 
     Row.ValueWidget.Widget = VerticalBox;
     Row.ValueWidget.MinDesiredWidth( HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH );
+
+    CacheRow( &InParam, Row );
 }
 
 void 
@@ -932,6 +1051,8 @@ FHoudiniParameterDetails::CreateWidgetToggle( IDetailCategoryBuilder & LocalDeta
 
     Row.ValueWidget.Widget = VerticalBox;
     Row.ValueWidget.MinDesiredWidth( HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH );
+
+    CacheRow( &InParam, Row );
 }
 
 void 
@@ -1072,6 +1193,8 @@ FHoudiniParameterDetails::CreateWidgetFloat( IDetailCategoryBuilder & LocalDetai
     }
     Row.ValueWidget.MinDesiredWidth( HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH );
     Row.ValueWidget.Widget->SetEnabled( !InParam.bIsDisabled );
+
+    CacheRow( &InParam, Row );
 }
 
 void 
@@ -1137,6 +1260,8 @@ FHoudiniParameterDetails::CreateWidgetInt( IDetailCategoryBuilder & LocalDetailC
 
     Row.ValueWidget.Widget = VerticalBox;
     Row.ValueWidget.MinDesiredWidth( HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH );
+
+    CacheRow( &InParam, Row );
 }
 
 void 
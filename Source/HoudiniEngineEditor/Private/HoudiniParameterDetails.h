@@ -27,6 +27,19 @@
 #include "IDetailCustomization.h"
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 
+/** Widgets of a parameter row, reused across details panel refreshes while the row layout is unchanged. **/
+struct FHoudiniParameterRowCacheEntry
+{
+    /** Hash of the parameter state baked into the widgets. **/
+    uint32 LayoutHash = 0;
+
+    /** Frame the widgets were last handed to a details panel. **/
+    uint64 LastUsedFrame = 0;
+
+    TSharedPtr< SWidget > NameWidget;
+    TSharedPtr< SWidget > ValueWidget;
+};
+
 struct FHoudiniParameterDetails
 {
     static void CreateNameWidget( class UHoudiniAssetParameter* InParam, FDetailWidgetRow & Row, bool bLabel );
@@ -55,7 +68,22 @@ struct FHoudiniParameterDetails
 
     static FText GetParameterTooltip( UHoudiniAssetParameter* InParam );
 
+    /** Removes the cached rows of destroyed components and parameters. **/
+    static void PruneRowCache();
+
 private:
+
+    /** Adds the cached row of a parameter, returns false if the row has to be created. **/
+    static bool CreateCachedRow( IDetailCategoryBuilder & LocalDetailCategoryBuilder, class UHoudiniAssetParameter* InParam );
+
+    /** Keeps the widgets of a newly created row for the next refresh. **/
+    static void CacheRow( class UHoudiniAssetParameter* InParam, const FDetailWidgetRow & Row );
+
+    /** Hash of the parameter state that the row widgets don't read through attributes. **/
+    static uint32 GetRowLayoutHash( class UHoudiniAssetParameter* InParam );
+
+    /** Cached rows, per component then per parameter. **/
+    static TMap< TWeakObjectPtr< UObject >, TMap< TWeakObjectPtr< UHoudiniAssetParameter >, FHoudiniParameterRowCacheEntry > > RowCache;
     
     static FMenuBuilder Helper_CreateCustomActorPickerWidget( 
         UHoudiniAssetInput& InParam, const TAttribute<FText>& HeadingText, const bool& bShowCurrentSelectionSection );
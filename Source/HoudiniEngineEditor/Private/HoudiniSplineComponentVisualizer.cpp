@@ -89,6 +89,7 @@ FHoudiniSplineComponentVisualizer::FHoudiniSplineComponentVisualizer()
     , bComponentNeedUpdate( false )
     , bCookOnlyOnMouseRelease( false )
     , bRecordTransactionOnMove( true )
+    , LastUpdateTime( 0.0 )
 {
     FHoudiniSplineComponentVisualizerCommands::Register();
     VisualizerActions = MakeShareable( new FUICommandList );
@@ -157,7 +158,15 @@ FHoudiniSplineComponentVisualizer::DrawVisualization(
         bool bNoPointSelected = EditedControlPointsIndexes.Num() <= 0;
         float GrabHandleCurrentSize = bNoPointSelected ? GrabHandleSizeNone : GrabHandleSize;
 
+        // Reserve the curve's segments so they are added to the batched lines in one go.
         int32 NumDisplayPoints = CurveDisplayPoints.Num();
+        int32 NumLines = FMath::Max( NumDisplayPoints - 1, 0 );
+        if ( HoudiniSplineComponent->IsClosedCurve() && NumDisplayPoints > 1 )
+            NumLines++;
+
+        if ( NumLines > 0 )
+            PDI->AddReserveLines( SDPG_Foreground, NumLines );
+
         for ( int32 DisplayPointIdx = 0; DisplayPointIdx < NumDisplayPoints; ++DisplayPointIdx )
         {
             // Get point for this index.
@@ -184,16 +193,59 @@ FHoudiniSplineComponentVisualizer::DrawVisualization(
             DisplayPointPrevious = DisplayPoint;
         }
 
+        // Flag the edited control points once instead of searching the selection for every point.
+        int32 NumPoints = CurvePoints.Num();
+        TBitArray<> SelectedPoints( false, NumPoints );
+        if ( bCurveEditing )
+        {
+            for ( int32 EditedIdx : EditedControlPointsIndexes )
+            {
+                if ( SelectedPoints.IsValidIndex( EditedIdx ) )
+                    SelectedPoints[ EditedIdx ] = true;
+            }
+        }
+
+        // Hit proxies are only needed when the viewport renders its hit proxy pass.
+        const bool bHitTesting = PDI->IsHitTesting();
+
+        // Position of the last handle drawn on screen, handles that would overlap it are skipped.
+        FVector2D LastHandlePixel = FVector2D::ZeroVector;
+        bool bHasLastHandle = false;
+
         // Draw control points.
-        for ( int32 PointIdx = 0; PointIdx < CurvePoints.Num(); ++PointIdx )
+        for ( int32 PointIdx = 0; PointIdx < NumPoints; ++PointIdx )
         {
             // Get point at this index.
             const FVector & DisplayPoint = HoudiniSplineComponentTransform.TransformPosition( CurvePoints[ PointIdx ].GetLocation() );
 
+            // The selected points and the points showing the curve's ends and direction are always drawn.
+            bool bIsSelected = SelectedPoints[ PointIdx ];
+            bool bAlwaysDraw = bIsSelected || PointIdx <= 1 || PointIdx == NumPoints - 1;
+
+            FVector2D HandlePixel;
+            bool bOnScreen = View->ViewFrustum.IntersectPoint( DisplayPoint ) && View->WorldToPixel( DisplayPoint, HandlePixel );
+            if ( !bAlwaysDraw )
+            {
+                if ( !bOnScreen )
+                    continue;
+
+                // Thin out the handles of dense or distant curves.
+                if ( bHasLastHandle && FVector2D::DistSquared( HandlePixel, LastHandlePixel )
+                    < FMath::Square( HAPI_UNREAL_SPLINE_HANDLE_MIN_PIXEL_DISTANCE ) )
+                    continue;
+            }
+
+            if ( bOnScreen )
+            {
+                LastHandlePixel = HandlePixel;
+                bHasLastHandle = true;
+            }
+
             // Draw point and set hit box for it.
-            PDI->SetHitProxy(new HHoudiniSplineControlPointVisProxy(HoudiniSplineComponent, PointIdx));
-       
-            if ( ( bCurveEditing ) && ( EditedControlPointsIndexes.Contains(PointIdx)))
+            if ( bHitTesting )
+                PDI->SetHitProxy( new HHoudiniSplineControlPointVisProxy( HoudiniSplineComponent, PointIdx ) );
+
+            if ( bIsSelected )
             {
                 // If we are editing this control point, change its color
                 PDI->DrawPoint(DisplayPoint, ColorSelected, GrabHandleSizeSelected, SDPG_Foreground);
@@ -209,7 +261,8 @@ FHoudiniSplineComponentVisualizer::DrawVisualization(
                     PDI->DrawPoint(DisplayPoint, bNoPointSelected ? ColorNone : ColorNormal, GrabHandleCurrentSize, SDPG_Foreground);
             }
 
-            PDI->SetHitProxy(nullptr);
+            if ( bHitTesting )
+                PDI->SetHitProxy( nullptr );
         }
     }
 }
@@ -433,8 +486,15 @@ FHoudiniSplineComponentVisualizer::HandleInputDelta(
    
     if ( ( bComponentNeedUpdate ) &&  ( !bCookOnlyOnMouseRelease ) )
     {
-        // Update and cook the asset
-        UpdateHoudiniComponents();
+        // Edits made during a drag are coalesced, only the latest state is sent once the interval has elapsed.
+        // Pending edits are flushed on mouse release.
+        const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+        const float UpdateInterval = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->CurveDragUpdateInterval : 0.0f;
+        if ( FPlatformTime::Seconds() - LastUpdateTime >= UpdateInterval )
+        {
+            // Update and cook the asset
+            UpdateHoudiniComponents();
+        }
     }
 
     return true;
@@ -484,6 +544,7 @@ FHoudiniSplineComponentVisualizer::UpdateHoudiniComponents()
         EditedHoudiniSplineComponent->UpdateHoudiniComponents();
 
     bComponentNeedUpdate = false;
+    LastUpdateTime = FPlatformTime::Seconds();
 }
 
 void
@@ -506,10 +567,9 @@ FHoudiniSplineComponentVisualizer::NotifyComponentModified( int32 PointIndex, co
         bRecordTransactionOnMove = false;
     }
 
-    // Update given control point.
-    EditedHoudiniSplineComponent->UpdatePoint( PointIndex, Point );
-
-    bComponentNeedUpdate = true;
+    // Update given control point, moves that leave it unchanged don't need an update.
+    if ( EditedHoudiniSplineComponent->UpdatePoint( PointIndex, Point ) )
+        bComponentNeedUpdate = true;
 }
 
 void
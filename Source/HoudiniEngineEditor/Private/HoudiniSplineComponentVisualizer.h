@@ -175,4 +175,7 @@ class FHoudiniSplineComponentVisualizer : public FComponentVisualizer
 
         /** Indicates wether or not a transaction should be recorded when moving a point **/
         bool bRecordTransactionOnMove;
+
+        /** Time of the last update, used to coalesce updates while dragging points **/
+        double LastUpdateTime;
 };
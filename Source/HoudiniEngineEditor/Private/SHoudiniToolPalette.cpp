@@ -91,6 +91,10 @@ SHoudiniToolPalette::Construct( const FArguments& InArgs )
 
     UpdateHoudiniToolDirectories();
 
+    // Rebuild the tool list when the background scan found changes in the tool directories
+    if ( !HoudiniToolIndexUpdatedHandle.IsValid() )
+        HoudiniToolIndexUpdatedHandle = HoudiniEngineEditor.OnHoudiniToolIndexUpdated().AddSP( this, &SHoudiniToolPalette::OnHoudiniToolIndexUpdated );
+
     SAssignNew( HoudiniToolListView, SHoudiniToolListView )
         .SelectionMode( ESelectionMode::Single )
         .ListItemsSource( &HoudiniEngineEditor.GetHoudiniTools() )
@@ -1179,6 +1183,15 @@ SHoudiniToolPalette::OnDirectoryChange(const FString& NewDir)
     }
 }
 
+void
+SHoudiniToolPalette::OnHoudiniToolIndexUpdated()
+{
+    UpdateHoudiniToolDirectories();
+
+    if ( HoudiniToolListView.IsValid() )
+        HoudiniToolListView->RequestListRefresh();
+}
+
 void
 SHoudiniToolPalette::UpdateHoudiniToolDirectories()
 {
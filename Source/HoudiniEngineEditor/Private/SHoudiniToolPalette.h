@@ -168,6 +168,9 @@ private:
 
     void UpdateHoudiniToolDirectories();
 
+    /** Handler for the tool index being updated by the background scan of the tool directories. **/
+    void OnHoudiniToolIndexUpdated();
+
     //void RenameToolFolder(const FString& SourcePath, const FString& NewName);
 
 private:
@@ -179,4 +182,7 @@ private:
 
     /** Holds the tools list view. */
     TSharedPtr<SHoudiniToolListView> HoudiniToolListView;
+
+    /** Handle to our binding to the tool index updates. **/
+    FDelegateHandle HoudiniToolIndexUpdatedHandle;
 };
@@ -261,7 +261,8 @@ public class HoudiniEngineRuntime : ModuleRules
                 "InputCore",
                 "RHI",
                 "Foliage",
-                "Landscape"
+                "Landscape",
+                "ProceduralMeshComponent"
              }
         );
 
@@ -284,6 +285,7 @@ public class HoudiniEngineRuntime : ModuleRules
                     "LevelEditor",
                     "MainFrame",
                     "MeshPaint",
+                    "MeshUtilities",
                     "Projects",
                     "PropertyEditor",
                     "RawMesh",
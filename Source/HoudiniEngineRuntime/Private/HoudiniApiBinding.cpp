@@ -0,0 +1,171 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#include "HoudiniApiBinding.h"
+#include "HoudiniApi.h"
+#include "HoudiniApiFunctions.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+#include "HAL/ThreadSafeCounter.h"
+
+/** Functions resolved when binding, the ones needed to start, check and report on a session. **/
+static const EHoudiniApiFunction::Type HoudiniApiCoreFunctions[] =
+{
+    EHoudiniApiFunction::BindCustomImplementation,
+    EHoudiniApiFunction::Cleanup,
+    EHoudiniApiFunction::CloseSession,
+    EHoudiniApiFunction::CreateCustomSession,
+    EHoudiniApiFunction::CreateInProcessSession,
+    EHoudiniApiFunction::CreateThriftNamedPipeSession,
+    EHoudiniApiFunction::CreateThriftSocketSession,
+    EHoudiniApiFunction::GetEnvInt,
+    EHoudiniApiFunction::GetSessionEnvInt,
+    EHoudiniApiFunction::GetStatus,
+    EHoudiniApiFunction::GetStatusString,
+    EHoudiniApiFunction::GetStatusStringBufLength,
+    EHoudiniApiFunction::GetString,
+    EHoudiniApiFunction::GetStringBufLength,
+    EHoudiniApiFunction::Initialize,
+    EHoudiniApiFunction::IsInitialized,
+    EHoudiniApiFunction::IsSessionValid,
+    EHoudiniApiFunction::StartThriftNamedPipeServer,
+    EHoudiniApiFunction::StartThriftSocketServer,
+};
+
+/** Library the lazily bound functions are resolved from. **/
+static void * HoudiniApiLibraryHandle = nullptr;
+
+/** Number of functions resolved since the library was bound. **/
+static FThreadSafeCounter HoudiniApiResolvedFunctionCount;
+
+/** Binding of an FHoudiniApi function pointer, its trampoline resolves the symbol on first call. **/
+template< int32 FunctionIndex, typename... ArgTypes >
+struct THoudiniApiLazyBinding
+{
+    typedef HAPI_Result ( *FuncPtr )( ArgTypes... );
+
+    /** FHoudiniApi function pointer we are bound to. **/
+    static FuncPtr * Function;
+
+    /** Function loaded from libHAPI, null until resolved. **/
+    static FuncPtr Resolved;
+
+    /** Empty stub held by the function pointer before binding, used if libHAPI lacks the symbol. **/
+    static FuncPtr Fallback;
+
+    static FuncPtr Resolve()
+    {
+        FuncPtr Loaded = Resolved;
+        if ( Loaded )
+            return Loaded;
+
+        const FString SymbolName = FString::Printf( TEXT( "HAPI_%s" ), GetHoudiniApiFunctionName( FunctionIndex ) );
+        Loaded = (FuncPtr) FPlatformProcess::GetDllExport( HoudiniApiLibraryHandle, *SymbolName );
+        if ( !Loaded )
+        {
+            HOUDINI_LOG_WARNING( TEXT( "libHAPI does not export %s." ), *SymbolName );
+            Loaded = Fallback;
+        }
+
+        // Several threads may resolve the same function, the first one wins.
+        void * Previous = FPlatformAtomics::InterlockedCompareExchangePointer( (void **) &Resolved, (void *) Loaded, nullptr );
+        if ( Previous )
+            return (FuncPtr) Previous;
+
+        HoudiniApiResolvedFunctionCount.Increment();
+        return Loaded;
+    }
+
+    static HAPI_Result Call( ArgTypes... Args )
+    {
+        FuncPtr Loaded = Resolve();
+
+        // Replace ourselves, unless the call tracing wrapper has taken our place.
+        if ( *Function == &Call )
+            *Function = Loaded;
+
+        return Loaded( Args... );
+    }
+};
+
+template< int32 FunctionIndex, typename... ArgTypes >
+typename THoudiniApiLazyBinding< FunctionIndex, ArgTypes... >::FuncPtr *
+THoudiniApiLazyBinding< FunctionIndex, ArgTypes... >::Function = nullptr;
+
+template< int32 FunctionIndex, typename... ArgTypes >
+typename THoudiniApiLazyBinding< FunctionIndex, ArgTypes... >::FuncPtr
+THoudiniApiLazyBinding< FunctionIndex, ArgTypes... >::Resolved = nullptr;
+
+template< int32 FunctionIndex, typename... ArgTypes >
+typename THoudiniApiLazyBinding< FunctionIndex, ArgTypes... >::FuncPtr
+THoudiniApiLazyBinding< FunctionIndex, ArgTypes... >::Fallback = nullptr;
+
+/** Bind the given FHoudiniApi function pointer, either right away or on its first call. **/
+template< int32 FunctionIndex, typename... ArgTypes >
+static void
+BindHoudiniApiFunction( HAPI_Result ( *& Function )( ArgTypes... ) )
+{
+    typedef THoudiniApiLazyBinding< FunctionIndex, ArgTypes... > FBinding;
+
+    if ( Function != &FBinding::Call )
+        FBinding::Fallback = Function;
+
+    FBinding::Function = &Function;
+    FBinding::Resolved = nullptr;
+
+    bool bCore = false;
+    for ( EHoudiniApiFunction::Type CoreFunction : HoudiniApiCoreFunctions )
+        bCore |= ( CoreFunction == FunctionIndex );
+
+    Function = bCore ? FBinding::Resolve() : &FBinding::Call;
+}
+
+void
+FHoudiniApiBinding::Bind( void * LibraryHandle )
+{
+    if ( !LibraryHandle )
+        return;
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    HoudiniApiLibraryHandle = LibraryHandle;
+    HoudiniApiResolvedFunctionCount.Reset();
+
+#define HOUDINI_API_BIND( NAME ) \
+    BindHoudiniApiFunction< EHoudiniApiFunction::NAME >( FHoudiniApi::NAME );
+
+    HOUDINI_API_FUNCTIONS( HOUDINI_API_BIND )
+
+#undef HOUDINI_API_BIND
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Bound %d of %d HAPI functions in %.3f ms, the others are bound on first use." ),
+        GetResolvedFunctionCount(), (int32) EHoudiniApiFunction::Count, ( FPlatformTime::Seconds() - StartTime ) * 1000.0 );
+}
+
+int32
+FHoudiniApiBinding::GetResolvedFunctionCount()
+{
+    return HoudiniApiResolvedFunctionCount.GetValue();
+}
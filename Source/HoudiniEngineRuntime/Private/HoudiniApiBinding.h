@@ -0,0 +1,40 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/** Binds the FHoudiniApi function pointers to libHAPI, resolving most of them on first use. **/
+// The core functions needed to start and check a session are resolved right away, the others
+// point to a trampoline which resolves the symbol and replaces itself the first time it is called.
+struct HOUDINIENGINERUNTIME_API FHoudiniApiBinding
+{
+    /** Bind the function pointers to the given libHAPI, replaces FHoudiniApi::InitializeHAPI. **/
+    static void Bind( void * LibraryHandle );
+
+    /** Return the number of functions whose symbol has been resolved so far. **/
+    static int32 GetResolvedFunctionCount();
+};
@@ -0,0 +1,279 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/** Functions dispatched through FHoudiniApi, in the order of HoudiniApi.h. **/
+#define HOUDINI_API_FUNCTIONS( FUNCTION ) \
+    FUNCTION( AddAttribute ) \
+    FUNCTION( AddGroup ) \
+    FUNCTION( BindCustomImplementation ) \
+    FUNCTION( CancelPDGCook ) \
+    FUNCTION( CheckForSpecificErrors ) \
+    FUNCTION( Cleanup ) \
+    FUNCTION( CloseSession ) \
+    FUNCTION( CommitGeo ) \
+    FUNCTION( CommitWorkitems ) \
+    FUNCTION( ComposeChildNodeList ) \
+    FUNCTION( ComposeNodeCookResult ) \
+    FUNCTION( ComposeObjectList ) \
+    FUNCTION( ConnectNodeInput ) \
+    FUNCTION( ConvertMatrixToEuler ) \
+    FUNCTION( ConvertMatrixToQuat ) \
+    FUNCTION( ConvertTransform ) \
+    FUNCTION( ConvertTransformEulerToMatrix ) \
+    FUNCTION( ConvertTransformQuatToMatrix ) \
+    FUNCTION( CookNode ) \
+    FUNCTION( CookPDG ) \
+    FUNCTION( CreateCustomSession ) \
+    FUNCTION( CreateHeightfieldInputNode ) \
+    FUNCTION( CreateHeightfieldInputVolumeNode ) \
+    FUNCTION( CreateInProcessSession ) \
+    FUNCTION( CreateInputNode ) \
+    FUNCTION( CreateNode ) \
+    FUNCTION( CreateThriftNamedPipeSession ) \
+    FUNCTION( CreateThriftSocketSession ) \
+    FUNCTION( CreateWorkitem ) \
+    FUNCTION( DeleteAttribute ) \
+    FUNCTION( DeleteNode ) \
+    FUNCTION( DirtyPDGNode ) \
+    FUNCTION( DisconnectNodeInput ) \
+    FUNCTION( DisconnectNodeOutputsAt ) \
+    FUNCTION( ExtractImageToFile ) \
+    FUNCTION( ExtractImageToMemory ) \
+    FUNCTION( GetActiveCacheCount ) \
+    FUNCTION( GetActiveCacheNames ) \
+    FUNCTION( GetAssetInfo ) \
+    FUNCTION( GetAttributeFloat64Data ) \
+    FUNCTION( GetAttributeFloatData ) \
+    FUNCTION( GetAttributeInfo ) \
+    FUNCTION( GetAttributeInt64Data ) \
+    FUNCTION( GetAttributeIntData ) \
+    FUNCTION( GetAttributeNames ) \
+    FUNCTION( GetAttributeStringData ) \
+    FUNCTION( GetAvailableAssetCount ) \
+    FUNCTION( GetAvailableAssets ) \
+    FUNCTION( GetBoxInfo ) \
+    FUNCTION( GetCacheProperty ) \
+    FUNCTION( GetComposedChildNodeList ) \
+    FUNCTION( GetComposedNodeCookResult ) \
+    FUNCTION( GetComposedObjectList ) \
+    FUNCTION( GetComposedObjectTransforms ) \
+    FUNCTION( GetCookingCurrentCount ) \
+    FUNCTION( GetCookingTotalCount ) \
+    FUNCTION( GetCurveCounts ) \
+    FUNCTION( GetCurveInfo ) \
+    FUNCTION( GetCurveKnots ) \
+    FUNCTION( GetCurveOrders ) \
+    FUNCTION( GetDisplayGeoInfo ) \
+    FUNCTION( GetEnvInt ) \
+    FUNCTION( GetFaceCounts ) \
+    FUNCTION( GetFirstVolumeTile ) \
+    FUNCTION( GetGeoInfo ) \
+    FUNCTION( GetGeoSize ) \
+    FUNCTION( GetGroupCountOnPackedInstancePart ) \
+    FUNCTION( GetGroupMembership ) \
+    FUNCTION( GetGroupMembershipOnPackedInstancePart ) \
+    FUNCTION( GetGroupNames ) \
+    FUNCTION( GetGroupNamesOnPackedInstancePart ) \
+    FUNCTION( GetHandleBindingInfo ) \
+    FUNCTION( GetHandleInfo ) \
+    FUNCTION( GetHeightFieldData ) \
+    FUNCTION( GetImageInfo ) \
+    FUNCTION( GetImageMemoryBuffer ) \
+    FUNCTION( GetImagePlaneCount ) \
+    FUNCTION( GetImagePlanes ) \
+    FUNCTION( GetInstanceTransforms ) \
+    FUNCTION( GetInstanceTransformsOnPart ) \
+    FUNCTION( GetInstancedObjectIds ) \
+    FUNCTION( GetInstancedPartIds ) \
+    FUNCTION( GetInstancerPartTransforms ) \
+    FUNCTION( GetManagerNodeId ) \
+    FUNCTION( GetMaterialInfo ) \
+    FUNCTION( GetMaterialNodeIdsOnFaces ) \
+    FUNCTION( GetNextVolumeTile ) \
+    FUNCTION( GetNodeInfo ) \
+    FUNCTION( GetNodeInputName ) \
+    FUNCTION( GetNodeOutputName ) \
+    FUNCTION( GetNodePath ) \
+    FUNCTION( GetNumWorkitems ) \
+    FUNCTION( GetObjectInfo ) \
+    FUNCTION( GetObjectTransform ) \
+    FUNCTION( GetPDGEvents ) \
+    FUNCTION( GetPDGGraphContexts ) \
+    FUNCTION( GetPDGState ) \
+    FUNCTION( GetParameters ) \
+    FUNCTION( GetParmChoiceLists ) \
+    FUNCTION( GetParmExpression ) \
+    FUNCTION( GetParmFile ) \
+    FUNCTION( GetParmFloatValue ) \
+    FUNCTION( GetParmFloatValues ) \
+    FUNCTION( GetParmIdFromName ) \
+    FUNCTION( GetParmInfo ) \
+    FUNCTION( GetParmInfoFromName ) \
+    FUNCTION( GetParmIntValue ) \
+    FUNCTION( GetParmIntValues ) \
+    FUNCTION( GetParmNodeValue ) \
+    FUNCTION( GetParmStringValue ) \
+    FUNCTION( GetParmStringValues ) \
+    FUNCTION( GetParmTagName ) \
+    FUNCTION( GetParmTagValue ) \
+    FUNCTION( GetParmWithTag ) \
+    FUNCTION( GetPartInfo ) \
+    FUNCTION( GetPreset ) \
+    FUNCTION( GetPresetBufLength ) \
+    FUNCTION( GetServerEnvInt ) \
+    FUNCTION( GetServerEnvString ) \
+    FUNCTION( GetServerEnvVarCount ) \
+    FUNCTION( GetServerEnvVarList ) \
+    FUNCTION( GetSessionEnvInt ) \
+    FUNCTION( GetSphereInfo ) \
+    FUNCTION( GetStatus ) \
+    FUNCTION( GetStatusString ) \
+    FUNCTION( GetStatusStringBufLength ) \
+    FUNCTION( GetString ) \
+    FUNCTION( GetStringBatch ) \
+    FUNCTION( GetStringBatchSize ) \
+    FUNCTION( GetStringBufLength ) \
+    FUNCTION( GetSupportedImageFileFormatCount ) \
+    FUNCTION( GetSupportedImageFileFormats ) \
+    FUNCTION( GetTime ) \
+    FUNCTION( GetTimelineOptions ) \
+    FUNCTION( GetVertexList ) \
+    FUNCTION( GetVolumeBounds ) \
+    FUNCTION( GetVolumeInfo ) \
+    FUNCTION( GetVolumeTileFloatData ) \
+    FUNCTION( GetVolumeTileIntData ) \
+    FUNCTION( GetVolumeVoxelFloatData ) \
+    FUNCTION( GetVolumeVoxelIntData ) \
+    FUNCTION( GetWorkitemDataLength ) \
+    FUNCTION( GetWorkitemFloatData ) \
+    FUNCTION( GetWorkitemInfo ) \
+    FUNCTION( GetWorkitemIntData ) \
+    FUNCTION( GetWorkitemResultInfo ) \
+    FUNCTION( GetWorkitemStringData ) \
+    FUNCTION( GetWorkitems ) \
+    FUNCTION( Initialize ) \
+    FUNCTION( InsertMultiparmInstance ) \
+    FUNCTION( Interrupt ) \
+    FUNCTION( IsInitialized ) \
+    FUNCTION( IsNodeValid ) \
+    FUNCTION( IsSessionValid ) \
+    FUNCTION( LoadAssetLibraryFromFile ) \
+    FUNCTION( LoadAssetLibraryFromMemory ) \
+    FUNCTION( LoadGeoFromFile ) \
+    FUNCTION( LoadGeoFromMemory ) \
+    FUNCTION( LoadHIPFile ) \
+    FUNCTION( ParmHasExpression ) \
+    FUNCTION( ParmHasTag ) \
+    FUNCTION( PausePDGCook ) \
+    FUNCTION( PythonThreadInterpreterLock ) \
+    FUNCTION( QueryNodeInput ) \
+    FUNCTION( QueryNodeOutputConnectedCount ) \
+    FUNCTION( QueryNodeOutputConnectedNodes ) \
+    FUNCTION( RemoveMultiparmInstance ) \
+    FUNCTION( RemoveParmExpression ) \
+    FUNCTION( RenameNode ) \
+    FUNCTION( RenderCOPToImage ) \
+    FUNCTION( RenderTextureToImage ) \
+    FUNCTION( ResetSimulation ) \
+    FUNCTION( RevertGeo ) \
+    FUNCTION( RevertParmToDefault ) \
+    FUNCTION( RevertParmToDefaults ) \
+    FUNCTION( SaveGeoToFile ) \
+    FUNCTION( SaveGeoToMemory ) \
+    FUNCTION( SaveHIPFile ) \
+    FUNCTION( SetAnimCurve ) \
+    FUNCTION( SetAttributeFloat64Data ) \
+    FUNCTION( SetAttributeFloatData ) \
+    FUNCTION( SetAttributeInt64Data ) \
+    FUNCTION( SetAttributeIntData ) \
+    FUNCTION( SetAttributeStringData ) \
+    FUNCTION( SetCacheProperty ) \
+    FUNCTION( SetCurveCounts ) \
+    FUNCTION( SetCurveInfo ) \
+    FUNCTION( SetCurveKnots ) \
+    FUNCTION( SetCurveOrders ) \
+    FUNCTION( SetFaceCounts ) \
+    FUNCTION( SetGroupMembership ) \
+    FUNCTION( SetHeightFieldData ) \
+    FUNCTION( SetImageInfo ) \
+    FUNCTION( SetObjectTransform ) \
+    FUNCTION( SetParmExpression ) \
+    FUNCTION( SetParmFloatValue ) \
+    FUNCTION( SetParmFloatValues ) \
+    FUNCTION( SetParmIntValue ) \
+    FUNCTION( SetParmIntValues ) \
+    FUNCTION( SetParmNodeValue ) \
+    FUNCTION( SetParmStringValue ) \
+    FUNCTION( SetPartInfo ) \
+    FUNCTION( SetPreset ) \
+    FUNCTION( SetServerEnvInt ) \
+    FUNCTION( SetServerEnvString ) \
+    FUNCTION( SetTime ) \
+    FUNCTION( SetTimelineOptions ) \
+    FUNCTION( SetTransformAnimCurve ) \
+    FUNCTION( SetVertexList ) \
+    FUNCTION( SetVolumeInfo ) \
+    FUNCTION( SetVolumeTileFloatData ) \
+    FUNCTION( SetVolumeTileIntData ) \
+    FUNCTION( SetVolumeVoxelFloatData ) \
+    FUNCTION( SetVolumeVoxelIntData ) \
+    FUNCTION( SetWorkitemFloatData ) \
+    FUNCTION( SetWorkitemIntData ) \
+    FUNCTION( SetWorkitemStringData ) \
+    FUNCTION( StartThriftNamedPipeServer ) \
+    FUNCTION( StartThriftSocketServer )
+
+namespace EHoudiniApiFunction
+{
+#define HOUDINI_API_FUNCTION_ENUM( NAME ) NAME,
+
+    enum Type
+    {
+        HOUDINI_API_FUNCTIONS( HOUDINI_API_FUNCTION_ENUM )
+        Count
+    };
+
+#undef HOUDINI_API_FUNCTION_ENUM
+}
+
+/** Return the name of the given function, without its HAPI_ prefix. **/
+inline const TCHAR *
+GetHoudiniApiFunctionName( int32 FunctionIndex )
+{
+#define HOUDINI_API_FUNCTION_NAME( NAME ) TEXT( #NAME ),
+
+    static const TCHAR * FunctionNames[] =
+    {
+        HOUDINI_API_FUNCTIONS( HOUDINI_API_FUNCTION_NAME )
+    };
+
+#undef HOUDINI_API_FUNCTION_NAME
+
+    return FunctionNames[ FunctionIndex ];
+}
@@ -0,0 +1,126 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#pragma once
+
+#include "HoudiniApi.h"
+#include "HoudiniApiFunctions.h"
+
+// Size of the arrays and buffers passed to the FHoudiniApi functions, shared by the call tracing and recording.
+
+/** Payload of a call, the functions transferring arrays or buffers specialize it below. **/
+struct FHoudiniApiTraceNoPayload
+{
+    template< typename... ArgTypes >
+    static int64 Sent( ArgTypes... ) { return 0; }
+
+    template< typename... ArgTypes >
+    static int64 Received( ArgTypes... ) { return 0; }
+};
+
+template< int32 FunctionIndex >
+struct THoudiniApiTracePayload : FHoudiniApiTraceNoPayload
+{};
+
+#define HOUDINI_API_TRACE_PAYLOAD( NAME, DIRECTION, PARAMS, BYTES ) \
+    template<> \
+    struct THoudiniApiTracePayload< EHoudiniApiFunction::NAME > : FHoudiniApiTraceNoPayload \
+    { \
+        static int64 DIRECTION PARAMS { return BYTES; } \
+    };
+
+static int64
+GetAttributeTupleSize( const HAPI_AttributeInfo * AttributeInfo )
+{
+    return AttributeInfo ? FMath::Max( AttributeInfo->tupleSize, 1 ) : 1;
+}
+
+static int64
+GetStringArraySize( const char ** Strings, int64 Count )
+{
+    int64 Size = 0;
+    for ( int64 Idx = 0; Strings && Idx < Count; ++Idx )
+    {
+        if ( Strings[ Idx ] )
+            Size += FCStringAnsi::Strlen( Strings[ Idx ] ) + 1;
+    }
+
+    return Size;
+}
+
+HOUDINI_API_TRACE_PAYLOAD( GetAttributeFloatData, Received,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const char *, HAPI_AttributeInfo * AttributeInfo, int, float *, int, int Length ),
+    Length * GetAttributeTupleSize( AttributeInfo ) * sizeof( float ) )
+HOUDINI_API_TRACE_PAYLOAD( GetAttributeIntData, Received,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const char *, HAPI_AttributeInfo * AttributeInfo, int, int *, int, int Length ),
+    Length * GetAttributeTupleSize( AttributeInfo ) * sizeof( int ) )
+HOUDINI_API_TRACE_PAYLOAD( GetAttributeStringData, Received,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const char *, HAPI_AttributeInfo * AttributeInfo, HAPI_StringHandle *, int, int Length ),
+    Length * GetAttributeTupleSize( AttributeInfo ) * sizeof( HAPI_StringHandle ) )
+HOUDINI_API_TRACE_PAYLOAD( SetAttributeFloatData, Sent,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const char *, const HAPI_AttributeInfo * AttributeInfo, const float *, int, int Length ),
+    Length * GetAttributeTupleSize( AttributeInfo ) * sizeof( float ) )
+HOUDINI_API_TRACE_PAYLOAD( SetAttributeIntData, Sent,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const char *, const HAPI_AttributeInfo * AttributeInfo, const int *, int, int Length ),
+    Length * GetAttributeTupleSize( AttributeInfo ) * sizeof( int ) )
+HOUDINI_API_TRACE_PAYLOAD( SetAttributeStringData, Sent,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const char *, const HAPI_AttributeInfo * AttributeInfo, const char ** Strings, int, int Length ),
+    GetStringArraySize( Strings, Length * GetAttributeTupleSize( AttributeInfo ) ) )
+HOUDINI_API_TRACE_PAYLOAD( GetVertexList, Received,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, int *, int, int Length ), (int64) Length * sizeof( int ) )
+HOUDINI_API_TRACE_PAYLOAD( SetVertexList, Sent,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const int *, int, int Length ), (int64) Length * sizeof( int ) )
+HOUDINI_API_TRACE_PAYLOAD( GetFaceCounts, Received,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, int *, int, int Length ), (int64) Length * sizeof( int ) )
+HOUDINI_API_TRACE_PAYLOAD( SetFaceCounts, Sent,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const int *, int, int Length ), (int64) Length * sizeof( int ) )
+HOUDINI_API_TRACE_PAYLOAD( GetHeightFieldData, Received,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, float *, int, int Length ), (int64) Length * sizeof( float ) )
+HOUDINI_API_TRACE_PAYLOAD( SetHeightFieldData, Sent,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const char *, const float *, int, int Length ), (int64) Length * sizeof( float ) )
+HOUDINI_API_TRACE_PAYLOAD( GetComposedObjectTransforms, Received,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_RSTOrder, HAPI_Transform *, int, int Length ), (int64) Length * sizeof( HAPI_Transform ) )
+HOUDINI_API_TRACE_PAYLOAD( GetParmFloatValues, Received,
+    ( const HAPI_Session *, HAPI_NodeId, float *, int, int Length ), (int64) Length * sizeof( float ) )
+HOUDINI_API_TRACE_PAYLOAD( GetParmIntValues, Received,
+    ( const HAPI_Session *, HAPI_NodeId, int *, int, int Length ), (int64) Length * sizeof( int ) )
+HOUDINI_API_TRACE_PAYLOAD( GetParmStringValues, Received,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_Bool, HAPI_StringHandle *, int, int Length ), (int64) Length * sizeof( HAPI_StringHandle ) )
+HOUDINI_API_TRACE_PAYLOAD( SetParmFloatValues, Sent,
+    ( const HAPI_Session *, HAPI_NodeId, const float *, int, int Length ), (int64) Length * sizeof( float ) )
+HOUDINI_API_TRACE_PAYLOAD( SetParmIntValues, Sent,
+    ( const HAPI_Session *, HAPI_NodeId, const int *, int, int Length ), (int64) Length * sizeof( int ) )
+HOUDINI_API_TRACE_PAYLOAD( GetString, Received,
+    ( const HAPI_Session *, HAPI_StringHandle, char *, int Length ), Length )
+HOUDINI_API_TRACE_PAYLOAD( GetStringBatch, Received,
+    ( const HAPI_Session *, char *, int Length ), Length )
+HOUDINI_API_TRACE_PAYLOAD( GetComposedNodeCookResult, Received,
+    ( const HAPI_Session *, char *, int Length ), Length )
+HOUDINI_API_TRACE_PAYLOAD( GetPreset, Received,
+    ( const HAPI_Session *, HAPI_NodeId, char *, int Length ), Length )
+HOUDINI_API_TRACE_PAYLOAD( SetPreset, Sent,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PresetType, const char *, const char *, int Length ), Length )
+HOUDINI_API_TRACE_PAYLOAD( LoadAssetLibraryFromMemory, Sent,
+    ( const HAPI_Session *, const char *, int Length, HAPI_Bool, HAPI_AssetLibraryId * ), Length )
+
+#undef HOUDINI_API_TRACE_PAYLOAD
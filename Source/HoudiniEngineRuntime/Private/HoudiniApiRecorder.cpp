@@ -0,0 +1,571 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#include "HoudiniApiRecorder.h"
+#include "HoudiniApi.h"
+#include "HoudiniApiFunctions.h"
+#include "HoudiniApiPayload.h"
+#include "HoudiniApiTrace.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace EHoudiniApiRecorderMode
+{
+    enum Type
+    {
+        None,
+        Recording,
+        Replaying
+    };
+}
+
+/** Calls recorded with the same function and input hash, answered in order while replaying. **/
+struct FHoudiniApiReplayCalls
+{
+    TArray< int32 > Offsets;
+    int32 NextCall = 0;
+};
+
+static EHoudiniApiRecorderMode::Type HoudiniApiRecorderMode = EHoudiniApiRecorderMode::None;
+static FCriticalSection HoudiniApiRecorderLock;
+
+/** Records of the calls, each is its size, the function index, input hash, result, whether outputs follow, **/
+/** and the size and bytes of each output. **/
+static TArray< uint8 > HoudiniApiRecording;
+static int32 HoudiniApiRecordedCallCount = 0;
+
+static TMap< uint64, FHoudiniApiReplayCalls > HoudiniApiReplayCalls;
+static int32 HoudiniApiReplayedCallCount = 0;
+static int32 HoudiniApiReplayMissCount[ EHoudiniApiFunction::Count ];
+
+/** Size of an element pointed to by an output argument, void pointers are opaque and not recorded. **/
+template< typename T >
+struct THoudiniApiOutputSize
+{
+    static const int64 Value = sizeof( T );
+};
+
+template<>
+struct THoudiniApiOutputSize< void >
+{
+    static const int64 Value = 0;
+};
+
+/** Hash of the input arguments of a call, the session and the output arguments are left out. **/
+struct FHoudiniApiRecordInputHash
+{
+    uint32 Hash = 0;
+
+    void Visit( const HAPI_Session * ) {}
+    void Visit( const char ** ) {}
+    void Visit( const char * String ) { if ( String ) Hash = FCrc::MemCrc32( String, FCStringAnsi::Strlen( String ), Hash ); }
+
+    template< typename T >
+    void Visit( const T * Value ) { if ( Value ) Hash = FCrc::MemCrc32( Value, THoudiniApiOutputSize< T >::Value, Hash ); }
+
+    template< typename T >
+    void Visit( T * ) {}
+
+    template< typename T >
+    void Visit( T Value ) { Hash = FCrc::MemCrc32( &Value, sizeof( T ), Hash ); }
+};
+
+/** Find the last output argument of a call, and the element count given after it. **/
+struct FHoudiniApiRecordOutputScan
+{
+    int32 ArgIndex = 0;
+    int32 LastOutputIndex = INDEX_NONE;
+    int64 LastOutputCount = 1;
+
+    void Visit( const HAPI_Session * ) { ArgIndex++; }
+    void Visit( const char ** ) { ArgIndex++; }
+    void Visit( int Value )
+    {
+        if ( LastOutputIndex != INDEX_NONE )
+            LastOutputCount = Value;
+        ArgIndex++;
+    }
+
+    template< typename T >
+    void Visit( const T * ) { ArgIndex++; }
+
+    template< typename T >
+    void Visit( T * )
+    {
+        LastOutputIndex = ArgIndex++;
+        LastOutputCount = 1;
+    }
+
+    template< typename T >
+    void Visit( T ) { ArgIndex++; }
+};
+
+/** Size in bytes of an output argument, the last one may be an array sized by the payload or the count after it. **/
+template< typename T >
+static int64
+GetHoudiniApiOutputSize( const FHoudiniApiRecordOutputScan & Scan, int32 ArgIndex, int64 ReceivedBytes )
+{
+    if ( ArgIndex != Scan.LastOutputIndex )
+        return THoudiniApiOutputSize< T >::Value;
+
+    if ( ReceivedBytes > 0 )
+        return ReceivedBytes;
+
+    return THoudiniApiOutputSize< T >::Value * FMath::Max< int64 >( Scan.LastOutputCount, 1 );
+}
+
+static void
+AppendHoudiniApiRecord( TArray< uint8 > & Record, const void * Data, int64 Size )
+{
+    Record.Append( (const uint8 *) Data, (int32) Size );
+}
+
+/** Append the output arguments of a call to its record. **/
+struct FHoudiniApiRecordOutputWriter
+{
+    const FHoudiniApiRecordOutputScan & Scan;
+    int64 ReceivedBytes;
+    TArray< uint8 > & Record;
+    int32 ArgIndex = 0;
+
+    FHoudiniApiRecordOutputWriter( const FHoudiniApiRecordOutputScan & InScan, int64 InReceivedBytes, TArray< uint8 > & InRecord )
+        : Scan( InScan ), ReceivedBytes( InReceivedBytes ), Record( InRecord )
+    {}
+
+    void Visit( const HAPI_Session * ) { ArgIndex++; }
+    void Visit( const char ** ) { ArgIndex++; }
+
+    template< typename T >
+    void Visit( const T * ) { ArgIndex++; }
+
+    template< typename T >
+    void Visit( T * Value )
+    {
+        const int32 Size = Value ? (int32) GetHoudiniApiOutputSize< T >( Scan, ArgIndex, ReceivedBytes ) : 0;
+        AppendHoudiniApiRecord( Record, &Size, sizeof( Size ) );
+        AppendHoudiniApiRecord( Record, Value, Size );
+        ArgIndex++;
+    }
+
+    template< typename T >
+    void Visit( T ) { ArgIndex++; }
+};
+
+/** Copy the recorded outputs of a call to its output arguments, up to their capacity. **/
+struct FHoudiniApiRecordOutputReader
+{
+    const FHoudiniApiRecordOutputScan & Scan;
+    int64 ReceivedBytes;
+    const uint8 * Record;
+    const uint8 * RecordEnd;
+    int32 ArgIndex = 0;
+
+    FHoudiniApiRecordOutputReader(
+        const FHoudiniApiRecordOutputScan & InScan, int64 InReceivedBytes, const uint8 * InRecord, const uint8 * InRecordEnd )
+        : Scan( InScan ), ReceivedBytes( InReceivedBytes ), Record( InRecord ), RecordEnd( InRecordEnd )
+    {}
+
+    void Visit( const HAPI_Session * ) { ArgIndex++; }
+    void Visit( const char ** ) { ArgIndex++; }
+
+    template< typename T >
+    void Visit( const T * ) { ArgIndex++; }
+
+    template< typename T >
+    void Visit( T * Value )
+    {
+        int32 Size = 0;
+        if ( Record + sizeof( Size ) <= RecordEnd )
+        {
+            FMemory::Memcpy( &Size, Record, sizeof( Size ) );
+            Record += sizeof( Size );
+        }
+
+        Size = FMath::Clamp< int32 >( Size, 0, RecordEnd - Record );
+        const int64 Capacity = GetHoudiniApiOutputSize< T >( Scan, ArgIndex, ReceivedBytes );
+        if ( Value )
+            FMemory::Memcpy( Value, Record, FMath::Min< int64 >( Size, Capacity ) );
+
+        Record += Size;
+        ArgIndex++;
+    }
+
+    template< typename T >
+    void Visit( T ) { ArgIndex++; }
+};
+
+/** Visit the arguments of a call in order. **/
+template< typename FVisitor, typename... ArgTypes >
+static void
+VisitHoudiniApiArgs( FVisitor & Visitor, ArgTypes... Args )
+{
+    int32 Unused[] = { 0, ( Visitor.Visit( Args ), 0 )... };
+    (void) Unused;
+}
+
+static uint64
+GetHoudiniApiReplayKey( int32 FunctionIndex, uint32 InputHash )
+{
+    return ( (uint64) FunctionIndex << 32 ) | InputHash;
+}
+
+/** Return the offset of the next recorded call with the given inputs, the last one is repeated once exhausted. **/
+static int32
+FindHoudiniApiReplayCall( int32 FunctionIndex, uint32 InputHash )
+{
+    FHoudiniApiReplayCalls * Calls = HoudiniApiReplayCalls.Find( GetHoudiniApiReplayKey( FunctionIndex, InputHash ) );
+    if ( !Calls || Calls->Offsets.Num() <= 0 )
+    {
+        HoudiniApiReplayMissCount[ FunctionIndex ]++;
+        return INDEX_NONE;
+    }
+
+    const int32 Offset = Calls->Offsets[ FMath::Min( Calls->NextCall, Calls->Offsets.Num() - 1 ) ];
+    Calls->NextCall++;
+    HoudiniApiReplayedCallCount++;
+    return Offset;
+}
+
+/** Recording and replaying wrapper of a FHoudiniApi function. **/
+template< int32 FunctionIndex, typename... ArgTypes >
+struct THoudiniApiRecorderWrapper
+{
+    typedef HAPI_Result ( *FuncPtr )( ArgTypes... );
+    static FuncPtr Function;
+
+    static uint32 HashInputs( ArgTypes... Args )
+    {
+        FHoudiniApiRecordInputHash InputHash;
+        VisitHoudiniApiArgs( InputHash, Args... );
+        return InputHash.Hash;
+    }
+
+    static HAPI_Result Record( ArgTypes... Args )
+    {
+        const uint32 InputHash = HashInputs( Args... );
+        HAPI_Result Result = Function( Args... );
+
+        FHoudiniApiRecordOutputScan Scan;
+        VisitHoudiniApiArgs( Scan, Args... );
+
+        TArray< uint8 > Record;
+        const int32 Index = FunctionIndex;
+        const int32 ResultValue = (int32) Result;
+        // Outputs are only recorded for successful calls, failed ones may have left them uninitialized.
+        const int32 HasOutputs = ( Result == HAPI_RESULT_SUCCESS && Scan.LastOutputIndex != INDEX_NONE ) ? 1 : 0;
+        AppendHoudiniApiRecord( Record, &Index, sizeof( Index ) );
+        AppendHoudiniApiRecord( Record, &InputHash, sizeof( InputHash ) );
+        AppendHoudiniApiRecord( Record, &ResultValue, sizeof( ResultValue ) );
+        AppendHoudiniApiRecord( Record, &HasOutputs, sizeof( HasOutputs ) );
+
+        if ( HasOutputs )
+        {
+            FHoudiniApiRecordOutputWriter Writer(
+                Scan, THoudiniApiTracePayload< FunctionIndex >::Received( Args... ), Record );
+            VisitHoudiniApiArgs( Writer, Args... );
+        }
+
+        FScopeLock ScopeLock( &HoudiniApiRecorderLock );
+        const int32 RecordSize = Record.Num();
+        AppendHoudiniApiRecord( HoudiniApiRecording, &RecordSize, sizeof( RecordSize ) );
+        HoudiniApiRecording.Append( Record );
+        HoudiniApiRecordedCallCount++;
+
+        return Result;
+    }
+
+    static HAPI_Result Replay( ArgTypes... Args )
+    {
+        const uint32 InputHash = HashInputs( Args... );
+
+        FScopeLock ScopeLock( &HoudiniApiRecorderLock );
+        const int32 Offset = FindHoudiniApiReplayCall( FunctionIndex, InputHash );
+        if ( Offset == INDEX_NONE )
+            return HAPI_RESULT_FAILURE;
+
+        int32 RecordSize = 0;
+        FMemory::Memcpy( &RecordSize, HoudiniApiRecording.GetData() + Offset, sizeof( RecordSize ) );
+        const uint8 * Record = HoudiniApiRecording.GetData() + Offset + sizeof( RecordSize );
+        const uint8 * RecordEnd = Record + RecordSize;
+
+        int32 ResultValue = 0;
+        int32 HasOutputs = 0;
+        FMemory::Memcpy( &ResultValue, Record + sizeof( int32 ) + sizeof( uint32 ), sizeof( ResultValue ) );
+        FMemory::Memcpy( &HasOutputs, Record + 2 * sizeof( int32 ) + sizeof( uint32 ), sizeof( HasOutputs ) );
+
+        if ( HasOutputs )
+        {
+            FHoudiniApiRecordOutputScan Scan;
+            VisitHoudiniApiArgs( Scan, Args... );
+
+            FHoudiniApiRecordOutputReader Reader(
+                Scan, THoudiniApiTracePayload< FunctionIndex >::Received( Args... ),
+                Record + 3 * sizeof( int32 ) + sizeof( uint32 ), RecordEnd );
+            VisitHoudiniApiArgs( Reader, Args... );
+        }
+
+        return (HAPI_Result) ResultValue;
+    }
+};
+
+template< int32 FunctionIndex, typename... ArgTypes >
+typename THoudiniApiRecorderWrapper< FunctionIndex, ArgTypes... >::FuncPtr
+THoudiniApiRecorderWrapper< FunctionIndex, ArgTypes... >::Function = nullptr;
+
+/** Install the recording or replaying wrapper of the given FHoudiniApi function pointer, or remove it. **/
+template< int32 FunctionIndex, typename... ArgTypes >
+static void
+HookHoudiniApiRecorderFunction( HAPI_Result ( *& Function )( ArgTypes... ), EHoudiniApiRecorderMode::Type Mode )
+{
+    typedef THoudiniApiRecorderWrapper< FunctionIndex, ArgTypes... > FWrapper;
+
+    if ( Function == &FWrapper::Record || Function == &FWrapper::Replay )
+        Function = FWrapper::Function;
+
+    if ( Mode == EHoudiniApiRecorderMode::None )
+        return;
+
+    FWrapper::Function = Function;
+    Function = Mode == EHoudiniApiRecorderMode::Recording ? &FWrapper::Record : &FWrapper::Replay;
+}
+
+static void
+SetHoudiniApiRecorderMode( EHoudiniApiRecorderMode::Type Mode )
+{
+#define HOUDINI_API_RECORDER_HOOK( NAME ) \
+    HookHoudiniApiRecorderFunction< EHoudiniApiFunction::NAME >( FHoudiniApi::NAME, Mode );
+
+    HOUDINI_API_FUNCTIONS( HOUDINI_API_RECORDER_HOOK )
+
+#undef HOUDINI_API_RECORDER_HOOK
+
+    HoudiniApiRecorderMode = Mode;
+}
+
+bool
+FHoudiniApiRecorder::StartRecording()
+{
+    if ( IsActive() )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "HAPI calls are already being recorded or replayed." ) );
+        return false;
+    }
+
+    if ( !FHoudiniApi::IsHAPIInitialized() )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "HAPI call recording requires libHAPI to be loaded." ) );
+        return false;
+    }
+
+    if ( FHoudiniApiTrace::IsEnabled() )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "HAPI call recording cannot be started while the HAPI calls are traced." ) );
+        return false;
+    }
+
+    {
+        FScopeLock ScopeLock( &HoudiniApiRecorderLock );
+        HoudiniApiRecording.Empty();
+        HoudiniApiRecordedCallCount = 0;
+    }
+
+    SetHoudiniApiRecorderMode( EHoudiniApiRecorderMode::Recording );
+    HOUDINI_LOG_MESSAGE( TEXT( "HAPI call recording started." ) );
+    return true;
+}
+
+bool
+FHoudiniApiRecorder::StopRecording( const FString & FileName )
+{
+    if ( HoudiniApiRecorderMode != EHoudiniApiRecorderMode::Recording )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "HAPI calls are not being recorded." ) );
+        return false;
+    }
+
+    SetHoudiniApiRecorderMode( EHoudiniApiRecorderMode::None );
+
+    TArray< uint8 > FileData;
+    const int32 Header[] = { HAPI_UNREAL_API_RECORDING_MAGIC, HAPI_UNREAL_API_RECORDING_VERSION, EHoudiniApiFunction::Count };
+    {
+        FScopeLock ScopeLock( &HoudiniApiRecorderLock );
+        FileData.Reserve( sizeof( Header ) + HoudiniApiRecording.Num() );
+        AppendHoudiniApiRecord( FileData, Header, sizeof( Header ) );
+        FileData.Append( HoudiniApiRecording );
+        HoudiniApiRecording.Empty();
+    }
+
+    if ( !FFileHelper::SaveArrayToFile( FileData, *FileName ) )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Failed to write the HAPI call recording to %s." ), *FileName );
+        return false;
+    }
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Recorded %d HAPI calls (%.2f MB) to %s." ),
+        HoudiniApiRecordedCallCount, FileData.Num() / ( 1024.0 * 1024.0 ), *FileName );
+    return true;
+}
+
+bool
+FHoudiniApiRecorder::StartReplay( const FString & FileName )
+{
+    if ( IsActive() )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "HAPI calls are already being recorded or replayed." ) );
+        return false;
+    }
+
+    if ( FHoudiniApiTrace::IsEnabled() )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "HAPI call replay cannot be started while the HAPI calls are traced." ) );
+        return false;
+    }
+
+    TArray< uint8 > FileData;
+    if ( !FFileHelper::LoadFileToArray( FileData, *FileName ) )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Failed to read the HAPI call recording %s." ), *FileName );
+        return false;
+    }
+
+    // The function indices are only stable for recordings made with the same set of functions.
+    int32 Header[ 3 ] = { 0, 0, 0 };
+    if ( FileData.Num() >= (int32) sizeof( Header ) )
+        FMemory::Memcpy( Header, FileData.GetData(), sizeof( Header ) );
+
+    if ( Header[ 0 ] != HAPI_UNREAL_API_RECORDING_MAGIC || Header[ 1 ] != HAPI_UNREAL_API_RECORDING_VERSION
+        || Header[ 2 ] != EHoudiniApiFunction::Count )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "%s is not a HAPI call recording made by this version of the plugin." ), *FileName );
+        return false;
+    }
+
+    FScopeLock ScopeLock( &HoudiniApiRecorderLock );
+    HoudiniApiRecording = MoveTemp( FileData );
+    HoudiniApiReplayCalls.Empty();
+    HoudiniApiReplayedCallCount = 0;
+    FMemory::Memzero( HoudiniApiReplayMissCount );
+
+    const int32 RecordHeaderSize = 4 * sizeof( int32 );
+    int32 Offset = sizeof( Header );
+    int32 CallCount = 0;
+    while ( Offset + (int32) sizeof( int32 ) + RecordHeaderSize <= HoudiniApiRecording.Num() )
+    {
+        int32 RecordSize = 0;
+        int32 FunctionIndex = 0;
+        uint32 InputHash = 0;
+        const uint8 * Record = HoudiniApiRecording.GetData() + Offset;
+        FMemory::Memcpy( &RecordSize, Record, sizeof( RecordSize ) );
+        FMemory::Memcpy( &FunctionIndex, Record + sizeof( int32 ), sizeof( FunctionIndex ) );
+        FMemory::Memcpy( &InputHash, Record + 2 * sizeof( int32 ), sizeof( InputHash ) );
+
+        if ( RecordSize < RecordHeaderSize || Offset + (int32) sizeof( int32 ) + RecordSize > HoudiniApiRecording.Num()
+            || FunctionIndex < 0 || FunctionIndex >= EHoudiniApiFunction::Count )
+        {
+            HOUDINI_LOG_WARNING( TEXT( "HAPI call recording %s is truncated after %d calls." ), *FileName, CallCount );
+            break;
+        }
+
+        HoudiniApiReplayCalls.FindOrAdd( GetHoudiniApiReplayKey( FunctionIndex, InputHash ) ).Offsets.Add( Offset );
+        Offset += sizeof( int32 ) + RecordSize;
+        CallCount++;
+    }
+
+    SetHoudiniApiRecorderMode( EHoudiniApiRecorderMode::Replaying );
+    HOUDINI_LOG_MESSAGE( TEXT( "Replaying %d HAPI calls from %s." ), CallCount, *FileName );
+    return true;
+}
+
+void
+FHoudiniApiRecorder::StopReplay()
+{
+    if ( HoudiniApiRecorderMode != EHoudiniApiRecorderMode::Replaying )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "HAPI calls are not being replayed." ) );
+        return;
+    }
+
+    SetHoudiniApiRecorderMode( EHoudiniApiRecorderMode::None );
+
+    FScopeLock ScopeLock( &HoudiniApiRecorderLock );
+    int32 MissCount = 0;
+    for ( int32 FunctionIndex = 0; FunctionIndex < EHoudiniApiFunction::Count; ++FunctionIndex )
+    {
+        if ( HoudiniApiReplayMissCount[ FunctionIndex ] <= 0 )
+            continue;
+
+        HOUDINI_LOG_WARNING(
+            TEXT( "HAPI replay: %d calls of %s had no recorded answer." ),
+            HoudiniApiReplayMissCount[ FunctionIndex ], GetHoudiniApiFunctionName( FunctionIndex ) );
+        MissCount += HoudiniApiReplayMissCount[ FunctionIndex ];
+    }
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "HAPI call replay stopped, %d calls answered and %d missed." ), HoudiniApiReplayedCallCount, MissCount );
+
+    HoudiniApiRecording.Empty();
+    HoudiniApiReplayCalls.Empty();
+}
+
+bool
+FHoudiniApiRecorder::IsActive()
+{
+    return HoudiniApiRecorderMode != EHoudiniApiRecorderMode::None;
+}
+
+static FAutoConsoleCommand HoudiniApiRecordStartCommand(
+    TEXT( "Houdini.ApiRecord.Start" ),
+    TEXT( "Start recording the HAPI calls and their outputs." ),
+    FConsoleCommandDelegate::CreateLambda( []()
+    {
+        FHoudiniApiRecorder::StartRecording();
+    } ) );
+
+static FAutoConsoleCommand HoudiniApiRecordStopCommand(
+    TEXT( "Houdini.ApiRecord.Stop" ),
+    TEXT( "Stop recording the HAPI calls and write them to a file, in the project log folder unless a file is given." ),
+    FConsoleCommandWithArgsDelegate::CreateLambda( []( const TArray< FString > & Args )
+    {
+        FHoudiniApiRecorder::StopRecording( Args.Num() > 0
+            ? Args[ 0 ] : FPaths::Combine( FPaths::ProjectLogDir(), HAPI_UNREAL_API_RECORDING_FILE ) );
+    } ) );
+
+static FAutoConsoleCommand HoudiniApiReplayStartCommand(
+    TEXT( "Houdini.ApiReplay.Start" ),
+    TEXT( "Answer the HAPI calls with a recording, from the project log folder unless a file is given." ),
+    FConsoleCommandWithArgsDelegate::CreateLambda( []( const TArray< FString > & Args )
+    {
+        FHoudiniApiRecorder::StartReplay( Args.Num() > 0
+            ? Args[ 0 ] : FPaths::Combine( FPaths::ProjectLogDir(), HAPI_UNREAL_API_RECORDING_FILE ) );
+    } ) );
+
+static FAutoConsoleCommand HoudiniApiReplayStopCommand(
+    TEXT( "Houdini.ApiReplay.Stop" ),
+    TEXT( "Stop answering the HAPI calls with a recording and log the calls that had no recorded answer." ),
+    FConsoleCommandDelegate::CreateStatic( &FHoudiniApiRecorder::StopReplay ) );
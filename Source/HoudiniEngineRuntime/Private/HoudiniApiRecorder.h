@@ -0,0 +1,51 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/** Recording of the HAPI calls dispatched through FHoudiniApi, and their offline replay. **/
+// While recording, the FHoudiniApi function pointers are replaced by wrappers storing the input hash,
+// result and output buffers of every call. While replaying, the wrappers answer each call with the
+// recorded outputs of the call with the same inputs, without a Houdini session behind them, so the
+// marshalling code can be profiled deterministically.
+struct HOUDINIENGINERUNTIME_API FHoudiniApiRecorder
+{
+    /** Start recording the HAPI calls, must be called after HAPI has been initialized. **/
+    static bool StartRecording();
+
+    /** Stop recording and write the recorded calls to the given file. **/
+    static bool StopRecording( const FString & FileName );
+
+    /** Load the calls recorded in the given file and start answering the HAPI calls with them. **/
+    static bool StartReplay( const FString & FileName );
+
+    /** Stop replaying and log the calls that had no recorded answer. **/
+    static void StopReplay();
+
+    /** Return true if the HAPI calls are being recorded or replayed. **/
+    static bool IsActive();
+};
@@ -0,0 +1,364 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#include "HoudiniApiTrace.h"
+#include "HoudiniApi.h"
+#include "HoudiniApiFunctions.h"
+#include "HoudiniApiPayload.h"
+#include "HoudiniApiRecorder.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniEngineUtils.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DECLARE_CYCLE_STAT( TEXT( "Houdini: HAPI Calls" ), STAT_HapiCalls, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_COUNTER_STAT( TEXT( "Houdini: HAPI Call Count" ), STAT_HapiCallCount, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_COUNTER_STAT( TEXT( "Houdini: HAPI Bytes Sent" ), STAT_HapiBytesSent, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_COUNTER_STAT( TEXT( "Houdini: HAPI Bytes Received" ), STAT_HapiBytesReceived, STATGROUP_HoudiniEngine );
+
+/** Number of latency buckets, bucket N holds the calls that took less than 2^N microseconds. **/
+static const int32 HoudiniApiTraceHistogramSize = 32;
+
+/** Statistics recorded for a traced function, updated concurrently by the scheduler threads. **/
+struct FHoudiniApiTraceStats
+{
+    volatile int64 CallCount;
+    volatile int64 Cycles;
+    volatile int64 BytesSent;
+    volatile int64 BytesReceived;
+    volatile int64 Histogram[ HoudiniApiTraceHistogramSize ];
+};
+
+static FHoudiniApiTraceStats HoudiniApiTraceStats[ EHoudiniApiFunction::Count ];
+
+/** Statistics recorded for each session of the pool, indexed by session index. **/
+struct FHoudiniApiTraceSessionStats
+{
+    volatile int64 CallCount;
+    volatile int64 Cycles;
+    volatile int64 BytesSent;
+    volatile int64 BytesReceived;
+};
+
+static FHoudiniApiTraceSessionStats HoudiniApiTraceSessionStats[ HAPI_UNREAL_SESSION_POOL_MAX_SIZE ];
+static bool bHoudiniApiTraceEnabled = false;
+
+/** Traced calls and payload bytes of the current thread, used to attribute the traffic to the task being processed. **/
+static thread_local int64 HoudiniApiTraceThreadCallCount = 0;
+static thread_local int64 HoudiniApiTraceThreadBytes = 0;
+
+/** Wrapper replacing an FHoudiniApi function pointer while tracing is enabled. **/
+template< int32 FunctionIndex, typename... ArgTypes >
+struct THoudiniApiTraceWrapper
+{
+    typedef HAPI_Result ( *FuncPtr )( ArgTypes... );
+
+    /** Function loaded from libHAPI, the wrapper forwards to it. **/
+    static FuncPtr Function;
+
+    static HAPI_Result Call( ArgTypes... Args )
+    {
+        SCOPE_CYCLE_COUNTER( STAT_HapiCalls );
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        HAPI_Result Result = Function( Args... );
+        const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+
+        FHoudiniApiTrace::RecordCall(
+            FunctionIndex, Cycles,
+            THoudiniApiTracePayload< FunctionIndex >::Sent( Args... ),
+            THoudiniApiTracePayload< FunctionIndex >::Received( Args... ) );
+
+        return Result;
+    }
+};
+
+template< int32 FunctionIndex, typename... ArgTypes >
+typename THoudiniApiTraceWrapper< FunctionIndex, ArgTypes... >::FuncPtr
+THoudiniApiTraceWrapper< FunctionIndex, ArgTypes... >::Function = nullptr;
+
+/** Install or remove the wrapper of the given FHoudiniApi function pointer. **/
+template< int32 FunctionIndex, typename... ArgTypes >
+static void
+HookHoudiniApiFunction( HAPI_Result ( *& Function )( ArgTypes... ), bool bEnabled )
+{
+    typedef THoudiniApiTraceWrapper< FunctionIndex, ArgTypes... > FWrapper;
+
+    if ( bEnabled && Function != &FWrapper::Call )
+    {
+        FWrapper::Function = Function;
+        Function = &FWrapper::Call;
+    }
+    else if ( !bEnabled && Function == &FWrapper::Call )
+    {
+        Function = FWrapper::Function;
+    }
+}
+
+/** Return the upper bound, in milliseconds, of the latency bucket reaching the given fraction of the calls. **/
+static double
+GetHoudiniApiTracePercentile( const FHoudiniApiTraceStats & Stats, double Fraction )
+{
+    const int64 Threshold = FMath::Max< int64 >( 1, (int64) FMath::CeilToDouble( Stats.CallCount * Fraction ) );
+    int64 CallCount = 0;
+
+    for ( int32 Bucket = 0; Bucket < HoudiniApiTraceHistogramSize; ++Bucket )
+    {
+        CallCount += Stats.Histogram[ Bucket ];
+        if ( CallCount >= Threshold )
+            return (double)( 1ull << Bucket ) / 1000.0;
+    }
+
+    return (double)( 1ull << ( HoudiniApiTraceHistogramSize - 1 ) ) / 1000.0;
+}
+
+/** Return the indices of the called functions, sorted by decreasing total wall time. **/
+static void
+GetHoudiniApiTraceCalledFunctions( TArray< int32 > & OutFunctionIndices )
+{
+    OutFunctionIndices.Empty();
+    for ( int32 FunctionIndex = 0; FunctionIndex < EHoudiniApiFunction::Count; ++FunctionIndex )
+    {
+        if ( HoudiniApiTraceStats[ FunctionIndex ].CallCount > 0 )
+            OutFunctionIndices.Add( FunctionIndex );
+    }
+
+    OutFunctionIndices.Sort( []( const int32 & A, const int32 & B )
+    {
+        return HoudiniApiTraceStats[ A ].Cycles > HoudiniApiTraceStats[ B ].Cycles;
+    } );
+}
+
+void
+FHoudiniApiTrace::SetEnabled( bool bEnabled )
+{
+    if ( bEnabled == bHoudiniApiTraceEnabled )
+        return;
+
+    if ( bEnabled && !FHoudiniApi::IsHAPIInitialized() )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "HAPI call tracing requires libHAPI to be loaded." ) );
+        return;
+    }
+
+    if ( bEnabled && FHoudiniApiRecorder::IsActive() )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "HAPI call tracing cannot be enabled while the HAPI calls are recorded or replayed." ) );
+        return;
+    }
+
+#define HOUDINI_API_TRACE_HOOK( NAME ) \
+    HookHoudiniApiFunction< EHoudiniApiFunction::NAME >( FHoudiniApi::NAME, bEnabled );
+
+    HOUDINI_API_FUNCTIONS( HOUDINI_API_TRACE_HOOK )
+
+#undef HOUDINI_API_TRACE_HOOK
+
+    bHoudiniApiTraceEnabled = bEnabled;
+    HOUDINI_LOG_MESSAGE( TEXT( "HAPI call tracing %s." ), bEnabled ? TEXT( "enabled" ) : TEXT( "disabled" ) );
+}
+
+bool
+FHoudiniApiTrace::IsEnabled()
+{
+    return bHoudiniApiTraceEnabled;
+}
+
+void
+FHoudiniApiTrace::GetThreadTotals( int64 & OutCallCount, int64 & OutBytes )
+{
+    OutCallCount = HoudiniApiTraceThreadCallCount;
+    OutBytes = HoudiniApiTraceThreadBytes;
+}
+
+void
+FHoudiniApiTrace::Reset()
+{
+    FMemory::Memzero( (void *) HoudiniApiTraceStats, sizeof( HoudiniApiTraceStats ) );
+    FMemory::Memzero( (void *) HoudiniApiTraceSessionStats, sizeof( HoudiniApiTraceSessionStats ) );
+}
+
+void
+FHoudiniApiTrace::RecordCall( int32 FunctionIndex, uint64 Cycles, int64 BytesSent, int64 BytesReceived )
+{
+    FHoudiniApiTraceStats & Stats = HoudiniApiTraceStats[ FunctionIndex ];
+
+    FPlatformAtomics::InterlockedIncrement( &Stats.CallCount );
+    FPlatformAtomics::InterlockedAdd( &Stats.Cycles, (int64) Cycles );
+
+    HoudiniApiTraceThreadCallCount++;
+    HoudiniApiTraceThreadBytes += FMath::Max< int64 >( BytesSent, 0 ) + FMath::Max< int64 >( BytesReceived, 0 );
+
+    if ( BytesSent > 0 )
+        FPlatformAtomics::InterlockedAdd( &Stats.BytesSent, BytesSent );
+
+    if ( BytesReceived > 0 )
+        FPlatformAtomics::InterlockedAdd( &Stats.BytesReceived, BytesReceived );
+
+    const uint64 Microseconds = (uint64)( FPlatformTime::ToSeconds64( Cycles ) * 1000000.0 );
+    const int32 Bucket = Microseconds > 0
+        ? FMath::Min( (int32) FMath::FloorLog2_64( Microseconds ) + 1, HoudiniApiTraceHistogramSize - 1 ) : 0;
+    FPlatformAtomics::InterlockedIncrement( &Stats.Histogram[ Bucket ] );
+
+    // Calls are made on the session used by the current thread.
+    const int32 SessionIndex = FHoudiniScopedSession::GetCurrentSessionIndex();
+    if ( SessionIndex >= 0 && SessionIndex < HAPI_UNREAL_SESSION_POOL_MAX_SIZE )
+    {
+        FHoudiniApiTraceSessionStats & SessionStats = HoudiniApiTraceSessionStats[ SessionIndex ];
+        FPlatformAtomics::InterlockedIncrement( &SessionStats.CallCount );
+        FPlatformAtomics::InterlockedAdd( &SessionStats.Cycles, (int64) Cycles );
+        FPlatformAtomics::InterlockedAdd( &SessionStats.BytesSent, BytesSent );
+        FPlatformAtomics::InterlockedAdd( &SessionStats.BytesReceived, BytesReceived );
+    }
+
+    INC_DWORD_STAT( STAT_HapiCallCount );
+    INC_DWORD_STAT_BY( STAT_HapiBytesSent, (uint32) BytesSent );
+    INC_DWORD_STAT_BY( STAT_HapiBytesReceived, (uint32) BytesReceived );
+}
+
+void
+FHoudiniApiTrace::DumpTopFunctions( int32 FunctionCount )
+{
+    TArray< int32 > FunctionIndices;
+    GetHoudiniApiTraceCalledFunctions( FunctionIndices );
+
+    if ( FunctionIndices.Num() <= 0 )
+    {
+        HOUDINI_LOG_MESSAGE( TEXT( "No HAPI calls have been traced." ) );
+        return;
+    }
+
+    double TotalMilliseconds = 0.0;
+    for ( int32 FunctionIndex : FunctionIndices )
+        TotalMilliseconds += FPlatformTime::ToMilliseconds64( HoudiniApiTraceStats[ FunctionIndex ].Cycles );
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "HAPI calls: %d functions called, %.3f ms in total. Top functions by wall time:" ),
+        FunctionIndices.Num(), TotalMilliseconds );
+
+    for ( int32 Idx = 0; Idx < FunctionIndices.Num() && Idx < FunctionCount; ++Idx )
+    {
+        const int32 FunctionIndex = FunctionIndices[ Idx ];
+        const FHoudiniApiTraceStats & Stats = HoudiniApiTraceStats[ FunctionIndex ];
+        const double Milliseconds = FPlatformTime::ToMilliseconds64( Stats.Cycles );
+
+        HOUDINI_LOG_MESSAGE(
+            TEXT( "    %-32s calls %8lld total %10.3f ms avg %8.3f ms p50 %8.3f ms p99 %8.3f ms sent %lld B received %lld B" ),
+            GetHoudiniApiFunctionName( FunctionIndex ), Stats.CallCount, Milliseconds, Milliseconds / Stats.CallCount,
+            GetHoudiniApiTracePercentile( Stats, 0.5 ), GetHoudiniApiTracePercentile( Stats, 0.99 ),
+            Stats.BytesSent, Stats.BytesReceived );
+    }
+}
+
+void
+FHoudiniApiTrace::DumpSessions()
+{
+    bool bHasCalls = false;
+    for ( int32 SessionIndex = 0; SessionIndex < HAPI_UNREAL_SESSION_POOL_MAX_SIZE; ++SessionIndex )
+    {
+        const FHoudiniApiTraceSessionStats & SessionStats = HoudiniApiTraceSessionStats[ SessionIndex ];
+        if ( SessionStats.CallCount <= 0 )
+            continue;
+
+        const double Seconds = FPlatformTime::ToSeconds64( SessionStats.Cycles );
+        const double Megabytes = ( SessionStats.BytesSent + SessionStats.BytesReceived ) / ( 1024.0 * 1024.0 );
+
+        HOUDINI_LOG_MESSAGE(
+            TEXT( "HAPI session %d: calls %lld total %.3f ms sent %lld B received %lld B throughput %.3f MB/s" ),
+            SessionIndex, SessionStats.CallCount, Seconds * 1000.0, SessionStats.BytesSent, SessionStats.BytesReceived,
+            Seconds > 0.0 ? Megabytes / Seconds : 0.0 );
+
+        bHasCalls = true;
+    }
+
+    if ( !bHasCalls )
+        HOUDINI_LOG_MESSAGE( TEXT( "No HAPI calls have been traced." ) );
+}
+
+bool
+FHoudiniApiTrace::WriteCsv( const FString & FileName )
+{
+    TArray< int32 > FunctionIndices;
+    GetHoudiniApiTraceCalledFunctions( FunctionIndices );
+
+    FString Csv = TEXT( "Function,Calls,TotalMs,AverageMs,P50Ms,P99Ms,BytesSent,BytesReceived\n" );
+    for ( int32 FunctionIndex : FunctionIndices )
+    {
+        const FHoudiniApiTraceStats & Stats = HoudiniApiTraceStats[ FunctionIndex ];
+        const double Milliseconds = FPlatformTime::ToMilliseconds64( Stats.Cycles );
+
+        Csv += FString::Printf(
+            TEXT( "%s,%lld,%.3f,%.3f,%.3f,%.3f,%lld,%lld\n" ),
+            GetHoudiniApiFunctionName( FunctionIndex ), Stats.CallCount, Milliseconds, Milliseconds / Stats.CallCount,
+            GetHoudiniApiTracePercentile( Stats, 0.5 ), GetHoudiniApiTracePercentile( Stats, 0.99 ),
+            Stats.BytesSent, Stats.BytesReceived );
+    }
+
+    if ( !FFileHelper::SaveStringToFile( Csv, *FileName ) )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "Failed writing the HAPI call trace to %s." ), *FileName );
+        return false;
+    }
+
+    HOUDINI_LOG_MESSAGE( TEXT( "HAPI call trace written to %s." ), *FileName );
+    return true;
+}
+
+static FAutoConsoleCommand HoudiniApiTraceEnableCommand(
+    TEXT( "Houdini.ApiTrace.Enable" ),
+    TEXT( "Enable (1) or disable (0) the tracing of the HAPI calls." ),
+    FConsoleCommandWithArgsDelegate::CreateLambda( []( const TArray< FString > & Args )
+    {
+        FHoudiniApiTrace::SetEnabled( Args.Num() <= 0 || Args[ 0 ].ToBool() );
+    } ) );
+
+static FAutoConsoleCommand HoudiniApiTraceResetCommand(
+    TEXT( "Houdini.ApiTrace.Reset" ),
+    TEXT( "Clear the recorded HAPI call statistics, typically before tracing a cook." ),
+    FConsoleCommandDelegate::CreateStatic( &FHoudiniApiTrace::Reset ) );
+
+static FAutoConsoleCommand HoudiniApiTraceDumpCommand(
+    TEXT( "Houdini.ApiTrace.Dump" ),
+    TEXT( "Log the HAPI functions with the highest total wall time, optionally followed by the number of functions to list." ),
+    FConsoleCommandWithArgsDelegate::CreateLambda( []( const TArray< FString > & Args )
+    {
+        FHoudiniApiTrace::DumpTopFunctions( Args.Num() > 0 ? FCString::Atoi( *Args[ 0 ] ) : HAPI_UNREAL_API_TRACE_DUMP_COUNT );
+    } ) );
+
+static FAutoConsoleCommand HoudiniApiTraceSessionsCommand(
+    TEXT( "Houdini.ApiTrace.Sessions" ),
+    TEXT( "Log the HAPI payload bytes and throughput of each session of the pool." ),
+    FConsoleCommandDelegate::CreateStatic( &FHoudiniApiTrace::DumpSessions ) );
+
+static FAutoConsoleCommand HoudiniApiTraceCsvCommand(
+    TEXT( "Houdini.ApiTrace.Csv" ),
+    TEXT( "Write the recorded HAPI call statistics to a CSV file, in the project log folder unless a file is given." ),
+    FConsoleCommandWithArgsDelegate::CreateLambda( []( const TArray< FString > & Args )
+    {
+        FHoudiniApiTrace::WriteCsv( Args.Num() > 0
+            ? Args[ 0 ] : FPaths::Combine( FPaths::ProjectLogDir(), HAPI_UNREAL_API_TRACE_CSV_FILE ) );
+    } ) );
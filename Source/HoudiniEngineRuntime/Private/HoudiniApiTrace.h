@@ -0,0 +1,58 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/** Opt-in tracing of the HAPI calls dispatched through FHoudiniApi. **/
+// While enabled, the FHoudiniApi function pointers are replaced by wrappers recording the
+// call count, payload bytes and wall time of each function before forwarding the call.
+struct HOUDINIENGINERUNTIME_API FHoudiniApiTrace
+{
+    /** Install or remove the tracing wrappers, must be called after HAPI has been initialized. **/
+    static void SetEnabled( bool bEnabled );
+
+    /** Return true if the tracing wrappers are installed. **/
+    static bool IsEnabled();
+
+    /** Clear the statistics recorded so far, typically before tracing a cook. **/
+    static void Reset();
+
+    /** Log the statistics of the functions with the highest total wall time. **/
+    static void DumpTopFunctions( int32 FunctionCount );
+
+    /** Log the transfer statistics of each session of the pool, to compare the throughput of local and remote sessions. **/
+    static void DumpSessions();
+
+    /** Write the statistics of every traced function that has been called to a CSV file. **/
+    static bool WriteCsv( const FString & FileName );
+
+    /** Return the number of traced calls made by the current thread so far, and the payload bytes they transferred. **/
+    static void GetThreadTotals( int64 & OutCallCount, int64 & OutBytes );
+
+    /** Record a call of the given function, used by the tracing wrappers. **/
+    static void RecordCall( int32 FunctionIndex, uint64 Cycles, int64 BytesSent, int64 BytesReceived );
+};
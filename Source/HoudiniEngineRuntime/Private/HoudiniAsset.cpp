@@ -33,6 +33,7 @@
 #include "HoudiniAsset.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
 #include "HoudiniEngineUtils.h"
 
 const uint32
@@ -41,11 +42,13 @@ UHoudiniAsset::PersistenceFormatVersion = 2u;
 UHoudiniAsset::UHoudiniAsset( const FObjectInitializer & ObjectInitializer )
     : Super( ObjectInitializer )
     , AssetFileName( TEXT( "" ) )
-    , AssetBytes( nullptr )
     , AssetBytesCount( 0 )
     , FileFormatVersion( UHoudiniAsset::PersistenceFormatVersion )
     , HoudiniAssetFlagsPacked ( 0u )
-{}
+{
+    // Keep the OTL payload out of the export data so loading the asset does not load it.
+    AssetBulkData.SetBulkDataFlags( BULKDATA_Force_NOT_InlinePayload );
+}
 
 void
 UHoudiniAsset::CreateAsset( const uint8 * BufferStart, const uint8 * BufferEnd, const FString & InFileName )
@@ -55,17 +58,15 @@ UHoudiniAsset::CreateAsset( const uint8 * BufferStart, const uint8 * BufferEnd,
     // Calculate buffer size.
     AssetBytesCount = BufferEnd - BufferStart;
 
-    if ( AssetBytesCount )
-    {
-        // Allocate buffer to store OTL raw data.
-        AssetBytes = static_cast< uint8 * >( FMemory::Malloc( AssetBytesCount ) );
+    // Hash the data while we have it, reimports compare against it.
+    AssetBytesHash = UHoudiniAsset::ComputeAssetBytesHash( BufferStart, AssetBytesCount );
 
-        if ( AssetBytes )
-        {
-            // Copy data into a newly allocated buffer.
-            FMemory::Memcpy( AssetBytes, BufferStart, AssetBytesCount );
-        }
-    }
+    // Copy OTL raw data into the bulk data.
+    AssetBulkData.Lock( LOCK_READ_WRITE );
+    void * AssetBytes = AssetBulkData.Realloc( AssetBytesCount );
+    if ( AssetBytes && AssetBytesCount )
+        FMemory::Memcpy( AssetBytes, BufferStart, AssetBytesCount );
+    AssetBulkData.Unlock();
 
     FString FileExtension = FPaths::GetExtension( InFileName );
 
@@ -82,9 +83,18 @@ UHoudiniAsset::CreateAsset( const uint8 * BufferStart, const uint8 * BufferEnd,
 }
 
 const uint8 *
-UHoudiniAsset::GetAssetBytes() const
+UHoudiniAsset::LockAssetBytes() const
+{
+    if ( !AssetBytesCount || AssetBulkData.GetBulkDataSize() <= 0 )
+        return nullptr;
+
+    return static_cast< const uint8 * >( AssetBulkData.LockReadOnly() );
+}
+
+void
+UHoudiniAsset::UnlockAssetBytes() const
 {
-    return AssetBytes;
+    AssetBulkData.Unlock();
 }
 
 const FString &
@@ -99,6 +109,32 @@ UHoudiniAsset::GetAssetBytesCount() const
     return AssetBytesCount;
 }
 
+const FString &
+UHoudiniAsset::GetAssetBytesHash() const
+{
+    if ( AssetBytesHash.IsEmpty() )
+    {
+        if ( const uint8 * AssetBytes = LockAssetBytes() )
+        {
+            AssetBytesHash = UHoudiniAsset::ComputeAssetBytesHash( AssetBytes, AssetBytesCount );
+            UnlockAssetBytes();
+        }
+    }
+
+    return AssetBytesHash;
+}
+
+FString
+UHoudiniAsset::ComputeAssetBytesHash( const uint8 * Bytes, uint32 BytesCount )
+{
+    if ( !Bytes || !BytesCount )
+        return FString();
+
+    FSHAHash Hash;
+    FSHA1::HashBuffer( Bytes, BytesCount, Hash.Hash );
+    return Hash.ToString();
+}
+
 bool
 UHoudiniAsset::IsPreviewHoudiniLogo() const
 {
@@ -109,12 +145,8 @@ void
 UHoudiniAsset::FinishDestroy()
 {
     // Release buffer which was used to store raw OTL data.
-    if ( AssetBytes )
-    {
-        FMemory::Free( AssetBytes );
-        AssetBytes = nullptr;
-        AssetBytesCount = 0;
-    }
+    AssetBulkData.RemoveBulkData();
+    AssetBytesCount = 0;
 
     Super::FinishDestroy();
 }
@@ -134,21 +166,28 @@ UHoudiniAsset::Serialize( FArchive & Ar )
     Ar << AssetBytesCount;
 
     if ( Ar.IsLoading() )
+        AssetBytesHash.Empty();
+
+    if ( Ar.CustomVer( FHoudiniCustomSerializationVersion::GUID ) >= VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_ASSET_BULK_DATA )
     {
-        // If buffer was previously used, release it.
-        if ( AssetBytes )
-        {
-            FMemory::Free( AssetBytes );
-            AssetBytes = nullptr;
-        }
+        // The hash is saved so finding loaded libraries and validating recovery data never loads the payload.
+        if ( Ar.IsSaving() )
+            GetAssetBytesHash();
 
-        // Allocate sufficient space to read stored raw OTL data.
-        if ( AssetBytesCount )
-            AssetBytes = static_cast< uint8 * >( FMemory::Malloc( AssetBytesCount ) );
-    }
+        Ar << AssetBytesHash;
 
-    if ( AssetBytes && AssetBytesCount )
-        Ar.Serialize( AssetBytes, AssetBytesCount );
+        AssetBulkData.SetBulkDataFlags( BULKDATA_Force_NOT_InlinePayload );
+        AssetBulkData.Serialize( Ar, this );
+    }
+    else if ( Ar.IsLoading() )
+    {
+        // Older assets stored raw OTL data inline, move it into the bulk data.
+        AssetBulkData.Lock( LOCK_READ_WRITE );
+        void * AssetBytes = AssetBulkData.Realloc( AssetBytesCount );
+        if ( AssetBytes && AssetBytesCount )
+            Ar.Serialize( AssetBytes, AssetBytesCount );
+        AssetBulkData.Unlock();
+    }
 
     // Serialize flags.
     Ar << HoudiniAssetFlagsPacked;
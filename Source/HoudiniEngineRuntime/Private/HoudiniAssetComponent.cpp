@@ -60,20 +60,24 @@
 #include "HoudiniMeshSplitInstancerComponent.h"
 #include "HoudiniParamUtils.h"
 #include "HoudiniLandscapeUtils.h"
+#include "HoudiniOutputMemoryUsage.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Landscape.h"
 #include "Logging/MessageLog.h"
 #include "Misc/UObjectToken.h"
 #include "LandscapeInfo.h"
+#include "LandscapeComponent.h"
 #include "LandscapeLayerInfoObject.h"
 #include "Materials/MaterialInstance.h"
 #include "Engine/StaticMeshSocket.h"
 #include "HoudiniCookHandler.h"
 #include "UObject/MetaData.h"
+#include "SceneManagement.h"
 #if WITH_EDITOR
 #include "UnrealEdGlobals.h"
 #include "Editor/UnrealEdEngine.h"
 #include "Editor.h"
+#include "LevelEditorViewport.h"
 #include "EdMode.h"
 #include "EditorModeManager.h"
 #include "EditorModes.h"
@@ -97,6 +101,11 @@
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
 
+DECLARE_CYCLE_STAT( TEXT( "Houdini: Post Cook" ), STAT_PostCook, STATGROUP_HoudiniEngine );
+DECLARE_CYCLE_STAT( TEXT( "Houdini: Create Instancers" ), STAT_CreateInstancers, STATGROUP_HoudiniEngine );
+DECLARE_CYCLE_STAT( TEXT( "Houdini: Create Landscapes" ), STAT_CreateLandscapes, STATGROUP_HoudiniEngine );
+DECLARE_CYCLE_STAT( TEXT( "Houdini: UI Refresh" ), STAT_UIRefresh, STATGROUP_HoudiniEngine );
+
 #if WITH_EDITOR
 
  /** Slate widget used to pick an asset to instantiate from an HDA with multiple assets inside. **/
@@ -296,6 +305,59 @@ SAssetSelectionWidget::OnButtonCancel()
     } \
     while( 0 )
 
+FHoudiniMultiEditGroup::FHoudiniMultiEditGroup()
+    : bPropagatingChange( false )
+{}
+
+FHoudiniPostCookState::FHoudiniPostCookState()
+    : Stage( EHoudiniPostCookStage::None )
+    , NextMeshPart( 0 )
+    , bOutputChanged( false )
+    , bSocketActorsIndexed( false )
+{}
+
+void
+FHoudiniPostCookState::Reset()
+{
+    Stage = EHoudiniPostCookStage::None;
+    NewStaticMeshes.Empty();
+    MeshParts.Empty();
+    NextMeshPart = 0;
+    Instancers.Empty();
+    Curves.Empty();
+    Volumes.Empty();
+    StaleParts.Empty();
+    PendingRegistrations.Empty();
+    bOutputChanged = false;
+    SocketActorsByName.Empty();
+    bSocketActorsIndexed = false;
+}
+
+int32
+FHoudiniGeoPartTable::Add( const FHoudiniGeoPartObject & GeoPartObject )
+{
+    const int32 * FoundIndex = PartIndices.Find( GeoPartObject );
+    if ( FoundIndex )
+        return *FoundIndex;
+
+    const int32 Index = Parts.Add( GeoPartObject );
+    PartIndices.Add( GeoPartObject, Index );
+    return Index;
+}
+
+void
+FHoudiniGeoPartTable::Serialize( FArchive & Ar )
+{
+    Ar << Parts;
+
+    if ( Ar.IsLoading() )
+    {
+        PartIndices.Empty( Parts.Num() );
+        for ( int32 Index = 0; Index < Parts.Num(); ++Index )
+            PartIndices.Add( Parts[ Index ], Index );
+    }
+}
+
 bool
 UHoudiniAssetComponent::bDisplayEngineNotInitialized = true;
 
@@ -307,12 +369,15 @@ UHoudiniAssetComponent::UHoudiniAssetComponent( const FObjectInitializer & Objec
 {
     HoudiniAsset = nullptr;
     bManualRecookRequested = false;
+    CookPreviewBounds.Init();
     PreviousTransactionHoudiniAsset = nullptr;
     HoudiniAssetComponentMaterials = nullptr;
 #if WITH_EDITOR
     CopiedHoudiniComponent = nullptr;
 #endif
     AssetId = -1;
+    SessionIndex = 0;
+    SharedCookOutputsKey = 0;
     GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
     TransformScaleFactor = HAPI_UNREAL_SCALE_FACTOR_TRANSLATION;
     ImportAxis = HRSAI_Unreal;
@@ -367,6 +432,7 @@ UHoudiniAssetComponent::UHoudiniAssetComponent( const FObjectInitializer & Objec
     bGeneratedUseMaximumStreamingTexelRatio = false;
     GeneratedStreamingDistanceMultiplier = 1.0f;
     GeneratedDistanceFieldResolutionScale = 0.0f;
+    GeneratedAutoLODTriangleBudget = 0;
 
     bNeedToUpdateNavigationSystem = false;
 
@@ -377,6 +443,7 @@ UHoudiniAssetComponent::UHoudiniAssetComponent( const FObjectInitializer & Objec
     ComponentGUID = FGuid::NewGuid();
 
     bEditorPropertiesNeedFullUpdate = true;
+    ParameterInterfaceHash = 0;
 
     bFullyLoaded = false;
 
@@ -400,45 +467,32 @@ UHoudiniAssetComponent::AddReferencedObjects( UObject * InThis, FReferenceCollec
 
     if ( HoudiniAssetComponent && !HoudiniAssetComponent->IsPendingKill() )
     {
-        // Add references for all parameters.
-        for ( TMap< HAPI_ParmId, UHoudiniAssetParameter * >::TIterator
-            IterParams( HoudiniAssetComponent->Parameters ); IterParams; ++IterParams )
-        {
-            UHoudiniAssetParameter * HoudiniAssetParameter = IterParams.Value();
-            if ( HoudiniAssetParameter && !HoudiniAssetParameter->IsPendingKill() )
-                Collector.AddReferencedObject( HoudiniAssetParameter, InThis );
-        }
+        // Parameters, inputs, instance inputs, handles and material assignments are properties referenced by the
+        // class token stream. Only the containers the reflection system can't describe are walked here.
 
-        // Add references to all inputs.
-        for ( TArray< UHoudiniAssetInput * >::TIterator
-            IterInputs( HoudiniAssetComponent->Inputs ); IterInputs; ++IterInputs )
-        {
-            UHoudiniAssetInput * HoudiniAssetInput = *IterInputs;
-            if ( HoudiniAssetInput && !HoudiniAssetInput->IsPendingKill() )
-                Collector.AddReferencedObject( HoudiniAssetInput, InThis );
-        }
-
-        // Add references to all instance inputs.
-        for ( auto& InstanceInput : HoudiniAssetComponent->InstanceInputs)
+        // Add references to all static meshes and corresponding geo parts.
+        for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator
+            Iter( HoudiniAssetComponent->StaticMeshes ); Iter; ++Iter )
         {
-            if ( !InstanceInput || InstanceInput->IsPendingKill() )
-                continue;
-
-            Collector.AddReferencedObject( InstanceInput, InThis );
+            UStaticMesh * StaticMesh = Iter.Value();
+            if ( StaticMesh && !StaticMesh->IsPendingKill() )
+                Collector.AddReferencedObject( StaticMesh, InThis );
         }
 
-        // Add references to all handles.
-        for ( TMap< FString, UHoudiniHandleComponent * >::TIterator
-            IterHandles( HoudiniAssetComponent->HandleComponents ); IterHandles; ++IterHandles )
+        // Add references to the static meshes kept by preset snapshots.
+        for ( const FHoudiniPresetSnapshot & PresetSnapshot : HoudiniAssetComponent->PresetSnapshots )
         {
-            UHoudiniHandleComponent * HandleComponent = IterHandles.Value();
-            if ( HandleComponent && !HandleComponent->IsPendingKill() )
-                Collector.AddReferencedObject( HandleComponent, InThis );
+            for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( PresetSnapshot.StaticMeshes ); Iter; ++Iter )
+            {
+                UStaticMesh * StaticMesh = Iter.Value();
+                if ( StaticMesh && !StaticMesh->IsPendingKill() )
+                    Collector.AddReferencedObject( StaticMesh, InThis );
+            }
         }
 
-        // Add references to all static meshes and corresponding geo parts.
+        // Add references to the static meshes of a post cook in progress.
         for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator
-            Iter( HoudiniAssetComponent->StaticMeshes ); Iter; ++Iter )
+            Iter( HoudiniAssetComponent->PostCookState.NewStaticMeshes ); Iter; ++Iter )
         {
             UStaticMesh * StaticMesh = Iter.Value();
             if ( StaticMesh && !StaticMesh->IsPendingKill() )
@@ -501,11 +555,6 @@ UHoudiniAssetComponent::AddReferencedObjects( UObject * InThis, FReferenceCollec
             // Manually add a reference to Houdini asset from this component.
             Collector.AddReferencedObject( HoudiniAsset, InThis );
         }
-
-        // Add reference to material replacements.
-        UHoudiniAssetComponentMaterials* HoudiniAssetComponentMaterials = HoudiniAssetComponent->HoudiniAssetComponentMaterials;
-        if ( HoudiniAssetComponentMaterials && !HoudiniAssetComponentMaterials->IsPendingKill() )
-            Collector.AddReferencedObject( HoudiniAssetComponent->HoudiniAssetComponentMaterials, InThis );
     }
 
     // Call base implementation.
@@ -533,9 +582,124 @@ UHoudiniAssetComponent::SetAssetId( HAPI_NodeId InAssetId )
 bool
 UHoudiniAssetComponent::HasValidAssetId() const
 {
+    FHoudiniScopedSession ScopedSession( SessionIndex );
     return FHoudiniEngineUtils::IsHoudiniNodeValid( AssetId );
 }
 
+const FHoudiniCookProfile &
+UHoudiniAssetComponent::GetCookProfile() const
+{
+    return CookProfile;
+}
+
+const FHoudiniLoadProfile &
+UHoudiniAssetComponent::GetLoadProfile() const
+{
+    return LoadProfile;
+}
+
+FHoudiniCookMetrics
+UHoudiniAssetComponent::GetLastCookMetrics() const
+{
+    return LastCookMetrics;
+}
+
+FString
+FHoudiniCookMetrics::ToString() const
+{
+    FString Metrics = FString::Printf(
+        TEXT( "queued %.2fs, cooked %.2fs, outputs %.2fs" ), QueueSeconds, CookSeconds, PostCookSeconds );
+
+    if ( HapiCallCount > 0 )
+        Metrics += FString::Printf( TEXT( ", %d HAPI calls, %.1f MB" ), HapiCallCount, HapiMegabytes );
+
+    return Metrics;
+}
+
+void
+UHoudiniAssetComponent::GetOutputMemoryUsage( FHoudiniOutputMemoryUsage & MemoryUsage ) const
+{
+    for ( const auto & StaticMeshPair : StaticMeshes )
+        MemoryUsage.AddObject( EHoudiniOutputMemoryCategory::StaticMeshes, StaticMeshPair.Value );
+
+    // Temporary materials and textures are the objects of the cooked temporary packages.
+    for ( const auto & PackagePair : CookedTemporaryPackages )
+    {
+        UPackage * Package = PackagePair.Value.Get();
+        if ( !Package || Package->IsPendingKill() )
+            continue;
+
+        ForEachObjectWithOuter( Package, [ &MemoryUsage ]( UObject * Object )
+        {
+            if ( Object->IsA< UTexture >() )
+                MemoryUsage.AddObject( EHoudiniOutputMemoryCategory::Textures, Object );
+            else if ( Object->IsA< UMaterialInterface >() )
+                MemoryUsage.AddObject( EHoudiniOutputMemoryCategory::Materials, Object );
+        }, false );
+    }
+
+    for ( const auto & LandscapePair : LandscapeComponents )
+    {
+        ALandscape * Landscape = LandscapePair.Value.Get();
+        if ( !Landscape || Landscape->IsPendingKill() )
+            continue;
+
+        for ( ULandscapeComponent * LandscapeComponent : Landscape->LandscapeComponents )
+        {
+            if ( !LandscapeComponent )
+                continue;
+
+            MemoryUsage.AddObject( EHoudiniOutputMemoryCategory::Landscapes, LandscapeComponent );
+            MemoryUsage.AddObject( EHoudiniOutputMemoryCategory::Landscapes, LandscapeComponent->HeightmapTexture );
+            for ( UTexture2D * WeightmapTexture : LandscapeComponent->WeightmapTextures )
+                MemoryUsage.AddObject( EHoudiniOutputMemoryCategory::Landscapes, WeightmapTexture );
+        }
+    }
+
+    for ( const UHoudiniAssetInstanceInputField * InstanceInputField : GetAllInstanceInputFields() )
+    {
+        if ( !InstanceInputField || InstanceInputField->IsPendingKill() )
+            continue;
+
+        for ( int32 VariationIdx = 0; VariationIdx < InstanceInputField->InstanceVariationCount(); ++VariationIdx )
+        {
+            USceneComponent * InstancedComponent = InstanceInputField->GetInstancedComponent( VariationIdx );
+            if ( !InstancedComponent )
+                continue;
+
+            // Split instancers and instanced actors hold their instances in child components.
+            MemoryUsage.AddObject( EHoudiniOutputMemoryCategory::Instancers, InstancedComponent );
+            for ( USceneComponent * ChildComponent : InstancedComponent->GetAttachChildren() )
+                MemoryUsage.AddObject( EHoudiniOutputMemoryCategory::Instancers, ChildComponent );
+        }
+    }
+}
+
+void
+UHoudiniAssetComponent::CheckOutputMemoryUsage() const
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( !HoudiniRuntimeSettings || HoudiniRuntimeSettings->OutputMemoryWarningThresholdMB <= 0 )
+        return;
+
+    FHoudiniOutputMemoryUsage MemoryUsage;
+    GetOutputMemoryUsage( MemoryUsage );
+
+    const double TotalMB = MemoryUsage.GetTotalBytes() / ( 1024.0 * 1024.0 );
+    if ( TotalMB > HoudiniRuntimeSettings->OutputMemoryWarningThresholdMB )
+    {
+        HOUDINI_LOG_WARNING(
+            TEXT( "%s: cooked outputs use %.1f MB, above the %d MB warning threshold, see Houdini.Memory.Largest." ),
+            GetOwner() ? *GetOwner()->GetName() : *GetName(), TotalMB, HoudiniRuntimeSettings->OutputMemoryWarningThresholdMB );
+    }
+}
+
+int32
+UHoudiniAssetComponent::GetSessionIndex() const
+{
+    return SessionIndex;
+}
+
 bool
 UHoudiniAssetComponent::IsComponentValid() const
 {
@@ -577,6 +741,9 @@ UHoudiniAssetComponent::SetHoudiniAsset( UHoudiniAsset * InHoudiniAsset )
     UHoudiniAsset * Asset = nullptr;
     AHoudiniAssetActor * HoudiniAssetActor = Cast< AHoudiniAssetActor >( GetOwner() );
 
+    // Outputs kept for the presets of the previous asset are of no use anymore.
+    ClearPresetSnapshots();
+
     HoudiniAsset = InHoudiniAsset;
 
     // Reset material tracking.
@@ -644,7 +811,12 @@ UHoudiniAssetComponent::SetHoudiniAsset( UHoudiniAsset * InHoudiniAsset )
             if ( !bLoadedComponent )
             {
                 // If component is not a loaded component, instantiate and start ticking.
-                StartTaskAssetInstantiation( false, true );
+                // Components placed in the editor are instantiated together on the next tick.
+                FHoudiniEngineInstantiationBatch & InstantiationBatch = HoudiniEngine.GetInstantiationBatch();
+                if ( InstantiationBatch.IsAssigningAsset() )
+                    InstantiationBatch.AddComponent( this );
+                else
+                    StartTaskAssetInstantiation( false, true );
             }
             else if ( bTransactionAssetChange )
             {
@@ -652,6 +824,17 @@ UHoudiniAssetComponent::SetHoudiniAsset( UHoudiniAsset * InHoudiniAsset )
                 StartTaskAssetInstantiation( true, true );
             }
         }
+        else if ( HoudiniEngine.IsSessionStarting() )
+        {
+            // Keep ticking until the session is up, we will instantiate then.
+            if ( !bLoadedComponent || bTransactionAssetChange )
+            {
+                bInstantiateWhenSessionStarted = true;
+                bInstantiateWhenSessionStartedAsLoaded = bLoadedComponent;
+            }
+
+            StartHoudiniTicking();
+        }
         else
         {
             if ( UHoudiniAssetComponent::bDisplayEngineHapiVersionMismatch && HoudiniEngine.CheckHapiVersionMismatch() )
@@ -751,157 +934,255 @@ UHoudiniAssetComponent::RemoveDownstreamAsset( UHoudiniAssetComponent * InDownst
     }
 }
 
+/** Hash the state of an attached component that affects its render and physics representation. **/
+static uint32
+HoudiniEngineComputeRenderStateHash( USceneComponent * SceneComponent )
+{
+    uint32 Hash = GetTypeHash( SceneComponent->GetAttachSocketName() );
+
+    const FTransform RelativeTransform = SceneComponent->GetRelativeTransform();
+    Hash = HashCombine( Hash, GetTypeHash( RelativeTransform.GetLocation() ) );
+    Hash = HashCombine( Hash, GetTypeHash( RelativeTransform.GetRotation().Euler() ) );
+    Hash = HashCombine( Hash, GetTypeHash( RelativeTransform.GetScale3D() ) );
+    Hash = HashCombine( Hash, GetTypeHash( (uint8) SceneComponent->Mobility ) );
+    Hash = HashCombine( Hash, GetTypeHash( (uint8) SceneComponent->IsVisible() ) );
+
+    if ( UPrimitiveComponent * PrimitiveComponent = Cast< UPrimitiveComponent >( SceneComponent ) )
+    {
+        const int32 MaterialCount = PrimitiveComponent->GetNumMaterials();
+        for ( int32 MaterialIdx = 0; MaterialIdx < MaterialCount; ++MaterialIdx )
+            Hash = HashCombine( Hash, GetTypeHash( PrimitiveComponent->GetMaterial( MaterialIdx ) ) );
+    }
+
+    if ( UStaticMeshComponent * StaticMeshComponent = Cast< UStaticMeshComponent >( SceneComponent ) )
+        Hash = HashCombine( Hash, GetTypeHash( StaticMeshComponent->GetStaticMesh() ) );
+
+    if ( UInstancedStaticMeshComponent * InstancedComponent = Cast< UInstancedStaticMeshComponent >( SceneComponent ) )
+    {
+        const TArray< FInstancedStaticMeshInstanceData > & InstanceData = InstancedComponent->PerInstanceSMData;
+        Hash = HashCombine( Hash, GetTypeHash( InstanceData.Num() ) );
+        if ( InstanceData.Num() > 0 )
+            Hash = FCrc::MemCrc32( InstanceData.GetData(), InstanceData.Num() * InstanceData.GetTypeSize(), Hash );
+    }
+
+    return Hash;
+}
+
 void
 UHoudiniAssetComponent::CreateObjectGeoPartResources(
     TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshMap )
+{
+    FHoudiniPostCookState LocalPostCookState;
+    BeginObjectGeoPartResources( StaticMeshMap, LocalPostCookState );
+
+    for ( const FHoudiniGeoPartObject & HoudiniGeoPartObject : LocalPostCookState.MeshParts )
+        CreateObjectGeoPartComponent( HoudiniGeoPartObject, StaticMeshMap.FindRef( HoudiniGeoPartObject ), LocalPostCookState );
+
+    EndObjectGeoPartComponents( StaticMeshMap, LocalPostCookState );
+
+#if WITH_EDITOR
+    if ( FHoudiniEngineUtils::IsHoudiniNodeValid( AssetId ) )
+    {
+        // Create necessary instance inputs.
+        CreateInstanceInputs( LocalPostCookState.Instancers );
+
+        // Create necessary curves.
+        CreateCurves( LocalPostCookState.Curves );
+
+        // Create necessary landscapes
+        CreateAllLandscapes( LocalPostCookState.Volumes );
+    }
+#endif
+
+    FinishObjectGeoPartResources();
+}
+
+void
+UHoudiniAssetComponent::BeginObjectGeoPartResources(
+    const TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshMap, FHoudiniPostCookState & PostCookStateRef )
 {
     // Reset Houdini logo flag.
     bContainsHoudiniLogoGeometry = false;
-    
-    // We need to store instancers as they need to be processed after all other meshes.
-    TArray< FHoudiniGeoPartObject > FoundInstancers;
-    TArray< FHoudiniGeoPartObject > FoundCurves;
-    TArray< FHoudiniGeoPartObject > FoundVolumes;
-    TMap< FHoudiniGeoPartObject, UStaticMesh* > StaleParts;
 
-    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( StaticMeshMap ); Iter; ++Iter )
+    // We need to store instancers as they need to be processed after all other meshes.
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( StaticMeshMap ); Iter; ++Iter )
     {
-        const FHoudiniGeoPartObject HoudiniGeoPartObject = Iter.Key();
+        const FHoudiniGeoPartObject & HoudiniGeoPartObject = Iter.Key();
         UStaticMesh * StaticMesh = Iter.Value();
 
         if ( HoudiniGeoPartObject.IsInstancer() )
         {
-            FoundInstancers.Add( HoudiniGeoPartObject );
+            PostCookStateRef.Instancers.Add( HoudiniGeoPartObject );
         }
         else if ( HoudiniGeoPartObject.IsPackedPrimitiveInstancer() )
         {
             // Packed Primitives should be processed before other instancer in case they are instanced by the same
-            FoundInstancers.Insert( HoudiniGeoPartObject, 0 );
+            PostCookStateRef.Instancers.Insert( HoudiniGeoPartObject, 0 );
         }
         else if ( HoudiniGeoPartObject.IsCurve() )
         {
             // This geo part is a curve and has no mesh assigned.
             check( !StaticMesh );
-            FoundCurves.Add( HoudiniGeoPartObject );
+            PostCookStateRef.Curves.Add( HoudiniGeoPartObject );
         }
         else if ( HoudiniGeoPartObject.IsVolume() )
         {
-            FoundVolumes.Add( HoudiniGeoPartObject );
+            PostCookStateRef.Volumes.Add( HoudiniGeoPartObject );
         }
         else
         {
-            // This geo part is visible and not an instancer and must have static mesh assigned.
-            if ( HoudiniGeoPartObject.IsVisible() && ( !StaticMesh || StaticMesh->IsPendingKill() ) )
-            {
-                HOUDINI_LOG_WARNING( TEXT( "No static mesh generated for visible part %d,%d,%d" ), HoudiniGeoPartObject.AssetId, HoudiniGeoPartObject.ObjectId, HoudiniGeoPartObject.PartId );
-                continue;
-            }
+            PostCookStateRef.MeshParts.Add( HoudiniGeoPartObject );
+        }
+    }
+}
 
-            UStaticMeshComponent * StaticMeshComponent = nullptr;
-            UStaticMeshComponent * FoundStaticMeshComponent = LocateStaticMeshComponent( StaticMesh );
+void
+UHoudiniAssetComponent::CreateObjectGeoPartComponent(
+    const FHoudiniGeoPartObject & HoudiniGeoPartObject, UStaticMesh * StaticMesh, FHoudiniPostCookState & PostCookStateRef )
+{
+    // This geo part is visible and not an instancer and must have static mesh assigned.
+    if ( HoudiniGeoPartObject.IsVisible() && ( !StaticMesh || StaticMesh->IsPendingKill() ) )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "No static mesh generated for visible part %d,%d,%d" ), HoudiniGeoPartObject.AssetId, HoudiniGeoPartObject.ObjectId, HoudiniGeoPartObject.PartId );
+        return;
+    }
 
-            if ( FoundStaticMeshComponent && !FoundStaticMeshComponent->IsPendingKill() )
-            {
-                StaticMeshComponent = FoundStaticMeshComponent;
-                if ( ! HoudiniGeoPartObject.IsVisible() )
-                {
-                    // We have a mesh and component for a part which is invisible.
-                    // Visibility may have changed since last cook
-                    StaleParts.Add( HoudiniGeoPartObject, StaticMesh );
-                    continue;
-                }
-            }
-            else if ( HoudiniGeoPartObject.IsVisible() )
-            {
-                // Create necessary component.
-                StaticMeshComponent = NewObject< UStaticMeshComponent >(
-                    GetOwner() ? GetOwner() : GetOuter(), UStaticMeshComponent::StaticClass(),
-                    NAME_None, RF_Transactional );
+    UStaticMeshComponent * StaticMeshComponent = nullptr;
+    UStaticMeshComponent * FoundStaticMeshComponent = LocateStaticMeshComponent( StaticMesh );
 
-                if ( StaticMeshComponent && !StaticMeshComponent->IsPendingKill() )
-                {
-                    // Attach created static mesh component to our Houdini component.
-                    StaticMeshComponent->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
+    if ( FoundStaticMeshComponent && !FoundStaticMeshComponent->IsPendingKill() )
+    {
+        StaticMeshComponent = FoundStaticMeshComponent;
+        if ( ! HoudiniGeoPartObject.IsVisible() )
+        {
+            // We have a mesh and component for a part which is invisible.
+            // Visibility may have changed since last cook
+            PostCookStateRef.StaleParts.Add( HoudiniGeoPartObject, StaticMesh );
+            return;
+        }
+    }
+    else if ( HoudiniGeoPartObject.IsVisible() )
+    {
+        // Create necessary component.
+        StaticMeshComponent = NewObject< UStaticMeshComponent >(
+            GetOwner() ? GetOwner() : GetOuter(), UStaticMeshComponent::StaticClass(),
+            NAME_None, RF_Transactional );
 
-                    StaticMeshComponent->SetStaticMesh(StaticMesh);
-                    StaticMeshComponent->SetVisibility(true);
-                    StaticMeshComponent->SetMobility(Mobility);
-                    StaticMeshComponent->RegisterComponent();
+        if ( StaticMeshComponent && !StaticMeshComponent->IsPendingKill() )
+        {
+            // Attach created static mesh component to our Houdini component.
+            StaticMeshComponent->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
 
-                    // Add to the map of components.
-                    StaticMeshComponents.Add(StaticMesh, StaticMeshComponent);
-                }
-            }
+            StaticMeshComponent->SetStaticMesh(StaticMesh);
+            StaticMeshComponent->SetVisibility(true);
+            StaticMeshComponent->SetMobility(Mobility);
 
-            if ( StaticMeshComponent && !StaticMeshComponent->IsPendingKill())
-            {
-                // If this is a collision geo, we need to make it invisible.
-                if (HoudiniGeoPartObject.IsCollidable())
-                {
-                    StaticMeshComponent->SetVisibility( false );
-                    StaticMeshComponent->SetHiddenInGame( true );
-                    StaticMeshComponent->SetCollisionProfileName( FName( TEXT( "InvisibleWall" ) ) );
-                }
-                else
-                {
-                    // Visibility may have changed so we still need to update it
-                    StaticMeshComponent->SetVisibility( HoudiniGeoPartObject.IsVisible() );
-                    StaticMeshComponent->SetHiddenInGame( !HoudiniGeoPartObject.IsVisible() );
-                }
+            // Registration is deferred until the component is fully set up,
+            // so its render and physics states are only created once.
+            PostCookStateRef.PendingRegistrations.Add(StaticMeshComponent);
+
+            // Add to the map of components.
+            StaticMeshComponents.Add(StaticMesh, StaticMeshComponent);
+        }
+    }
 
-                // And we will need to update the navmesh later
-                if( HoudiniGeoPartObject.IsCollidable() || HoudiniGeoPartObject.IsRenderCollidable() )
-                    bNeedToUpdateNavigationSystem = true;
+    if ( StaticMeshComponent && !StaticMeshComponent->IsPendingKill())
+    {
+        // If this is a collision geo, we need to make it invisible.
+        if (HoudiniGeoPartObject.IsCollidable())
+        {
+            StaticMeshComponent->SetVisibility( false );
+            StaticMeshComponent->SetHiddenInGame( true );
+            StaticMeshComponent->SetCollisionProfileName( FName( TEXT( "InvisibleWall" ) ) );
+        }
+        else
+        {
+            // Visibility may have changed so we still need to update it
+            StaticMeshComponent->SetVisibility( HoudiniGeoPartObject.IsVisible() );
+            StaticMeshComponent->SetHiddenInGame( !HoudiniGeoPartObject.IsVisible() );
+        }
 
-                // Transform the component by transformation provided by HAPI.
-                StaticMeshComponent->SetRelativeTransform( HoudiniGeoPartObject.TransformMatrix );
+        // And we will need to update the navmesh later
+        if( HoudiniGeoPartObject.IsCollidable() || HoudiniGeoPartObject.IsRenderCollidable() )
+            bNeedToUpdateNavigationSystem = true;
 
-                // If the static mesh had sockets, we can assign the desired actor to them now
-                int32 NumberOfSockets = StaticMesh == nullptr ? 0 : StaticMesh->Sockets.Num();
-                for( int32 nSocket = 0; nSocket < NumberOfSockets; nSocket++ )
-                {
-                    UStaticMeshSocket* MeshSocket = StaticMesh->Sockets[ nSocket ];
-                    if ( MeshSocket && !MeshSocket->IsPendingKill() && ( MeshSocket->Tag.IsEmpty() ) )
-                        continue;
+        // Transform the component by transformation provided by HAPI.
+        StaticMeshComponent->SetRelativeTransform( HoudiniGeoPartObject.TransformMatrix );
 
-                    FHoudiniEngineUtils::AddActorsToMeshSocket( StaticMesh->Sockets[ nSocket ], StaticMeshComponent );
-                }
+        // If the static mesh had sockets, we can assign the desired actor to them now
+        int32 NumberOfSockets = StaticMesh == nullptr ? 0 : StaticMesh->Sockets.Num();
+        for( int32 nSocket = 0; nSocket < NumberOfSockets; nSocket++ )
+        {
+            UStaticMeshSocket* MeshSocket = StaticMesh->Sockets[ nSocket ];
+            if ( MeshSocket && !MeshSocket->IsPendingKill() && ( MeshSocket->Tag.IsEmpty() ) )
+                continue;
 
-                // Try to update uproperty atributes
-                // No need to update uprops if we've not yet been instanced
-                if ( bFullyLoaded )
-                    FHoudiniEngineUtils::UpdateUPropertyAttributesOnObject( StaticMeshComponent, HoudiniGeoPartObject );
+#if WITH_EDITOR
+            // The world's actors are indexed once, for all the sockets of this cook.
+            if ( !PostCookStateRef.bSocketActorsIndexed && MeshSocket && MeshSocket->Tag.Contains( TEXT( "|" ) ) )
+            {
+                FHoudiniEngineUtils::BuildActorNameIndex( GetWorld(), PostCookStateRef.SocketActorsByName );
+                PostCookStateRef.bSocketActorsIndexed = true;
             }
+#endif
+
+            FHoudiniEngineUtils::AddActorsToMeshSocket(
+                StaticMesh->Sockets[ nSocket ], StaticMeshComponent,
+                PostCookStateRef.bSocketActorsIndexed ? &PostCookStateRef.SocketActorsByName : nullptr );
         }
+
+        // Try to update uproperty atributes
+        // No need to update uprops if we've not yet been instanced
+        if ( bFullyLoaded )
+            FHoudiniEngineUtils::UpdateUPropertyAttributesOnObject( StaticMeshComponent, HoudiniGeoPartObject );
     }
+}
 
-    if ( StaleParts.Num() )
+void
+UHoudiniAssetComponent::EndObjectGeoPartComponents(
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshMap, FHoudiniPostCookState & PostCookStateRef )
+{
+    if ( PostCookStateRef.StaleParts.Num() )
     {
-        for ( auto Iter : StaleParts )
+        for ( auto Iter : PostCookStateRef.StaleParts )
         {
             StaticMeshMap.Remove( Iter.Key );
         }
-        ReleaseObjectGeoPartResources( StaleParts, true );
+        ReleaseObjectGeoPartResources( PostCookStateRef.StaleParts, true );
     }
 
+    RegisterPendingComponents( PostCookStateRef );
+
     // Skip self assignment.
     if ( &StaticMeshes != &StaticMeshMap )
         StaticMeshes = StaticMeshMap;
+}
 
-#if WITH_EDITOR
-    if ( FHoudiniEngineUtils::IsHoudiniNodeValid( AssetId ) )
+void
+UHoudiniAssetComponent::RegisterPendingComponents( FHoudiniPostCookState & PostCookStateRef )
+{
+    for ( UStaticMeshComponent * StaticMeshComponent : PostCookStateRef.PendingRegistrations )
     {
-        // Create necessary instance inputs.
-        CreateInstanceInputs( FoundInstancers );
+        if ( !StaticMeshComponent || StaticMeshComponent->IsPendingKill() || StaticMeshComponent->IsRegistered() )
+            continue;
 
-        // Create necessary curves.
-        CreateCurves( FoundCurves );
+        StaticMeshComponent->RegisterComponent();
 
-        // Create necessary landscapes
-        CreateAllLandscapes( FoundVolumes );
+        // The component was registered with its final mesh and transform,
+        // its physics state does not need to be recreated at the end of the post cook.
+        if ( bRenderStateCaptured )
+        {
+            CapturedRenderStateHashes.Add( StaticMeshComponent, HoudiniEngineComputeRenderStateHash( StaticMeshComponent ) );
+            ChangedStaticMeshes.Remove( StaticMeshComponent->GetStaticMesh() );
+        }
     }
-#endif
 
+    PostCookStateRef.PendingRegistrations.Empty();
+}
+
+void
+UHoudiniAssetComponent::FinishObjectGeoPartResources()
+{
     CleanUpAttachedStaticMeshComponents();
 
     // Now that all the Meshes/Landscapes are created, see if we need to create material instances from attributes
@@ -924,9 +1205,6 @@ UHoudiniAssetComponent::ReleaseObjectGeoPartResources(
     TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshMap,
     bool bDeletePackages )
 {
-    // Record generated static meshes which we need to delete.
-    TArray< UStaticMesh * > StaticMeshesToDelete;
-
     // Get Houdini logo.
     UStaticMesh * HoudiniLogoMesh = FHoudiniEngine::Get().GetHoudiniLogoStaticMesh().Get();
 
@@ -939,58 +1217,23 @@ UHoudiniAssetComponent::ReleaseObjectGeoPartResources(
         // Removes the static mesh component from the map, detaches and destroys it.
         RemoveStaticMeshComponent( StaticMesh );
 
-        if ( bDeletePackages && ( StaticMesh != HoudiniLogoMesh ) )
-        {
-            // Make sure this static mesh is not referenced.
-            UObject * ObjectMesh = (UObject *) StaticMesh;
-            FReferencerInformationList Referencers;
-
-            // Check if object is referenced and get its referencers, if it is.
-            bool bReferenced = IsReferenced(
-                ObjectMesh, GARBAGE_COLLECTION_KEEPFLAGS,
-                EInternalObjectFlags::GarbageCollectionKeepFlags, true, &Referencers );
-
-            if ( !bReferenced || IsObjectReferencedLocally( StaticMesh, Referencers ) )
-            {
-                // Only delete generated mesh if it has not been saved manually.
-                UPackage * Package = Cast< UPackage >( StaticMesh->GetOuter() );
-                if ( !Package || !Package->bHasBeenFullyLoaded )
-                    StaticMeshesToDelete.Add(StaticMesh);
-            }
-        }
+#if WITH_EDITOR
+        // Meshes kept by a preset snapshot are restored when switching back to its preset.
+        // The no longer used generated meshes are released in a batch once cooking is done.
+        if ( bDeletePackages && ( StaticMesh != HoudiniLogoMesh ) && !IsStaticMeshInPresetSnapshots( StaticMesh ) )
+            FHoudiniEngine::Get().GetTempPackageCleanup().AddStaticMesh( StaticMesh );
+#endif
     }
     
     // CleanUpAttachedStaticMeshComponents();
 
     // Remove unused meshes.
     StaticMeshMap.Empty();
-
-#if WITH_EDITOR    // Delete no longer used generated static meshes.
-    int32 MeshNum = StaticMeshesToDelete.Num();
-
-    if ( bDeletePackages && MeshNum > 0 )
-    {
-        for ( int32 MeshIdx = 0; MeshIdx < MeshNum; ++MeshIdx )
-        {
-            UStaticMesh * StaticMesh = StaticMeshesToDelete[ MeshIdx ];
-
-            // Free any RHI resources.
-            StaticMesh->PreEditChange( nullptr );
-            StaticMesh->MarkPendingKill();
-
-            ObjectTools::DeleteSingleObject( StaticMesh, false );
-        }
-    }
-
-#endif
 }
 
 void
 UHoudiniAssetComponent::CleanUpAttachedStaticMeshComponents()
 {
-    // Record generated static meshes which we need to delete.
-    TArray< UStaticMesh * > StaticMeshesToDelete;
-
     // Collect all the static mesh component for this asset
     TMap<const UStaticMeshComponent *, FHoudiniGeoPartObject> AllSMC = CollectAllStaticMeshComponents();
     
@@ -1020,77 +1263,31 @@ UHoudiniAssetComponent::CleanUpAttachedStaticMeshComponents()
             StaticMeshComponent->UnregisterComponent();
             StaticMeshComponent->DestroyComponent();
 
-            StaticMeshesToDelete.Add( StaticMesh );
+#if WITH_EDITOR
+            // We'll try to delete the undesirable static mesh too.
+            FHoudiniEngine::Get().GetTempPackageCleanup().AddStaticMesh( StaticMesh );
+#endif
 
             //HOUDINI_LOG_WARNING( TEXT("CLEANUP: Deleted extra Static Mesh Component for %s"), *(StaticMesh->GetName()) );
         }
     }
+}
 
-#if WITH_EDITOR
-    // We'll try to delete the undesirable static meshes too
-    for (int32 MeshIdx = 0; MeshIdx < StaticMeshesToDelete.Num(); ++MeshIdx)
+void
+UHoudiniAssetComponent::CollectSubstanceParameters( TMap< FString, UHoudiniAssetParameter * > & SubstanceParameters ) const
+{
+    SubstanceParameters.Empty();
+
+    for ( TMap< HAPI_ParmId, UHoudiniAssetParameter * >::TConstIterator IterParams( Parameters ); IterParams; ++IterParams )
     {
-        UStaticMesh * StaticMesh = StaticMeshesToDelete[MeshIdx];
-        if ( !StaticMesh || StaticMesh->IsPendingKill() )
-            continue;
-                
-        UObject * ObjectMesh = (UObject *)StaticMesh;
-        if ( ObjectMesh->IsUnreachable() )
+        UHoudiniAssetParameter * HoudiniAssetParameter = IterParams.Value();
+        if  (!HoudiniAssetParameter || HoudiniAssetParameter->IsPendingKill() )
             continue;
 
-        // Check if object is referenced and get its referencers, if it is.
-        FReferencerInformationList Referencers; 
-        bool bReferenced = IsReferenced(
-            ObjectMesh, GARBAGE_COLLECTION_KEEPFLAGS,
-            EInternalObjectFlags::GarbageCollectionKeepFlags, true, &Referencers);
-
-        if ( !bReferenced || IsObjectReferencedLocally( StaticMesh, Referencers ) )
-        {
-            // Only delete generated mesh if it has not been saved manually.
-            UPackage * Package = Cast< UPackage >( StaticMesh->GetOuter() );
-            if ( !Package || !Package->bHasBeenFullyLoaded )
-            {
-                StaticMesh->PreEditChange( nullptr );
-                ObjectTools::DeleteSingleObject( StaticMesh, false );
-            }
-        }
-    }
-#endif
-}
-
-bool
-UHoudiniAssetComponent::IsObjectReferencedLocally(
-    UStaticMesh * StaticMesh,
-    FReferencerInformationList & Referencers ) const
-{
-    if ( Referencers.InternalReferences.Num() == 0 && Referencers.ExternalReferences.Num() == 1 )
-    {
-        const FReferencerInformation & ExternalReferencer = Referencers.ExternalReferences[ 0 ];
-        if ( ExternalReferencer.Referencer == this )
-        {
-            // Only referencer is this component.
-            return true;
-        }
-    }
-
-    return false;
-}
-
-void
-UHoudiniAssetComponent::CollectSubstanceParameters( TMap< FString, UHoudiniAssetParameter * > & SubstanceParameters ) const
-{
-    SubstanceParameters.Empty();
-
-    for ( TMap< HAPI_ParmId, UHoudiniAssetParameter * >::TConstIterator IterParams( Parameters ); IterParams; ++IterParams )
-    {
-        UHoudiniAssetParameter * HoudiniAssetParameter = IterParams.Value();
-        if  (!HoudiniAssetParameter || HoudiniAssetParameter->IsPendingKill() )
-            continue;
-
-        if ( HoudiniAssetParameter->IsSubstanceParameter() )
-            SubstanceParameters.Add( HoudiniAssetParameter->GetParameterName(), HoudiniAssetParameter );
-    }
-}
+        if ( HoudiniAssetParameter->IsSubstanceParameter() )
+            SubstanceParameters.Add( HoudiniAssetParameter->GetParameterName(), HoudiniAssetParameter );
+    }
+}
 
 void
 UHoudiniAssetComponent::CollectAllParametersOfType(
@@ -1111,8 +1308,20 @@ UHoudiniAssetComponent::CollectAllParametersOfType(
 }
 
 UHoudiniAssetParameter *
-UHoudiniAssetComponent::FindParameter( const FString & ParameterName ) const
+UHoudiniAssetComponent::FindParameter( const FString & ParameterName )
 {
+#if WITH_EDITOR
+
+    // Parameters of inactive tabs are created on first access, and kept from then on.
+    if ( DeferredParameters.Contains( ParameterName ) && FHoudiniEngineUtils::IsValidNodeId( AssetId ) )
+    {
+        FHoudiniScopedSession ScopedSession( SessionIndex );
+        ForcedParameterNames.Add( ParameterName );
+        CreateParameters();
+    }
+
+#endif
+
     UHoudiniAssetParameter * const * FoundHoudiniAssetParameter = ParameterByName.Find( ParameterName );
     UHoudiniAssetParameter * HoudiniAssetParameter = nullptr;
 
@@ -1287,6 +1496,12 @@ UHoudiniAssetComponent::IsInstantiatingOrCooking() const
     return HapiGUID.IsValid();
 }
 
+const FGuid &
+UHoudiniAssetComponent::GetHapiGUID() const
+{
+    return HapiGUID;
+}
+
 bool
 UHoudiniAssetComponent::HasBeenInstantiatedButNotCooked() const
 {
@@ -1311,25 +1526,18 @@ UHoudiniAssetComponent::AssignUniqueActorLabel()
 void
 UHoudiniAssetComponent::StartHoudiniUIUpdateTicking()
 {
-    // If we have no timer delegate spawned for ui update, spawn one.
-    if ( !TimerDelegateUIUpdate.IsBound() && GEditor )
-    {
-        TimerDelegateUIUpdate = FTimerDelegate::CreateUObject( this, &UHoudiniAssetComponent::TickHoudiniUIUpdate );
-
-        // We need to register delegate with the timer system.
-        static const float TickTimerDelay = 0.25f;
-        GEditor->GetTimerManager()->SetTimer( TimerHandleUIUpdate, TimerDelegateUIUpdate, TickTimerDelay, true );
-    }
+    // Register with the engine's dispatcher, it will tick our ui update.
+    FHoudiniEngineCookDispatcher & CookDispatcher = FHoudiniEngine::Get().GetCookDispatcher();
+    if ( !CookDispatcher.IsUIUpdateRegistered( this ) && GEditor )
+        CookDispatcher.RegisterUIUpdate( this );
 }
 
 void
 UHoudiniAssetComponent::StopHoudiniUIUpdateTicking()
 {
-    if ( TimerDelegateUIUpdate.IsBound() && GEditor )
-    {
-        GEditor->GetTimerManager()->ClearTimer( TimerHandleUIUpdate );
-        TimerDelegateUIUpdate.Unbind();
-    }
+    FHoudiniEngineCookDispatcher & CookDispatcher = FHoudiniEngine::Get().GetCookDispatcher();
+    if ( CookDispatcher.IsUIUpdateRegistered( this ) )
+        CookDispatcher.UnregisterUIUpdate( this );
 }
 
 void
@@ -1341,14 +1549,14 @@ UHoudiniAssetComponent::TickHoudiniUIUpdate()
 void
 UHoudiniAssetComponent::StartHoudiniTicking()
 {
-    // If we have no timer delegate spawned for this component, spawn one.
-    if ( !TimerDelegateCooking.IsBound() && GEditor )
-    {
-        TimerDelegateCooking = FTimerDelegate::CreateUObject( this, &UHoudiniAssetComponent::TickHoudiniComponent );
+    if ( IsStaticPIEContainer() )
+        return;
 
-        // We need to register delegate with the timer system.
-        static const float TickTimerDelay = 0.25f;
-        GEditor->GetTimerManager()->SetTimer( TimerHandleCooking, TimerDelegateCooking, TickTimerDelay, true );
+    // Register with the engine's dispatcher, it ticks us when our task info is updated.
+    FHoudiniEngineCookDispatcher & CookDispatcher = FHoudiniEngine::Get().GetCookDispatcher();
+    if ( !CookDispatcher.IsComponentRegistered( this ) && GEditor )
+    {
+        CookDispatcher.RegisterComponent( this );
 
         // Grab current time for delayed notification.
         HapiNotificationStarted = FPlatformTime::Seconds();
@@ -1358,47 +1566,230 @@ UHoudiniAssetComponent::StartHoudiniTicking()
 void
 UHoudiniAssetComponent::StopHoudiniTicking()
 {
-    if ( TimerDelegateCooking.IsBound() && GEditor )
+    FHoudiniEngineCookDispatcher & CookDispatcher = FHoudiniEngine::Get().GetCookDispatcher();
+    if ( CookDispatcher.IsComponentRegistered( this ) )
     {
-        GEditor->GetTimerManager()->ClearTimer( TimerHandleCooking );
-        TimerDelegateCooking.Unbind();
+        CookDispatcher.UnregisterComponent( this );
 
         // Reset time for delayed notification.
         HapiNotificationStarted = 0.0;
     }
 }
 
-void
+bool
 UHoudiniAssetComponent::PostCook( bool bCookError )
 {
+    SCOPE_CYCLE_COUNTER( STAT_PostCook );
+
+    // The time spent in each stage is recorded in the profile of this cook.
+    FHoudiniScopedCookProfile ScopedCookProfile( CookProfile );
+
     // Show busy cursor.
     FScopedBusyCursor ScopedBusyCursor;
 
-    // Create parameters and inputs.
-    CreateParameters();
-    CreateInputs();
-    CreateHandles();
+    // Strings resolved while processing this part of the cook results are only requested once.
+    FHoudiniScopedStringCache ScopedStringCache;
+
+    // Parts share their raw data buffers until this part of the cook results is processed.
+    FHoudiniScopedPartScratchBuffers ScopedPartScratchBuffers;
 
-    if ( bCookError )
+    if ( PostCookState.Stage == EHoudiniPostCookStage::None )
     {
-        // We need to reset the manual recook flag here to avoid endless cooking
-        bManualRecookRequested = false;
-        return;
+        PostCookState.Reset();
+        PostCookState.Stage = EHoudiniPostCookStage::Parameters;
+
+        // Our outputs are about to change, they are published again once done.
+        SharedCookOutputsKey = 0;
+
+        // Only the components modified by this post cook will need their render and physics state updated.
+        CaptureRenderState();
+    }
+
+    // Stages are executed until we run out of our per frame budget, a budget of 0 disables time slicing.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    const double TimeBudget = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->PostCookTimeBudget / 1000.0 : 0.0;
+    const double StartTime = FPlatformTime::Seconds();
+    auto IsOverBudget = [&]()
+    {
+        return TimeBudget > 0.0 && ( FPlatformTime::Seconds() - StartTime ) >= TimeBudget;
+    };
+
+    while ( PostCookState.Stage != EHoudiniPostCookStage::None )
+    {
+        switch ( PostCookState.Stage )
+        {
+            case EHoudiniPostCookStage::Parameters:
+            {
+                // Create parameters and inputs.
+                CreateParameters();
+                CreateInputs();
+                CreateHandles();
+
+                if ( bCookError )
+                {
+                    // We need to reset the manual recook flag here to avoid endless cooking
+                    bManualRecookRequested = false;
+                    PostCookState.Reset();
+                    return true;
+                }
+
+                PostCookState.Stage = EHoudiniPostCookStage::StaticMeshes;
+
+                // Intermediate assets of a chain only cook in Houdini, downstream assets read their nodes directly.
+                if ( bPassThroughOnly )
+                {
+                    ReleasePassThroughOutputs();
+                    PostCookState.bOutputChanged = true;
+                    PostCookState.Stage = EHoudiniPostCookStage::Downstream;
+                    break;
+                }
+
+                // Let a frame show the preview of the cooked geometry before creating the outputs.
+                if ( UpdateCookPreview() )
+                    return false;
+
+                break;
+            }
+
+            case EHoudiniPostCookStage::StaticMeshes:
+            {
+                PostCookStaticMeshes();
+                break;
+            }
+
+            case EHoudiniPostCookStage::Components:
+            {
+                // Create one component at a time, so that large assets stream into the scene.
+                while ( PostCookState.NextMeshPart < PostCookState.MeshParts.Num() )
+                {
+                    const FHoudiniGeoPartObject & HoudiniGeoPartObject = PostCookState.MeshParts[ PostCookState.NextMeshPart++ ];
+                    CreateObjectGeoPartComponent(
+                        HoudiniGeoPartObject, PostCookState.NewStaticMeshes.FindRef( HoudiniGeoPartObject ), PostCookState );
+
+                    if ( IsOverBudget() )
+                    {
+                        // The components created this frame are registered together.
+                        RegisterPendingComponents( PostCookState );
+                        return false;
+                    }
+                }
+
+                EndObjectGeoPartComponents( PostCookState.NewStaticMeshes, PostCookState );
+                PostCookState.Stage = EHoudiniPostCookStage::Instancers;
+                break;
+            }
+
+            case EHoudiniPostCookStage::Instancers:
+            {
+                // Create necessary instance inputs.
+                if ( FHoudiniEngineUtils::IsHoudiniNodeValid( AssetId ) )
+                    CreateInstanceInputs( PostCookState.Instancers );
+
+                PostCookState.Stage = EHoudiniPostCookStage::Curves;
+                break;
+            }
+
+            case EHoudiniPostCookStage::Curves:
+            {
+                // Create necessary curves.
+                if ( FHoudiniEngineUtils::IsHoudiniNodeValid( AssetId ) )
+                    CreateCurves( PostCookState.Curves );
+
+                PostCookState.Stage = EHoudiniPostCookStage::Landscapes;
+                break;
+            }
+
+            case EHoudiniPostCookStage::Landscapes:
+            {
+                // Create necessary landscapes
+                if ( FHoudiniEngineUtils::IsHoudiniNodeValid( AssetId ) )
+                    CreateAllLandscapes( PostCookState.Volumes );
+
+                PostCookState.Stage = EHoudiniPostCookStage::Materials;
+                break;
+            }
+
+            case EHoudiniPostCookStage::Materials:
+            {
+                FinishObjectGeoPartResources();
+                PostCookState.Stage = EHoudiniPostCookStage::Downstream;
+                break;
+            }
+
+            case EHoudiniPostCookStage::Downstream:
+            default:
+            {
+                // We can reset the manual recook flag now that the static meshes have been created
+                bManualRecookRequested = false;
+
+                // Invoke cooks of downstream assets.
+                if ( bCookingTriggersDownstreamCooks && PostCookState.bOutputChanged )
+                {
+                    for ( TMap<UHoudiniAssetComponent *, TSet< int32 > >::TIterator IterAssets( DownstreamAssetConnections );
+                        IterAssets;
+                        ++IterAssets )
+                    {
+                        UHoudiniAssetComponent * DownstreamAsset = IterAssets.Key();
+                        if ( !DownstreamAsset || DownstreamAsset->IsPendingKill() )
+                            continue;
+
+                        DownstreamAsset->bManualRecookRequested = true;
+                        DownstreamAsset->NotifyParameterChanged( nullptr );
+                    }
+                }
+
+                ClearCookPreview();
+                CheckOutputMemoryUsage();
+                PublishSharedCookOutputs();
+                PostCookState.Reset();
+                return true;
+            }
+        }
+
+        if ( IsOverBudget() )
+            return false;
     }
 
+    return true;
+}
+
+void
+UHoudiniAssetComponent::PostCookStaticMeshes()
+{
     FTransform ComponentTransform;
-    TMap< FHoudiniGeoPartObject, UStaticMesh * > NewStaticMeshes;
-    
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > & NewStaticMeshes = PostCookState.NewStaticMeshes;
+
+    // Downstream assets only need to recook if our output has changed.
+    PostCookState.bOutputChanged = bManualRecookRequested;
+
+    // Unless we have to create components, we are done after this stage.
+    PostCookState.Stage = EHoudiniPostCookStage::Downstream;
+
     FHoudiniCookParams HoudiniCookParams( this );
     HoudiniCookParams.StaticMeshBakeMode = FHoudiniCookParams::GetDefaultStaticMeshesCookMode();
     HoudiniCookParams.MaterialAndTextureBakeMode = FHoudiniCookParams::GetDefaultMaterialAndTextureCookMode();
 
+    // Meshes shared with a copied component cannot be rebuilt in place, this cook creates our own instead.
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > UnsharedStaticMeshes;
+    const TMap< FHoudiniGeoPartObject, UStaticMesh * > * ReusableStaticMeshes = &StaticMeshes;
+    if ( SharedStaticMeshes.Num() > 0 )
+    {
+        for ( const TPair< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshPair : StaticMeshes )
+        {
+            if ( !SharedStaticMeshes.Contains( StaticMeshPair.Value ) )
+                UnsharedStaticMeshes.Add( StaticMeshPair.Key, StaticMeshPair.Value );
+        }
+
+        SharedStaticMeshes.Empty();
+        ReusableStaticMeshes = &UnsharedStaticMeshes;
+    }
+
     if ( FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
         GetAssetId(),
         HoudiniCookParams,
         !CheckGlobalSettingScaleFactors(),
         bManualRecookRequested,
-        StaticMeshes, 
+        *ReusableStaticMeshes,
         NewStaticMeshes, 
         ComponentTransform ) )
     {
@@ -1409,6 +1800,12 @@ UHoudiniAssetComponent::PostCook( bool bCookError )
             const FHoudiniGeoPartObject HoudiniGeoPartObject = Iter.Key();
             UStaticMesh * StaticMesh = Iter.Value();
 
+            if ( HoudiniGeoPartObject.HasGeoChanged() )
+            {
+                PostCookState.bOutputChanged = true;
+                ChangedStaticMeshes.Add( StaticMesh );
+            }
+
             // Removes the mesh from previous map of meshes
             UStaticMesh * FoundOldStaticMesh = LocateStaticMesh( HoudiniGeoPartObject );
             if ( ( FoundOldStaticMesh ) && ( FoundOldStaticMesh == StaticMesh ) )
@@ -1421,6 +1818,10 @@ UHoudiniAssetComponent::PostCook( bool bCookError )
             FHoudiniEngineUtils::UpdateUPropertyAttributesOnObject( this, HoudiniGeoPartObject );
         }
 
+        // Parts that were removed, or an asset without any part, count as a change.
+        if ( StaticMeshes.Num() > 0 || NewStaticMeshes.Num() == 0 )
+            PostCookState.bOutputChanged = true;
+
         // Make sure rendering is done
         FlushRenderingCommands();
 
@@ -1440,36 +1841,84 @@ UHoudiniAssetComponent::PostCook( bool bCookError )
             ReleaseObjectGeoPartResources(StaticMeshes, true);
 
             // Set meshes and create new components for those meshes that do not have them.
-            if (NewStaticMeshes.Num() > 0)
-                CreateObjectGeoPartResources(NewStaticMeshes);
+            if ( NewStaticMeshes.Num() > 0 )
+            {
+                BeginObjectGeoPartResources( NewStaticMeshes, PostCookState );
+                PostCookState.Stage = EHoudiniPostCookStage::Components;
+            }
             else
-                CreateStaticMeshHoudiniLogoResource(NewStaticMeshes);
+            {
+                CreateStaticMeshHoudiniLogoResource( NewStaticMeshes );
+            }
         }
     }
+    else
+    {
+        PostCookState.bOutputChanged = true;
+    }
+}
 
-    // We can reset the manual recook flag now that the static meshes have been created
-    bManualRecookRequested = false;
+bool
+UHoudiniAssetComponent::UpdateCookPreview()
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( !HoudiniRuntimeSettings || !HoudiniRuntimeSettings->bShowCookPreview )
+        return false;
 
-    // Invoke cooks of downstream assets.
-    if ( bCookingTriggersDownstreamCooks )
+    if ( !FHoudiniEngineUtils::HapiGetCookPreviewPoints(
+        AssetId, HoudiniRuntimeSettings->CookPreviewMaxPoints, CookPreviewPoints, CookPreviewBounds ) || !CookPreviewBounds.IsValid )
     {
-        for ( TMap<UHoudiniAssetComponent *, TSet< int32 > >::TIterator IterAssets( DownstreamAssetConnections );
-            IterAssets;
-            ++IterAssets )
-        {
-            UHoudiniAssetComponent * DownstreamAsset = IterAssets.Key();
-            if ( !DownstreamAsset || DownstreamAsset->IsPendingKill() )
-                continue;
-
-            DownstreamAsset->bManualRecookRequested = true;
-            DownstreamAsset->NotifyParameterChanged( nullptr );
-        }
+        ClearCookPreview();
+        return false;
     }
+
+    // The preview is drawn by our scene proxy, which is recreated with the new points.
+    UpdateBounds();
+    MarkRenderStateDirty();
+
+    return true;
+}
+
+void
+UHoudiniAssetComponent::ClearCookPreview()
+{
+    if ( CookPreviewPoints.Num() <= 0 && !CookPreviewBounds.IsValid )
+        return;
+
+    CookPreviewPoints.Empty();
+    CookPreviewBounds.Init();
+
+    UpdateBounds();
+    MarkRenderStateDirty();
+}
+
+bool
+UHoudiniAssetComponent::IsPostCookInProgress() const
+{
+    return PostCookState.Stage != EHoudiniPostCookStage::None;
 }
 
 void
 UHoudiniAssetComponent::TickHoudiniComponent()
 {
+    // Requests wait until the session has been started by the scheduler.
+    if ( FHoudiniEngine::Get().IsSessionStarting() )
+        return;
+
+    if ( bInstantiateWhenSessionStarted )
+    {
+        bInstantiateWhenSessionStarted = false;
+        if ( FHoudiniEngine::IsInitialized() )
+            StartTaskAssetInstantiation( bInstantiateWhenSessionStartedAsLoaded, false );
+    }
+
+    // Components recovering from a lost session are only restored once they are visible or selected.
+    if ( bRecoveringSession && bLoadedComponentRequiresInstantiation && !IsVisibleOrSelected() )
+        return;
+
+    // All HAPI calls made while ticking target the session owning our node.
+    FHoudiniScopedSession ScopedSession( SessionIndex );
+
     // Get settings.
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
 
@@ -1561,7 +2010,10 @@ UHoudiniAssetComponent::TickHoudiniComponent()
                         AssetCookCount = 0;
 
                         if ( TaskInfo.bLoadedComponent )
+                        {
                             bFinishedLoadedInstantiation = true;
+                            LoadProfile.EndPhase( EHoudiniLoadProfilePhase::Reinstantiation );
+                        }
 
                         FHoudiniEngine::Get().SetHapiState( HAPI_RESULT_SUCCESS );
                     }
@@ -1583,19 +2035,49 @@ UHoudiniAssetComponent::TickHoudiniComponent()
                         // Set new asset id.
                         SetAssetId( TaskInfo.AssetId );
 
-                        // Call post cook event.
-                        PostCook();
+                        // A new cook profile starts with the time the scheduler spent cooking.
+                        if ( !IsPostCookInProgress() )
+                        {
+                            CookProfile.Reset();
+                            CookProfile.StageSeconds[ EHoudiniCookProfileStage::HapiCook ] = TaskInfo.ElapsedSeconds;
+
+                            LastCookMetrics = FHoudiniCookMetrics();
+                            LastCookMetrics.QueueSeconds = TaskInfo.QueueSeconds;
+                            LastCookMetrics.CookSeconds = TaskInfo.ElapsedSeconds;
+                            LastCookMetrics.HapiCallCount = TaskInfo.HapiCallCount;
+                            LastCookMetrics.HapiMegabytes = TaskInfo.HapiBytes / ( 1024.0f * 1024.0f );
+                        }
+
+                        // Call post cook event, it is resumed on the next ticks if it is time sliced.
+                        const double PostCookStartTime = FPlatformTime::Seconds();
+                        const bool bPostCookFinished = PostCook();
+                        LastCookMetrics.PostCookSeconds += (float) ( FPlatformTime::Seconds() - PostCookStartTime );
+                        if ( !bPostCookFinished )
+                            break;
+
+                        HOUDINI_LOG_MESSAGE( TEXT( "    %s cook metrics: %s." ), *GetOwner()->GetName(), *LastCookMetrics.ToString() );
+
+                        // The first cook after a load completes its load profile.
+                        LoadProfile.EndPhase( EHoudiniLoadProfilePhase::Recook );
+                        LoadProfile.Finish();
 
                         // Need to update rendering information.
                         UpdateRenderingInformation();
 
+                        // Remember what we just cooked, in case the session is lost.
+                        if ( HoudiniRuntimeSettings && HoudiniRuntimeSettings->bAutomaticSessionRecovery )
+                            CacheRecoveryState();
+
 #if WITH_EDITOR
                         // Force editor to redraw viewports.
                         if ( GEditor )
                             GEditor->RedrawAllViewports();
 
                         // Update properties panel after instantiation.
-                        UpdateEditorProperties( true );
+                        {
+                            FHoudiniScopedCookProfile ScopedCookProfile( CookProfile );
+                            UpdateEditorProperties( true );
+                        }
 
                         // We may have toolshelf input presets to apply (may cause a recook)
                         if ( HoudiniToolInputPreset.Num() > 0 )
@@ -1612,7 +2094,9 @@ UHoudiniAssetComponent::TickHoudiniComponent()
                         TSharedPtr< SNotificationItem > NotificationItem = NotificationPtr.Pin();
                         if ( NotificationItem.IsValid() )
                         {
-                            NotificationItem->SetText( TaskInfo.StatusText );
+                            NotificationItem->SetText( FText::Format(
+                                LOCTEXT( "CookMetricsNotification", "{0}\n{1}" ),
+                                TaskInfo.StatusText, FText::FromString( LastCookMetrics.ToString() ) ) );
                             NotificationItem->ExpireAndFadeout();
 
                             NotificationPtr.Reset();
@@ -1632,6 +2116,9 @@ UHoudiniAssetComponent::TickHoudiniComponent()
                 {
                     HOUDINI_LOG_MESSAGE( TEXT( "    %s FinishedCookingWithErrors." ), *GetOwner()->GetName() );
 
+                    LoadProfile.EndPhase( EHoudiniLoadProfilePhase::Recook );
+                    LoadProfile.Finish();
+
                     if ( FHoudiniEngineUtils::IsValidNodeId( TaskInfo.AssetId ) )
                     {
                         // Call post cook event with error parameter. This will create parameters, inputs and handles.
@@ -1768,6 +2255,24 @@ UHoudiniAssetComponent::TickHoudiniComponent()
                             NotificationItem->SetText( TaskInfo.StatusText );
                     }
 
+                    // Parameters changed while cooking, the running cook is stale.
+                    if ( TaskInfo.TaskType == EHoudiniEngineTaskType::AssetCooking && bParametersChanged && IsCookingEnabled()
+                        && HoudiniRuntimeSettings && HoudiniRuntimeSettings->bInterruptStaleCooks )
+                    {
+                        FHoudiniEngine::Get().InterruptTask( HapiGUID );
+                    }
+
+                    break;
+                }
+
+                case EHoudiniEngineTaskState::Interrupted:
+                {
+                    HOUDINI_LOG_MESSAGE( TEXT( "    %s Cooking Interrupted." ), *GetOwner()->GetName() );
+
+                    // Our changed parameters will be uploaded and cooked below.
+                    FHoudiniEngine::Get().RemoveTaskInfo( HapiGUID );
+                    HapiGUID.Invalidate();
+
                     break;
                 }
 
@@ -1791,7 +2296,8 @@ UHoudiniAssetComponent::TickHoudiniComponent()
 
     if ( !IsInstantiatingOrCooking() )
     {
-        if ( HasBeenInstantiatedButNotCooked() || bParametersChanged || bComponentNeedsCook || bManualRecookRequested )
+        if ( HasBeenInstantiatedButNotCooked() || bParametersChanged || bComponentNeedsCook || bManualRecookRequested
+            || bRecoveringSession )
         {
             // Grab current time for delayed notification.
             HapiNotificationStarted = FPlatformTime::Seconds();
@@ -1812,10 +2318,13 @@ UHoudiniAssetComponent::TickHoudiniComponent()
             {
                 // This component has been loaded and requires instantiation.
                 bLoadedComponentRequiresInstantiation = false;
+                LoadProfile.BeginPhase( EHoudiniLoadProfilePhase::Reinstantiation );
                 StartTaskAssetInstantiation( true );
             }
             else if ( bFinishedLoadedInstantiation )
             {
+                FHoudiniLoadProfilePhaseScope LoadProfileScope( LoadProfile, EHoudiniLoadProfilePhase::InputUpload );
+
                 // If we are doing first cook after instantiation.
                 RefreshEditableNodesAfterLoad();
 
@@ -1835,14 +2344,47 @@ UHoudiniAssetComponent::TickHoudiniComponent()
                     PresetBuffer.Empty();
                 }
 
+                // A recovered asset that has not been modified since its state was cached keeps its outputs.
+                const bool bSkipCook = bRecoveringSession && bRecoveryOutputsValid && !bParametersChanged && !bManualRecookRequested;
+                bRecoveringSession = false;
+                bRecoveryOutputsValid = false;
+
                 // Upload changed parameters back to HAPI.
                 UploadChangedParameters();
 
                 // Reset tranform changed flag.
                 bComponentNeedsCook = false;
 
-                // Create asset cooking task object and submit it for processing.
-                StartTaskAssetCooking();
+                if ( bSkipCook )
+                {
+                    AssetCookCount = 1;
+                    bFullyLoaded = true;
+                    bStopTicking = true;
+
+                    // Parameters saved in the compact format still have to be recreated from the asset.
+                    if ( DeferredParameters.Num() > 0 )
+                        CreateParameters();
+
+                    HOUDINI_LOG_MESSAGE( TEXT( "    %s Recovered without cooking." ), *GetOwner()->GetName() );
+                    LoadProfile.Finish();
+                }
+                else if ( RestoreSharedCookOutputs() )
+                {
+                    // Another component cooked the same asset and preset, we use its outputs.
+                    bFullyLoaded = true;
+                    bStopTicking = true;
+                    LoadProfile.Finish();
+                }
+                else
+                {
+                    // Create asset cooking task object and submit it for processing.
+                    LoadProfile.BeginPhase( EHoudiniLoadProfilePhase::Recook );
+                    StartTaskAssetCooking();
+                }
+            }
+            else if ( IsWaitingForUpstreamAssetsToCook() )
+            {
+                // Our upstream assets cook first, we keep ticking and cook once after all of them have finished.
             }
             else
             {
@@ -1851,8 +2393,11 @@ UHoudiniAssetComponent::TickHoudiniComponent()
                     // Upload changed parameters back to HAPI.
                     UploadChangedParameters();
 
-                    // Create asset cooking task object and submit it for processing.
-                    StartTaskAssetCooking();
+                    // Another component that cooked the same asset and preset shares its outputs, unless our transform moved.
+                    if ( !bComponentNeedsCook && RestoreSharedCookOutputs() )
+                        bStopTicking = true;
+                    else
+                        StartTaskAssetCooking();
 
                     // Reset ComponentNeedsCook flag.
                     bComponentNeedsCook = false;
@@ -1913,6 +2458,33 @@ UHoudiniAssetComponent::UpdateEditorProperties( bool bConditionalUpdate )
     if ( !HoudiniAssetActor )
         return;
 
+    SCOPE_CYCLE_COUNTER( STAT_UIRefresh );
+    FHoudiniCookProfileStageScope ProfileStageScope( EHoudiniCookProfileStage::UIRefresh );
+
+    // Components edited together refresh the details panel once, when the last of them is done,
+    // and keep all of their actors selected in it.
+    TArray< UObject * > SelectedActors;
+    SelectedActors.Add( HoudiniAssetActor );
+
+    TSharedPtr< FHoudiniMultiEditGroup > Group = MultiEditGroup.Pin();
+    if ( Group.IsValid() )
+    {
+        for ( const TWeakObjectPtr< UHoudiniAssetComponent > & WeakComponent : Group->Components )
+        {
+            UHoudiniAssetComponent * OtherComponent = WeakComponent.Get();
+            if ( !OtherComponent || OtherComponent == this || OtherComponent->IsPendingKill() )
+                continue;
+
+            if ( OtherComponent->bParametersChanged || OtherComponent->IsInstantiatingOrCooking()
+                || OtherComponent->IsPostCookInProgress() )
+                return;
+
+            AHoudiniAssetActor * OtherActor = OtherComponent->GetHoudiniAssetActorOwner();
+            if ( OtherActor )
+                SelectedActors.AddUnique( OtherActor );
+        }
+    }
+
     FPropertyEditorModule & PropertyModule =
         FModuleManager::Get().GetModuleChecked< FPropertyEditorModule >( "PropertyEditor" );
 
@@ -1966,9 +2538,6 @@ UHoudiniAssetComponent::UpdateEditorProperties( bool bConditionalUpdate )
                 continue;
             }
 
-            TArray< UObject * > SelectedActors;
-            SelectedActors.Add( HoudiniAssetActor );
-
             // bEditorPropertiesNeedFullUpdate is false only when small changes (parameters value) have been made
             // We do not reselect the actor to avoid loosing the current selected parameter
 
@@ -1993,85 +2562,184 @@ UHoudiniAssetComponent::StartTaskAssetInstantiation( bool bLocalLoadedComponent,
 {
     // We do not want to be instantiated twice
     bAssetIsBeingInstantiated = true;
+    bTrustingSerializedOutputs = false;
 
     // We first need to make sure all our asset inputs have been instantiated and reconnected.
     UpdateWaitingForUpstreamAssetsToInstantiate( true );
 
     if ( !bWaitingForUpstreamAssetsToInstantiate )
     {
+        // Pick the session our node will live in, the asset library is loaded in that session.
+        SessionIndex = PickSessionIndex();
+        FHoudiniScopedSession ScopedSession( SessionIndex );
+
         // Check if asset has multiple Houdini assets inside.
         HAPI_AssetLibraryId AssetLibraryId = -1;
         TArray< HAPI_StringHandle > AssetNames;
 
         if ( FHoudiniEngineUtils::GetAssetNames( HoudiniAsset, AssetLibraryId, AssetNames ) )
         {
-            HAPI_StringHandle PickedAssetName = AssetNames[ 0 ];
-            bool bShowMultiAssetDialog = false;
+            const int32 PickedAssetNameIdx = PickAssetNameIndex( AssetNames );
+            FHoudiniEngine::Get().AddTask( CreateAssetInstantiationTask(
+                bLocalLoadedComponent, AssetLibraryId, AssetNames[ PickedAssetNameIdx ] ) );
+        }
+        else
+        {
+            HOUDINI_LOG_MESSAGE( TEXT( "Cancelling asset instantiation - unable to retrieve asset names." ) );
+            return;
+        }
+    }
 
-            const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-            if ( HoudiniRuntimeSettings )
-                bShowMultiAssetDialog = HoudiniRuntimeSettings->bShowMultiAssetDialog;
+    // Start ticking - this will poll the cooking system for completion.
+    if ( bStartTicking )
+        StartHoudiniTicking();
+}
 
-            if ( bShowMultiAssetDialog && AssetNames.Num() > 1 )
-            {
-                // If we have more than one asset, we need to present user with choice dialog.
+void
+UHoudiniAssetComponent::StartTaskAssetInstantiations(
+    const TArray< UHoudiniAssetComponent * > & HoudiniAssetComponents, bool bStartTicking )
+{
+    // Asset names are retrieved once per asset and session, the asset picked in the multi asset dialog
+    // is used by all the components of an asset.
+    TMap< TPair< UHoudiniAsset *, int32 >, TPair< HAPI_AssetLibraryId, TArray< HAPI_StringHandle > > > SessionAssetNames;
+    TMap< UHoudiniAsset *, int32 > PickedAssetNameIndices;
 
-                TSharedPtr< SWindow > ParentWindow;
+    // Tasks of this batch, counted per session to keep balancing the pool before they are queued.
+    TArray< FHoudiniEngineTask > Tasks;
+    TMap< int32, int32 > BatchedTaskCounts;
+    TArray< UHoudiniAssetComponent * > TickingComponents;
 
-                // Check if the main frame is loaded. When using the old main frame it may not be.
-                if ( FModuleManager::Get().IsModuleLoaded( "MainFrame" ) )
-                {
-                    IMainFrameModule & MainFrame = FModuleManager::LoadModuleChecked< IMainFrameModule >( "MainFrame" );
-                    ParentWindow = MainFrame.GetParentWindow();
-                }
+    for ( UHoudiniAssetComponent * HoudiniAssetComponent : HoudiniAssetComponents )
+    {
+        if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() || !HoudiniAssetComponent->HoudiniAsset )
+            continue;
 
-                if ( ParentWindow.IsValid() )
-                {
-                    TSharedPtr< SAssetSelectionWidget > AssetSelectionWidget;
+        // We do not want to be instantiated twice
+        HoudiniAssetComponent->bAssetIsBeingInstantiated = true;
+        HoudiniAssetComponent->bTrustingSerializedOutputs = false;
 
-                    TSharedRef< SWindow > Window = SNew( SWindow )
-                        .Title( LOCTEXT( "WindowTitle", "Select an asset to instantiate" ) )
-                        .ClientSize( FVector2D( 640, 480 ) )
-                        .SupportsMinimize( false )
-                        .SupportsMaximize( false )
-                        .HasCloseButton( false );
+        // We first need to make sure all our asset inputs have been instantiated and reconnected.
+        HoudiniAssetComponent->UpdateWaitingForUpstreamAssetsToInstantiate( true );
 
-                    Window->SetContent( SAssignNew( AssetSelectionWidget, SAssetSelectionWidget )
-                        .WidgetWindow( Window )
-                        .AvailableAssetNames( AssetNames ) );
+        if ( !HoudiniAssetComponent->bWaitingForUpstreamAssetsToInstantiate )
+        {
+            UHoudiniAsset * Asset = HoudiniAssetComponent->HoudiniAsset;
+            const int32 PickedSessionIndex = HoudiniAssetComponent->PickSessionIndex( &BatchedTaskCounts );
+            HoudiniAssetComponent->SessionIndex = PickedSessionIndex;
 
-                    if ( AssetSelectionWidget->IsValidWidget() )
-                    {
-                        FSlateApplication::Get().AddModalWindow( Window, ParentWindow, false );
+            const TPair< UHoudiniAsset *, int32 > SessionAsset( Asset, PickedSessionIndex );
+            TPair< HAPI_AssetLibraryId, TArray< HAPI_StringHandle > > * AssetNames = SessionAssetNames.Find( SessionAsset );
+            if ( !AssetNames )
+            {
+                FHoudiniScopedSession ScopedSession( PickedSessionIndex );
 
-                        int32 DialogPickedAssetName = AssetSelectionWidget->GetSelectedAssetName();
-                        if ( DialogPickedAssetName != -1 )
-                            PickedAssetName = DialogPickedAssetName;
-                    }
-                }
+                AssetNames = &SessionAssetNames.Add( SessionAsset );
+                AssetNames->Key = -1;
+                if ( !FHoudiniEngineUtils::GetAssetNames( Asset, AssetNames->Key, AssetNames->Value ) )
+                    AssetNames->Value.Empty();
             }
 
-            // Create new GUID to identify this request.
-            HapiGUID = FGuid::NewGuid();
+            if ( AssetNames->Value.Num() <= 0 )
+            {
+                HOUDINI_LOG_MESSAGE( TEXT( "Cancelling asset instantiation - unable to retrieve asset names." ) );
+                continue;
+            }
 
-            FHoudiniEngineTask Task( EHoudiniEngineTaskType::AssetInstantiation, HapiGUID );
-            Task.Asset = HoudiniAsset;
-            Task.ActorName = GetOuter()->GetName();
-            Task.bLoadedComponent = bLocalLoadedComponent;
-            Task.AssetLibraryId = AssetLibraryId;
-            Task.AssetHapiName = PickedAssetName;
-            FHoudiniEngine::Get().AddTask( Task );
-        }
-        else
-        {
-            HOUDINI_LOG_MESSAGE( TEXT( "Cancelling asset instantiation - unable to retrieve asset names." ) );
-            return;
+            const int32 * PickedAssetNameIdx = PickedAssetNameIndices.Find( Asset );
+            if ( !PickedAssetNameIdx )
+                PickedAssetNameIdx = &PickedAssetNameIndices.Add( Asset, HoudiniAssetComponent->PickAssetNameIndex( AssetNames->Value ) );
+
+            const int32 AssetNameIdx = AssetNames->Value.IsValidIndex( *PickedAssetNameIdx ) ? *PickedAssetNameIdx : 0;
+            Tasks.Add( HoudiniAssetComponent->CreateAssetInstantiationTask(
+                false, AssetNames->Key, AssetNames->Value[ AssetNameIdx ] ) );
+            BatchedTaskCounts.FindOrAdd( PickedSessionIndex )++;
         }
+
+        TickingComponents.Add( HoudiniAssetComponent );
     }
 
+    // Submit the whole batch at once, each scheduler is only woken up once.
+    FHoudiniEngine::Get().AddTasks( MoveTemp( Tasks ) );
+
     // Start ticking - this will poll the cooking system for completion.
     if ( bStartTicking )
-        StartHoudiniTicking();
+    {
+        for ( UHoudiniAssetComponent * HoudiniAssetComponent : TickingComponents )
+            HoudiniAssetComponent->StartHoudiniTicking();
+    }
+}
+
+int32
+UHoudiniAssetComponent::PickAssetNameIndex( const TArray< HAPI_StringHandle > & AssetNames ) const
+{
+    int32 PickedAssetNameIdx = 0;
+    bool bShowMultiAssetDialog = false;
+
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings )
+        bShowMultiAssetDialog = HoudiniRuntimeSettings->bShowMultiAssetDialog;
+
+    if ( bShowMultiAssetDialog && AssetNames.Num() > 1 )
+    {
+        // If we have more than one asset, we need to present user with choice dialog.
+
+        TSharedPtr< SWindow > ParentWindow;
+
+        // Check if the main frame is loaded. When using the old main frame it may not be.
+        if ( FModuleManager::Get().IsModuleLoaded( "MainFrame" ) )
+        {
+            IMainFrameModule & MainFrame = FModuleManager::LoadModuleChecked< IMainFrameModule >( "MainFrame" );
+            ParentWindow = MainFrame.GetParentWindow();
+        }
+
+        if ( ParentWindow.IsValid() )
+        {
+            TSharedPtr< SAssetSelectionWidget > AssetSelectionWidget;
+
+            TSharedRef< SWindow > Window = SNew( SWindow )
+                .Title( LOCTEXT( "WindowTitle", "Select an asset to instantiate" ) )
+                .ClientSize( FVector2D( 640, 480 ) )
+                .SupportsMinimize( false )
+                .SupportsMaximize( false )
+                .HasCloseButton( false );
+
+            Window->SetContent( SAssignNew( AssetSelectionWidget, SAssetSelectionWidget )
+                .WidgetWindow( Window )
+                .AvailableAssetNames( AssetNames ) );
+
+            if ( AssetSelectionWidget->IsValidWidget() )
+            {
+                FSlateApplication::Get().AddModalWindow( Window, ParentWindow, false );
+
+                int32 DialogPickedAssetName = AssetSelectionWidget->GetSelectedAssetName();
+                int32 DialogPickedAssetNameIdx = AssetNames.Find( DialogPickedAssetName );
+                if ( DialogPickedAssetName != -1 && DialogPickedAssetNameIdx != INDEX_NONE )
+                    PickedAssetNameIdx = DialogPickedAssetNameIdx;
+            }
+        }
+    }
+
+    return PickedAssetNameIdx;
+}
+
+FHoudiniEngineTask
+UHoudiniAssetComponent::CreateAssetInstantiationTask(
+    bool bLocalLoadedComponent, HAPI_AssetLibraryId AssetLibraryId, HAPI_StringHandle AssetHapiName )
+{
+    // Create new GUID to identify this request.
+    HapiGUID = FGuid::NewGuid();
+
+    FHoudiniEngineTask Task( EHoudiniEngineTaskType::AssetInstantiation, HapiGUID );
+    Task.Asset = HoudiniAsset;
+    Task.ActorName = GetOuter()->GetName();
+    Task.bLoadedComponent = bLocalLoadedComponent;
+    Task.Priority = bLocalLoadedComponent ? EHoudiniEngineTaskPriority::Background : EHoudiniEngineTaskPriority::Normal;
+    Task.SortKey = bLocalLoadedComponent ? GetLoadTaskSortKey() : 0.0f;
+    Task.AssetLibraryId = AssetLibraryId;
+    Task.AssetHapiName = AssetHapiName;
+    Task.SessionIndex = SessionIndex;
+
+    return Task;
 }
 
 void
@@ -2099,6 +2767,8 @@ UHoudiniAssetComponent::StartTaskAssetCookingManual()
 void
 UHoudiniAssetComponent::StartTaskAssetResetManual()
 {
+    FHoudiniScopedSession ScopedSession( SessionIndex );
+
     if ( !IsInstantiatingOrCooking() )
     {
         if ( FHoudiniEngineUtils::IsValidNodeId( GetAssetId() ) )
@@ -2128,6 +2798,8 @@ UHoudiniAssetComponent::StartTaskAssetResetManual()
 void
 UHoudiniAssetComponent::StartTaskAssetRebuildManual()
 {
+    FHoudiniScopedSession ScopedSession( SessionIndex );
+
     if ( !IsInstantiatingOrCooking() )
     {
         if ( FHoudiniEngineUtils::IsHoudiniNodeValid( AssetId ) )
@@ -2152,11 +2824,91 @@ UHoudiniAssetComponent::StartTaskAssetRebuildManual()
     }
 }
 
+bool
+UHoudiniAssetComponent::ApplyPreset( const TArray< char > & InPresetBuffer )
+{
+    FHoudiniScopedSession ScopedSession( SessionIndex );
+
+    if ( IsInstantiatingOrCooking() || IsPostCookInProgress() || !FHoudiniEngineUtils::IsValidNodeId( AssetId ) )
+        return false;
+
+    // Keep the outputs of the preset we are leaving, unless they are stale.
+    TArray< char > CurrentPresetBuffer;
+    if ( !bParametersChanged && AssetCookCount > 0 && FHoudiniEngineUtils::GetAssetPreset( AssetId, CurrentPresetBuffer ) )
+        CapturePresetSnapshot( FCrc::MemCrc32( CurrentPresetBuffer.GetData(), CurrentPresetBuffer.Num() ) );
+
+    if ( !FHoudiniEngineUtils::SetAssetPreset( AssetId, InPresetBuffer ) )
+        return false;
+
+    UnmarkChangedParameters();
+
+    const uint32 PresetHash = FCrc::MemCrc32( InPresetBuffer.GetData(), InPresetBuffer.Num() );
+    for ( int32 SnapshotIdx = 0; SnapshotIdx < PresetSnapshots.Num(); ++SnapshotIdx )
+    {
+        if ( PresetSnapshots[ SnapshotIdx ].PresetHash != PresetHash )
+            continue;
+
+        // Move the snapshot to the front, it is now the most recently used one.
+        FHoudiniPresetSnapshot PresetSnapshot = PresetSnapshots[ SnapshotIdx ];
+        PresetSnapshots.RemoveAt( SnapshotIdx );
+        PresetSnapshots.Insert( PresetSnapshot, 0 );
+
+        if ( !HoudiniAsset || PresetSnapshot.AssetBytesHash != HoudiniAsset->GetAssetBytesHash() )
+            break;
+
+        RestorePresetSnapshot( PresetSnapshot );
+        return true;
+    }
+
+    StartTaskAssetCookingManual();
+    return true;
+}
+
+void
+UHoudiniAssetComponent::NotifyAssetNeedsToChangeSession()
+{
+    if ( IsInstantiatingOrCooking() )
+        return;
+
+    {
+        FHoudiniScopedSession ScopedSession( SessionIndex );
+
+        if ( FHoudiniEngineUtils::IsHoudiniNodeValid( AssetId ) && !FHoudiniEngineUtils::GetAssetPreset( AssetId, PresetBuffer ) )
+            HOUDINI_LOG_WARNING( TEXT( "Failed to get the asset's preset, moved asset may have lost its parameters." ) );
+
+        // Our input nodes live in the session we are leaving, they are created again in the new one.
+        for ( UHoudiniAssetInput * LocalInput : Inputs )
+        {
+            if ( LocalInput && !LocalInput->IsPendingKill() )
+                LocalInput->ResetForNewSession();
+        }
+
+        for ( TMap< HAPI_ParmId, UHoudiniAssetParameter * >::TIterator IterParams( Parameters ); IterParams; ++IterParams )
+        {
+            UHoudiniAssetInput * Input = Cast< UHoudiniAssetInput >( IterParams.Value() );
+            if ( Input && !Input->IsPendingKill() )
+                Input->ResetForNewSession();
+        }
+    }
+
+    // Our node is deleted in its session, the new one is picked when we are instantiated again.
+    StartTaskAssetDeletion();
+
+    HapiGUID = FGuid::NewGuid();
+    bLoadedComponentRequiresInstantiation = true;
+    bParametersChanged = true;
+    bManualRecookRequested = true;
+
+    StartHoudiniTicking();
+}
+
 void
 UHoudiniAssetComponent::StartTaskAssetDeletion()
 {
     if ( FHoudiniEngineUtils::IsValidNodeId( AssetId ) && bIsNativeComponent )
     {
+        FHoudiniScopedSession ScopedSession( SessionIndex );
+
         // Get the Asset's NodeInfo
         HAPI_NodeInfo AssetNodeInfo;
         FMemory::Memset< HAPI_NodeInfo >(AssetNodeInfo, 0);
@@ -2178,7 +2930,9 @@ UHoudiniAssetComponent::StartTaskAssetDeletion()
         // Create asset deletion task object and submit it for processing.
         FHoudiniEngineTask Task( EHoudiniEngineTaskType::AssetDeletion, HapiDeletionGUID );
         Task.AssetId = OBJNodeToDelete;
-        FHoudiniEngine::Get().AddTask( Task );
+        Task.SessionIndex = SessionIndex;
+        Task.Priority = EHoudiniEngineTaskPriority::Background;
+        FHoudiniEngine::Get().AddTask( MoveTemp( Task ) );
 
         // Reset asset id
         AssetId = -1;
@@ -2201,7 +2955,13 @@ UHoudiniAssetComponent::StartTaskAssetCooking( bool bStartTicking )
         FHoudiniEngineTask Task( EHoudiniEngineTaskType::AssetCooking, HapiGUID );
         Task.ActorName = GetOuter()->GetName();
         Task.AssetId = GetAssetId();
-        FHoudiniEngine::Get().AddTask( Task );
+        Task.SessionIndex = SessionIndex;
+
+        // The first cook of a loaded component is not waited on, later cooks follow user edits.
+        Task.Priority = ( bLoadedComponent && AssetCookCount == 0 )
+            ? EHoudiniEngineTaskPriority::Background : EHoudiniEngineTaskPriority::Interactive;
+        Task.SortKey = ( Task.Priority == EHoudiniEngineTaskPriority::Background ) ? GetLoadTaskSortKey() : 0.0f;
+        FHoudiniEngine::Get().AddTask( MoveTemp( Task ) );
 
         if ( bStartTicking )
             StartHoudiniTicking();
@@ -2249,6 +3009,9 @@ UHoudiniAssetComponent::ResetHoudiniResources()
 void
 UHoudiniAssetComponent::SubscribeEditorDelegates()
 {
+    if ( IsStaticPIEContainer() )
+        return;
+
     // Add delegate for asset post import.
     DelegateHandleAssetPostImport =
         FEditorDelegates::OnAssetPostImport.AddUObject( this, &UHoudiniAssetComponent::OnAssetPostImport );
@@ -2342,9 +3105,12 @@ UHoudiniAssetComponent::PostEditChangeProperty( FPropertyChangedEvent & Property
                 if ( !StaticMesh || StaticMesh->IsPendingKill() )
                     continue;
 
+                FHoudiniEngineMeshBuildQueue & StaticMeshBuildQueue = FHoudiniEngine::Get().GetStaticMeshBuildQueue();
+                StaticMeshBuildQueue.FinishBuild( StaticMesh );
+
                 SetStaticMeshGenerationParameters( StaticMesh );
                 FHoudiniScopedGlobalSilence ScopedGlobalSilence;
-                StaticMesh->Build( true );
+                StaticMeshBuildQueue.BuildStaticMesh( StaticMesh );
                 RefreshCollisionChange( *StaticMesh );
             }
 
@@ -2618,7 +3384,7 @@ UHoudiniAssetComponent::OnAssetPostImport( UFactory * Factory, UObject * Object
 
     TMap<UObject*, UObject*> ReplacementMap;
 
-    // We need to reconstruct geometry from copied actor.
+    // We share the geometry of the copied actor, both components get their own meshes on their next cook or edit.
     for( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator Iter( CopiedHoudiniComponent->StaticMeshes ); Iter; ++Iter )
     {
         FHoudiniGeoPartObject & HoudiniGeoPartObject = Iter.Key();
@@ -2626,16 +3392,9 @@ UHoudiniAssetComponent::OnAssetPostImport( UFactory * Factory, UObject * Object
         if ( !StaticMesh || StaticMesh->IsPendingKill() )
             continue;
 
-        // Duplicate static mesh and all related generated Houdini materials and textures.
-        UStaticMesh * DuplicatedStaticMesh =
-            FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackage( StaticMesh, this, HoudiniGeoPartObject, FHoudiniCookParams::GetDefaultStaticMeshesCookMode() );
-
-        if( DuplicatedStaticMesh && !DuplicatedStaticMesh->IsPendingKill() )
-        {
-            // Store this duplicated mesh.
-            StaticMeshes.Add( FHoudiniGeoPartObject( HoudiniGeoPartObject, true ), DuplicatedStaticMesh );
-            ReplacementMap.Add( StaticMesh, DuplicatedStaticMesh );
-        }
+        StaticMeshes.Add( FHoudiniGeoPartObject( HoudiniGeoPartObject, true ), StaticMesh );
+        SharedStaticMeshes.Add( StaticMesh );
+        CopiedHoudiniComponent->SharedStaticMeshes.Add( StaticMesh );
     }
 
     // Copy material information.
@@ -2718,6 +3477,68 @@ UHoudiniAssetComponent::OnAssetPostImport( UFactory * Factory, UObject * Object
         StartTaskAssetCookingManual();
 }
 
+UStaticMesh *
+UHoudiniAssetComponent::UnshareStaticMesh( UStaticMesh * StaticMesh )
+{
+    if ( !StaticMesh || SharedStaticMeshes.Remove( StaticMesh ) == 0 )
+        return StaticMesh;
+
+    const FHoudiniGeoPartObject * FoundHoudiniGeoPartObject = StaticMeshes.FindKey( StaticMesh );
+    if ( !FoundHoudiniGeoPartObject )
+        return StaticMesh;
+
+    const FHoudiniGeoPartObject HoudiniGeoPartObject = *FoundHoudiniGeoPartObject;
+
+    // Duplicate static mesh and all related generated Houdini materials and textures.
+    UStaticMesh * DuplicatedStaticMesh =
+        FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackage( StaticMesh, this, HoudiniGeoPartObject, FHoudiniCookParams::GetDefaultStaticMeshesCookMode() );
+
+    if ( !DuplicatedStaticMesh || DuplicatedStaticMesh->IsPendingKill() )
+        return StaticMesh;
+
+    StaticMeshes.Add( HoudiniGeoPartObject, DuplicatedStaticMesh );
+
+    // Our component and instancers now use the duplicated mesh.
+    UStaticMeshComponent * StaticMeshComponent = nullptr;
+    if ( StaticMeshComponents.RemoveAndCopyValue( StaticMesh, StaticMeshComponent ) && StaticMeshComponent )
+    {
+        StaticMeshComponent->SetStaticMesh( DuplicatedStaticMesh );
+        StaticMeshComponents.Add( DuplicatedStaticMesh, StaticMeshComponent );
+    }
+
+    TMap< UObject *, UObject * > ReplacementMap;
+    ReplacementMap.Add( StaticMesh, DuplicatedStaticMesh );
+
+    for ( auto & InstanceInput : InstanceInputs )
+    {
+        if ( !InstanceInput || InstanceInput->IsPendingKill() )
+            continue;
+
+        for ( UHoudiniAssetInstanceInputField * InputField : InstanceInput->GetInstanceInputFields() )
+        {
+            if ( InputField && !InputField->IsPendingKill() )
+                InputField->FixInstancedObjects( ReplacementMap );
+        }
+    }
+
+    return DuplicatedStaticMesh;
+}
+
+void
+UHoudiniAssetComponent::UnshareStaticMeshes()
+{
+    if ( SharedStaticMeshes.Num() <= 0 )
+        return;
+
+    TArray< UStaticMesh * > StaticMeshesToUnshare;
+    StaticMeshes.GenerateValueArray( StaticMeshesToUnshare );
+
+    for ( UStaticMesh * StaticMesh : StaticMeshesToUnshare )
+        UnshareStaticMesh( StaticMesh );
+
+    SharedStaticMeshes.Empty();
+}
+
 void
 UHoudiniAssetComponent::OnApplyObjectToActor( UObject* ObjectToApply, AActor * ActorToApplyTo )
 {
@@ -2729,6 +3550,9 @@ UHoudiniAssetComponent::OnApplyObjectToActor( UObject* ObjectToApply, AActor * A
     if (!Material)
         return;
 
+    // Materials are replaced on the meshes themselves, which must not be shared with a copied component.
+    UnshareStaticMeshes();
+
     bool bMaterialReplaced = false;
 
     TMap< UStaticMesh*, int32 > MaterialReplacementsMap;
@@ -2851,12 +3675,15 @@ UHoudiniAssetComponent::CheckedUploadTransform()
 {
     // Only if the asset is done loading, else this might cause a cook 
     // upon loading a map if the asset has TransformChangeTRiggersCook enabled
-    if ( !bFullyLoaded )
+    if ( !bFullyLoaded || IsStaticPIEContainer() )
         return;
 
     // If we have to upload transforms.
     if ( bUploadTransformsToHoudiniEngine && AssetCookCount > 0 )
     {
+        // The outputs of other presets were cooked with the previous transform.
+        ClearPresetSnapshots();
+
         // Retrieve the current component-to-world transform for this component.
         if ( !FHoudiniEngineUtils::HapiSetAssetTransform( AssetId, GetComponentTransform() ) )
             HOUDINI_LOG_MESSAGE( TEXT( "Failed Uploading Transformation change back to HAPI." ) );
@@ -2883,7 +3710,13 @@ UHoudiniAssetComponent::CheckedUploadTransform()
         }
 
         if (bLoadedComponent && !FHoudiniEngineUtils::IsValidNodeId(AssetId) && !bAssetIsBeingInstantiated)
+        {
+            // The saved outputs are kept until an edit creates the node, the cook will then pick up the new transform.
+            if ( bTrustingSerializedOutputs )
+                return;
+
             StartTaskAssetCookingManual();
+        }
 
         bComponentNeedsCook = true;
         StartHoudiniTicking();
@@ -2958,7 +3791,7 @@ FString UHoudiniAssetComponent::GetBakingBaseName( const FHoudiniGeoPartObject&
     }
     if( GeoPartObject.HasCustomName() )
     {
-        return GeoPartObject.PartName;
+        return GeoPartObject.GetPartName();
     }
 
     if ( GetOwner() )
@@ -2985,6 +3818,10 @@ UHoudiniAssetComponent::CalcBounds( const FTransform & LocalToWorld ) const
     LocalBounds = FBoxSphereBounds( BoundingBox );
     LocalBounds.Origin = LocalToWorld.GetLocation();
 
+    // Keep the preview of the cooked geometry from being culled.
+    if ( CookPreviewBounds.IsValid )
+        LocalBounds = LocalBounds + FBoxSphereBounds( CookPreviewBounds.TransformBy( LocalToWorld ) );
+
     const auto & LocalAttachedChildren = GetAttachChildren();
     for (int32 Idx = 0; Idx < LocalAttachedChildren.Num(); ++Idx)
     {
@@ -2999,6 +3836,21 @@ UHoudiniAssetComponent::CalcBounds( const FTransform & LocalToWorld ) const
     return LocalBounds;
 }
 
+void
+UHoudiniAssetComponent::CaptureRenderState()
+{
+    CapturedRenderStateHashes.Reset();
+    ChangedStaticMeshes.Reset();
+
+    for ( USceneComponent * SceneComponent : GetAttachChildren() )
+    {
+        if ( SceneComponent && !SceneComponent->IsPendingKill() )
+            CapturedRenderStateHashes.Add( SceneComponent, HoudiniEngineComputeRenderStateHash( SceneComponent ) );
+    }
+
+    bRenderStateCaptured = true;
+}
+
 void
 UHoudiniAssetComponent::UpdateRenderingInformation()
 {
@@ -3007,14 +3859,31 @@ UHoudiniAssetComponent::UpdateRenderingInformation()
 
     // Update physics representation right away.
     RecreatePhysicsState();
-    const auto & LocalAttachChildren = GetAttachChildren();
-    for ( TArray< USceneComponent * >::TConstIterator Iter( LocalAttachChildren ); Iter; ++Iter )
+
+    // Without a capture, after loading for instance, all attached components are updated.
+    // Their render states are marked dirty by the changes themselves and sent once at the end of the frame.
+    for ( USceneComponent * SceneComponent : GetAttachChildren() )
     {
-        USceneComponent * SceneComponent = *Iter;
-        if( SceneComponent )
-            SceneComponent->RecreatePhysicsState();
+        if ( !SceneComponent || SceneComponent->IsPendingKill() )
+            continue;
+
+        if ( bRenderStateCaptured )
+        {
+            UStaticMeshComponent * StaticMeshComponent = Cast< UStaticMeshComponent >( SceneComponent );
+            const bool bMeshChanged = StaticMeshComponent && ChangedStaticMeshes.Contains( StaticMeshComponent->GetStaticMesh() );
+
+            const uint32 * CapturedHash = CapturedRenderStateHashes.Find( SceneComponent );
+            if ( !bMeshChanged && CapturedHash && *CapturedHash == HoudiniEngineComputeRenderStateHash( SceneComponent ) )
+                continue;
+        }
+
+        SceneComponent->RecreatePhysicsState();
     }
 
+    bRenderStateCaptured = false;
+    CapturedRenderStateHashes.Empty();
+    ChangedStaticMeshes.Empty();
+
     // Since we have new asset, we need to update bounds.
     UpdateBounds();
 }
@@ -3084,6 +3953,16 @@ UHoudiniAssetComponent::OnComponentCreated()
 void
 UHoudiniAssetComponent::OnComponentDestroyed( bool bDestroyingHierarchy )
 {
+    // The PIE world is torn down as a whole, the outputs we hold are the ones of the editor component.
+    if ( IsStaticPIEContainer() )
+    {
+        Super::OnComponentDestroyed( bDestroyingHierarchy );
+        return;
+    }
+
+    // Snapshot meshes are released with the current ones, not deleted.
+    PresetSnapshots.Empty();
+
     // Release static mesh related resources.
     ReleaseObjectGeoPartResources( StaticMeshes );
     StaticMeshes.Empty();
@@ -3127,6 +4006,13 @@ UHoudiniAssetComponent::OnRegister()
 {
     Super::OnRegister();
 
+    // Duplicated outputs are registered with the PIE world as they are, they don't need their states rebuilt.
+    if ( IsStaticPIEContainer() )
+    {
+        bFullyLoaded = true;
+        return;
+    }
+
     // We need to recreate render states for loaded components.
     if ( bLoadedComponent )
     {
@@ -3134,13 +4020,15 @@ UHoudiniAssetComponent::OnRegister()
         for ( TMap< UStaticMesh *, UStaticMeshComponent * >::TIterator Iter( StaticMeshComponents ); Iter; ++Iter )
         {
             UStaticMeshComponent * StaticMeshComponent = Iter.Value();
-            if ( StaticMeshComponent && !StaticMeshComponent->IsPendingKill() )
+            if ( StaticMeshComponent && !StaticMeshComponent->IsPendingKill() && StaticMeshComponent->IsRegistered() )
             {
-                // Recreate render state.
-                StaticMeshComponent->RecreateRenderState_Concurrent();
+                // Recreate render state, hidden components create it themselves once they are shown.
+                if ( StaticMeshComponent->IsRenderStateCreated() && StaticMeshComponent->IsVisible() )
+                    StaticMeshComponent->RecreateRenderState_Concurrent();
 
-                // Need to recreate physics state.
-                StaticMeshComponent->RecreatePhysicsState();
+                // Need to recreate physics state, if there is one to build.
+                if ( StaticMeshComponent->IsCollisionEnabled() || StaticMeshComponent->IsPhysicsStateCreated() )
+                    StaticMeshComponent->RecreatePhysicsState();
             }
         }
 
@@ -3206,12 +4094,16 @@ UHoudiniAssetComponent::PostLoad()
         return;
     }
 
-    SanitizePostLoad();
+    {
+        FHoudiniLoadProfilePhaseScope LoadProfileScope( LoadProfile, EHoudiniLoadProfilePhase::PostLoad );
+        SanitizePostLoad();
+    }
 
     // We loaded a component which has no asset associated with it.
     if ( !HoudiniAsset && StaticMeshes.Num() <= 0)
     {
         // Set geometry to be Houdini logo geometry, since we have no other geometry.
+        FHoudiniLoadProfilePhaseScope LoadProfileScope( LoadProfile, EHoudiniLoadProfilePhase::RenderState );
         CreateStaticMeshHoudiniLogoResource( StaticMeshes );
         return;
     }
@@ -3219,42 +4111,58 @@ UHoudiniAssetComponent::PostLoad()
     // Show busy cursor.
     FScopedBusyCursor ScopedBusyCursor;
 
-    if ( StaticMeshes.Num() > 0 )
-    {
-        CreateObjectGeoPartResources( StaticMeshes );
-    }
-    else
     {
-        // Iff the only component our owner has is us, then we should show the logo mesh
-        auto SceneComponents = GetOwner()->GetComponentsByClass( USceneComponent::StaticClass() );
-        if ( SceneComponents.Num() == 1 )
+        FHoudiniLoadProfilePhaseScope LoadProfileScope( LoadProfile, EHoudiniLoadProfilePhase::RenderState );
+        if ( StaticMeshes.Num() > 0 )
         {
-            CreateStaticMeshHoudiniLogoResource( StaticMeshes );
+            CreateObjectGeoPartResources( StaticMeshes );
+        }
+        else
+        {
+            // Iff the only component our owner has is us, then we should show the logo mesh
+            auto SceneComponents = GetOwner()->GetComponentsByClass( USceneComponent::StaticClass() );
+            if ( SceneComponents.Num() == 1 )
+            {
+                CreateStaticMeshHoudiniLogoResource( StaticMeshes );
+            }
         }
     }
 
-    // Perform post load initialization on parameters.
-    PostLoadInitializeParameters();
+    // Trusted outputs are displayed as they are, the node is only created once we get edited.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    bTrustingSerializedOutputs = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bTrustSerializedOutputsOnLoad
+        && bLoadedComponent && HasSerializedOutputs();
+
+    {
+        FHoudiniLoadProfilePhaseScope LoadProfileScope( LoadProfile, EHoudiniLoadProfilePhase::PostLoad );
 
-    // Perform post load initialization on instance inputs.
-    PostLoadInitializeInstanceInputs();
+        // Perform post load initialization on parameters.
+        PostLoadInitializeParameters();
 
-    // Post attach components to parent asset component.
-    PostLoadReattachComponents();
+        // Perform post load initialization on instance inputs.
+        PostLoadInitializeInstanceInputs();
 
-    // Update mobility.
-    // It'll be changed to static if we generated a landscape,
-    // and if not, to movable if any of our children is movable
-    UpdateMobility();
+        // Post attach components to parent asset component.
+        PostLoadReattachComponents();
+
+        // Update mobility.
+        // It'll be changed to static if we generated a landscape,
+        // and if not, to movable if any of our children is movable
+        UpdateMobility();
+    }
 
-    // Need to update rendering information.
-    UpdateRenderingInformation();
+    {
+        // Need to update rendering information.
+        FHoudiniLoadProfilePhaseScope LoadProfileScope( LoadProfile, EHoudiniLoadProfilePhase::RenderState );
+        UpdateRenderingInformation();
+    }
 
     // Force editor to redraw viewports.
     if ( GEditor )
         GEditor->RedrawAllViewports();
 
     // Update properties panel after instantiation.
+    FHoudiniLoadProfilePhaseScope LoadProfileScope( LoadProfile, EHoudiniLoadProfilePhase::PostLoad );
     UpdateEditorProperties( false );
 }
 #endif
@@ -3269,6 +4177,12 @@ UHoudiniAssetComponent::Serialize( FArchive & Ar )
     if ( !Ar.IsSaving() && !Ar.IsLoading() )
         return;
 
+    // Loading from a package starts a new load profile, undo transactions are not level loads.
+    if ( Ar.IsLoading() && !Ar.IsTransacting() )
+        LoadProfile.Start();
+
+    FHoudiniLoadProfilePhaseScope LoadProfileScope( LoadProfile, EHoudiniLoadProfilePhase::Deserialization );
+
     // Serialize component flags.
     Ar << HoudiniAssetComponentFlagsPacked;
 
@@ -3385,10 +4299,14 @@ UHoudiniAssetComponent::Serialize( FArchive & Ar )
     }
 
     // Serialize parameters.
-    SerializeParameters( Ar );
+    const bool bCompactParameters = SerializeParameters( Ar );
 
     // Serialize parameters name map.
-    if ( HoudiniAssetComponentVersion >= VER_HOUDINI_ENGINE_COMPONENT_PARAMETER_NAME_MAP )
+    if ( bCompactParameters )
+    {
+        // The compact format already stored it along with the parameters.
+    }
+    else if ( HoudiniAssetComponentVersion >= VER_HOUDINI_ENGINE_COMPONENT_PARAMETER_NAME_MAP )
     {
         Ar << ParameterByName;
     }
@@ -3414,8 +4332,40 @@ UHoudiniAssetComponent::Serialize( FArchive & Ar )
     // Serialize material replacements and material assignments.
     Ar << HoudiniAssetComponentMaterials;
 
-    // Serialize geo parts and generated static meshes.
-    Ar << StaticMeshes;
+    // Serialize geo parts and generated static meshes. Parts are written once in a table which the output maps
+    // reference by index, transactions keep them inline as they never reach the disk.
+    bool bGeoPartTable = false;
+    if ( HoudiniAssetComponentVersion >= VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_GEO_PART_TABLE )
+    {
+        if ( Ar.IsSaving() )
+            bGeoPartTable = !Ar.IsTransacting();
+
+        Ar << bGeoPartTable;
+    }
+
+    FHoudiniGeoPartTable GeoPartTable;
+    if ( bGeoPartTable )
+    {
+        if ( Ar.IsSaving() )
+        {
+            for ( const auto & Pair : StaticMeshes )
+                GeoPartTable.Add( Pair.Key );
+            for ( const auto & Pair : LandscapeComponents )
+                GeoPartTable.Add( Pair.Key );
+            for ( const auto & Pair : CookedTemporaryStaticMeshPackages )
+                GeoPartTable.Add( Pair.Key );
+            for ( const auto & Pair : CookedTemporaryLandscapeLayers )
+                GeoPartTable.Add( Pair.Value );
+        }
+
+        GeoPartTable.Serialize( Ar );
+        GeoPartTable.SerializeKeys( Ar, StaticMeshes );
+    }
+    else
+    {
+        Ar << StaticMeshes;
+    }
+
     Ar << StaticMeshComponents;
 
     // Serialize instance inputs (we do this after geometry loading as we might need it).
@@ -3433,7 +4383,10 @@ UHoudiniAssetComponent::Serialize( FArchive & Ar )
     // Serialize Landscape/GeoPart map
     if ( HoudiniAssetComponentVersion >= VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_LANDSCAPES )
     {
-        Ar << LandscapeComponents;
+        if ( bGeoPartTable )
+            GeoPartTable.SerializeKeys( Ar, LandscapeComponents );
+        else
+            Ar << LandscapeComponents;
     }
 
     if( HoudiniAssetComponentVersion >=  VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_BAKENAME_OVERRIDE )
@@ -3507,7 +4460,10 @@ UHoudiniAssetComponent::Serialize( FArchive & Ar )
             }
         }
 
-        Ar << MeshPackages;
+        if ( bGeoPartTable )
+            GeoPartTable.SerializeKeys( Ar, MeshPackages );
+        else
+            Ar << MeshPackages;
 
         if ( Ar.IsLoading() )
         {
@@ -3549,7 +4505,10 @@ UHoudiniAssetComponent::Serialize( FArchive & Ar )
             }
         }
 
-        Ar << LayerPackages;
+        if ( bGeoPartTable )
+            GeoPartTable.SerializeValues( Ar, LayerPackages );
+        else
+            Ar << LayerPackages;
 
         if ( Ar.IsLoading() )
         {
@@ -3761,6 +4720,34 @@ UHoudiniAssetComponent::IsCookingEnabled() const
     return FHoudiniEngine::Get().GetEnableCookingGlobal() && bEnableCooking;
 }
 
+void
+UHoudiniAssetComponent::SetPassThroughOnly( bool bInPassThroughOnly )
+{
+    if ( bPassThroughOnly == (uint32) bInPassThroughOnly )
+        return;
+
+    bPassThroughOnly = bInPassThroughOnly;
+
+    // The outputs are released, or created again, by the next post cook.
+    if ( FHoudiniEngineUtils::IsValidNodeId( GetAssetId() ) )
+        StartTaskAssetCookingManual();
+}
+
+void
+UHoudiniAssetComponent::ReleasePassThroughOutputs()
+{
+    ClearInstanceInputs();
+    ClearLandscapes();
+
+    if ( !bContainsHoudiniLogoGeometry || StaticMeshes.Num() != 1 )
+    {
+        ReleaseObjectGeoPartResources( StaticMeshes, true );
+        StaticMeshes.Empty();
+        StaticMeshComponents.Empty();
+        CreateStaticMeshHoudiniLogoResource( StaticMeshes );
+    }
+}
+
 void
 UHoudiniAssetComponent::PostEditUndo()
 {
@@ -3903,6 +4890,7 @@ UHoudiniAssetComponent::PostInitProperties()
         bEnableCooking = HoudiniRuntimeSettings->bEnableCooking;
         bUploadTransformsToHoudiniEngine = HoudiniRuntimeSettings->bUploadTransformsToHoudiniEngine;
         bTransformChangeTriggersCooks = HoudiniRuntimeSettings->bTransformChangeTriggersCooks;
+        bSliderDragTriggersCooks = HoudiniRuntimeSettings->bSliderDragTriggersCooks;
 
         // Copy static mesh generation parameters from settings.
         bGeneratedDoubleSidedGeometry = HoudiniRuntimeSettings->bDoubleSidedGeometry;
@@ -3918,6 +4906,7 @@ UHoudiniAssetComponent::PostInitProperties()
         GeneratedFoliageDefaultSettings = HoudiniRuntimeSettings->FoliageDefaultSettings;
         GeneratedAssetUserData = HoudiniRuntimeSettings->AssetUserData;
         GeneratedDistanceFieldResolutionScale = HoudiniRuntimeSettings->GeneratedDistanceFieldResolutionScale;
+        GeneratedAutoLODTriangleBudget = HoudiniRuntimeSettings->AutoLODTriangleBudget;
     }
 }
 
@@ -3947,17 +4936,18 @@ UHoudiniAssetComponent::LocateStaticMeshes(
 
             if ( ObjectName.Len() > 0 )
             {
-                if ( bSubstring && ObjectName.Len() >= HoudiniGeoPartObject.ObjectName.Len() )
+                const FString PartObjectName = HoudiniGeoPartObject.GetObjectName();
+                if ( bSubstring && ObjectName.Len() >= PartObjectName.Len() )
                 {
                     int32 Index = ObjectName.Find(
-                        *HoudiniGeoPartObject.ObjectName,
+                        *PartObjectName,
                         ESearchCase::IgnoreCase,
                         ESearchDir::FromEnd, INDEX_NONE );
 
-                    if ( ( Index != -1 ) && ( Index + HoudiniGeoPartObject.ObjectName.Len() == ObjectName.Len() ) )
+                    if ( ( Index != -1 ) && ( Index + PartObjectName.Len() == ObjectName.Len() ) )
                         Objects.Add( HoudiniGeoPartObject );
                 }
-                else if ( HoudiniGeoPartObject.ObjectName.Equals( ObjectName ) )
+                else if ( PartObjectName.Equals( ObjectName ) )
                 {
                     Objects.Add( HoudiniGeoPartObject );
                 }
@@ -4027,15 +5017,30 @@ UHoudiniAssetComponent::IsPIEActive() const
     return false;
 }
 
-#if WITH_EDITOR
-
-void
-UHoudiniAssetComponent::CreateCurves( const TArray< FHoudiniGeoPartObject > & FoundCurves )
+bool
+UHoudiniAssetComponent::IsStaticPIEContainer() const
 {
-    bool bCurveCreated = false;
+#if WITH_EDITOR
+    const UWorld * World = GetWorld();
+    if ( !World || World->WorldType != EWorldType::PIE )
+        return false;
 
-    TMap< FHoudiniGeoPartObject, TWeakObjectPtr<UHoudiniSplineComponent> > NewSplineComponents;
-    for ( TArray< FHoudiniGeoPartObject >::TConstIterator Iter( FoundCurves ); Iter; ++Iter )
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    return HoudiniRuntimeSettings && HoudiniRuntimeSettings->bStaticComponentsInPIE;
+#else
+    return false;
+#endif
+}
+
+#if WITH_EDITOR
+
+void
+UHoudiniAssetComponent::CreateCurves( const TArray< FHoudiniGeoPartObject > & FoundCurves )
+{
+    bool bCurveCreated = false;
+
+    TMap< FHoudiniGeoPartObject, TWeakObjectPtr<UHoudiniSplineComponent> > NewSplineComponents;
+    for ( TArray< FHoudiniGeoPartObject >::TConstIterator Iter( FoundCurves ); Iter; ++Iter )
     {
         const FHoudiniGeoPartObject & HoudiniGeoPartObject = *Iter;
 
@@ -4166,12 +5171,20 @@ UHoudiniAssetComponent::CreateParameters()
 {
     TMap< HAPI_ParmId, class UHoudiniAssetParameter * > NewParameters;
 
-    if( FHoudiniParamUtils::Build(AssetId, this, Parameters, NewParameters) )
+    uint32 InterfaceHash = ParameterInterfaceHash;
+    bool bInterfaceChanged = true;
+    TMap< FString, HAPI_ParmId > NewDeferredParameters = DeferredParameters;
+    if( FHoudiniParamUtils::Build(AssetId, this, Parameters, NewParameters, &InterfaceHash, &bInterfaceChanged,
+        &NewDeferredParameters, &ForcedParameterNames ) )
     {
-        bEditorPropertiesNeedFullUpdate = true;
+        // The panel only needs a full update if the parameter tree was rebuilt.
+        if ( bInterfaceChanged )
+            bEditorPropertiesNeedFullUpdate = true;
 
         // Remove all unused parameters.
         ClearParameters();
+        ParameterInterfaceHash = InterfaceHash;
+        DeferredParameters = NewDeferredParameters;
 
         // Update parameters.
         Parameters = NewParameters;
@@ -4202,15 +5215,74 @@ UHoudiniAssetComponent::NotifyParameterChanged( UHoudiniAssetParameter * Houdini
         */
         if ( !FoundClass->IsChildOf< UHoudiniAssetInput >() )
             bEditorPropertiesNeedFullUpdate = false;
+        else
+            ClearPresetSnapshots();
+    }
+    else
+    {
+        // Upstream changes make the outputs of all presets stale.
+        ClearPresetSnapshots();
     }
 
     bParametersChanged = true;
     StartHoudiniTicking();
 }
 
+void
+UHoudiniAssetComponent::SetMultiEditGroup( const TSharedPtr< FHoudiniMultiEditGroup > & InMultiEditGroup )
+{
+    MultiEditGroup = InMultiEditGroup;
+}
+
+void
+UHoudiniAssetComponent::PropagateParameterChange( UHoudiniAssetParameter * HoudiniAssetParameter )
+{
+    TSharedPtr< FHoudiniMultiEditGroup > Group = MultiEditGroup.Pin();
+    if ( !Group.IsValid() || Group->bPropagatingChange )
+        return;
+
+    if ( !HoudiniAssetParameter || HoudiniAssetParameter->IsPendingKill() )
+        return;
+
+    // Copying the value marks the other parameters as changed, which must not propagate again.
+    TGuardValue< bool > PropagatingGuard( Group->bPropagatingChange, true );
+
+    const FString & ParameterName = HoudiniAssetParameter->GetParameterName();
+    for ( const TWeakObjectPtr< UHoudiniAssetComponent > & WeakComponent : Group->Components )
+    {
+        UHoudiniAssetComponent * OtherComponent = WeakComponent.Get();
+        if ( !OtherComponent || OtherComponent == this || OtherComponent->IsPendingKill() )
+            continue;
+
+        // Only components of the same asset share their parameters.
+        if ( OtherComponent->HoudiniAsset != HoudiniAsset )
+            continue;
+
+        UHoudiniAssetParameter * OtherParameter = OtherComponent->FindParameter( ParameterName );
+        if ( OtherParameter && OtherParameter != HoudiniAssetParameter && !OtherParameter->IsPendingKill() )
+            OtherParameter->CopyValuesFrom( HoudiniAssetParameter );
+    }
+}
+
+void
+UHoudiniAssetComponent::CreateDeferredParameters()
+{
+    // While cooking, the parameters are rebuilt after the cook with the active tabs.
+    if ( DeferredParameters.Num() <= 0 || IsInstantiatingOrCooking() || IsPostCookInProgress() )
+        return;
+
+    if ( !FHoudiniEngineUtils::IsValidNodeId( AssetId ) )
+        return;
+
+    FHoudiniScopedSession ScopedSession( SessionIndex );
+    CreateParameters();
+}
+
 void
 UHoudiniAssetComponent::NotifyHoudiniSplineChanged( UHoudiniSplineComponent * HoudiniSplineComponent )
 {
+    ClearPresetSnapshots();
+
     if ( bLoadedComponent && !FHoudiniEngineUtils::IsValidNodeId( AssetId ) && !bAssetIsBeingInstantiated )
         bLoadedComponentRequiresInstantiation = true;
 
@@ -4257,7 +5329,8 @@ UHoudiniAssetComponent::UploadChangedParameters()
             }
         }
 
-        // Upload parameters.
+        // Upload parameters, int and float values are gathered and sent in contiguous runs.
+        FHoudiniScopedParmValueUpload ScopedParmValueUpload;
         for ( TMap< HAPI_ParmId, UHoudiniAssetParameter * >::TIterator IterParams( Parameters ); IterParams; ++IterParams )
         {
             UHoudiniAssetParameter * HoudiniAssetParameter = IterParams.Value();
@@ -4270,6 +5343,8 @@ UHoudiniAssetComponent::UploadChangedParameters()
                 Success &= HoudiniAssetParameter->UploadParameterValue();
             }
         }
+
+        Success &= ScopedParmValueUpload.Flush();
     }
 
     if( !Success )
@@ -4532,6 +5607,125 @@ UHoudiniAssetComponent::UpdateWaitingForUpstreamAssetsToInstantiate( bool bNotif
     return bWaitingForUpstreamAssetsToInstantiate;
 }
 
+int32
+UHoudiniAssetComponent::PickSessionIndex( const TMap< int32, int32 > * BatchedTaskCounts ) const
+{
+    // Nodes can only be connected within a session, assets with upstream or downstream assets use the main one.
+    TArray< UHoudiniAssetComponent * > UpstreamAssetComponents;
+    GetUpstreamAssetComponents( UpstreamAssetComponents );
+    if ( UpstreamAssetComponents.Num() > 0 || DownstreamAssetConnections.Num() > 0 )
+        return 0;
+
+    return FHoudiniEngine::Get().GetIdleSessionIndex( BatchedTaskCounts );
+}
+
+void
+UHoudiniAssetComponent::GetUpstreamAssetComponents( TArray< UHoudiniAssetComponent * > & OutUpstreamAssetComponents ) const
+{
+    auto AddUpstreamAssetComponent = [&]( UHoudiniAssetInput * Input )
+    {
+        if ( !Input || Input->IsPendingKill() )
+            return;
+
+        UHoudiniAssetComponent * InputAssetComponent = Input->GetConnectedInputAssetComponent();
+        if ( !InputAssetComponent || InputAssetComponent->IsPendingKill() || InputAssetComponent == this )
+            return;
+
+        OutUpstreamAssetComponents.AddUnique( InputAssetComponent );
+    };
+
+    for ( UHoudiniAssetInput * LocalInput : Inputs )
+        AddUpstreamAssetComponent( LocalInput );
+
+    for ( TMap< HAPI_ParmId, UHoudiniAssetParameter * >::TConstIterator IterParams( Parameters ); IterParams; ++IterParams )
+        AddUpstreamAssetComponent( Cast< UHoudiniAssetInput >( IterParams.Value() ) );
+}
+
+bool
+UHoudiniAssetComponent::HasPendingCook() const
+{
+    if ( IsInstantiatingOrCooking() )
+        return true;
+
+    // Changes made while cooking is disabled are not going to be cooked.
+    if ( !IsCookingEnabled() && !bManualRecookRequested )
+        return false;
+
+    return bParametersChanged || bComponentNeedsCook || bManualRecookRequested;
+}
+
+bool
+UHoudiniAssetComponent::IsWaitingForUpstreamAssetsToCook() const
+{
+    TArray< UHoudiniAssetComponent * > UpstreamAssetComponents;
+    GetUpstreamAssetComponents( UpstreamAssetComponents );
+
+    for ( UHoudiniAssetComponent * UpstreamAssetComponent : UpstreamAssetComponents )
+    {
+        // Do not wait on an asset that is also downstream of us, we would both wait forever.
+        if ( DownstreamAssetConnections.Contains( UpstreamAssetComponent ) )
+            continue;
+
+        if ( UpstreamAssetComponent->HasPendingCook() )
+            return true;
+    }
+
+    return false;
+}
+
+void
+UHoudiniAssetComponent::CacheRecoveryState()
+{
+    if ( !HoudiniAsset || !FHoudiniEngineUtils::GetAssetPreset( AssetId, RecoveryPresetBuffer ) )
+    {
+        RecoveryPresetBuffer.Empty();
+        RecoveryAssetBytesHash.Empty();
+        return;
+    }
+
+    RecoveryAssetBytesHash = HoudiniAsset->GetAssetBytesHash();
+}
+
+bool
+UHoudiniAssetComponent::IsVisibleOrSelected() const
+{
+    AActor * Owner = GetOwner();
+    if ( !Owner )
+        return true;
+
+#if WITH_EDITOR
+    if ( Owner->IsSelected() )
+        return true;
+#endif
+
+    return Owner->WasRecentlyRendered( HAPI_UNREAL_SESSION_RECOVERY_VISIBILITY_TOLERANCE );
+}
+
+float
+UHoudiniAssetComponent::GetLoadTaskSortKey() const
+{
+#if WITH_EDITOR
+    AActor * Owner = GetOwner();
+    if ( !Owner || Owner->IsSelected() )
+        return 0.0f;
+
+    // The others follow by distance to the active viewport's camera.
+    if ( GCurrentLevelEditingViewportClient )
+        return 1.0f + FVector::Dist( GCurrentLevelEditingViewportClient->GetViewLocation(), Bounds.Origin );
+#endif
+
+    return 1.0f;
+}
+
+bool
+UHoudiniAssetComponent::HasSerializedOutputs() const
+{
+    if ( StaticMeshes.Num() > 0 && !bContainsHoudiniLogoGeometry )
+        return true;
+
+    return LandscapeComponents.Num() > 0 || InstanceInputs.Num() > 0;
+}
+
 bool
 UHoudiniAssetComponent::RefreshEditableNodesAfterLoad()
 {
@@ -4643,6 +5837,9 @@ UHoudiniAssetComponent::LocateInstanceInput( const FHoudiniGeoPartObject& GeoPar
 void
 UHoudiniAssetComponent::CreateInstanceInputs( const TArray< FHoudiniGeoPartObject > & Instancers )
 {
+    SCOPE_CYCLE_COUNTER( STAT_CreateInstancers );
+    FHoudiniCookProfileStageScope ProfileStageScope( EHoudiniCookProfileStage::Instancers );
+
     TArray< UHoudiniAssetInstanceInput * > NewInstanceInputs;
 
     for ( const FHoudiniGeoPartObject& GeoPart : Instancers )
@@ -4836,6 +6033,9 @@ UHoudiniAssetComponent::CreateAllLandscapes( const TArray< FHoudiniGeoPartObject
     if ( FoundVolumes.Num() <= 0 )
         return false;
 
+    SCOPE_CYCLE_COUNTER( STAT_CreateLandscapes );
+    FHoudiniCookProfileStageScope ProfileStageScope( EHoudiniCookProfileStage::Landscapes );
+
     // Try to create a Landscape for each HeightData found
     TMap< FHoudiniGeoPartObject, TWeakObjectPtr<ALandscape> > NewLandscapes;
 
@@ -4985,143 +6185,466 @@ void UHoudiniAssetComponent::UpdateLandscapeMaterialsAssignementsAndReplacements
         }
     }
 
-    // Assign the new material if they have been updated
-    if ( Landscape->LandscapeMaterial != LandscapeMaterial )
-        Landscape->LandscapeMaterial = LandscapeMaterial;
+    // Assign the new material if they have been updated
+    if ( Landscape->LandscapeMaterial != LandscapeMaterial )
+        Landscape->LandscapeMaterial = LandscapeMaterial;
+
+    if ( Landscape->LandscapeHoleMaterial != LandscapeHoleMaterial )
+        Landscape->LandscapeHoleMaterial = LandscapeHoleMaterial;
+
+    Landscape->UpdateAllComponentMaterialInstances();
+
+    /*
+    // As UpdateAllComponentMaterialInstances() is not accessible to us, we'll try to access the Material's UProperty 
+    // to trigger a fake Property change event that will call the Update function...
+    UProperty* FoundProperty = FindField< UProperty >(Landscape->GetClass(), (MaterialIdx == 0) ? TEXT("LandscapeMaterial") : TEXT("LandscapeHoleMaterial"));
+    if (FoundProperty)
+    {
+        FPropertyChangedEvent PropChanged(FoundProperty, EPropertyChangeType::ValueSet);
+        Landscape->PostEditChangeProperty(PropChanged);
+    }
+    */
+}
+
+bool
+UHoudiniAssetComponent::ReplaceLandscapeInInputs( ALandscape* Old, ALandscape* New )
+{
+    bool bReturn = false;
+
+    // First, get all the inputs, including the object path parameters
+    TArray< UHoudiniAssetInput * > AllInputs;
+    GetInputs( AllInputs, true );
+
+    // Look for landscape input, selecting the old landscape
+    for ( TArray< UHoudiniAssetInput * >::TIterator IterInputs( AllInputs ); IterInputs; ++IterInputs )
+    {
+        UHoudiniAssetInput * HoudiniAssetInput = *IterInputs;
+        if ( !HoudiniAssetInput || HoudiniAssetInput->IsPendingKill() )
+            continue;
+
+        if ( HoudiniAssetInput->GetChoiceIndex() != EHoudiniAssetInputType::LandscapeInput )
+            continue;
+
+        if ( Old != HoudiniAssetInput->GetLandscapeInput() )
+            continue;
+
+        HoudiniAssetInput->OnLandscapeActorSelected( New );
+        HoudiniAssetInput->UploadParameterValue();
+
+        bReturn = true;
+    }
+
+    return bReturn;
+}
+
+#endif
+
+void
+UHoudiniAssetComponent::ClearInstanceInputs()
+{
+    for ( auto& InstanceInput : InstanceInputs )
+    {
+        if ( InstanceInput && !InstanceInput->IsPendingKill() )
+            InstanceInput->ConditionalBeginDestroy();
+    }
+
+    InstanceInputs.Empty();
+}
+
+void
+UHoudiniAssetComponent::ClearCurves()
+{
+    for ( TMap< FHoudiniGeoPartObject, TWeakObjectPtr <UHoudiniSplineComponent>>::TIterator Iter( SplineComponents ); Iter; ++Iter )
+    {
+        UHoudiniSplineComponent * SplineComponent = Iter.Value().Get();
+        if (SplineComponent)
+        {
+            SplineComponent->DetachFromComponent(FDetachmentTransformRules::KeepRelativeTransform);
+            SplineComponent->UnregisterComponent();
+            SplineComponent->DestroyComponent();
+        }        
+    }
+
+    SplineComponents.Empty();
+}
+
+void
+UHoudiniAssetComponent::ClearLandscapes()
+{
+    for (TMap< FHoudiniGeoPartObject, TWeakObjectPtr<ALandscape> >::TIterator Iter(LandscapeComponents); Iter; ++Iter)
+    {
+        ALandscape * HoudiniLandscape = Iter.Value().Get();
+        if ( !IsValid( HoudiniLandscape ) )
+            continue;
+
+        // Make sure we never destroy an input landscape
+        bool IsCurrentLandscapeAnInput = false;
+        for (auto CurrentInput : Inputs)
+        {
+            if (!CurrentInput)
+                continue;
+
+            if (CurrentInput->GetChoiceIndex() != EHoudiniAssetInputType::Enum::LandscapeInput)
+                continue;
+
+            ALandscape* InputLandscape = CurrentInput->GetLandscapeInput();
+            if (!InputLandscape || InputLandscape->IsPendingKill())
+                continue;
+
+            IsCurrentLandscapeAnInput = true;
+            break;
+        }
+
+        if ( IsCurrentLandscapeAnInput )
+            continue;
+
+        HoudiniLandscape->UnregisterAllComponents();
+        HoudiniLandscape->Destroy();
+    }
+
+    // The layers of the heightfields share their asset, so their ranges are released as well.
+    TSet< HAPI_NodeId > LandscapeAssetIds;
+    for ( const auto & LandscapePair : LandscapeComponents )
+        LandscapeAssetIds.Add( LandscapePair.Key.AssetId );
+
+    FHoudiniLandscapeUtils::ReleaseVolumeZRanges( GetSessionIndex(), LandscapeAssetIds );
+
+    LandscapeComponents.Empty();
+}
+
+void
+UHoudiniAssetComponent::ClearParameters()
+{
+    for ( auto Iter : Parameters )
+    {
+        if ( Iter.Value && !Iter.Value->IsPendingKill() )
+        {
+            Iter.Value->ConditionalBeginDestroy();
+        }
+        else
+        {
+            HOUDINI_LOG_WARNING(TEXT("%s: null parameter when clearing"), *GetOwner()->GetName());
+        }
+    }
+
+    Parameters.Empty();
+    ParameterByName.Empty();
+    DeferredParameters.Empty();
+    ParameterInterfaceHash = 0;
+}
+
+bool
+UHoudiniAssetComponent::HasOnlyStaticMeshOutputs() const
+{
+    // Only static meshes can be restored as they were, instancers, curves and landscapes are rebuilt from the cooked node.
+    if ( bContainsHoudiniLogoGeometry || InstanceInputs.Num() > 0 || LandscapeComponents.Num() > 0 )
+        return false;
+
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( StaticMeshes ); Iter; ++Iter )
+    {
+        const FHoudiniGeoPartObject & HoudiniGeoPartObject = Iter.Key();
+        if ( HoudiniGeoPartObject.IsInstancer() || HoudiniGeoPartObject.IsPackedPrimitiveInstancer()
+            || HoudiniGeoPartObject.IsCurve() || HoudiniGeoPartObject.IsVolume() )
+            return false;
+    }
+
+    return true;
+}
+
+void
+UHoudiniAssetComponent::CapturePresetSnapshot( uint32 PresetHash )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    const int32 CacheSize = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->PresetSnapshotCacheSize : 0;
+    if ( CacheSize <= 0 || !HoudiniAsset || StaticMeshes.Num() <= 0 || !HasOnlyStaticMeshOutputs() )
+        return;
+
+    for ( int32 SnapshotIdx = PresetSnapshots.Num() - 1; SnapshotIdx >= 0; --SnapshotIdx )
+    {
+        if ( PresetSnapshots[ SnapshotIdx ].PresetHash == PresetHash )
+            RemovePresetSnapshot( SnapshotIdx );
+    }
+
+    FHoudiniPresetSnapshot PresetSnapshot;
+    PresetSnapshot.PresetHash = PresetHash;
+    PresetSnapshot.AssetBytesHash = HoudiniAsset->GetAssetBytesHash();
+    PresetSnapshot.StaticMeshes = StaticMeshes;
+    PresetSnapshots.Insert( PresetSnapshot, 0 );
+
+    // Evict the least recently used snapshots.
+    while ( PresetSnapshots.Num() > CacheSize )
+        RemovePresetSnapshot( PresetSnapshots.Num() - 1 );
+}
+
+void
+UHoudiniAssetComponent::RestorePresetSnapshot( const FHoudiniPresetSnapshot & PresetSnapshot )
+{
+    RestoreStaticMeshOutputs( PresetSnapshot.StaticMeshes );
+
+    // Our outputs changed, publish them again for the components cooking the same preset.
+    PublishSharedCookOutputs();
+
+    HOUDINI_LOG_MESSAGE( TEXT( "%s: Restored preset outputs without cooking." ), GetOwner() ? *GetOwner()->GetName() : *GetName() );
+}
+
+void
+UHoudiniAssetComponent::RestoreStaticMeshOutputs( const TMap< FHoudiniGeoPartObject, UStaticMesh * > & InStaticMeshes )
+{
+    // Free the current meshes that are not restored, those kept by snapshots are not deleted.
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > OldStaticMeshes = StaticMeshes;
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( InStaticMeshes ); Iter; ++Iter )
+    {
+        if ( OldStaticMeshes.FindRef( Iter.Key() ) == Iter.Value() )
+            OldStaticMeshes.Remove( Iter.Key() );
+    }
+
+    ReleaseObjectGeoPartResources( OldStaticMeshes, true );
+
+    // Create the components of the restored meshes, as a post cook would.
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > RestoredStaticMeshes = InStaticMeshes;
+    FHoudiniPostCookState RestoreState;
+    BeginObjectGeoPartResources( RestoredStaticMeshes, RestoreState );
+    for ( const FHoudiniGeoPartObject & HoudiniGeoPartObject : RestoreState.MeshParts )
+        CreateObjectGeoPartComponent( HoudiniGeoPartObject, RestoredStaticMeshes.FindRef( HoudiniGeoPartObject ), RestoreState );
+
+    EndObjectGeoPartComponents( RestoredStaticMeshes, RestoreState );
+    FinishObjectGeoPartResources();
+
+#if WITH_EDITOR
+
+    // Parameters are refreshed from the preset, their interface is unchanged.
+    CreateParameters();
+
+    // Downstream assets consume our node's output, they have to cook.
+    if ( bCookingTriggersDownstreamCooks )
+    {
+        for ( TMap< UHoudiniAssetComponent *, TSet< int32 > >::TIterator IterAssets( DownstreamAssetConnections ); IterAssets; ++IterAssets )
+        {
+            UHoudiniAssetComponent * DownstreamAsset = IterAssets.Key();
+            if ( !DownstreamAsset || DownstreamAsset->IsPendingKill() )
+                continue;
+
+            DownstreamAsset->bManualRecookRequested = true;
+            DownstreamAsset->NotifyParameterChanged( nullptr );
+        }
+    }
+
+    UpdateEditorProperties( false );
 
-    if ( Landscape->LandscapeHoleMaterial != LandscapeHoleMaterial )
-        Landscape->LandscapeHoleMaterial = LandscapeHoleMaterial;
+#endif
+}
 
-    Landscape->UpdateAllComponentMaterialInstances();
+/** Components whose outputs can be shared, by the key of the asset content and preset they cooked. Game thread only. **/
+static TMap< uint32, TWeakObjectPtr< UHoudiniAssetComponent > > HoudiniEngineSharedCookOutputs;
 
-    /*
-    // As UpdateAllComponentMaterialInstances() is not accessible to us, we'll try to access the Material's UProperty 
-    // to trigger a fake Property change event that will call the Update function...
-    UProperty* FoundProperty = FindField< UProperty >(Landscape->GetClass(), (MaterialIdx == 0) ? TEXT("LandscapeMaterial") : TEXT("LandscapeHoleMaterial"));
-    if (FoundProperty)
+uint32
+UHoudiniAssetComponent::ComputeSharedCookOutputsKey( FSHAHash & OutHash )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( !HoudiniRuntimeSettings || !HoudiniRuntimeSettings->bShareIdenticalCookOutputs || !HoudiniAsset )
+        return 0;
+
+    if ( !FHoudiniEngineUtils::IsValidNodeId( AssetId ) )
+        return 0;
+
+    // Inputs are not hashed, only the assets cooking from their parameters alone share their outputs.
+    auto IsInputConnected = []( UHoudiniAssetInput * Input )
     {
-        FPropertyChangedEvent PropChanged(FoundProperty, EPropertyChangeType::ValueSet);
-        Landscape->PostEditChangeProperty(PropChanged);
+        return Input && !Input->IsPendingKill()
+            && ( FHoudiniEngineUtils::IsValidNodeId( Input->GetConnectedAssetId() ) || Input->GetConnectedInputAssetComponent() );
+    };
+
+    for ( UHoudiniAssetInput * LocalInput : Inputs )
+    {
+        if ( IsInputConnected( LocalInput ) )
+            return 0;
     }
-    */
+
+    for ( TMap< HAPI_ParmId, UHoudiniAssetParameter * >::TConstIterator IterParams( Parameters ); IterParams; ++IterParams )
+    {
+        if ( IsInputConnected( Cast< UHoudiniAssetInput >( IterParams.Value() ) ) )
+            return 0;
+    }
+
+    // Material replacements are applied to the meshes themselves.
+    if ( HoudiniAssetComponentMaterials && HoudiniAssetComponentMaterials->Replacements.Num() > 0 )
+        return 0;
+
+    FHoudiniScopedSession ScopedSession( SessionIndex );
+
+    TArray< char > CurrentPresetBuffer;
+    if ( !FHoudiniEngineUtils::GetAssetPreset( AssetId, CurrentPresetBuffer ) )
+        return 0;
+
+    // Components sharing a key are only candidates, the full hash tells if they really cooked the same preset.
+    const FString AssetBytesHash = HoudiniAsset->GetAssetBytesHash();
+
+    FSHA1 HashState;
+    HashState.UpdateWithString( *AssetBytesHash, AssetBytesHash.Len() );
+    HashState.Update( (const uint8 *) CurrentPresetBuffer.GetData(), CurrentPresetBuffer.Num() );
+    HashState.Final();
+    HashState.GetHash( OutHash.Hash );
+
+    const uint32 Key = GetTypeHash( OutHash );
+    return Key != 0 ? Key : 1;
+}
+
+void
+UHoudiniAssetComponent::PublishSharedCookOutputs()
+{
+    SharedCookOutputsKey = 0;
+    if ( StaticMeshes.Num() <= 0 || !HasOnlyStaticMeshOutputs() )
+        return;
+
+    SharedCookOutputsKey = ComputeSharedCookOutputsKey( SharedCookOutputsHash );
+    if ( SharedCookOutputsKey != 0 )
+        HoudiniEngineSharedCookOutputs.Add( SharedCookOutputsKey, this );
 }
 
 bool
-UHoudiniAssetComponent::ReplaceLandscapeInInputs( ALandscape* Old, ALandscape* New )
+UHoudiniAssetComponent::RestoreSharedCookOutputs()
 {
-    bool bReturn = false;
+    // An explicit recook always cooks, and our current outputs have to be replaced entirely by the shared meshes.
+    if ( bManualRecookRequested || !HasOnlyStaticMeshOutputs() )
+        return false;
 
-    // First, get all the inputs, including the object path parameters
-    TArray< UHoudiniAssetInput * > AllInputs;
-    GetInputs( AllInputs, true );
+    FSHAHash Hash;
+    const uint32 Key = ComputeSharedCookOutputsKey( Hash );
+    if ( Key == 0 )
+        return false;
 
-    // Look for landscape input, selecting the old landscape
-    for ( TArray< UHoudiniAssetInput * >::TIterator IterInputs( AllInputs ); IterInputs; ++IterInputs )
+    // The source component must still hold the outputs it published for this key.
+    UHoudiniAssetComponent * SourceComponent = HoudiniEngineSharedCookOutputs.FindRef( Key ).Get();
+    if ( !SourceComponent || SourceComponent == this || SourceComponent->IsPendingKill()
+        || SourceComponent->SharedCookOutputsKey != Key || SourceComponent->SharedCookOutputsHash != Hash
+        || SourceComponent->HoudiniAsset != HoudiniAsset
+        || SourceComponent->IsInstantiatingOrCooking() || SourceComponent->IsPostCookInProgress()
+        || !SourceComponent->HasOnlyStaticMeshOutputs() || !HasSameGeneratedStaticMeshSettings( SourceComponent ) )
     {
-        UHoudiniAssetInput * HoudiniAssetInput = *IterInputs;
-        if ( !HoudiniAssetInput || HoudiniAssetInput->IsPendingKill() )
-            continue;
-
-        if ( HoudiniAssetInput->GetChoiceIndex() != EHoudiniAssetInputType::LandscapeInput )
-            continue;
+        return false;
+    }
 
-        if ( Old != HoudiniAssetInput->GetLandscapeInput() )
+    // We share the geometry of the source component, both components get their own meshes on their next cook or edit.
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > SourceStaticMeshes;
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( SourceComponent->StaticMeshes ); Iter; ++Iter )
+    {
+        UStaticMesh * StaticMesh = Iter.Value();
+        if ( !StaticMesh || StaticMesh->IsPendingKill() )
             continue;
 
-        HoudiniAssetInput->OnLandscapeActorSelected( New );
-        HoudiniAssetInput->UploadParameterValue();
-
-        bReturn = true;
+        SourceStaticMeshes.Add( FHoudiniGeoPartObject( Iter.Key(), true ), StaticMesh );
+        SharedStaticMeshes.Add( StaticMesh );
+        SourceComponent->SharedStaticMeshes.Add( StaticMesh );
     }
 
-    return bReturn;
-}
-
-#endif
+    if ( SourceStaticMeshes.Num() <= 0 )
+        return false;
 
-void
-UHoudiniAssetComponent::ClearInstanceInputs()
-{
-    for ( auto& InstanceInput : InstanceInputs )
+    // Copy material information.
+    if ( SourceComponent->HoudiniAssetComponentMaterials )
     {
-        if ( InstanceInput && !InstanceInput->IsPendingKill() )
-            InstanceInput->ConditionalBeginDestroy();
+        TMap< UObject *, UObject * > ReplacementMap;
+        HoudiniAssetComponentMaterials = SourceComponent->HoudiniAssetComponentMaterials->Duplicate( this, ReplacementMap );
     }
 
-    InstanceInputs.Empty();
-}
-
-void
-UHoudiniAssetComponent::ClearCurves()
-{
-    for ( TMap< FHoudiniGeoPartObject, TWeakObjectPtr <UHoudiniSplineComponent>>::TIterator Iter( SplineComponents ); Iter; ++Iter )
+    // A first cook also creates our parameters, inputs and handles from the node.
+    if ( AssetCookCount == 0 )
     {
-        UHoudiniSplineComponent * SplineComponent = Iter.Value().Get();
-        if (SplineComponent)
-        {
-            SplineComponent->DetachFromComponent(FDetachmentTransformRules::KeepRelativeTransform);
-            SplineComponent->UnregisterComponent();
-            SplineComponent->DestroyComponent();
-        }        
+        CreateParameters();
+        CreateInputs();
+        CreateHandles();
     }
 
-    SplineComponents.Empty();
+    UnmarkChangedParameters();
+    RestoreStaticMeshOutputs( SourceStaticMeshes );
+
+    AssetCookCount = FMath::Max( AssetCookCount, 1 );
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "%s: Shared the outputs of %s without cooking." ), GetOwner() ? *GetOwner()->GetName() : *GetName(),
+        SourceComponent->GetOwner() ? *SourceComponent->GetOwner()->GetName() : *SourceComponent->GetName() );
+
+    return true;
 }
 
-void
-UHoudiniAssetComponent::ClearLandscapes()
+bool
+UHoudiniAssetComponent::HasSameGeneratedStaticMeshSettings( const UHoudiniAssetComponent * Other ) const
 {
-    for (TMap< FHoudiniGeoPartObject, TWeakObjectPtr<ALandscape> >::TIterator Iter(LandscapeComponents); Iter; ++Iter)
-    {
-        ALandscape * HoudiniLandscape = Iter.Value().Get();
-        if ( !IsValid( HoudiniLandscape ) )
-            continue;
+    if ( !Other )
+        return false;
 
-        // Make sure we never destroy an input landscape
-        bool IsCurrentLandscapeAnInput = false;
-        for (auto CurrentInput : Inputs)
-        {
-            if (!CurrentInput)
-                continue;
+    // Instanced settings objects belong to each component, they cannot be compared.
+    if ( GeneratedFoliageDefaultSettings || Other->GeneratedFoliageDefaultSettings
+        || GeneratedAssetUserData.Num() > 0 || Other->GeneratedAssetUserData.Num() > 0 )
+        return false;
 
-            if (CurrentInput->GetChoiceIndex() != EHoudiniAssetInputType::Enum::LandscapeInput)
-                continue;
+    return bGeneratedDoubleSidedGeometry == Other->bGeneratedDoubleSidedGeometry
+        && GeneratedPhysMaterial == Other->GeneratedPhysMaterial
+        && FBodyInstance::StaticStruct()->CompareScriptStruct( &DefaultBodyInstance, &Other->DefaultBodyInstance, PPF_None )
+        && GeneratedCollisionTraceFlag == Other->GeneratedCollisionTraceFlag
+        && GeneratedLightMapResolution == Other->GeneratedLightMapResolution
+        && GeneratedLpvBiasMultiplier == Other->GeneratedLpvBiasMultiplier
+        && GeneratedDistanceFieldResolutionScale == Other->GeneratedDistanceFieldResolutionScale
+        && GeneratedAutoLODTriangleBudget == Other->GeneratedAutoLODTriangleBudget
+        && FWalkableSlopeOverride::StaticStruct()->CompareScriptStruct(
+            &GeneratedWalkableSlopeOverride, &Other->GeneratedWalkableSlopeOverride, PPF_None )
+        && GeneratedLightMapCoordinateIndex == Other->GeneratedLightMapCoordinateIndex
+        && bGeneratedUseMaximumStreamingTexelRatio == Other->bGeneratedUseMaximumStreamingTexelRatio
+        && GeneratedStreamingDistanceMultiplier == Other->GeneratedStreamingDistanceMultiplier
+        && GeneratedGeometryScaleFactor == Other->GeneratedGeometryScaleFactor
+        && TransformScaleFactor == Other->TransformScaleFactor
+        && ImportAxis == Other->ImportAxis;
+}
 
-            ALandscape* InputLandscape = CurrentInput->GetLandscapeInput();
-            if (!InputLandscape || InputLandscape->IsPendingKill())
-                continue;
+void
+UHoudiniAssetComponent::RemovePresetSnapshot( int32 SnapshotIdx )
+{
+    if ( !PresetSnapshots.IsValidIndex( SnapshotIdx ) )
+        return;
 
-            IsCurrentLandscapeAnInput = true;
-            break;
-        }
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > SnapshotStaticMeshes = PresetSnapshots[ SnapshotIdx ].StaticMeshes;
+    PresetSnapshots.RemoveAt( SnapshotIdx );
 
-        if ( IsCurrentLandscapeAnInput )
+    // Only delete the meshes that are neither current outputs nor kept by another snapshot.
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > UnusedStaticMeshes;
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( SnapshotStaticMeshes ); Iter; ++Iter )
+    {
+        UStaticMesh * StaticMesh = Iter.Value();
+        if ( !StaticMesh || StaticMesh->IsPendingKill() || StaticMeshComponents.Contains( StaticMesh ) )
             continue;
 
-        HoudiniLandscape->UnregisterAllComponents();
-        HoudiniLandscape->Destroy();
+        bool bUsed = false;
+        for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator IterCurrent( StaticMeshes ); IterCurrent && !bUsed; ++IterCurrent )
+            bUsed = ( IterCurrent.Value() == StaticMesh );
+
+        if ( !bUsed && !IsStaticMeshInPresetSnapshots( StaticMesh ) )
+            UnusedStaticMeshes.Add( Iter.Key(), StaticMesh );
     }
 
-    LandscapeComponents.Empty();
+    if ( UnusedStaticMeshes.Num() > 0 )
+        ReleaseObjectGeoPartResources( UnusedStaticMeshes, true );
 }
 
 void
-UHoudiniAssetComponent::ClearParameters()
+UHoudiniAssetComponent::ClearPresetSnapshots()
 {
-    for ( auto Iter : Parameters )
+    while ( PresetSnapshots.Num() > 0 )
+        RemovePresetSnapshot( PresetSnapshots.Num() - 1 );
+}
+
+bool
+UHoudiniAssetComponent::IsStaticMeshInPresetSnapshots( const UStaticMesh * StaticMesh ) const
+{
+    for ( const FHoudiniPresetSnapshot & PresetSnapshot : PresetSnapshots )
     {
-        if ( Iter.Value && !Iter.Value->IsPendingKill() )
-        {
-            Iter.Value->ConditionalBeginDestroy();
-        }
-        else
+        for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( PresetSnapshot.StaticMeshes ); Iter; ++Iter )
         {
-            HOUDINI_LOG_WARNING(TEXT("%s: null parameter when clearing"), *GetOwner()->GetName());
+            if ( Iter.Value() == StaticMesh )
+                return true;
         }
     }
 
-    Parameters.Empty();
-    ParameterByName.Empty();
+    return false;
 }
 
 void
@@ -5203,6 +6726,17 @@ UHoudiniAssetComponent::ClearDownstreamAssets()
 void
 UHoudiniAssetComponent::ClearCookTempFile()
 {
+    auto ReleasePackage = []( UPackage * Package )
+    {
+#if WITH_EDITOR
+        // The temporary packages are destroyed in a batch once cooking is done.
+        FHoudiniEngine::Get().GetTempPackageCleanup().AddPackage( Package );
+#else
+        Package->ClearFlags( RF_Standalone );
+        Package->ConditionalBeginDestroy();
+#endif
+    };
+
     // First, Clean up the assignement/replacement map
     if ( HoudiniAssetComponentMaterials && !HoudiniAssetComponentMaterials->IsPendingKill() )
         HoudiniAssetComponentMaterials->ResetMaterialInfo();
@@ -5212,13 +6746,11 @@ UHoudiniAssetComponent::ClearCookTempFile()
         IterPackage; ++IterPackage)
     {
         UPackage * Package = IterPackage.Value().Get();
-        if ( !Package )
-            continue;
-
-        Package->ClearFlags( RF_Standalone );
-        Package->ConditionalBeginDestroy();
+        if ( Package )
+            ReleasePackage( Package );
     }
 
+    FHoudiniEngineMaterialUtils::InvalidateGeneratedTextureIndex( CookedTemporaryPackages );
     CookedTemporaryPackages.Empty();
 
     // Delete all cooked Static Meshes
@@ -5226,11 +6758,8 @@ UHoudiniAssetComponent::ClearCookTempFile()
         IterPackage; ++IterPackage )
     {
         UPackage * Package = IterPackage.Value().Get();
-        if ( !Package )
-            continue;
-
-        Package->ClearFlags( RF_Standalone );
-        Package->ConditionalBeginDestroy();
+        if ( Package )
+            ReleasePackage( Package );
     }
 
     CookedTemporaryStaticMeshPackages.Empty();
@@ -5240,11 +6769,8 @@ UHoudiniAssetComponent::ClearCookTempFile()
         IterPackage; ++IterPackage )
     {
         UPackage * Package = IterPackage.Key().Get();
-        if ( !Package )
-            continue;
-
-        Package->ClearFlags( RF_Standalone );
-        Package->ConditionalBeginDestroy();
+        if ( Package )
+            ReleasePackage( Package );
     }
 
     CookedTemporaryLandscapeLayers.Empty();
@@ -5432,9 +6958,25 @@ UHoudiniAssetComponent::SerializeInstanceInputs( FArchive & Ar )
     }
 }
 
-void
+bool
 UHoudiniAssetComponent::SerializeParameters( FArchive & Ar )
 {
+    // The compact format only keeps the parameters the preset can't restore, the others are stored by name and
+    // recreated from the asset once it is instantiated. Transactions always keep the full parameter objects.
+    bool bCompactParameters = false;
+    int32 HoudiniAssetComponentVersion = GetLinkerCustomVersion( FHoudiniCustomSerializationVersion::GUID );
+    if ( HoudiniAssetComponentVersion >= VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_COMPACT_PARAMETERS )
+    {
+        if ( Ar.IsSaving() )
+        {
+            const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+            bCompactParameters = !Ar.IsTransacting()
+                && HoudiniRuntimeSettings && HoudiniRuntimeSettings->bCompactParameterSerialization;
+        }
+
+        Ar << bCompactParameters;
+    }
+
     // We have to make sure that parameter are NOT saaved with an empty name, as this will cause UE to crash on load
     for (TMap< HAPI_ParmId, UHoudiniAssetParameter * >::TIterator IterParams(Parameters); IterParams; ++IterParams)
     {
@@ -5449,7 +6991,53 @@ UHoudiniAssetComponent::SerializeParameters( FArchive & Ar )
         HoudiniAssetParameter->Rename();
     }
 
-    Ar << Parameters;
+    if ( bCompactParameters )
+    {
+        if ( Ar.IsSaving() )
+        {
+            // Only inputs reference objects the preset can't restore, everything else is kept as an interned name.
+            TMap< HAPI_ParmId, UHoudiniAssetParameter * > KeptParameters;
+            TMap< FString, UHoudiniAssetParameter * > KeptParameterByName;
+            TMap< FString, HAPI_ParmId > ParameterNames = DeferredParameters;
+            for ( const auto & ParmPair : Parameters )
+            {
+                UHoudiniAssetParameter * HoudiniAssetParameter = ParmPair.Value;
+                if ( !HoudiniAssetParameter || HoudiniAssetParameter->IsPendingKill() )
+                    continue;
+
+                if ( HoudiniAssetParameter->IsA( UHoudiniAssetInput::StaticClass() ) )
+                {
+                    KeptParameters.Add( ParmPair.Key, HoudiniAssetParameter );
+                    KeptParameterByName.Add( HoudiniAssetParameter->GetParameterName(), HoudiniAssetParameter );
+                }
+                else
+                {
+                    ParameterNames.Add( HoudiniAssetParameter->GetParameterName(), ParmPair.Key );
+                }
+            }
+
+            Ar << KeptParameters;
+            Ar << KeptParameterByName;
+            Ar << ParameterNames;
+        }
+        else
+        {
+            // Named parameters are recreated on demand, the same way as the ones of inactive folder tabs.
+            Ar << Parameters;
+            Ar << ParameterByName;
+            Ar << DeferredParameters;
+        }
+    }
+    else
+    {
+        Ar << Parameters;
+    }
+
+    // Loaded or restored parameters have to be reconciled with the asset's parameters again.
+    if ( Ar.IsLoading() )
+        ParameterInterfaceHash = 0;
+
+    return bCompactParameters;
 }
 
 void
@@ -6206,18 +7794,49 @@ UHoudiniAssetComponent::CreateSceneProxy()
 
             FHoudiniAssetSceneProxy( const UHoudiniAssetComponent* InComponent )
                 : FPrimitiveSceneProxy( InComponent )
+                , PreviewPoints( InComponent->CookPreviewPoints )
+                , PreviewBounds( InComponent->CookPreviewBounds )
+            {
+            }
+
+            virtual void GetDynamicMeshElements(
+                const TArray< const FSceneView * > & Views, const FSceneViewFamily & ViewFamily,
+                uint32 VisibilityMap, FMeshElementCollector & Collector ) const override
             {
+                static const FLinearColor PreviewColor( 1.0f, 0.5f, 0.0f );
+                static const float PreviewPointSize = 2.0f;
+
+                const FMatrix & LocalToWorld = GetLocalToWorld();
+                for ( int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex )
+                {
+                    if ( !( VisibilityMap & ( 1 << ViewIndex ) ) )
+                        continue;
+
+                    FPrimitiveDrawInterface * PDI = Collector.GetPDI( ViewIndex );
+                    DrawWireBox( PDI, LocalToWorld, PreviewBounds, PreviewColor, SDPG_World );
+
+                    for ( const FVector & PreviewPoint : PreviewPoints )
+                        PDI->DrawPoint( LocalToWorld.TransformPosition( PreviewPoint ), PreviewColor, PreviewPointSize, SDPG_World );
+                }
             }
 
             virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override
             {
                 FPrimitiveViewRelevance Result;
                 Result.bDrawRelevance = IsShown( View );
+
+                // Only the preview of the cooked geometry is drawn by this proxy.
+                Result.bDynamicRelevance = PreviewBounds.IsValid != 0;
                 return Result;
             }
 
             virtual uint32 GetMemoryFootprint( void ) const override { return( sizeof( *this ) + GetAllocatedSize() ); }
-            uint32 GetAllocatedSize( void ) const { return( FPrimitiveSceneProxy::GetAllocatedSize() ); }
+            uint32 GetAllocatedSize( void ) const { return( FPrimitiveSceneProxy::GetAllocatedSize() + PreviewPoints.GetAllocatedSize() ); }
+
+        private:
+
+            TArray< FVector > PreviewPoints;
+            FBox PreviewBounds;
     };
 
     return new FHoudiniAssetSceneProxy( this );
@@ -6249,6 +7868,49 @@ UHoudiniAssetComponent::NotifyAssetNeedsToBeReinstantiated()
     }
 }
 
+void
+UHoudiniAssetComponent::NotifyAssetNeedsToBeRecovered()
+{
+    if ( IsStaticPIEContainer() )
+        return;
+
+    // Our node was never created in the lost session, the saved outputs are still what we display.
+    if ( bTrustingSerializedOutputs && !FHoudiniEngineUtils::IsValidNodeId( AssetId ) && !bAssetIsBeingInstantiated )
+        return;
+
+    // Without a cached state, the asset is reinstantiated and cooked as usual.
+    if ( RecoveryPresetBuffer.Num() <= 0 || !HoudiniAsset )
+    {
+        NotifyAssetNeedsToBeReinstantiated();
+        return;
+    }
+
+    bLoadedComponentRequiresInstantiation = true;
+    bLoadedComponent = true;
+    bFullyLoaded = false;
+    AssetCookCount = 0;
+    AssetId = -1;
+
+    // Our input nodes have to be created again in the new session.
+    for ( TArray< UHoudiniAssetInput * >::TIterator IterInputs( Inputs ); IterInputs; ++IterInputs )
+    {
+        UHoudiniAssetInput * HoudiniAssetInput = *IterInputs;
+        if ( HoudiniAssetInput && !HoudiniAssetInput->IsPendingKill() )
+            HoudiniAssetInput->MarkChanged( false );
+    }
+
+    // The cached preset restores all the parameters, they do not need to be uploaded one by one.
+    PresetBuffer = RecoveryPresetBuffer;
+
+    // Our outputs are still those of the cached state, unless the asset has been reimported since.
+    bRecoveryOutputsValid = ( RecoveryAssetBytesHash == HoudiniAsset->GetAssetBytesHash() );
+    bRecoveringSession = true;
+
+#if WITH_EDITOR
+    StartHoudiniTicking();
+#endif
+}
+
 void
 UHoudiniAssetComponent::UpdateMobility()
 {
@@ -6260,12 +7922,16 @@ UHoudiniAssetComponent::UpdateMobility()
     else
     {
         // If one of the children we created is movable, we need to set ourselves to movable as well
-        const auto & LocalAttachChildren = GetAttachChildren();
-        for (TArray< USceneComponent * >::TConstIterator Iter(LocalAttachChildren); Iter; ++Iter)
+        if ( Mobility == EComponentMobility::Movable )
+            return;
+
+        for ( USceneComponent * SceneComponent : GetAttachChildren() )
         {
-            USceneComponent * SceneComponent = *Iter;
-            if (SceneComponent->Mobility == EComponentMobility::Movable)
-                SetMobility(EComponentMobility::Movable);
+            if ( SceneComponent && SceneComponent->Mobility == EComponentMobility::Movable )
+            {
+                SetMobility( EComponentMobility::Movable );
+                break;
+            }
         }
     }
 }
@@ -27,10 +27,13 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniCookHandler.h"
+#include "HoudiniCookProfile.h"
+#include "HoudiniLoadProfile.h"
 
 #include "CoreMinimal.h"
 #include "Landscape.h"
 #include "TimerManager.h"
+#include "Misc/SecureHash.h"
 #include "Components/PrimitiveComponent.h"
 #if WITH_EDITOR
 #include "Factories/Factory.h"
@@ -58,6 +61,8 @@ class UHoudiniAssetComponentMaterials;
 class UFoliageType_InstancedStaticMesh;
 
 struct FTransform;
+struct FHoudiniEngineTask;
+struct FHoudiniOutputMemoryUsage;
 struct FPropertyChangedEvent;
 struct FWalkableSlopeOverride;
 
@@ -87,6 +92,183 @@ namespace EHoudiniAssetComponentState
     };
 }
 
+namespace EHoudiniPostCookStage
+{
+    /** Stages of the post cook processing, they can be spread over several frames. **/
+    enum Type
+    {
+        None,
+        Parameters,
+        StaticMeshes,
+        Components,
+        Instancers,
+        Curves,
+        Landscapes,
+        Materials,
+        Downstream
+    };
+}
+
+/** Components edited together in the details panel, parameter changes on one of them are applied to all. **/
+struct FHoudiniMultiEditGroup
+{
+    FHoudiniMultiEditGroup();
+
+    TArray< TWeakObjectPtr< UHoudiniAssetComponent > > Components;
+
+    /** Set while a change is being applied to the other components of the group. **/
+    bool bPropagatingChange;
+};
+
+/** State of the post cook processing, kept between frames when post cook is time sliced. **/
+struct FHoudiniPostCookState
+{
+    FHoudiniPostCookState();
+
+    /** Reset to the initial state. **/
+    void Reset();
+
+    /** Stage to execute next. **/
+    EHoudiniPostCookStage::Type Stage;
+
+    /** Static meshes generated by the cook. **/
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > NewStaticMeshes;
+
+    /** Parts requiring a static mesh component, and the next one to process. **/
+    TArray< FHoudiniGeoPartObject > MeshParts;
+    int32 NextMeshPart;
+
+    /** Instancer, curve and volume parts, processed after all meshes. **/
+    TArray< FHoudiniGeoPartObject > Instancers;
+    TArray< FHoudiniGeoPartObject > Curves;
+    TArray< FHoudiniGeoPartObject > Volumes;
+
+    /** Parts which have a mesh and a component, but are no longer visible. **/
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > StaleParts;
+
+    /** Components created by the post cook, registered together once they are fully set up. **/
+    TArray< UStaticMeshComponent * > PendingRegistrations;
+
+    /** Is set to true when the output of the asset has changed, and downstream assets need to cook. **/
+    bool bOutputChanged;
+
+    /** Actors of the world by name and label, indexed on first use to attach actors to mesh sockets. **/
+    TMultiMap< FString, TWeakObjectPtr< AActor > > SocketActorsByName;
+    bool bSocketActorsIndexed;
+};
+
+/** Timings and HAPI traffic of the last cook of a component. **/
+USTRUCT( BlueprintType )
+struct HOUDINIENGINERUNTIME_API FHoudiniCookMetrics
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** Return a one line summary of the metrics, used by the log and notifications. **/
+    FString ToString() const;
+
+    /** Time in seconds the cook request waited in the scheduler queue. **/
+    UPROPERTY( BlueprintReadOnly, Category = HoudiniAsset )
+    float QueueSeconds = 0.0f;
+
+    /** Time in seconds spent cooking in Houdini Engine. **/
+    UPROPERTY( BlueprintReadOnly, Category = HoudiniAsset )
+    float CookSeconds = 0.0f;
+
+    /** Time in seconds spent creating the outputs from the cook results. **/
+    UPROPERTY( BlueprintReadOnly, Category = HoudiniAsset )
+    float PostCookSeconds = 0.0f;
+
+    /** Number of HAPI calls made by the cook, only counted while HAPI tracing is enabled. **/
+    UPROPERTY( BlueprintReadOnly, Category = HoudiniAsset )
+    int32 HapiCallCount = 0;
+
+    /** Megabytes transferred by the HAPI calls of the cook, only counted while HAPI tracing is enabled. **/
+    UPROPERTY( BlueprintReadOnly, Category = HoudiniAsset )
+    float HapiMegabytes = 0.0f;
+};
+
+/** Outputs of the asset cooked with a given preset, restored when switching back to that preset. **/
+struct FHoudiniPresetSnapshot
+{
+    /** Hash of the preset buffer the outputs were cooked with. **/
+    uint32 PresetHash = 0;
+
+    /** Content hash of the Houdini asset the outputs were cooked from. **/
+    FString AssetBytesHash;
+
+    /** Cooked static meshes. **/
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > StaticMeshes;
+};
+
+/** Geo parts of a component archive, written once and referenced by index from the output maps. **/
+struct FHoudiniGeoPartTable
+{
+    /** Add a part if it is not in the table yet, returns its index. **/
+    int32 Add( const FHoudiniGeoPartObject & GeoPartObject );
+
+    /** Serialize the parts of the table. **/
+    void Serialize( FArchive & Ar );
+
+    /** Serialize a map keyed by parts of the table as a map keyed by their index. **/
+    template< typename ValueType >
+    void SerializeKeys( FArchive & Ar, TMap< FHoudiniGeoPartObject, ValueType > & Map ) const
+    {
+        TMap< int32, ValueType > IndexedMap;
+        if ( Ar.IsSaving() )
+        {
+            for ( const auto & Pair : Map )
+            {
+                const int32 * Index = PartIndices.Find( Pair.Key );
+                if ( Index )
+                    IndexedMap.Add( *Index, Pair.Value );
+            }
+        }
+
+        Ar << IndexedMap;
+
+        if ( Ar.IsLoading() )
+        {
+            Map.Empty( IndexedMap.Num() );
+            for ( const auto & Pair : IndexedMap )
+            {
+                if ( Parts.IsValidIndex( Pair.Key ) )
+                    Map.Add( Parts[ Pair.Key ], Pair.Value );
+            }
+        }
+    }
+
+    /** Serialize a map whose values are parts of the table as a map of their index. **/
+    template< typename KeyType >
+    void SerializeValues( FArchive & Ar, TMap< KeyType, FHoudiniGeoPartObject > & Map ) const
+    {
+        TMap< KeyType, int32 > IndexedMap;
+        if ( Ar.IsSaving() )
+        {
+            for ( const auto & Pair : Map )
+            {
+                const int32 * Index = PartIndices.Find( Pair.Value );
+                if ( Index )
+                    IndexedMap.Add( Pair.Key, *Index );
+            }
+        }
+
+        Ar << IndexedMap;
+
+        if ( Ar.IsLoading() )
+        {
+            Map.Empty( IndexedMap.Num() );
+            for ( const auto & Pair : IndexedMap )
+            {
+                if ( Parts.IsValidIndex( Pair.Value ) )
+                    Map.Add( Pair.Key, Parts[ Pair.Value ] );
+            }
+        }
+    }
+
+    TArray< FHoudiniGeoPartObject > Parts;
+    TMap< FHoudiniGeoPartObject, int32 > PartIndices;
+};
+
 
 UCLASS( ClassGroup = (Rendering, Common), hidecategories = (Object,Activation,"Components|Activation"),
     ShowCategories = (Mobility), editinlinenew )
@@ -152,6 +334,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetComponent : public UPrimitiveCompone
             meta = (DisplayName = "Distance Field Resolution Scale", UIMin = "0.0", UIMax = "100.0"))
             float GeneratedDistanceFieldResolutionScale;
 
+        /** Meshes with more triangles than this get a chain of reduced LODs generated at build time, 0 disables it. **/
+        UPROPERTY( EditAnywhere,
+            Category = HoudiniGeneratedStaticMeshSettings,
+            meta = ( DisplayName = "Auto LOD Triangle Budget", ClampMin = "0" ) )
+        int32 GeneratedAutoLODTriangleBudget;
+
         /** Custom walkable slope setting for generated mesh's body. */
         UPROPERTY( EditAnywhere, AdvancedDisplay,
             Category = HoudiniGeneratedStaticMeshSettings,
@@ -216,6 +404,12 @@ public:
         /** Return true if this component has no cooking or instantiation in progress. **/
         bool IsInstantiatingOrCooking() const;
 
+        /** Return the GUID of the task in progress, invalid if there is none. **/
+        const FGuid & GetHapiGUID() const;
+
+        /** Return true if a time sliced post cook is waiting to be resumed. **/
+        bool IsPostCookInProgress() const;
+
         /** Return true if this component's asset has been instantiated, but not cooked. **/
         bool HasBeenInstantiatedButNotCooked() const;
 
@@ -232,6 +426,15 @@ public:
         /** Callback used by parameters to notify component about their changes. **/
         void NotifyParameterChanged( UHoudiniAssetParameter * HoudiniAssetParameter );
 
+        /** Set the group of components edited together with this one, null when edited alone. **/
+        void SetMultiEditGroup( const TSharedPtr< FHoudiniMultiEditGroup > & InMultiEditGroup );
+
+        /** Apply a changed parameter's value to the same parameter of the other components of the multi-edit group. **/
+        void PropagateParameterChange( UHoudiniAssetParameter * HoudiniAssetParameter );
+
+        /** Create the parameters of the folder tabs that have been activated since the last build. **/
+        void CreateDeferredParameters();
+
         /** Notification used by spline visualizer to notify main Houdini asset component about spline change. **/
         void NotifyHoudiniSplineChanged( UHoudiniSplineComponent * HoudiniSplineComponent );
 
@@ -241,14 +444,25 @@ public:
         /** Return true if cooking is enabled for this component. **/
         bool IsCookingEnabled() const;
 
+        /** Only cook the asset in Houdini for its downstream assets, without generating meshes, materials or landscapes. **/
+        /** Changing the mode recooks the asset.                                                                         **/
+        void SetPassThroughOnly( bool bInPassThroughOnly );
+
         /** Start asset instantiation task. **/
         void StartTaskAssetInstantiation( bool bLoadedComponent = false, bool bStartTicking = false );
 
+        /** Start the instantiation tasks of newly placed components, all tasks are submitted at once. **/
+        static void StartTaskAssetInstantiations(
+            const TArray< UHoudiniAssetComponent * > & HoudiniAssetComponents, bool bStartTicking = false );
+
         /** Start manual asset cooking task. **/
         void StartTaskAssetCookingManual();
 
         /** Start manual asset rebuild task. **/
         void StartTaskAssetRebuildManual();
+
+        /** Apply a preset to the asset. The outputs of a recently cooked preset are restored without cooking. **/
+        bool ApplyPreset( const TArray< char > & InPresetBuffer );
 #endif
 
         /** Used to differentiate native components from dynamic ones. **/
@@ -264,12 +478,34 @@ public:
         /** Return true if asset id is valid. **/
         bool HasValidAssetId() const;
 
+        /** Return the time spent in each stage of the last cook. **/
+        const FHoudiniCookProfile & GetCookProfile() const;
+
+        /** Return the time spent in each phase of the loading of this component. **/
+        const FHoudiniLoadProfile & GetLoadProfile() const;
+
+        /** Return the timings and HAPI traffic of the last cook. **/
+        UFUNCTION( BlueprintCallable, Category = HoudiniAsset )
+        FHoudiniCookMetrics GetLastCookMetrics() const;
+
+        /** Add the memory used by the cooked outputs of this component to the given usage. **/
+        void GetOutputMemoryUsage( FHoudiniOutputMemoryUsage & MemoryUsage ) const;
+
+        /** Return the index of the pooled session owning this asset's node. **/
+        int32 GetSessionIndex() const;
+
         /** Returns true if the asset is valid for cook/bake **/
         bool IsComponentValid() const;
 
         /** Invalidates the assets, causing it to be reinstantiated upon recook **/
         void NotifyAssetNeedsToBeReinstantiated();
 
+        /** Invalidates the asset after its session has been lost, it is restored from its cached state once visible or selected. **/
+        void NotifyAssetNeedsToBeRecovered();
+
+        /** Deletes the asset and its input nodes from its session, it is instantiated again in the session picked for it. **/
+        void NotifyAssetNeedsToChangeSession();
+
         /** Return current referenced Houdini asset. **/
         UHoudiniAsset * GetHoudiniAsset() const;
 
@@ -328,6 +564,9 @@ public:
         /** Return true if this component is in playmode. **/
         bool IsPIEActive() const;
 
+        /** Return true if this component belongs to a PIE world and only holds its outputs, without any processing. **/
+        bool IsStaticPIEContainer() const;
+
         /** Return component GUID. **/
         const FGuid& GetComponentGuid() const;
 
@@ -358,6 +597,14 @@ public:
             const FHoudiniGeoPartObject & HoudiniGeoPartObject, class UMaterialInterface * NewMaterialInterface,
             class UMaterialInterface * OldMaterialInterface, int32 MaterialIndex );
 
+#if WITH_EDITOR
+        /** Give this component its own copy of a static mesh it still shares with a copied component, and return it. **/
+        UStaticMesh * UnshareStaticMesh( UStaticMesh * StaticMesh );
+
+        /** Give this component its own copy of all static meshes it still shares with a copied component. **/
+        void UnshareStaticMeshes();
+#endif
+
         /** Remove material replacement. **/
         void RemoveReplacementMaterial( const FHoudiniGeoPartObject & HoudiniGeoPartObject, const FString & MaterialName );
 
@@ -370,8 +617,8 @@ public:
         /** Collect all parameters of a given type. **/
         void CollectAllParametersOfType( UClass * ParameterClass, TMap< FString, UHoudiniAssetParameter * > & ClassParameters ) const;
 
-        /** Locate parameter by name. **/
-        UHoudiniAssetParameter * FindParameter( const FString & ParameterName ) const;
+        /** Locate parameter by name, creating it if it belongs to an inactive folder tab. **/
+        UHoudiniAssetParameter * FindParameter( const FString & ParameterName );
 
         FORCEINLINE const TArray< UHoudiniAssetInput* >& GetInputs() const { return Inputs; }
 
@@ -392,6 +639,38 @@ public:
         /** Is the asset still waiting for upstream asset to finish instantiating **/
         bool UpdateWaitingForUpstreamAssetsToInstantiate( bool bNotifyUpstreamAsset = false );
 
+        /** Pick the pooled session to instantiate in, chained assets all live in the main session. **/
+        /** BatchedTaskCounts holds the tasks per session of a batch which have not been queued yet. **/
+        int32 PickSessionIndex( const TMap< int32, int32 > * BatchedTaskCounts = nullptr ) const;
+
+        /** Return the index of the asset to instantiate, asks the user if the library contains multiple assets. **/
+        int32 PickAssetNameIndex( const TArray< HAPI_StringHandle > & AssetNames ) const;
+
+        /** Create the instantiation task of the given asset, a new request GUID is assigned. **/
+        FHoudiniEngineTask CreateAssetInstantiationTask(
+            bool bLocalLoadedComponent, HAPI_AssetLibraryId AssetLibraryId, HAPI_StringHandle AssetHapiName );
+
+        /** Collect the asset components connected to our asset inputs. **/
+        void GetUpstreamAssetComponents( TArray< UHoudiniAssetComponent * > & OutUpstreamAssetComponents ) const;
+
+        /** Return true if this asset has a cook in progress, or changes waiting to be cooked. **/
+        bool HasPendingCook() const;
+
+        /** Return true if one of our upstream assets still has to cook, we cook once after all of them. **/
+        bool IsWaitingForUpstreamAssetsToCook() const;
+
+        /** Remember the state we last cooked, so that it can be restored if the session is lost. **/
+        void CacheRecoveryState();
+
+        /** Return true if our actor has been rendered recently or is selected. **/
+        bool IsVisibleOrSelected() const;
+
+        /** Return the sort key of our load time tasks: selected assets first, then by distance to the viewport camera. **/
+        float GetLoadTaskSortKey() const;
+
+        /** Return true if outputs were serialized with this component, other than the Houdini logo. **/
+        bool HasSerializedOutputs() const;
+
         /** Updates the HAC's mobility depending on its children's mobility **/
         void UpdateMobility();
 
@@ -425,16 +704,31 @@ public:
 
     private:
 
-        /** Update rendering information. **/
+        /** Update rendering information, only the attached components changed since the capture are updated. **/
         void UpdateRenderingInformation();
 
+        /** Remember the render state of the attached components before the post cook modifies them. **/
+        void CaptureRenderState();
+
         /** Re-attach components after loading or copying. **/
         void PostLoadReattachComponents();
 
 #if WITH_EDITOR
 
-        /** Called after each cook. **/
-        void PostCook( bool bCookError = false );
+        /** Called after each cook, return false if the post cook is time sliced and needs to be resumed next frame. **/
+        bool PostCook( bool bCookError = false );
+
+        /** Post cook stage : create static meshes from the cooked geometry. **/
+        void PostCookStaticMeshes();
+
+        /** Read the preview of the cooked geometry shown while the outputs are created, returns true if there is one. **/
+        bool UpdateCookPreview();
+
+        /** Remove the preview of the cooked geometry. **/
+        void ClearCookPreview();
+
+        /** Warn if the cooked outputs use more memory than the threshold set in the runtime settings. **/
+        void CheckOutputMemoryUsage() const;
 
         /** Check ourselves over and fix up any errors */
         void SanitizePostLoad();
@@ -558,6 +852,40 @@ public:
         /** Clear all parameters. **/
         void ClearParameters();
 
+        /** Return true if we have no instancer, curve, volume or landscape output, static meshes can be restored as they were. **/
+        bool HasOnlyStaticMeshOutputs() const;
+
+        /** Keep the current outputs as the snapshot of the given preset, if they can be restored without cooking. **/
+        void CapturePresetSnapshot( uint32 PresetHash );
+
+        /** Replace the current outputs by those of a snapshot. **/
+        void RestorePresetSnapshot( const FHoudiniPresetSnapshot & PresetSnapshot );
+
+        /** Replace the current outputs by the given static meshes, creating their components as a post cook would. **/
+        void RestoreStaticMeshOutputs( const TMap< FHoudiniGeoPartObject, UStaticMesh * > & InStaticMeshes );
+
+        /** Return the hash of the asset content and parameter preset our node cooks, 0 if our outputs cannot be shared. **/
+        /** OutHash receives their SHA1, the key only picks the candidate components. **/
+        uint32 ComputeSharedCookOutputsKey( FSHAHash & OutHash );
+
+        /** Make our outputs available to the components cooking the same asset and preset. **/
+        void PublishSharedCookOutputs();
+
+        /** Share the outputs of a component that cooked the same asset and preset, returns false if we have to cook. **/
+        bool RestoreSharedCookOutputs();
+
+        /** Return true if the other component builds its static meshes with the same generation settings. **/
+        bool HasSameGeneratedStaticMeshSettings( const UHoudiniAssetComponent * Other ) const;
+
+        /** Remove the snapshot at the given index, deleting the meshes no longer used. **/
+        void RemovePresetSnapshot( int32 SnapshotIdx );
+
+        /** Remove all preset snapshots, after a change of inputs or of the asset made them stale. **/
+        void ClearPresetSnapshots();
+
+        /** Return true if the static mesh is kept by one of the preset snapshots. **/
+        bool IsStaticMeshInPresetSnapshots( const UStaticMesh * StaticMesh ) const;
+
         /** Clear handles. **/
         void ClearHandles();
 
@@ -578,9 +906,6 @@ public:
             TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshMap, 
             bool bDeletePackages = false );
 
-        /** Return true if given object is referenced locally only, by objects generated and owned by this component. **/
-        bool IsObjectReferencedLocally( UStaticMesh * StaticMesh, FReferencerInformationList & Referencers ) const;
-
     public:
 
         /** Clear all landscapes **/
@@ -595,12 +920,33 @@ public:
         /** Create Static mesh resources. This will create necessary components for each mesh and update maps. **/
         void CreateObjectGeoPartResources( TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshMap );
 
+        /** Sort the geo parts by the kind of resources they require. **/
+        void BeginObjectGeoPartResources(
+            const TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshMap, FHoudiniPostCookState & PostCookStateRef );
+
+        /** Create or update the static mesh component of a geo part. **/
+        void CreateObjectGeoPartComponent(
+            const FHoudiniGeoPartObject & HoudiniGeoPartObject, UStaticMesh * StaticMesh, FHoudiniPostCookState & PostCookStateRef );
+
+        /** Release the stale parts and store the static mesh map once all components have been created. **/
+        void EndObjectGeoPartComponents(
+            TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshMap, FHoudiniPostCookState & PostCookStateRef );
+
+        /** Register the components created since the last call, their render and physics states are created together. **/
+        void RegisterPendingComponents( FHoudiniPostCookState & PostCookStateRef );
+
+        /** Clean up components and update materials and mobility once all resources have been created. **/
+        void FinishObjectGeoPartResources();
+
         /** Delete Static mesh resources. This will free static meshes and corresponding components. **/
         void ReleaseObjectGeoPartResources( bool bDeletePackages = false );
 
         /** Check all the attached StaticMeshComponents to delete invalid ones **/
         void CleanUpAttachedStaticMeshComponents();
 
+        /** Release the meshes, instancers and landscapes of a pass-through only asset, only the Houdini logo is kept. **/
+        void ReleasePassThroughOutputs();
+
         /** Create Static mesh resource which corresponds to Houdini logo. **/
         void CreateStaticMeshHoudiniLogoResource( TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMesDhMap );
 
@@ -610,8 +956,8 @@ public:
         /** Serialize instance inputs. **/
         void SerializeInstanceInputs( FArchive & Ar );
 
-        /** Serialize parameters. **/
-        void SerializeParameters( FArchive & Ar );
+        /** Serialize parameters, returns true if they were in the compact format, which includes the name map. **/
+        bool SerializeParameters( FArchive & Ar );
 
         /** Used to perform post loading initialization on instance inputs. **/
         void PostLoadInitializeInstanceInputs();
@@ -681,16 +1027,33 @@ public:
         /** Previous asset, if it has been changed through transaction. **/
         UHoudiniAsset * PreviousTransactionHoudiniAsset;
 
-        /** Parameters for this component's asset, indexed by parameter id. **/
-        TMap< HAPI_ParmId, UHoudiniAssetParameter * > Parameters;
+        /** Parameters for this component's asset, indexed by parameter id. Like the object containers below, this is **/
+        /** a transient property walked by garbage collection, the serialization is done by Serialize.               **/
+        UPROPERTY( Transient )
+        TMap< int32, UHoudiniAssetParameter * > Parameters;
 
         /** Parameters for this component's asset, indexed by name for fast look up. **/
+        UPROPERTY( Transient )
         TMap< FString, UHoudiniAssetParameter * > ParameterByName;
 
+        /** Parameters of inactive folder tabs whose objects haven't been created, by name. Transient. **/
+        TMap< FString, HAPI_ParmId > DeferredParameters;
+
+        /** Parameters accessed by name, which are created even if they are in an inactive folder tab. Transient. **/
+        TSet< FString > ForcedParameterNames;
+
+        /** Components selected with this one in the details panel, owned by the details customization. Transient. **/
+        TWeakPtr< FHoudiniMultiEditGroup > MultiEditGroup;
+
+        /** Hash of the parameter templates the parameters were last built from, 0 if they have to be reconciled. **/
+        uint32 ParameterInterfaceHash;
+
         /** Inputs for this component's asset. **/
+        UPROPERTY( Transient )
         TArray< UHoudiniAssetInput * > Inputs;
 
         /** Instance inputs for this component's asset **/
+        UPROPERTY( Transient )
         TArray< UHoudiniAssetInstanceInput * > InstanceInputs;
 
         /** List of dependent downstream asset connections that have this asset as an asset input. **/
@@ -700,9 +1063,28 @@ public:
         TMap< FHoudiniGeoPartObject, UStaticMesh * > StaticMeshes;
         TMap< UStaticMesh *, UStaticMeshComponent * > StaticMeshComponents;
 
+        /** Outputs of the recently cooked presets, most recent first. Transient. **/
+        TArray< FHoudiniPresetSnapshot > PresetSnapshots;
+
+        /** Static meshes shared with a copy of this component, the next cook or edit creates our own. Transient. **/
+        TSet< TWeakObjectPtr< UStaticMesh > > SharedStaticMeshes;
+
+        /** Key our outputs were published with for other components to share, 0 if they are not. Transient. **/
+        uint32 SharedCookOutputsKey;
+
+        /** SHA1 of the asset content and preset our outputs were published for. Transient. **/
+        FSHAHash SharedCookOutputsHash;
+
+        /** Render state hashes of the attached components when the post cook started. Transient. **/
+        TMap< TWeakObjectPtr< USceneComponent >, uint32 > CapturedRenderStateHashes;
+
+        /** Static meshes whose geometry changed during the post cook, their components need updating. Transient. **/
+        TSet< TWeakObjectPtr< UStaticMesh > > ChangedStaticMeshes;
+
         /** Map of asset handle components. **/
         typedef TMap< FString, UHoudiniHandleComponent * > FHandleComponentMap;
-        FHandleComponentMap HandleComponents;
+        UPROPERTY( Transient )
+        TMap< FString, UHoudiniHandleComponent * > HandleComponents;
 
         /** Map of curve / spline components. **/
         TMap< FHoudiniGeoPartObject, TWeakObjectPtr<UHoudiniSplineComponent> > SplineComponents;
@@ -711,6 +1093,7 @@ public:
         TMap< FHoudiniGeoPartObject, TWeakObjectPtr<ALandscape> > LandscapeComponents;
 
         /** Material assignments. **/
+        UPROPERTY( Transient )
         UHoudiniAssetComponentMaterials * HoudiniAssetComponentMaterials;
 
         /** Buffer to hold preset data for serialization purposes. Used only during serialization. **/
@@ -719,6 +1102,12 @@ public:
         /** Buffer to hold default preset for reset purposes. **/
         TArray< char > DefaultPresetBuffer;
 
+        /** Preset of the asset after its last cook, used to restore it if the session is lost. **/
+        TArray< char > RecoveryPresetBuffer;
+
+        /** Content hash of the Houdini asset when the recovery preset was cached. **/
+        FString RecoveryAssetBytesHash;
+
         /** The output folder for baking actions */
         UPROPERTY()
         FText BakeFolder;
@@ -755,20 +1144,27 @@ public:
         /** Delegate to handle editor viewport drag and drop events. **/
         FDelegateHandle DelegateHandleApplyObjectToActor;
 
-        /** Timer handle, this timer is used for cooking. **/
-        FTimerHandle TimerHandleCooking;
+        /** Id of corresponding Houdini asset. **/
+        HAPI_NodeId AssetId;
 
-        /** Timer delegate, we use it for ticking during cooking or instantiation. **/
-        FTimerDelegate TimerDelegateCooking;
+        /** Index of the pooled session owning the Houdini asset node. **/
+        int32 SessionIndex;
 
-        /** Timer handle, this timer is used for UI updates. **/
-        FTimerHandle TimerHandleUIUpdate;
+        /** State of the post cook processing in progress. **/
+        FHoudiniPostCookState PostCookState;
 
-        /** Timer delegate, we use it for checking if details panel update can be performed. **/
-        FTimerDelegate TimerDelegateUIUpdate;
+        /** Time spent in each stage of the last cook. Transient. **/
+        FHoudiniCookProfile CookProfile;
 
-        /** Id of corresponding Houdini asset. **/
-        HAPI_NodeId AssetId;
+        /** Timings and HAPI traffic of the last cook. **/
+        FHoudiniCookMetrics LastCookMetrics;
+
+        /** Time spent in each phase of the loading of this component. Transient. **/
+        FHoudiniLoadProfile LoadProfile;
+
+        /** Sampled points and bounds of the cooked geometry, drawn while the outputs are created. Transient. **/
+        TArray< FVector > CookPreviewPoints;
+        FBox CookPreviewBounds;
 
         /** Scale factor used for generated geometry of this component. **/
         float GeneratedGeometryScaleFactor;
@@ -834,6 +1230,12 @@ public:
 
                 /** Is set to true after the asset is fully loaded and registered **/
                 uint32 bFullyLoaded : 1;
+
+                /** Enables preview cooks while a parameter slider is being dragged. **/
+                uint32 bSliderDragTriggersCooks : 1;
+
+                /** Is set to true when the asset only feeds downstream assets, no Unreal outputs are generated. **/
+                uint32 bPassThroughOnly : 1;
             };
 
             uint32 HoudiniAssetComponentFlagsPacked;
@@ -861,6 +1263,24 @@ public:
 
                 /** Is set to true when component is loaded and requires instantiation. **/
                 uint32 bLoadedComponentRequiresInstantiation : 1;
+
+                /** Is set to true when the asset has been assigned while the session was starting. **/
+                uint32 bInstantiateWhenSessionStarted : 1;
+
+                /** Is set to true if the asset assigned while the session was starting is to be instantiated as loaded. **/
+                uint32 bInstantiateWhenSessionStartedAsLoaded : 1;
+
+                /** Is set to true while the asset is restored in a new session from its cached state. **/
+                uint32 bRecoveringSession : 1;
+
+                /** Is set to true if the outputs are still valid for the recovered state, which then does not need cooking. **/
+                uint32 bRecoveryOutputsValid : 1;
+
+                /** Is set to true while a loaded component displays its serialized outputs without a node, until it is edited. **/
+                uint32 bTrustingSerializedOutputs : 1;
+
+                /** Is set to true when the render state of the attached components has been captured for the post cook. **/
+                uint32 bRenderStateCaptured : 1;
             };
 
             uint32 HoudiniAssetComponentTransientFlagsPacked;
@@ -35,6 +35,7 @@
 #include "HoudiniPluginSerializationVersion.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniLandscapeUtils.h"
+#include "LandscapeComponent.h"
 #include "Components/SplineComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/InstancedStaticMeshComponent.h"
@@ -252,6 +253,7 @@ UHoudiniAssetInput::UHoudiniAssetInput( const FObjectInitializer & ObjectInitial
     , ConnectedAssetId( -1 )
     , InputIndex( 0 )
     , ChoiceIndex( EHoudiniAssetInputType::GeometryInput )
+    , bWorldOutlinerMeshesDirty( true )
     , UnrealSplineResolution( -1.0f )
     , OutlinerInputsNeedPostLoadInit( false )
     , HoudiniAssetInputFlagsPacked( 0u )
@@ -435,6 +437,13 @@ UHoudiniAssetInput::DisconnectAndDestroyInputAsset()
                 FHoudiniEngineUtils::HapiDisconnectAsset( HostAssetId, InputIndex );
         }
 
+#if WITH_EDITOR
+        // The heightfield we could have patched is destroyed below.
+        StopTrackingLandscapeChanges();
+#endif
+        if ( LandscapeHeightfieldInput.IsValid() )
+            LandscapeHeightfieldInput->Reset();
+
         // Destroy all the geo input assets
         for ( HAPI_NodeId AssetNodeId : CreatedInputDataAssetIds )
         {
@@ -459,6 +468,7 @@ UHoudiniAssetInput::DisconnectAndDestroyInputAsset()
             for ( int32 n = 0; n < InputOutlinerMeshArray.Num(); n++ )
             {
                 InputOutlinerMeshArray[ n ].AssetId = -1;
+                InputOutlinerMeshArray[ n ].InstancePointsNodeId = -1;
             }
         }
 
@@ -825,6 +835,23 @@ UHoudiniAssetInput::UploadParameterValue()
             }
             else
             {
+#if WITH_EDITOR
+                // When only some components of the landscape we sent were modified, patch its heightfield in place.
+                if ( bLandscapeExportAsHeightfield && !bLandscapeExportSelectionOnly
+                    && LandscapeHeightfieldInput.IsValid()
+                    && LandscapeHeightfieldInput->LandscapeProxy.Get() == InputLandscapeProxy
+                    && FHoudiniEngineUtils::IsValidNodeId( ConnectedAssetId )
+                    && FHoudiniLandscapeUtils::UpdateHeightfieldFromLandscapeComponents(
+                        DirtyLandscapeComponents, *LandscapeHeightfieldInput ) )
+                {
+                    DirtyLandscapeComponents.Empty();
+
+                    Success &= ConnectInputNode();
+                    Success &= UpdateObjectMergeTransformType();
+                    break;
+                }
+#endif
+
                 // Disconnect and destroy currently connected asset, if there's one.
                 DisconnectAndDestroyInputAsset();
 
@@ -837,6 +864,9 @@ UHoudiniAssetInput::UploadParameterValue()
                 if ( AssetComponent && !AssetComponent->IsPendingKill() )
                     Bounds = AssetComponent->GetAssetBounds( this, true );
 
+                if ( !LandscapeHeightfieldInput.IsValid() )
+                    LandscapeHeightfieldInput = MakeShareable( new FHoudiniLandscapeHeightfieldInput() );
+
                 // Connect input and create connected asset. Will return by reference.
                 if ( !FHoudiniEngineUtils::HapiCreateInputNodeForLandscape(
                         HostAssetId, InputLandscapeProxy,
@@ -844,8 +874,10 @@ UHoudiniAssetInput::UploadParameterValue()
                         bLandscapeExportSelectionOnly, bLandscapeExportCurves,
                         bLandscapeExportMaterials, bLandscapeExportAsMesh, bLandscapeExportLighting,
                         bLandscapeExportNormalizedUVs, bLandscapeExportTileUVs, Bounds,
-                        bLandscapeExportAsHeightfield, bLandscapeAutoSelectComponent ) )
+                        bLandscapeExportAsHeightfield, bLandscapeAutoSelectComponent,
+                        LandscapeHeightfieldInput.Get() ) )
                 {
+                    LandscapeHeightfieldInput->Reset();
                     bChanged = false;
                     ConnectedAssetId = -1;
                     return false;
@@ -854,6 +886,11 @@ UHoudiniAssetInput::UploadParameterValue()
                 // Connect the inputs and update the transform type
                 Success &= ConnectInputNode();
                 Success &= UpdateObjectMergeTransformType();
+
+#if WITH_EDITOR
+                if ( LandscapeHeightfieldInput->IsValid() )
+                    StartTrackingLandscapeChanges();
+#endif
             }
             break;
         }
@@ -1128,6 +1165,18 @@ UHoudiniAssetInput::BeginDestroy()
 {
     Super::BeginDestroy();
 
+#if WITH_EDITOR
+    // Stop listening to the editor's actor changes.
+    if ( GEngine )
+    {
+        GEngine->OnActorMoved().Remove( OnActorMovedDelegateHandle );
+        GEngine->OnLevelActorDeleted().Remove( OnLevelActorDeletedDelegateHandle );
+    }
+    FCoreUObjectDelegates::OnObjectModified.Remove( OnObjectModifiedDelegateHandle );
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove( OnObjectPropertyChangedDelegateHandle );
+    StopTrackingLandscapeChanges();
+#endif
+
     // Destroy anything curve related.
     DestroyInputCurve();
 
@@ -1294,21 +1343,7 @@ UHoudiniAssetInput::AddReferencedObjects( UObject * InThis, FReferenceCollector
     UHoudiniAssetInput * HoudiniAssetInput = Cast< UHoudiniAssetInput >( InThis );
     if ( HoudiniAssetInput && !HoudiniAssetInput->IsPendingKill() )
     {
-        // Add reference to held geometry object.
-        if ( HoudiniAssetInput->InputObjects.Num() )
-            Collector.AddReferencedObjects( HoudiniAssetInput->InputObjects, InThis );
-
-        // Add reference to held input asset component, if we have one.
-        if ( HoudiniAssetInput->InputAssetComponent && !HoudiniAssetInput->InputAssetComponent->IsPendingKill() )
-            Collector.AddReferencedObject( HoudiniAssetInput->InputAssetComponent, InThis );
-
-        // Add reference to held curve object.
-        if ( HoudiniAssetInput->InputCurve && !HoudiniAssetInput->InputCurve->IsPendingKill() )
-            Collector.AddReferencedObject( HoudiniAssetInput->InputCurve, InThis );
-
-        // Add reference to held landscape.
-        if ( HoudiniAssetInput->InputLandscapeProxy && !HoudiniAssetInput->InputLandscapeProxy->IsPendingKill() )
-            Collector.AddReferencedObject( HoudiniAssetInput->InputLandscapeProxy, InThis );
+        // Held objects and curve parameters are properties referenced by the class token stream.
 
         // Add reference for the WorldInputs' Actors
         for ( auto & OutlinerInput : HoudiniAssetInput->InputOutlinerMeshArray )
@@ -1320,15 +1355,6 @@ UHoudiniAssetInput::AddReferencedObjects( UObject * InThis, FReferenceCollector
 
             Collector.AddReferencedObject( OutlinerInputActor, InThis );
         }
-
-        // Add references for all curve input parameters.
-        for ( TMap< FString, UHoudiniAssetParameter * >::TIterator IterParams( HoudiniAssetInput->InputCurveParameters );
-            IterParams; ++IterParams )
-        {
-            UHoudiniAssetParameter * HoudiniAssetParameter = IterParams.Value();
-            if ( HoudiniAssetParameter && !HoudiniAssetParameter->IsPendingKill() )
-                Collector.AddReferencedObject( HoudiniAssetParameter, InThis );
-        }
     }
 
     // Call base implementation.
@@ -1887,6 +1913,12 @@ UHoudiniAssetInput::TickWorldOutlinerInputs()
     if ( !FHoudiniEngine::Get().GetEnableCookingGlobal() )
         return;
 
+    // Nothing has touched our actors since the last tick.
+    if ( !bWorldOutlinerMeshesDirty )
+        return;
+
+    bWorldOutlinerMeshesDirty = false;
+
     // Lambda use to Modify / Prechange only once
     bool bLocalChanged = false;
     auto MarkLocalChanged = [&]()
@@ -1911,13 +1943,33 @@ UHoudiniAssetInput::TickWorldOutlinerInputs()
     if ( bStaticMeshChanged )
         return;
 
+    // Outliner meshes instanced on points needing their transforms updated.
+    TSet< HAPI_NodeId > InstancePointsToUpdate;
+
     // Check for destroyed / modified outliner inputs
     for ( auto & OutlinerInput : InputOutlinerMeshArray )
     {
+        if ( !OutlinerInput.bIsDirty )
+            continue;
+
+        OutlinerInput.bIsDirty = false;
         if ( !OutlinerInput.ActorPtr.IsValid() )
             continue;
 
-        if ( OutlinerInput.HasActorTransformChanged() && ( OutlinerInput.AssetId >= 0 ) )
+        // Static meshes moved without any other change only need their transform updated, not their geometry.
+        const bool bTransformOnlyChange = !OutlinerInput.SplineComponent
+            && ( OutlinerInput.KeepWorldTransform == bKeepWorldTransform )
+            && ( OutlinerInput.HasActorTransformChanged() || OutlinerInput.HasComponentTransformChanged() );
+
+        if ( bTransformOnlyChange && ( OutlinerInput.InstancePointsNodeId >= 0 ) )
+        {
+            MarkLocalChanged();
+
+            // Updates to the new Transform, the instance points are re-sent after the loop.
+            UpdateWorldOutlinerTransforms( OutlinerInput );
+            InstancePointsToUpdate.Add( OutlinerInput.InstancePointsNodeId );
+        }
+        else if ( ( OutlinerInput.HasActorTransformChanged() || bTransformOnlyChange ) && ( OutlinerInput.AssetId >= 0 ) )
         {
             MarkLocalChanged();
 
@@ -1964,6 +2016,20 @@ UHoudiniAssetInput::TickWorldOutlinerInputs()
         }
     }
 
+    for ( HAPI_NodeId PointsNodeId : InstancePointsToUpdate )
+    {
+        // The points are in the outliner array's order.
+        TArray< FTransform > InstanceTransforms;
+        for ( const auto & OutlinerInput : InputOutlinerMeshArray )
+        {
+            if ( OutlinerInput.InstancePointsNodeId == PointsNodeId )
+                InstanceTransforms.Add( OutlinerInput.ComponentTransform );
+        }
+
+        if ( !FHoudiniEngineUtils::HapiSetInstancePointTransforms( PointsNodeId, InstanceTransforms ) )
+            bStaticMeshChanged = true;
+    }
+
     if ( bLocalChanged )
         MarkChanged();
 }
@@ -1980,6 +2046,31 @@ UHoudiniAssetInput::ConnectInputAssetActor()
     if ( !FHoudiniEngineUtils::IsValidNodeId( InputAssetComponent->GetAssetId() ) )
         return;
 
+    // Nodes living in different pooled sessions cannot be connected, chained assets are moved to the main session.
+    UHoudiniAssetComponent * HoudiniAssetComponent = GetHoudiniAssetComponent();
+    if ( HoudiniAssetComponent
+        && ( HoudiniAssetComponent->GetSessionIndex() != 0 || InputAssetComponent->GetSessionIndex() != 0 ) )
+    {
+        // Try again on the next upload while either asset is busy in its session.
+        if ( HoudiniAssetComponent->IsInstantiatingOrCooking() || InputAssetComponent->IsInstantiatingOrCooking() )
+        {
+            MarkChanged();
+            return;
+        }
+
+        HOUDINI_LOG_MESSAGE(
+            TEXT( "Moving chained assets %s and %s to the main session." ),
+            *InputAssetComponent->GetOwner()->GetName(), *HoudiniAssetComponent->GetOwner()->GetName() );
+
+        // We are registered first, so that the upstream asset also picks the main session.
+        InputAssetComponent->AddDownstreamAsset( HoudiniAssetComponent, InputIndex );
+        if ( InputAssetComponent->GetSessionIndex() != 0 )
+            InputAssetComponent->NotifyAssetNeedsToChangeSession();
+        if ( HoudiniAssetComponent->GetSessionIndex() != 0 )
+            HoudiniAssetComponent->NotifyAssetNeedsToChangeSession();
+        return;
+    }
+
     // Check we have the correct Id
     if ( ConnectedAssetId != InputAssetComponent->GetAssetId() )
         ConnectedAssetId = InputAssetComponent->GetAssetId();
@@ -2148,16 +2239,14 @@ bool
 UHoudiniAssetInput::UpdateInputCurve()
 {
     bool Success = true;
-    FString CurvePointsString;
     EHoudiniSplineComponentType::Enum CurveTypeValue = EHoudiniSplineComponentType::Bezier;
     EHoudiniSplineComponentMethod::Enum CurveMethodValue = EHoudiniSplineComponentMethod::CVs;
     int32 CurveClosed = 1;
 
     if(ConnectedAssetId != -1)
     {
-        FHoudiniEngineUtils::HapiGetParameterDataAsString(
-            ConnectedAssetId, HAPI_UNREAL_PARAM_CURVE_COORDS, TEXT( "" ),
-            CurvePointsString );
+        // The control points are owned by the input curve component, the coords string may also be stale
+        // since linear curves are uploaded as binary geometry, only the curve settings are read back.
         FHoudiniEngineUtils::HapiGetParameterDataAsInteger(
             ConnectedAssetId, HAPI_UNREAL_PARAM_CURVE_TYPE,
             (int32) EHoudiniSplineComponentType::Bezier, (int32 &) CurveTypeValue );
@@ -2186,10 +2275,6 @@ UHoudiniAssetInput::UpdateInputCurve()
         HoudiniGeoPartObject, HAPI_UNREAL_ATTRIB_POSITION,
         AttributeRefinedCurvePositions, RefinedCurvePositions );
 
-    // Process coords string and extract positions.
-    TArray< FVector > CurvePoints;
-    FHoudiniEngineUtils::ExtractStringPositions( CurvePointsString, CurvePoints );
-
     TArray< FVector > CurveDisplayPoints;
     FHoudiniEngineUtils::ConvertScaleAndFlipVectorData( RefinedCurvePositions, CurveDisplayPoints );
 
@@ -2672,6 +2757,7 @@ UHoudiniAssetInput::CheckStateChangedKeepWorldTransform(ECheckBoxState NewState)
     Modify();
 
     bKeepWorldTransform = bState;
+    MarkAllWorldOutlinerMeshesDirty();
 
     // Mark this parameter as changed.
     MarkChanged();
@@ -2931,6 +3017,16 @@ UHoudiniAssetInput::StartWorldOutlinerTicking()
         // We need to register delegate with the timer system.
         static const float TickTimerDelay = 0.5f;
         GEditor->GetTimerManager()->SetTimer( WorldOutlinerTimerHandle, WorldOutlinerTimerDelegate, TickTimerDelay, true );
+
+        // The tick only checks the meshes whose actors the editor reported as changed.
+        OnActorMovedDelegateHandle = GEngine->OnActorMoved().AddUObject( this, &UHoudiniAssetInput::OnWorldOutlinerActorMoved );
+        OnLevelActorDeletedDelegateHandle = GEngine->OnLevelActorDeleted().AddUObject( this, &UHoudiniAssetInput::OnWorldOutlinerActorMoved );
+        OnObjectModifiedDelegateHandle = FCoreUObjectDelegates::OnObjectModified.AddUObject(
+            this, &UHoudiniAssetInput::OnWorldOutlinerObjectModified );
+        OnObjectPropertyChangedDelegateHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(
+            this, &UHoudiniAssetInput::OnWorldOutlinerObjectPropertyChanged );
+
+        MarkAllWorldOutlinerMeshesDirty();
     }
 }
 
@@ -2941,18 +3037,145 @@ UHoudiniAssetInput::StopWorldOutlinerTicking()
     {
         GEditor->GetTimerManager()->ClearTimer( WorldOutlinerTimerHandle );
         WorldOutlinerTimerDelegate.Unbind();
+
+        if ( GEngine )
+        {
+            GEngine->OnActorMoved().Remove( OnActorMovedDelegateHandle );
+            GEngine->OnLevelActorDeleted().Remove( OnLevelActorDeletedDelegateHandle );
+        }
+        FCoreUObjectDelegates::OnObjectModified.Remove( OnObjectModifiedDelegateHandle );
+        FCoreUObjectDelegates::OnObjectPropertyChanged.Remove( OnObjectPropertyChangedDelegateHandle );
     }
 }
 
+void
+UHoudiniAssetInput::OnWorldOutlinerActorMoved( AActor * Actor )
+{
+    MarkWorldOutlinerMeshesDirty( Actor );
+}
+
+void
+UHoudiniAssetInput::OnWorldOutlinerObjectModified( UObject * Object )
+{
+    MarkWorldOutlinerMeshesDirty( Object );
+}
+
+void
+UHoudiniAssetInput::OnWorldOutlinerObjectPropertyChanged( UObject * Object, FPropertyChangedEvent & PropertyChangedEvent )
+{
+    MarkWorldOutlinerMeshesDirty( Object );
+}
+
+void
+UHoudiniAssetInput::MarkWorldOutlinerMeshesDirty( UObject * Object )
+{
+    if ( !Object || ChoiceIndex != EHoudiniAssetInputType::WorldInput )
+        return;
+
+    // Changes to the input itself (undo, transform type) may affect all meshes.
+    if ( Object == this )
+    {
+        MarkAllWorldOutlinerMeshesDirty();
+        return;
+    }
+
+    const AActor * Actor = Cast< AActor >( Object );
+    if ( !Actor )
+    {
+        if ( const UActorComponent * ActorComponent = Cast< UActorComponent >( Object ) )
+            Actor = ActorComponent->GetOwner();
+    }
+
+    if ( !Actor )
+        return;
+
+    for ( auto & OutlinerMesh : InputOutlinerMeshArray )
+    {
+        if ( OutlinerMesh.ActorPtr.Get() == Actor )
+        {
+            OutlinerMesh.bIsDirty = true;
+            bWorldOutlinerMeshesDirty = true;
+        }
+    }
+}
+
+void
+UHoudiniAssetInput::MarkAllWorldOutlinerMeshesDirty()
+{
+    for ( auto & OutlinerMesh : InputOutlinerMeshArray )
+        OutlinerMesh.bIsDirty = true;
+
+    bWorldOutlinerMeshesDirty = true;
+}
+
+void
+UHoudiniAssetInput::StartTrackingLandscapeChanges()
+{
+    // Changes made before the landscape was sent are already in the heightfield.
+    DirtyLandscapeComponents.Empty();
+
+    if ( OnLandscapeModifiedDelegateHandle.IsValid() )
+        return;
+
+    // Painting and sculpting modify the components, undo and redo report them as changed.
+    OnLandscapeModifiedDelegateHandle = FCoreUObjectDelegates::OnObjectModified.AddUObject(
+        this, &UHoudiniAssetInput::OnLandscapeObjectModified );
+    OnLandscapePropertyChangedDelegateHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(
+        this, &UHoudiniAssetInput::OnLandscapeObjectPropertyChanged );
+}
+
+void
+UHoudiniAssetInput::StopTrackingLandscapeChanges()
+{
+    FCoreUObjectDelegates::OnObjectModified.Remove( OnLandscapeModifiedDelegateHandle );
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove( OnLandscapePropertyChangedDelegateHandle );
+    OnLandscapeModifiedDelegateHandle.Reset();
+    OnLandscapePropertyChangedDelegateHandle.Reset();
+
+    DirtyLandscapeComponents.Empty();
+}
+
+void
+UHoudiniAssetInput::OnLandscapeObjectModified( UObject * Object )
+{
+    ULandscapeComponent * LandscapeComponent = Cast< ULandscapeComponent >( Object );
+    if ( !LandscapeComponent || !InputLandscapeProxy || ChoiceIndex != EHoudiniAssetInputType::LandscapeInput )
+        return;
+
+    // The whole landscape is sent, including the components of its streaming proxies.
+    if ( LandscapeComponent->GetLandscapeInfo() == InputLandscapeProxy->GetLandscapeInfo() )
+        DirtyLandscapeComponents.Add( LandscapeComponent );
+}
+
+void
+UHoudiniAssetInput::OnLandscapeObjectPropertyChanged( UObject * Object, FPropertyChangedEvent & PropertyChangedEvent )
+{
+    OnLandscapeObjectModified( Object );
+}
+
 void UHoudiniAssetInput::InvalidateNodeIds()
 {
     ConnectedAssetId = -1;
+    LandscapeHeightfieldInput.Reset();
     for (auto& OutlinerInputMesh : InputOutlinerMeshArray)
     {
         OutlinerInputMesh.AssetId = -1;
+        OutlinerInputMesh.InstancePointsNodeId = -1;
     }
 }
 
+void
+UHoudiniAssetInput::ResetForNewSession()
+{
+    // Asset inputs do not own any node, they only need to be connected again.
+    if ( ChoiceIndex != EHoudiniAssetInputType::AssetInput )
+        DisconnectAndDestroyInputAsset();
+
+    bInputAssetConnectedInHoudini = false;
+    InvalidateNodeIds();
+    MarkChanged( false );
+}
+
 void UHoudiniAssetInput::DuplicateCurves(UHoudiniAssetInput * OriginalInput)
 {
     if (!InputCurve || InputCurve->IsPendingKill() )
@@ -3150,6 +3373,8 @@ UHoudiniAssetInput::SetSplineResolutionValue(float InValue)
         OnResetSplineResolutionClicked();
     else
         UnrealSplineResolution = FMath::Clamp< float >(InValue, 0.0f, 10000.0f);
+
+    MarkAllWorldOutlinerMeshesDirty();
 }
 
 
@@ -3178,6 +3403,8 @@ UHoudiniAssetInput::OnResetSplineResolutionClicked()
     else
         UnrealSplineResolution = HAPI_UNREAL_PARAM_SPLINE_RESOLUTION_DEFAULT;
 
+    MarkAllWorldOutlinerMeshesDirty();
+
     return FReply::Handled();
 }
 
@@ -34,6 +34,8 @@
 
 class ALandscape;
 class ALandscapeProxy;
+class ULandscapeComponent;
+struct FHoudiniLandscapeHeightfieldInput;
 class UHoudiniSplineComponent;
 class USplineComponent;
 
@@ -134,6 +136,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniAssetInputOutlinerMesh
 
     /** If the world In is a ISM, index of this instance **/
     uint32 InstanceIndex = -1;
+
+    /** Set when the actor or its components changed, the next tick of the input needs to check this mesh. **/
+    bool bIsDirty = true;
+
+    /** If the mesh is instanced with other actors' meshes, the node holding the instance points. **/
+    HAPI_NodeId InstancePointsNodeId = -1;
 };
 
 
@@ -231,6 +239,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Invalidate all connected node ids */
         void InvalidateNodeIds();
 
+        /** Destroys our input nodes in the current session, they are created and connected again on the next upload. **/
+        void ResetForNewSession();
+
         /** Duplicates the data from the input curve properly **/
         void DuplicateCurves(UHoudiniAssetInput * OriginalInput);
 
@@ -337,6 +348,25 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Check if input Actors have had their Transforms changed. **/
         void TickWorldOutlinerInputs();
 
+        /** Editor delegate handlers, mark the outliner meshes of a changed actor dirty. **/
+        void OnWorldOutlinerActorMoved( AActor * Actor );
+        void OnWorldOutlinerObjectModified( UObject * Object );
+        void OnWorldOutlinerObjectPropertyChanged( UObject * Object, FPropertyChangedEvent & PropertyChangedEvent );
+
+        /** Mark the outliner meshes of the actor owning the given object dirty. **/
+        void MarkWorldOutlinerMeshesDirty( UObject * Object );
+
+        /** Mark all outliner meshes dirty, when a setting affecting all of them changed. **/
+        void MarkAllWorldOutlinerMeshesDirty();
+
+        /** Start or stop recording the input landscape's components modified since it was sent as a heightfield. **/
+        void StartTrackingLandscapeChanges();
+        void StopTrackingLandscapeChanges();
+
+        /** Editor delegate handlers, mark the modified components of the input landscape dirty. **/
+        void OnLandscapeObjectModified( UObject * Object );
+        void OnLandscapeObjectPropertyChanged( UObject * Object, FPropertyChangedEvent & PropertyChangedEvent );
+
         /** Update WorldOutliners Transform after they changed **/
         void UpdateWorldOutlinerTransforms(FHoudiniAssetInputOutlinerMesh& OutlinerMesh);
 
@@ -421,6 +451,7 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         HAPI_NodeId GetAssetId() const;
 
         /** Parameters used by a curve input asset. **/
+        UPROPERTY( Transient )
         TMap< FString, UHoudiniAssetParameter * > InputCurveParameters;
 
         /** Choice labels for this property. **/
@@ -549,16 +580,21 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Value of choice option. **/
         FString ChoiceStringValue;
 
-        /** Objects used for geometry input. **/
+        /** Objects used for geometry input. The held objects are transient properties referenced by garbage **/
+        /** collection, they are serialized by Serialize.                                                      **/
+        UPROPERTY( Transient )
         TArray<UObject *> InputObjects;
 
         /** Houdini spline component which is used for curve input. **/
+        UPROPERTY( Transient )
         class UHoudiniSplineComponent * InputCurve;
 
         /** Houdini asset component pointer of the input asset (actor). **/
+        UPROPERTY( Transient )
         class UHoudiniAssetComponent * InputAssetComponent;
 
         /** Landscape actor used for input. **/
+        UPROPERTY( Transient )
         class ALandscapeProxy * InputLandscapeProxy;
 
         /** List of selected meshes and actors from the World Outliner. **/
@@ -586,6 +622,25 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Timer delegate, we use it for ticking to see if input Actors have changed. **/
         FTimerDelegate WorldOutlinerTimerDelegate;
 
+        /** Editor delegates telling us which input Actors may have changed. **/
+        FDelegateHandle OnActorMovedDelegateHandle;
+        FDelegateHandle OnLevelActorDeletedDelegateHandle;
+        FDelegateHandle OnObjectModifiedDelegateHandle;
+        FDelegateHandle OnObjectPropertyChangedDelegateHandle;
+
+        /** Set when at least one outliner mesh is dirty, idle inputs skip their tick. **/
+        bool bWorldOutlinerMeshesDirty;
+
+        /** Whole landscape heightfield sent by this input, patched in place when only some components changed. **/
+        TSharedPtr< FHoudiniLandscapeHeightfieldInput > LandscapeHeightfieldInput;
+
+        /** Components of the input landscape modified since its heightfield was sent. **/
+        TSet< TWeakObjectPtr< ULandscapeComponent > > DirtyLandscapeComponents;
+
+        /** Editor delegates telling us which landscape components were modified. **/
+        FDelegateHandle OnLandscapeModifiedDelegateHandle;
+        FDelegateHandle OnLandscapePropertyChangedDelegateHandle;
+
         float UnrealSplineResolution;
 
         /** Indicates that the OutlinerInputs have just been loaded and needs to be updated **/
@@ -39,6 +39,7 @@
 
 #include "Internationalization/Internationalization.h"
 #include "HoudiniEngineBakeUtils.h"
+#include "HoudiniEngineInstancerUtils.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
 
@@ -77,7 +78,7 @@ UHoudiniAssetInstanceInput::Create(
 
     NewInstanceInput->PrimaryObject = InPrimaryObject;
     NewInstanceInput->HoudiniGeoPartObject = InHoudiniGeoPartObject;
-    NewInstanceInput->SetNameAndLabel( InHoudiniGeoPartObject.ObjectName );
+    NewInstanceInput->SetNameAndLabel( InHoudiniGeoPartObject.GetObjectName() );
     NewInstanceInput->ObjectToInstanceId = ObjectToInstance;
 
     NewInstanceInput->Flags = Flags;
@@ -185,22 +186,15 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
             FHoudiniEngine::Get().GetSession(), HoudiniGeoPartObject.GeoId, PartInfo.id,
             InstancedPartIds.GetData(), 0, PartInfo.instancedPartCount ), false );
 
+        // The instance transforms are shared by all instanced parts.
+        TArray<FTransform> InstancerUnrealTransforms;
+        InstancerUnrealTransforms.SetNumUninitialized( InstancerPartTransforms.Num() );
+        FHoudiniEngineUtils::TranslateHapiTransforms(
+            InstancerPartTransforms.GetData(), InstancerPartTransforms.Num(), InstancerUnrealTransforms.GetData() );
+
         for ( auto InstancedPartId : InstancedPartIds )
         {
-            HAPI_PartInfo InstancedPartInfo;
-            HOUDINI_CHECK_ERROR_RETURN(
-                FHoudiniApi::GetPartInfo(
-                    FHoudiniEngine::Get().GetSession(), HoudiniGeoPartObject.GeoId, InstancedPartId,
-                    &InstancedPartInfo ), false );
-
-            TArray<FTransform> ObjectTransforms;
-            ObjectTransforms.SetNumUninitialized( InstancerPartTransforms.Num() );
-            for ( int32 InstanceIdx = 0; InstanceIdx < InstancerPartTransforms.Num(); ++InstanceIdx )
-            {
-                const auto& InstanceTransform = InstancerPartTransforms[InstanceIdx];
-                FHoudiniEngineUtils::TranslateHapiTransform( InstanceTransform, ObjectTransforms[InstanceIdx] );
-                //HOUDINI_LOG_MESSAGE( TEXT( "Instance %d:%d Transform: %s for Part Id %d" ), HoudiniGeoPartObject.PartId, InstanceIdx, *ObjectTransforms[ InstanceIdx ].ToString(), InstancedPartId );
-            }
+            const TArray<FTransform> & ObjectTransforms = InstancerUnrealTransforms;
 
             // Create this instanced input field for this instanced part
             //
@@ -313,51 +307,42 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
         }
         else if ( ResultAttributeInfo.owner == HAPI_ATTROWNER_POINT )
         {
-            TArray< FString > PointInstanceValues;
-            if ( !HoudiniGeoPartObject.HapiGetAttributeDataAsString(
-                AssetId, MarshallingAttributeInstanceOverride,
-                HAPI_ATTROWNER_POINT, ResultAttributeInfo, PointInstanceValues ) )
+            // Get the unique values, and for each point the index of its value.
+            TArray< FString > UniqueInstancePaths;
+            TArray< int32 > PointInstancePathIndices;
+            if ( !FHoudiniEngineUtils::HapiGetAttributeDataAsStringTable(
+                AssetId, HoudiniGeoPartObject.ObjectId, HoudiniGeoPartObject.GeoId, HoudiniGeoPartObject.PartId,
+                MarshallingAttributeInstanceOverride.c_str(), ResultAttributeInfo,
+                UniqueInstancePaths, PointInstancePathIndices, 0, HAPI_ATTROWNER_POINT ) )
             {
                 // This should not happen - attribute exists, but there was an error retrieving it.
                 return false;
             }
 
             // Attribute is on points, number of points must match number of transforms.
-            if ( PointInstanceValues.Num() != AllTransforms.Num() )
+            if ( PointInstancePathIndices.Num() != AllTransforms.Num() )
             {
                 // This should not happen, we have mismatch between number of instance values and transforms.
                 return false;
             }
 
-            // If instance attribute exists on points, we need to get all unique values.
-            TMap< FString, UObject * > ObjectsToInstance;
-
-            for ( auto Iter : PointInstanceValues )
-            {
-                const FString & UniqueName = *Iter;
-
-                if ( !ObjectsToInstance.Contains( UniqueName ) )
-                {
-                    UObject * AttributeObject = StaticLoadObject( 
-                        UObject::StaticClass(), nullptr, *UniqueName, nullptr, LOAD_None, nullptr );
+            // Load each unique object once, and split the transforms between them.
+            TArray< UObject * > ObjectsToInstance;
+            FHoudiniEngineInstancerUtils::LoadInstancedObjects( UniqueInstancePaths, ObjectsToInstance );
 
-                    if ( AttributeObject && !AttributeObject->IsPendingKill() )
-                        ObjectsToInstance.Add( UniqueName, AttributeObject );
-                }
-            }
+            TArray< TArray< FTransform > > ObjectsTransforms;
+            FHoudiniEngineInstancerUtils::BucketInstanceTransforms(
+                PointInstancePathIndices, UniqueInstancePaths.Num(), AllTransforms, ObjectsTransforms );
 
             bool Success = false;
 
-            for( auto Iter : ObjectsToInstance )
+            for ( int32 ObjectIdx = 0; ObjectIdx < ObjectsToInstance.Num(); ++ObjectIdx )
             {
-                const FString & InstancePath = Iter.Key;
-                UObject * AttributeObject = Iter.Value;
+                UObject * AttributeObject = ObjectsToInstance[ ObjectIdx ];
 
-                if ( AttributeObject && !AttributeObject->IsPendingKill() )
+                if ( AttributeObject && !AttributeObject->IsPendingKill() && ObjectsTransforms[ ObjectIdx ].Num() > 0 )
                 {
-                    TArray< FTransform > ObjectTransforms;
-                    GetPathInstaceTransforms( InstancePath, PointInstanceValues, AllTransforms, ObjectTransforms );
-                    CreateInstanceInputField( AttributeObject, ObjectTransforms, InstanceInputFields, NewInstanceInputFields );
+                    CreateInstanceInputField( AttributeObject, ObjectsTransforms[ ObjectIdx ], InstanceInputFields, NewInstanceInputFields );
                     Success = true;
                 }
             }
@@ -548,21 +533,15 @@ UHoudiniAssetInstanceInput::CreateInstanceInputField(
             FHoudiniEngine::Get().GetSession(), InHoudiniGeoPartObject.GeoId, PartInfo.id,
             InstancedPartIds.GetData(), 0, PartInfo.instancedPartCount ) );
 
+        // The instance transforms are shared by all instanced parts.
+        TArray<FTransform> InstancerUnrealTransforms;
+        InstancerUnrealTransforms.SetNumUninitialized( InstancerPartTransforms.Num() );
+        FHoudiniEngineUtils::TranslateHapiTransforms(
+            InstancerPartTransforms.GetData(), InstancerPartTransforms.Num(), InstancerUnrealTransforms.GetData() );
+
         for ( auto InstancedPartId : InstancedPartIds )
         {
-            HAPI_PartInfo InstancedPartInfo;
-            HOUDINI_CHECK_ERROR( &Result,
-                FHoudiniApi::GetPartInfo(
-                    FHoudiniEngine::Get().GetSession(), InHoudiniGeoPartObject.GeoId, InstancedPartId,
-                    &InstancedPartInfo ) );
-
-            TArray<FTransform> PPObjectTransforms;
-            PPObjectTransforms.SetNumUninitialized( InstancerPartTransforms.Num() );
-            for ( int32 InstanceIdx = 0; InstanceIdx < InstancerPartTransforms.Num(); ++InstanceIdx )
-            {
-                const auto& InstanceTransform = InstancerPartTransforms[InstanceIdx];
-                FHoudiniEngineUtils::TranslateHapiTransform( InstanceTransform, PPObjectTransforms[InstanceIdx] );
-            }
+            const TArray<FTransform> & PPObjectTransforms = InstancerUnrealTransforms;
 
             // Create this instanced input field for this instanced part
             
@@ -587,14 +566,14 @@ UHoudiniAssetInstanceInput::CreateInstanceInputField(
             else
             {
                 HOUDINI_LOG_WARNING(
-                    TEXT( "CreateInstanceInputField for Packed Primitive: Could not find static mesh for object [%d %s], geo %d, part %d]" ), InHoudiniGeoPartObject.ObjectId, *InHoudiniGeoPartObject.ObjectName, InHoudiniGeoPartObject.GeoId, InstancedPartId );
+                    TEXT( "CreateInstanceInputField for Packed Primitive: Could not find static mesh for object [%d %s], geo %d, part %d]" ), InHoudiniGeoPartObject.ObjectId, *InHoudiniGeoPartObject.GetObjectName(), InHoudiniGeoPartObject.GeoId, InstancedPartId );
             }
         }
     }
     else
     {
         HOUDINI_LOG_WARNING(
-            TEXT( "CreateInstanceInputField: Could not find static mesh for object [%d %s], geo %d, part %d]" ), InHoudiniGeoPartObject.ObjectId, *InHoudiniGeoPartObject.ObjectName, InHoudiniGeoPartObject.GeoId, InHoudiniGeoPartObject.PartId );
+            TEXT( "CreateInstanceInputField: Could not find static mesh for object [%d %s], geo %d, part %d]" ), InHoudiniGeoPartObject.ObjectId, *InHoudiniGeoPartObject.GetObjectName(), InHoudiniGeoPartObject.GeoId, InHoudiniGeoPartObject.PartId );
     }
 }
 
@@ -729,14 +708,14 @@ FString UHoudiniAssetInstanceInput::GetFieldLabel( int32 FieldIdx, int32 Variati
     if ( Flags.bIsPackedPrimitiveInstancer )
     {
         if ( Field->GetHoudiniGeoPartObject().HasCustomName() )
-            FieldNameText = Field->GetHoudiniGeoPartObject().PartName;
+            FieldNameText = Field->GetHoudiniGeoPartObject().GetPartName();
         else
             FieldNameText = Field->GetHoudiniGeoPartObject().GetNodePath();
     }
     else if ( Flags.bAttributeInstancerOverride )
     {
         if ( HoudiniGeoPartObject.HasCustomName() )
-            FieldNameText =  HoudiniGeoPartObject.PartName;
+            FieldNameText =  HoudiniGeoPartObject.GetPartName();
         else
             FieldNameText = HoudiniGeoPartObject.GetNodePath() + TEXT( "/Override_" ) + FString::FromInt( FieldIdx );
     }
@@ -744,9 +723,9 @@ FString UHoudiniAssetInstanceInput::GetFieldLabel( int32 FieldIdx, int32 Variati
     {
         // For object-instancers we use the instancer's name as well
         if (HoudiniGeoPartObject.HasCustomName())
-            FieldNameText = HoudiniGeoPartObject.PartName;
+            FieldNameText = HoudiniGeoPartObject.GetPartName();
         else
-            FieldNameText = HoudiniGeoPartObject.GetNodePath() + TEXT( "/" ) + Field->GetHoudiniGeoPartObject().ObjectName;
+            FieldNameText = HoudiniGeoPartObject.GetNodePath() + TEXT( "/" ) + Field->GetHoudiniGeoPartObject().GetObjectName();
     }
 
     if ( Field->InstanceVariationCount() > 1 )
@@ -831,6 +810,7 @@ UHoudiniAssetInstanceInput::CloneComponentsAndAttachToActor( AActor * Actor )
 
     USceneComponent * RootComponent = Actor->GetRootComponent();
     TMap< const UStaticMesh*, UStaticMesh* > OriginalToBakedMesh;
+    TMap< const UObject*, UObject* > OriginalToBakedMaterials;
 
     for ( int32 Idx = 0; Idx < InstanceInputFields.Num(); ++Idx )
     {
@@ -947,7 +927,7 @@ UHoudiniAssetInstanceInput::CloneComponentsAndAttachToActor( AActor * Actor )
                     if ( Comp && !Comp->IsPendingKill() )
                     {
                         auto&& ItemGeoPartObject = Comp->LocateGeoPartObject(OutStaticMesh);
-                        FHoudiniEngineBakeUtils::CheckedBakeStaticMesh(Comp, OriginalToBakedMesh, ItemGeoPartObject, OriginalSM);
+                        FHoudiniEngineBakeUtils::CheckedBakeStaticMesh(Comp, OriginalToBakedMesh, ItemGeoPartObject, OriginalSM, &OriginalToBakedMaterials);
                         OutStaticMesh = OriginalToBakedMesh[OutStaticMesh];
                     }
                 }
@@ -975,12 +955,9 @@ UHoudiniAssetInstanceInput::CloneComponentsAndAttachToActor( AActor * Actor )
                     // Reapply the uproperties modified by attributes on the duplicated component
                     FHoudiniEngineUtils::UpdateUPropertyAttributesOnObject(DuplicatedComponent, HoudiniGeoPartObject);
 
-                    TArray<FTransform> ProcessedTransforms;
-                    HoudiniAssetInstanceInputField->GetProcessedTransforms(ProcessedTransforms, VariationIdx);
-
-                    // Set component instances.
-                    UHoudiniInstancedActorComponent::UpdateInstancerComponentInstances(
-                        DuplicatedComponent, ProcessedTransforms, HoudiniAssetInstanceInputField->GetInstancedColors( VariationIdx ) );
+                    // The live component already holds the processed instances, copy its per-instance
+                    // data in one go instead of processing the transforms again and adding them one by one.
+                    DuplicatedComponent->PerInstanceSMData = ISMC->PerInstanceSMData;
 
                     // Copy visibility.
                     DuplicatedComponent->SetVisibility(ISMC->IsVisible());
@@ -990,6 +967,9 @@ UHoudiniAssetInstanceInput::CloneComponentsAndAttachToActor( AActor * Actor )
 
                     DuplicatedComponent->RegisterComponent();
                     DuplicatedComponent->GetBodyInstance()->bAutoWeld = false;
+
+                    if ( UHierarchicalInstancedStaticMeshComponent * DuplicatedHISMC = Cast< UHierarchicalInstancedStaticMeshComponent >( DuplicatedComponent ) )
+                        DuplicatedHISMC->BuildTreeIfOutdated( true, true );
                 }
             }
             else if ( MSIC && !MSIC->IsPendingKill() )
@@ -1021,21 +1001,6 @@ UHoudiniAssetInstanceInput::CloneComponentsAndAttachToActor( AActor * Actor )
 
 #endif
 
-void
-UHoudiniAssetInstanceInput::GetPathInstaceTransforms(
-    const FString & ObjectInstancePath,
-    const TArray< FString > & PointInstanceValues, const TArray< FTransform > & Transforms,
-    TArray< FTransform > & OutTransforms)
-{
-    OutTransforms.Empty();
-
-    for ( int32 Idx = 0; Idx < PointInstanceValues.Num(); ++Idx )
-    {
-        if ( ObjectInstancePath.Equals( PointInstanceValues[ Idx ] ) )
-            OutTransforms.Add( Transforms[ Idx ] );
-    }
-}
-
 #if WITH_EDITOR
 
 void
@@ -1163,7 +1128,7 @@ UHoudiniAssetInstanceInput::SetRotationRoll(
     FRotator Rotator = HoudiniAssetInstanceInputField->GetRotationOffset( VariationIdx );
     Rotator.Roll = Value;
     HoudiniAssetInstanceInputField->SetRotationOffset( Rotator, VariationIdx );
-    HoudiniAssetInstanceInputField->UpdateInstanceTransforms( false );
+    HoudiniAssetInstanceInputField->UpdateInstanceTransforms( false, VariationIdx );
 }
 
 void
@@ -1182,7 +1147,7 @@ UHoudiniAssetInstanceInput::SetRotationPitch(
     FRotator Rotator = HoudiniAssetInstanceInputField->GetRotationOffset( VariationIdx );
     Rotator.Pitch = Value;
     HoudiniAssetInstanceInputField->SetRotationOffset( Rotator, VariationIdx );
-    HoudiniAssetInstanceInputField->UpdateInstanceTransforms( false );
+    HoudiniAssetInstanceInputField->UpdateInstanceTransforms( false, VariationIdx );
 }
 
 void
@@ -1201,7 +1166,7 @@ UHoudiniAssetInstanceInput::SetRotationYaw(
     FRotator Rotator = HoudiniAssetInstanceInputField->GetRotationOffset( VariationIdx );
     Rotator.Yaw = Value;
     HoudiniAssetInstanceInputField->SetRotationOffset( Rotator, VariationIdx );
-    HoudiniAssetInstanceInputField->UpdateInstanceTransforms( false );
+    HoudiniAssetInstanceInputField->UpdateInstanceTransforms( false, VariationIdx );
 }
 
 TOptional< float >
@@ -1260,7 +1225,7 @@ UHoudiniAssetInstanceInput::SetScaleX(
     }
 
     HoudiniAssetInstanceInputField->SetScaleOffset( Scale3D, VariationIdx );
-    HoudiniAssetInstanceInputField->UpdateInstanceTransforms( false );
+    HoudiniAssetInstanceInputField->UpdateInstanceTransforms( false, VariationIdx );
 }
 
 void
@@ -1286,7 +1251,7 @@ UHoudiniAssetInstanceInput::SetScaleY(
     }
 
     HoudiniAssetInstanceInputField->SetScaleOffset( Scale3D, VariationIdx );
-    HoudiniAssetInstanceInputField->UpdateInstanceTransforms( false );
+    HoudiniAssetInstanceInputField->UpdateInstanceTransforms( false, VariationIdx );
 }
 
 void
@@ -1312,7 +1277,7 @@ UHoudiniAssetInstanceInput::SetScaleZ(
     }
 
     HoudiniAssetInstanceInputField->SetScaleOffset( Scale3D, VariationIdx );
-    HoudiniAssetInstanceInputField->UpdateInstanceTransforms( false );
+    HoudiniAssetInstanceInputField->UpdateInstanceTransforms( false, VariationIdx );
 }
 
 void
@@ -113,13 +113,6 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInput : public UHoudiniAsset
 
 #endif
 
-    protected:
-
-        /** Retrieve all transforms for a given path. Used by attribute instancer. **/
-        void GetPathInstaceTransforms(
-            const FString & ObjectInstancePath, const TArray< FString > & PointInstanceValues,
-            const TArray< FTransform > & Transforms, TArray< FTransform > & OutTransforms );
-
     protected:
 
         /** Locate field which matches given criteria. Return null if not found. **/
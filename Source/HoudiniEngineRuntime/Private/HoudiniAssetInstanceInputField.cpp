@@ -32,6 +32,7 @@
 
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Async/ParallelFor.h"
 
 
 // Fastrand is a faster alternative to std::rand()
@@ -42,6 +43,36 @@ inline int fastrand(int& nSeed)
     return (nSeed >> 16) & 0x7FFF;
 }
 
+/** Split values into one array per variation, given the variation of each value. **/
+template< typename ValueType >
+static void
+BucketInstanceValuesByVariation(
+    const TArray< int32 > & Assignments, int32 VariationCount,
+    const TArray< ValueType > & Values, TArray< TArray< ValueType > > & VariationValues )
+{
+    VariationValues.Empty( VariationCount );
+    VariationValues.SetNum( VariationCount );
+
+    int32 ValueCount = FMath::Min( Assignments.Num(), Values.Num() );
+
+    // Find the slot of each value in its variation, then copy the values in parallel.
+    TArray< int32 > VariationCounts;
+    VariationCounts.SetNumZeroed( VariationCount );
+    TArray< int32 > ValueSlots;
+    ValueSlots.SetNumUninitialized( ValueCount );
+    for ( int32 Idx = 0; Idx < ValueCount; ++Idx )
+        ValueSlots[ Idx ] = VariationCounts.IsValidIndex( Assignments[ Idx ] ) ? VariationCounts[ Assignments[ Idx ] ]++ : INDEX_NONE;
+
+    for ( int32 VariationIdx = 0; VariationIdx < VariationCount; ++VariationIdx )
+        VariationValues[ VariationIdx ].SetNumUninitialized( VariationCounts[ VariationIdx ] );
+
+    ParallelFor( ValueCount, [&]( int32 Idx )
+    {
+        if ( ValueSlots[ Idx ] != INDEX_NONE )
+            VariationValues[ Assignments[ Idx ] ][ ValueSlots[ Idx ] ] = Values[ Idx ];
+    }, ValueCount < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
+}
+
 bool
 FHoudiniAssetInstanceInputFieldSortPredicate::operator()(
     const UHoudiniAssetInstanceInputField & A,
@@ -243,13 +274,13 @@ UHoudiniAssetInstanceInputField::AddInstanceComponent( int32 VariationIdx )
         if( InstancerHoudiniGeoPartObject.bInstancerAttributeMaterialAvailable )
         {
             InstancerMaterial = Comp->GetAssignmentMaterial(
-                InstancerHoudiniGeoPartObject.InstancerAttributeMaterialName);
+                InstancerHoudiniGeoPartObject.GetInstancerAttributeMaterialName());
         }
 
         // If attribute material was not found, we check for presence of shop instancer material.
         if( !InstancerMaterial && InstancerHoudiniGeoPartObject.bInstancerMaterialAvailable )
             InstancerMaterial = Comp->GetAssignmentMaterial(
-                InstancerHoudiniGeoPartObject.InstancerMaterialName);
+                InstancerHoudiniGeoPartObject.GetInstancerMaterialName());
 
         USceneComponent* NewComp = nullptr;
         if( HoudiniAssetInstanceInput->Flags.bIsSplitMeshInstancer )
@@ -295,15 +326,15 @@ UHoudiniAssetInstanceInputField::AddInstanceComponent( int32 VariationIdx )
         else
         {
             UInstancedStaticMeshComponent * InstancedStaticMeshComponent = nullptr;
-            if ( StaticMesh->GetNumLODs() > 1 )
+            if ( NeedsHierarchicalInstancing( StaticMesh ) )
             {
-                // If the mesh has LODs, use Hierarchical ISMC
+                // If the mesh has LODs or many instances, use Hierarchical ISMC
                 InstancedStaticMeshComponent = NewObject< UHierarchicalInstancedStaticMeshComponent >(
                     RootComp->GetOwner(), UHierarchicalInstancedStaticMeshComponent::StaticClass(), NAME_None, RF_Transactional);
             }
             else
             {
-                // If the mesh doesnt have LOD, we can use a regular ISMC
+                // If the mesh doesnt have LOD and few instances, we can use a regular ISMC
                 InstancedStaticMeshComponent = NewObject< UInstancedStaticMeshComponent >(
                     RootComp->GetOwner(),UInstancedStaticMeshComponent::StaticClass(), NAME_None, RF_Transactional );
             }
@@ -362,44 +393,88 @@ UHoudiniAssetInstanceInputField::AddInstanceComponent( int32 VariationIdx )
     UpdateRelativeTransform();
 }
 
+void
+UHoudiniAssetInstanceInputField::RecreateInstanceComponent( int32 VariationIdx )
+{
+    FTransform SavedXform = FTransform::Identity;
+
+    if ( InstancerComponents.IsValidIndex( VariationIdx ) )
+    {
+        if ( InstancerComponents[ VariationIdx ] )
+        {
+            SavedXform = InstancerComponents[ VariationIdx ]->GetRelativeTransform();
+            InstancerComponents[ VariationIdx ]->DestroyComponent();
+        }
+        InstancerComponents.RemoveAt( VariationIdx );
+    }
+
+    AddInstanceComponent( VariationIdx );
+    if ( InstancerComponents.IsValidIndex( VariationIdx ) && InstancerComponents[ VariationIdx ] )
+        InstancerComponents[ VariationIdx ]->SetRelativeTransform( SavedXform );
+}
+
+bool
+UHoudiniAssetInstanceInputField::NeedsHierarchicalInstancing( UStaticMesh * StaticMesh ) const
+{
+    if ( !StaticMesh || StaticMesh->IsPendingKill() )
+        return false;
+
+    // Meshes with LODs need the HISM for LOD selection, large counts benefit from its culling tree.
+    return StaticMesh->GetNumLODs() > 1
+        || InstancedTransforms.Num() >= HAPI_UNREAL_INSTANCER_HIERARCHICAL_MIN_INSTANCES;
+}
+
 void
 UHoudiniAssetInstanceInputField::SetInstanceTransforms( const TArray< FTransform > & ObjectTransforms )
 {
     InstancedTransforms = ObjectTransforms;
+
+    // The instance count may have crossed the hierarchical threshold, swap plain and hierarchical components if needed.
+    for ( int32 Idx = 0; Idx < InstancedObjects.Num() && Idx < InstancerComponents.Num(); ++Idx )
+    {
+        UInstancedStaticMeshComponent * ISMC = Cast< UInstancedStaticMeshComponent >( InstancerComponents[ Idx ] );
+        if ( !ISMC || ISMC->IsPendingKill() )
+            continue;
+
+        bool bIsHierarchical = ISMC->IsA< UHierarchicalInstancedStaticMeshComponent >();
+        if ( bIsHierarchical != NeedsHierarchicalInstancing( Cast< UStaticMesh >( InstancedObjects[ Idx ] ) ) )
+            RecreateInstanceComponent( Idx );
+    }
+
     UpdateInstanceTransforms( true );
 }
 
 void
-UHoudiniAssetInstanceInputField::UpdateInstanceTransforms( bool RecomputeVariationAssignments )
+UHoudiniAssetInstanceInputField::UpdateInstanceTransforms( bool RecomputeVariationAssignments, int32 OnlyVariationIdx )
 {
     int32 VariationCount = InstanceVariationCount();
 
-    int nSeed = 1234;
     if ( RecomputeVariationAssignments )
     {
-        VariationTransformsArray.Empty();
-        VariationTransformsArray.SetNum(VariationCount);
-
-        VariationInstanceColorOverrideArray.Empty();
-        VariationInstanceColorOverrideArray.SetNum(VariationCount);
-
-        for ( int32 Idx = 0; Idx < InstancedTransforms.Num(); Idx++ )
+        // The assignment of an instance only depends on its index and the variation count,
+        // so the table only needs rebuilding when one of those changed.
+        if ( InstanceVariationAssignments.Num() != InstancedTransforms.Num()
+            || InstanceVariationAssignmentsCount != VariationCount )
         {
-            int32 VariationIndex = fastrand(nSeed) % VariationCount;
-            if ( VariationTransformsArray.IsValidIndex(VariationIndex) )
-                VariationTransformsArray[ VariationIndex ].Add(InstancedTransforms[Idx]);
+            int nSeed = 1234;
+            InstanceVariationAssignments.SetNumUninitialized( InstancedTransforms.Num() );
+            for ( int32 Idx = 0; Idx < InstancedTransforms.Num(); Idx++ )
+                InstanceVariationAssignments[ Idx ] = VariationCount > 0 ? fastrand( nSeed ) % VariationCount : INDEX_NONE;
 
-            if( InstanceColorOverride.Num() > Idx )
-            {
-                if ( VariationInstanceColorOverrideArray.IsValidIndex( VariationIndex )
-                    && InstanceColorOverride.IsValidIndex(Idx) )
-                    VariationInstanceColorOverrideArray[VariationIndex].Add(InstanceColorOverride[Idx]);
-            }
+            InstanceVariationAssignmentsCount = VariationCount;
         }
+
+        BucketInstanceValuesByVariation(
+            InstanceVariationAssignments, VariationCount, InstancedTransforms, VariationTransformsArray );
+        BucketInstanceValuesByVariation(
+            InstanceVariationAssignments, VariationCount, InstanceColorOverride, VariationInstanceColorOverrideArray );
     }
 
     for ( int32 Idx = 0; Idx < VariationCount; Idx++ )
     {
+        if ( OnlyVariationIdx != INDEX_NONE && Idx != OnlyVariationIdx )
+            continue;
+
         if ( !InstancerComponents.IsValidIndex( Idx )
             || !VariationTransformsArray.IsValidIndex( Idx )
             || !VariationInstanceColorOverrideArray.IsValidIndex( Idx ) )
@@ -549,21 +624,18 @@ UHoudiniAssetInstanceInputField::ReplaceInstanceVariation( UObject * InObject, i
     bool bComponentNeedToBeCreated = true;
     if ( bInIsStaticMesh == bCurrentIsStaticMesh )
     {
-        // If the in mesh has LODs, we need a Hierarchical ISMC
-        UStaticMesh* StaticMesh = Cast< UStaticMesh >( InObject );
-        bool bInHasLODs = false;
-        if ( StaticMesh && !StaticMesh->IsPendingKill() && ( StaticMesh->GetNumLODs() > 1 ) )
-            bInHasLODs = true;
+        // If the in mesh has LODs or many instances, we need a Hierarchical ISMC
+        bool bInNeedsHierarchical = NeedsHierarchicalInstancing( Cast< UStaticMesh >( InObject ) );
 
         // We'll try to reuse the InstanceComponent
         if ( UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>( InstancerComponents[ Index ] ) )
         {
-            // If we have LODs, make sure we the component is a HISM
+            // If we need a HISM, make sure we the component is a HISM
             // If we don't, make sure the component is not a HISM
             UHierarchicalInstancedStaticMeshComponent* HISMC = Cast<UHierarchicalInstancedStaticMeshComponent>( InstancerComponents[ Index ] );
-            if ( !HISMC && bInHasLODs )
+            if ( !HISMC && bInNeedsHierarchical )
                 bComponentNeedToBeCreated = true;
-            else if ( HISMC && !bInHasLODs )
+            else if ( HISMC && !bInNeedsHierarchical )
                 bComponentNeedToBeCreated = true;
             else if ( !ISMC->IsPendingKill() )
             {
@@ -592,23 +664,11 @@ UHoudiniAssetInstanceInputField::ReplaceInstanceVariation( UObject * InObject, i
     if ( bComponentNeedToBeCreated )
     {
         // We'll create a new InstanceComponent
-        FTransform SavedXform = FTransform::Identity;
-
-        if ( InstancerComponents.IsValidIndex( Index ) )
-        {
-            if ( InstancerComponents[ Index ] )
-            {
-                SavedXform = InstancerComponents[ Index ]->GetRelativeTransform();
-                InstancerComponents[ Index ]->DestroyComponent();
-            }
-            InstancerComponents.RemoveAt( Index );
-        }
-
-        AddInstanceComponent( Index );
-        InstancerComponents[ Index ]->SetRelativeTransform( SavedXform );
+        RecreateInstanceComponent( Index );
     }
 
-    UpdateInstanceTransforms( false );
+    // Only this variation's component changed.
+    UpdateInstanceTransforms( false, Index );
     UpdateInstanceUPropertyAttributes();
 }
 
@@ -708,7 +768,11 @@ UHoudiniAssetInstanceInputField::RecreateRenderState()
     for ( auto Comp : InstancerComponents )
     {
         UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>(Comp);
-        if ( ISMC && !ISMC->IsPendingKill() )
+        if ( !ISMC || ISMC->IsPendingKill() || !ISMC->IsRegistered() )
+            continue;
+
+        // Components without a render state create it themselves once they are visible.
+        if ( ISMC->IsRenderStateCreated() && ISMC->IsVisible() )
             ISMC->RecreateRenderState_Concurrent();
     }
 }
@@ -720,7 +784,11 @@ UHoudiniAssetInstanceInputField::RecreatePhysicsState()
     for ( auto Comp : InstancerComponents )
     {
         UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>(Comp);
-        if ( ISMC && !ISMC->IsPendingKill() )
+        if ( !ISMC || ISMC->IsPendingKill() || !ISMC->IsRegistered() )
+            continue;
+
+        // Building per-instance bodies is expensive, skip components that have no collision.
+        if ( ISMC->IsCollisionEnabled() || ISMC->IsPhysicsStateCreated() )
             ISMC->RecreatePhysicsState();
     }
 }
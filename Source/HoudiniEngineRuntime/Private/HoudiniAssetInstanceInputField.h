@@ -153,14 +153,20 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInputField : public UObject
         /** Create instanced component for this field. **/
         void AddInstanceComponent( int32 VariationIdx );
 
+        /** Destroy and create again the instanced component of a variation, keeping its relative transform. **/
+        void RecreateInstanceComponent( int32 VariationIdx );
+
+        /** Return true if given mesh should be instanced by a hierarchical instanced static mesh component. **/
+        bool NeedsHierarchicalInstancing( UStaticMesh * StaticMesh ) const;
+
         /** Set transforms for this field. **/
         void SetInstanceTransforms( const TArray< FTransform > & ObjectTransforms );
 
         /** Update relative transform for this field. **/
         void UpdateRelativeTransform();
 
-        /** Update instance transformations. **/
-        void UpdateInstanceTransforms( bool RecomputeVariationAssignments );
+        /** Update instance transformations, of all variations or only of the given one. **/
+        void UpdateInstanceTransforms( bool RecomputeVariationAssignments, int32 OnlyVariationIdx = INDEX_NONE );
 
     protected:
 
@@ -185,6 +191,10 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInputField : public UObject
         /** Assignment of Transforms to each variation **/
         TArray< TArray< FTransform > > VariationTransformsArray;
 
+        /** Variation of each instance, and the variation count it was computed for. **/
+        TArray< int32 > InstanceVariationAssignments;
+        int32 InstanceVariationAssignmentsCount = 0;
+
         /** Color overrides, one per instance **/
         TArray<FLinearColor> InstanceColorOverride;
 
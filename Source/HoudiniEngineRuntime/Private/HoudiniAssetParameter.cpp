@@ -58,6 +58,7 @@ UHoudiniAssetParameter::UHoudiniAssetParameter( const FObjectInitializer & Objec
     , ValuesIndex( -1 )
     , MultiparmInstanceIndex( -1 )
     , ActiveChildParameter( 0 )
+    , LastSliderDragCookTime( 0.0 )
     , HoudiniAssetParameterFlagsPacked( 0u )
     , HoudiniAssetParameterVersion( VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_BASE )
 {
@@ -164,6 +165,13 @@ UHoudiniAssetParameter::SetParameterVariantValue( const FVariant& Variant, int32
     return false;
 }
 
+bool
+UHoudiniAssetParameter::CopyValuesFrom( const UHoudiniAssetParameter * OtherParameter )
+{
+    // Default implementation does nothing.
+    return false;
+}
+
 bool
 UHoudiniAssetParameter::HasChanged() const
 {
@@ -389,9 +397,16 @@ UHoudiniAssetParameter::MarkChanged( bool bMarkAndTriggerUpdate )
     if( bMarkAndTriggerUpdate )
     {
         if( UHoudiniAssetComponent* Component = Cast<UHoudiniAssetComponent>(PrimaryObject) )
+        {
             if ( !Component->IsPendingKill() )
+            {
                 Component->NotifyParameterChanged( this );
 
+                // Apply the change to the other components selected with this one.
+                Component->PropagateParameterChange( this );
+            }
+        }
+
         // Notify parent parameter about change.
         if( ParentParameter && !ParentParameter->IsPendingKill() )
             ParentParameter->NotifyChildParameterChanged( this );
@@ -400,6 +415,34 @@ UHoudiniAssetParameter::MarkChanged( bool bMarkAndTriggerUpdate )
 #endif // WITH_EDITOR
 }
 
+void
+UHoudiniAssetParameter::MarkChangedDuringSliderDrag()
+{
+#if WITH_EDITOR
+
+    UHoudiniAssetComponent * Component = Cast< UHoudiniAssetComponent >( PrimaryObject );
+    if ( Component && Component->bSliderDragTriggersCooks )
+    {
+        // Values set in between two preview cooks are coalesced, the latest one is uploaded with the next cook.
+        // The scheduler also coalesces the cooks queued while one is still running.
+        const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+        const float CookInterval = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->SliderDragCookInterval : 0.0f;
+
+        const double CurrentTime = FPlatformTime::Seconds();
+        if ( CurrentTime - LastSliderDragCookTime >= CookInterval )
+        {
+            LastSliderDragCookTime = CurrentTime;
+            MarkChanged( true );
+            return;
+        }
+    }
+
+#endif // WITH_EDITOR
+
+    // The final value is cooked when the slider is released.
+    MarkChanged( false );
+}
+
 void
 UHoudiniAssetParameter::UnmarkChanged()
 {
@@ -436,6 +479,25 @@ UHoudiniAssetParameter::GetActiveChildParameter() const
     return ActiveChildParameter;
 }
 
+void
+UHoudiniAssetParameter::SetActiveChildParameter( int32 InActiveChildParameter )
+{
+    if ( ActiveChildParameter == InActiveChildParameter )
+        return;
+
+    ActiveChildParameter = InActiveChildParameter;
+
+#if WITH_EDITOR
+    if ( UHoudiniAssetComponent * Comp = Cast< UHoudiniAssetComponent >( PrimaryObject ) )
+    {
+        if ( !Comp->IsPendingKill() )
+            Comp->CreateDeferredParameters();
+    }
+#endif
+
+    OnParamStateChanged();
+}
+
 void UHoudiniAssetParameter::OnParamStateChanged()
 {
 #if WITH_EDITOR
@@ -69,6 +69,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameter : public UObject
             bool bTriggerModify = true,
             bool bRecordUndo = true );
 
+        /** Copy the value of a parameter of the same type, used when editing several components. **/
+        virtual bool CopyValuesFrom( const UHoudiniAssetParameter * OtherParameter );
+
         /** Notification from a child parameter about its change. **/
         virtual void NotifyChildParameterChanged( UHoudiniAssetParameter * HoudiniAssetParameter );
 
@@ -116,6 +119,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameter : public UObject
         /** Return true if given parameter is an active child parameter. **/
         bool IsActiveChildParameter( UHoudiniAssetParameter * ChildParameter ) const;
 
+        /** Return index of active child parameter. **/
+        int32 GetActiveChildParameter() const;
+
+        /** Set the active child parameter, the parameters of a folder tab are created once it is activated. **/
+        void SetActiveChildParameter( int32 InActiveChildParameter );
+
         /** Return true if this parameter contains child parameters. **/
         bool HasChildParameters() const;
 
@@ -163,15 +172,15 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameter : public UObject
         /** Mark this parameter as changed. This occurs when user modifies the value of this parameter through UI. **/
         void MarkChanged( bool bMarkAndTriggerUpdate = true );
 
+        /** Mark this parameter as changed while its slider is dragged, triggering throttled preview cooks if enabled. **/
+        void MarkChangedDuringSliderDrag();
+
         /** Return true if this parameter is an array (has tuple size larger than one). **/
         bool IsArray() const;
 
         /** Sets internal value index used by this parameter. **/
         void SetValuesIndex( int32 InValuesIndex );
 
-        /** Return index of active child parameter. **/
-        int32 GetActiveChildParameter() const;
-
         /** Called when state of the parameter changes as side-effect of some action */
         void OnParamStateChanged();
 
@@ -225,6 +234,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameter : public UObject
         /** The parameter's help, to be used as a tooltip **/
         FString ParameterHelp;
 
+        /** Time of the last preview cook triggered while the slider is dragged. Transient. **/
+        double LastSliderDragCookTime;
+
         /** Flags used by this parameter. **/
         union
         {
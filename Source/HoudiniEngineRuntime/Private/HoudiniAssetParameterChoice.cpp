@@ -28,6 +28,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniParamUtils.h"
 
 #include "Misc/Variant.h"
 #include "Internationalization/Internationalization.h"
@@ -91,9 +92,7 @@ UHoudiniAssetParameterChoice::CreateParameter(
         // Assign internal Hapi values index.
         SetValuesIndex( ParmInfo.intValuesIndex );
 
-        if ( FHoudiniApi::GetParmIntValues(
-            FHoudiniEngine::Get().GetSession(), NodeId, &CurrentValue,
-            ValuesIndex, TupleSize) != HAPI_RESULT_SUCCESS )
+        if ( !FHoudiniParamUtils::GetParmIntValues( NodeId, &CurrentValue, ValuesIndex, TupleSize ) )
         {
             return false;
         }
@@ -112,9 +111,7 @@ UHoudiniAssetParameterChoice::CreateParameter(
         SetValuesIndex( ParmInfo.stringValuesIndex );
 
         HAPI_StringHandle StringHandle;
-        if ( FHoudiniApi::GetParmStringValues(
-            FHoudiniEngine::Get().GetSession(), NodeId, false,
-            &StringHandle, ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+        if ( !FHoudiniParamUtils::GetParmStringValues( NodeId, &StringHandle, ValuesIndex, TupleSize ) )
         {
             return false;
         }
@@ -128,9 +125,7 @@ UHoudiniAssetParameterChoice::CreateParameter(
     // Get choice descriptors.
     TArray< HAPI_ParmChoiceInfo > ParmChoices;
     ParmChoices.SetNumZeroed( ParmInfo.choiceCount );
-    if ( FHoudiniApi::GetParmChoiceLists(
-        FHoudiniEngine::Get().GetSession(), NodeId, &ParmChoices[ 0 ],
-        ParmInfo.choiceIndex, ParmInfo.choiceCount ) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::GetParmChoiceLists( NodeId, &ParmChoices[ 0 ], ParmInfo.choiceIndex, ParmInfo.choiceCount ) )
     {
         return false;
     }
@@ -238,7 +233,7 @@ UHoudiniAssetParameterChoice::UploadParameterValue()
     else
     {
         // This is an int choice list.
-        FHoudiniApi::SetParmIntValues( FHoudiniEngine::Get().GetSession(), NodeId, &CurrentValue, ValuesIndex, TupleSize );
+        FHoudiniParamUtils::SetParmIntValues( NodeId, &CurrentValue, ValuesIndex, TupleSize );
     }
 
     return Super::UploadParameterValue();
@@ -331,6 +326,28 @@ UHoudiniAssetParameterChoice::SetParameterVariantValue( const FVariant & Variant
     return false;
 }
 
+bool
+UHoudiniAssetParameterChoice::CopyValuesFrom( const UHoudiniAssetParameter * OtherParameter )
+{
+    const UHoudiniAssetParameterChoice * OtherChoice = Cast< const UHoudiniAssetParameterChoice >( OtherParameter );
+    if ( !OtherChoice || OtherChoice->bStringChoiceList != bStringChoiceList )
+        return false;
+
+    // The other parameter's choices may differ, only take values that exist here.
+    if ( bStringChoiceList && !StringChoiceValues.IsValidIndex( OtherChoice->CurrentValue ) )
+        return false;
+
+    if ( OtherChoice->CurrentValue == CurrentValue )
+        return true;
+
+    Modify();
+    CurrentValue = OtherChoice->CurrentValue;
+    StringValue = OtherChoice->StringValue;
+    MarkChanged();
+
+    return true;
+}
+
 void
 UHoudiniAssetParameterChoice::Serialize( FArchive & Ar )
 {
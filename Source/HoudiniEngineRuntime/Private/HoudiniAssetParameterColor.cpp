@@ -26,6 +26,7 @@
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
+#include "HoudiniParamUtils.h"
 
 #include "Misc/Variant.h"
 #include "Internationalization/Internationalization.h"
@@ -94,9 +95,7 @@ UHoudiniAssetParameterColor::CreateParameter(
 
     // Get the actual value for this property.
     Color = FLinearColor::White;
-    if ( FHoudiniApi::GetParmFloatValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId,
-        (float *) &Color.R, ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::GetParmFloatValues( InNodeId, (float *) &Color.R, ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -110,8 +109,7 @@ UHoudiniAssetParameterColor::CreateParameter(
 bool
 UHoudiniAssetParameterColor::UploadParameterValue()
 {
-    if ( FHoudiniApi::SetParmFloatValues(
-        FHoudiniEngine::Get().GetSession(), NodeId, (const float*)&Color.R, ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::SetParmFloatValues( NodeId, (const float*)&Color.R, ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -159,6 +157,23 @@ UHoudiniAssetParameterColor::SetParameterVariantValue( const FVariant& Variant,
     return true;
 }
 
+bool
+UHoudiniAssetParameterColor::CopyValuesFrom( const UHoudiniAssetParameter * OtherParameter )
+{
+    const UHoudiniAssetParameterColor * OtherColor = Cast< const UHoudiniAssetParameterColor >( OtherParameter );
+    if ( !OtherColor )
+        return false;
+
+    if ( OtherColor->Color == Color )
+        return true;
+
+    Modify();
+    Color = OtherColor->Color;
+    MarkChanged();
+
+    return true;
+}
+
 FLinearColor
 UHoudiniAssetParameterColor::GetColor() const
 {
@@ -29,6 +29,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniAsset.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniParamUtils.h"
 
 #include "Internationalization/Internationalization.h"
 #include "Misc/Paths.h"
@@ -121,9 +122,7 @@ UHoudiniAssetParameterFile::CreateParameter(
     // Get the actual value for this property.
     TArray< HAPI_StringHandle > StringHandles;
     StringHandles.SetNum( TupleSize );
-    if ( FHoudiniApi::GetParmStringValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId, false,
-        &StringHandles[ 0 ], ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::GetParmStringValues( InNodeId, &StringHandles[ 0 ], ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -224,6 +223,23 @@ UHoudiniAssetParameterFile::SetParameterVariantValue(
     return false;
 }
 
+bool
+UHoudiniAssetParameterFile::CopyValuesFrom( const UHoudiniAssetParameter * OtherParameter )
+{
+    const UHoudiniAssetParameterFile * OtherFile = Cast< const UHoudiniAssetParameterFile >( OtherParameter );
+    if ( !OtherFile || OtherFile->Values.Num() != Values.Num() )
+        return false;
+
+    if ( OtherFile->Values == Values )
+        return true;
+
+    Modify();
+    Values = OtherFile->Values;
+    MarkChanged();
+
+    return true;
+}
+
 #if WITH_EDITOR
 
 void
@@ -60,6 +60,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameterFile : public UHoudiniAsset
             const FVariant & Variant, int32 Idx = 0, bool bTriggerModify = true,
             bool bRecordUndo = true ) override;
 
+        /** Copy the value of a parameter of the same type. **/
+        virtual bool CopyValuesFrom( const UHoudiniAssetParameter * OtherParameter ) override;
+
     /** UObject methods. **/
     public:
 
@@ -28,6 +28,7 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniParamUtils.h"
 
 #include "Misc/Variant.h"
 #include "Internationalization/Internationalization.h"
@@ -116,9 +117,7 @@ UHoudiniAssetParameterFloat::CreateParameter(
     Values.SetNumZeroed(TupleSize);
 
     // Get the actual value for this property.
-    if ( FHoudiniApi::GetParmFloatValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::GetParmFloatValues( InNodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -213,8 +212,7 @@ UHoudiniAssetParameterFloat::CreateParameter(
 bool
 UHoudiniAssetParameterFloat::UploadParameterValue()
 {
-    if ( FHoudiniApi::SetParmFloatValues( FHoudiniEngine::Get().GetSession(), NodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::SetParmFloatValues( NodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -258,6 +256,23 @@ UHoudiniAssetParameterFloat::SetParameterVariantValue( const FVariant & Variant,
     return true;
 }
 
+bool
+UHoudiniAssetParameterFloat::CopyValuesFrom( const UHoudiniAssetParameter * OtherParameter )
+{
+    const UHoudiniAssetParameterFloat * OtherFloat = Cast< const UHoudiniAssetParameterFloat >( OtherParameter );
+    if ( !OtherFloat || OtherFloat->Values.Num() != Values.Num() )
+        return false;
+
+    if ( OtherFloat->Values == Values )
+        return true;
+
+    Modify();
+    Values = OtherFloat->Values;
+    MarkChanged();
+
+    return true;
+}
+
 TOptional< float >
 UHoudiniAssetParameterFloat::GetValue( int32 Idx ) const
 {
@@ -287,7 +302,10 @@ UHoudiniAssetParameterFloat::SetValue( float InValue, int32 Idx, bool bTriggerMo
         Values[ Idx ] = FMath::Clamp< float >( InValue, ValueMin, ValueMax );
 
         // Mark this parameter as changed.
-        MarkChanged( bTriggerModify );
+        if ( bSliderDragged && !bTriggerModify )
+            MarkChangedDuringSliderDrag();
+        else
+            MarkChanged( bTriggerModify );
     }
 }
 
@@ -306,6 +324,7 @@ void
 UHoudiniAssetParameterFloat::OnSliderMovingBegin( int32 Idx )
 {
     bSliderDragged = true;
+    LastSliderDragCookTime = 0.0;
     
     // We want to record undo increments only when user lets go of the slider.
     FScopedTransaction Transaction(
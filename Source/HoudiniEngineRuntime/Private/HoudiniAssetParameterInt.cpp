@@ -27,6 +27,7 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniParamUtils.h"
 
 #include "Misc/Variant.h"
 #include "Internationalization/Internationalization.h"
@@ -85,9 +86,7 @@ UHoudiniAssetParameterInt::CreateParameter(
 
     // Get the actual value for this property.
     Values.SetNumZeroed( TupleSize );
-    if ( FHoudiniApi::GetParmIntValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::GetParmIntValues( InNodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -145,9 +144,7 @@ UHoudiniAssetParameterInt::CreateParameter(
 bool
 UHoudiniAssetParameterInt::UploadParameterValue()
 {
-    if ( FHoudiniApi::SetParmIntValues(
-        FHoudiniEngine::Get().GetSession(), NodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::SetParmIntValues( NodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -205,6 +202,23 @@ UHoudiniAssetParameterInt::SetParameterVariantValue( const FVariant & Variant, i
     return true;
 }
 
+bool
+UHoudiniAssetParameterInt::CopyValuesFrom( const UHoudiniAssetParameter * OtherParameter )
+{
+    const UHoudiniAssetParameterInt * OtherInt = Cast< const UHoudiniAssetParameterInt >( OtherParameter );
+    if ( !OtherInt || OtherInt->Values.Num() != Values.Num() )
+        return false;
+
+    if ( OtherInt->Values == Values )
+        return true;
+
+    Modify();
+    Values = OtherInt->Values;
+    MarkChanged();
+
+    return true;
+}
+
 TOptional< int32 >
 UHoudiniAssetParameterInt::GetValue( int32 Idx ) const
 {
@@ -236,7 +250,10 @@ UHoudiniAssetParameterInt::SetValue( int32 InValue, int32 Idx, bool bTriggerModi
         Values[ Idx ] = FMath::Clamp< int32 >( InValue, ValueMin, ValueMax );
 
         // Mark this parameter as changed.
-        MarkChanged( bTriggerModify );
+        if ( bSliderDragged && !bTriggerModify )
+            MarkChangedDuringSliderDrag();
+        else
+            MarkChanged( bTriggerModify );
     }
 }
 
@@ -255,6 +272,7 @@ void
 UHoudiniAssetParameterInt::OnSliderMovingBegin( int32 Idx )
 {
     bSliderDragged = true;
+    LastSliderDragCookTime = 0.0;
 
     // We want to record undo increments only when user lets go of the slider.
     FScopedTransaction Transaction(
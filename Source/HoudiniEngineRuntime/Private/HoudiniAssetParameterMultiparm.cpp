@@ -27,6 +27,7 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniParamUtils.h"
 
 #include "Internationalization/Internationalization.h"
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
@@ -34,6 +35,7 @@
 UHoudiniAssetParameterMultiparm::UHoudiniAssetParameterMultiparm( const FObjectInitializer & ObjectInitializer )
     : Super( ObjectInitializer )
     , MultiparmValue( 0 )
+    , PendingMultiparmValue( -1 )
     , LastModificationType( RegularValueChange )
     , LastRemoveAddInstanceIndex( -1 )
 {}
@@ -79,10 +81,10 @@ UHoudiniAssetParameterMultiparm::CreateParameter(
 
     // Get the actual value for this property.
     MultiparmValue = 0;
-    HOUDINI_CHECK_ERROR_RETURN(
-        FHoudiniApi::GetParmIntValues( 
-            FHoudiniEngine::Get().GetSession(), InNodeId, &MultiparmValue, ValuesIndex, 1 )
-        , false );
+    PendingMultiparmValue = -1;
+    if ( !FHoudiniParamUtils::GetParmIntValues( InNodeId, &MultiparmValue, ValuesIndex, 1 ) )
+        return false;
+
     return true;
 }
 
@@ -151,6 +153,9 @@ UHoudiniAssetParameterMultiparm::RemoveMultiparmInstance( int32 ChildMultiparmIn
 bool
 UHoudiniAssetParameterMultiparm::UploadParameterValue()
 {
+    // Changing the instance count moves the values of the following parameters, send the queued ones first.
+    FHoudiniParamUtils::FlushParmValueUploads();
+
     if ( FHoudiniApi::SetParmIntValues(
         FHoudiniEngine::Get().GetSession(), NodeId,
         &MultiparmValue, ValuesIndex, 1 ) != HAPI_RESULT_SUCCESS )
@@ -164,33 +169,56 @@ UHoudiniAssetParameterMultiparm::UploadParameterValue()
 TOptional< int32 >
 UHoudiniAssetParameterMultiparm::GetValue() const
 {
+    if ( PendingMultiparmValue >= 0 )
+        return TOptional< int32 >( PendingMultiparmValue );
+
     return TOptional< int32 >( MultiparmValue );
 }
 
 void
 UHoudiniAssetParameterMultiparm::SetValue( int32 InValue )
 {
-    if ( MultiparmValue != InValue )
-    {
-        LastModificationType = RegularValueChange;
-        LastRemoveAddInstanceIndex = -1;
+    SetInstanceCount( InValue );
+}
+
+void
+UHoudiniAssetParameterMultiparm::SetPendingValue( int32 InValue )
+{
+    PendingMultiparmValue = FMath::Max( InValue, 0 );
+}
+
+void
+UHoudiniAssetParameterMultiparm::SetInstanceCount( int32 InNumInstances, bool bTriggerModify, bool bRecordUndo )
+{
+    PendingMultiparmValue = -1;
+
+    InNumInstances = FMath::Max( InNumInstances, 0 );
+    if ( MultiparmValue == InNumInstances )
+        return;
+
+    // The whole resize is a single value change: the count is uploaded once, the asset cooks once
+    // and the child parameters are rebuilt once afterwards, however many instances are added or removed.
+    LastModificationType = RegularValueChange;
+    LastRemoveAddInstanceIndex = -1;
 
 #if WITH_EDITOR
 
-        // Record undo information.
-        FScopedTransaction Transaction(
-            TEXT( HOUDINI_MODULE_RUNTIME ),
-            LOCTEXT( "HoudiniAssetParameterMultiparmChange", "Houdini Parameter Multiparm: Changing a value" ),
-            PrimaryObject );
-        Modify();
+    // Record undo information.
+    FScopedTransaction Transaction(
+        TEXT( HOUDINI_MODULE_RUNTIME ),
+        LOCTEXT( "HoudiniAssetParameterMultiparmChange", "Houdini Parameter Multiparm: Changing a value" ),
+        PrimaryObject );
+    Modify();
+
+    if ( !bRecordUndo )
+        Transaction.Cancel();
 
 #endif
 
-        MultiparmValue = InValue;
+    MultiparmValue = InNumInstances;
 
-        // Mark this parameter as changed.
-        MarkChanged();
-    }
+    // Mark this parameter as changed.
+    MarkChanged( bTriggerModify );
 }
 
 void
@@ -203,28 +231,7 @@ void
 UHoudiniAssetParameterMultiparm::AddElements( int32 NumElements, bool bTriggerModify, bool bRecordUndo )
 {
     if ( NumElements > 0 )
-    {
-        LastModificationType = RegularValueChange;
-        LastRemoveAddInstanceIndex = -1;
-
-#if WITH_EDITOR
-
-        // Record undo information.
-        FScopedTransaction Transaction(
-            TEXT( HOUDINI_MODULE_RUNTIME ),
-            LOCTEXT( "HoudiniAssetParameterMultiparmChange", "Houdini Parameter Multiparm: Changing a value" ),
-            PrimaryObject );
-        Modify();
-
-        if ( !bRecordUndo )
-            Transaction.Cancel();
-
-#endif
-
-        MultiparmValue += NumElements;
-
-        MarkChanged( bTriggerModify );
-    }
+        SetInstanceCount( MultiparmValue + NumElements, bTriggerModify, bRecordUndo );
 }
 
 void
@@ -237,31 +244,7 @@ void
 UHoudiniAssetParameterMultiparm::RemoveElements( int32 NumElements, bool bTriggerModify, bool bRecordUndo )
 {
     if ( NumElements > 0 )
-    {
-        if ( MultiparmValue - NumElements < 0 )
-            NumElements = MultiparmValue;
-
-        LastModificationType = RegularValueChange;
-        LastRemoveAddInstanceIndex = -1;
-
-#if WITH_EDITOR
-
-        // Record undo information.
-        FScopedTransaction Transaction(
-            TEXT( HOUDINI_MODULE_RUNTIME ),
-            LOCTEXT( "HoudiniAssetParameterMultiparmChange", "Houdini Parameter Multiparm: Changing a value" ),
-            PrimaryObject );
-        Modify();
-
-        if ( !bRecordUndo )
-            Transaction.Cancel();
-
-#endif
-
-        MultiparmValue -= NumElements;
-
-        MarkChanged( bTriggerModify );
-    }
+        SetInstanceCount( MultiparmValue - NumElements, bTriggerModify, bRecordUndo );
 }
 
 void
@@ -279,7 +262,10 @@ UHoudiniAssetParameterMultiparm::Serialize( FArchive & Ar )
     }
 
     if ( Ar.IsLoading() )
+    {
         MultiparmValue = 0;
+        PendingMultiparmValue = -1;
+    }
 
     Ar << MultiparmValue;
 }
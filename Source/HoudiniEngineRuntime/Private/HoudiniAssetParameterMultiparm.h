@@ -80,6 +80,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameterMultiparm : public UHoudini
         /** Set value of this property, used by Slate. **/
         void SetValue( int32 InValue );
 
+        /** Preview a value while it is being dragged in Slate, nothing is uploaded until it is committed. **/
+        void SetPendingValue( int32 InValue );
+
+        /** Resize this multiparm to the given number of instances as a single change. **/
+        void SetInstanceCount( int32 InNumInstances, bool bTriggerModify = true, bool bRecordUndo = true );
+
         /** Increment value, used by Slate. **/
         void AddElement( bool bTriggerModify = true, bool bRecordUndo = true );
         void AddElements( int32 NumElements, bool bTriggerModify = true, bool bRecordUndo = true );
@@ -93,6 +99,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameterMultiparm : public UHoudini
         /** Value of this property. **/
         int32 MultiparmValue;
 
+        /** Value previewed by Slate while dragging, -1 if none. **/
+        int32 PendingMultiparmValue;
+
     private:
 
         enum ModificationType
@@ -304,6 +304,11 @@ UHoudiniAssetParameterRamp::CreateParameter(
     UHoudiniAssetParameter * InParentParameter,
     HAPI_NodeId InNodeId, const HAPI_ParmInfo & ParmInfo )
 {
+    // Child parameters are reset, so are their cached keys.
+    RampKeyPositions.Empty();
+    RampKeyValues.Empty();
+    RampKeyInterpolations.Empty();
+
     if ( !Super::CreateParameter( InPrimaryObject, InParentParameter, InNodeId, ParmInfo ) )
         return false;
 
@@ -326,13 +331,15 @@ UHoudiniAssetParameterRamp::CreateParameter(
 void
 UHoudiniAssetParameterRamp::NotifyChildParametersCreated()
 {
+    CacheRampKeyParameters();
+
     if ( bIsCurveUploadRequired )
     {
         bIsCurveChanged = true;
         OnCurveEditingFinished();
         bIsCurveUploadRequired = false;
     }
-    else
+    else if ( !IsCurveInSync() )
     {
         GenerateCurvePoints();
 
@@ -438,6 +445,7 @@ UHoudiniAssetParameterRamp::OnCurveEditingFinished()
             return;
 
         bIsCurveChanged = false;
+        bool bKeysChanged = false;
 
         if ( HoudiniAssetParameterRampCurveFloat && !HoudiniAssetParameterRampCurveFloat->IsPendingKill() )
         {
@@ -455,20 +463,29 @@ UHoudiniAssetParameterRamp::OnCurveEditingFinished()
 
                 const FRichCurveKey & RichCurveKey = RichCurve.Keys[ KeyIdx ];
 
-                if ( !ChildParamPosition->IsPendingKill() )
+                // Only the key parameters that differ are marked as changed and uploaded.
+                if ( !ChildParamPosition->IsPendingKill() && ChildParamPosition->GetParameterValue( 0, 0.0f ) != RichCurveKey.Time )
+                {
                     ChildParamPosition->SetValue( RichCurveKey.Time, 0, false, false );
+                    bKeysChanged = true;
+                }
 
-                if ( !ChildParamValue->IsPendingKill() )
+                if ( !ChildParamValue->IsPendingKill() && ChildParamValue->GetParameterValue( 0, 0.0f ) != RichCurveKey.Value )
+                {
                     ChildParamValue->SetValue( RichCurveKey.Value, 0, false, false );
+                    bKeysChanged = true;
+                }
 
                 EHoudiniAssetParameterRampKeyInterpolation::Type RichCurveKeyInterpolation =
                     TranslateUnrealRampKeyInterpolation( RichCurveKey.InterpMode );
 
-                if ( !ChildParamInterpolation->IsPendingKill() )
+                if ( !ChildParamInterpolation->IsPendingKill()
+                    && ChildParamInterpolation->GetParameterValueInt() != (int32) RichCurveKeyInterpolation )
+                {
                     ChildParamInterpolation->SetValueInt( (int32) RichCurveKeyInterpolation, false, false );
+                    bKeysChanged = true;
+                }
             }
-
-            MarkChanged();
         }
         else if ( HoudiniAssetParameterRampCurveColor )
         {
@@ -492,22 +509,43 @@ UHoudiniAssetParameterRamp::OnCurveEditingFinished()
                 const FRichCurveKey & RichCurveKeyB = RichCurveB.Keys[ KeyIdx ];
                 //const FRichCurveKey & RichCurveKeyA = RichCurveA.Keys[ KeyIdx ];
 
-                if ( !ChildParamPosition->IsPendingKill() )
+                if ( !ChildParamPosition->IsPendingKill() && ChildParamPosition->GetParameterValue( 0, 0.0f ) != RichCurveKeyR.Time )
+                {
                     ChildParamPosition->SetValue( RichCurveKeyR.Time, 0, false, false );
+                    bKeysChanged = true;
+                }
 
                 FLinearColor KeyColor( RichCurveKeyR.Value, RichCurveKeyG.Value, RichCurveKeyB.Value, 1.0f );
-                if ( !ChildParamColor->IsPendingKill() )
+                if ( !ChildParamColor->IsPendingKill() && ChildParamColor->GetColor() != KeyColor )
+                {
                     ChildParamColor->OnPaintColorChanged( KeyColor, false, false );
+                    bKeysChanged = true;
+                }
 
                 EHoudiniAssetParameterRampKeyInterpolation::Type RichCurveKeyInterpolation =
                     TranslateUnrealRampKeyInterpolation( RichCurveKeyR.InterpMode );
 
-                if ( !ChildParamInterpolation->IsPendingKill() )
+                if ( !ChildParamInterpolation->IsPendingKill()
+                    && ChildParamInterpolation->GetParameterValueInt() != (int32) RichCurveKeyInterpolation )
+                {
                     ChildParamInterpolation->SetValueInt( (int32) RichCurveKeyInterpolation, false, false );
+                    bKeysChanged = true;
+                }
             }
+        }
 
-            MarkChanged();
+        // The changed keys are uploaded with the other changed parameters. The ramp itself isn't marked
+        // as changed, as its number of keys is the same and doesn't need to be uploaded again.
+#if WITH_EDITOR
+        if ( bKeysChanged )
+        {
+            if ( UHoudiniAssetComponent * Component = Cast< UHoudiniAssetComponent >( PrimaryObject ) )
+            {
+                if ( !Component->IsPendingKill() )
+                    Component->NotifyParameterChanged( this );
+            }
         }
+#endif
     }
 }
 
@@ -644,6 +682,17 @@ UHoudiniAssetParameterRamp::GetRampKeysCurveFloat(
     Value = nullptr;
     Interp = nullptr;
 
+    if ( HasValidRampKeyParameters() )
+    {
+        if ( !RampKeyPositions.IsValidIndex( Idx ) )
+            return false;
+
+        Position = RampKeyPositions[ Idx ];
+        Value = Cast< UHoudiniAssetParameterFloat >( RampKeyValues[ Idx ] );
+        Interp = RampKeyInterpolations[ Idx ];
+        return Position != nullptr && Value != nullptr && Interp != nullptr;
+    }
+
     int32 NumChildren = ChildParameters.Num();
 
     if ( ChildParameters.IsValidIndex( 3 * Idx + 0 ) )
@@ -668,6 +717,17 @@ UHoudiniAssetParameterRamp::GetRampKeysCurveColor(
     Value = nullptr;
     Interp = nullptr;
 
+    if ( HasValidRampKeyParameters() )
+    {
+        if ( !RampKeyPositions.IsValidIndex( Idx ) )
+            return false;
+
+        Position = RampKeyPositions[ Idx ];
+        Value = Cast< UHoudiniAssetParameterColor >( RampKeyValues[ Idx ] );
+        Interp = RampKeyInterpolations[ Idx ];
+        return Position != nullptr && Value != nullptr && Interp != nullptr;
+    }
+
     int32 NumChildren = ChildParameters.Num();
 
     if ( 3 * Idx + 0 < NumChildren )
@@ -682,6 +742,96 @@ UHoudiniAssetParameterRamp::GetRampKeysCurveColor(
     return Position != nullptr && Value != nullptr && Interp != nullptr;
 }
 
+void
+UHoudiniAssetParameterRamp::CacheRampKeyParameters()
+{
+    RampKeyPositions.Empty();
+    RampKeyValues.Empty();
+    RampKeyInterpolations.Empty();
+
+    const int32 KeyCount = GetRampKeyCount();
+    RampKeyPositions.Reserve( KeyCount );
+    RampKeyValues.Reserve( KeyCount );
+    RampKeyInterpolations.Reserve( KeyCount );
+
+    for ( int32 KeyIdx = 0; KeyIdx < KeyCount; ++KeyIdx )
+    {
+        RampKeyPositions.Add( Cast< UHoudiniAssetParameterFloat >( ChildParameters[ 3 * KeyIdx + 0 ] ) );
+        RampKeyValues.Add( ChildParameters[ 3 * KeyIdx + 1 ] );
+        RampKeyInterpolations.Add( Cast< UHoudiniAssetParameterChoice >( ChildParameters[ 3 * KeyIdx + 2 ] ) );
+    }
+}
+
+bool
+UHoudiniAssetParameterRamp::HasValidRampKeyParameters() const
+{
+    return RampKeyPositions.Num() > 0 && RampKeyPositions.Num() * 3 == ChildParameters.Num();
+}
+
+bool
+UHoudiniAssetParameterRamp::IsCurveInSync() const
+{
+    const int32 KeyCount = GetRampKeyCount();
+    for ( int32 KeyIdx = 0; KeyIdx < KeyCount; ++KeyIdx )
+    {
+        if ( HoudiniAssetParameterRampCurveFloat )
+        {
+            const FRichCurve & RichCurve = HoudiniAssetParameterRampCurveFloat->FloatCurve;
+            if ( RichCurve.GetNumKeys() != KeyCount )
+                return false;
+
+            UHoudiniAssetParameterFloat * ChildParamPosition = nullptr;
+            UHoudiniAssetParameterFloat * ChildParamValue = nullptr;
+            UHoudiniAssetParameterChoice * ChildParamInterpolation = nullptr;
+            if ( !GetRampKeysCurveFloat( KeyIdx, ChildParamPosition, ChildParamValue, ChildParamInterpolation ) )
+                return false;
+
+            const FRichCurveKey & RichCurveKey = RichCurve.Keys[ KeyIdx ];
+            if ( RichCurveKey.Time != ChildParamPosition->GetParameterValue( 0, 0.0f )
+                || RichCurveKey.Value != ChildParamValue->GetParameterValue( 0, 0.0f )
+                || RichCurveKey.InterpMode != TranslateHoudiniRampKeyInterpolation( TranslateChoiceKeyInterpolation( ChildParamInterpolation ) ) )
+                return false;
+        }
+        else if ( HoudiniAssetParameterRampCurveColor )
+        {
+            UHoudiniAssetParameterFloat * ChildParamPosition = nullptr;
+            UHoudiniAssetParameterColor * ChildParamColor = nullptr;
+            UHoudiniAssetParameterChoice * ChildParamInterpolation = nullptr;
+            if ( !GetRampKeysCurveColor( KeyIdx, ChildParamPosition, ChildParamColor, ChildParamInterpolation ) )
+                return false;
+
+            const FLinearColor KeyColor = ChildParamColor->GetColor();
+            const ERichCurveInterpMode KeyInterpMode =
+                TranslateHoudiniRampKeyInterpolation( TranslateChoiceKeyInterpolation( ChildParamInterpolation ) );
+
+            for ( int32 CurveIdx = 0; CurveIdx < 4; ++CurveIdx )
+            {
+                const FRichCurve & RichCurve = HoudiniAssetParameterRampCurveColor->FloatCurves[ CurveIdx ];
+                if ( RichCurve.GetNumKeys() != KeyCount )
+                    return false;
+
+                const FRichCurveKey & RichCurveKey = RichCurve.Keys[ KeyIdx ];
+                if ( RichCurveKey.Time != ChildParamPosition->GetParameterValue( 0, 0.0f )
+                    || RichCurveKey.Value != KeyColor.Component( CurveIdx )
+                    || RichCurveKey.InterpMode != KeyInterpMode )
+                    return false;
+            }
+        }
+    }
+
+    // Curves without keys are only in sync with ramps without keys.
+    if ( KeyCount == 0 )
+    {
+        if ( HoudiniAssetParameterRampCurveFloat )
+            return HoudiniAssetParameterRampCurveFloat->FloatCurve.GetNumKeys() == 0;
+
+        if ( HoudiniAssetParameterRampCurveColor )
+            return HoudiniAssetParameterRampCurveColor->FloatCurves[ 0 ].GetNumKeys() == 0;
+    }
+
+    return true;
+}
+
 int32
 UHoudiniAssetParameterRamp::GetRampKeyCount() const
 {
@@ -223,6 +223,15 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameterRamp : public UHoudiniAsset
             UHoudiniAssetParameterColor *& Value,
             UHoudiniAssetParameterChoice *& Interp ) const;
 
+        /** Cache the position, value and interpolation parameters of each key from the child parameters. **/
+        void CacheRampKeyParameters();
+
+        /** Return true if the cached key parameters match the child parameters. **/
+        bool HasValidRampKeyParameters() const;
+
+        /** Return true if the curve keys already match the values of the key parameters. **/
+        bool IsCurveInSync() const;
+
     protected:
 
         //! Default spline interpolation method.
@@ -248,4 +257,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameterRamp : public UHoudiniAsset
 
         //! Set to true when curve data needs to be re-uploaded to Houdini Engine.
         bool bIsCurveUploadRequired;
+
+        //! Child parameters of each key, cached once the child parameters have been created.
+        TArray< UHoudiniAssetParameterFloat * > RampKeyPositions;
+        TArray< UHoudiniAssetParameter * > RampKeyValues;
+        TArray< UHoudiniAssetParameterChoice * > RampKeyInterpolations;
 };
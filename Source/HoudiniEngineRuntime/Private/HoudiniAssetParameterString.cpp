@@ -28,6 +28,7 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniParamUtils.h"
 
 #include "Misc/Variant.h"
 #include "Internationalization/Internationalization.h"
@@ -82,9 +83,7 @@ UHoudiniAssetParameterString::CreateParameter(
     // Get the actual value for this property.
     TArray< HAPI_StringHandle > StringHandles;
     StringHandles.SetNum( TupleSize );
-    if ( FHoudiniApi::GetParmStringValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId, false,
-        &StringHandles[ 0 ], ValuesIndex, TupleSize) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::GetParmStringValues( InNodeId, &StringHandles[ 0 ], ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -166,6 +165,23 @@ UHoudiniAssetParameterString::SetParameterVariantValue(
     return false;
 }
 
+bool
+UHoudiniAssetParameterString::CopyValuesFrom( const UHoudiniAssetParameter * OtherParameter )
+{
+    const UHoudiniAssetParameterString * OtherString = Cast< const UHoudiniAssetParameterString >( OtherParameter );
+    if ( !OtherString || OtherString->Values.Num() != Values.Num() )
+        return false;
+
+    if ( OtherString->Values == Values )
+        return true;
+
+    Modify();
+    Values = OtherString->Values;
+    MarkChanged();
+
+    return true;
+}
+
 #if WITH_EDITOR
 
 void
@@ -26,6 +26,7 @@
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
+#include "HoudiniParamUtils.h"
 
 #include "Misc/Variant.h"
 #include "Internationalization/Internationalization.h"
@@ -80,9 +81,7 @@ UHoudiniAssetParameterToggle::CreateParameter(
 
     // Get the actual value for this property.
     Values.SetNumZeroed( TupleSize );
-    if ( FHoudiniApi::GetParmIntValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::GetParmIntValues( InNodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -94,9 +93,7 @@ UHoudiniAssetParameterToggle::CreateParameter(
 bool
 UHoudiniAssetParameterToggle::UploadParameterValue()
 {
-    if ( FHoudiniApi::SetParmIntValues(
-        FHoudiniEngine::Get().GetSession(), NodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::SetParmIntValues( NodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -161,6 +158,23 @@ UHoudiniAssetParameterToggle::SetParameterVariantValue(
     return true;
 }
 
+bool
+UHoudiniAssetParameterToggle::CopyValuesFrom( const UHoudiniAssetParameter * OtherParameter )
+{
+    const UHoudiniAssetParameterToggle * OtherToggle = Cast< const UHoudiniAssetParameterToggle >( OtherParameter );
+    if ( !OtherToggle || OtherToggle->Values.Num() != Values.Num() )
+        return false;
+
+    if ( OtherToggle->Values == Values )
+        return true;
+
+    Modify();
+    Values = OtherToggle->Values;
+    MarkChanged();
+
+    return true;
+}
+
 void
 UHoudiniAssetParameterToggle::Serialize( FArchive & Ar )
 {
@@ -47,19 +47,44 @@ UHoudiniAttributeDataComponent::~UHoudiniAttributeDataComponent()
 void 
 UHoudiniAttributeDataComponent::SetAttributeData( FHoudiniPointAttributeData&& InVertexAttributeData )
 {
-    VertexAttributeData.Add( InVertexAttributeData );
+    UStaticMeshComponent* StaticMeshComponent = InVertexAttributeData.Component.Get();
+    FHoudiniComponentAttributeData* ComponentData = const_cast< FHoudiniComponentAttributeData* >( FindComponentAttributeData( StaticMeshComponent ) );
+    if ( !ComponentData )
+    {
+        ComponentData = &ComponentAttributeData.AddDefaulted_GetRef();
+        ComponentData->Component = StaticMeshComponent;
+    }
+
+    // Convert the name once, it is reused by every upload of this attribute.
+    std::string AttrNameRaw;
+    FHoudiniEngineUtils::ConvertUnrealString( InVertexAttributeData.AttrName, AttrNameRaw );
+
+    ComponentData->AttrNamesRaw.Add( AttrNameRaw );
+    ComponentData->Attributes.Add( MoveTemp( InVertexAttributeData ) );
 }
 
 FHoudiniPointAttributeData* 
 UHoudiniAttributeDataComponent::GetAttributeData( class UStaticMeshComponent* StaticMeshComponent )
 {
-    for ( FHoudiniPointAttributeData& AttributeData : VertexAttributeData )
+    const FHoudiniComponentAttributeData* ComponentData = FindComponentAttributeData( StaticMeshComponent );
+    if ( ComponentData && ComponentData->Attributes.Num() > 0 )
+        return const_cast< FHoudiniPointAttributeData* >( &ComponentData->Attributes[ 0 ] );
+
+    return nullptr;
+}
+
+const FHoudiniComponentAttributeData*
+UHoudiniAttributeDataComponent::FindComponentAttributeData( class UStaticMeshComponent* StaticMeshComponent ) const
+{
+    if ( !StaticMeshComponent )
+        return nullptr;
+
+    for ( const FHoudiniComponentAttributeData& ComponentData : ComponentAttributeData )
     {
-        if ( AttributeData.Component.IsValid() && AttributeData.Component.Get() == StaticMeshComponent )
-        {
-            return &AttributeData;
-        }
+        if ( ComponentData.Component.IsValid() && ComponentData.Component.Get() == StaticMeshComponent )
+            return &ComponentData;
     }
+
     return nullptr;
 }
 
@@ -77,57 +102,59 @@ UHoudiniAttributeDataComponent::Serialize( FArchive & Ar )
 bool 
 UHoudiniAttributeDataComponent::Upload( HAPI_NodeId GeoNodeId, class UStaticMeshComponent* StaticMeshComponent ) const
 {
-    for ( const FHoudiniPointAttributeData& AttributeData : VertexAttributeData )
+    const FHoudiniComponentAttributeData* ComponentData = FindComponentAttributeData( StaticMeshComponent );
+    if ( !ComponentData )
+        return true;
+
+    // Each attribute is uploaded whole, with a single add and set.
+    for ( int32 AttrIdx = 0; AttrIdx < ComponentData->Attributes.Num(); ++AttrIdx )
     {
-        if ( AttributeData.Component.IsValid() && AttributeData.Component.Get() == StaticMeshComponent )
+        const FHoudiniPointAttributeData& AttributeData = ComponentData->Attributes[ AttrIdx ];
+        const char* AttrNameRaw = ComponentData->AttrNamesRaw[ AttrIdx ].c_str();
+
+        HAPI_AttributeInfo AttributeInfoPoint;
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoPoint );
+        AttributeInfoPoint.count = AttributeData.Count;
+        AttributeInfoPoint.tupleSize = AttributeData.TupleSize;
+        AttributeInfoPoint.exists = true;
+        AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
+        AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
+
+        switch ( AttributeData.DataType )
         {
-            HAPI_AttributeInfo AttributeInfoPoint;
-            FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoPoint );
-            AttributeInfoPoint.count = AttributeData.Count;
-            AttributeInfoPoint.tupleSize = AttributeData.TupleSize;
-            AttributeInfoPoint.exists = true;
-            AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
-            AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
+            case EHoudiniVertexAttributeDataType::VADT_Bool:
+            case EHoudiniVertexAttributeDataType::VADT_Int32:
+            {
+                AttributeInfoPoint.storage = HAPI_STORAGETYPE_INT;
 
-            const char* AttrNameRaw = TCHAR_TO_ANSI( *AttributeData.AttrName );
+                HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+                    FHoudiniEngine::Get().GetSession(), GeoNodeId,
+                    0, AttrNameRaw, &AttributeInfoPoint ), false );
 
-            switch ( AttributeData.DataType )
+                HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeIntData(
+                    FHoudiniEngine::Get().GetSession(),
+                    GeoNodeId, 0, AttrNameRaw, &AttributeInfoPoint,
+                    AttributeData.IntData.GetData(), 0, AttributeInfoPoint.count ), false );
+
+                break;
+            }
+            case EHoudiniVertexAttributeDataType::VADT_Float:
             {
-                case EHoudiniVertexAttributeDataType::VADT_Bool:
-                case EHoudiniVertexAttributeDataType::VADT_Int32:
-                {
-                    AttributeInfoPoint.storage = HAPI_STORAGETYPE_INT;
-
-                    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-                        FHoudiniEngine::Get().GetSession(), GeoNodeId,
-                        0, AttrNameRaw, &AttributeInfoPoint ), false );
-
-                    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeIntData(
-                        FHoudiniEngine::Get().GetSession(),
-                        GeoNodeId, 0, AttrNameRaw, &AttributeInfoPoint,
-                        AttributeData.IntData.GetData(), 0, AttributeInfoPoint.count ), false );
-
-                    break;
-                }
-                case EHoudiniVertexAttributeDataType::VADT_Float:
-                {
-                    AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
-
-                    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-                        FHoudiniEngine::Get().GetSession(), GeoNodeId,
-                        0, AttrNameRaw, &AttributeInfoPoint ), false );
-
-                    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-                        FHoudiniEngine::Get().GetSession(),
-                        GeoNodeId, 0, AttrNameRaw, &AttributeInfoPoint,
-                        AttributeData.FloatData.GetData(), 0, AttributeInfoPoint.count ), false );
-
-                    break;
-                }
-                default:
-                    checkNoEntry();
+                AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
+
+                HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+                    FHoudiniEngine::Get().GetSession(), GeoNodeId,
+                    0, AttrNameRaw, &AttributeInfoPoint ), false );
+
+                HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+                    FHoudiniEngine::Get().GetSession(),
+                    GeoNodeId, 0, AttrNameRaw, &AttributeInfoPoint,
+                    AttributeData.FloatData.GetData(), 0, AttributeInfoPoint.count ), false );
+
+                break;
             }
-            break;
+            default:
+                checkNoEntry();
         }
     }
     return true;
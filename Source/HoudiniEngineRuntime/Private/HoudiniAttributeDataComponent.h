@@ -27,6 +27,7 @@
 #include "Components/StaticMeshComponent.h"
 
 #include "HAPI.h"
+#include <string>
 #include "HoudiniAttributeDataComponent.generated.h"
 
 UENUM()
@@ -70,6 +71,16 @@ struct FHoudiniPointAttributeData
     TArray<int32> IntData;
 };
 
+/** All the attribute data stored for one static mesh component, uploaded together. **/
+struct FHoudiniComponentAttributeData
+{
+    TWeakObjectPtr<class UStaticMeshComponent> Component;
+    TArray< FHoudiniPointAttributeData > Attributes;
+
+    /** Attribute names converted for HAPI, in the same order as Attributes. **/
+    TArray< std::string > AttrNamesRaw;
+};
+
 UCLASS( config = Engine )
 class HOUDINIENGINERUNTIME_API UHoudiniAttributeDataComponent : public UActorComponent
 {
@@ -87,5 +98,9 @@ public:
     /** Upload all data for the given mesh to the specified geo node */
     bool Upload( HAPI_NodeId GeoNodeId, class UStaticMeshComponent* StaticMeshComponent ) const;
 private:
-    TArray< FHoudiniPointAttributeData > VertexAttributeData;
+    /** Return the attribute data stored for the given component, if any. **/
+    const FHoudiniComponentAttributeData* FindComponentAttributeData( class UStaticMeshComponent* StaticMeshComponent ) const;
+
+    /** Attribute data, grouped per component. **/
+    TArray< FHoudiniComponentAttributeData > ComponentAttributeData;
 };
@@ -0,0 +1,155 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "HoudiniCookProfile.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniAssetComponent.h"
+
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+
+/** Cook profile and innermost stage being timed on this thread. **/
+static thread_local FHoudiniCookProfile * HoudiniEngineThreadCookProfile = nullptr;
+static thread_local FHoudiniCookProfileStageScope * HoudiniEngineThreadCookProfileStage = nullptr;
+
+FHoudiniCookProfile::FHoudiniCookProfile()
+{
+    Reset();
+}
+
+void
+FHoudiniCookProfile::Reset()
+{
+    for ( int32 StageIdx = 0; StageIdx < EHoudiniCookProfileStage::MAX; ++StageIdx )
+        StageSeconds[ StageIdx ] = 0.0;
+}
+
+double
+FHoudiniCookProfile::GetTotalSeconds() const
+{
+    double TotalSeconds = 0.0;
+    for ( int32 StageIdx = 0; StageIdx < EHoudiniCookProfileStage::MAX; ++StageIdx )
+        TotalSeconds += StageSeconds[ StageIdx ];
+
+    return TotalSeconds;
+}
+
+const TCHAR *
+FHoudiniCookProfile::GetStageName( EHoudiniCookProfileStage::Type Stage )
+{
+    switch ( Stage )
+    {
+        case EHoudiniCookProfileStage::HapiCook:        return TEXT( "HAPI Cook" );
+        case EHoudiniCookProfileStage::GeometryFetch:   return TEXT( "Geometry Fetch" );
+        case EHoudiniCookProfileStage::MeshBuild:       return TEXT( "Mesh Build" );
+        case EHoudiniCookProfileStage::Materials:       return TEXT( "Materials" );
+        case EHoudiniCookProfileStage::Landscapes:      return TEXT( "Landscapes" );
+        case EHoudiniCookProfileStage::Instancers:      return TEXT( "Instancers" );
+        case EHoudiniCookProfileStage::UIRefresh:       return TEXT( "UI Refresh" );
+        default:                                        return TEXT( "Unknown" );
+    }
+}
+
+void
+FHoudiniCookProfile::DumpSlowestComponents( int32 Count )
+{
+    TArray< const UHoudiniAssetComponent * > Components;
+    for ( TObjectIterator< UHoudiniAssetComponent > Iter; Iter; ++Iter )
+    {
+        const UHoudiniAssetComponent * HoudiniAssetComponent = *Iter;
+        if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() || HoudiniAssetComponent->IsTemplate() )
+            continue;
+
+        UWorld * World = HoudiniAssetComponent->GetWorld();
+        if ( !World || World->WorldType != EWorldType::Editor || !HoudiniAssetComponent->GetOwner() )
+            continue;
+
+        if ( HoudiniAssetComponent->GetCookProfile().GetTotalSeconds() > 0.0 )
+            Components.Add( HoudiniAssetComponent );
+    }
+
+    Components.Sort( []( const UHoudiniAssetComponent & A, const UHoudiniAssetComponent & B )
+    {
+        return A.GetCookProfile().GetTotalSeconds() > B.GetCookProfile().GetTotalSeconds();
+    } );
+
+    HOUDINI_LOG_MESSAGE( TEXT( "Slowest Houdini actors of the last cook (%d of %d), times in ms:" ),
+        FMath::Min( Count, Components.Num() ), Components.Num() );
+
+    for ( int32 ComponentIdx = 0; ComponentIdx < Components.Num() && ComponentIdx < Count; ++ComponentIdx )
+    {
+        const FHoudiniCookProfile & Profile = Components[ ComponentIdx ]->GetCookProfile();
+
+        FString Stages;
+        for ( int32 StageIdx = 0; StageIdx < EHoudiniCookProfileStage::MAX; ++StageIdx )
+        {
+            Stages += FString::Printf( TEXT( "  %s %.1f" ),
+                GetStageName( (EHoudiniCookProfileStage::Type) StageIdx ), Profile.StageSeconds[ StageIdx ] * 1000.0 );
+        }
+
+        HOUDINI_LOG_MESSAGE( TEXT( "    %-32s %9.1f |%s" ),
+            *Components[ ComponentIdx ]->GetOwner()->GetName(), Profile.GetTotalSeconds() * 1000.0, *Stages );
+    }
+}
+
+FHoudiniScopedCookProfile::FHoudiniScopedCookProfile( FHoudiniCookProfile & Profile )
+    : bOwnsProfile( HoudiniEngineThreadCookProfile == nullptr )
+{
+    if ( bOwnsProfile )
+        HoudiniEngineThreadCookProfile = &Profile;
+}
+
+FHoudiniScopedCookProfile::~FHoudiniScopedCookProfile()
+{
+    if ( bOwnsProfile )
+        HoudiniEngineThreadCookProfile = nullptr;
+}
+
+FHoudiniCookProfileStageScope::FHoudiniCookProfileStageScope( EHoudiniCookProfileStage::Type InStage )
+    : Stage( InStage )
+    , StartTime( FPlatformTime::Seconds() )
+    , NestedSeconds( 0.0 )
+    , Parent( HoudiniEngineThreadCookProfileStage )
+{
+    HoudiniEngineThreadCookProfileStage = this;
+}
+
+FHoudiniCookProfileStageScope::~FHoudiniCookProfileStageScope()
+{
+    const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+    if ( HoudiniEngineThreadCookProfile )
+        HoudiniEngineThreadCookProfile->StageSeconds[ Stage ] += ElapsedSeconds - NestedSeconds;
+
+    if ( Parent )
+        Parent->NestedSeconds += ElapsedSeconds;
+
+    HoudiniEngineThreadCookProfileStage = Parent;
+}
+
+static FAutoConsoleCommand HoudiniCookProfileDumpCommand(
+    TEXT( "Houdini.Profile.Slowest" ),
+    TEXT( "Log the Houdini actors whose last cook took the longest, optionally followed by the number of actors to list." ),
+    FConsoleCommandWithArgsDelegate::CreateLambda( []( const TArray< FString > & Args )
+    {
+        FHoudiniCookProfile::DumpSlowestComponents( Args.Num() > 0 ? FCString::Atoi( *Args[ 0 ] ) : HAPI_UNREAL_COOK_PROFILE_DUMP_COUNT );
+    } ) );
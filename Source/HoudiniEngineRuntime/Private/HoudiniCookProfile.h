@@ -0,0 +1,89 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace EHoudiniCookProfileStage
+{
+    /** Stages of a cook whose time is recorded in the cook profile of a component. **/
+    enum Type
+    {
+        HapiCook,
+        GeometryFetch,
+        MeshBuild,
+        Materials,
+        Landscapes,
+        Instancers,
+        UIRefresh,
+        MAX
+    };
+}
+
+/** Time spent in each stage of the last cook of a component. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniCookProfile
+{
+    FHoudiniCookProfile();
+
+    /** Clear the recorded times, before a new cook. **/
+    void Reset();
+
+    /** Return the time spent in all stages. **/
+    double GetTotalSeconds() const;
+
+    /** Return the display name of a stage. **/
+    static const TCHAR * GetStageName( EHoudiniCookProfileStage::Type Stage );
+
+    /** Log the components of the editor worlds whose last cook took the longest, with the time of each stage. **/
+    static void DumpSlowestComponents( int32 Count );
+
+    double StageSeconds[ EHoudiniCookProfileStage::MAX ];
+};
+
+/** Scope during which the stages timed on this thread are recorded in the given profile, nested scopes are ignored. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniScopedCookProfile
+{
+    FHoudiniScopedCookProfile( FHoudiniCookProfile & Profile );
+    ~FHoudiniScopedCookProfile();
+
+    /** Is set to true if this scope installed its profile, false if an outer scope was already active. **/
+    bool bOwnsProfile;
+};
+
+/** Time the enclosing scope as the given stage of the active cook profile, the time of nested stages is only counted once. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniCookProfileStageScope
+{
+    FHoudiniCookProfileStageScope( EHoudiniCookProfileStage::Type InStage );
+    ~FHoudiniCookProfileStageScope();
+
+    EHoudiniCookProfileStage::Type Stage;
+    double StartTime;
+
+    /** Time spent in the stages nested in this one. **/
+    double NestedSeconds;
+
+    /** Stage scope this one is nested in. **/
+    FHoudiniCookProfileStageScope * Parent;
+};
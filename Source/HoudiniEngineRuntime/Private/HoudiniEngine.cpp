@@ -22,6 +22,8 @@
 */
 
 #include "HoudiniApi.h"
+#include "HoudiniApiBinding.h"
+#include "HoudiniApiTrace.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniEngineScheduler.h"
@@ -30,12 +32,16 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniLandscapeUtils.h"
 #include "HoudiniEngineInstancerUtils.h"
+#include "HoudiniEngineRuntimeMeshUtils.h"
 #include "HoudiniAsset.h"
+#include "HoudiniAssetComponent.h"
 #include "HoudiniRuntimeSettings.h"
 
 #include "HAL/PlatformMisc.h"
 #include "HAL/PlatformFilemanager.h"
+#include "HAL/FileManager.h"
 #include "Misc/ScopeLock.h"
+#include "UObject/UObjectIterator.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Materials/Material.h"
 
@@ -43,9 +49,20 @@
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
 
+DECLARE_CYCLE_STAT( TEXT( "Houdini: Cook Node Outputs" ), STAT_CookNodeOutputs, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_ACCUMULATOR_STAT( TEXT( "Houdini: Pending Instantiations" ), STAT_PendingInstantiations, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_ACCUMULATOR_STAT( TEXT( "Houdini: Pending Cooks" ), STAT_PendingCooks, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_ACCUMULATOR_STAT( TEXT( "Houdini: Pending Deletions" ), STAT_PendingDeletions, STATGROUP_HoudiniEngine );
+DECLARE_FLOAT_ACCUMULATOR_STAT( TEXT( "Houdini: Oldest Task Age (s)" ), STAT_OldestTaskAge, STATGROUP_HoudiniEngine );
+DECLARE_FLOAT_ACCUMULATOR_STAT( TEXT( "Houdini: Scheduler Utilization" ), STAT_SchedulerUtilization, STATGROUP_HoudiniEngine );
+DECLARE_FLOAT_ACCUMULATOR_STAT( TEXT( "Houdini: Cook Status Poll Fraction" ), STAT_CookStatusPollFraction, STATGROUP_HoudiniEngine );
+
 
 const FName FHoudiniEngine::HoudiniEngineAppIdentifier = FName( TEXT( "HoudiniEngineApp" ) );
 
+/** Index of the pooled session used by HAPI calls made on the current thread. **/
+static thread_local int32 HoudiniEngineThreadSessionIndex = 0;
+
 IMPLEMENT_MODULE( FHoudiniEngine, HoudiniEngineRuntime );
 DEFINE_LOG_CATEGORY( LogHoudiniEngine );
 
@@ -58,10 +75,17 @@ FHoudiniEngine::FHoudiniEngine()
     , HoudiniBgeoAsset( nullptr )
     , HoudiniEngineSchedulerThread( nullptr )
     , HoudiniEngineScheduler( nullptr )
+    , bCustomImplementationBound( false )
+    , bSessionWasValid( false )
     , EnableCookingGlobal( true )
 {
     Session.type = HAPI_SESSION_MAX;
     Session.id = -1;
+
+    // Sized once, so that the loaded libraries of a session can be accessed under lock without reallocation.
+    LoadedAssetLibraries.SetNum( HAPI_UNREAL_SESSION_POOL_MAX_SIZE );
+    LoadedAssetLibraryBuffers.SetNum( HAPI_UNREAL_SESSION_POOL_MAX_SIZE );
+    SessionHealths.SetNum( HAPI_UNREAL_SESSION_POOL_MAX_SIZE );
 }
 
 #if WITH_EDITOR
@@ -119,7 +143,264 @@ FHoudiniEngine::SetHapiState( HAPI_Result Result )
 const HAPI_Session *
 FHoudiniEngine::GetSession() const
 {
-    return Session.type == HAPI_SESSION_MAX ? nullptr : &Session;
+    return GetPooledSession( HoudiniEngineThreadSessionIndex );
+}
+
+const HAPI_Session *
+FHoudiniEngine::GetPooledSession( int32 SessionIndex ) const
+{
+    if ( SessionIndex <= 0 )
+        return Session.type == HAPI_SESSION_MAX ? nullptr : &Session;
+
+    // The pool is published by the scheduler thread once all of its sessions have started.
+    if ( IsSessionStarting() || !PooledSessions.IsValidIndex( SessionIndex - 1 ) )
+        return nullptr;
+
+    const HAPI_Session & PooledSession = PooledSessions[ SessionIndex - 1 ];
+    return PooledSession.type == HAPI_SESSION_MAX ? nullptr : &PooledSession;
+}
+
+int32
+FHoudiniEngine::GetSessionPoolSize() const
+{
+    return IsSessionStarting() ? 1 : 1 + PooledSchedulers.Num();
+}
+
+int32
+FHoudiniEngine::GetIdleSessionIndex( const TMap< int32, int32 > * BatchedTaskCounts ) const
+{
+    auto GetBatchedTaskCount = [ BatchedTaskCounts ]( int32 SessionIndex )
+    {
+        const int32 * BatchedTaskCount = BatchedTaskCounts ? BatchedTaskCounts->Find( SessionIndex ) : nullptr;
+        return BatchedTaskCount ? *BatchedTaskCount : 0;
+    };
+
+    int32 IdleSessionIndex = 0;
+    int32 IdlePendingTaskCount = ( HoudiniEngineScheduler ? HoudiniEngineScheduler->GetPendingTaskCount() : 0 )
+        + GetBatchedTaskCount( 0 );
+
+    if ( IsSessionStarting() )
+        return IdleSessionIndex;
+
+    for ( int32 Idx = 0; Idx < PooledSchedulers.Num(); ++Idx )
+    {
+        const int32 PendingTaskCount = PooledSchedulers[ Idx ]->GetPendingTaskCount()
+            + GetBatchedTaskCount( PooledSchedulers[ Idx ]->GetSessionIndex() );
+        if ( PendingTaskCount < IdlePendingTaskCount )
+        {
+            IdleSessionIndex = PooledSchedulers[ Idx ]->GetSessionIndex();
+            IdlePendingTaskCount = PendingTaskCount;
+        }
+    }
+
+    return IdleSessionIndex;
+}
+
+HAPI_Result
+FHoudiniEngine::CreateCustomSession( HAPI_Session * SessionPtr, const FString & SessionInfo )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    // The implementation library only needs to be bound once, all sessions of the pool share it.
+    if ( !bCustomImplementationBound )
+    {
+        if ( !FPaths::FileExists( HoudiniRuntimeSettings->CustomSessionLibraryPath ) )
+        {
+            HOUDINI_LOG_ERROR(
+                TEXT( "Custom Houdini Engine session library was not found: %s" ),
+                *HoudiniRuntimeSettings->CustomSessionLibraryPath );
+
+            return HAPI_RESULT_FAILURE;
+        }
+
+        HAPI_Result Result = FHoudiniApi::BindCustomImplementation(
+            HAPI_UNREAL_SESSION_CUSTOM_TYPE, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->CustomSessionLibraryPath ) );
+        if ( Result != HAPI_RESULT_SUCCESS )
+        {
+            HOUDINI_LOG_ERROR(
+                TEXT( "Failed to bind custom Houdini Engine session library %s" ),
+                *HoudiniRuntimeSettings->CustomSessionLibraryPath );
+
+            return Result;
+        }
+
+        bCustomImplementationBound = true;
+    }
+
+    // The format of the session info is defined by the implementation, we pass it a null terminated string.
+    FTCHARToUTF8 SessionInfoUTF8( *SessionInfo );
+    return FHoudiniApi::CreateCustomSession(
+        HAPI_UNREAL_SESSION_CUSTOM_TYPE, const_cast< ANSICHAR * >( SessionInfoUTF8.Get() ), SessionPtr );
+}
+
+void
+FHoudiniEngine::SetSessionHealth( int32 SessionIndex, EHoudiniSessionHealth::Type Health, double RoundTripTime )
+{
+    if ( !SessionHealths.IsValidIndex( SessionIndex ) )
+        return;
+
+    SessionHealths[ SessionIndex ].RoundTripTime.Set( (int32) FMath::Min( RoundTripTime * 1000000.0, (double) MAX_int32 ) );
+    SessionHealths[ SessionIndex ].Health.Set( Health );
+}
+
+EHoudiniSessionHealth::Type
+FHoudiniEngine::GetSessionHealth( int32 SessionIndex ) const
+{
+    if ( !SessionHealths.IsValidIndex( SessionIndex ) )
+        return EHoudiniSessionHealth::Unknown;
+
+    return (EHoudiniSessionHealth::Type) SessionHealths[ SessionIndex ].Health.GetValue();
+}
+
+double
+FHoudiniEngine::GetSessionRoundTripTime( int32 SessionIndex ) const
+{
+    if ( !SessionHealths.IsValidIndex( SessionIndex ) )
+        return 0.0;
+
+    return SessionHealths[ SessionIndex ].RoundTripTime.GetValue() / 1000000.0;
+}
+
+void
+FHoudiniEngine::GetSchedulerTelemetry( TArray< FHoudiniEngineSchedulerTelemetry > & OutTelemetry ) const
+{
+    OutTelemetry.Empty();
+    if ( !HoudiniEngineScheduler )
+        return;
+
+    HoudiniEngineScheduler->GetTelemetry( OutTelemetry.AddDefaulted_GetRef() );
+    if ( IsSessionStarting() )
+        return;
+
+    for ( const FHoudiniEngineScheduler * PooledScheduler : PooledSchedulers )
+    {
+        if ( PooledScheduler )
+            PooledScheduler->GetTelemetry( OutTelemetry.AddDefaulted_GetRef() );
+    }
+}
+
+int32
+FHoudiniEngine::GetCookingThreadCount() const
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    int32 ThreadCount = HoudiniRuntimeSettings->CookingThreadCount;
+    const int32 PoolSize = FMath::Clamp( HoudiniRuntimeSettings->CookSessionPoolSize, 1, HAPI_UNREAL_SESSION_POOL_MAX_SIZE );
+
+    if ( !HoudiniRuntimeSettings->bCookingThreadCountPerSession && PoolSize > 1 )
+    {
+        // Share the threads, or all the logical cores if unspecified, between the sessions of the pool.
+        if ( ThreadCount <= 0 )
+            ThreadCount = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+
+        ThreadCount = FMath::Max( ThreadCount / PoolSize, 1 );
+    }
+
+    return FMath::Clamp( ThreadCount, 0, HAPI_UNREAL_MAX_COOKING_THREAD_COUNT );
+}
+
+void
+FHoudiniEngine::UpdateCookingThreadEnvironment() const
+{
+    const int32 ThreadCount = GetCookingThreadCount();
+    if ( ThreadCount > 0 )
+    {
+        FPlatformMisc::SetEnvironmentVar( HAPI_UNREAL_ENV_MAX_THREADS, *FString::FromInt( ThreadCount ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "Starting Houdini Engine server with %d cooking thread(s)." ), ThreadCount );
+    }
+    else
+    {
+        FPlatformMisc::SetEnvironmentVar( HAPI_UNREAL_ENV_MAX_THREADS, *OriginalMaxThreadsEnvironment );
+    }
+}
+
+bool
+FHoudiniEngine::FindLoadedAssetLibrary( const FString & AssetFileName, HAPI_AssetLibraryId & OutAssetLibraryId )
+{
+    const int32 SessionIndex = FHoudiniScopedSession::GetCurrentSessionIndex();
+    if ( !LoadedAssetLibraries.IsValidIndex( SessionIndex ) )
+        return false;
+
+    FScopeLock ScopeLock( &LoadedAssetLibrariesCriticalSection );
+
+    const FLoadedAssetLibrary * LoadedAssetLibrary = LoadedAssetLibraries[ SessionIndex ].Find( AssetFileName );
+    if ( !LoadedAssetLibrary )
+        return false;
+
+    // The library has to be reloaded if the file has changed since.
+    if ( LoadedAssetLibrary->TimeStamp != IFileManager::Get().GetTimeStamp( *AssetFileName ) )
+        return false;
+
+    OutAssetLibraryId = LoadedAssetLibrary->AssetLibraryId;
+    return true;
+}
+
+void
+FHoudiniEngine::AddLoadedAssetLibrary( const FString & AssetFileName, HAPI_AssetLibraryId AssetLibraryId )
+{
+    const int32 SessionIndex = FHoudiniScopedSession::GetCurrentSessionIndex();
+    if ( !LoadedAssetLibraries.IsValidIndex( SessionIndex ) )
+        return;
+
+    FLoadedAssetLibrary LoadedAssetLibrary;
+    LoadedAssetLibrary.AssetLibraryId = AssetLibraryId;
+    LoadedAssetLibrary.TimeStamp = IFileManager::Get().GetTimeStamp( *AssetFileName );
+
+    FScopeLock ScopeLock( &LoadedAssetLibrariesCriticalSection );
+    LoadedAssetLibraries[ SessionIndex ].Add( AssetFileName, LoadedAssetLibrary );
+}
+
+void
+FHoudiniEngine::ClearLoadedAssetLibraries( int32 SessionIndex )
+{
+    if ( !LoadedAssetLibraries.IsValidIndex( SessionIndex ) )
+        return;
+
+    FScopeLock ScopeLock( &LoadedAssetLibrariesCriticalSection );
+    LoadedAssetLibraries[ SessionIndex ].Empty();
+    LoadedAssetLibraryBuffers[ SessionIndex ].Empty();
+}
+
+bool
+FHoudiniEngine::FindLoadedAssetLibraryBuffer( const FString & AssetBytesHash, HAPI_AssetLibraryId & OutAssetLibraryId )
+{
+    const int32 SessionIndex = FHoudiniScopedSession::GetCurrentSessionIndex();
+    if ( !LoadedAssetLibraryBuffers.IsValidIndex( SessionIndex ) || AssetBytesHash.IsEmpty() )
+        return false;
+
+    FScopeLock ScopeLock( &LoadedAssetLibrariesCriticalSection );
+
+    const HAPI_AssetLibraryId * AssetLibraryId = LoadedAssetLibraryBuffers[ SessionIndex ].Find( AssetBytesHash );
+    if ( !AssetLibraryId )
+        return false;
+
+    OutAssetLibraryId = *AssetLibraryId;
+    return true;
+}
+
+void
+FHoudiniEngine::AddLoadedAssetLibraryBuffer( const FString & AssetBytesHash, HAPI_AssetLibraryId AssetLibraryId )
+{
+    const int32 SessionIndex = FHoudiniScopedSession::GetCurrentSessionIndex();
+    if ( !LoadedAssetLibraryBuffers.IsValidIndex( SessionIndex ) || AssetBytesHash.IsEmpty() )
+        return;
+
+    FScopeLock ScopeLock( &LoadedAssetLibrariesCriticalSection );
+    LoadedAssetLibraryBuffers[ SessionIndex ].Add( AssetBytesHash, AssetLibraryId );
+}
+
+void
+FHoudiniEngine::PreloadAssetLibraries( int32 SessionIndex )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( !HoudiniRuntimeSettings->bPreloadAssetLibraries || HoudiniRuntimeSettings->OtlSearchPath.IsEmpty() )
+        return;
+
+    // Libraries are loaded by the session's scheduler, without holding up the editor.
+    FHoudiniEngineTask Task( EHoudiniEngineTaskType::AssetLibraryPreload, FGuid::NewGuid() );
+    Task.Priority = EHoudiniEngineTaskPriority::Background;
+    Task.SessionIndex = SessionIndex;
+    AddTask( MoveTemp( Task ) );
 }
 
 FHoudiniEngine &
@@ -143,6 +424,9 @@ FHoudiniEngine::StartupModule()
 
     HOUDINI_LOG_MESSAGE( TEXT( "Starting the Houdini Engine module." ) );
 
+    // Keep the user's thread count, it is restored when the thread settings are left to their default.
+    OriginalMaxThreadsEnvironment = FPlatformMisc::GetEnvironmentVariable( HAPI_UNREAL_ENV_MAX_THREADS );
+
 #if WITH_EDITOR
     // Register settings.
     if( ISettingsModule * SettingsModule = FModuleManager::GetModulePtr< ISettingsModule >( "Settings" ) )
@@ -160,7 +444,10 @@ FHoudiniEngine::StartupModule()
 
         if ( HAPILibraryHandle )
         {
-            FHoudiniApi::InitializeHAPI( HAPILibraryHandle );
+            FHoudiniApiBinding::Bind( HAPILibraryHandle );
+
+            if ( GetDefault< UHoudiniRuntimeSettings >()->bEnableHapiCallTracing )
+                FHoudiniApiTrace::SetEnabled( true );
         }
         else
         {
@@ -226,174 +513,42 @@ FHoudiniEngine::StartupModule()
     {
         const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
 
-        HAPI_Result SessionResult = HAPI_RESULT_FAILURE;
-
-        HAPI_ThriftServerOptions ServerOptions;
-        FMemory::Memzero< HAPI_ThriftServerOptions >( ServerOptions );
-        ServerOptions.autoClose = true;
-        ServerOptions.timeoutMs = HoudiniRuntimeSettings->AutomaticServerTimeout;
-
-        auto UpdatePathForServer = [&] {
-            // Modify our PATH so that HARC will find HARS.exe
-            const TCHAR* PathDelimiter = FPlatformMisc::GetPathVarDelimiter();
-
-            FString OrigPathVar = FPlatformMisc::GetEnvironmentVariable(TEXT("PATH"));
-
-            FString ModifiedPath =
-#if PLATFORM_MAC
-            // On Mac our binaries are split between two folders
-            LibHAPILocation + TEXT( "/../Resources/bin" ) + PathDelimiter +
-#endif
-            LibHAPILocation + PathDelimiter + OrigPathVar;
-
-            FPlatformMisc::SetEnvironmentVar( TEXT( "PATH" ), *ModifiedPath );
-        };
-
-        switch ( HoudiniRuntimeSettings->SessionType.GetValue() )
-        {
-            case EHoudiniRuntimeSettingsSessionType::HRSST_InProcess:
-            {
-                // As of Unreal 4.19, InProcess sessions are not supported anymore
-                /*
-                SessionResult = FHoudiniApi::CreateInProcessSession(&this->Session);
-#if PLATFORM_WINDOWS
-                // Workaround for Houdini libtools setting stdout to binary
-                FWindowsPlatformMisc::SetUTF8Output();
-#endif
-                */
-
-                // Create an auto started pipe session instead using default values
-                UpdatePathForServer();
-                FHoudiniApi::StartThriftNamedPipeServer(
-                    &ServerOptions,
-                    TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ),
-                    nullptr );
-
-                SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
-                    &this->Session, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ) );
-
-                break;
-            }
-
-            case EHoudiniRuntimeSettingsSessionType::HRSST_Socket:
-            {
-                if ( HoudiniRuntimeSettings->bStartAutomaticServer )
-                {
-                    UpdatePathForServer();
-
-                    FHoudiniApi::StartThriftSocketServer( &ServerOptions, HoudiniRuntimeSettings->ServerPort, nullptr );
-                }
-
-                SessionResult = FHoudiniApi::CreateThriftSocketSession(
-                    &this->Session,
-                    TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerHost ),
-                    HoudiniRuntimeSettings->ServerPort );
-
-                break;
-            }
-
-            case EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe:
-            {
-                if ( HoudiniRuntimeSettings->bStartAutomaticServer )
-                {
-                    UpdatePathForServer();
-
-                    FHoudiniApi::StartThriftNamedPipeServer(
-                        &ServerOptions,
-                        TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ),
-                        nullptr );
-                }
-
-                SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
-                    &this->Session, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ) );
-
-                break;
-            }
+        // Store the instance now, the scheduler thread may need it as soon as it starts.
+        FHoudiniEngine::HoudiniEngineInstance = this;
 
-            default:
-
-                HOUDINI_LOG_ERROR( TEXT( "Unsupported Houdini Engine session type" ) );
-        }
+        // Create HAPI scheduler and processing thread.
+        HoudiniEngineScheduler = new FHoudiniEngineScheduler();
+        HoudiniEngineSchedulerThread = FRunnableThread::Create(
+            HoudiniEngineScheduler, TEXT( "HoudiniTaskCookAsset" ), 0, TPri_Normal );
 
-        const HAPI_Session * SessionPtr = GetSession();
-        if ( SessionResult != HAPI_RESULT_SUCCESS || !SessionPtr )
+        // Commandlets and dedicated servers need the sessions as soon as the module is loaded.
+        const bool bStartSynchronously = IsRunningCommandlet() || IsRunningDedicatedServer();
+        if ( HoudiniRuntimeSettings->bStartSessionAsynchronously && !bStartSynchronously )
         {
-            if ( ( HoudiniRuntimeSettings->SessionType.GetValue() == EHoudiniRuntimeSettingsSessionType::HRSST_Socket ||
-                HoudiniRuntimeSettings->SessionType.GetValue() == EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe ) &&
-                ! HoudiniRuntimeSettings->bStartAutomaticServer )
-            {
-                HOUDINI_LOG_ERROR( TEXT( "Failed to create a Houdini Engine session.  Check that a Houdini Engine Debugger session or HARS server is running" ) );
-            }
-            else
-            {
-                HOUDINI_LOG_ERROR( TEXT( "Failed to create a Houdini Engine session" ) );
-            }
-        }
-
-        // We need to make sure HAPI version is correct.
-        int32 RunningEngineMajor = 0;
-        int32 RunningEngineMinor = 0;
-        int32 RunningEngineApi = 0;
+            // Let the scheduler start the sessions, requests made in the meantime wait for them.
+            bSessionStarting = true;
 
-        // Retrieve version numbers for running Houdini Engine.
-        FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MAJOR, &RunningEngineMajor );
-        FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MINOR, &RunningEngineMinor );
-        FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_API, &RunningEngineApi );
-
-        // Compare defined and running versions.
-        if ( RunningEngineMajor == HAPI_VERSION_HOUDINI_ENGINE_MAJOR &&
-           RunningEngineMinor == HAPI_VERSION_HOUDINI_ENGINE_MINOR &&
-           RunningEngineApi == HAPI_VERSION_HOUDINI_ENGINE_API )
-        {
-            HAPI_CookOptions CookOptions;
-            FMemory::Memzero< HAPI_CookOptions >( CookOptions );
-            CookOptions.curveRefineLOD = 8.0f;
-            CookOptions.clearErrorsAndWarnings = false;
-            CookOptions.maxVerticesPerPrimitive = 3;
-            CookOptions.splitGeosByGroup = false;
-            CookOptions.refineCurveToLinear = true;
-            CookOptions.handleBoxPartTypes = false;
-            CookOptions.handleSpherePartTypes = false;
-            CookOptions.splitPointsByVertexAttributes = false;
-            CookOptions.packedPrimInstancingMode = HAPI_PACKEDPRIM_INSTANCING_MODE_FLAT;
-
-            HAPI_Result Result = FHoudiniApi::Initialize( SessionPtr, &CookOptions, true,
-                HoudiniRuntimeSettings->CookingThreadStackSize, 
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->HoudiniEnvironmentFiles),
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->OtlSearchPath), 
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->DsoSearchPath),
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ImageDsoSearchPath), 
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->AudioDsoSearchPath) );
-            if ( Result == HAPI_RESULT_SUCCESS )
-            {
-                HOUDINI_LOG_MESSAGE( TEXT( "Successfully intialized the Houdini Engine API module." ) );
-                FHoudiniApi::SetServerEnvString( SessionPtr, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME );
-            }
-            else
-            {
-                HOUDINI_LOG_MESSAGE(
-                    TEXT( "Starting up the Houdini Engine API module failed: %s" ),
-                    *FHoudiniEngineUtils::GetErrorDescription( Result ) );
-            }
+            FHoudiniEngineTask Task( EHoudiniEngineTaskType::SessionStartup, FGuid::NewGuid() );
+            Task.Priority = EHoudiniEngineTaskPriority::Interactive;
+            AddTask( MoveTemp( Task ) );
         }
         else
         {
-            bHAPIVersionMismatch = true;
-
-            HOUDINI_LOG_MESSAGE( TEXT( "Starting up the Houdini Engine API module failed: build and running versions do not match." ) );
-            HOUDINI_LOG_MESSAGE(
-                TEXT( "Defined version: %d.%d.api:%d vs Running version: %d.%d.api:%d" ),
-                HAPI_VERSION_HOUDINI_ENGINE_MAJOR, HAPI_VERSION_HOUDINI_ENGINE_MINOR, HAPI_VERSION_HOUDINI_ENGINE_API,
-                RunningEngineMajor, RunningEngineMinor, RunningEngineApi );
+            StartSessions();
         }
 
-        // Create HAPI scheduler and processing thread.
-        HoudiniEngineScheduler = new FHoudiniEngineScheduler();
-        HoudiniEngineSchedulerThread = FRunnableThread::Create(
-            HoudiniEngineScheduler, TEXT( "HoudiniTaskCookAsset" ), 0, TPri_Normal );
-
         // Set the default value for pausing houdini engine cooking
         EnableCookingGlobal = !HoudiniRuntimeSettings->bPauseCookingOnStart;
+
+        // Watch for the loss of the main session.
+        SessionRecoveryTickerHandle = FTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw( this, &FHoudiniEngine::TickSessionRecovery ),
+            HAPI_UNREAL_SESSION_RECOVERY_CHECK_INTERVAL );
+
+        // Publish the scheduler telemetry as stats and watch for stalled tasks.
+        SchedulerTelemetryTickerHandle = FTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw( this, &FHoudiniEngine::TickSchedulerTelemetry ),
+            HAPI_UNREAL_SCHEDULER_TELEMETRY_INTERVAL );
     }
 
 #endif
@@ -402,11 +557,52 @@ FHoudiniEngine::StartupModule()
     FHoudiniEngine::HoudiniEngineInstance = this;
 }
 
+void
+FHoudiniEngine::StartSessions()
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    // Start the main session, reconnecting to a server kept running by a previous editor session if allowed.
+    HAPI_Session * SessionPtr = &Session;
+    const bool bSessionStarted = StartSession( SessionPtr );
+
+    // Start the additional sessions used to cook independent assets in parallel.
+    if ( bSessionStarted )
+        StartSessionPool( HoudiniRuntimeSettings->CookSessionPoolSize );
+
+    // The pool is complete, make it visible to the other threads.
+    FPlatformMisc::MemoryBarrier();
+    bSessionStarting = false;
+
+    if ( bSessionStarted )
+    {
+        for ( int32 SessionIndex = 0; SessionIndex < GetSessionPoolSize(); ++SessionIndex )
+            PreloadAssetLibraries( SessionIndex );
+    }
+}
+
+bool
+FHoudiniEngine::IsSessionStarting() const
+{
+    return bSessionStarting;
+}
+
 void
 FHoudiniEngine::ShutdownModule()
 {
     HOUDINI_LOG_MESSAGE( TEXT( "Shutting down the Houdini Engine module." ) );
 
+#if WITH_EDITOR
+    // Placed components waiting for their instantiation won't get a session anymore.
+    InstantiationBatch.Reset();
+
+    // Static meshes still being built get their render data before the module goes away.
+    StaticMeshBuildQueue.FinishAllBuilds();
+
+    // Released outputs are left to the final garbage collection.
+    TempPackageCleanup.Flush();
+#endif
+
     // We no longer need Houdini logo static mesh.
     if ( HoudiniLogoStaticMesh.IsValid() )
     {
@@ -433,8 +629,23 @@ FHoudiniEngine::ShutdownModule()
     ISettingsModule * SettingsModule = FModuleManager::GetModulePtr< ISettingsModule >( "Settings" );
     if ( SettingsModule )
         SettingsModule->UnregisterSettings( "Project", "Plugins", "HoudiniEngine" );
+
+    if ( SessionRecoveryTickerHandle.IsValid() )
+    {
+        FTicker::GetCoreTicker().RemoveTicker( SessionRecoveryTickerHandle );
+        SessionRecoveryTickerHandle.Reset();
+    }
+
+    if ( SchedulerTelemetryTickerHandle.IsValid() )
+    {
+        FTicker::GetCoreTicker().RemoveTicker( SchedulerTelemetryTickerHandle );
+        SchedulerTelemetryTickerHandle.Reset();
+    }
 #endif
 
+    // Stop the additional sessions of the session pool.
+    StopSessionPool();
+
     // Do scheduler and thread clean up.
     if ( HoudiniEngineScheduler )
         HoudiniEngineScheduler->Stop();
@@ -461,42 +672,238 @@ FHoudiniEngine::ShutdownModule()
         FHoudiniApi::CloseSession( GetSession() );
     }
 
+    FHoudiniApiTrace::SetEnabled( false );
     FHoudiniApi::FinalizeHAPI();
 }
 
+void
+FHoudiniEngine::StartSessionPool( int32 PoolSize )
+{
+    PoolSize = FMath::Clamp( PoolSize, 1, HAPI_UNREAL_SESSION_POOL_MAX_SIZE );
+    if ( PoolSize <= 1 )
+        return;
+
+    // The pool is built aside and published at once, the game thread may be reading it meanwhile.
+    TArray< HAPI_Session > NewSessions;
+    TArray< FHoudiniEngineScheduler * > NewSchedulers;
+    TArray< FRunnableThread * > NewSchedulerThreads;
+    NewSessions.Reserve( PoolSize - 1 );
+
+    for ( int32 SessionIndex = 1; SessionIndex < PoolSize; ++SessionIndex )
+    {
+        HAPI_Session & PooledSession = NewSessions[ NewSessions.AddDefaulted() ];
+        PooledSession.type = HAPI_SESSION_MAX;
+        PooledSession.id = -1;
+
+        HAPI_Session * PooledSessionPtr = &PooledSession;
+        if ( !StartSession( PooledSessionPtr, SessionIndex ) )
+        {
+            HOUDINI_LOG_WARNING(
+                TEXT( "Failed to start pooled Houdini Engine session %d, using %d session(s) for cooking." ),
+                SessionIndex, SessionIndex );
+
+            NewSessions.Pop( false );
+            break;
+        }
+
+        FHoudiniEngineScheduler * PooledScheduler = new FHoudiniEngineScheduler( SessionIndex );
+        FRunnableThread * PooledSchedulerThread = FRunnableThread::Create(
+            PooledScheduler, *FString::Printf( TEXT( "HoudiniTaskCookAsset%d" ), SessionIndex ), 0, TPri_Normal );
+
+        NewSchedulers.Add( PooledScheduler );
+        NewSchedulerThreads.Add( PooledSchedulerThread );
+    }
+
+    PooledSessions = MoveTemp( NewSessions );
+    PooledSchedulers = MoveTemp( NewSchedulers );
+    PooledSchedulerThreads = MoveTemp( NewSchedulerThreads );
+
+    HOUDINI_LOG_MESSAGE( TEXT( "Using %d Houdini Engine session(s) for cooking." ), GetSessionPoolSize() );
+}
+
+void
+FHoudiniEngine::StopSessionPool()
+{
+    for ( FHoudiniEngineScheduler * PooledScheduler : PooledSchedulers )
+        PooledScheduler->Stop();
+
+    for ( FRunnableThread * PooledSchedulerThread : PooledSchedulerThreads )
+    {
+        if ( !PooledSchedulerThread )
+            continue;
+
+        PooledSchedulerThread->WaitForCompletion();
+        delete PooledSchedulerThread;
+    }
+
+    for ( FHoudiniEngineScheduler * PooledScheduler : PooledSchedulers )
+        delete PooledScheduler;
+
+    PooledSchedulerThreads.Empty();
+    PooledSchedulers.Empty();
+
+    for ( HAPI_Session & PooledSession : PooledSessions )
+    {
+        HAPI_Session * PooledSessionPtr = &PooledSession;
+        StopSession( PooledSessionPtr );
+    }
+
+    PooledSessions.Empty();
+}
+
 void
 FHoudiniEngine::AddTask( const FHoudiniEngineTask & Task )
 {
-    if ( HoudiniEngineScheduler )
-        HoudiniEngineScheduler->AddTask( Task );
+    AddTask( FHoudiniEngineTask( Task ) );
+}
+
+void
+FHoudiniEngine::AddTask( FHoudiniEngineTask && Task )
+{
+    // Register the task info first, the scheduler may report progress as soon as the task is queued.
+    {
+        FTaskInfoShard & Shard = GetTaskInfoShard( Task.HapiGUID );
+        FScopeLock ScopeLock( &Shard.CriticalSection );
+        FHoudiniEngineTaskInfo TaskInfo;
+        Shard.TaskInfos.Add( Task.HapiGUID, TaskInfo );
+        Shard.TaskInterruptRequests.Remove( Task.HapiGUID );
+    }
+
+    // Tasks are executed by the scheduler owning the task's session.
+    FHoudiniEngineScheduler * TaskScheduler = HoudiniEngineScheduler;
+    if ( !IsSessionStarting() && PooledSchedulers.IsValidIndex( Task.SessionIndex - 1 ) )
+        TaskScheduler = PooledSchedulers[ Task.SessionIndex - 1 ];
 
-    FScopeLock ScopeLock( &CriticalSection );
-    FHoudiniEngineTaskInfo TaskInfo;
-    TaskInfos.Add( Task.HapiGUID, TaskInfo );
+    if ( TaskScheduler )
+        TaskScheduler->AddTask( MoveTemp( Task ) );
+}
+
+void
+FHoudiniEngine::AddTasks( TArray< FHoudiniEngineTask > && Tasks )
+{
+    if ( Tasks.Num() <= 0 )
+        return;
+
+    // Register the task infos first, the schedulers may report progress as soon as the tasks are queued.
+    for ( const FHoudiniEngineTask & Task : Tasks )
+    {
+        FTaskInfoShard & Shard = GetTaskInfoShard( Task.HapiGUID );
+        FScopeLock ScopeLock( &Shard.CriticalSection );
+        FHoudiniEngineTaskInfo TaskInfo;
+        Shard.TaskInfos.Add( Task.HapiGUID, TaskInfo );
+        Shard.TaskInterruptRequests.Remove( Task.HapiGUID );
+    }
+
+    // Group the tasks by the scheduler owning their session.
+    TMap< FHoudiniEngineScheduler *, TArray< FHoudiniEngineTask > > SchedulerTasks;
+    for ( FHoudiniEngineTask & Task : Tasks )
+    {
+        FHoudiniEngineScheduler * TaskScheduler = HoudiniEngineScheduler;
+        if ( !IsSessionStarting() && PooledSchedulers.IsValidIndex( Task.SessionIndex - 1 ) )
+            TaskScheduler = PooledSchedulers[ Task.SessionIndex - 1 ];
+
+        if ( TaskScheduler )
+            SchedulerTasks.FindOrAdd( TaskScheduler ).Add( MoveTemp( Task ) );
+    }
+
+    Tasks.Empty();
+
+    for ( TPair< FHoudiniEngineScheduler *, TArray< FHoudiniEngineTask > > & SchedulerTask : SchedulerTasks )
+        SchedulerTask.Key->AddTasks( MoveTemp( SchedulerTask.Value ) );
+}
+
+FHoudiniEngine::FTaskInfoShard &
+FHoudiniEngine::GetTaskInfoShard( const FGuid & HapIGUID )
+{
+    return TaskInfoShards[ GetTypeHash( HapIGUID ) % TaskInfoShardCount ];
 }
 
 void
 FHoudiniEngine::AddTaskInfo( const FGuid HapIGUID, const FHoudiniEngineTaskInfo & TaskInfo )
 {
-    FScopeLock ScopeLock( &CriticalSection );
-    TaskInfos.Add( HapIGUID, TaskInfo );
+    FTaskInfoShard & Shard = GetTaskInfoShard( HapIGUID );
+    FScopeLock ScopeLock( &Shard.CriticalSection );
+    Shard.TaskInfos.Add( HapIGUID, TaskInfo );
+    Shard.UpdatedTaskInfos.Add( HapIGUID );
+}
+
+void
+FHoudiniEngine::RetrieveUpdatedTaskInfos( TSet< FGuid > & OutHapiGUIDs )
+{
+    OutHapiGUIDs.Reset();
+
+    for ( FTaskInfoShard & Shard : TaskInfoShards )
+    {
+        FScopeLock ScopeLock( &Shard.CriticalSection );
+        OutHapiGUIDs.Append( Shard.UpdatedTaskInfos );
+        Shard.UpdatedTaskInfos.Reset();
+    }
+}
+
+#if WITH_EDITOR
+
+FHoudiniEngineCookDispatcher &
+FHoudiniEngine::GetCookDispatcher()
+{
+    return CookDispatcher;
 }
 
+FHoudiniEngineMeshBuildQueue &
+FHoudiniEngine::GetStaticMeshBuildQueue()
+{
+    return StaticMeshBuildQueue;
+}
+
+FHoudiniEngineTempPackageCleanup &
+FHoudiniEngine::GetTempPackageCleanup()
+{
+    return TempPackageCleanup;
+}
+
+FHoudiniEngineInstantiationBatch &
+FHoudiniEngine::GetInstantiationBatch()
+{
+    return InstantiationBatch;
+}
+
+#endif
+
 void
 FHoudiniEngine::RemoveTaskInfo( const FGuid HapIGUID )
 {
-    FScopeLock ScopeLock( &CriticalSection );
-    TaskInfos.Remove( HapIGUID );
+    FTaskInfoShard & Shard = GetTaskInfoShard( HapIGUID );
+    FScopeLock ScopeLock( &Shard.CriticalSection );
+    Shard.TaskInfos.Remove( HapIGUID );
+    Shard.TaskInterruptRequests.Remove( HapIGUID );
+    Shard.UpdatedTaskInfos.Remove( HapIGUID );
+}
+
+void
+FHoudiniEngine::InterruptTask( const FGuid HapIGUID )
+{
+    FTaskInfoShard & Shard = GetTaskInfoShard( HapIGUID );
+    FScopeLock ScopeLock( &Shard.CriticalSection );
+    if ( Shard.TaskInfos.Contains( HapIGUID ) )
+        Shard.TaskInterruptRequests.Add( HapIGUID );
+}
+
+bool
+FHoudiniEngine::ConsumeTaskInterruptRequest( const FGuid HapIGUID )
+{
+    FTaskInfoShard & Shard = GetTaskInfoShard( HapIGUID );
+    FScopeLock ScopeLock( &Shard.CriticalSection );
+    return Shard.TaskInterruptRequests.Remove( HapIGUID ) > 0;
 }
 
 bool
 FHoudiniEngine::RetrieveTaskInfo( const FGuid HapIGUID, FHoudiniEngineTaskInfo & TaskInfo )
 {
-    FScopeLock ScopeLock( &CriticalSection );
+    FTaskInfoShard & Shard = GetTaskInfoShard( HapIGUID );
+    FScopeLock ScopeLock( &Shard.CriticalSection );
 
-    if ( TaskInfos.Contains( HapIGUID ) )
+    if ( const FHoudiniEngineTaskInfo * FoundTaskInfo = Shard.TaskInfos.Find( HapIGUID ) )
     {
-        TaskInfo = TaskInfos[ HapIGUID ];
+        TaskInfo = *FoundTaskInfo;
         return true;
     }
 
@@ -515,6 +922,8 @@ FHoudiniEngine::CookNode(
     TMap< FHoudiniGeoPartObject, USceneComponent * >& InstancersOut,
     USceneComponent* ParentComponent, FTransform & ComponentTransform )
 {
+    SCOPE_CYCLE_COUNTER( STAT_CookNodeOutputs );
+
     // 
     TMap< FHoudiniGeoPartObject, UStaticMesh * > CookResultArray;
     bool bReturn = FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
@@ -571,6 +980,18 @@ FHoudiniEngine::CookNode(
     return true;
 }
 
+bool
+FHoudiniEngine::CookNodeToMeshComponents(
+    HAPI_NodeId AssetId, USceneComponent * ParentComponent, bool bCreateCollision,
+    TMap< FHoudiniGeoPartObject, UProceduralMeshComponent * > & MeshComponentsIn,
+    TMap< FHoudiniGeoPartObject, UProceduralMeshComponent * > & MeshComponentsOut )
+{
+    SCOPE_CYCLE_COUNTER( STAT_CookNodeOutputs );
+
+    return FHoudiniEngineRuntimeMeshUtils::CreateMeshComponentsFromHoudiniAsset(
+        AssetId, ParentComponent, bCreateCollision, MeshComponentsIn, MeshComponentsOut );
+}
+
 void 
 FHoudiniEngine::SetEnableCookingGlobal(const bool& enableCooking)
 {
@@ -585,7 +1006,7 @@ FHoudiniEngine::GetEnableCookingGlobal()
 
 
 bool
-FHoudiniEngine::StartSession( HAPI_Session*& SessionPtr )
+FHoudiniEngine::StartSession( HAPI_Session*& SessionPtr, int32 SessionIndex )
 {
     // HAPI needs to be initialized
     if ( !FHoudiniApi::IsHAPIInitialized() )
@@ -595,15 +1016,27 @@ FHoudiniEngine::StartSession( HAPI_Session*& SessionPtr )
     if ( HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid( SessionPtr ) )
         return true;
 
+    // The health of the previous session no longer applies.
+    SetSessionHealth( SessionIndex, EHoudiniSessionHealth::Unknown, 0.0 );
+
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
 
     HAPI_Result SessionResult = HAPI_RESULT_FAILURE;
 
+    // Servers kept running after the editor closes are reused by the next editor session.
+    const bool bReuseRunningServer = HoudiniRuntimeSettings->bKeepAutomaticServersRunning;
+
     HAPI_ThriftServerOptions ServerOptions;
     FMemory::Memzero< HAPI_ThriftServerOptions >( ServerOptions );
-    ServerOptions.autoClose = true;
+    ServerOptions.autoClose = !bReuseRunningServer;
     ServerOptions.timeoutMs = HoudiniRuntimeSettings->AutomaticServerTimeout;
 
+    // Additional sessions of the session pool connect to their own server.
+    const int32 ServerPort = HoudiniRuntimeSettings->ServerPort + SessionIndex;
+    FString ServerPipeName = HoudiniRuntimeSettings->ServerPipeName;
+    if ( SessionIndex > 0 )
+        ServerPipeName += FString::Printf( TEXT( "_%d" ), SessionIndex );
+
     auto UpdatePathForServer = [&]
     {
         // Modify our PATH so that HARC will find HARS.exe
@@ -619,6 +1052,9 @@ FHoudiniEngine::StartSession( HAPI_Session*& SessionPtr )
         LibHAPILocation + PathDelimiter + OrigPathVar;
 
         FPlatformMisc::SetEnvironmentVar( TEXT( "PATH" ), *ModifiedPath );
+
+        // The server inherits our environment, including its thread count.
+        UpdateCookingThreadEnvironment();
     };
 
     switch ( HoudiniRuntimeSettings->SessionType.GetValue() )
@@ -627,40 +1063,85 @@ FHoudiniEngine::StartSession( HAPI_Session*& SessionPtr )
         {
             // As of Unreal 4.19, InProcess sessions are not supported anymore
             // Create an auto started pipe session instead using default values
-            UpdatePathForServer();
-            FHoudiniApi::StartThriftNamedPipeServer(
-                &ServerOptions, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ), nullptr );
+            if ( bReuseRunningServer )
+            {
+                SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
+                    SessionPtr, TCHAR_TO_UTF8( *ServerPipeName ) );
+            }
 
-            SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
-                SessionPtr, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ) );
+            if ( SessionResult != HAPI_RESULT_SUCCESS )
+            {
+                UpdatePathForServer();
+                FHoudiniApi::StartThriftNamedPipeServer(
+                    &ServerOptions, TCHAR_TO_UTF8( *ServerPipeName ), nullptr );
+
+                SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
+                    SessionPtr, TCHAR_TO_UTF8( *ServerPipeName ) );
+            }
         }
         break;
 
         case EHoudiniRuntimeSettingsSessionType::HRSST_Socket:
         {
-            if ( HoudiniRuntimeSettings->bStartAutomaticServer )
+            if ( bReuseRunningServer )
             {
-                UpdatePathForServer();
-                FHoudiniApi::StartThriftSocketServer(
-                    &ServerOptions, HoudiniRuntimeSettings->ServerPort, nullptr );
+                SessionResult = FHoudiniApi::CreateThriftSocketSession(
+                    SessionPtr, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerHost ), ServerPort );
             }
 
-            SessionResult = FHoudiniApi::CreateThriftSocketSession(
-                SessionPtr, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerHost ), HoudiniRuntimeSettings->ServerPort );
+            if ( SessionResult != HAPI_RESULT_SUCCESS )
+            {
+                if ( HoudiniRuntimeSettings->bStartAutomaticServer )
+                {
+                    UpdatePathForServer();
+                    FHoudiniApi::StartThriftSocketServer(
+                        &ServerOptions, ServerPort, nullptr );
+                }
+
+                SessionResult = FHoudiniApi::CreateThriftSocketSession(
+                    SessionPtr, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerHost ), ServerPort );
+            }
         }
         break;
 
         case EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe:
         {
-            if ( HoudiniRuntimeSettings->bStartAutomaticServer )
+            if ( bReuseRunningServer )
             {
-                UpdatePathForServer();
-                FHoudiniApi::StartThriftNamedPipeServer(
-                    &ServerOptions, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ), nullptr );
+                SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
+                    SessionPtr, TCHAR_TO_UTF8( *ServerPipeName ) );
+            }
+
+            if ( SessionResult != HAPI_RESULT_SUCCESS )
+            {
+                if ( HoudiniRuntimeSettings->bStartAutomaticServer )
+                {
+                    UpdatePathForServer();
+                    FHoudiniApi::StartThriftNamedPipeServer(
+                        &ServerOptions, TCHAR_TO_UTF8( *ServerPipeName ), nullptr );
+                }
+
+                SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
+                    SessionPtr, TCHAR_TO_UTF8( *ServerPipeName ) );
+            }
+        }
+        break;
+
+        case EHoudiniRuntimeSettingsSessionType::HRSST_Custom:
+        {
+            FString CustomSessionInfo = HoudiniRuntimeSettings->CustomSessionInfo;
+            if ( SessionIndex > 0 )
+                CustomSessionInfo += FString::Printf( TEXT( "_%d" ), SessionIndex );
+
+            // Ask the implementation to compress its bulk payloads, for servers reached over slow links.
+            if ( HoudiniRuntimeSettings->bCompressCustomSessionTransport )
+            {
+                CustomSessionInfo += FString::Printf(
+                    HAPI_UNREAL_SESSION_CUSTOM_COMPRESSION_OPTION,
+                    FMath::Clamp( HoudiniRuntimeSettings->CustomSessionCompressionLevel, 1, 9 ) );
             }
 
-            SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
-                SessionPtr, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ) );
+            SessionResult = CreateCustomSession( SessionPtr, CustomSessionInfo );
         }
         break;
 
@@ -723,13 +1204,24 @@ FHoudiniEngine::StartSession( HAPI_Session*& SessionPtr )
     CookOptions.splitPointsByVertexAttributes = false;
     CookOptions.packedPrimInstancingMode = HAPI_PACKEDPRIM_INSTANCING_MODE_FLAT;
 
-    HAPI_Result Result = FHoudiniApi::Initialize( SessionPtr, &CookOptions, true,
-        HoudiniRuntimeSettings->CookingThreadStackSize, 
-        TCHAR_TO_UTF8( *HoudiniRuntimeSettings->HoudiniEnvironmentFiles),
-        TCHAR_TO_UTF8( *HoudiniRuntimeSettings->OtlSearchPath), 
-        TCHAR_TO_UTF8( *HoudiniRuntimeSettings->DsoSearchPath),
-        TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ImageDsoSearchPath), 
-        TCHAR_TO_UTF8( *HoudiniRuntimeSettings->AudioDsoSearchPath) );
+    auto InitializeSession = [&]
+    {
+        return FHoudiniApi::Initialize( SessionPtr, &CookOptions, true,
+            HoudiniRuntimeSettings->CookingThreadStackSize, 
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->HoudiniEnvironmentFiles),
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->OtlSearchPath), 
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->DsoSearchPath),
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ImageDsoSearchPath), 
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->AudioDsoSearchPath) );
+    };
+
+    HAPI_Result Result = InitializeSession();
+    if ( Result == HAPI_RESULT_ALREADY_INITIALIZED )
+    {
+        // We reconnected to a server left initialized by an editor that did not shut down cleanly.
+        FHoudiniApi::Cleanup( SessionPtr );
+        Result = InitializeSession();
+    }
 
     if ( Result != HAPI_RESULT_SUCCESS )
     {
@@ -743,6 +1235,9 @@ FHoudiniEngine::StartSession( HAPI_Session*& SessionPtr )
     HOUDINI_LOG_MESSAGE( TEXT( "Successfully intialized the Houdini Engine API module." ) );
     FHoudiniApi::SetServerEnvString( SessionPtr, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME );
 
+    // Libraries loaded in a previous session are gone.
+    ClearLoadedAssetLibraries( SessionIndex );
+
     return true;
 }
 
@@ -766,14 +1261,178 @@ FHoudiniEngine::StopSession( HAPI_Session*& SessionPtr )
 bool
 FHoudiniEngine::RestartSession()
 {
+    // The sessions are not ours to restart until they have started.
+    if ( IsSessionStarting() )
+        return false;
+
     HAPI_Session* SessionPtr = &Session;
+    // The pooled sessions are restarted as well, so that they pick up the current settings.
+    StopSessionPool();
+
     if ( !StopSession( SessionPtr ) )
         return false;
 
+    // The node ids the volume ranges were cached for are gone with the previous sessions.
+    FHoudiniLandscapeUtils::ClearVolumeZRanges();
+
     if ( !StartSession( SessionPtr ) )
         return false;
 
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    StartSessionPool( HoudiniRuntimeSettings->CookSessionPoolSize );
+
+    for ( int32 SessionIndex = 0; SessionIndex < GetSessionPoolSize(); ++SessionIndex )
+        PreloadAssetLibraries( SessionIndex );
+
+    return true;
+}
+
+bool
+FHoudiniEngine::RecoverSession()
+{
+    if ( IsSessionStarting() )
+        return false;
+
+    const bool bRestarted = RestartSession();
+
+    // Components are restored lazily, the ones with a cached state skip instantiation until visible and may skip cooking.
+    for ( TObjectIterator< UHoudiniAssetComponent > Itr; Itr; ++Itr )
+    {
+        UHoudiniAssetComponent * HoudiniAssetComponent = *Itr;
+        if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() )
+            continue;
+
+        HoudiniAssetComponent->NotifyAssetNeedsToBeRecovered();
+    }
+
+    return bRestarted;
+}
+
+#if WITH_EDITOR
+
+bool
+FHoudiniEngine::TickSchedulerTelemetry( float DeltaTime )
+{
+    // The session pool is not published until startup completes.
+    if ( IsSessionStarting() )
+        return true;
+
+    TArray< FHoudiniEngineSchedulerTelemetry > SchedulerTelemetry;
+    GetSchedulerTelemetry( SchedulerTelemetry );
+    StalledTaskStartTimes.SetNumZeroed( SchedulerTelemetry.Num() );
+
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    const float StallWarningTime = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->SchedulerStallWarningTime : 0.0f;
+    const double Now = FPlatformTime::Seconds();
+
+    int32 PendingTaskCounts[ EHoudiniEngineTaskType::MAX ];
+    FMemory::Memzero( PendingTaskCounts );
+    double OldestTaskAge = 0.0;
+    float Utilization = 0.0f;
+    float StatusPollFraction = 0.0f;
+
+    for ( int32 SessionIndex = 0; SessionIndex < SchedulerTelemetry.Num(); ++SessionIndex )
+    {
+        const FHoudiniEngineSchedulerTelemetry & Telemetry = SchedulerTelemetry[ SessionIndex ];
+        for ( int32 TaskType = 0; TaskType < EHoudiniEngineTaskType::MAX; ++TaskType )
+            PendingTaskCounts[ TaskType ] += Telemetry.PendingTaskCounts[ TaskType ];
+
+        if ( Telemetry.OldestTaskQueuedTime > 0.0 )
+            OldestTaskAge = FMath::Max( OldestTaskAge, Now - Telemetry.OldestTaskQueuedTime );
+
+        Utilization += Telemetry.Utilization / SchedulerTelemetry.Num();
+        StatusPollFraction = FMath::Max( StatusPollFraction, Telemetry.StatusPollFraction );
+
+        // Each stalled task is only reported once.
+        const double CurrentTaskSeconds = Telemetry.CurrentTaskStartTime > 0.0 ? Now - Telemetry.CurrentTaskStartTime : 0.0;
+        if ( StallWarningTime > 0.0f && CurrentTaskSeconds > StallWarningTime
+            && StalledTaskStartTimes[ SessionIndex ] != Telemetry.CurrentTaskStartTime )
+        {
+            StalledTaskStartTimes[ SessionIndex ] = Telemetry.CurrentTaskStartTime;
+
+            static const TCHAR * TaskTypeNames[] =
+            {
+                TEXT( "task" ), TEXT( "instantiation" ), TEXT( "cook" ), TEXT( "deletion" ),
+                TEXT( "asset library preload" ), TEXT( "session startup" )
+            };
+            static_assert( ARRAY_COUNT( TaskTypeNames ) == EHoudiniEngineTaskType::MAX, "Missing task type name." );
+
+            HOUDINI_LOG_WARNING(
+                TEXT( "Houdini Engine session %d: %s of %s has been running for %.1f seconds." ),
+                SessionIndex, TaskTypeNames[ Telemetry.CurrentTaskType ],
+                Telemetry.CurrentTaskActorName.IsEmpty() ? TEXT( "(no asset)" ) : *Telemetry.CurrentTaskActorName,
+                CurrentTaskSeconds );
+        }
+    }
+
+    SET_DWORD_STAT( STAT_PendingInstantiations, PendingTaskCounts[ EHoudiniEngineTaskType::AssetInstantiation ] );
+    SET_DWORD_STAT( STAT_PendingCooks, PendingTaskCounts[ EHoudiniEngineTaskType::AssetCooking ] );
+    SET_DWORD_STAT( STAT_PendingDeletions, PendingTaskCounts[ EHoudiniEngineTaskType::AssetDeletion ] );
+    SET_FLOAT_STAT( STAT_OldestTaskAge, (float) OldestTaskAge );
+    SET_FLOAT_STAT( STAT_SchedulerUtilization, Utilization );
+    SET_FLOAT_STAT( STAT_CookStatusPollFraction, StatusPollFraction );
+
     return true;
 }
 
+bool
+FHoudiniEngine::TickSessionRecovery( float DeltaTime )
+{
+    if ( IsSessionStarting() || !FHoudiniApi::IsHAPIInitialized() )
+        return true;
+
+    // In-process sessions cannot be lost without the editor.
+    if ( Session.type != HAPI_SESSION_THRIFT && Session.type != HAPI_UNREAL_SESSION_CUSTOM_TYPE )
+        return true;
+
+    // The scheduler's heartbeat tells us without blocking, we only check ourselves when it is disabled.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    EHoudiniSessionHealth::Type Health = GetSessionHealth( 0 );
+    if ( Health == EHoudiniSessionHealth::Unknown )
+    {
+        if ( HoudiniRuntimeSettings->SessionHeartbeatInterval > 0.0f )
+            return true;
+
+        Health = ( FHoudiniApi::IsSessionValid( &Session ) == HAPI_RESULT_SUCCESS )
+            ? EHoudiniSessionHealth::Alive : EHoudiniSessionHealth::Lost;
+    }
+
+    if ( Health == EHoudiniSessionHealth::Alive )
+    {
+        bSessionWasValid = true;
+        return true;
+    }
+
+    // Only sessions that used to be valid are recovered, we do not retry a session that failed to start.
+    if ( !bSessionWasValid || !HoudiniRuntimeSettings->bAutomaticSessionRecovery )
+        return true;
+
+    bSessionWasValid = false;
+    HOUDINI_LOG_WARNING( TEXT( "The Houdini Engine session has been lost, restarting it." ) );
+
+    if ( !RecoverSession() )
+        HOUDINI_LOG_ERROR( TEXT( "Failed to recover the Houdini Engine session." ) );
+
+    return true;
+}
+
+#endif
+
+FHoudiniScopedSession::FHoudiniScopedSession( int32 InSessionIndex )
+    : PreviousSessionIndex( HoudiniEngineThreadSessionIndex )
+{
+    HoudiniEngineThreadSessionIndex = InSessionIndex;
+}
+
+FHoudiniScopedSession::~FHoudiniScopedSession()
+{
+    HoudiniEngineThreadSessionIndex = PreviousSessionIndex;
+}
+
+int32
+FHoudiniScopedSession::GetCurrentSessionIndex()
+{
+    return HoudiniEngineThreadSessionIndex;
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -25,11 +25,33 @@
 
 #include "IHoudiniEngine.h"
 #include "HoudiniEngineTaskInfo.h"
+#include "HoudiniEngineCookDispatcher.h"
+#include "HoudiniEngineMeshBuildQueue.h"
+#include "HoudiniEngineTempPackageCleanup.h"
+#include "HoudiniEngineInstantiationBatch.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
 
 
 class UStaticMesh;
 class FRunnableThread;
 class FHoudiniEngineScheduler;
+struct FHoudiniEngineSchedulerTelemetry;
+
+namespace EHoudiniSessionHealth
+{
+    enum Type
+    {
+        /** No heartbeat has been measured since the session was started. **/
+        Unknown,
+
+        /** The last heartbeat reached the session. **/
+        Alive,
+
+        /** The last heartbeat failed, the session or its server is gone. **/
+        Lost
+    };
+}
 
 class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
 {
@@ -75,14 +97,147 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
             TMap< FHoudiniGeoPartObject, USceneComponent * >& InstancersOut,
             USceneComponent* ParentComponent,
             FTransform & ComponentTransform ) override;
+        virtual bool CookNodeToMeshComponents(
+            HAPI_NodeId AssetId, USceneComponent * ParentComponent, bool bCreateCollision,
+            TMap< FHoudiniGeoPartObject, UProceduralMeshComponent * > & MeshComponentsIn,
+            TMap< FHoudiniGeoPartObject, UProceduralMeshComponent * > & MeshComponentsOut ) override;
 
         void SetEnableCookingGlobal(const bool& enableCooking);
         bool GetEnableCookingGlobal();
 
-        bool StartSession( HAPI_Session*& SessionPtr );
+        /** Register task for execution, the task is moved into the scheduler queue. **/
+        void AddTask( FHoudiniEngineTask && Task );
+
+        /** Register a batch of tasks, each scheduler receives its tasks at once. **/
+        void AddTasks( TArray< FHoudiniEngineTask > && Tasks );
+
+        /** Move the GUIDs of the tasks whose info has been updated since the last call into OutHapiGUIDs. **/
+        void RetrieveUpdatedTaskInfos( TSet< FGuid > & OutHapiGUIDs );
+
+#if WITH_EDITOR
+
+        /** Return the dispatcher ticking asset components. **/
+        FHoudiniEngineCookDispatcher & GetCookDispatcher();
+
+        /** Return the queue building generated static meshes. **/
+        FHoudiniEngineMeshBuildQueue & GetStaticMeshBuildQueue();
+
+        /** Return the deferred cleanup of temporary cook outputs. **/
+        FHoudiniEngineTempPackageCleanup & GetTempPackageCleanup();
+
+        /** Return the batch instantiating the asset components placed in the editor. **/
+        FHoudiniEngineInstantiationBatch & GetInstantiationBatch();
+
+#endif
+
+        /** Request the running cook of the given task to be interrupted. **/
+        void InterruptTask( const FGuid HapIGUID );
+
+        /** Return true and clear the request if the given task has been asked to be interrupted. **/
+        bool ConsumeTaskInterruptRequest( const FGuid HapIGUID );
+
+        /** Start the main session and the session pool, executed by the scheduler when starting asynchronously. **/
+        void StartSessions();
+
+        /** Return true while the sessions are being started asynchronously, requests should wait until they are up. **/
+        bool IsSessionStarting() const;
+
+        bool StartSession( HAPI_Session*& SessionPtr, int32 SessionIndex = 0 );
         bool StopSession( HAPI_Session*& SessionPtr );
         bool RestartSession();
 
+        /** Restart the sessions and let every asset component restore itself from its cached state. **/
+        bool RecoverSession();
+
+        /** Return the session at the given index of the session pool, index 0 is the main session. **/
+        const HAPI_Session * GetPooledSession( int32 SessionIndex ) const;
+
+        /** Return the number of sessions in the session pool, including the main session. **/
+        int32 GetSessionPoolSize() const;
+
+        /** Return the index of the pooled session with the fewest pending tasks. **/
+        /** BatchedTaskCounts optionally adds the tasks per session index of a batch not queued yet. **/
+        int32 GetIdleSessionIndex( const TMap< int32, int32 > * BatchedTaskCounts = nullptr ) const;
+
+        /** Find the asset library loaded from the given file in the current thread's session. **/
+        bool FindLoadedAssetLibrary( const FString & AssetFileName, HAPI_AssetLibraryId & OutAssetLibraryId );
+
+        /** Remember the asset library loaded from the given file in the current thread's session. **/
+        void AddLoadedAssetLibrary( const FString & AssetFileName, HAPI_AssetLibraryId AssetLibraryId );
+
+        /** Find the asset library loaded from a buffer with the given content hash in the current thread's session. **/
+        bool FindLoadedAssetLibraryBuffer( const FString & AssetBytesHash, HAPI_AssetLibraryId & OutAssetLibraryId );
+
+        /** Remember the asset library loaded from a buffer with the given content hash in the current thread's session. **/
+        void AddLoadedAssetLibraryBuffer( const FString & AssetBytesHash, HAPI_AssetLibraryId AssetLibraryId );
+
+        /** Queue the loading of the asset libraries found in OtlSearchPath in the given session. **/
+        void PreloadAssetLibraries( int32 SessionIndex );
+
+        /** Return the number of cooking threads a session should use, 0 to let Houdini Engine decide. **/
+        int32 GetCookingThreadCount() const;
+
+        /** Store the liveness and round-trip time of a session, measured by the heartbeat of its scheduler. **/
+        void SetSessionHealth( int32 SessionIndex, EHoudiniSessionHealth::Type Health, double RoundTripTime );
+
+        /** Return the liveness of a session as of its last heartbeat, without calling into HAPI. **/
+        EHoudiniSessionHealth::Type GetSessionHealth( int32 SessionIndex ) const;
+
+        /** Return the round-trip time of the last heartbeat of a session, in seconds. **/
+        double GetSessionRoundTripTime( int32 SessionIndex ) const;
+
+        /** Copy the telemetry of the scheduler of each session of the pool, indexed by session index. **/
+        void GetSchedulerTelemetry( TArray< FHoudiniEngineSchedulerTelemetry > & OutTelemetry ) const;
+
+    protected:
+
+        /** Number of independently locked shards the task info map is split into. **/
+        static const int32 TaskInfoShardCount = 16;
+
+        /** Task infos whose GUIDs hash to the same shard, guarded by their own lock. **/
+        struct FTaskInfoShard
+        {
+            /** Synchronization primitive. **/
+            FCriticalSection CriticalSection;
+
+            /** Map of task statuses. **/
+            TMap< FGuid, FHoudiniEngineTaskInfo > TaskInfos;
+
+            /** Tasks whose running cook has been asked to be interrupted. **/
+            TSet< FGuid > TaskInterruptRequests;
+
+            /** Tasks whose info has been updated since the cook dispatcher last ticked. **/
+            TSet< FGuid > UpdatedTaskInfos;
+        };
+
+        /** Return the shard holding the info of the given task. **/
+        FTaskInfoShard & GetTaskInfoShard( const FGuid & HapIGUID );
+
+        /** Forget the asset libraries loaded in the given session. **/
+        void ClearLoadedAssetLibraries( int32 SessionIndex );
+
+        /** Create a session using the custom HAPI implementation library, binding it first if needed. **/
+        HAPI_Result CreateCustomSession( HAPI_Session * SessionPtr, const FString & SessionInfo );
+
+        /** Set up the environment inherited by the Houdini Engine servers we start, based on the thread settings. **/
+        void UpdateCookingThreadEnvironment() const;
+
+        /** Start the additional sessions of the session pool, along with their schedulers. **/
+        void StartSessionPool( int32 PoolSize );
+
+        /** Stop the additional sessions of the session pool and their schedulers. **/
+        void StopSessionPool();
+
+#if WITH_EDITOR
+
+        /** Ticker callback, recovers the main session if its server has been lost. **/
+        bool TickSessionRecovery( float DeltaTime );
+
+        /** Ticker callback, updates the scheduler stats and warns about the tasks running for too long. **/
+        bool TickSchedulerTelemetry( float DeltaTime );
+
+#endif
+
     public:
 
         /** App identifier string. **/
@@ -119,11 +274,24 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
 
 #endif
 
-        /** Synchronization primitive. **/
-        FCriticalSection CriticalSection;
+        /** Task statuses, sharded by task GUID so the schedulers and ticking components rarely contend. **/
+        FTaskInfoShard TaskInfoShards[ TaskInfoShardCount ];
+
+#if WITH_EDITOR
 
-        /** Map of task statuses. **/
-        TMap< FGuid, FHoudiniEngineTaskInfo > TaskInfos;
+        /** Dispatcher ticking asset components. **/
+        FHoudiniEngineCookDispatcher CookDispatcher;
+
+        /** Queue building generated static meshes on worker threads. **/
+        FHoudiniEngineMeshBuildQueue StaticMeshBuildQueue;
+
+        /** Deferred cleanup of the temporary cook outputs no longer used. **/
+        FHoudiniEngineTempPackageCleanup TempPackageCleanup;
+
+        /** Batched instantiation of the asset components placed in the editor. **/
+        FHoudiniEngineInstantiationBatch InstantiationBatch;
+
+#endif
 
         /** Thread used to execute the scheduler. **/
         FRunnableThread * HoudiniEngineSchedulerThread;
@@ -143,6 +311,80 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
         /** The Houdini Engine session. **/
         HAPI_Session Session;
 
+        /** Additional sessions of the session pool, session index N is stored at N - 1. **/
+        TArray< HAPI_Session > PooledSessions;
+
+        /** Schedulers and their threads for the additional sessions of the session pool. **/
+        TArray< FHoudiniEngineScheduler * > PooledSchedulers;
+        TArray< FRunnableThread * > PooledSchedulerThreads;
+
+        /** Asset library loaded from a file, along with the time stamp of the file when it was loaded. **/
+        struct FLoadedAssetLibrary
+        {
+            HAPI_AssetLibraryId AssetLibraryId;
+            FDateTime TimeStamp;
+        };
+
+        /** Synchronization primitive for the loaded asset libraries. **/
+        FCriticalSection LoadedAssetLibrariesCriticalSection;
+
+        /** Health of a session, written by its scheduler's heartbeat and read from any thread. **/
+        struct FSessionHealth
+        {
+            /** EHoudiniSessionHealth value. **/
+            FThreadSafeCounter Health;
+
+            /** Round-trip time of the last heartbeat, in microseconds. **/
+            FThreadSafeCounter RoundTripTime;
+        };
+
+        /** Health of each session of the pool, indexed by session index. **/
+        TArray< FSessionHealth > SessionHealths;
+
+        /** Asset libraries loaded in each session of the pool, indexed by session index. **/
+        TArray< TMap< FString, FLoadedAssetLibrary > > LoadedAssetLibraries;
+
+        /** Asset libraries loaded from memory in each session of the pool, keyed by content hash. **/
+        TArray< TMap< FString, HAPI_AssetLibraryId > > LoadedAssetLibraryBuffers;
+
+        /** Is set to true once the custom HAPI implementation library has been bound. **/
+        bool bCustomImplementationBound;
+
+        /** Value of the thread count environment variable before we modified it. **/
+        FString OriginalMaxThreadsEnvironment;
+
+        /** Is set to true while the scheduler is starting the sessions. **/
+        FThreadSafeBool bSessionStarting;
+
+#if WITH_EDITOR
+
+        /** Handle of the ticker checking whether the main session is still valid. **/
+        FDelegateHandle SessionRecoveryTickerHandle;
+
+        /** Handle of the ticker reading the scheduler telemetry. **/
+        FDelegateHandle SchedulerTelemetryTickerHandle;
+
+        /** Start time of the last task reported as stalled by each scheduler, indexed by session index. **/
+        TArray< double > StalledTaskStartTimes;
+
+#endif
+
+        /** Is set to true once the main session has been found valid, only such sessions are recovered. **/
+        bool bSessionWasValid;
+
         /** Global cooking flag, used to pause HEngine while using the editor **/
         bool EnableCookingGlobal;
 };
+
+/** Scope during which FHoudiniEngine::GetSession returns the pooled session with the given index on this thread. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniScopedSession
+{
+    FHoudiniScopedSession( int32 InSessionIndex );
+    ~FHoudiniScopedSession();
+
+    /** Return the session index used by the current thread. **/
+    static int32 GetCurrentSessionIndex();
+
+    /** Session index used before entering this scope. **/
+    int32 PreviousSessionIndex;
+};
@@ -56,9 +56,16 @@
     #include "StaticMeshResources.h"
     #include "InstancedFoliage.h"
     #include "InstancedFoliageActor.h"
+    #include "EditorLevelUtils.h"
+    #include "Engine/LevelStreaming.h"
+    #include "Engine/LevelStreamingDynamic.h"
+    #include "Engine/Selection.h"
+    #include "Settings/LevelEditorMiscSettings.h"
 #endif
 #include "EngineUtils.h"
 #include "UObject/MetaData.h"
+#include "Misc/SecureHash.h"
+#include "Misc/FileHelper.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "Components/InstancedStaticMeshComponent.h"
 
@@ -273,6 +280,61 @@ FHoudiniEngineBakeUtils::BakeStaticMesh(
     return StaticMesh;
 }
 
+static FSHAHash GetStaticMeshBakeContentHash( const UStaticMesh * StaticMesh );
+
+/** Blueprints baked with bShareBakedBlueprints, by configuration key. **/
+static TMap< FString, TWeakObjectPtr< UBlueprint > > HoudiniEngineSharedBakedBlueprints;
+
+/** Key identifying what a component bakes to: its asset, its parameters and the content of its output meshes. **/
+static FString
+GetBlueprintBakeConfigurationKey( UHoudiniAssetComponent * HoudiniAssetComponent )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( !HoudiniRuntimeSettings || !HoudiniRuntimeSettings->bShareBakedBlueprints || !HoudiniAssetComponent->HoudiniAsset )
+        return FString();
+
+    TArray< char > PresetBuffer;
+    if ( !FHoudiniEngineUtils::GetAssetPreset( HoudiniAssetComponent->GetAssetId(), PresetBuffer ) )
+        return FString();
+
+    FSHAHash PresetHash;
+    FSHA1::HashBuffer( PresetBuffer.GetData(), PresetBuffer.Num(), PresetHash.Hash );
+
+    // The output meshes cover what the parameters don't, like inputs
+    TArray< FString > MeshKeys;
+    for ( const auto & Iter : HoudiniAssetComponent->CollectAllStaticMeshComponents() )
+    {
+        const UStaticMeshComponent * StaticMeshComponent = Iter.Key;
+        if ( !StaticMeshComponent || StaticMeshComponent->IsPendingKill() || !StaticMeshComponent->GetStaticMesh() )
+            continue;
+
+        MeshKeys.Add( GetStaticMeshBakeContentHash( StaticMeshComponent->GetStaticMesh() ).ToString()
+            + StaticMeshComponent->GetRelativeTransform().ToString() );
+    }
+    MeshKeys.Sort();
+
+    return HoudiniAssetComponent->HoudiniAsset->GetPathName() + TEXT( "_" ) + PresetHash.ToString()
+        + TEXT( "_" ) + FString::Join( MeshKeys, TEXT( "_" ) );
+}
+
+/** Blueprint already baked for the same configuration, if any. **/
+static UBlueprint *
+FindSharedBakedBlueprint( const FString & ConfigurationKey )
+{
+    if ( ConfigurationKey.IsEmpty() )
+        return nullptr;
+
+    TWeakObjectPtr< UBlueprint > * FoundBlueprint = HoudiniEngineSharedBakedBlueprints.Find( ConfigurationKey );
+    if ( !FoundBlueprint || !FoundBlueprint->IsValid() )
+        return nullptr;
+
+    UBlueprint * Blueprint = FoundBlueprint->Get();
+    if ( Blueprint->IsPendingKill() || !Blueprint->GeneratedClass )
+        return nullptr;
+
+    return Blueprint;
+}
+
 UBlueprint *
 FHoudiniEngineBakeUtils::BakeBlueprint( UHoudiniAssetComponent * HoudiniAssetComponent )
 {
@@ -283,6 +345,11 @@ FHoudiniEngineBakeUtils::BakeBlueprint( UHoudiniAssetComponent * HoudiniAssetCom
 
 #if WITH_EDITOR
 
+    const FString ConfigurationKey = GetBlueprintBakeConfigurationKey( HoudiniAssetComponent );
+    Blueprint = FindSharedBakedBlueprint( ConfigurationKey );
+    if ( Blueprint )
+        return Blueprint;
+
     // Create package for our Blueprint.
     FString BlueprintName = TEXT( "" );
     UPackage * Package = FHoudiniEngineBakeUtils::BakeCreateBlueprintPackageForComponent(
@@ -300,7 +367,11 @@ FHoudiniEngineBakeUtils::BakeBlueprint( UHoudiniAssetComponent * HoudiniAssetCom
             Actor->ConditionalBeginDestroy();
 
             if( Blueprint && !Blueprint->IsPendingKill() )
+            {
                 FAssetRegistryModule::AssetCreated( Blueprint );
+                if ( !ConfigurationKey.IsEmpty() )
+                    HoudiniEngineSharedBakedBlueprints.Add( ConfigurationKey, Blueprint );
+            }
         }
     }
 
@@ -319,6 +390,43 @@ FHoudiniEngineBakeUtils::ReplaceHoudiniActorWithBlueprint( UHoudiniAssetComponen
 
 #if WITH_EDITOR
 
+    // We can initiate Houdini actor deletion.
+    auto DestroyHoudiniAssetActor = [ HoudiniAssetComponent ]()
+    {
+        AHoudiniAssetActor * HoudiniAssetActor = HoudiniAssetComponent->GetHoudiniAssetActorOwner();
+
+        // Remove Houdini actor from active selection in editor and delete it.
+        if( GEditor )
+        {
+            GEditor->SelectActor( HoudiniAssetActor, false, false );
+            GEditor->Layers->DisassociateActorFromLayers( HoudiniAssetActor );
+        }
+
+        UWorld * World = HoudiniAssetActor->GetWorld();
+        if ( !World )
+            World = GWorld;
+
+        World->EditorDestroyActor( HoudiniAssetActor, false );
+    };
+
+    // An identical actor was already baked, place an instance of its blueprint instead
+    const FString ConfigurationKey = GetBlueprintBakeConfigurationKey( HoudiniAssetComponent );
+    UBlueprint * SharedBlueprint = FindSharedBakedBlueprint( ConfigurationKey );
+    AHoudiniAssetActor * HoudiniAssetActorOwner = HoudiniAssetComponent->GetHoudiniAssetActorOwner();
+    if ( SharedBlueprint && GEditor && HoudiniAssetActorOwner && HoudiniAssetActorOwner->GetLevel() )
+    {
+        // Bake the asset's landscape
+        BakeLandscape( HoudiniAssetComponent );
+
+        FTransform ActorTransform( HoudiniAssetActorOwner->GetActorRotation(), HoudiniAssetActorOwner->GetActorLocation() );
+        Actor = GEditor->AddActor( HoudiniAssetActorOwner->GetLevel(), SharedBlueprint->GeneratedClass, ActorTransform );
+        if ( Actor && !Actor->IsPendingKill() )
+        {
+            DestroyHoudiniAssetActor();
+            return Actor;
+        }
+    }
+
     // Create package for our Blueprint.
     FString BlueprintName = TEXT( "" );
     UPackage * Package = FHoudiniEngineBakeUtils::BakeCreateBlueprintPackageForComponent( HoudiniAssetComponent, BlueprintName );
@@ -384,6 +492,8 @@ FHoudiniEngineBakeUtils::ReplaceHoudiniActorWithBlueprint( UHoudiniAssetComponen
         // Compile our blueprint and notify asset system about blueprint.
         FKismetEditorUtilities::CompileBlueprint( Blueprint );
         FAssetRegistryModule::AssetCreated( Blueprint );
+        if ( !ConfigurationKey.IsEmpty() )
+            HoudiniEngineSharedBakedBlueprints.Add( ConfigurationKey, Blueprint );
 
         // Retrieve actor transform.
         FVector Location = ClonedActor->GetActorLocation();
@@ -398,21 +508,7 @@ FHoudiniEngineBakeUtils::ReplaceHoudiniActorWithBlueprint( UHoudiniAssetComponen
             Actor = FKismetEditorUtilities::CreateBlueprintInstanceFromSelection( Blueprint, Actors, Location, Rotator );
         }
 
-        // We can initiate Houdini actor deletion.
-        AHoudiniAssetActor * HoudiniAssetActor = HoudiniAssetComponent->GetHoudiniAssetActorOwner();
-
-        // Remove Houdini actor from active selection in editor and delete it.
-        if( GEditor )
-        {
-            GEditor->SelectActor( HoudiniAssetActor, false, false );
-            GEditor->Layers->DisassociateActorFromLayers( HoudiniAssetActor );
-        }
-
-        UWorld * World = HoudiniAssetActor->GetWorld();
-        if ( !World )
-            World = GWorld;
-
-        World->EditorDestroyActor( HoudiniAssetActor, false );
+        DestroyHoudiniAssetActor();
     }
     else
     {
@@ -428,7 +524,8 @@ FHoudiniEngineBakeUtils::ReplaceHoudiniActorWithBlueprint( UHoudiniAssetComponen
 UStaticMesh *
 FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackage(
     const UStaticMesh * StaticMesh, UHoudiniAssetComponent * Component,
-    const FHoudiniGeoPartObject & HoudiniGeoPartObject, EBakeMode BakeMode )
+    const FHoudiniGeoPartObject & HoudiniGeoPartObject, EBakeMode BakeMode,
+    TMap< const UObject*, UObject* >* OriginalToBakedMaterials )
 {
     UStaticMesh * DuplicatedStaticMesh = nullptr;
 #if WITH_EDITOR
@@ -443,6 +540,7 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackage(
             HoudiniCookParams.MaterialAndTextureBakeMode = FHoudiniCookParams::GetDefaultMaterialAndTextureCookMode();
         else
             HoudiniCookParams.MaterialAndTextureBakeMode = BakeMode;
+        HoudiniCookParams.BakedDuplicatesForOriginals = OriginalToBakedMaterials;
 
         FString MeshName;
         FGuid MeshGuid;
@@ -539,6 +637,12 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToActors( UHoudiniAssetComponent * Houd
     auto SplitMeshInstancerComponentToPart = HoudiniAssetComponent->CollectAllMeshSplitInstancerComponents();
     NewActors.Append( BakeHoudiniActorToActors_SplitMeshInstancers( HoudiniAssetComponent, SplitMeshInstancerComponentToPart ) );
 
+    // Large outputs can be split into streaming levels, moving the actors selects them.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    const float StreamingCellSize = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->BakeStreamingCellSize : 0.0f;
+    if ( StreamingCellSize > 0.0f && MoveBakedActorsToStreamingCells( HoudiniAssetComponent, NewActors, StreamingCellSize ) )
+        return;
+
     if( SelectNewActors && NewActors.Num() )
     {
         GEditor->SelectNone( false, true );
@@ -586,6 +690,7 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToActors_InstancedActors(
                 NewActor->SetActorLabel( NewNameStr );
                 NewActor->SetFolderPath( BaseName );
                 NewActor->SetActorTransform( CurrentTransform );
+                NewActors.Add( NewActor );
             }
         }
     }
@@ -593,11 +698,375 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToActors_InstancedActors(
     return NewActors;
 }
 
+bool
+FHoudiniEngineBakeUtils::MoveBakedActorsToStreamingCells(
+    UHoudiniAssetComponent * HoudiniAssetComponent, const TArray< AActor * > & BakedActors, float CellSize )
+{
+#if WITH_EDITOR
+    if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() || CellSize <= 0.0f )
+        return false;
+
+    UWorld * World = GWorld;
+    AActor * OwnerActor = HoudiniAssetComponent->GetOwner();
+    if ( !World || World->IsPendingKill() || !OwnerActor )
+        return false;
+
+    // The cell levels are saved next to the map, which needs to have been saved first.
+    const FString WorldPackageName = World->GetOutermost()->GetName();
+    if ( !FPackageName::IsValidLongPackageName( WorldPackageName ) || WorldPackageName.StartsWith( TEXT( "/Temp/" ) ) )
+    {
+        HOUDINI_LOG_WARNING(
+            TEXT( "Bake to streaming cells: the map must be saved before %s can be partitioned, baked actors are kept in the current level." ),
+            *OwnerActor->GetName() );
+        return false;
+    }
+
+    // Partition the actors by the grid cell their pivot falls into.
+    TMap< FIntPoint, TArray< AActor * > > CellActors;
+    for ( AActor * BakedActor : BakedActors )
+    {
+        if ( !BakedActor || BakedActor->IsPendingKill() )
+            continue;
+
+        const FVector ActorLocation = BakedActor->GetActorLocation();
+        const FIntPoint Cell( FMath::FloorToInt( ActorLocation.X / CellSize ), FMath::FloorToInt( ActorLocation.Y / CellSize ) );
+        CellActors.FindOrAdd( Cell ).Add( BakedActor );
+    }
+
+    if ( CellActors.Num() <= 0 )
+        return false;
+
+    // Streaming levels of previous bakes of this actor are reused.
+    TMap< FName, ULevelStreaming * > StreamingLevelsByPackage;
+    for ( ULevelStreaming * StreamingLevel : World->GetStreamingLevels() )
+    {
+        if ( StreamingLevel )
+            StreamingLevelsByPackage.Add( StreamingLevel->GetWorldAssetPackageFName(), StreamingLevel );
+    }
+
+    TSubclassOf< ULevelStreaming > StreamingLevelClass = GetDefault< ULevelEditorMiscSettings >()->DefaultLevelStreamingClass;
+    if ( !StreamingLevelClass )
+        StreamingLevelClass = ULevelStreamingDynamic::StaticClass();
+
+    TArray< AActor * > MovedActors;
+    for ( TPair< FIntPoint, TArray< AActor * > > & CellActorsPair : CellActors )
+    {
+        const FIntPoint & Cell = CellActorsPair.Key;
+        const FString CellPackageName = FString::Printf(
+            TEXT( "%s_%s_Cell_%d_%d" ), *WorldPackageName, *OwnerActor->GetName(), Cell.X, Cell.Y );
+
+        ULevelStreaming * CellStreamingLevel = StreamingLevelsByPackage.FindRef( FName( *CellPackageName ) );
+        if ( !CellStreamingLevel )
+        {
+            const FString CellFilename = FPackageName::LongPackageNameToFilename(
+                CellPackageName, FPackageName::GetMapPackageExtension() );
+            CellStreamingLevel = EditorLevelUtils::CreateNewStreamingLevel( StreamingLevelClass, CellFilename, false );
+        }
+
+        if ( !CellStreamingLevel )
+        {
+            HOUDINI_LOG_WARNING(
+                TEXT( "Bake to streaming cells: unable to create streaming level %s, its actors are kept in the current level." ),
+                *CellPackageName );
+            continue;
+        }
+
+        HOUDINI_LOG_MESSAGE(
+            TEXT( "Bake to streaming cells: moving %d actors to %s." ), CellActorsPair.Value.Num(), *CellPackageName );
+
+        EditorLevelUtils::MoveActorsToLevel( CellActorsPair.Value, CellStreamingLevel, false );
+
+        // Moved actors are recreated in their new level and selected.
+        for ( FSelectionIterator It = GEditor->GetSelectedActorIterator(); It; ++It )
+        {
+            if ( AActor * MovedActor = Cast< AActor >( *It ) )
+                MovedActors.Add( MovedActor );
+        }
+    }
+
+    if ( MovedActors.Num() <= 0 )
+        return false;
+
+    // Keep working in the level the actors were baked from, and select all the moved actors.
+    EditorLevelUtils::MakeLevelCurrent( OwnerActor->GetLevel() );
+
+    GEditor->SelectNone( false, true );
+    for ( AActor * MovedActor : MovedActors )
+    {
+        if ( MovedActor && !MovedActor->IsPendingKill() )
+            GEditor->SelectActor( MovedActor, true, false );
+    }
+    GEditor->NoteSelectionChange();
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+/** Baked static meshes, by the content hash of the generated mesh they were baked from. **/
+static TMap< FSHAHash, TWeakObjectPtr< UStaticMesh > > HoudiniEngineBakedStaticMeshesForContent;
+
+/** Hash the geometry, build settings, materials and collision of a mesh, so identical generated meshes bake once. **/
+static FSHAHash
+GetStaticMeshBakeContentHash( const UStaticMesh * StaticMesh )
+{
+    FSHAHash Hash;
+#if WITH_EDITOR
+    FSHA1 HashState;
+    auto UpdateValue = [ &HashState ]( const auto & Value )
+    {
+        HashState.Update( (const uint8 *) &Value, sizeof( Value ) );
+    };
+    auto UpdateArray = [ &HashState, &UpdateValue ]( const auto & Array )
+    {
+        UpdateValue( Array.Num() );
+        if ( Array.Num() > 0 )
+            HashState.Update( (const uint8 *) Array.GetData(), Array.Num() * Array.GetTypeSize() );
+    };
+    auto UpdateString = [ &HashState ]( const FString & String )
+    {
+        HashState.UpdateWithString( *String, String.Len() );
+    };
+
+    for ( const FStaticMeshSourceModel & SrcModel : StaticMesh->SourceModels )
+    {
+        FRawMesh RawMesh;
+        if ( SrcModel.RawMeshBulkData && !SrcModel.RawMeshBulkData->IsEmpty() )
+            SrcModel.RawMeshBulkData->LoadRawMesh( RawMesh );
+
+        UpdateArray( RawMesh.FaceMaterialIndices );
+        UpdateArray( RawMesh.FaceSmoothingMasks );
+        UpdateArray( RawMesh.VertexPositions );
+        UpdateArray( RawMesh.WedgeIndices );
+        UpdateArray( RawMesh.WedgeTangentX );
+        UpdateArray( RawMesh.WedgeTangentY );
+        UpdateArray( RawMesh.WedgeTangentZ );
+        UpdateArray( RawMesh.WedgeColors );
+        for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_MESH_TEXTURE_COORDS; ++TexCoordIdx )
+            UpdateArray( RawMesh.WedgeTexCoords[ TexCoordIdx ] );
+
+        const FMeshBuildSettings & BuildSettings = SrcModel.BuildSettings;
+        const uint32 BuildFlags =
+            ( BuildSettings.bRecomputeNormals ? 1 : 0 )
+            | ( BuildSettings.bRecomputeTangents ? 2 : 0 )
+            | ( BuildSettings.bUseMikkTSpace ? 4 : 0 )
+            | ( BuildSettings.bRemoveDegenerates ? 8 : 0 )
+            | ( BuildSettings.bGenerateLightmapUVs ? 16 : 0 );
+        UpdateValue( BuildFlags );
+        UpdateValue( BuildSettings.SrcLightmapIndex );
+        UpdateValue( BuildSettings.DstLightmapIndex );
+        UpdateValue( BuildSettings.MinLightmapResolution );
+        UpdateValue( BuildSettings.BuildScale3D );
+        UpdateValue( BuildSettings.DistanceFieldResolutionScale );
+        UpdateValue( SrcModel.ScreenSize.Default );
+    }
+
+    for ( const FStaticMaterial & StaticMaterial : StaticMesh->StaticMaterials )
+    {
+        UpdateString( StaticMaterial.MaterialInterface ? StaticMaterial.MaterialInterface->GetPathName() : FString() );
+        UpdateString( StaticMaterial.MaterialSlotName.ToString() );
+    }
+
+    UpdateValue( StaticMesh->LightMapResolution );
+    UpdateValue( StaticMesh->LightMapCoordinateIndex );
+
+    if ( StaticMesh->BodySetup && !StaticMesh->BodySetup->IsPendingKill() )
+    {
+        const FKAggregateGeom & AggGeom = StaticMesh->BodySetup->AggGeom;
+        UpdateValue( (int32) StaticMesh->BodySetup->CollisionTraceFlag );
+        for ( const FKBoxElem & Box : AggGeom.BoxElems )
+        {
+            UpdateValue( Box.Center );
+            UpdateValue( Box.Rotation );
+            UpdateValue( Box.X );
+            UpdateValue( Box.Y );
+            UpdateValue( Box.Z );
+        }
+        for ( const FKSphereElem & Sphere : AggGeom.SphereElems )
+        {
+            UpdateValue( Sphere.Center );
+            UpdateValue( Sphere.Radius );
+        }
+        for ( const FKSphylElem & Sphyl : AggGeom.SphylElems )
+        {
+            UpdateValue( Sphyl.Center );
+            UpdateValue( Sphyl.Rotation );
+            UpdateValue( Sphyl.Radius );
+            UpdateValue( Sphyl.Length );
+        }
+        for ( const FKConvexElem & Convex : AggGeom.ConvexElems )
+            UpdateArray( Convex.VertexData );
+    }
+
+    HashState.Final();
+    HashState.GetHash( Hash.Hash );
+#endif
+    return Hash;
+}
+
+/** Baked meshes saved to disk, by content hash, as recorded in the bake progress file. **/
+static TMap< FString, FString > HoudiniEngineSavedBakedStaticMeshes;
+static bool bHoudiniEngineSavedBakedStaticMeshesLoaded = false;
+
+/** Baked meshes, by content hash, whose packages haven't been saved yet. **/
+static TMap< FString, TWeakObjectPtr< UStaticMesh > > HoudiniEngineUnsavedBakedStaticMeshes;
+
+/** The bake progress file records the saved baked meshes, so an interrupted bake can reuse them. **/
+static FString
+GetBakeProgressFilePath()
+{
+    return FPaths::ProjectSavedDir() / TEXT( "HoudiniEngine" ) / TEXT( "BakeProgress.txt" );
+}
+
+static void
+LoadBakeProgress()
+{
+    if ( bHoudiniEngineSavedBakedStaticMeshesLoaded )
+        return;
+
+    bHoudiniEngineSavedBakedStaticMeshesLoaded = true;
+
+    // Each line is "ContentHash|MeshObjectPath"
+    TArray< FString > Lines;
+    FFileHelper::LoadFileToStringArray( Lines, *GetBakeProgressFilePath() );
+    for ( const FString & Line : Lines )
+    {
+        FString HashString, ObjectPath;
+        if ( Line.Split( TEXT( "|" ), &HashString, &ObjectPath ) )
+            HoudiniEngineSavedBakedStaticMeshes.Add( HashString, ObjectPath );
+    }
+}
+
+/** Packages of a baked mesh and of the materials and textures it uses. **/
+static void
+GetBakedStaticMeshPackages( UStaticMesh * BakedSM, TArray< UPackage * > & OutPackages )
+{
+    OutPackages.AddUnique( BakedSM->GetOutermost() );
+    for ( const FStaticMaterial & StaticMaterial : BakedSM->StaticMaterials )
+    {
+        UMaterial * Material = Cast< UMaterial >( StaticMaterial.MaterialInterface );
+        if ( !Material || Material->IsPendingKill() )
+            continue;
+
+        OutPackages.AddUnique( Material->GetOutermost() );
+#if WITH_EDITOR
+        for ( UMaterialExpression * Expression : Material->Expressions )
+        {
+            UMaterialExpressionTextureSample * TextureSample = Cast< UMaterialExpressionTextureSample >( Expression );
+            if ( TextureSample && TextureSample->Texture && !TextureSample->Texture->IsPendingKill() )
+                OutPackages.AddUnique( TextureSample->Texture->GetOutermost() );
+        }
+#endif
+    }
+}
+
+/** Save the packages of the baked meshes if required, and collect garbage if the memory ceiling is exceeded. **/
+static void
+FlushBakedStaticMeshes()
+{
+#if WITH_EDITOR
+    if ( HoudiniEngineUnsavedBakedStaticMeshes.Num() <= 0 )
+        return;
+
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( !HoudiniRuntimeSettings )
+        return;
+
+    const uint64 UsedPhysicalMB = FPlatformMemory::GetStats().UsedPhysical / ( 1024 * 1024 );
+    const bool bMemoryCeilingExceeded =
+        HoudiniRuntimeSettings->BakeMemoryCeilingMB > 0 && UsedPhysicalMB > (uint64) HoudiniRuntimeSettings->BakeMemoryCeilingMB;
+
+    if ( !HoudiniRuntimeSettings->bSaveBakedPackagesImmediately && !bMemoryCeilingExceeded )
+        return;
+
+    TArray< UPackage * > PackagesToSave;
+    TArray< FString > SavedHashes;
+    for ( const auto & Iter : HoudiniEngineUnsavedBakedStaticMeshes )
+    {
+        UStaticMesh * BakedSM = Iter.Value.Get();
+        if ( !BakedSM || BakedSM->IsPendingKill() )
+            continue;
+
+        GetBakedStaticMeshPackages( BakedSM, PackagesToSave );
+        SavedHashes.Add( Iter.Key );
+    }
+
+    if ( PackagesToSave.Num() > 0 &&
+        FEditorFileUtils::PromptForCheckoutAndSave( PackagesToSave, true, false ) == FEditorFileUtils::PR_Success )
+    {
+        // Record the saved meshes, so a bake interrupted from now on can reuse them
+        LoadBakeProgress();
+        TArray< FString > Lines;
+        for ( const FString & HashString : SavedHashes )
+        {
+            UStaticMesh * BakedSM = HoudiniEngineUnsavedBakedStaticMeshes[ HashString ].Get();
+            HoudiniEngineSavedBakedStaticMeshes.Add( HashString, BakedSM->GetPathName() );
+            Lines.Add( HashString + TEXT( "|" ) + BakedSM->GetPathName() );
+        }
+
+        FFileHelper::SaveStringArrayToFile(
+            Lines, *GetBakeProgressFilePath(), FFileHelper::EEncodingOptions::AutoDetect,
+            &IFileManager::Get(), FILEWRITE_Append );
+    }
+
+    HoudiniEngineUnsavedBakedStaticMeshes.Empty();
+
+    // The baked assets are standalone and are kept, this releases the garbage left by the bake so far
+    if ( bMemoryCeilingExceeded )
+    {
+        HOUDINI_LOG_MESSAGE( TEXT( "Bake memory ceiling exceeded (%llu MB used), collecting garbage." ), UsedPhysicalMB );
+        CollectGarbage( GARBAGE_COLLECTION_KEEPFLAGS );
+    }
+#endif
+}
+
+/** Bake a generated mesh, unless an identical one, possibly from another component, was already baked. **/
+static UStaticMesh *
+FindOrBakeStaticMesh(
+    const UStaticMesh * OriginalSM, UHoudiniAssetComponent * HoudiniAssetComponent,
+    const FHoudiniGeoPartObject & HoudiniGeoPartObject, TMap< const UObject*, UObject* >* OriginalToBakedMaterials )
+{
+    const FSHAHash ContentHash = GetStaticMeshBakeContentHash( OriginalSM );
+    if ( TWeakObjectPtr< UStaticMesh > * FoundBakedSM = HoudiniEngineBakedStaticMeshesForContent.Find( ContentHash ) )
+    {
+        UStaticMesh * BakedSM = FoundBakedSM->Get();
+        if ( BakedSM && !BakedSM->IsPendingKill() && BakedSM->GetOutermost() && !BakedSM->GetOutermost()->IsPendingKill() )
+            return BakedSM;
+    }
+
+    // Reuse a mesh saved by a previous, possibly interrupted, bake
+    const FString HashString = ContentHash.ToString();
+    LoadBakeProgress();
+    if ( const FString * SavedObjectPath = HoudiniEngineSavedBakedStaticMeshes.Find( HashString ) )
+    {
+        UStaticMesh * SavedSM = LoadObject< UStaticMesh >( nullptr, **SavedObjectPath, nullptr, LOAD_NoWarn );
+        if ( SavedSM && !SavedSM->IsPendingKill() )
+        {
+            HoudiniEngineBakedStaticMeshesForContent.Add( ContentHash, SavedSM );
+            return SavedSM;
+        }
+    }
+
+    UStaticMesh * BakedSM = FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackage(
+        OriginalSM, HoudiniAssetComponent, HoudiniGeoPartObject, EBakeMode::CreateNewAssets, OriginalToBakedMaterials );
+
+    if ( BakedSM )
+    {
+        HoudiniEngineBakedStaticMeshesForContent.Add( ContentHash, BakedSM );
+        HoudiniEngineUnsavedBakedStaticMeshes.Add( HashString, BakedSM );
+        FlushBakedStaticMeshes();
+    }
+
+    return BakedSM;
+}
+
 void
 FHoudiniEngineBakeUtils::CheckedBakeStaticMesh(
     UHoudiniAssetComponent* HoudiniAssetComponent,
     TMap< const UStaticMesh*, UStaticMesh* >& OriginalToBakedMesh,
-    const FHoudiniGeoPartObject & HoudiniGeoPartObject, UStaticMesh* OriginalSM)
+    const FHoudiniGeoPartObject & HoudiniGeoPartObject, UStaticMesh* OriginalSM,
+    TMap< const UObject*, UObject* >* OriginalToBakedMaterials )
 {
     UStaticMesh* BakedSM = nullptr;
     if( UStaticMesh ** FoundMeshPtr = OriginalToBakedMesh.Find(OriginalSM) )
@@ -610,8 +1079,7 @@ FHoudiniEngineBakeUtils::CheckedBakeStaticMesh(
         if( FHoudiniEngineBakeUtils::StaticMeshRequiresBake(OriginalSM) )
         {
             // Bake the found mesh into the project
-            BakedSM = FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackage(
-                OriginalSM, HoudiniAssetComponent, HoudiniGeoPartObject, EBakeMode::CreateNewAssets);
+            BakedSM = FindOrBakeStaticMesh( OriginalSM, HoudiniAssetComponent, HoudiniGeoPartObject, OriginalToBakedMaterials );
 
             if( ensure(BakedSM) )
             {
@@ -633,6 +1101,7 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToActors_StaticMeshes(
     TMap< const UStaticMeshComponent*, FHoudiniGeoPartObject >& SMComponentToPart )
 {
     TMap< const UStaticMesh*, UStaticMesh* > OriginalToBakedMesh;
+    TMap< const UObject*, UObject* > OriginalToBakedMaterials;
 
     TArray< AActor* > NewActors;
     if (!HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill())
@@ -651,7 +1120,7 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToActors_StaticMeshes(
         if( !OtherSM || OtherSM->IsPendingKill() )
             continue;
 
-        CheckedBakeStaticMesh(HoudiniAssetComponent, OriginalToBakedMesh, HoudiniGeoPartObject, OtherSM);
+        CheckedBakeStaticMesh(HoudiniAssetComponent, OriginalToBakedMesh, HoudiniGeoPartObject, OtherSM, &OriginalToBakedMaterials);
     }
 
     // Finished baking, now spawn the actors
@@ -767,10 +1236,11 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToActors_StaticMeshes(
             }
 #else
             // This is an instanced static mesh component - we will split it up into StaticMeshActors
-            for( int32 InstanceIx = 0; InstanceIx < OtherISMC->GetInstanceCount(); ++InstanceIx )
+            // Read the instances straight from the component's per-instance data.
+            const FTransform & ComponentTransform = OtherISMC->GetComponentTransform();
+            for( const FInstancedStaticMeshInstanceData & InstanceData : OtherISMC->PerInstanceSMData )
             {
-                FTransform InstanceTransform;
-                OtherISMC->GetInstanceTransform( InstanceIx, InstanceTransform, true );
+                FTransform InstanceTransform = FTransform( InstanceData.Transform ) * ComponentTransform;
                 AActor* NewActor = Factory->CreateActor(BakedSM, DesiredLevel, InstanceTransform, RF_Transactional);
                 if (!NewActor || NewActor->IsPendingKill())
                     continue;
@@ -814,6 +1284,7 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToActors_SplitMeshInstancers(UHoudiniAs
 
 #if WITH_EDITOR
     TMap< const UStaticMesh*, UStaticMesh* > OriginalToBakedMesh;
+    TMap< const UObject*, UObject* > OriginalToBakedMaterials;
 
     for( auto&& Iter : SplitMeshInstancerComponentToPart )
     {
@@ -828,7 +1299,7 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToActors_SplitMeshInstancers(UHoudiniAs
         if( !OtherSM || OtherSM->IsPendingKill() )
             continue;
 
-        CheckedBakeStaticMesh(HoudiniAssetComponent, OriginalToBakedMesh, HoudiniGeoPartObject, OtherSM);
+        CheckedBakeStaticMesh(HoudiniAssetComponent, OriginalToBakedMesh, HoudiniGeoPartObject, OtherSM, &OriginalToBakedMaterials);
     }
     // Done baking, now spawn the actors
     for( auto&& Iter : SplitMeshInstancerComponentToPart )
@@ -959,6 +1430,7 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToOutlinerInput( UHoudiniAssetComponent
 
 #if WITH_EDITOR
     TMap< const UStaticMesh*, UStaticMesh* > OriginalToBakedMesh;
+    TMap< const UObject*, UObject* > OriginalToBakedMaterials;
     TMap< const UStaticMeshComponent*, FHoudiniGeoPartObject > SMComponentToPart = HoudiniAssetComponent->CollectAllStaticMeshComponents();
 
     for( const auto& Iter : SMComponentToPart )
@@ -981,8 +1453,7 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToOutlinerInput( UHoudiniAssetComponent
         else
         {
             // Bake the found mesh into the project
-            BakedSM = FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackage(
-                OtherSM, HoudiniAssetComponent, HoudiniGeoPartObject, EBakeMode::CreateNewAssets );
+            BakedSM = FindOrBakeStaticMesh( OtherSM, HoudiniAssetComponent, HoudiniGeoPartObject, &OriginalToBakedMaterials );
 
             if( BakedSM )
             {
@@ -1041,6 +1512,7 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToFoliage(UHoudiniAssetComponent * Houd
 
     // Map storing original and baked Static Meshes
     TMap< const UStaticMesh*, UStaticMesh* > OriginalToBakedMesh;
+    TMap< const UObject*, UObject* > OriginalToBakedMaterials;
 
     const TArray< UHoudiniAssetInstanceInputField * > InstanceInputFields = HoudiniAssetComponent->GetAllInstanceInputFields();
     for ( int32 Idx = 0; Idx < InstanceInputFields.Num(); ++Idx )
@@ -1068,14 +1540,14 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToFoliage(UHoudiniAssetComponent * Houd
 
                 // We're instancing a mesh created by the plugin, bake it if we haven't already
                 auto&& ItemGeoPartObject = HoudiniAssetComponent->LocateGeoPartObject(OutStaticMesh);
-                FHoudiniEngineBakeUtils::CheckedBakeStaticMesh(HoudiniAssetComponent, OriginalToBakedMesh, ItemGeoPartObject, OriginalSM);
+                FHoudiniEngineBakeUtils::CheckedBakeStaticMesh(HoudiniAssetComponent, OriginalToBakedMesh, ItemGeoPartObject, OriginalSM, &OriginalToBakedMaterials);
                 OutStaticMesh = OriginalToBakedMesh[ OutStaticMesh ];
                 /*
                 // If previously created a foliage type for that mesh, then we dont need to bake it now
                 if ( !InstancedFoliageActor->GetLocalFoliageTypeForMesh(OriginalSM) )
                 {
                     auto&& ItemGeoPartObject = HoudiniAssetComponent->LocateGeoPartObject( OutStaticMesh );
-                    FHoudiniEngineBakeUtils::CheckedBakeStaticMesh(HoudiniAssetComponent, OriginalToBakedMesh, ItemGeoPartObject, OriginalSM);
+                    FHoudiniEngineBakeUtils::CheckedBakeStaticMesh(HoudiniAssetComponent, OriginalToBakedMesh, ItemGeoPartObject, OriginalSM, &OriginalToBakedMaterials);
                     OutStaticMesh = OriginalToBakedMesh[OutStaticMesh];
                 }
                 else
@@ -1085,45 +1557,10 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToFoliage(UHoudiniAssetComponent * Houd
                 */
             }
 
-            // Now duplicate the Instanced Static Mesh Component
-            // Do we need a Hierarchical ISMC ?
-            UHierarchicalInstancedStaticMeshComponent * HISMC =
-                Cast<UHierarchicalInstancedStaticMeshComponent>( HoudiniAssetInstanceInputField->GetInstancedComponent( VariationIdx ) );
-
-            UInstancedStaticMeshComponent* DuplicatedComponent = nullptr;
-            if ( HISMC && !HISMC->IsPendingKill() )
-                DuplicatedComponent = NewObject< UHierarchicalInstancedStaticMeshComponent >(
-                    InstancedFoliageActor, UHierarchicalInstancedStaticMeshComponent::StaticClass(), NAME_None, RF_Public );
-            else
-                DuplicatedComponent = NewObject< UInstancedStaticMeshComponent >(
-                    InstancedFoliageActor, UInstancedStaticMeshComponent::StaticClass(), NAME_None, RF_Public );
-
-            if (!DuplicatedComponent || DuplicatedComponent->IsPendingKill())
-                continue;
-
-            // Add the Duplicated Instancer Component to the foliage Actor
-            InstancedFoliageActor->AddInstanceComponent(DuplicatedComponent);
-            DuplicatedComponent->SetStaticMesh(OutStaticMesh);
-
-            // Reapply the uproperties modified by attributes on the duplicated component
-            FHoudiniGeoPartObject HoudiniGeoPartObject = HoudiniAssetComponent->LocateGeoPartObject(OutStaticMesh);
-            FHoudiniEngineUtils::UpdateUPropertyAttributesOnObject( DuplicatedComponent, HoudiniGeoPartObject );
-
-            // Set the instances on the duplicated instancer component.
+            // The foliage actor renders the instances through its own component, so they go straight
+            // into the foliage mesh info instead of through a duplicate of our instancer component.
             TArray< FTransform > ProcessedTransforms;
             HoudiniAssetInstanceInputField->GetProcessedTransforms(ProcessedTransforms, VariationIdx);
-            UHoudiniInstancedActorComponent::UpdateInstancerComponentInstances(
-                DuplicatedComponent,
-                ProcessedTransforms,
-                HoudiniAssetInstanceInputField->GetInstancedColors(VariationIdx) );
-
-            // Copy visibility.
-            DuplicatedComponent->SetVisibility(ISMC->IsVisible());
-
-            // Attache the Instancer to the foliage actor
-            DuplicatedComponent->AttachToComponent( InstancedFoliageActor->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform );
-            DuplicatedComponent->RegisterComponent();
-            DuplicatedComponent->GetBodyInstance()->bAutoWeld = false;
 
             // Create the Foliage type for the mesh and set the instances on the foliage mesh info
             UFoliageType* FoliageType = InstancedFoliageActor->GetLocalFoliageTypeForMesh(OutStaticMesh);
@@ -1138,17 +1575,24 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToFoliage(UHoudiniAssetComponent * Houd
             if ( !FoliageMeshInfo )
                 continue;
 
-            for (auto CurrentTransform : ProcessedTransforms)
+            // Foliage instances are in world space, our transforms are relative to the instancer component.
+            // Add them all without rebuilding the foliage tree, and build it once at the end.
+            const FTransform & InstancerTransform = ISMC->GetComponentTransform();
+            FoliageMeshInfo->Instances.Reserve( FoliageMeshInfo->Instances.Num() + ProcessedTransforms.Num() );
+            for ( const FTransform & CurrentTransform : ProcessedTransforms )
             {
+                FTransform WorldTransform = CurrentTransform * InstancerTransform;
+
                 FFoliageInstance FoliageInstance;
-                FoliageInstance.Location = CurrentTransform.GetLocation();
-                FoliageInstance.Rotation = CurrentTransform.GetRotation().Rotator();
-                FoliageInstance.DrawScale3D = CurrentTransform.GetScale3D();
+                FoliageInstance.Location = WorldTransform.GetLocation();
+                FoliageInstance.Rotation = WorldTransform.GetRotation().Rotator();
+                FoliageInstance.DrawScale3D = WorldTransform.GetScale3D();
 
-                FoliageMeshInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance, DuplicatedComponent, false);
+                FoliageMeshInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance, nullptr, false);
             }
 
-            FoliageMeshInfo->Component->BuildTreeIfOutdated(true, true);
+            if ( FoliageMeshInfo->Component && !FoliageMeshInfo->Component->IsPendingKill() )
+                FoliageMeshInfo->Component->BuildTreeIfOutdated(true, true);
 
             // Notify the user that we succesfully bake the instances to foliage
             FString Notification = TEXT("Successfully baked ") + FString::FromInt(ProcessedTransforms.Num()) + TEXT(" instances of ") + OutStaticMesh->GetName() + TEXT(" to Foliage");
@@ -1191,6 +1635,17 @@ FHoudiniEngineBakeUtils::DuplicateMaterialAndCreatePackage(
 {
     UMaterial * DuplicatedMaterial = nullptr;
 #if WITH_EDITOR
+    // Reuse the material if it was already baked for another mesh
+    if ( HoudiniCookParams.BakedDuplicatesForOriginals )
+    {
+        if ( UObject ** FoundDuplicate = HoudiniCookParams.BakedDuplicatesForOriginals->Find( Material ) )
+        {
+            DuplicatedMaterial = Cast< UMaterial >( *FoundDuplicate );
+            if ( DuplicatedMaterial && !DuplicatedMaterial->IsPendingKill() )
+                return DuplicatedMaterial;
+        }
+    }
+
     // Create material package.
     FString MaterialName;
     UPackage * MaterialPackage = FHoudiniEngineBakeUtils::BakeCreateTextureOrMaterialPackageForComponent(
@@ -1231,6 +1686,9 @@ FHoudiniEngineBakeUtils::DuplicateMaterialAndCreatePackage(
 
     // Reset any derived state
     DuplicatedMaterial->ForceRecompileForRendering();
+
+    if ( HoudiniCookParams.BakedDuplicatesForOriginals )
+        HoudiniCookParams.BakedDuplicatesForOriginals->Add( Material, DuplicatedMaterial );
 #endif
     return DuplicatedMaterial;
 }
@@ -1272,6 +1730,17 @@ FHoudiniEngineBakeUtils::DuplicateTextureAndCreatePackage(
 {
     UTexture2D* DuplicatedTexture = nullptr;
 #if WITH_EDITOR
+    // Reuse the texture if it was already baked for another material
+    if ( HoudiniCookParams.BakedDuplicatesForOriginals )
+    {
+        if ( UObject ** FoundDuplicate = HoudiniCookParams.BakedDuplicatesForOriginals->Find( Texture ) )
+        {
+            DuplicatedTexture = Cast< UTexture2D >( *FoundDuplicate );
+            if ( DuplicatedTexture && !DuplicatedTexture->IsPendingKill() )
+                return DuplicatedTexture;
+        }
+    }
+
     // Retrieve original package of this texture.
     UPackage * TexturePackage = Cast< UPackage >( Texture->GetOuter() );
     if( !TexturePackage || TexturePackage->IsPendingKill() )
@@ -1320,6 +1789,9 @@ FHoudiniEngineBakeUtils::DuplicateTextureAndCreatePackage(
 
         // Dirty the texture package.
         DuplicatedTexture->MarkPackageDirty();
+
+        if ( HoudiniCookParams.BakedDuplicatesForOriginals )
+            HoudiniCookParams.BakedDuplicatesForOriginals->Add( Texture, DuplicatedTexture );
     }
 #endif
     return DuplicatedTexture;
@@ -1340,6 +1812,7 @@ FHoudiniCookParams::FHoudiniCookParams( UHoudiniAssetComponent* HoudiniAssetComp
     BakeFolder = HoudiniAssetComponent->GetBakeFolder();
     IntermediateOuter = HoudiniAssetComponent->GetComponentLevel();
     GeneratedDistanceFieldResolutionScale = HoudiniAssetComponent->GeneratedDistanceFieldResolutionScale;
+    GeneratedAutoLODTriangleBudget = HoudiniAssetComponent->GeneratedAutoLODTriangleBudget;
 #endif
 }
 
@@ -1357,7 +1830,8 @@ FHoudiniEngineBakeUtils::BakeLandscape( UHoudiniAssetComponent* HoudiniAssetComp
     if ( !LandscapeComponentsPtr )
         return false;
 
-    TArray<UPackage *> LayerPackages;
+    // Parts of the baked landscapes, their layers are then gathered in a single pass
+    TSet< FHoudiniGeoPartObject > BakedLandscapeParts;
     bool bNeedToUpdateProperties = false;
     for ( TMap< FHoudiniGeoPartObject, TWeakObjectPtr<ALandscape> >::TIterator Iter(* LandscapeComponentsPtr ); Iter; ++Iter)
     {
@@ -1370,22 +1844,11 @@ FHoudiniEngineBakeUtils::BakeLandscape( UHoudiniAssetComponent* HoudiniAssetComp
             continue;
 
         // Simply remove the landscape from the map
-        FHoudiniGeoPartObject & HoudiniGeoPartObject = Iter.Key();
-        LandscapeComponentsPtr->Remove( HoudiniGeoPartObject );
+        BakedLandscapeParts.Add( Iter.Key() );
+        Iter.RemoveCurrent();
 
         CurrentLandscape->DetachFromActor( FDetachmentTransformRules::KeepWorldTransform );
 
-        // And save its layers to prevent them from being removed
-        for ( TMap< TWeakObjectPtr< UPackage >, FHoudiniGeoPartObject > ::TIterator IterPackage( HoudiniAssetComponent->CookedTemporaryLandscapeLayers ); IterPackage; ++IterPackage )
-        {
-            if ( !( HoudiniGeoPartObject == IterPackage.Value() ) )
-                continue;
-
-            UPackage * Package = IterPackage.Key().Get();
-            if ( Package && !Package->IsPendingKill() )
-                LayerPackages.Add( Package );
-        }
-
         bNeedToUpdateProperties = true;
 
         // If we only wanted to bake a single landscape, we're done
@@ -1393,6 +1856,18 @@ FHoudiniEngineBakeUtils::BakeLandscape( UHoudiniAssetComponent* HoudiniAssetComp
             break;
     }
 
+    // And save their layers to prevent them from being removed, tiles sharing a layer info save it once
+    TArray<UPackage *> LayerPackages;
+    for ( TMap< TWeakObjectPtr< UPackage >, FHoudiniGeoPartObject > ::TIterator IterPackage( HoudiniAssetComponent->CookedTemporaryLandscapeLayers ); IterPackage; ++IterPackage )
+    {
+        if ( !BakedLandscapeParts.Contains( IterPackage.Value() ) )
+            continue;
+
+        UPackage * Package = IterPackage.Key().Get();
+        if ( Package && !Package->IsPendingKill() )
+            LayerPackages.AddUnique( Package );
+    }
+
     if ( LayerPackages.Num() > 0 )
     {
         // Save the layer info's package
@@ -1657,6 +2132,9 @@ FHoudiniEngineBakeUtils::CheckPackageSafeForBake( UPackage* Package, FString& Fo
     return true;
 }
 
+/** Next bake counter to try, for each baked package base name. Lets name probing skip the names already taken. **/
+static TMap< FString, int32 > HoudiniEngineBakedPackageNameCounters;
+
 UPackage *
 FHoudiniEngineBakeUtils::BakeCreateStaticMeshPackageForComponent(
     FHoudiniCookParams& HoudiniCookParams,
@@ -1668,6 +2146,7 @@ FHoudiniEngineBakeUtils::BakeCreateStaticMeshPackageForComponent(
 #if WITH_EDITOR
     EBakeMode BakeMode = HoudiniCookParams.StaticMeshBakeMode;
     FString PackageName;
+    FString BasePackageName;
     int32 BakeCount = 0;
     const FGuid & ComponentGUID = HoudiniCookParams.PackageGUID;
     FString ComponentGUIDString = ComponentGUID.ToString().Left(
@@ -1771,7 +2250,7 @@ FHoudiniEngineBakeUtils::BakeCreateStaticMeshPackageForComponent(
                     FString::FromInt(HoudiniGeoPartObject.GeoId) + TEXT("_") +
                     FString::FromInt(HoudiniGeoPartObject.PartId) + TEXT("_") +
                     FString::FromInt(HoudiniGeoPartObject.SplitId) + TEXT("_") +
-                    HoudiniGeoPartObject.SplitName + TEXT("_") +
+                    HoudiniGeoPartObject.GetSplitName() + TEXT("_") +
                     BakeGUIDString;
 
                 PackageName = FPackageName::GetLongPackagePath( HoudiniCookParams.HoudiniAsset->GetOuter()->GetName() ) +
@@ -1799,6 +2278,8 @@ FHoudiniEngineBakeUtils::BakeCreateStaticMeshPackageForComponent(
 
         // Santize package name.
         PackageName = UPackageTools::SanitizePackageName( PackageName );
+        if ( BakeCount == 0 )
+            BasePackageName = PackageName;
 
         UObject * OuterPackage = nullptr;
 
@@ -1816,8 +2297,10 @@ FHoudiniEngineBakeUtils::BakeCreateStaticMeshPackageForComponent(
         {
             if ( BakeMode != EBakeMode::Intermediate )
             {
-                // Increment bake counter
+                // Increment bake counter, jumping past the names previous bakes already took
                 BakeCount++;
+                if ( const int32 * NextBakeCount = HoudiniEngineBakedPackageNameCounters.Find( BasePackageName ) )
+                    BakeCount = FMath::Max( BakeCount, *NextBakeCount );
             }
             else
             {
@@ -1829,6 +2312,8 @@ FHoudiniEngineBakeUtils::BakeCreateStaticMeshPackageForComponent(
         {
             // Create actual package.
             PackageNew = CreatePackage( OuterPackage, *PackageName );
+            if ( BakeMode != EBakeMode::Intermediate && BakeCount > 0 )
+                HoudiniEngineBakedPackageNameCounters.Add( BasePackageName, BakeCount + 1 );
             break;
         }
     }
@@ -61,10 +61,11 @@ public:
         TMap< const class UHoudiniInstancedActorComponent*, FHoudiniGeoPartObject >& ComponentToPart );
     static TArray< AActor* > BakeHoudiniActorToActors_SplitMeshInstancers(UHoudiniAssetComponent * HoudiniAssetComponent,
         TMap<const class UHoudiniMeshSplitInstancerComponent *, FHoudiniGeoPartObject> SplitMeshInstancerComponentToPart);
-    /** Helper for baking an SM only if necessary */
+    /** Helper for baking an SM only if necessary, OriginalToBakedMaterials lets meshes share their baked materials */
     static void CheckedBakeStaticMesh(
         class UHoudiniAssetComponent* HoudiniAssetComponent, TMap< const UStaticMesh*, UStaticMesh* >& OriginalToBakedMesh,
-        const FHoudiniGeoPartObject & HoudiniGeoPartObject, UStaticMesh* OriginalSM);
+        const FHoudiniGeoPartObject & HoudiniGeoPartObject, UStaticMesh* OriginalSM,
+        TMap< const UObject*, UObject* >* OriginalToBakedMaterials = nullptr );
     /** Duplicate a given material. This will create a new package for it. This will also create necessary textures **/
     /** and their corresponding packages. **/
     static class UMaterial * DuplicateMaterialAndCreatePackage(
@@ -82,14 +83,20 @@ public:
     static bool StaticMeshRequiresBake( const UStaticMesh * StaticMesh );
 
     /** Duplicate a given static mesh. This will create a new package for it. This will also create necessary       **/
-    /** materials and textures and their corresponding packages. **/
+    /** materials and textures and their corresponding packages, unless they are found in OriginalToBakedMaterials. **/
     static UStaticMesh * DuplicateStaticMeshAndCreatePackage(
         const UStaticMesh * StaticMesh, UHoudiniAssetComponent * Component,
-        const FHoudiniGeoPartObject & HoudiniGeoPartObject, EBakeMode BakeMode );
+        const FHoudiniGeoPartObject & HoudiniGeoPartObject, EBakeMode BakeMode,
+        TMap< const UObject*, UObject* >* OriginalToBakedMaterials = nullptr );
 
     /** Bake output meshes and materials to packages and create corresponding actors in the scene */
     static void BakeHoudiniActorToActors( UHoudiniAssetComponent * HoudiniAssetComponent, bool SelectNewActors );
 
+    /** Move baked actors into streaming levels, one per cell of a grid of the given size, the moved actors are selected. **/
+    /** Returns false if the actors were left in their level.                                                           **/
+    static bool MoveBakedActorsToStreamingCells(
+        UHoudiniAssetComponent * HoudiniAssetComponent, const TArray< AActor * > & BakedActors, float CellSize );
+
     /** Get a candidate for baking to outliner input workflow */
     static class UHoudiniAssetInput* GetInputForBakeHoudiniActorToOutlinerInput( const UHoudiniAssetComponent * HoudiniAssetComponent );
 
@@ -27,15 +27,24 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineBakeUtils.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniAsset.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniEngineTask.h"
+#include "HoudiniEngineTaskInfo.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "CoreMinimal.h"
 #include "Engine/StaticMesh.h"
 #include "HAL/PlatformFilemanager.h"
 #include "HAL/FileManagerGeneric.h"
+#include "Misc/FileHelper.h"
+#include "Misc/SecureHash.h"
 
 
 const FString LocalAutoBakeFolder = TEXT("/HoudiniEngine/AutoBake/");
 
+// Name of the manifest written in the output directory by the directory commandlet
+const FString ConversionManifestFileName = TEXT("HoudiniBgeoManifest.txt");
+
 UHoudiniEngineConvertBgeoCommandlet::UHoudiniEngineConvertBgeoCommandlet()
 {
     IsClient = false;
@@ -91,13 +100,18 @@ UHoudiniEngineConvertBgeoDirCommandlet::UHoudiniEngineConvertBgeoDirCommandlet()
 
 int32 UHoudiniEngineConvertBgeoDirCommandlet::Main(const FString& Params)
 {
-    // Run me via UE4editor.exe my.uproject -run=HoudiniEngineConvertBgeoDir BGEO_DIR_IN (UASSET_DIR_OUT)
+    // Run me via UE4editor.exe my.uproject -run=HoudiniEngineConvertBgeoDir BGEO_DIR_IN (UASSET_DIR_OUT) (-jobs=N)
     HOUDINI_LOG_MESSAGE(TEXT("Houdini Engine Convert BGEO directory"));
 
     // Parse the params to a string arrays
     TArray<FString> ArgumentsArray;
     Params.ParseIntoArray(ArgumentsArray, TEXT(" "), true);
 
+    // Extract the switches from the positional arguments
+    int32 NumJobs = 1;
+    FParse::Value( *Params, TEXT( "-jobs=" ), NumJobs );
+    ArgumentsArray.RemoveAll( []( const FString& Argument ) { return Argument.StartsWith( TEXT( "-" ) ); } );
+
     // We're expecting at least one param (the bgeo dir in) and a maximum of 3 params (bgeo dir in, uasset dir out, timeout)
     // The first param is the Commandlet name, so ignore that
     if ( (ArgumentsArray.Num() < 1 ) || ( ArgumentsArray.Num() > 3 ) )
@@ -117,6 +131,10 @@ int32 UHoudiniEngineConvertBgeoDirCommandlet::Main(const FString& Params)
         HOUDINI_LOG_MESSAGE(TEXT("TIMEOUT (optional)"));
         HOUDINI_LOG_MESSAGE(TEXT("\tAfter this amount of time of inactivity, the commandlet will exit."));
 
+        HOUDINI_LOG_MESSAGE(TEXT("-jobs=N (optional)"));
+        HOUDINI_LOG_MESSAGE(TEXT("\tNumber of Houdini Engine sessions of the pool converting files in parallel."));
+        HOUDINI_LOG_MESSAGE(TEXT("\tIf greater than 1, each session also loads its next file while the current one is being saved."));
+
         return 1;
     }
 
@@ -143,6 +161,38 @@ int32 UHoudiniEngineConvertBgeoDirCommandlet::Main(const FString& Params)
         return false;
     }
 
+    if ( !FHoudiniEngine::IsInitialized() )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Couldn't initialize HoudiniEngine!" ) );
+        return 1;
+    }
+
+    // Each job is a session of the pool loading a file, the loaded files are converted here as soon as their cook is done.
+    // With more than one job, a session also starts loading its next file while the current one is being saved.
+    FHoudiniEngine& HoudiniEngine = FHoudiniEngine::Get();
+    const bool bPipelineConversions = NumJobs > 1;
+    TArray< int32 > JobSessions;
+    for ( int32 SessionIndex = 0; SessionIndex < HoudiniEngine.GetSessionPoolSize() && JobSessions.Num() < NumJobs; SessionIndex++ )
+    {
+        if ( HoudiniEngine.GetPooledSession( SessionIndex ) )
+            JobSessions.Add( SessionIndex );
+    }
+
+    if ( JobSessions.Num() <= 0 )
+        JobSessions.Add( 0 );
+
+    if ( JobSessions.Num() < NumJobs )
+    {
+        HOUDINI_LOG_MESSAGE(
+            TEXT( "-jobs=%d: only %d Houdini Engine session(s) available, increase the cook session pool size for more." ),
+            NumJobs, JobSessions.Num() );
+    }
+
+    // The manifest lets us skip the files that were already converted with the same settings
+    const FString ManifestFilePath = UASSETDirPath + TEXT("/") + ConversionManifestFileName;
+    TMap< FString, FString > ManifestEntries;
+    FHoudiniCommandletUtils::LoadConversionManifest( ManifestFilePath, ManifestEntries );
+
     HOUDINI_LOG_MESSAGE( TEXT( "Looking for .bgeo files in %s ." ), *BGEODirPath );
 
     // Sleep time in seconds before listing the files again
@@ -176,11 +226,11 @@ int32 UHoudiniEngineConvertBgeoDirCommandlet::Main(const FString& Params)
         TArray< FString > CurrentFileList;
         FFileManagerGeneric::Get().FindFiles( CurrentFileList, *BGEODirPath, TEXT( ".bgeo" ) );
 
-        // Convert the files we found
-        int32 ConversionCount = 0;
+        // Gather the files we'll try to convert during this pass
+        TArray< FString > PendingFileList;
         for ( int32 n = CurrentFileList.Num() - 1; n >= 0; n-- )
         {
-            FString CurrentFile = CurrentFileList[ n ];
+            const FString& CurrentFile = CurrentFileList[ n ];
 
             // Skip undeleted files
             if ( UndeletedFileMap.Contains( CurrentFile ) )
@@ -190,9 +240,45 @@ int32 UHoudiniEngineConvertBgeoDirCommandlet::Main(const FString& Params)
             if ( FailingFileMap.Contains(CurrentFile) && FailingFileMap[ CurrentFile ] >= NumConvertAttempts )
                 continue;
 
-            // Build the in / out file names
-            FString BGEOFile = BGEODirPath + TEXT("/") + CurrentFileList[ n ];
-            FString UASSETFile = UASSETDirPath + TEXT("/") + CurrentFileList[ n ].LeftChop(5) + TEXT(".uasset");
+            // Skip files that haven't changed since their last conversion
+            const FString* ConvertedSignature = ManifestEntries.Find( CurrentFile );
+            if ( ConvertedSignature
+                && FPaths::FileExists( UASSETDirPath + TEXT("/") + CurrentFile.LeftChop(5) + TEXT(".uasset") )
+                && ConvertedSignature->Equals( FHoudiniCommandletUtils::ComputeSourceFileSignature( BGEODirPath + TEXT("/") + CurrentFile ) ) )
+            {
+                HOUDINI_LOG_MESSAGE( TEXT( "Skipping %s, unchanged since its last conversion." ), *CurrentFile );
+                UndeletedFileMap.Add( CurrentFile );
+                continue;
+            }
+
+            PendingFileList.Add( CurrentFile );
+        }
+
+        // File being converted by each job, and the node loading it in the job's session
+        struct FJobFile
+        {
+            int32 FileIdx = INDEX_NONE;
+            HAPI_NodeId NodeId = -1;
+            FString SourceSignature;
+        };
+
+        TArray< FJobFile > JobFiles;
+        JobFiles.SetNum( JobSessions.Num() );
+
+        // Starts loading the next pending file in the session of a job
+        int32 ConversionCount = 0;
+        int32 NextFileIdx = 0;
+        auto StartNextFile = [ & ]( int32 JobIdx )
+        {
+            FJobFile& JobFile = JobFiles[ JobIdx ];
+            JobFile = FJobFile();
+            if ( NextFileIdx >= PendingFileList.Num() )
+                return;
+
+            JobFile.FileIdx = NextFileIdx++;
+            const FString& CurrentFile = PendingFileList[ JobFile.FileIdx ];
+            FString BGEOFile = FPaths::ConvertRelativePathToFull( BGEODirPath + TEXT("/") + CurrentFile );
+            FString UASSETFile = UASSETDirPath + TEXT("/") + CurrentFile.LeftChop(5) + TEXT(".uasset");
 
             if ( CrushFiles )
             {
@@ -203,23 +289,99 @@ int32 UHoudiniEngineConvertBgeoDirCommandlet::Main(const FString& Params)
                 }
             }
 
+            // Compute the signature before converting, in case the source is deleted or modified meanwhile
+            JobFile.SourceSignature = FHoudiniCommandletUtils::ComputeSourceFileSignature( BGEOFile );
+
+            // If the load can't be started, the conversion will load the file itself and report the error
+            FHoudiniScopedSession ScopedSession( JobSessions[ JobIdx ] );
+            if ( !FHoudiniCommandletUtils::StartLoadBGEOFileInHAPI( BGEOFile, JobFile.NodeId ) )
+                JobFile.NodeId = -1;
+        };
+
+        // Converts the file loaded by a job, the job's session is free to load the next file during the save
+        auto ConvertJobFile = [ & ]( int32 JobIdx )
+        {
+            FJobFile JobFile = JobFiles[ JobIdx ];
+            JobFiles[ JobIdx ] = FJobFile();
+
+            const FString& CurrentFile = PendingFileList[ JobFile.FileIdx ];
+            FString BGEOFile = BGEODirPath + TEXT("/") + CurrentFile;
+            FString UASSETFile = UASSETDirPath + TEXT("/") + CurrentFile.LeftChop(5) + TEXT(".uasset");
+
+            TFunction< void() > OnHAPIDone;
+            if ( bPipelineConversions )
+                OnHAPIDone = [ &StartNextFile, JobIdx ]() { StartNextFile( JobIdx ); };
+
             // Attempting to convert the file
             ConversionCount++;
-            if ( !FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( BGEOFile, UASSETFile ) )
+            double ConversionStartTime = FPlatformTime::Seconds();
+            bool bConverted = false;
+            {
+                FHoudiniScopedSession ScopedSession( JobSessions[ JobIdx ] );
+                bConverted = FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( BGEOFile, UASSETFile, JobFile.NodeId, OnHAPIDone );
+            }
+
+            if ( !bConverted )
             {
                 if ( FailingFileMap.Contains( CurrentFile ) )
                     FailingFileMap[ CurrentFile ]++;
                 else
                     FailingFileMap.Add( CurrentFile, 1 );
 
-                continue;
+                return;
             }
 
-            HOUDINI_LOG_MESSAGE(TEXT("Successfully converted BGEO file: %s to %s"), *BGEOFile, *UASSETFile );
+            HOUDINI_LOG_MESSAGE(
+                TEXT("Successfully converted BGEO file: %s to %s in %.3f s"),
+                *BGEOFile, *UASSETFile, FPlatformTime::Seconds() - ConversionStartTime );
+
+            // Record the conversion right away so an interrupted run doesn't lose it
+            if ( !JobFile.SourceSignature.IsEmpty() )
+            {
+                ManifestEntries.Add( CurrentFile, JobFile.SourceSignature );
+                if ( !FHoudiniCommandletUtils::SaveConversionManifest( ManifestFilePath, ManifestEntries ) )
+                    HOUDINI_LOG_WARNING( TEXT( "Could not write the conversion manifest %s" ), *ManifestFilePath );
+            }
 
             // Delete the source BGEO
             if ( !DeleteFileAfterConversion || !FFileManagerGeneric::Get().Delete( *BGEOFile, false, true, true ) )
                 UndeletedFileMap.Add( CurrentFile );
+        };
+
+        // Convert the files we found, each job's session cooks its file in parallel with the others
+        bool bJobsRunning = PendingFileList.Num() > 0;
+        while ( bJobsRunning )
+        {
+            bJobsRunning = false;
+            bool bConvertedFile = false;
+            for ( int32 JobIdx = 0; JobIdx < JobFiles.Num(); JobIdx++ )
+            {
+                if ( JobFiles[ JobIdx ].FileIdx == INDEX_NONE )
+                    StartNextFile( JobIdx );
+
+                if ( JobFiles[ JobIdx ].FileIdx == INDEX_NONE )
+                    continue;
+
+                bJobsRunning = true;
+
+                // Wait for the file SOP to cook before converting
+                bool bLoaded = JobFiles[ JobIdx ].NodeId < 0;
+                if ( !bLoaded )
+                {
+                    FHoudiniScopedSession ScopedSession( JobSessions[ JobIdx ] );
+                    bLoaded = FHoudiniCommandletUtils::IsCookFinished();
+                }
+
+                if ( !bLoaded )
+                    continue;
+
+                ConvertJobFile( JobIdx );
+                bConvertedFile = true;
+            }
+
+            // Wait for the sessions if there was nothing to do
+            if ( bJobsRunning && !bConvertedFile )
+                FPlatformProcess::Sleep( 0.01f );
         }
 
         // Update the inactivity counter
@@ -248,8 +410,687 @@ int32 UHoudiniEngineConvertBgeoDirCommandlet::Main(const FString& Params)
     return 0;
 }
 
+UHoudiniEngineCookVariantsCommandlet::UHoudiniEngineCookVariantsCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UHoudiniEngineCookVariantsCommandlet::Main( const FString& Params )
+{
+    // Run me via UE4editor.exe my.uproject -run=HoudiniEngineCookVariants HOUDINI_ASSET VARIANTS UASSET_DIR_OUT
+    HOUDINI_LOG_MESSAGE( TEXT( "Houdini Engine Cook Variants Commandlet" ) );
+
+    // Parse the params to a string arrays
+    TArray<FString> ArgumentsArray;
+    Params.ParseIntoArray( ArgumentsArray, TEXT( " " ), true );
+    ArgumentsArray.RemoveAll( []( const FString& Argument ) { return Argument.StartsWith( TEXT( "-" ) ); } );
+
+    if ( ArgumentsArray.Num() != 3 )
+    {
+        // Invalid number of arguments, Print usage and error out
+        HOUDINI_LOG_MESSAGE( TEXT( "HoudiniEngineCookVariantsCommandlet" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "Cooks variants of a Houdini Digital Asset and bakes their Static Meshes to .uasset files." ) );
+
+        HOUDINI_LOG_MESSAGE( TEXT( "Usage: -run=HoudiniEngineCookVariants HOUDINI_ASSET VARIANTS UASSET_DIR_OUT" ) );
+
+        HOUDINI_LOG_MESSAGE( TEXT( "HOUDINI_ASSET" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tObject path of the Houdini Asset to cook, ie /Game/MyAsset.MyAsset" ) );
+
+        HOUDINI_LOG_MESSAGE( TEXT( "VARIANTS" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tEither a directory containing binary .preset files, or a .csv file." ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tThe csv header lists the parameter names after a first name column, each row is a variant." ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tValues of tuple parameters are separated by ';'." ) );
+
+        HOUDINI_LOG_MESSAGE( TEXT( "UASSET_DIR_OUT" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tPath for the baked uasset files." ) );
+
+        return 1;
+    }
+
+    const FString& HoudiniAssetPath = ArgumentsArray[ 0 ];
+    const FString& VariantsPath = ArgumentsArray[ 1 ];
+    const FString& UASSETDirPath = ArgumentsArray[ 2 ];
+
+    if ( !FPaths::DirectoryExists( UASSETDirPath ) )
+    {
+        // Cant find Output dir
+        HOUDINI_LOG_ERROR( TEXT( "The output UASSET directory does not exist: %s" ), *UASSETDirPath );
+        return 1;
+    }
+
+    if ( !FHoudiniEngine::IsInitialized() )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Couldn't initialize HoudiniEngine!" ) );
+        return 1;
+    }
+
+    //---------------------------------------------------------------------------------------------
+    // 1. Gather the variants
+    //---------------------------------------------------------------------------------------------
+
+    TArray< FString > VariantNames;
+    TArray< TArray< char > > VariantPresets;
+    TArray< FString > CSVParameterNames;
+    TArray< TArray< FString > > CSVVariantValues;
+
+    const bool bUseCSV = FPaths::GetExtension( VariantsPath ).Equals( TEXT( "csv" ), ESearchCase::IgnoreCase );
+    if ( bUseCSV )
+    {
+        TArray< FString > Lines;
+        if ( !FFileHelper::LoadFileToStringArray( Lines, *VariantsPath ) || Lines.Num() < 2 )
+        {
+            HOUDINI_LOG_ERROR( TEXT( "Could not read any variant from %s" ), *VariantsPath );
+            return 1;
+        }
+
+        Lines[ 0 ].ParseIntoArray( CSVParameterNames, TEXT( "," ), false );
+        for ( FString& ParmName : CSVParameterNames )
+            ParmName.TrimStartAndEndInline();
+
+        for ( int32 n = 1; n < Lines.Num(); n++ )
+        {
+            TArray< FString > Cells;
+            Lines[ n ].ParseIntoArray( Cells, TEXT( "," ), false );
+            if ( Cells.Num() <= 0 || Cells[ 0 ].TrimStartAndEnd().IsEmpty() )
+                continue;
+
+            for ( FString& Cell : Cells )
+                Cell.TrimStartAndEndInline();
+
+            VariantNames.Add( Cells[ 0 ] );
+            CSVVariantValues.Add( Cells );
+        }
+    }
+    else
+    {
+        TArray< FString > PresetFiles;
+        FFileManagerGeneric::Get().FindFiles( PresetFiles, *VariantsPath, TEXT( ".preset" ) );
+        for ( const FString& PresetFile : PresetFiles )
+        {
+            TArray< uint8 > FileData;
+            if ( !FFileHelper::LoadFileToArray( FileData, *( VariantsPath + TEXT( "/" ) + PresetFile ) ) || FileData.Num() <= 0 )
+            {
+                HOUDINI_LOG_WARNING( TEXT( "Could not read preset file %s" ), *PresetFile );
+                continue;
+            }
+
+            TArray< char > PresetBuffer;
+            PresetBuffer.SetNumUninitialized( FileData.Num() );
+            FMemory::Memcpy( PresetBuffer.GetData(), FileData.GetData(), FileData.Num() );
+
+            VariantNames.Add( FPaths::GetBaseFilename( PresetFile ) );
+            VariantPresets.Add( PresetBuffer );
+        }
+    }
+
+    if ( VariantNames.Num() <= 0 )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "No variant found in %s" ), *VariantsPath );
+        return 1;
+    }
+
+    //---------------------------------------------------------------------------------------------
+    // 2. Instantiate the asset
+    //---------------------------------------------------------------------------------------------
+
+    UHoudiniAsset* HoudiniAsset = LoadObject< UHoudiniAsset >( nullptr, *HoudiniAssetPath );
+    if ( !HoudiniAsset )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Could not load the Houdini Asset %s" ), *HoudiniAssetPath );
+        return 1;
+    }
+
+    // Each session of the pool gets its own instance of the asset, and cooks one variant at a time
+    FHoudiniEngine& HoudiniEngine = FHoudiniEngine::Get();
+    TArray< int32 > VariantSessions;
+    for ( int32 SessionIndex = 0; SessionIndex < HoudiniEngine.GetSessionPoolSize() && VariantSessions.Num() < VariantNames.Num(); SessionIndex++ )
+    {
+        if ( HoudiniEngine.GetPooledSession( SessionIndex ) )
+            VariantSessions.Add( SessionIndex );
+    }
+
+    // Start all the instantiations before waiting for them, so they cook in parallel
+    TArray< HAPI_NodeId > SessionAssetIds;
+    for ( int32 SessionIndex : VariantSessions )
+    {
+        FHoudiniScopedSession ScopedSession( SessionIndex );
+        HAPI_AssetLibraryId AssetLibraryId = -1;
+        TArray< HAPI_StringHandle > AssetNames;
+        std::string AssetNameString;
+        HAPI_NodeId AssetId = -1;
+        if ( !FHoudiniEngineUtils::GetAssetNames( HoudiniAsset, AssetLibraryId, AssetNames )
+            || AssetNames.Num() <= 0
+            || !FHoudiniEngineString( AssetNames[ 0 ] ).ToStdString( AssetNameString )
+            || HAPI_RESULT_SUCCESS != FHoudiniApi::CreateNode(
+                HoudiniEngine.GetSession(), -1, AssetNameString.c_str(), nullptr, true, &AssetId ) )
+        {
+            HOUDINI_LOG_WARNING( TEXT( "Could not instantiate %s in session %d" ), *HoudiniAssetPath, SessionIndex );
+            AssetId = -1;
+        }
+
+        SessionAssetIds.Add( AssetId );
+    }
+
+    for ( int32 Idx = VariantSessions.Num() - 1; Idx >= 0; Idx-- )
+    {
+        FHoudiniScopedSession ScopedSession( VariantSessions[ Idx ] );
+        if ( SessionAssetIds[ Idx ] >= 0 && FHoudiniCommandletUtils::WaitForNodeCook( SessionAssetIds[ Idx ] ) )
+            continue;
+
+        if ( SessionAssetIds[ Idx ] >= 0 )
+            FHoudiniApi::DeleteNode( HoudiniEngine.GetSession(), SessionAssetIds[ Idx ] );
+
+        VariantSessions.RemoveAt( Idx );
+        SessionAssetIds.RemoveAt( Idx );
+    }
+
+    if ( VariantSessions.Num() <= 0 )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Could not instantiate %s" ), *HoudiniAssetPath );
+        return 1;
+    }
+
+    // Keep the default parameters so every variant starts from them
+    TArray< char > DefaultPreset;
+    {
+        FHoudiniScopedSession ScopedSession( VariantSessions[ 0 ] );
+        FHoudiniEngineUtils::GetAssetPreset( SessionAssetIds[ 0 ], DefaultPreset );
+    }
+
+    HOUDINI_LOG_MESSAGE( TEXT( "Cooking %d variants on %d Houdini Engine session(s)." ), VariantNames.Num(), VariantSessions.Num() );
+
+    //---------------------------------------------------------------------------------------------
+    // 3. Cook and bake each variant
+    //---------------------------------------------------------------------------------------------
+
+    // Applies the parameters of the next variant to the asset of a session and starts its cook
+    int32 NumFailedVariants = 0;
+    int32 NextVariantIdx = 0;
+    TArray< int32 > SessionVariants;
+    TArray< double > SessionVariantStartTimes;
+    SessionVariants.Init( INDEX_NONE, VariantSessions.Num() );
+    SessionVariantStartTimes.Init( 0.0, VariantSessions.Num() );
+    auto StartNextVariant = [ & ]( int32 Idx )
+    {
+        while ( NextVariantIdx < VariantNames.Num() )
+        {
+            const int32 VariantIdx = NextVariantIdx++;
+            const FString& VariantName = VariantNames[ VariantIdx ];
+            const HAPI_NodeId AssetId = SessionAssetIds[ Idx ];
+            FHoudiniScopedSession ScopedSession( VariantSessions[ Idx ] );
+
+            if ( DefaultPreset.Num() > 0 )
+                FHoudiniEngineUtils::SetAssetPreset( AssetId, DefaultPreset );
+
+            bool bVariantApplied = true;
+            if ( bUseCSV )
+            {
+                const TArray< FString >& Values = CSVVariantValues[ VariantIdx ];
+                for ( int32 ParmIdx = 1; ParmIdx < CSVParameterNames.Num() && ParmIdx < Values.Num(); ParmIdx++ )
+                {
+                    if ( Values[ ParmIdx ].IsEmpty() )
+                        continue;
+
+                    bVariantApplied &= FHoudiniCommandletUtils::SetParameterFromString(
+                        AssetId, CSVParameterNames[ ParmIdx ], Values[ ParmIdx ] );
+                }
+            }
+            else
+            {
+                bVariantApplied = FHoudiniEngineUtils::SetAssetPreset( AssetId, VariantPresets[ VariantIdx ] );
+            }
+
+            if ( !bVariantApplied )
+            {
+                HOUDINI_LOG_ERROR( TEXT( "Could not apply the parameters of variant %s" ), *VariantName );
+                NumFailedVariants++;
+                continue;
+            }
+
+            // Start the cook, its end is polled without blocking the other sessions
+            SessionVariantStartTimes[ Idx ] = FPlatformTime::Seconds();
+            if ( HAPI_RESULT_SUCCESS != FHoudiniApi::CookNode( HoudiniEngine.GetSession(), AssetId, nullptr ) )
+            {
+                HOUDINI_LOG_ERROR( TEXT( "Could not cook variant %s" ), *VariantName );
+                NumFailedVariants++;
+                continue;
+            }
+
+            SessionVariants[ Idx ] = VariantIdx;
+            return;
+        }
+    };
+
+    bool bVariantsRunning = true;
+    while ( bVariantsRunning )
+    {
+        bVariantsRunning = false;
+        bool bBakedVariant = false;
+        for ( int32 Idx = 0; Idx < VariantSessions.Num(); Idx++ )
+        {
+            if ( SessionVariants[ Idx ] == INDEX_NONE )
+                StartNextVariant( Idx );
+
+            const int32 VariantIdx = SessionVariants[ Idx ];
+            if ( VariantIdx == INDEX_NONE )
+                continue;
+
+            bVariantsRunning = true;
+
+            FHoudiniScopedSession ScopedSession( VariantSessions[ Idx ] );
+            if ( !FHoudiniCommandletUtils::IsCookFinished() )
+                continue;
+
+            SessionVariants[ Idx ] = INDEX_NONE;
+            bBakedVariant = true;
+
+            const FString& VariantName = VariantNames[ VariantIdx ];
+            FString UASSETFile = FPaths::ConvertRelativePathToFull(
+                UASSETDirPath + TEXT( "/" ) + HoudiniAsset->GetName() + TEXT( "_" ) + VariantName + TEXT( ".uasset" ) );
+
+            if ( !FHoudiniCommandletUtils::WaitForNodeCook( SessionAssetIds[ Idx ] )
+                || !FHoudiniCommandletUtils::BakeCookedAssetToUAsset( SessionAssetIds[ Idx ], VariantName, UASSETFile ) )
+            {
+                HOUDINI_LOG_ERROR( TEXT( "Could not cook and bake variant %s" ), *VariantName );
+                NumFailedVariants++;
+                continue;
+            }
+
+            HOUDINI_LOG_MESSAGE(
+                TEXT( "Successfully baked variant %s to %s in %.3f s" ),
+                *VariantName, *UASSETFile, FPlatformTime::Seconds() - SessionVariantStartTimes[ Idx ] );
+        }
+
+        // Wait for the sessions if there was nothing to do
+        if ( bVariantsRunning && !bBakedVariant )
+            FPlatformProcess::Sleep( 0.01f );
+    }
+
+    for ( int32 Idx = 0; Idx < VariantSessions.Num(); Idx++ )
+    {
+        FHoudiniScopedSession ScopedSession( VariantSessions[ Idx ] );
+        FHoudiniApi::DeleteNode( HoudiniEngine.GetSession(), SessionAssetIds[ Idx ] );
+    }
+
+    // Nuke everything in our temporary bake folder
+    FFileManagerGeneric::Get().DeleteDirectory( *LocalAutoBakeFolder, false, true );
+
+    HOUDINI_LOG_MESSAGE( TEXT( "Baked %d out of %d variants." ), VariantNames.Num() - NumFailedVariants, VariantNames.Num() );
+
+    return NumFailedVariants > 0 ? 1 : 0;
+}
+
+UHoudiniEngineCookFarmCommandlet::UHoudiniEngineCookFarmCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+/** A job of the cook farm commandlet, and the time it spent in each stage. **/
+struct FHoudiniCookFarmJob
+{
+    /** Name of the job, used for the baked uasset. **/
+    FString Name;
+
+    /** Object path of the Houdini Asset to cook. **/
+    FString HoudiniAssetPath;
+
+    /** Optional preset applied before cooking. **/
+    TArray< char > Preset;
+
+    /** Session the job is cooked in, and its current scheduler task. **/
+    int32 SessionIndex = -1;
+    FGuid HapiGUID;
+    HAPI_NodeId AssetId = -1;
+
+    /** Time at which the current stage started. **/
+    double StageStartTime = 0.0;
+
+    /** Per stage times, in seconds. **/
+    double InstantiateTime = 0.0;
+    double CookTime = 0.0;
+    double MeshTime = 0.0;
+    double SaveTime = 0.0;
+};
+
+int32 UHoudiniEngineCookFarmCommandlet::Main( const FString& Params )
+{
+    // Run me via UE4editor.exe my.uproject -run=HoudiniEngineCookFarm JOB_LIST UASSET_DIR_OUT
+    HOUDINI_LOG_MESSAGE( TEXT( "Houdini Engine Cook Farm Commandlet" ) );
+
+    // Parse the params to a string arrays
+    TArray<FString> ArgumentsArray;
+    Params.ParseIntoArray( ArgumentsArray, TEXT( " " ), true );
+    ArgumentsArray.RemoveAll( []( const FString& Argument ) { return Argument.StartsWith( TEXT( "-" ) ); } );
+
+    if ( ArgumentsArray.Num() != 2 )
+    {
+        // Invalid number of arguments, Print usage and error out
+        HOUDINI_LOG_MESSAGE( TEXT( "HoudiniEngineCookFarmCommandlet" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "Cooks a list of jobs through the Houdini Engine scheduler and bakes their Static Meshes to .uasset files." ) );
+
+        HOUDINI_LOG_MESSAGE( TEXT( "Usage: -run=HoudiniEngineCookFarm JOB_LIST UASSET_DIR_OUT" ) );
+
+        HOUDINI_LOG_MESSAGE( TEXT( "JOB_LIST" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tText file with one job per line: NAME,HOUDINI_ASSET(,PRESET_FILE)." ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tHOUDINI_ASSET is an object path, ie /Game/MyAsset.MyAsset, PRESET_FILE a binary .preset file." ) );
+
+        HOUDINI_LOG_MESSAGE( TEXT( "UASSET_DIR_OUT" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tPath for the baked uasset files." ) );
+
+        return 1;
+    }
+
+    const FString& JobListPath = ArgumentsArray[ 0 ];
+    const FString& UASSETDirPath = ArgumentsArray[ 1 ];
+
+    if ( !FPaths::DirectoryExists( UASSETDirPath ) )
+    {
+        // Cant find Output dir
+        HOUDINI_LOG_ERROR( TEXT( "The output UASSET directory does not exist: %s" ), *UASSETDirPath );
+        return 1;
+    }
+
+    if ( !FHoudiniEngine::IsInitialized() )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Couldn't initialize HoudiniEngine!" ) );
+        return 1;
+    }
+
+    //---------------------------------------------------------------------------------------------
+    // 1. Read the job list
+    //---------------------------------------------------------------------------------------------
+
+    TArray< FString > Lines;
+    if ( !FFileHelper::LoadFileToStringArray( Lines, *JobListPath ) )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Could not read the job list %s" ), *JobListPath );
+        return 1;
+    }
+
+    TArray< FHoudiniCookFarmJob > Jobs;
+    int32 NumFailedJobs = 0;
+    for ( const FString& Line : Lines )
+    {
+        TArray< FString > Cells;
+        Line.ParseIntoArray( Cells, TEXT( "," ), false );
+        for ( FString& Cell : Cells )
+            Cell.TrimStartAndEndInline();
+
+        // Skip empty lines and comments
+        if ( Cells.Num() <= 0 || Cells[ 0 ].IsEmpty() || Cells[ 0 ].StartsWith( TEXT( "#" ) ) )
+            continue;
+
+        if ( Cells.Num() < 2 || Cells[ 1 ].IsEmpty() )
+        {
+            HOUDINI_LOG_ERROR( TEXT( "Job %s has no Houdini Asset." ), *Cells[ 0 ] );
+            NumFailedJobs++;
+            continue;
+        }
+
+        FHoudiniCookFarmJob Job;
+        Job.Name = Cells[ 0 ];
+        Job.HoudiniAssetPath = Cells[ 1 ];
+
+        if ( Cells.Num() > 2 && !Cells[ 2 ].IsEmpty() )
+        {
+            TArray< uint8 > FileData;
+            if ( !FFileHelper::LoadFileToArray( FileData, *Cells[ 2 ] ) || FileData.Num() <= 0 )
+            {
+                HOUDINI_LOG_ERROR( TEXT( "Could not read preset file %s of job %s" ), *Cells[ 2 ], *Job.Name );
+                NumFailedJobs++;
+                continue;
+            }
+
+            Job.Preset.SetNumUninitialized( FileData.Num() );
+            FMemory::Memcpy( Job.Preset.GetData(), FileData.GetData(), FileData.Num() );
+        }
+
+        Jobs.Add( MoveTemp( Job ) );
+    }
+
+    const int32 NumJobs = Jobs.Num() + NumFailedJobs;
+    if ( Jobs.Num() <= 0 )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "No job found in %s" ), *JobListPath );
+        return 1;
+    }
+
+    //---------------------------------------------------------------------------------------------
+    // 2. Run the jobs
+    //---------------------------------------------------------------------------------------------
+
+    // Each session of the pool cooks one job at a time on its scheduler thread. As soon as a job's
+    // cook is done, its meshes are built and its package saved here while the session cooks the next job.
+    FHoudiniEngine& HoudiniEngine = FHoudiniEngine::Get();
+    TArray< int32 > SessionJobs;
+    for ( int32 SessionIndex = 0; SessionIndex < HoudiniEngine.GetSessionPoolSize(); SessionIndex++ )
+        SessionJobs.Add( HoudiniEngine.GetPooledSession( SessionIndex ) ? INDEX_NONE : -2 );
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Running %d jobs on %d Houdini Engine session(s)." ),
+        Jobs.Num(), SessionJobs.FilterByPredicate( []( int32 JobIdx ) { return JobIdx == INDEX_NONE; } ).Num() );
+
+    // Fails the job running in a session and frees the session
+    auto FailSessionJob = [ & ]( int32 SessionIndex, const FString& Reason )
+    {
+        FHoudiniCookFarmJob& Job = Jobs[ SessionJobs[ SessionIndex ] ];
+        HOUDINI_LOG_ERROR( TEXT( "Job %s failed: %s" ), *Job.Name, *Reason );
+
+        HoudiniEngine.RemoveTaskInfo( Job.HapiGUID );
+        if ( Job.AssetId >= 0 )
+        {
+            FHoudiniScopedSession ScopedSession( SessionIndex );
+            FHoudiniApi::DeleteNode( HoudiniEngine.GetSession(), Job.AssetId );
+            Job.AssetId = -1;
+        }
+
+        SessionJobs[ SessionIndex ] = INDEX_NONE;
+        NumFailedJobs++;
+    };
+
+    // Gives the next job to an idle session, by queueing its instantiation on the session's scheduler
+    int32 NextJobIdx = 0;
+    auto StartNextJob = [ & ]( int32 SessionIndex )
+    {
+        const int32 JobIdx = NextJobIdx++;
+        FHoudiniCookFarmJob& Job = Jobs[ JobIdx ];
+        SessionJobs[ SessionIndex ] = JobIdx;
+        Job.SessionIndex = SessionIndex;
+        Job.StageStartTime = FPlatformTime::Seconds();
+
+        // Asset libraries are loaded in each session
+        FHoudiniScopedSession ScopedSession( SessionIndex );
+        UHoudiniAsset* HoudiniAsset = LoadObject< UHoudiniAsset >( nullptr, *Job.HoudiniAssetPath );
+        HAPI_AssetLibraryId AssetLibraryId = -1;
+        TArray< HAPI_StringHandle > AssetNames;
+        if ( !HoudiniAsset
+            || !FHoudiniEngineUtils::GetAssetNames( HoudiniAsset, AssetLibraryId, AssetNames )
+            || AssetNames.Num() <= 0 )
+        {
+            FailSessionJob( SessionIndex, FString::Printf( TEXT( "could not load the Houdini Asset %s" ), *Job.HoudiniAssetPath ) );
+            return;
+        }
+
+        Job.HapiGUID = FGuid::NewGuid();
+        FHoudiniEngineTask Task( EHoudiniEngineTaskType::AssetInstantiation, Job.HapiGUID );
+        Task.Asset = HoudiniAsset;
+        Task.ActorName = Job.Name;
+        Task.AssetLibraryId = AssetLibraryId;
+        Task.AssetHapiName = AssetNames[ 0 ];
+        Task.SessionIndex = SessionIndex;
+        HoudiniEngine.AddTask( Task );
+    };
+
+    const double FarmStartTime = FPlatformTime::Seconds();
+    double TotalInstantiateTime = 0.0, TotalCookTime = 0.0, TotalMeshTime = 0.0, TotalSaveTime = 0.0;
+    int32 NumFinishedJobs = 0;
+    while ( NumFinishedJobs + NumFailedJobs < NumJobs )
+    {
+        // Give the next jobs to the idle sessions
+        for ( int32 SessionIndex = 0; SessionIndex < SessionJobs.Num() && NextJobIdx < Jobs.Num(); SessionIndex++ )
+        {
+            if ( SessionJobs[ SessionIndex ] == INDEX_NONE )
+                StartNextJob( SessionIndex );
+        }
+
+        // Process the jobs whose scheduler task is done
+        bool bProcessedJob = false;
+        for ( int32 SessionIndex = 0; SessionIndex < SessionJobs.Num(); SessionIndex++ )
+        {
+            if ( SessionJobs[ SessionIndex ] < 0 )
+                continue;
+
+            FHoudiniCookFarmJob& Job = Jobs[ SessionJobs[ SessionIndex ] ];
+            FHoudiniEngineTaskInfo TaskInfo;
+            if ( !HoudiniEngine.RetrieveTaskInfo( Job.HapiGUID, TaskInfo ) )
+                continue;
+
+            switch ( TaskInfo.TaskState )
+            {
+                case EHoudiniEngineTaskState::FinishedInstantiation:
+                {
+                    Job.InstantiateTime = FPlatformTime::Seconds() - Job.StageStartTime;
+                    Job.AssetId = TaskInfo.AssetId;
+                    HoudiniEngine.RemoveTaskInfo( Job.HapiGUID );
+
+                    FHoudiniScopedSession ScopedSession( SessionIndex );
+                    if ( Job.Preset.Num() > 0 && !FHoudiniEngineUtils::SetAssetPreset( Job.AssetId, Job.Preset ) )
+                    {
+                        FailSessionJob( SessionIndex, TEXT( "could not apply its preset" ) );
+                        break;
+                    }
+
+                    // Cook with the job's parameters
+                    Job.StageStartTime = FPlatformTime::Seconds();
+                    Job.HapiGUID = FGuid::NewGuid();
+                    FHoudiniEngineTask Task( EHoudiniEngineTaskType::AssetCooking, Job.HapiGUID );
+                    Task.ActorName = Job.Name;
+                    Task.AssetId = Job.AssetId;
+                    Task.SessionIndex = SessionIndex;
+                    HoudiniEngine.AddTask( Task );
+                    break;
+                }
+
+                case EHoudiniEngineTaskState::FinishedCooking:
+                {
+                    Job.CookTime = FPlatformTime::Seconds() - Job.StageStartTime;
+                    HoudiniEngine.RemoveTaskInfo( Job.HapiGUID );
+                    bProcessedJob = true;
+
+                    // Fetch the results and build the meshes
+                    double MeshStartTime = FPlatformTime::Seconds();
+                    FString UASSETFile = FPaths::ConvertRelativePathToFull( UASSETDirPath + TEXT( "/" ) + Job.Name + TEXT( ".uasset" ) );
+                    FString PackageFilePath;
+                    UPackage* Package = FHoudiniCommandletUtils::CreateLocalPackage( Job.Name, PackageFilePath );
+
+                    bool bMeshesBaked = false;
+                    {
+                        FHoudiniScopedSession ScopedSession( SessionIndex );
+                        HAPI_NodeId NodeId = Job.AssetId;
+                        TMap< FHoudiniGeoPartObject, UStaticMesh * > StaticMeshesOut;
+                        bMeshesBaked = Package
+                            && FHoudiniCommandletUtils::CreateStaticMeshes( Job.Name, NodeId, Package, StaticMeshesOut )
+                            && FHoudiniCommandletUtils::BakeStaticMeshesToPackage( Job.Name, StaticMeshesOut, Package );
+                    }
+
+                    if ( !bMeshesBaked )
+                    {
+                        FailSessionJob( SessionIndex, TEXT( "could not bake its Static Meshes" ) );
+                        break;
+                    }
+
+                    Job.MeshTime = FPlatformTime::Seconds() - MeshStartTime;
+
+                    // The session doesn't need to wait for the save, let it delete the node and start the next job
+                    FHoudiniEngineTask DeleteTask( EHoudiniEngineTaskType::AssetDeletion, FGuid::NewGuid() );
+                    DeleteTask.ActorName = Job.Name;
+                    DeleteTask.AssetId = Job.AssetId;
+                    DeleteTask.SessionIndex = SessionIndex;
+                    DeleteTask.Priority = EHoudiniEngineTaskPriority::Background;
+                    HoudiniEngine.AddTask( DeleteTask );
+                    HoudiniEngine.RemoveTaskInfo( DeleteTask.HapiGUID );
+                    Job.AssetId = -1;
+                    SessionJobs[ SessionIndex ] = INDEX_NONE;
+                    if ( NextJobIdx < Jobs.Num() )
+                        StartNextJob( SessionIndex );
+
+                    // Save the package
+                    double SaveStartTime = FPlatformTime::Seconds();
+                    if ( !FHoudiniCommandletUtils::SaveLocalPackage( Package, PackageFilePath, UASSETFile ) )
+                    {
+                        HOUDINI_LOG_ERROR( TEXT( "Job %s failed: could not save %s" ), *Job.Name, *UASSETFile );
+                        NumFailedJobs++;
+                        break;
+                    }
+
+                    Job.SaveTime = FPlatformTime::Seconds() - SaveStartTime;
+
+                    TotalInstantiateTime += Job.InstantiateTime;
+                    TotalCookTime += Job.CookTime;
+                    TotalMeshTime += Job.MeshTime;
+                    TotalSaveTime += Job.SaveTime;
+                    NumFinishedJobs++;
+
+                    HOUDINI_LOG_MESSAGE(
+                        TEXT( "Baked job %s to %s: instantiate %.3f s, cook %.3f s, meshes %.3f s, save %.3f s." ),
+                        *Job.Name, *UASSETFile, Job.InstantiateTime, Job.CookTime, Job.MeshTime, Job.SaveTime );
+                    break;
+                }
+
+                case EHoudiniEngineTaskState::FinishedInstantiationWithErrors:
+                case EHoudiniEngineTaskState::FinishedCookingWithErrors:
+                case EHoudiniEngineTaskState::Aborted:
+                case EHoudiniEngineTaskState::Interrupted:
+                {
+                    if ( Job.AssetId < 0 )
+                        Job.AssetId = TaskInfo.AssetId;
+
+                    FailSessionJob( SessionIndex, TaskInfo.StatusText.ToString() );
+                    break;
+                }
+
+                default:
+                    break;
+            }
+        }
+
+        // Wait for the sessions if there was nothing to do
+        if ( !bProcessedJob )
+            FPlatformProcess::Sleep( 0.01f );
+    }
+
+    //---------------------------------------------------------------------------------------------
+    // 3. Report the throughput
+    //---------------------------------------------------------------------------------------------
+
+    // Nuke everything in our temporary bake folder
+    FFileManagerGeneric::Get().DeleteDirectory( *LocalAutoBakeFolder, false, true );
+
+    const double FarmTime = FPlatformTime::Seconds() - FarmStartTime;
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Baked %d out of %d jobs in %.3f s, %.2f jobs/minute." ),
+        NumFinishedJobs, NumJobs, FarmTime, FarmTime > 0.0 ? NumFinishedJobs * 60.0 / FarmTime : 0.0 );
+
+    if ( NumFinishedJobs > 0 )
+    {
+        HOUDINI_LOG_MESSAGE(
+            TEXT( "Average job stages: instantiate %.3f s, cook %.3f s, meshes %.3f s, save %.3f s." ),
+            TotalInstantiateTime / NumFinishedJobs, TotalCookTime / NumFinishedJobs,
+            TotalMeshTime / NumFinishedJobs, TotalSaveTime / NumFinishedJobs );
+    }
 
-bool FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( const FString& InBGEOFilePath, const FString& OutUAssetFilePath )
+    return NumFailedJobs > 0 ? 1 : 0;
+}
+
+bool FHoudiniCommandletUtils::ConvertBGEOFileToUAsset(
+    const FString& InBGEOFilePath, const FString& OutUAssetFilePath,
+    HAPI_NodeId PreloadedNodeId, TFunction< void() > OnHAPIDone )
 {
 #if WITH_EDITOR
     //---------------------------------------------------------------------------------------------
@@ -325,46 +1166,35 @@ bool FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( const FString& InBGEOFile
     // 3. Load the bgeo file in HAPI
     //---------------------------------------------------------------------------------------------
 
-    HAPI_NodeId NodeId = -1;
-    if ( !FHoudiniCommandletUtils::LoadBGEOFileInHAPI( BGEOFilePath, NodeId) )
+    double LoadStartTime = FPlatformTime::Seconds();
+    HAPI_NodeId NodeId = PreloadedNodeId;
+    if ( NodeId >= 0 )
+    {
+        // The file SOP was created in advance, just wait for its cook
+        if ( !FHoudiniCommandletUtils::WaitForNodeCook( NodeId ) )
+            return SaveDebugHipFileAndReturnError();
+    }
+    else if ( !FHoudiniCommandletUtils::LoadBGEOFileInHAPI( BGEOFilePath, NodeId) )
+    {
         return SaveDebugHipFileAndReturnError();
+    }
+
+    double LoadTime = FPlatformTime::Seconds() - LoadStartTime;
 
     //---------------------------------------------------------------------------------------------
     // 4. Create a package for the result
     //---------------------------------------------------------------------------------------------
 
-    FString PackagePath = LocalAutoBakeFolder + UASSETFileName;
-    FString PackageFilePath = UPackageTools::SanitizePackageName( PackagePath );
-    UPackage * Package = FindPackage( nullptr, *PackageFilePath );
-    if ( !Package )    
-    {
-        // Create actual package.
-        Package = CreatePackage( nullptr, *PackageFilePath );
-        if ( !Package )
-        {
-            // Couldn't create the package
-            HOUDINI_LOG_ERROR( TEXT( "Could not create local Package for the UASSET !!!" ) );
-            return false;
-        }
-    }
-    else
-    {
-        // Package already exists, overwrite?
-        HOUDINI_LOG_MESSAGE( TEXT( "Package %s already exists, overwriting!" ), *PackageFilePath );
-    }
-
-    // ERROR Lambda
-    // Tries to delete the local package and creates an error ( in case of UE4/Package error)
-    auto DeleteLocalPackageAndReturnError = [&]()
-    {
-        FFileManagerGeneric::Get().Delete( *PackageFilePath, false, true, true );
-        return SaveDebugHipFileAndReturnError();
-    };
+    FString PackageFilePath;
+    UPackage * Package = FHoudiniCommandletUtils::CreateLocalPackage( UASSETFileName, PackageFilePath );
+    if ( !Package )
+        return false;
 
     //---------------------------------------------------------------------------------------------
     // 5. Create the Static Meshes from  the result of the bgeo cooking
     //---------------------------------------------------------------------------------------------
 
+    double MeshStartTime = FPlatformTime::Seconds();
     TMap< FHoudiniGeoPartObject, UStaticMesh * > StaticMeshesOut;
     if ( !FHoudiniCommandletUtils::CreateStaticMeshes(
         BGEOFileName, NodeId, Package, StaticMeshesOut ) )
@@ -391,10 +1221,189 @@ bool FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( const FString& InBGEOFile
         HOUDINI_LOG_WARNING( TEXT( "Could not delete the bgeo file sop for %s"), * BGEOFileName );
     }
 
+    double MeshTime = FPlatformTime::Seconds() - MeshStartTime;
+
+    // The Houdini session is free, let the caller use it while we save
+    if ( OnHAPIDone )
+        OnHAPIDone();
+
     //---------------------------------------------------------------------------------------------
-    // 8. Save the package
+    // 8. Save the package and move it to its final destination
     //---------------------------------------------------------------------------------------------
 
+    double SaveStartTime = FPlatformTime::Seconds();
+    if ( !FHoudiniCommandletUtils::SaveLocalPackage( Package, PackageFilePath, UASSETFilePath ) )
+        return SaveDebugHipFileAndReturnError();
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Converted %s: load %.3f s, meshes %.3f s, save %.3f s." ),
+        *BGEOFileName, LoadTime, MeshTime, FPlatformTime::Seconds() - SaveStartTime );
+#endif
+    return true;
+}
+
+bool FHoudiniCommandletUtils::CookAndBakeAssetToUAsset(
+    HAPI_NodeId AssetId, const FString& VariantName, const FString& OutUAssetFilePath )
+{
+#if WITH_EDITOR
+    // Cook the asset with its new parameters
+    double CookStartTime = FPlatformTime::Seconds();
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
+        FHoudiniEngine::Get().GetSession(), AssetId, nullptr ), false );
+
+    if ( !WaitForNodeCook( AssetId ) )
+        return false;
+
+    HOUDINI_LOG_MESSAGE( TEXT( "Cooked %s in %.3f s." ), *VariantName, FPlatformTime::Seconds() - CookStartTime );
+#endif
+    return BakeCookedAssetToUAsset( AssetId, VariantName, OutUAssetFilePath );
+}
+
+bool FHoudiniCommandletUtils::BakeCookedAssetToUAsset(
+    HAPI_NodeId AssetId, const FString& VariantName, const FString& OutUAssetFilePath )
+{
+#if WITH_EDITOR
+    // Create a package for the result
+    FString UASSETPath, UASSETFileName, UASSETExtension;
+    FPaths::Split( OutUAssetFilePath, UASSETPath, UASSETFileName, UASSETExtension );
+
+    FString PackageFilePath;
+    UPackage * Package = CreateLocalPackage( UASSETFileName, PackageFilePath );
+    if ( !Package )
+        return false;
+
+    // Create the Static Meshes and bake them to the package
+    double MeshStartTime = FPlatformTime::Seconds();
+    HAPI_NodeId NodeId = AssetId;
+    TMap< FHoudiniGeoPartObject, UStaticMesh * > StaticMeshesOut;
+    if ( !CreateStaticMeshes( VariantName, NodeId, Package, StaticMeshesOut ) )
+        return false;
+
+    if ( !BakeStaticMeshesToPackage( VariantName, StaticMeshesOut, Package ) )
+        return false;
+
+    double MeshTime = FPlatformTime::Seconds() - MeshStartTime;
+
+    double SaveStartTime = FPlatformTime::Seconds();
+    if ( !SaveLocalPackage( Package, PackageFilePath, OutUAssetFilePath ) )
+        return false;
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Baked %s: meshes %.3f s, save %.3f s." ),
+        *VariantName, MeshTime, FPlatformTime::Seconds() - SaveStartTime );
+#endif
+    return true;
+}
+
+bool FHoudiniCommandletUtils::SetParameterFromString(
+    HAPI_NodeId NodeId, const FString& ParmName, const FString& ValueString )
+{
+    std::string ParmNameString = TCHAR_TO_UTF8( *ParmName );
+    HAPI_ParmId ParmId = -1;
+    if ( ( HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmIdFromName(
+        FHoudiniEngine::Get().GetSession(), NodeId, ParmNameString.c_str(), &ParmId ) ) || ( ParmId < 0 ) )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "Could not find parameter %s" ), *ParmName );
+        return false;
+    }
+
+    HAPI_ParmInfo ParmInfo;
+    FMemory::Memzero< HAPI_ParmInfo >( ParmInfo );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmInfo(
+        FHoudiniEngine::Get().GetSession(), NodeId, ParmId, &ParmInfo ), false );
+
+    TArray< FString > Values;
+    ValueString.ParseIntoArray( Values, TEXT( ";" ), false );
+    int32 NumValues = FMath::Min( Values.Num(), ParmInfo.size );
+    if ( NumValues <= 0 )
+        return false;
+
+    switch ( ParmInfo.type )
+    {
+        case HAPI_PARMTYPE_INT:
+        case HAPI_PARMTYPE_TOGGLE:
+        case HAPI_PARMTYPE_MULTIPARMLIST:
+        {
+            TArray< int32 > IntValues;
+            IntValues.SetNumUninitialized( NumValues );
+            for ( int32 Idx = 0; Idx < NumValues; Idx++ )
+                IntValues[ Idx ] = FCString::Atoi( *Values[ Idx ] );
+
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmIntValues(
+                FHoudiniEngine::Get().GetSession(), NodeId, IntValues.GetData(),
+                ParmInfo.intValuesIndex, NumValues ), false );
+            break;
+        }
+
+        case HAPI_PARMTYPE_FLOAT:
+        case HAPI_PARMTYPE_COLOR:
+        {
+            TArray< float > FloatValues;
+            FloatValues.SetNumUninitialized( NumValues );
+            for ( int32 Idx = 0; Idx < NumValues; Idx++ )
+                FloatValues[ Idx ] = FCString::Atof( *Values[ Idx ] );
+
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmFloatValues(
+                FHoudiniEngine::Get().GetSession(), NodeId, FloatValues.GetData(),
+                ParmInfo.floatValuesIndex, NumValues ), false );
+            break;
+        }
+
+        case HAPI_PARMTYPE_STRING:
+        case HAPI_PARMTYPE_PATH_FILE:
+        case HAPI_PARMTYPE_PATH_FILE_DIR:
+        case HAPI_PARMTYPE_PATH_FILE_GEO:
+        case HAPI_PARMTYPE_PATH_FILE_IMAGE:
+        {
+            for ( int32 Idx = 0; Idx < NumValues; Idx++ )
+            {
+                std::string ConvertedString = TCHAR_TO_UTF8( *Values[ Idx ] );
+                HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmStringValue(
+                    FHoudiniEngine::Get().GetSession(), NodeId, ConvertedString.c_str(), ParmId, Idx ), false );
+            }
+            break;
+        }
+
+        default:
+        {
+            HOUDINI_LOG_WARNING( TEXT( "Parameter %s has a type that can't be set from a string" ), *ParmName );
+            return false;
+        }
+    }
+
+    return true;
+}
+
+UPackage* FHoudiniCommandletUtils::CreateLocalPackage( const FString& UASSETFileName, FString& OutPackageFilePath )
+{
+    FString PackagePath = LocalAutoBakeFolder + UASSETFileName;
+    OutPackageFilePath = UPackageTools::SanitizePackageName( PackagePath );
+    UPackage * Package = FindPackage( nullptr, *OutPackageFilePath );
+    if ( !Package )    
+    {
+        // Create actual package.
+        Package = CreatePackage( nullptr, *OutPackageFilePath );
+        if ( !Package )
+        {
+            // Couldn't create the package
+            HOUDINI_LOG_ERROR( TEXT( "Could not create local Package for the UASSET !!!" ) );
+            return nullptr;
+        }
+    }
+    else
+    {
+        // Package already exists, overwrite?
+        HOUDINI_LOG_MESSAGE( TEXT( "Package %s already exists, overwriting!" ), *OutPackageFilePath );
+    }
+
+    return Package;
+}
+
+bool FHoudiniCommandletUtils::SaveLocalPackage( UPackage* Package, const FString& PackageFilePath, const FString& UASSETFilePath )
+{
+    if ( !Package )
+        return false;
+
     Package->SetDirtyFlag( true );
     Package->FullyLoad();
 
@@ -403,25 +1412,31 @@ bool FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( const FString& InBGEOFile
     {
         // There was some cook errors
         HOUDINI_LOG_ERROR( TEXT( "Could not save the local package %s"), *PackageFilePath );
-        return DeleteLocalPackageAndReturnError();
+        FFileManagerGeneric::Get().Delete( *LocalPackageFileName, false, true, true );
+        return false;
     }
 
-    //---------------------------------------------------------------------------------------------
-    // 9. Move the local package to its final destination
-    //---------------------------------------------------------------------------------------------
-
+    // Move the local package to its final destination
     LocalPackageFileName = FPaths::ConvertRelativePathToFull( LocalPackageFileName );
     if (!FFileManagerGeneric::Get().Move(*UASSETFilePath, *LocalPackageFileName, true, true, false, false  ) )
     {
         HOUDINI_LOG_ERROR( TEXT("Could not move local package %s to %s"), *LocalPackageFileName, *UASSETFilePath);
-        return DeleteLocalPackageAndReturnError();
+        FFileManagerGeneric::Get().Delete( *LocalPackageFileName, false, true, true );
+        return false;
     }
-#endif
+
     return true;
 }
 
-
 bool FHoudiniCommandletUtils::LoadBGEOFileInHAPI( const FString& InputFilePath, HAPI_NodeId& NodeId )
+{
+    if ( !StartLoadBGEOFileInHAPI( InputFilePath, NodeId ) )
+        return false;
+
+    return WaitForNodeCook( NodeId );
+}
+
+bool FHoudiniCommandletUtils::StartLoadBGEOFileInHAPI( const FString& InputFilePath, HAPI_NodeId& NodeId )
 {
     NodeId = -1;
 
@@ -448,6 +1463,15 @@ bool FHoudiniCommandletUtils::LoadBGEOFileInHAPI( const FString& InputFilePath,
         FHoudiniEngine::Get().GetSession(), NodeId, ConvertedString.c_str(), ParmId, 0 ), false );
 
     // Cook the node    
+    HAPI_CookOptions CookOptions = GetBGEOCookOptions();
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
+        FHoudiniEngine::Get().GetSession(), NodeId, &CookOptions ), false );
+
+    return true;
+}
+
+HAPI_CookOptions FHoudiniCommandletUtils::GetBGEOCookOptions()
+{
     HAPI_CookOptions CookOptions;
     FMemory::Memzero< HAPI_CookOptions >( CookOptions );
     CookOptions.curveRefineLOD = 8.0f;
@@ -459,8 +1483,78 @@ bool FHoudiniCommandletUtils::LoadBGEOFileInHAPI( const FString& InputFilePath,
     CookOptions.handleSpherePartTypes = false;
     CookOptions.splitPointsByVertexAttributes = false;
     CookOptions.packedPrimInstancingMode = HAPI_PACKEDPRIM_INSTANCING_MODE_FLAT;
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
-        FHoudiniEngine::Get().GetSession(), NodeId, &CookOptions ), false );
+
+    return CookOptions;
+}
+
+FString FHoudiniCommandletUtils::GetConversionSettingsString()
+{
+    HAPI_CookOptions CookOptions = GetBGEOCookOptions();
+    return FString::Printf(
+        TEXT( "%s|%f|%d|%d|%d|%d|%d|%d|%d" ),
+        *FHoudiniEngineUtils::ComputeVersionString( true ),
+        CookOptions.curveRefineLOD,
+        CookOptions.maxVerticesPerPrimitive,
+        CookOptions.splitGeosByGroup ? 1 : 0,
+        CookOptions.refineCurveToLinear ? 1 : 0,
+        CookOptions.handleBoxPartTypes ? 1 : 0,
+        CookOptions.handleSpherePartTypes ? 1 : 0,
+        CookOptions.splitPointsByVertexAttributes ? 1 : 0,
+        (int32)CookOptions.packedPrimInstancingMode );
+}
+
+FString FHoudiniCommandletUtils::ComputeSourceFileSignature( const FString& FilePath )
+{
+    int64 FileSize = FFileManagerGeneric::Get().FileSize( *FilePath );
+    if ( FileSize < 0 )
+        return FString();
+
+    FMD5Hash FileHash = FMD5Hash::HashFile( *FilePath );
+    if ( !FileHash.IsValid() )
+        return FString();
+
+    return FString::Printf( TEXT( "%lld|%s" ), FileSize, *LexToString( FileHash ) );
+}
+
+void FHoudiniCommandletUtils::LoadConversionManifest( const FString& ManifestFilePath, TMap< FString, FString >& Entries )
+{
+    Entries.Empty();
+
+    TArray< FString > Lines;
+    if ( !FFileHelper::LoadFileToStringArray( Lines, *ManifestFilePath ) || Lines.Num() <= 0 )
+        return;
+
+    // The first line holds the settings the files were converted with
+    if ( !Lines[ 0 ].Equals( GetConversionSettingsString() ) )
+    {
+        HOUDINI_LOG_MESSAGE( TEXT( "Conversion settings changed since the manifest was written, all files will be converted." ) );
+        return;
+    }
+
+    // Each following line is "FileName|Size|Hash"
+    for ( int32 n = 1; n < Lines.Num(); n++ )
+    {
+        FString FileName, Signature;
+        if ( Lines[ n ].Split( TEXT( "|" ), &FileName, &Signature ) && !FileName.IsEmpty() )
+            Entries.Add( FileName, Signature );
+    }
+}
+
+bool FHoudiniCommandletUtils::SaveConversionManifest( const FString& ManifestFilePath, const TMap< FString, FString >& Entries )
+{
+    TArray< FString > Lines;
+    Lines.Reserve( Entries.Num() + 1 );
+    Lines.Add( GetConversionSettingsString() );
+    for ( const TPair< FString, FString >& Entry : Entries )
+        Lines.Add( Entry.Key + TEXT( "|" ) + Entry.Value );
+
+    return FFileHelper::SaveStringArrayToFile( Lines, *ManifestFilePath );
+}
+
+bool FHoudiniCommandletUtils::WaitForNodeCook( HAPI_NodeId NodeId )
+{
+    if ( NodeId < 0 )
+        return false;
 
     // Wait for the cook to finish
     int status = HAPI_STATE_MAX_READY_STATE + 1;
@@ -491,6 +1585,16 @@ bool FHoudiniCommandletUtils::LoadBGEOFileInHAPI( const FString& InputFilePath,
     return true;
 }
 
+bool FHoudiniCommandletUtils::IsCookFinished()
+{
+    int status = HAPI_STATE_MAX_READY_STATE + 1;
+    if ( HAPI_RESULT_SUCCESS != FHoudiniApi::GetStatus(
+        FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &status ) )
+        return true;
+
+    return status <= HAPI_STATE_MAX_READY_STATE;
+}
+
 bool FHoudiniCommandletUtils::CreateStaticMeshes(
     const FString& InputName, HAPI_NodeId& NodeId, UPackage* OuterPackage,
     TMap<FHoudiniGeoPartObject, UStaticMesh *>& StaticMeshesOut )
@@ -36,16 +36,60 @@ struct FHoudiniGeoPartObject;
 
 struct FHoudiniCommandletUtils
 {
-    static bool ConvertBGEOFileToUAsset( const FString& InBGEOFilePath, const FString& OutUAssetFilePath );
+    /** Converts a bgeo file to a uasset. If PreloadedNodeId is valid, it must be a file SOP started via  **/
+    /** StartLoadBGEOFileInHAPI for that bgeo. OnHAPIDone is called as soon as the conversion doesn't      **/
+    /** need the Houdini session anymore, before the package is saved.                                    **/
+    static bool ConvertBGEOFileToUAsset(
+        const FString& InBGEOFilePath, const FString& OutUAssetFilePath,
+        HAPI_NodeId PreloadedNodeId = -1, TFunction< void() > OnHAPIDone = nullptr );
 
     static bool LoadBGEOFileInHAPI( const FString& InputFilePath, HAPI_NodeId& NodeId );
 
+    /** Creates a file SOP for the bgeo and starts cooking it, without waiting for the cook to finish. **/
+    static bool StartLoadBGEOFileInHAPI( const FString& InputFilePath, HAPI_NodeId& NodeId );
+
+    /** Waits for the cook of a node, started without waiting, to finish. **/
+    static bool WaitForNodeCook( HAPI_NodeId NodeId );
+
+    /** Returns true once the current session is done cooking, without waiting. **/
+    static bool IsCookFinished();
+
+    /** Cook options used when loading bgeo files. **/
+    static HAPI_CookOptions GetBGEOCookOptions();
+
+    /** Returns a string identifying the plugin version and import settings used for conversions. **/
+    static FString GetConversionSettingsString();
+
+    /** Returns a "size|md5" signature of a source file, empty if the file couldn't be read. **/
+    static FString ComputeSourceFileSignature( const FString& FilePath );
+
+    /** Reads the conversion manifest. Entries written with other settings are discarded. **/
+    static void LoadConversionManifest( const FString& ManifestFilePath, TMap< FString, FString >& Entries );
+
+    /** Writes the conversion manifest, mapping source file names to their signature. **/
+    static bool SaveConversionManifest( const FString& ManifestFilePath, const TMap< FString, FString >& Entries );
+
     static bool CreateStaticMeshes(
 	const FString& InputName, HAPI_NodeId& NodeId, UPackage* OuterPackage,
 	TMap<FHoudiniGeoPartObject, UStaticMesh *>& StaticMeshesOut );
 
     static bool BakeStaticMeshesToPackage(
 	const FString& InputName, TMap<FHoudiniGeoPartObject, UStaticMesh *>& StaticMeshes, UPackage* OutPackage );
+
+    /** Creates (or finds) the package used to bake a uasset in the local auto bake folder. **/
+    static UPackage* CreateLocalPackage( const FString& UASSETFileName, FString& OutPackageFilePath );
+
+    /** Saves a local package, then moves the resulting file to UASSETFilePath. **/
+    static bool SaveLocalPackage( UPackage* Package, const FString& PackageFilePath, const FString& UASSETFilePath );
+
+    /** Sets a parameter of a node from a string, tuple values are separated by ';'. **/
+    static bool SetParameterFromString( HAPI_NodeId NodeId, const FString& ParmName, const FString& ValueString );
+
+    /** Cooks an instantiated asset and bakes its static meshes to a uasset. **/
+    static bool CookAndBakeAssetToUAsset( HAPI_NodeId AssetId, const FString& VariantName, const FString& OutUAssetFilePath );
+
+    /** Bakes the static meshes of an asset that is done cooking to a uasset. **/
+    static bool BakeCookedAssetToUAsset( HAPI_NodeId AssetId, const FString& VariantName, const FString& OutUAssetFilePath );
 };
 
 UCLASS()
@@ -63,6 +107,36 @@ class UHoudiniEngineConvertBgeoCommandlet : public UCommandlet
 	virtual int32 Main(const FString& Params) override;
 };
 
+UCLASS()
+class UHoudiniEngineCookVariantsCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+public:
+
+    /** Default constructor. */
+    UHoudiniEngineCookVariantsCommandlet();
+
+public:
+
+    //~ UCommandlet interface
+    virtual int32 Main(const FString& Params) override;
+};
+
+UCLASS()
+class UHoudiniEngineCookFarmCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+public:
+
+    /** Default constructor. */
+    UHoudiniEngineCookFarmCommandlet();
+
+public:
+
+    //~ UCommandlet interface
+    virtual int32 Main(const FString& Params) override;
+};
+
 UCLASS()
 class UHoudiniEngineConvertBgeoDirCommandlet : public UCommandlet
 {
@@ -0,0 +1,171 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineCookDispatcher.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniEngine.h"
+#include "HoudiniAssetComponent.h"
+
+#if WITH_EDITOR
+
+FHoudiniEngineCookDispatcher::FHoudiniEngineCookDispatcher()
+    : LastPollTime( 0.0 )
+{}
+
+FHoudiniEngineCookDispatcher::~FHoudiniEngineCookDispatcher()
+{
+    if ( TickerHandle.IsValid() )
+    {
+        FTicker::GetCoreTicker().RemoveTicker( TickerHandle );
+        TickerHandle.Reset();
+    }
+}
+
+void
+FHoudiniEngineCookDispatcher::RegisterComponent( UHoudiniAssetComponent * HoudiniAssetComponent )
+{
+    if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() )
+        return;
+
+    TickingComponents.Add( HoudiniAssetComponent );
+    UpdateTicker();
+}
+
+void
+FHoudiniEngineCookDispatcher::UnregisterComponent( UHoudiniAssetComponent * HoudiniAssetComponent )
+{
+    TickingComponents.Remove( HoudiniAssetComponent );
+    UpdateTicker();
+}
+
+bool
+FHoudiniEngineCookDispatcher::IsComponentRegistered( UHoudiniAssetComponent * HoudiniAssetComponent ) const
+{
+    return TickingComponents.Contains( HoudiniAssetComponent );
+}
+
+bool
+FHoudiniEngineCookDispatcher::HasTickingComponents() const
+{
+    return TickingComponents.Num() > 0;
+}
+
+void
+FHoudiniEngineCookDispatcher::RegisterUIUpdate( UHoudiniAssetComponent * HoudiniAssetComponent )
+{
+    if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() )
+        return;
+
+    UIUpdateComponents.Add( HoudiniAssetComponent );
+    UpdateTicker();
+}
+
+void
+FHoudiniEngineCookDispatcher::UnregisterUIUpdate( UHoudiniAssetComponent * HoudiniAssetComponent )
+{
+    UIUpdateComponents.Remove( HoudiniAssetComponent );
+    UpdateTicker();
+}
+
+bool
+FHoudiniEngineCookDispatcher::IsUIUpdateRegistered( UHoudiniAssetComponent * HoudiniAssetComponent ) const
+{
+    return UIUpdateComponents.Contains( HoudiniAssetComponent );
+}
+
+void
+FHoudiniEngineCookDispatcher::UpdateTicker()
+{
+    const bool bHasComponents = TickingComponents.Num() > 0 || UIUpdateComponents.Num() > 0;
+    if ( bHasComponents && !TickerHandle.IsValid() )
+    {
+        // Tick every frame, task results are dispatched as soon as they are available.
+        TickerHandle = FTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw( this, &FHoudiniEngineCookDispatcher::Tick ) );
+    }
+    else if ( !bHasComponents && TickerHandle.IsValid() )
+    {
+        // Nothing to tick, idle components cost nothing.
+        FTicker::GetCoreTicker().RemoveTicker( TickerHandle );
+        TickerHandle.Reset();
+    }
+}
+
+bool
+FHoudiniEngineCookDispatcher::Tick( float DeltaTime )
+{
+    // Retrieve the tasks whose info has been updated since last frame.
+    TSet< FGuid > UpdatedTaskGUIDs;
+    FHoudiniEngine::Get().RetrieveUpdatedTaskInfos( UpdatedTaskGUIDs );
+
+    // Components without a task in progress, submitting tasks or waiting on upstream assets, are ticked periodically.
+    const double CurrentTime = FPlatformTime::Seconds();
+    const bool bPollComponents = ( CurrentTime - LastPollTime ) >= HAPI_UNREAL_COOK_DISPATCHER_POLL_INTERVAL;
+    if ( bPollComponents )
+        LastPollTime = CurrentTime;
+
+    // Components can register or unregister while being ticked, iterate on a copy.
+    TArray< TWeakObjectPtr< UHoudiniAssetComponent > > Components = TickingComponents.Array();
+    for ( TWeakObjectPtr< UHoudiniAssetComponent > & Component : Components )
+    {
+        if ( !Component.IsValid() || Component->IsPendingKill() )
+        {
+            TickingComponents.Remove( Component );
+            continue;
+        }
+
+        // Time sliced post cooks are resumed every frame.
+        const FGuid & HapiGUID = Component->GetHapiGUID();
+        if ( Component->IsPostCookInProgress()
+            || ( HapiGUID.IsValid() ? UpdatedTaskGUIDs.Contains( HapiGUID ) : bPollComponents ) )
+        {
+            Component->TickHoudiniComponent();
+        }
+    }
+
+    if ( bPollComponents )
+    {
+        TArray< TWeakObjectPtr< UHoudiniAssetComponent > > UIComponents = UIUpdateComponents.Array();
+        for ( TWeakObjectPtr< UHoudiniAssetComponent > & Component : UIComponents )
+        {
+            if ( !Component.IsValid() || Component->IsPendingKill() )
+            {
+                UIUpdateComponents.Remove( Component );
+                continue;
+            }
+
+            Component->TickHoudiniUIUpdate();
+        }
+    }
+
+    // Remove ourselves from the ticker if we have nothing left to tick.
+    const bool bHasComponents = TickingComponents.Num() > 0 || UIUpdateComponents.Num() > 0;
+    if ( !bHasComponents )
+        TickerHandle.Reset();
+
+    return bHasComponents;
+}
+
+#endif
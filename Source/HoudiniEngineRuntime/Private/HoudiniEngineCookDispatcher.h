@@ -0,0 +1,88 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtr.h"
+
+#if WITH_EDITOR
+
+class UHoudiniAssetComponent;
+
+/** Ticks the asset components waiting on instantiation, cooking or UI updates, from a single engine-owned ticker. **/
+class FHoudiniEngineCookDispatcher
+{
+    public:
+
+        FHoudiniEngineCookDispatcher();
+        ~FHoudiniEngineCookDispatcher();
+
+    public:
+
+        /** Register a component requiring cooking / instantiation ticking. **/
+        void RegisterComponent( UHoudiniAssetComponent * HoudiniAssetComponent );
+
+        /** Unregister a component, it will no longer be ticked. **/
+        void UnregisterComponent( UHoudiniAssetComponent * HoudiniAssetComponent );
+
+        /** Return true if the component is registered for cooking / instantiation ticking. **/
+        bool IsComponentRegistered( UHoudiniAssetComponent * HoudiniAssetComponent ) const;
+
+        /** Return true if any component is registered for cooking / instantiation ticking. **/
+        bool HasTickingComponents() const;
+
+        /** Register a component waiting to update its details panel. **/
+        void RegisterUIUpdate( UHoudiniAssetComponent * HoudiniAssetComponent );
+
+        /** Unregister a component waiting to update its details panel. **/
+        void UnregisterUIUpdate( UHoudiniAssetComponent * HoudiniAssetComponent );
+
+        /** Return true if the component is waiting to update its details panel. **/
+        bool IsUIUpdateRegistered( UHoudiniAssetComponent * HoudiniAssetComponent ) const;
+
+    protected:
+
+        /** Ticker callback, dispatches the updated task infos to their components. **/
+        bool Tick( float DeltaTime );
+
+        /** Add or remove our ticker depending on whether we have registered components. **/
+        void UpdateTicker();
+
+    protected:
+
+        /** Components registered for cooking / instantiation ticking. **/
+        TSet< TWeakObjectPtr< UHoudiniAssetComponent > > TickingComponents;
+
+        /** Components waiting to update their details panel. **/
+        TSet< TWeakObjectPtr< UHoudiniAssetComponent > > UIUpdateComponents;
+
+        /** Handle of our core ticker delegate, only valid while components are registered. **/
+        FDelegateHandle TickerHandle;
+
+        /** Last time components without a task in progress were ticked. **/
+        double LastPollTime;
+};
+
+#endif
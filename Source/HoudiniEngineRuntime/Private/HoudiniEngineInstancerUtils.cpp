@@ -27,6 +27,7 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniCookProfile.h"
 #include "HoudiniInstancedActorComponent.h"
 #include "HoudiniMeshSplitInstancerComponent.h"
 
@@ -34,9 +35,13 @@
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
 
 #include "HoudiniEngineRuntimePrivatePCH.h"
+#include "Misc/PackageName.h"
+#include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+DECLARE_CYCLE_STAT( TEXT( "Houdini: Create All Instancers" ), STAT_CreateAllInstancers, STATGROUP_HoudiniEngine );
+
 bool
 FHoudiniEngineInstancerUtils::CreateAllInstancers(
     FHoudiniCookParams& HoudiniCookParams,
@@ -47,6 +52,9 @@ FHoudiniEngineInstancerUtils::CreateAllInstancers(
     TMap< FHoudiniGeoPartObject, USceneComponent * >& Instancers,
     TMap< FHoudiniGeoPartObject, USceneComponent * >& NewInstancers )
 {
+    SCOPE_CYCLE_COUNTER( STAT_CreateAllInstancers );
+    FHoudiniCookProfileStageScope ProfileStageScope( EHoudiniCookProfileStage::Instancers );
+
     for ( const FHoudiniGeoPartObject& HoudiniGeoPartObject : FoundInstancers )
     {
         if ( !HoudiniGeoPartObject.IsVisible() )
@@ -137,7 +145,7 @@ FHoudiniEngineInstancerUtils::CreateAllInstancers(
 		    {
 			HOUDINI_LOG_WARNING(
 			    TEXT( "CreateAllInstancers for Packed Primitive: Could not find static mesh for object [%d %s], geo %d, part %d]" ),
-			    InstancedGeoPartObject.ObjectId, *InstancedGeoPartObject.ObjectName, InstancedGeoPartObject.GeoId, InstancedGeoPartObject.PartId );
+			    InstancedGeoPartObject.ObjectId, *InstancedGeoPartObject.GetObjectName(), InstancedGeoPartObject.GeoId, InstancedGeoPartObject.PartId );
 		    }
 		}
 	    }
@@ -232,20 +240,24 @@ FHoudiniEngineInstancerUtils::GetPackedPrimInstancerObjectsAndTransforms(
     // Convert the transform to Unreal's coordinate system
     TArray<FTransform> InstancerUnrealTransforms;
     InstancerUnrealTransforms.SetNumUninitialized( InstancerPartTransforms.Num() );
-    for ( int32 InstanceIdx = 0; InstanceIdx < InstancerPartTransforms.Num(); ++InstanceIdx )
-    {
-	const auto& InstanceTransform = InstancerPartTransforms[InstanceIdx];
-	FHoudiniEngineUtils::TranslateHapiTransform( InstanceTransform, InstancerUnrealTransforms[ InstanceIdx ] );
-    }
+    FHoudiniEngineUtils::TranslateHapiTransforms(
+	InstancerPartTransforms.GetData(), InstancerPartTransforms.Num(), InstancerUnrealTransforms.GetData() );
 
-    for ( auto InstancedPartId : InstancedPartIds )
+    InstancedGeoPart.Reserve( InstancedGeoPart.Num() + InstancedPartIds.Num() );
+    InstancedTransforms.Reserve( InstancedTransforms.Num() + InstancedPartIds.Num() );
+    for ( int32 PartIdx = 0; PartIdx < InstancedPartIds.Num(); ++PartIdx )
     {
 	// Create the GeoPartObject correspondin to the instanced part
-	FHoudiniGeoPartObject InstancedPart( HoudiniGeoPartObject.AssetId, HoudiniGeoPartObject.ObjectId, HoudiniGeoPartObject.GeoId, InstancedPartId );
+	FHoudiniGeoPartObject InstancedPart( HoudiniGeoPartObject.AssetId, HoudiniGeoPartObject.ObjectId, HoudiniGeoPartObject.GeoId, InstancedPartIds[ PartIdx ] );
 	InstancedPart.TransformMatrix = HoudiniGeoPartObject.TransformMatrix;
 
 	InstancedGeoPart.Add( InstancedPart );
-	InstancedTransforms.Add( InstancerUnrealTransforms );
+
+	// All parts share the same transforms, the last one can take them over.
+	if ( PartIdx == InstancedPartIds.Num() - 1 )
+	    InstancedTransforms.Add( MoveTemp( InstancerUnrealTransforms ) );
+	else
+	    InstancedTransforms.Add( InstancerUnrealTransforms );
     }
 
     return true;
@@ -318,60 +330,44 @@ FHoudiniEngineInstancerUtils::GetUnrealAttributeInstancerObjectsAndTransforms(
     }
     else
     {
-	// Attribute is on points, so we may have different values for each of them
-	TArray< FString > PointInstanceValues;
-	if ( !HoudiniGeoPartObject.HapiGetAttributeDataAsString(
-	    AssetId, MarshallingAttributeInstanceOverride,
-	    HAPI_ATTROWNER_POINT, ResultAttributeInfo, PointInstanceValues ) )
+	// Attribute is on points, so we may have different values for each of them.
+	// Get them as a table of the unique paths, which are the objects we want to instance.
+	TArray< FString > UniqueInstancePaths;
+	TArray< int32 > PointInstancePathIndices;
+	if ( !FHoudiniEngineUtils::HapiGetAttributeDataAsStringTable(
+	    AssetId, HoudiniGeoPartObject.ObjectId, HoudiniGeoPartObject.GeoId, HoudiniGeoPartObject.PartId,
+	    MarshallingAttributeInstanceOverride.c_str(), ResultAttributeInfo,
+	    UniqueInstancePaths, PointInstancePathIndices, 0, HAPI_ATTROWNER_POINT ) )
 	{
 	    // This should not happen - attribute exists, but there was an error retrieving it.
 	    return false;
 	}
 
 	// Attribute is on points, number of points must match number of transforms.
-	if ( !ensure( PointInstanceValues.Num() == AllTransforms.Num() ) )
+	if ( !ensure( PointInstancePathIndices.Num() == AllTransforms.Num() ) )
 	{
 	    // This should not happen, we have mismatch between number of instance values and transforms.
 	    return false;
 	}
 
-	// If instance attribute exists on points, we need to get all unique values.
-	// This will give us all the unique object we want to instance
-	TMap< FString, UObject * > ObjectsToInstance;
-	for ( auto Iter : PointInstanceValues )
-	{
-	    const FString & UniqueName = *Iter;
-
-	    if ( !ObjectsToInstance.Contains( UniqueName ) )
-	    {
-		// To avoid trying to load an object that fails multiple times, still add it to the array so we skip further attempts
-		UObject * AttributeObject = StaticLoadObject( 
-		    UObject::StaticClass(), nullptr, *UniqueName, nullptr, LOAD_None, nullptr );
+	// Load each unique object once, and split the transforms between them.
+	TArray< UObject * > ObjectsToInstance;
+	FHoudiniEngineInstancerUtils::LoadInstancedObjects( UniqueInstancePaths, ObjectsToInstance );
 
-		ObjectsToInstance.Add( UniqueName, AttributeObject );
-	    }
-	}
+	TArray< TArray< FTransform > > ObjectsTransforms;
+	FHoudiniEngineInstancerUtils::BucketInstanceTransforms(
+	    PointInstancePathIndices, UniqueInstancePaths.Num(), AllTransforms, ObjectsTransforms );
 
-	// Iterates through all the unique objects and get their corresponding transforms
 	bool Success = false;
-	for( auto Iter : ObjectsToInstance )
+	for ( int32 ObjectIdx = 0; ObjectIdx < ObjectsToInstance.Num(); ++ObjectIdx )
 	{
 	    // Check we managed to load this object
-	    UObject * AttributeObject = Iter.Value;
-	    if ( !AttributeObject )
+	    UObject * AttributeObject = ObjectsToInstance[ ObjectIdx ];
+	    if ( !AttributeObject || ObjectsTransforms[ ObjectIdx ].Num() <= 0 )
 		continue;
 
-	    // Extract the transform values that correspond to this object
-	    const FString & InstancePath = Iter.Key;
-	    TArray< FTransform > ObjectTransforms;
-	    for (int32 Idx = 0; Idx < PointInstanceValues.Num(); ++Idx)
-	    {
-		if ( InstancePath.Equals( PointInstanceValues[ Idx ] ) )
-		    ObjectTransforms.Add( AllTransforms[ Idx ] );
-	    }
-
 	    InstancedObjects.Add( AttributeObject );
-	    InstancedTransforms.Add( ObjectTransforms );
+	    InstancedTransforms.Add( MoveTemp( ObjectsTransforms[ ObjectIdx ] ) );
 	    Success = true;
 	}
 
@@ -381,6 +377,97 @@ FHoudiniEngineInstancerUtils::GetUnrealAttributeInstancerObjectsAndTransforms(
 
     return true;
 }
+
+/** Objects already resolved from instance attribute paths. **/
+static TMap< FString, TWeakObjectPtr< UObject > > HoudiniInstancedObjectCache;
+
+void
+FHoudiniEngineInstancerUtils::LoadInstancedObjects(
+    const TArray< FString >& ObjectPaths,
+    TArray< UObject * >& Objects )
+{
+    Objects.SetNumZeroed( ObjectPaths.Num() );
+
+    // Resolve what we can from the cache, the others need to be loaded.
+    TArray< int32 > MissingObjectIndices;
+    for ( int32 Idx = 0; Idx < ObjectPaths.Num(); ++Idx )
+    {
+	if ( ObjectPaths[ Idx ].IsEmpty() )
+	    continue;
+
+	TWeakObjectPtr< UObject > * CachedObject = HoudiniInstancedObjectCache.Find( ObjectPaths[ Idx ] );
+	if ( CachedObject && CachedObject->IsValid() && !( *CachedObject )->IsPendingKill() )
+	    Objects[ Idx ] = CachedObject->Get();
+	else
+	    MissingObjectIndices.Add( Idx );
+    }
+
+    // Request all missing packages at once so they load together, instead of one after the other.
+    if ( MissingObjectIndices.Num() > 1 )
+    {
+	TSet< FString > RequestedPackages;
+	for ( int32 Idx : MissingObjectIndices )
+	{
+	    FString PackageName = FPackageName::ObjectPathToPackageName( ObjectPaths[ Idx ] );
+	    if ( !FPackageName::IsValidLongPackageName( PackageName ) || RequestedPackages.Contains( PackageName ) )
+		continue;
+
+	    if ( FindPackage( nullptr, *PackageName ) )
+		continue;
+
+	    RequestedPackages.Add( PackageName );
+	    LoadPackageAsync( PackageName );
+	}
+
+	if ( RequestedPackages.Num() > 0 )
+	    FlushAsyncLoading();
+    }
+
+    for ( int32 Idx : MissingObjectIndices )
+    {
+	UObject * LoadedObject = StaticLoadObject(
+	    UObject::StaticClass(), nullptr, *ObjectPaths[ Idx ], nullptr, LOAD_None, nullptr );
+
+	if ( !LoadedObject || LoadedObject->IsPendingKill() )
+	    continue;
+
+	Objects[ Idx ] = LoadedObject;
+	HoudiniInstancedObjectCache.Add( ObjectPaths[ Idx ], LoadedObject );
+    }
+}
+
+void
+FHoudiniEngineInstancerUtils::BucketInstanceTransforms(
+    const TArray< int32 >& ObjectIndices,
+    int32 ObjectCount,
+    const TArray< FTransform >& AllTransforms,
+    TArray< TArray< FTransform > >& ObjectTransforms )
+{
+    ObjectTransforms.Empty( ObjectCount );
+    ObjectTransforms.SetNum( ObjectCount );
+
+    int32 TransformCount = FMath::Min( ObjectIndices.Num(), AllTransforms.Num() );
+
+    // Find the slot of each transform in its object's array, then copy the transforms in parallel.
+    TArray< int32 > ObjectCounts;
+    ObjectCounts.SetNumZeroed( ObjectCount );
+    TArray< int32 > TransformSlots;
+    TransformSlots.SetNumUninitialized( TransformCount );
+    for ( int32 Idx = 0; Idx < TransformCount; ++Idx )
+    {
+	int32 ObjectIdx = ObjectIndices[ Idx ];
+	TransformSlots[ Idx ] = ObjectCounts.IsValidIndex( ObjectIdx ) ? ObjectCounts[ ObjectIdx ]++ : INDEX_NONE;
+    }
+
+    for ( int32 ObjectIdx = 0; ObjectIdx < ObjectCount; ++ObjectIdx )
+	ObjectTransforms[ ObjectIdx ].SetNumUninitialized( ObjectCounts[ ObjectIdx ] );
+
+    ParallelFor( TransformCount, [&]( int32 Idx )
+    {
+	if ( TransformSlots[ Idx ] != INDEX_NONE )
+	    ObjectTransforms[ ObjectIndices[ Idx ] ][ TransformSlots[ Idx ] ] = AllTransforms[ Idx ];
+    }, TransformCount < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
+}
 	
 bool
 FHoudiniEngineInstancerUtils::CreateInstancerComponent(    
@@ -400,13 +487,13 @@ FHoudiniEngineInstancerUtils::CreateInstancerComponent(
         if(InstancerGeoPartObject.bInstancerAttributeMaterialAvailable )
         {
             InstancerMaterial = Comp->GetAssignmentMaterial(
-		InstancerGeoPartObject.InstancerAttributeMaterialName);
+		InstancerGeoPartObject.GetInstancerAttributeMaterialName());
         }
 
         // If attribute material was not found, we check for presence of shop instancer material.
         if( !InstancerMaterial && InstancerHoudiniGeoPartObject.bInstancerMaterialAvailable )
             InstancerMaterial = Comp->GetAssignmentMaterial(
-                InstancerHoudiniGeoPartObject.InstancerMaterialName);
+                InstancerHoudiniGeoPartObject.GetInstancerMaterialName());
 	*/
 
 	if ( !FHoudiniEngineInstancerUtils::CreateInstancedStaticMeshComponent(
@@ -58,6 +58,18 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineInstancerUtils
 	    TArray< UObject *>& InstancedObjects,
 	    TArray< TArray< FTransform > >& InstancedTransforms );
 
+	/** Resolve instanced object paths, loading the missing packages in one batch. Unresolved paths give null. **/
+	static void LoadInstancedObjects(
+	    const TArray< FString >& ObjectPaths,
+	    TArray< UObject * >& Objects );
+
+	/** Split transforms into one array per object, given the object index of each transform. **/
+	static void BucketInstanceTransforms(
+	    const TArray< int32 >& ObjectIndices,
+	    int32 ObjectCount,
+	    const TArray< FTransform >& AllTransforms,
+	    TArray< TArray< FTransform > >& ObjectTransforms );
+
 	static bool CreateInstancerComponent(
 	    UObject* InstancedObject,
 	    const TArray< FTransform >& InstancedObjectTransforms,
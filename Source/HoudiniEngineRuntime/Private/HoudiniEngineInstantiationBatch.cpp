@@ -0,0 +1,120 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineInstantiationBatch.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniAsset.h"
+
+#if WITH_EDITOR
+
+FHoudiniEngineInstantiationBatch::FHoudiniEngineInstantiationBatch()
+    : bAssigningAsset( false )
+{}
+
+FHoudiniEngineInstantiationBatch::~FHoudiniEngineInstantiationBatch()
+{
+    Reset();
+}
+
+void
+FHoudiniEngineInstantiationBatch::AssignAsset( UHoudiniAssetComponent * HoudiniAssetComponent, UHoudiniAsset * HoudiniAsset )
+{
+    if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() )
+        return;
+
+    // The component queues itself instead of starting its instantiation.
+    TGuardValue< bool > AssigningAssetGuard( bAssigningAsset, true );
+    HoudiniAssetComponent->SetHoudiniAsset( HoudiniAsset );
+}
+
+bool
+FHoudiniEngineInstantiationBatch::IsAssigningAsset() const
+{
+    return bAssigningAsset;
+}
+
+void
+FHoudiniEngineInstantiationBatch::AddComponent( UHoudiniAssetComponent * HoudiniAssetComponent )
+{
+    if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() )
+        return;
+
+    HoudiniAssetComponents.AddUnique( HoudiniAssetComponent );
+
+    if ( !TickerHandle.IsValid() )
+    {
+        TickerHandle = FTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw( this, &FHoudiniEngineInstantiationBatch::Tick ) );
+    }
+}
+
+void
+FHoudiniEngineInstantiationBatch::Flush()
+{
+    TArray< UHoudiniAssetComponent * > ComponentsToInstantiate;
+    ComponentsToInstantiate.Reserve( HoudiniAssetComponents.Num() );
+
+    for ( const TWeakObjectPtr< UHoudiniAssetComponent > & ComponentPtr : HoudiniAssetComponents )
+    {
+        // Skip the components destroyed or instantiated since they were queued.
+        UHoudiniAssetComponent * HoudiniAssetComponent = ComponentPtr.Get();
+        if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() )
+            continue;
+
+        if ( !HoudiniAssetComponent->GetHoudiniAsset() || HoudiniAssetComponent->IsInstantiatingOrCooking() )
+            continue;
+
+        ComponentsToInstantiate.Add( HoudiniAssetComponent );
+    }
+
+    HoudiniAssetComponents.Empty();
+
+    if ( ComponentsToInstantiate.Num() > 0 )
+        UHoudiniAssetComponent::StartTaskAssetInstantiations( ComponentsToInstantiate, true );
+}
+
+void
+FHoudiniEngineInstantiationBatch::Reset()
+{
+    HoudiniAssetComponents.Empty();
+
+    if ( TickerHandle.IsValid() )
+    {
+        FTicker::GetCoreTicker().RemoveTicker( TickerHandle );
+        TickerHandle.Reset();
+    }
+}
+
+bool
+FHoudiniEngineInstantiationBatch::Tick( float DeltaTime )
+{
+    // Returning false removes our ticker, it is added again when components are queued.
+    TickerHandle.Reset();
+    Flush();
+
+    return false;
+}
+
+#endif
@@ -0,0 +1,78 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtr.h"
+
+#if WITH_EDITOR
+
+class UHoudiniAsset;
+class UHoudiniAssetComponent;
+
+/** Collects the asset components placed in the editor during a frame, by the actor factory or the asset broker, **/
+/** and starts their instantiation in a single batch on the next tick. Asset names are retrieved once per asset,  **/
+/** the multi asset dialog is shown once per asset and all tasks are submitted to the schedulers at once.         **/
+class FHoudiniEngineInstantiationBatch
+{
+    public:
+
+        FHoudiniEngineInstantiationBatch();
+        ~FHoudiniEngineInstantiationBatch();
+
+    public:
+
+        /** Assign the asset to the component, its instantiation is deferred to the batch. **/
+        void AssignAsset( UHoudiniAssetComponent * HoudiniAssetComponent, UHoudiniAsset * HoudiniAsset );
+
+        /** Return true while an asset is being assigned through the batch. **/
+        bool IsAssigningAsset() const;
+
+        /** Queue a component whose instantiation should be started with the batch. **/
+        void AddComponent( UHoudiniAssetComponent * HoudiniAssetComponent );
+
+        /** Start the instantiation of all the queued components now. **/
+        void Flush();
+
+        /** Drop the queued components. **/
+        void Reset();
+
+    protected:
+
+        /** Ticker callback, starts the instantiation of the queued components. **/
+        bool Tick( float DeltaTime );
+
+    protected:
+
+        /** Components waiting for their instantiation. **/
+        TArray< TWeakObjectPtr< UHoudiniAssetComponent > > HoudiniAssetComponents;
+
+        /** Handle of our core ticker delegate, only valid while components are queued. **/
+        FDelegateHandle TickerHandle;
+
+        /** True while an asset is assigned through the batch. **/
+        bool bAssigningAsset;
+};
+
+#endif
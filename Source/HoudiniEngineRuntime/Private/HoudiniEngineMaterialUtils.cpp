@@ -28,12 +28,17 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineBakeUtils.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniRuntimeSettings.h"
+#include "HoudiniCookProfile.h"
 
 #include "Materials/Material.h"
 #include "Materials/MaterialInstance.h"
 #include "Materials/MaterialInstanceConstant.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "UObject/MetaData.h"
+#include "HAL/FileManager.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Async/ParallelFor.h"
 #if WITH_EDITOR
     #include "Materials/Material.h"
     #include "Materials/MaterialInstance.h"
@@ -50,6 +55,8 @@
     #include "Factories/MaterialInstanceConstantFactoryNew.h"
 #endif
 
+DECLARE_CYCLE_STAT( TEXT( "Houdini: Create Materials" ), STAT_CreateMaterials, STATGROUP_HoudiniEngine );
+
 const int32
 FHoudiniEngineMaterialUtils::MaterialExpressionNodeX = -400;
 
@@ -62,6 +69,297 @@ FHoudiniEngineMaterialUtils::MaterialExpressionNodeStepX = 220;
 const int32
 FHoudiniEngineMaterialUtils::MaterialExpressionNodeStepY = 220;
 
+/** Image rendered from a texture parameter of a material node, kept between cooks. **/
+struct FHoudiniMaterialImageCacheEntry
+{
+    FHoudiniMaterialImageCacheEntry()
+        : FileTimeStamp( FDateTime::MinValue() )
+        , bHasImagePlanes( false )
+        , bHasLastImageInfo( false )
+        , LastUsedBatch( 0 )
+        , Size( 0 )
+    {
+        FMemory::Memzero( LastImageInfo );
+    }
+
+    /** Extracted image data for a given plane, data format and packing. **/
+    struct FImage
+    {
+        HAPI_ImageInfo ImageInfo;
+        TArray< char > Buffer;
+    };
+
+    /** Time stamp of the texture file, MinValue if it is not reachable from here. **/
+    FDateTime FileTimeStamp;
+
+    /** Image planes of the rendered texture. **/
+    TArray< FString > ImagePlanes;
+    bool bHasImagePlanes;
+
+    /** Extracted images, keyed by plane type, data format and packing. **/
+    TMap< FString, FImage > Images;
+
+    /** Image info of the last image returned from this entry. **/
+    HAPI_ImageInfo LastImageInfo;
+    bool bHasLastImageInfo;
+
+    /** Material batch this entry was last used in, used for eviction. **/
+    uint32 LastUsedBatch;
+
+    /** Size of the extracted image data held by this entry. **/
+    int64 Size;
+};
+
+/** Cached images, keyed by texture parameter value (and owning node for op: references). **/
+static TMap< FString, FHoudiniMaterialImageCacheEntry > HoudiniMaterialImageCache;
+
+/** Cache keys resolved in the current material batch, keyed by material node and parameter. **/
+static TMap< TPair< HAPI_NodeId, HAPI_ParmId >, FString > HoudiniMaterialImageCacheKeys;
+
+/** Texture parameter currently rendered on each material node in the current batch. **/
+static TMap< HAPI_NodeId, HAPI_ParmId > HoudiniMaterialRenderedImageParms;
+
+/** Current material batch and total size of the cached image data. **/
+static uint32 HoudiniMaterialImageCacheBatch = 0;
+static int64 HoudiniMaterialImageCacheSize = 0;
+
+/** Starts a new material batch, evicting the least recently used images when over budget. **/
+static void
+BeginMaterialImageCacheBatch( bool bClearCache )
+{
+    HoudiniMaterialImageCacheBatch++;
+    HoudiniMaterialImageCacheKeys.Empty();
+    HoudiniMaterialRenderedImageParms.Empty();
+
+    if ( bClearCache )
+    {
+        HoudiniMaterialImageCache.Empty();
+        HoudiniMaterialImageCacheSize = 0;
+        return;
+    }
+
+    while ( HoudiniMaterialImageCacheSize > HAPI_UNREAL_MATERIAL_IMAGE_CACHE_MAX_SIZE && HoudiniMaterialImageCache.Num() > 0 )
+    {
+        auto OldestIter = HoudiniMaterialImageCache.CreateIterator();
+        for ( auto Iter = HoudiniMaterialImageCache.CreateIterator(); Iter; ++Iter )
+        {
+            if ( Iter.Value().LastUsedBatch < OldestIter.Value().LastUsedBatch )
+                OldestIter = Iter;
+        }
+
+        HoudiniMaterialImageCacheSize -= OldestIter.Value().Size;
+        OldestIter.RemoveCurrent();
+    }
+}
+
+/** Returns the cache entry for a texture parameter of a material, or null if it cannot be cached. **/
+static FHoudiniMaterialImageCacheEntry *
+FindMaterialImageCacheEntry( HAPI_ParmId NodeParmId, const HAPI_MaterialInfo & MaterialInfo )
+{
+    TPair< HAPI_NodeId, HAPI_ParmId > NodeParm( MaterialInfo.nodeId, NodeParmId );
+    if ( const FString * ResolvedKey = HoudiniMaterialImageCacheKeys.Find( NodeParm ) )
+        return ResolvedKey->IsEmpty() ? nullptr : HoudiniMaterialImageCache.Find( *ResolvedKey );
+
+    // Resolve the key once per batch, the texture parameter value is what identifies the image.
+    HoudiniMaterialImageCacheKeys.Add( NodeParm, FString() );
+
+    HAPI_ParmInfo ParmInfo;
+    if ( FHoudiniApi::GetParmInfo(
+        FHoudiniEngine::Get().GetSession(),
+        MaterialInfo.nodeId, NodeParmId, &ParmInfo ) != HAPI_RESULT_SUCCESS || ParmInfo.stringValuesIndex < 0 )
+    {
+        return nullptr;
+    }
+
+    HAPI_StringHandle ParmValueHandle = -1;
+    if ( FHoudiniApi::GetParmStringValues(
+        FHoudiniEngine::Get().GetSession(),
+        MaterialInfo.nodeId, true, &ParmValueHandle, ParmInfo.stringValuesIndex, 1 ) != HAPI_RESULT_SUCCESS )
+    {
+        return nullptr;
+    }
+
+    FString ParmValue;
+    if ( !FHoudiniEngineString( ParmValueHandle ).ToFString( ParmValue ) || ParmValue.IsEmpty() )
+        return nullptr;
+
+    // Node references are only shared by the material that owns them, and go stale when it changes.
+    // Node ids are reused by the other sessions of the pool, so the session is part of their key.
+    // File textures are shared by every material using them, and go stale when the file changes.
+    bool bIsNodeReference = ParmValue.StartsWith( TEXT( "op:" ) );
+    FString Key = bIsNodeReference
+        ? FString::Printf(
+            TEXT( "%d:%d:%d:%s" ), FHoudiniScopedSession::GetCurrentSessionIndex(),
+            MaterialInfo.nodeId, NodeParmId, *ParmValue )
+        : ParmValue;
+
+    FDateTime FileTimeStamp = bIsNodeReference ? FDateTime::MinValue() : IFileManager::Get().GetTimeStamp( *ParmValue );
+
+    FHoudiniMaterialImageCacheEntry * Entry = HoudiniMaterialImageCache.Find( Key );
+    if ( Entry && Entry->LastUsedBatch != HoudiniMaterialImageCacheBatch )
+    {
+        bool bIsStale = bIsNodeReference
+            ? MaterialInfo.hasChanged
+            : ( FileTimeStamp == FDateTime::MinValue() || FileTimeStamp != Entry->FileTimeStamp );
+
+        if ( bIsStale )
+        {
+            HoudiniMaterialImageCacheSize -= Entry->Size;
+            HoudiniMaterialImageCache.Remove( Key );
+            Entry = nullptr;
+        }
+    }
+
+    if ( !Entry )
+    {
+        Entry = &HoudiniMaterialImageCache.Add( Key );
+        Entry->FileTimeStamp = FileTimeStamp;
+    }
+
+    Entry->LastUsedBatch = HoudiniMaterialImageCacheBatch;
+    HoudiniMaterialImageCacheKeys[ NodeParm ] = Key;
+
+    return Entry;
+}
+
+#if WITH_EDITOR
+
+/** Generated textures whose PostEditChange is deferred until their platform data has been built. **/
+static TArray< TWeakObjectPtr< UTexture2D > > HoudiniMaterialPendingTextures;
+
+/** Defers the PostEditChange of a generated texture, its platform data is built in the background meanwhile. **/
+static void
+DeferTexturePostEditChange( UTexture2D * Texture )
+{
+    if ( Texture && !Texture->IsPendingKill() )
+        HoudiniMaterialPendingTextures.AddUnique( Texture );
+}
+
+/** Appends the exported value of the properties of an object that affect the compiled shaders. **/
+static void
+AppendMaterialGraphSignature( UObject * Object, FString & Signature )
+{
+    Signature += Object->GetClass()->GetName() + TEXT( "{" );
+    for ( TFieldIterator< UProperty > PropertyIt( Object->GetClass() ); PropertyIt; ++PropertyIt )
+    {
+        UProperty * Property = *PropertyIt;
+        if ( Property->HasAnyPropertyFlags( CPF_Transient | CPF_DuplicateTransient ) )
+            continue;
+
+        // Editable values and the connections between expressions.
+        UStructProperty * StructProperty = Cast< UStructProperty >( Property );
+        bool bIsExpressionInput = StructProperty && StructProperty->Struct->GetFName() == TEXT( "ExpressionInput" );
+        if ( !bIsExpressionInput && !Property->HasAnyPropertyFlags( CPF_Edit ) )
+            continue;
+
+        FString Value;
+        Property->ExportTextItem( Value, Property->ContainerPtrToValuePtr< void >( Object ), nullptr, Object, PPF_None );
+        Signature += Property->GetName() + TEXT( "=" ) + Value + TEXT( ";" );
+    }
+
+    Signature += TEXT( "}" );
+}
+
+/** Returns a signature of everything in a generated material that requires its shaders to be recompiled. **/
+static FString
+GetMaterialGraphSignature( UMaterial * Material )
+{
+    FString Signature = FString::Printf(
+        TEXT( "%d:%d:%d:%d|" ), (int32) Material->BlendMode, (int32) Material->TwoSided,
+        (int32) Material->GetShadingModel(), (int32) Material->bUsedWithInstancedStaticMeshes );
+
+    for ( int32 PropertyIdx = 0; PropertyIdx < MP_MAX; ++PropertyIdx )
+    {
+        FExpressionInput * Input = Material->GetExpressionInputForProperty( (EMaterialProperty) PropertyIdx );
+        if ( Input && Input->Expression )
+            Signature += FString::Printf( TEXT( "%d=%s:%d:%d|" ), PropertyIdx, *Input->Expression->GetName(), Input->OutputIndex, Input->Mask );
+    }
+
+    for ( UMaterialExpression * Expression : Material->Expressions )
+    {
+        if ( Expression )
+            AppendMaterialGraphSignature( Expression, Signature );
+    }
+
+    return FString::Printf( TEXT( "%08x" ), FCrc::StrCrc32( *Signature ) );
+}
+
+/** Calls PostEditChange on all deferred textures, once all their platform data builds have been started. **/
+static void
+FinishPendingTexturePostEditChanges()
+{
+    for ( TWeakObjectPtr< UTexture2D > & Texture : HoudiniMaterialPendingTextures )
+    {
+        if ( Texture.IsValid() && !Texture->IsPendingKill() )
+        {
+            Texture->FinishCachePlatformData();
+            Texture->PostEditChange();
+        }
+    }
+
+    HoudiniMaterialPendingTextures.Empty();
+}
+
+#endif
+
+#if WITH_EDITOR
+
+/** Material instances created from attributes, keyed by parent material and parameter values. **/
+static TMap< FString, TWeakObjectPtr< UMaterialInstanceConstant > > HoudiniMaterialInstanceCache;
+
+/** Builds the cache key of a material instance from its parent and its sorted parameter values. **/
+static FString
+GetMaterialInstanceCacheKey(
+    const UMaterial * ParentMaterial, const TArray< UGenericAttribute > & MaterialParameters, FHoudiniCookParams & CookParams )
+{
+    TArray< FString > ParameterKeys;
+    for ( const UGenericAttribute & MaterialParameter : MaterialParameters )
+    {
+        FString ParameterKey = MaterialParameter.AttributeName.ToLower() + TEXT( "=" );
+        for ( double Value : MaterialParameter.DoubleValues )
+            ParameterKey += FString::Printf( TEXT( "%.17g," ), Value );
+
+        for ( int64 Value : MaterialParameter.IntValues )
+            ParameterKey += LexToString( Value ) + TEXT( "," );
+
+        for ( const FString & Value : MaterialParameter.StringValues )
+        {
+            // Generated textures are looked up in the cook's own packages, so key them by the texture they resolve to.
+            UTexture * GeneratedTexture = FHoudiniEngineMaterialUtils::FindGeneratedTexture( Value, CookParams );
+            ParameterKey += ( GeneratedTexture ? GeneratedTexture->GetPathName() : Value ) + TEXT( "," );
+        }
+
+        ParameterKeys.Add( ParameterKey );
+    }
+
+    ParameterKeys.Sort();
+
+    return ParentMaterial->GetPathName() + TEXT( "|" ) + FString::Join( ParameterKeys, TEXT( "|" ) );
+}
+
+#endif
+
+/** Renders a texture parameter on its material node, unless it is the image currently rendered there. **/
+static bool
+RenderMaterialTextureToImage( HAPI_ParmId NodeParmId, const HAPI_MaterialInfo & MaterialInfo, bool bForceRender )
+{
+    const HAPI_ParmId * RenderedParmId = HoudiniMaterialRenderedImageParms.Find( MaterialInfo.nodeId );
+    if ( !bForceRender && RenderedParmId && *RenderedParmId == NodeParmId )
+        return true;
+
+    HoudiniMaterialRenderedImageParms.Remove( MaterialInfo.nodeId );
+
+    if ( FHoudiniApi::RenderTextureToImage(
+        FHoudiniEngine::Get().GetSession(),
+        MaterialInfo.nodeId, NodeParmId ) != HAPI_RESULT_SUCCESS )
+    {
+        return false;
+    }
+
+    HoudiniMaterialRenderedImageParms.Add( MaterialInfo.nodeId, NodeParmId );
+    return true;
+}
+
 void
 FHoudiniEngineMaterialUtils::HapiCreateMaterials(
     HAPI_NodeId AssetId,
@@ -74,12 +372,18 @@ FHoudiniEngineMaterialUtils::HapiCreateMaterials(
 {
 #if WITH_EDITOR
 
+    SCOPE_CYCLE_COUNTER( STAT_CreateMaterials );
+    FHoudiniCookProfileStageScope ProfileStageScope( EHoudiniCookProfileStage::Materials );
+
     // Empty returned materials.
     Materials.Empty();
 
     if ( UniqueMaterialIds.Num() == 0 )
         return;
 
+    // Images rendered by previous cooks are reused unless we are forced to recook everything.
+    BeginMaterialImageCacheBatch( bForceRecookAll );
+
     // Update context for generated materials (will trigger when object goes out of scope).
     FMaterialUpdateContext MaterialUpdateContext;
 
@@ -91,6 +395,10 @@ FHoudiniEngineMaterialUtils::HapiCreateMaterials(
     UMaterialFactoryNew * MaterialFactory = NewObject< UMaterialFactoryNew >();
     MaterialFactory->AddToRoot();
 
+    // Materials are updated once all their textures are built, with the newly created ones flagged.
+    TArray< TPair< UMaterial *, bool > > MaterialsToUpdate;
+    TArray< FString > MaterialSignatures;
+
     for ( TSet< HAPI_NodeId >::TConstIterator IterMaterialId( UniqueMaterialIds ); IterMaterialId; ++IterMaterialId )
     {
         HAPI_NodeId MaterialId = *IterMaterialId;
@@ -207,19 +515,23 @@ FHoudiniEngineMaterialUtils::HapiCreateMaterials(
             Material->TwoSided = true;
             Material->SetShadingModel( MSM_DefaultLit );
 
-            // Schedule this material for update.
-            MaterialUpdateContext.AddMaterial( Material );
-
             // Cache material.
             Materials.Add( MaterialShopName, Material );
 
-            // Propagate and trigger material updates.
-            if ( bCreatedNewMaterial )
-                FAssetRegistryModule::AssetCreated( Material );
+            // Shaders only depend on the graph, not on the texture content. If the graph is the one we
+            // compiled last time (the material node reported a change that did not affect it), skip the recompile.
+            FString MaterialSignature = GetMaterialGraphSignature( Material );
+            UMetaData * MaterialMetaData = Material->GetOutermost()->GetMetaData();
+            if ( !bCreatedNewMaterial && MaterialMetaData
+                && MaterialMetaData->GetValue( Material, HAPI_UNREAL_PACKAGE_META_GENERATED_MATERIAL_SIGNATURE ) == MaterialSignature )
+            {
+                continue;
+            }
 
-            Material->PreEditChange( nullptr );
-            Material->PostEditChange();
-            Material->MarkPackageDirty();
+            // Schedule this material for update.
+            MaterialUpdateContext.AddMaterial( Material );
+            MaterialsToUpdate.Add( TPair< UMaterial *, bool >( Material, bCreatedNewMaterial ) );
+            MaterialSignatures.Add( MaterialSignature );
         }
         else
         {
@@ -227,6 +539,24 @@ FHoudiniEngineMaterialUtils::HapiCreateMaterials(
         }
     }
 
+    // The platform data of all generated textures is being built in the background, wait for it.
+    FinishPendingTexturePostEditChanges();
+
+    // Propagate and trigger material updates.
+    for ( int32 MaterialIdx = 0; MaterialIdx < MaterialsToUpdate.Num(); ++MaterialIdx )
+    {
+        UMaterial * Material = MaterialsToUpdate[ MaterialIdx ].Key;
+        if ( MaterialsToUpdate[ MaterialIdx ].Value )
+            FAssetRegistryModule::AssetCreated( Material );
+
+        FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
+            Material->GetOutermost(), Material, HAPI_UNREAL_PACKAGE_META_GENERATED_MATERIAL_SIGNATURE, *MaterialSignatures[ MaterialIdx ] );
+
+        Material->PreEditChange( nullptr );
+        Material->PostEditChange();
+        Material->MarkPackageDirty();
+    }
+
     MaterialFactory->RemoveFromRoot();
 
 #endif
@@ -237,18 +567,30 @@ bool
 FHoudiniEngineMaterialUtils::HapiExtractImage(
     HAPI_ParmId NodeParmId, const HAPI_MaterialInfo & MaterialInfo,
     TArray< char > & ImageBuffer, const char * PlaneType, HAPI_ImageDataFormat ImageDataFormat,
-    HAPI_ImagePacking ImagePacking, bool bRenderToImage )
+    HAPI_ImagePacking ImagePacking, bool bRenderToImage, int32 MaxResolution, bool bPowerOfTwo )
 {
-    if ( bRenderToImage )
+    FHoudiniMaterialImageCacheEntry * CacheEntry = FindMaterialImageCacheEntry( NodeParmId, MaterialInfo );
+    FString ImageKey = FString::Printf(
+        TEXT( "%s:%d:%d:%d:%d" ), UTF8_TO_TCHAR( PlaneType ), (int32) ImageDataFormat, (int32) ImagePacking,
+        MaxResolution, bPowerOfTwo ? 1 : 0 );
+
+    if ( CacheEntry )
     {
-        if ( FHoudiniApi::RenderTextureToImage(
-            FHoudiniEngine::Get().GetSession(),
-            MaterialInfo.nodeId, NodeParmId ) != HAPI_RESULT_SUCCESS )
+        if ( const FHoudiniMaterialImageCacheEntry::FImage * CachedImage = CacheEntry->Images.Find( ImageKey ) )
         {
-            return false;
+            ImageBuffer = CachedImage->Buffer;
+            CacheEntry->LastImageInfo = CachedImage->ImageInfo;
+            CacheEntry->bHasLastImageInfo = true;
+            return true;
         }
+
+        CacheEntry->bHasLastImageInfo = false;
     }
 
+    // Planes may have come from the cache, in which case the texture has not been rendered yet.
+    if ( !RenderMaterialTextureToImage( NodeParmId, MaterialInfo, bRenderToImage ) )
+        return false;
+
     HAPI_ImageInfo ImageInfo;
     if ( FHoudiniApi::GetImageInfo(
         FHoudiniEngine::Get().GetSession(),
@@ -261,6 +603,33 @@ FHoudiniEngineMaterialUtils::HapiExtractImage(
     ImageInfo.interleaved = true;
     ImageInfo.packing = ImagePacking;
 
+    // Let Houdini downscale large images, this keeps them from going through the session at full size.
+    int32 LargestResolution = FMath::Max( ImageInfo.xRes, ImageInfo.yRes );
+    if ( MaxResolution > 0 && LargestResolution > MaxResolution )
+    {
+        float Scale = (float) MaxResolution / (float) LargestResolution;
+        ImageInfo.xRes = FMath::Max( 1, FMath::RoundToInt( ImageInfo.xRes * Scale ) );
+        ImageInfo.yRes = FMath::Max( 1, FMath::RoundToInt( ImageInfo.yRes * Scale ) );
+    }
+
+    // Non power of two textures get neither mips nor streaming, have Houdini resample to the nearest power of two.
+    if ( bPowerOfTwo )
+    {
+        auto NearestPowerOfTwo = [ MaxResolution ]( int32 Resolution )
+        {
+            int32 Upper = (int32) FMath::RoundUpToPowerOfTwo( (uint32) Resolution );
+            int32 Lower = Upper > Resolution ? Upper / 2 : Upper;
+            int32 Nearest = ( Upper - Resolution < Resolution - Lower ) ? Upper : Lower;
+            if ( MaxResolution > 0 && Nearest > MaxResolution )
+                Nearest = Lower;
+
+            return FMath::Max( 1, Nearest );
+        };
+
+        ImageInfo.xRes = NearestPowerOfTwo( ImageInfo.xRes );
+        ImageInfo.yRes = NearestPowerOfTwo( ImageInfo.yRes );
+    }
+
     if ( FHoudiniApi::SetImageInfo(
         FHoudiniEngine::Get().GetSession(),
         MaterialInfo.nodeId, &ImageInfo) != HAPI_RESULT_SUCCESS )
@@ -290,9 +659,44 @@ FHoudiniEngineMaterialUtils::HapiExtractImage(
         return false;
     }
 
+    if ( CacheEntry )
+    {
+        FHoudiniMaterialImageCacheEntry::FImage & CachedImage = CacheEntry->Images.Add( ImageKey );
+        if ( FHoudiniApi::GetImageInfo(
+            FHoudiniEngine::Get().GetSession(),
+            MaterialInfo.nodeId, &CachedImage.ImageInfo ) != HAPI_RESULT_SUCCESS )
+        {
+            CacheEntry->Images.Remove( ImageKey );
+            return true;
+        }
+
+        CachedImage.Buffer = ImageBuffer;
+        CacheEntry->LastImageInfo = CachedImage.ImageInfo;
+        CacheEntry->bHasLastImageInfo = true;
+        CacheEntry->Size += ImageBufferSize;
+        HoudiniMaterialImageCacheSize += ImageBufferSize;
+    }
+
     return true;
 }
 
+HAPI_Result
+FHoudiniEngineMaterialUtils::HapiGetImageInfo(
+    HAPI_ParmId NodeParmId, const HAPI_MaterialInfo & MaterialInfo, HAPI_ImageInfo & ImageInfo )
+{
+    // Cached images may not be the one currently rendered on the material node.
+    FHoudiniMaterialImageCacheEntry * CacheEntry = FindMaterialImageCacheEntry( NodeParmId, MaterialInfo );
+    if ( CacheEntry && CacheEntry->bHasLastImageInfo )
+    {
+        ImageInfo = CacheEntry->LastImageInfo;
+        return HAPI_RESULT_SUCCESS;
+    }
+
+    return FHoudiniApi::GetImageInfo(
+        FHoudiniEngine::Get().GetSession(),
+        MaterialInfo.nodeId, &ImageInfo );
+}
+
 bool
 FHoudiniEngineMaterialUtils::HapiGetImagePlanes(
     HAPI_ParmId NodeParmId, const HAPI_MaterialInfo & MaterialInfo,
@@ -301,13 +705,16 @@ FHoudiniEngineMaterialUtils::HapiGetImagePlanes(
     ImagePlanes.Empty();
     int32 ImagePlaneCount = 0;
 
-    if ( FHoudiniApi::RenderTextureToImage(
-        FHoudiniEngine::Get().GetSession(),
-        MaterialInfo.nodeId, NodeParmId ) != HAPI_RESULT_SUCCESS )
+    FHoudiniMaterialImageCacheEntry * CacheEntry = FindMaterialImageCacheEntry( NodeParmId, MaterialInfo );
+    if ( CacheEntry && CacheEntry->bHasImagePlanes )
     {
-        return false;
+        ImagePlanes = CacheEntry->ImagePlanes;
+        return true;
     }
 
+    if ( !RenderMaterialTextureToImage( NodeParmId, MaterialInfo, true ) )
+        return false;
+
     if ( FHoudiniApi::GetImagePlaneCount(
         FHoudiniEngine::Get().GetSession(),
         MaterialInfo.nodeId, &ImagePlaneCount ) != HAPI_RESULT_SUCCESS )
@@ -316,7 +723,12 @@ FHoudiniEngineMaterialUtils::HapiGetImagePlanes(
     }
 
     if ( !ImagePlaneCount )
+    {
+        if ( CacheEntry )
+            CacheEntry->bHasImagePlanes = true;
+
         return true;
+    }
 
     TArray< HAPI_StringHandle > ImagePlaneStringHandles;
     ImagePlaneStringHandles.SetNumUninitialized( ImagePlaneCount );
@@ -336,6 +748,12 @@ FHoudiniEngineMaterialUtils::HapiGetImagePlanes(
         ImagePlanes.Add( ValueString );
     }
 
+    if ( CacheEntry )
+    {
+        CacheEntry->ImagePlanes = ImagePlanes;
+        CacheEntry->bHasImagePlanes = true;
+    }
+
     return true;
 }
 
@@ -500,16 +918,16 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentDiffuse(
         // Retrieve color plane.
         if ( bFoundImagePlanes && FHoudiniEngineMaterialUtils::HapiExtractImage(
             ParmDiffuseTextureId, MaterialInfo, ImageBuffer, PlaneType,
-            HAPI_IMAGE_DATA_INT8, ImagePacking, false ) )
+            HAPI_IMAGE_DATA_INT8, ImagePacking, false,
+            GetDefault< UHoudiniRuntimeSettings >()->MarshallingTextureMaxResolution,
+            GetDefault< UHoudiniRuntimeSettings >()->MarshallingTextureStreamingMips ) )
         {
             UPackage * TextureDiffusePackage = nullptr;
             if ( TextureDiffuse && !TextureDiffuse->IsPendingKill() )
                 TextureDiffusePackage = Cast< UPackage >( TextureDiffuse->GetOuter() );
 
             HAPI_ImageInfo ImageInfo;
-            Result = FHoudiniApi::GetImageInfo(
-                FHoudiniEngine::Get().GetSession(),
-                MaterialInfo.nodeId, &ImageInfo );
+            Result = FHoudiniEngineMaterialUtils::HapiGetImageInfo( ParmDiffuseTextureId, MaterialInfo, ImageInfo );
 
             if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
             {
@@ -566,7 +984,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentDiffuse(
                     FAssetRegistryModule::AssetCreated( TextureDiffuse );
 
                 TextureDiffuse->PreEditChange( nullptr );
-                TextureDiffuse->PostEditChange();
+                DeferTexturePostEditChange( TextureDiffuse );
                 TextureDiffuse->MarkPackageDirty();
             }
         }
@@ -745,7 +1163,9 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentOpacityMask(
 
         if ( bFoundImagePlanes && FHoudiniEngineMaterialUtils::HapiExtractImage(
             ParmOpacityTextureId, MaterialInfo, ImageBuffer, PlaneType,
-            HAPI_IMAGE_DATA_INT8, ImagePacking, false ) )
+            HAPI_IMAGE_DATA_INT8, ImagePacking, false,
+            GetDefault< UHoudiniRuntimeSettings >()->MarshallingTextureMaxResolution,
+            GetDefault< UHoudiniRuntimeSettings >()->MarshallingTextureStreamingMips ) )
         {
             // Locate sampling expression.
             ExpressionTextureOpacitySample = Cast< UMaterialExpressionTextureSampleParameter2D >(
@@ -761,9 +1181,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentOpacityMask(
                 TextureOpacityPackage = Cast< UPackage >( TextureOpacity->GetOuter() );
 
             HAPI_ImageInfo ImageInfo;
-            Result = FHoudiniApi::GetImageInfo(
-                FHoudiniEngine::Get().GetSession(),
-                MaterialInfo.nodeId, &ImageInfo );
+            Result = FHoudiniEngineMaterialUtils::HapiGetImageInfo( ParmOpacityTextureId, MaterialInfo, ImageInfo );
 
             if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
             {
@@ -840,7 +1258,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentOpacityMask(
                     FAssetRegistryModule::AssetCreated( TextureOpacity );
 
                 TextureOpacity->PreEditChange( nullptr );
-                TextureOpacity->PostEditChange();
+                DeferTexturePostEditChange( TextureOpacity );
                 TextureOpacity->MarkPackageDirty();
 
                 bExpressionCreated = true;
@@ -1112,7 +1530,9 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentNormal(
         // Retrieve color plane.
         if (FHoudiniEngineMaterialUtils::HapiExtractImage(
             ParmNameNormalId, MaterialInfo, ImageBuffer,
-            HAPI_UNREAL_MATERIAL_TEXTURE_COLOR, HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true ) )
+            HAPI_UNREAL_MATERIAL_TEXTURE_COLOR, HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true,
+            GetDefault< UHoudiniRuntimeSettings >()->MarshallingDataTextureMaxResolution,
+            GetDefault< UHoudiniRuntimeSettings >()->MarshallingDataTextureStreamingMips ) )
         {
             UMaterialExpressionTextureSampleParameter2D * ExpressionNormal =
                 Cast< UMaterialExpressionTextureSampleParameter2D >( Material->Normal.Expression );
@@ -1137,9 +1557,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentNormal(
                 TextureNormalPackage = Cast< UPackage >( TextureNormal->GetOuter() );
 
             HAPI_ImageInfo ImageInfo;
-            Result = FHoudiniApi::GetImageInfo(
-                FHoudiniEngine::Get().GetSession(),
-                MaterialInfo.nodeId, &ImageInfo );
+            Result = FHoudiniEngineMaterialUtils::HapiGetImageInfo( ParmNameNormalId, MaterialInfo, ImageInfo );
 
             if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
             {
@@ -1209,7 +1627,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentNormal(
                     FAssetRegistryModule::AssetCreated(TextureNormal);
 
                 TextureNormal->PreEditChange(nullptr);
-                TextureNormal->PostEditChange();
+                DeferTexturePostEditChange( TextureNormal );
                 TextureNormal->MarkPackageDirty();
             }
         }
@@ -1244,7 +1662,9 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentNormal(
             // Retrieve color plane - this will contain normal data.
             if ( FHoudiniEngineMaterialUtils::HapiExtractImage(
                 ParmNameBaseId, MaterialInfo, ImageBuffer,
-                HAPI_UNREAL_MATERIAL_TEXTURE_NORMAL, HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGB, true ) )
+                HAPI_UNREAL_MATERIAL_TEXTURE_NORMAL, HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGB, true,
+                GetDefault< UHoudiniRuntimeSettings >()->MarshallingDataTextureMaxResolution,
+                GetDefault< UHoudiniRuntimeSettings >()->MarshallingDataTextureStreamingMips ) )
             {
                 UMaterialExpressionTextureSampleParameter2D * ExpressionNormal =
                     Cast< UMaterialExpressionTextureSampleParameter2D >( Material->Normal.Expression );
@@ -1269,9 +1689,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentNormal(
                     TextureNormalPackage = Cast< UPackage >( TextureNormal->GetOuter() );
 
                 HAPI_ImageInfo ImageInfo;
-                Result = FHoudiniApi::GetImageInfo(
-                    FHoudiniEngine::Get().GetSession(),
-                    MaterialInfo.nodeId, &ImageInfo );
+                Result = FHoudiniEngineMaterialUtils::HapiGetImageInfo( ParmNameBaseId, MaterialInfo, ImageInfo );
 
                 if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
                 {
@@ -1336,7 +1754,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentNormal(
                         FAssetRegistryModule::AssetCreated( TextureNormal );
 
                     TextureNormal->PreEditChange( nullptr );
-                    TextureNormal->PostEditChange();
+                    DeferTexturePostEditChange( TextureNormal );
                     TextureNormal->MarkPackageDirty();
 
                     bExpressionCreated = true;
@@ -1395,7 +1813,9 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentSpecular(
         // Retrieve color plane.
         if ( FHoudiniEngineMaterialUtils::HapiExtractImage(
             ParmNameSpecularId, MaterialInfo, ImageBuffer,
-            HAPI_UNREAL_MATERIAL_TEXTURE_COLOR, HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true ) )
+            HAPI_UNREAL_MATERIAL_TEXTURE_COLOR, HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true,
+            GetDefault< UHoudiniRuntimeSettings >()->MarshallingDataTextureMaxResolution,
+            GetDefault< UHoudiniRuntimeSettings >()->MarshallingDataTextureStreamingMips ) )
         {
             UMaterialExpressionTextureSampleParameter2D * ExpressionSpecular =
                 Cast< UMaterialExpressionTextureSampleParameter2D >( Material->Specular.Expression );
@@ -1420,9 +1840,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentSpecular(
                 TextureSpecularPackage = Cast< UPackage >( TextureSpecular->GetOuter() );
 
             HAPI_ImageInfo ImageInfo;
-            Result = FHoudiniApi::GetImageInfo(
-                FHoudiniEngine::Get().GetSession(),
-                MaterialInfo.nodeId, &ImageInfo );
+            Result = FHoudiniEngineMaterialUtils::HapiGetImageInfo( ParmNameSpecularId, MaterialInfo, ImageInfo );
 
             if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
             {
@@ -1489,7 +1907,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentSpecular(
                     FAssetRegistryModule::AssetCreated(TextureSpecular);
 
                 TextureSpecular->PreEditChange(nullptr);
-                TextureSpecular->PostEditChange();
+                DeferTexturePostEditChange( TextureSpecular );
                 TextureSpecular->MarkPackageDirty();
             }
         }
@@ -1611,7 +2029,9 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentRoughness(
         // Retrieve color plane.
         if ( FHoudiniEngineMaterialUtils::HapiExtractImage(
             ParmNameRoughnessId, MaterialInfo, ImageBuffer,
-            HAPI_UNREAL_MATERIAL_TEXTURE_COLOR, HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true ) )
+            HAPI_UNREAL_MATERIAL_TEXTURE_COLOR, HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true,
+            GetDefault< UHoudiniRuntimeSettings >()->MarshallingDataTextureMaxResolution,
+            GetDefault< UHoudiniRuntimeSettings >()->MarshallingDataTextureStreamingMips ) )
         {
             UMaterialExpressionTextureSampleParameter2D* ExpressionRoughness =
                 Cast< UMaterialExpressionTextureSampleParameter2D >( Material->Roughness.Expression );
@@ -1636,9 +2056,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentRoughness(
                 TextureRoughnessPackage = Cast< UPackage >( TextureRoughness->GetOuter() );
 
             HAPI_ImageInfo ImageInfo;
-            Result = FHoudiniApi::GetImageInfo(
-                FHoudiniEngine::Get().GetSession(),
-                MaterialInfo.nodeId, &ImageInfo );
+            Result = FHoudiniEngineMaterialUtils::HapiGetImageInfo( ParmNameRoughnessId, MaterialInfo, ImageInfo );
 
             if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
             {
@@ -1703,7 +2121,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentRoughness(
                     FAssetRegistryModule::AssetCreated(TextureRoughness);
 
                 TextureRoughness->PreEditChange(nullptr);
-                TextureRoughness->PostEditChange();
+                DeferTexturePostEditChange( TextureRoughness );
                 TextureRoughness->MarkPackageDirty();
             }
         }
@@ -1819,7 +2237,9 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentMetallic(
         // Retrieve color plane.
         if ( FHoudiniEngineMaterialUtils::HapiExtractImage(
             ParmNameMetallicId, MaterialInfo, ImageBuffer,
-            HAPI_UNREAL_MATERIAL_TEXTURE_COLOR, HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true ) )
+            HAPI_UNREAL_MATERIAL_TEXTURE_COLOR, HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true,
+            GetDefault< UHoudiniRuntimeSettings >()->MarshallingDataTextureMaxResolution,
+            GetDefault< UHoudiniRuntimeSettings >()->MarshallingDataTextureStreamingMips ) )
         {
             UMaterialExpressionTextureSampleParameter2D * ExpressionMetallic =
                 Cast< UMaterialExpressionTextureSampleParameter2D >( Material->Metallic.Expression );
@@ -1844,9 +2264,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentMetallic(
                 TextureMetallicPackage = Cast< UPackage >( TextureMetallic->GetOuter() );
 
             HAPI_ImageInfo ImageInfo;
-            Result = FHoudiniApi::GetImageInfo(
-                FHoudiniEngine::Get().GetSession(),
-                MaterialInfo.nodeId, &ImageInfo );
+            Result = FHoudiniEngineMaterialUtils::HapiGetImageInfo( ParmNameMetallicId, MaterialInfo, ImageInfo );
 
             if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
             {
@@ -1911,7 +2329,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentMetallic(
                     FAssetRegistryModule::AssetCreated(TextureMetallic);
 
                 TextureMetallic->PreEditChange(nullptr);
-                TextureMetallic->PostEditChange();
+                DeferTexturePostEditChange( TextureMetallic );
                 TextureMetallic->MarkPackageDirty();
             }
         }
@@ -2018,7 +2436,9 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentEmissive(
         // Retrieve color plane.
         if ( FHoudiniEngineMaterialUtils::HapiExtractImage(
             ParmNameEmissiveId, MaterialInfo, ImageBuffer,
-            HAPI_UNREAL_MATERIAL_TEXTURE_COLOR, HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true ) )
+            HAPI_UNREAL_MATERIAL_TEXTURE_COLOR, HAPI_IMAGE_DATA_INT8, HAPI_IMAGE_PACKING_RGBA, true,
+            GetDefault< UHoudiniRuntimeSettings >()->MarshallingTextureMaxResolution,
+            GetDefault< UHoudiniRuntimeSettings >()->MarshallingTextureStreamingMips ) )
         {
             UMaterialExpressionTextureSampleParameter2D * ExpressionEmissive =
                 Cast< UMaterialExpressionTextureSampleParameter2D >( Material->EmissiveColor.Expression );
@@ -2043,9 +2463,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentEmissive(
                 TextureEmissivePackage = Cast< UPackage >( TextureEmissive->GetOuter() );
 
             HAPI_ImageInfo ImageInfo;
-            Result = FHoudiniApi::GetImageInfo(
-                FHoudiniEngine::Get().GetSession(),
-                MaterialInfo.nodeId, &ImageInfo );
+            Result = FHoudiniEngineMaterialUtils::HapiGetImageInfo( ParmNameEmissiveId, MaterialInfo, ImageInfo );
 
             if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
             {
@@ -2110,7 +2528,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentEmissive(
                     FAssetRegistryModule::AssetCreated(TextureEmissive);
 
                 TextureEmissive->PreEditChange(nullptr);
-                TextureEmissive->PostEditChange();
+                DeferTexturePostEditChange( TextureEmissive );
                 TextureEmissive->MarkPackageDirty();
             }
         }
@@ -2223,51 +2641,43 @@ FHoudiniEngineMaterialUtils::CreateUnrealTexture(
     // Lock the texture.
     uint8 * MipData = Texture->Source.LockMip( 0 );
 
-    // Create base map.
-    uint8* DestPtr = nullptr;
+    // Create base map. Rows are independent, so convert them in parallel and
+    // look for an actual alpha value in the same pass.
     uint32 SrcWidth = ImageInfo.xRes;
     uint32 SrcHeight = ImageInfo.yRes;
     const char * SrcData = &ImageBuffer[ 0 ];
+    const bool bUseAlpha = TextureParameters.bUseAlpha;
 
-    for ( uint32 y = 0; y < SrcHeight; y++ )
+    FThreadSafeBool bFoundAlphaValue( false );
+    ParallelFor( SrcHeight, [&]( int32 y )
     {
-        DestPtr = &MipData[ ( SrcHeight - 1 - y ) * SrcWidth * sizeof( FColor ) ];
+        uint8 * DestPtr = &MipData[ ( SrcHeight - 1 - y ) * SrcWidth * sizeof( FColor ) ];
+        const uint8 * SrcPtr = (const uint8 *)( SrcData + y * SrcWidth * 4 );
 
-        for ( uint32 x = 0; x < SrcWidth; x++ )
+        uint8 RowAlpha = 0xFF;
+        for ( uint32 x = 0; x < SrcWidth; x++, SrcPtr += 4 )
         {
-            uint32 DataOffset = y * SrcWidth * 4 + x * 4;
-
-            *DestPtr++ = *(uint8*)( SrcData + DataOffset + 2 ); // B
-            *DestPtr++ = *(uint8*)( SrcData + DataOffset + 1 ); // G
-            *DestPtr++ = *(uint8*)( SrcData + DataOffset + 0 ); // R
+            *DestPtr++ = SrcPtr[ 2 ]; // B
+            *DestPtr++ = SrcPtr[ 1 ]; // G
+            *DestPtr++ = SrcPtr[ 0 ]; // R
 
-            if ( TextureParameters.bUseAlpha )
-                *DestPtr++ = *(uint8*)( SrcData + DataOffset + 3 ); // A
+            if ( bUseAlpha )
+            {
+                *DestPtr++ = SrcPtr[ 3 ]; // A
+                RowAlpha &= SrcPtr[ 3 ];
+            }
             else
+            {
                 *DestPtr++ = 0xFF;
+            }
         }
-    }
 
-    bool bHasAlphaValue = false;
-    if ( TextureParameters.bUseAlpha )
-    {
-        // See if there is an actual alpha value in the texture or if we can ignore the texture alpha
-        for ( uint32 y = 0; y < SrcHeight; y++ )
-        {
-            for ( uint32 x = 0; x < SrcWidth; x++ )
-            {
-                uint32 DataOffset = y * SrcWidth * 4 + x * 4;
-                if (*(uint8*)(SrcData + DataOffset + 3) != 0xFF)
-                {
-                    bHasAlphaValue = true;
-                    break;
-                }
-            }
+        if ( RowAlpha != 0xFF )
+            bFoundAlphaValue = true;
 
-            if ( bHasAlphaValue )
-                break;
-        }
-    }
+    }, SrcWidth * SrcHeight < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
+
+    bool bHasAlphaValue = bFoundAlphaValue;
 
     // Unlock the texture.
     Texture->Source.UnlockMip( 0 );
@@ -2278,6 +2688,21 @@ FHoudiniEngineMaterialUtils::CreateUnrealTexture(
     Texture->CompressionNoAlpha = !bHasAlphaValue;
     Texture->DeferCompression = TextureParameters.bDeferCompression;
 
+    // Let power of two textures generate a mip chain and stream it, if enabled for this texture role.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    bool bIsColorTexture = TextureType == HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE
+        || TextureType == HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK
+        || TextureType == HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE;
+    bool bStreamingMips = bIsColorTexture
+        ? HoudiniRuntimeSettings->MarshallingTextureStreamingMips
+        : HoudiniRuntimeSettings->MarshallingDataTextureStreamingMips;
+
+    if ( bStreamingMips && FMath::IsPowerOfTwo( SrcWidth ) && FMath::IsPowerOfTwo( SrcHeight ) )
+    {
+        Texture->MipGenSettings = TMGS_FromTextureGroup;
+        Texture->NeverStream = false;
+    }
+
     // Set the Source Guid/Hash if specified.
     /*
     if ( TextureParameters.SourceGuidHash.IsValid() )
@@ -2286,7 +2711,8 @@ FHoudiniEngineMaterialUtils::CreateUnrealTexture(
     }
     */
 
-    Texture->PostEditChange();
+    // Start building the platform data in the background, the caller triggers PostEditChange.
+    Texture->BeginCachePlatformData();
 
     return Texture;
 }
@@ -2469,9 +2895,27 @@ FHoudiniEngineMaterialUtils::CreateMaterialInstances(
     if ( !ParentMaterial ||ParentMaterial->IsPendingKill() )
         return false;
 
-    // Create/Retrieve the package for the MI
+    // See if we need to override some of the material instance's parameters
+    TArray< UGenericAttribute > AllMatParams;
+    // Get the detail material parameters
+    int ParamCount = FHoudiniEngineUtils::GetGenericAttributeList( HoudiniGeoPartObject, HAPI_UNREAL_ATTRIB_GENERIC_MAT_PARAM_PREFIX, AllMatParams, HAPI_ATTROWNER_DETAIL );
+    // Then the primitive material parameters
+    ParamCount += FHoudiniEngineUtils::GetGenericAttributeList( HoudiniGeoPartObject, HAPI_UNREAL_ATTRIB_GENERIC_MAT_PARAM_PREFIX, AllMatParams, HAPI_ATTROWNER_PRIM, MaterialIndexToAttributeIndex );
+
+    // Instances with the same parent and parameter values are shared, by all components.
+    FString MaterialInstanceKey = GetMaterialInstanceCacheKey( ParentMaterial, AllMatParams, CookParams );
+    TWeakObjectPtr< UMaterialInstanceConstant > * CachedMaterialInstance = HoudiniMaterialInstanceCache.Find( MaterialInstanceKey );
+    if ( CachedMaterialInstance && CachedMaterialInstance->IsValid() && !( *CachedMaterialInstance )->IsPendingKill()
+        && ( *CachedMaterialInstance )->Parent == ParentMaterial )
+    {
+        CreatedMaterialInstance = CachedMaterialInstance->Get();
+        return true;
+    }
+
+    // Create/Retrieve the package for the MI, named after its parameters so different parameter sets do not overwrite each other.
     FString MaterialInstanceName;
-    FString MaterialInstanceNamePrefix = UPackageTools::SanitizePackageName( ParentMaterial->GetName() + TEXT("_instance_") + FString::FromInt(MaterialIndex) );
+    FString MaterialInstanceNamePrefix = UPackageTools::SanitizePackageName(
+        ParentMaterial->GetName() + TEXT( "_instance_" ) + FString::Printf( TEXT( "%08x" ), FCrc::StrCrc32( *MaterialInstanceKey ) ) );
     
     // See if we can find the package in the cooked temp package cache
     UPackage * MaterialInstancePackage = nullptr;
@@ -2541,12 +2985,6 @@ FHoudiniEngineMaterialUtils::CreateMaterialInstances(
     FMaterialUpdateContext MaterialUpdateContext;
 
     bool bModifiedMaterialParameters = false;
-    // See if we need to override some of the material instance's parameters
-    TArray< UGenericAttribute > AllMatParams;
-    // Get the detail material parameters
-    int ParamCount = FHoudiniEngineUtils::GetGenericAttributeList( HoudiniGeoPartObject, HAPI_UNREAL_ATTRIB_GENERIC_MAT_PARAM_PREFIX, AllMatParams, HAPI_ATTROWNER_DETAIL );
-    // Then the primitive material parameters
-    ParamCount += FHoudiniEngineUtils::GetGenericAttributeList( HoudiniGeoPartObject, HAPI_UNREAL_ATTRIB_GENERIC_MAT_PARAM_PREFIX, AllMatParams, HAPI_ATTROWNER_PRIM, MaterialIndexToAttributeIndex );
     for ( int32 ParamIdx = 0; ParamIdx < AllMatParams.Num(); ParamIdx++ )
     {
         // Try to update the material instance parameter corresponding to the attribute
@@ -2591,6 +3029,7 @@ FHoudiniEngineMaterialUtils::CreateMaterialInstances(
 
     // Update the return pointers
     CreatedMaterialInstance = NewMaterialInstance;
+    HoudiniMaterialInstanceCache.Add( MaterialInstanceKey, NewMaterialInstance );
 
     return true;
 #else
@@ -2864,15 +3303,45 @@ FHoudiniEngineMaterialUtils::UpdateMaterialInstanceParameter( UGenericAttribute
     return false;
 }
 
-UTexture*
-FHoudiniEngineMaterialUtils::FindGeneratedTexture( const FString& TextureString, FHoudiniCookParams& CookParams )
-{    
-    if ( TextureString.IsEmpty() )
-        return nullptr;
+/** Generated textures of a set of cooked temporary packages, keyed by every string that can refer to them. **/
+struct FHoudiniGeneratedTextureIndex
+{
+    /** Hash of the packages the index was built from, used to detect changes. **/
+    uint32 PackagesHash = 0;
+    int32 PackageCount = -1;
 
-    // Try to find the corresponding texture in the cooked temporary package generated by an HDA
-    UTexture* FoundTexture = nullptr;
-    for ( TMap<FString, TWeakObjectPtr< UPackage > >::TIterator IterPackage( *(CookParams.CookedTemporaryPackages) ); IterPackage; ++IterPackage )
+    /** Lower case reference strings to textures. **/
+    TMap< FString, TWeakObjectPtr< UTexture > > Textures;
+};
+
+/** Texture indices, keyed by the cooked temporary packages they were built from. **/
+static TMap< const void *, FHoudiniGeneratedTextureIndex > HoudiniGeneratedTextureIndices;
+
+/** Returns the texture index of cooked temporary packages, rebuilding it if they changed since. **/
+static FHoudiniGeneratedTextureIndex &
+GetGeneratedTextureIndex( TMap< FString, TWeakObjectPtr< UPackage > > & CookedTemporaryPackages )
+{
+    uint32 PackagesHash = 0;
+    for ( TMap< FString, TWeakObjectPtr< UPackage > >::TIterator IterPackage( CookedTemporaryPackages ); IterPackage; ++IterPackage )
+        PackagesHash = HashCombine( PackagesHash, HashCombine( GetTypeHash( IterPackage.Key() ), PointerHash( IterPackage.Value().Get() ) ) );
+
+    FHoudiniGeneratedTextureIndex & Index = HoudiniGeneratedTextureIndices.FindOrAdd( &CookedTemporaryPackages );
+    if ( Index.PackageCount == CookedTemporaryPackages.Num() && Index.PackagesHash == PackagesHash )
+        return Index;
+
+    Index.PackagesHash = PackagesHash;
+    Index.PackageCount = CookedTemporaryPackages.Num();
+    Index.Textures.Empty();
+
+    // Packages are indexed in iteration order and earlier ones win, like the linear search used to.
+    auto AddReference = [ &Index ]( const FString & Reference, UTexture * Texture )
+    {
+        FString Key = Reference.ToLower();
+        if ( !Index.Textures.Contains( Key ) )
+            Index.Textures.Add( Key, Texture );
+    };
+
+    for ( TMap< FString, TWeakObjectPtr< UPackage > >::TIterator IterPackage( CookedTemporaryPackages ); IterPackage; ++IterPackage )
     {
         // Iterate through the cooked packages
         UPackage * CurrentPackage = IterPackage.Value().Get();
@@ -2894,11 +3363,7 @@ FHoudiniEngineMaterialUtils::FindGeneratedTexture( const FString& TextureString,
         // Get the texture type from the meta data
         // Texture type store has meta data will be C_A, N, S, R etc..
         const FString TextureTypeString = MetaData->GetValue( PackageTexture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_TYPE );
-        if ( TextureTypeString.Compare( TextureString, ESearchCase::IgnoreCase ) == 0 )
-        {
-            FoundTexture = PackageTexture;
-            break;
-        }
+        AddReference( TextureTypeString, PackageTexture );
 
         // Convert the texture type to a "friendly" version
         // C_A to diffuse, N to Normal, S to Specular etc...
@@ -2920,48 +3385,53 @@ FHoudiniEngineMaterialUtils::FindGeneratedTexture( const FString& TextureString,
         else if ( TextureTypeString.Compare( HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC, ESearchCase::IgnoreCase) == 0 )
             TextureTypeFriendlyString = TEXT( "metallic" );
         else if ( TextureTypeString.Compare( HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK, ESearchCase::IgnoreCase) == 0 )
-            TextureTypeFriendlyString = TEXT( "opacity" );        
+            TextureTypeFriendlyString = TEXT( "opacity" );
 
-        // See if we have a match between the texture string and the friendly name
-        if ( ( TextureTypeFriendlyString.Compare( TextureString, ESearchCase::IgnoreCase ) == 0 )
-            || ( !TextureTypeFriendlyAlternateString.IsEmpty() && TextureTypeFriendlyAlternateString.Compare( TextureString, ESearchCase::IgnoreCase ) == 0 ) )
-        {
-            FoundTexture = PackageTexture;
-            break;
-        }
+        // The friendly names
+        AddReference( TextureTypeFriendlyString, PackageTexture );
+        if ( !TextureTypeFriendlyAlternateString.IsEmpty() )
+            AddReference( TextureTypeFriendlyAlternateString, PackageTexture );
 
         // Get the node path from the meta data
         const FString NodePath = MetaData->GetValue( PackageTexture, HAPI_UNREAL_PACKAGE_META_NODE_PATH );
         if ( NodePath.IsEmpty() )
             continue;
 
-        // See if we have a match with the path and texture type
-        FString PathAndType = NodePath + TEXT("/") + TextureTypeString;
-        if ( PathAndType.Compare( TextureString, ESearchCase::IgnoreCase ) == 0 )
-        {
-            FoundTexture = PackageTexture;
-            break;
-        }
+        // The path and texture type, friendly or not
+        AddReference( NodePath + TEXT( "/" ) + TextureTypeString, PackageTexture );
+        AddReference( NodePath + TEXT( "/" ) + TextureTypeFriendlyString, PackageTexture );
+        if ( !TextureTypeFriendlyAlternateString.IsEmpty() )
+            AddReference( NodePath + TEXT( "/" ) + TextureTypeFriendlyAlternateString, PackageTexture );
+    }
 
-        // See if we have a match with the friendly path and texture type
-        FString PathAndFriendlyType = NodePath + TEXT("/") + TextureTypeFriendlyString;
-        if ( PathAndFriendlyType.Compare( TextureString, ESearchCase::IgnoreCase ) == 0 )
-        {
-            FoundTexture = PackageTexture;
-            break;
-        }
+    return Index;
+}
 
-        // Try the alternate friendly string
-        if ( !TextureTypeFriendlyAlternateString.IsEmpty() )
-        {
-            PathAndFriendlyType = NodePath + TEXT("/") + TextureTypeFriendlyAlternateString;
-            if ( PathAndFriendlyType.Compare( TextureString, ESearchCase::IgnoreCase ) == 0 )
-            {
-                FoundTexture = PackageTexture;
-                break;
-            }
-        }
+UTexture*
+FHoudiniEngineMaterialUtils::FindGeneratedTexture( const FString& TextureString, FHoudiniCookParams& CookParams )
+{    
+    if ( TextureString.IsEmpty() || !CookParams.CookedTemporaryPackages )
+        return nullptr;
+
+    // Try to find the corresponding texture in the cooked temporary package generated by an HDA
+    FString TextureKey = TextureString.ToLower();
+    FHoudiniGeneratedTextureIndex & Index = GetGeneratedTextureIndex( *CookParams.CookedTemporaryPackages );
+    TWeakObjectPtr< UTexture > * FoundTexture = Index.Textures.Find( TextureKey );
+    if ( FoundTexture && ( !FoundTexture->IsValid() || ( *FoundTexture )->IsPendingKill() ) )
+    {
+        // The texture was replaced in its package, rebuild the index.
+        FHoudiniEngineMaterialUtils::InvalidateGeneratedTextureIndex( *CookParams.CookedTemporaryPackages );
+        FoundTexture = GetGeneratedTextureIndex( *CookParams.CookedTemporaryPackages ).Textures.Find( TextureKey );
     }
 
-    return FoundTexture;
+    if ( !FoundTexture || !FoundTexture->IsValid() )
+        return nullptr;
+
+    return FoundTexture->Get();
+}
+
+void
+FHoudiniEngineMaterialUtils::InvalidateGeneratedTextureIndex( const TMap< FString, TWeakObjectPtr< UPackage > > & CookedTemporaryPackages )
+{
+    HoudiniGeneratedTextureIndices.Remove( &CookedTemporaryPackages );
 }
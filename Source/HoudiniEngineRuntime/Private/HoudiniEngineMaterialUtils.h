@@ -48,11 +48,16 @@ public:
         HAPI_ParmId NodeParmId, const HAPI_MaterialInfo & MaterialInfo,
         TArray< FString > & ImagePlanes );
 
-    /** HAPI : Extract image data. **/
+    /** HAPI : Extract image data, downscaled so neither side exceeds MaxResolution (if not 0) and **/
+    /** optionally resampled to the nearest power of two resolution so it can be mipmapped and streamed. **/
     static bool HapiExtractImage(
         HAPI_ParmId NodeParmId, const HAPI_MaterialInfo & MaterialInfo,
         TArray< char > & ImageBuffer, const char * PlaneType, HAPI_ImageDataFormat ImageDataFormat,
-        HAPI_ImagePacking ImagePacking, bool bRenderToImage );
+        HAPI_ImagePacking ImagePacking, bool bRenderToImage, int32 MaxResolution = 0, bool bPowerOfTwo = false );
+
+    /** HAPI : Retrieve image info of the image last extracted for given texture parameter. **/
+    static HAPI_Result HapiGetImageInfo(
+        HAPI_ParmId NodeParmId, const HAPI_MaterialInfo & MaterialInfo, HAPI_ImageInfo & ImageInfo );
         
     /** HAPI : Get unique material SHOP name. **/
     static bool GetUniqueMaterialShopName( HAPI_NodeId AssetId, HAPI_NodeId MaterialId, FString & Name );
@@ -72,9 +77,12 @@ public:
     /** Try to find a texture generated by HoudiniEngine that matches the texture string **/
     static UTexture* FindGeneratedTexture( const FString& TextureString, FHoudiniCookParams& CookParams );
 
+    /** Drop the generated texture index of given cooked temporary packages, it is rebuilt on the next lookup. **/
+    static void InvalidateGeneratedTextureIndex( const TMap< FString, TWeakObjectPtr< UPackage > > & CookedTemporaryPackages );
+
 #if WITH_EDITOR
 
-    /** Create a texture from given information. **/
+    /** Create a texture from given information, its platform data is built in the background until PostEditChange. **/
     static UTexture2D * CreateUnrealTexture(
         UTexture2D * ExistingTexture, const HAPI_ImageInfo & ImageInfo,
         UPackage * Package, const FString & TextureName,
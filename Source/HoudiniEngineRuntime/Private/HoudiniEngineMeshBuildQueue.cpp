@@ -0,0 +1,252 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#include "HoudiniEngineMeshBuildQueue.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniRuntimeSettings.h"
+
+#if WITH_EDITOR
+
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Interfaces/ITargetPlatform.h"
+#include "Interfaces/ITargetPlatformManagerModule.h"
+#include "MeshUtilities.h"
+#include "Async/Async.h"
+
+DECLARE_CYCLE_STAT( TEXT( "Houdini: Swap Static Mesh Render Data" ), STAT_SwapStaticMeshRenderData, STATGROUP_HoudiniEngine );
+
+FHoudiniEngineMeshBuildQueue::FPendingBuild::FPendingBuild()
+    : bAddedToRoot( false )
+{}
+
+FHoudiniEngineMeshBuildQueue::FPendingBuild::FPendingBuild( FPendingBuild && Other )
+    : RenderData( MoveTemp( Other.RenderData ) )
+    , Future( MoveTemp( Other.Future ) )
+    , bAddedToRoot( Other.bAddedToRoot )
+{
+    Other.bAddedToRoot = false;
+}
+
+FHoudiniEngineMeshBuildQueue::FPendingBuild::~FPendingBuild()
+{}
+
+FHoudiniEngineMeshBuildQueue::FHoudiniEngineMeshBuildQueue()
+{}
+
+FHoudiniEngineMeshBuildQueue::~FHoudiniEngineMeshBuildQueue()
+{
+    // Worker threads must not outlive the render data they write to.
+    for ( TPair< UStaticMesh *, FPendingBuild > & Pair : PendingBuilds )
+    {
+        if ( Pair.Value.Future.IsValid() )
+            Pair.Value.Future.Wait();
+    }
+
+    PendingBuilds.Empty();
+
+    if ( TickerHandle.IsValid() )
+    {
+        FTicker::GetCoreTicker().RemoveTicker( TickerHandle );
+        TickerHandle.Reset();
+    }
+}
+
+bool
+FHoudiniEngineMeshBuildQueue::IsAsyncBuildEnabled()
+{
+    // Commandlets and automation tests expect the render data to be available once the meshes are created.
+    if ( !GIsEditor || IsRunningCommandlet() || GIsAutomationTesting )
+        return false;
+
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    return HoudiniRuntimeSettings && HoudiniRuntimeSettings->bAsyncStaticMeshBuild;
+}
+
+void
+FHoudiniEngineMeshBuildQueue::BuildStaticMesh( UStaticMesh * StaticMesh, TArray< FText > * OutErrors )
+{
+    if ( !StaticMesh || StaticMesh->IsPendingKill() )
+        return;
+
+    // A previous build of this mesh is superseded, its render data is swapped in first to keep things consistent.
+    FinishBuild( StaticMesh );
+
+    if ( !IsAsyncBuildEnabled() || StaticMesh->SourceModels.Num() <= 0 )
+    {
+        // Free any RHI resources.
+        StaticMesh->PreEditChange( nullptr );
+
+        FHoudiniScopedGlobalSilence ScopedGlobalSilence;
+        StaticMesh->Build( true, OutErrors );
+        return;
+    }
+
+    // The body setup is needed by the collision code running right after the mesh is created.
+    StaticMesh->CreateBodySetup();
+
+    // Everything that is not thread safe is resolved on the game thread: the LOD settings of the running
+    // platform and the mesh utilities module used by the build.
+    ITargetPlatform * RunningPlatform = GetTargetPlatformManagerRef().GetRunningTargetPlatform();
+    check( RunningPlatform );
+    const FStaticMeshLODSettings & LODSettings = RunningPlatform->GetStaticMeshLODSettings();
+    FModuleManager::Get().LoadModuleChecked< IMeshUtilities >( TEXT( "MeshUtilities" ) );
+
+    FPendingBuild PendingBuild;
+    PendingBuild.RenderData = MakeUnique< FStaticMeshRenderData >();
+
+    // Keep the mesh alive while a worker thread reads from it.
+    if ( !StaticMesh->IsRooted() )
+    {
+        StaticMesh->AddToRoot();
+        PendingBuild.bAddedToRoot = true;
+    }
+
+    // Normals, tangents, lightmap UVs and adjacency buffers are built, or fetched from the DDC, on the thread pool.
+    FStaticMeshRenderData * RenderData = PendingBuild.RenderData.Get();
+    PendingBuild.Future = Async< void >( EAsyncExecution::ThreadPool, [ StaticMesh, RenderData, &LODSettings ]()
+    {
+        RenderData->Cache( StaticMesh, LODSettings );
+    } );
+
+    PendingBuilds.Add( StaticMesh, MoveTemp( PendingBuild ) );
+    UpdateTicker();
+}
+
+void
+FHoudiniEngineMeshBuildQueue::FinishBuild( UStaticMesh * StaticMesh )
+{
+    FPendingBuild * FoundPendingBuild = PendingBuilds.Find( StaticMesh );
+    if ( !FoundPendingBuild )
+        return;
+
+    FPendingBuild PendingBuild( MoveTemp( *FoundPendingBuild ) );
+    PendingBuilds.Remove( StaticMesh );
+
+    CompleteBuild( StaticMesh, PendingBuild );
+    UpdateTicker();
+}
+
+void
+FHoudiniEngineMeshBuildQueue::FinishAllBuilds()
+{
+    TMap< UStaticMesh *, FPendingBuild > Builds = MoveTemp( PendingBuilds );
+    PendingBuilds.Reset();
+
+    for ( TPair< UStaticMesh *, FPendingBuild > & Pair : Builds )
+        CompleteBuild( Pair.Key, Pair.Value );
+
+    UpdateTicker();
+}
+
+bool
+FHoudiniEngineMeshBuildQueue::IsBuildPending( const UStaticMesh * StaticMesh ) const
+{
+    return PendingBuilds.Contains( const_cast< UStaticMesh * >( StaticMesh ) );
+}
+
+void
+FHoudiniEngineMeshBuildQueue::CompleteBuild( UStaticMesh * StaticMesh, FPendingBuild & PendingBuild )
+{
+    SCOPE_CYCLE_COUNTER( STAT_SwapStaticMeshRenderData );
+
+    if ( PendingBuild.Future.IsValid() )
+        PendingBuild.Future.Wait();
+
+    if ( PendingBuild.bAddedToRoot )
+        StaticMesh->RemoveFromRoot();
+
+    // The mesh went away while it was being built, drop its render data.
+    if ( StaticMesh->IsPendingKill() || !PendingBuild.RenderData.IsValid() )
+        return;
+
+    const FString ExistingDerivedDataKey = StaticMesh->RenderData ? StaticMesh->RenderData->DerivedDataKey : FString();
+
+    {
+        // Detach all instances of this static mesh from the scene, their bounds are refreshed when reattached.
+        FStaticMeshComponentRecreateRenderStateContext RecreateRenderStateContext( StaticMesh, false, true );
+
+        // The rendering thread must be done with the previous render data before it is replaced.
+        StaticMesh->ReleaseResources();
+        StaticMesh->ReleaseResourcesFence.Wait();
+
+        StaticMesh->RenderData = MoveTemp( PendingBuild.RenderData );
+        StaticMesh->InitResources();
+        StaticMesh->CalculateExtendedBounds();
+    }
+
+    StaticMesh->CreateBodySetup();
+    if ( StaticMesh->BodySetup && ExistingDerivedDataKey != StaticMesh->RenderData->DerivedDataKey )
+    {
+        // Complex collision is cooked from the new render data.
+        StaticMesh->BodySetup->InvalidatePhysicsData();
+        StaticMesh->BodySetup->CreatePhysicsMeshes();
+    }
+
+    StaticMesh->GetOnMeshChanged().Broadcast();
+}
+
+void
+FHoudiniEngineMeshBuildQueue::UpdateTicker()
+{
+    if ( PendingBuilds.Num() > 0 && !TickerHandle.IsValid() )
+    {
+        TickerHandle = FTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw( this, &FHoudiniEngineMeshBuildQueue::Tick ) );
+    }
+    else if ( PendingBuilds.Num() <= 0 && TickerHandle.IsValid() )
+    {
+        FTicker::GetCoreTicker().RemoveTicker( TickerHandle );
+        TickerHandle.Reset();
+    }
+}
+
+bool
+FHoudiniEngineMeshBuildQueue::Tick( float DeltaTime )
+{
+    // Swap in the builds that are done, the others keep their placeholder until a later frame.
+    for ( TMap< UStaticMesh *, FPendingBuild >::TIterator Iter( PendingBuilds ); Iter; ++Iter )
+    {
+        FPendingBuild & PendingBuild = Iter.Value();
+        if ( PendingBuild.Future.IsValid() && !PendingBuild.Future.IsReady() )
+            continue;
+
+        FPendingBuild FinishedBuild( MoveTemp( PendingBuild ) );
+        UStaticMesh * StaticMesh = Iter.Key();
+        Iter.RemoveCurrent();
+
+        CompleteBuild( StaticMesh, FinishedBuild );
+    }
+
+    // Remove ourselves from the ticker if we have nothing left to swap in.
+    const bool bHasPendingBuilds = PendingBuilds.Num() > 0;
+    if ( !bHasPendingBuilds )
+        TickerHandle.Reset();
+
+    return bHasPendingBuilds;
+}
+
+#endif
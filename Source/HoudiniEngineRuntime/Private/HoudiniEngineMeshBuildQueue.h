@@ -0,0 +1,100 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+
+#if WITH_EDITOR
+
+class UStaticMesh;
+class FStaticMeshRenderData;
+
+/** Builds the render data of generated static meshes on worker threads and swaps it in on the game thread. **/
+/** Until their build is swapped in, meshes keep rendering their previous render data, or nothing if they are new. **/
+class FHoudiniEngineMeshBuildQueue
+{
+    public:
+
+        FHoudiniEngineMeshBuildQueue();
+        ~FHoudiniEngineMeshBuildQueue();
+
+    public:
+
+        /** Return true if static mesh builds are offloaded to worker threads. **/
+        static bool IsAsyncBuildEnabled();
+
+        /** Build the given static mesh, on a worker thread if enabled, synchronously otherwise. **/
+        /** The source models of the mesh must not be modified until its build is finished. **/
+        void BuildStaticMesh( UStaticMesh * StaticMesh, TArray< FText > * OutErrors = nullptr );
+
+        /** Wait for the pending build of the given static mesh, if any, and swap in its render data. **/
+        void FinishBuild( UStaticMesh * StaticMesh );
+
+        /** Wait for all pending builds and swap in their render data. **/
+        void FinishAllBuilds();
+
+        /** Return true if the given static mesh has a build in progress. **/
+        bool IsBuildPending( const UStaticMesh * StaticMesh ) const;
+
+    protected:
+
+        /** A static mesh build running on a worker thread. **/
+        struct FPendingBuild
+        {
+            FPendingBuild();
+            FPendingBuild( FPendingBuild && Other );
+            ~FPendingBuild();
+
+            /** Render data being built. **/
+            TUniquePtr< FStaticMeshRenderData > RenderData;
+
+            /** Completion of the worker thread build. **/
+            TFuture< void > Future;
+
+            /** Whether we rooted the mesh while it is being built. **/
+            bool bAddedToRoot;
+        };
+
+        /** Swap the finished render data into its static mesh. **/
+        void CompleteBuild( UStaticMesh * StaticMesh, FPendingBuild & PendingBuild );
+
+        /** Ticker callback, swaps in the builds that are finished. **/
+        bool Tick( float DeltaTime );
+
+        /** Add or remove our ticker depending on whether we have pending builds. **/
+        void UpdateTicker();
+
+    protected:
+
+        /** Builds in progress, keyed by static mesh. **/
+        TMap< UStaticMesh *, FPendingBuild > PendingBuilds;
+
+        /** Handle of our core ticker delegate, only valid while builds are pending. **/
+        FDelegateHandle TickerHandle;
+};
+
+#endif
@@ -0,0 +1,265 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineRuntimeMeshUtils.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniRuntimeSettings.h"
+
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "Materials/MaterialInterface.h"
+
+DECLARE_CYCLE_STAT( TEXT( "Houdini: Create Runtime Mesh Components" ), STAT_CreateRuntimeMeshComponents, STATGROUP_HoudiniEngine );
+
+void
+FHoudiniRuntimeMeshSection::Reset()
+{
+    Vertices.Reset();
+    Triangles.Reset();
+    Normals.Reset();
+    UV0.Reset();
+    Colors.Reset();
+    Tangents.Reset();
+    Material = nullptr;
+}
+
+bool
+FHoudiniEngineRuntimeMeshUtils::CreateMeshComponentsFromHoudiniAsset(
+    HAPI_NodeId AssetId, USceneComponent * ParentComponent, bool bCreateCollision,
+    TMap< FHoudiniGeoPartObject, UProceduralMeshComponent * > & MeshComponentsIn,
+    TMap< FHoudiniGeoPartObject, UProceduralMeshComponent * > & MeshComponentsOut )
+{
+    SCOPE_CYCLE_COUNTER( STAT_CreateRuntimeMeshComponents );
+
+    if ( !ParentComponent || ParentComponent->IsPendingKill() )
+        return false;
+
+    TArray< HAPI_ObjectInfo > ObjectInfos;
+    if ( !FHoudiniEngineUtils::HapiGetObjectInfos( AssetId, ObjectInfos ) )
+        return false;
+
+    TArray< HAPI_Transform > ObjectTransforms;
+    if ( !FHoudiniEngineUtils::HapiGetObjectTransforms( AssetId, ObjectTransforms ) )
+        return false;
+
+    // The buffers are reused from part to part.
+    FHoudiniRuntimeMeshSection MeshSection;
+    for ( int32 ObjectIdx = 0; ObjectIdx < ObjectInfos.Num(); ++ObjectIdx )
+    {
+        const HAPI_ObjectInfo & ObjectInfo = ObjectInfos[ ObjectIdx ];
+        if ( !ObjectInfo.isVisible || ObjectInfo.isInstancer )
+            continue;
+
+        HAPI_GeoInfo GeoInfo;
+        FMemory::Memzero< HAPI_GeoInfo >( GeoInfo );
+        if ( FHoudiniApi::GetDisplayGeoInfo(
+            FHoudiniEngine::Get().GetSession(), ObjectInfo.nodeId, &GeoInfo ) != HAPI_RESULT_SUCCESS )
+            continue;
+
+        FTransform ObjectTransform = FTransform::Identity;
+        if ( ObjectTransforms.IsValidIndex( ObjectIdx ) )
+            FHoudiniEngineUtils::TranslateHapiTransform( ObjectTransforms[ ObjectIdx ], ObjectTransform );
+
+        for ( int32 PartIdx = 0; PartIdx < GeoInfo.partCount; ++PartIdx )
+        {
+            HAPI_PartInfo PartInfo;
+            FMemory::Memzero< HAPI_PartInfo >( PartInfo );
+            if ( FHoudiniApi::GetPartInfo(
+                FHoudiniEngine::Get().GetSession(), GeoInfo.nodeId, PartIdx, &PartInfo ) != HAPI_RESULT_SUCCESS )
+                continue;
+
+            if ( PartInfo.isInstanced || PartInfo.type != HAPI_PARTTYPE_MESH )
+                continue;
+
+            FHoudiniGeoPartObject HoudiniGeoPartObject( ObjectTransform, AssetId, ObjectInfo, GeoInfo, PartInfo );
+            if ( !GetPartMeshSection( HoudiniGeoPartObject, MeshSection ) )
+                continue;
+
+            // Reuse the component of the previous cook if there is one, new components are set up like instancers.
+            UProceduralMeshComponent * MeshComponent = nullptr;
+            UProceduralMeshComponent * const * FoundMeshComponent = MeshComponentsIn.Find( HoudiniGeoPartObject );
+            if ( FoundMeshComponent && *FoundMeshComponent && !( *FoundMeshComponent )->IsPendingKill() )
+            {
+                MeshComponent = *FoundMeshComponent;
+                MeshComponentsIn.Remove( HoudiniGeoPartObject );
+            }
+            else
+            {
+                MeshComponent = NewObject< UProceduralMeshComponent >(
+                    ParentComponent->GetOwner(), UProceduralMeshComponent::StaticClass(), NAME_None, RF_Transactional );
+
+                if ( !MeshComponent )
+                    continue;
+
+                MeshComponent->SetMobility( ParentComponent->Mobility );
+                MeshComponent->AttachToComponent( ParentComponent, FAttachmentTransformRules::KeepRelativeTransform );
+                MeshComponent->RegisterComponent();
+            }
+
+            MeshComponent->SetRelativeTransform( ObjectTransform );
+            MeshComponent->CreateMeshSection_LinearColor(
+                0, MeshSection.Vertices, MeshSection.Triangles, MeshSection.Normals,
+                MeshSection.UV0, MeshSection.Colors, MeshSection.Tangents, bCreateCollision );
+            MeshComponent->SetMaterial( 0, MeshSection.Material );
+
+            MeshComponentsOut.Add( HoudiniGeoPartObject, MeshComponent );
+        }
+    }
+
+    return MeshComponentsOut.Num() > 0;
+}
+
+bool
+FHoudiniEngineRuntimeMeshUtils::GetPartMeshSection(
+    const FHoudiniGeoPartObject & HoudiniGeoPartObject, FHoudiniRuntimeMeshSection & MeshSection )
+{
+    MeshSection.Reset();
+
+    HAPI_PartInfo PartInfo;
+    FMemory::Memzero< HAPI_PartInfo >( PartInfo );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetPartInfo(
+        FHoudiniEngine::Get().GetSession(), HoudiniGeoPartObject.GeoId, HoudiniGeoPartObject.PartId, &PartInfo ), false );
+
+    // Assets are cooked triangulated, anything else is left to the static mesh path.
+    if ( PartInfo.vertexCount <= 0 || ( PartInfo.vertexCount % 3 ) != 0 )
+        return false;
+
+    TArray< int32 > VertexList;
+    VertexList.SetNumUninitialized( PartInfo.vertexCount );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetVertexList(
+        FHoudiniEngine::Get().GetSession(), HoudiniGeoPartObject.GeoId, HoudiniGeoPartObject.PartId,
+        VertexList.GetData(), 0, PartInfo.vertexCount ), false );
+
+    HAPI_AttributeInfo AttribInfoPositions;
+    FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoPositions );
+    TArray< float > PartPositions;
+    if ( !FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+        HoudiniGeoPartObject, HAPI_UNREAL_ATTRIB_POSITION, AttribInfoPositions, PartPositions, 3 )
+        || !AttribInfoPositions.exists )
+        return false;
+
+    HAPI_AttributeInfo AttribInfoNormals;
+    FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoNormals );
+    TArray< float > PartNormals;
+    FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+        HoudiniGeoPartObject, HAPI_UNREAL_ATTRIB_NORMAL, AttribInfoNormals, PartNormals, 3 );
+
+    HAPI_AttributeInfo AttribInfoUVs;
+    FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoUVs );
+    TArray< float > PartUVs;
+    FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+        HoudiniGeoPartObject, HAPI_UNREAL_ATTRIB_UV, AttribInfoUVs, PartUVs, 2 );
+
+    HAPI_AttributeInfo AttribInfoColors;
+    FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoColors );
+    TArray< float > PartColors;
+    FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+        HoudiniGeoPartObject, HAPI_UNREAL_ATTRIB_COLOR, AttribInfoColors, PartColors, 3 );
+
+    // Every attribute is unshared per wedge, the way the procedural mesh expects its sections.
+    const int32 VertexCount = VertexList.Num();
+    TArray< float > WedgeColors;
+    TArray< FHoudiniWedgeAttributeTransfer > WedgeAttributeTransfers;
+
+    MeshSection.Vertices.SetNumUninitialized( VertexCount );
+    WedgeAttributeTransfers.Emplace( AttribInfoPositions, PartPositions, (float *) MeshSection.Vertices.GetData(), 3 );
+
+    if ( AttribInfoNormals.exists )
+    {
+        MeshSection.Normals.SetNumUninitialized( VertexCount );
+        WedgeAttributeTransfers.Emplace( AttribInfoNormals, PartNormals, (float *) MeshSection.Normals.GetData(), 3 );
+    }
+
+    if ( AttribInfoUVs.exists )
+    {
+        MeshSection.UV0.SetNumUninitialized( VertexCount );
+        WedgeAttributeTransfers.Emplace( AttribInfoUVs, PartUVs, (float *) MeshSection.UV0.GetData(), 2 );
+    }
+
+    if ( AttribInfoColors.exists )
+    {
+        WedgeColors.SetNumUninitialized( VertexCount * 3 );
+        WedgeAttributeTransfers.Emplace( AttribInfoColors, PartColors, WedgeColors.GetData(), 3 );
+    }
+
+    const int32 WedgeCount = FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+        VertexList, WedgeAttributeTransfers ) / 3 * 3;
+
+    if ( WedgeCount <= 0 )
+        return false;
+
+    MeshSection.Vertices.SetNum( WedgeCount, false );
+    if ( MeshSection.Normals.Num() > 0 )
+        MeshSection.Normals.SetNum( WedgeCount, false );
+    if ( MeshSection.UV0.Num() > 0 )
+        MeshSection.UV0.SetNum( WedgeCount, false );
+
+    // Convert to Unreal's scale and axes, and fix the winding order when swapping axes.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    const float GeneratedGeometryScaleFactor = HoudiniRuntimeSettings ?
+        HoudiniRuntimeSettings->GeneratedGeometryScaleFactor : HAPI_UNREAL_SCALE_FACTOR_POSITION;
+    const bool bSwapYZ = !HoudiniRuntimeSettings || HoudiniRuntimeSettings->ImportAxis == HRSAI_Unreal;
+
+    FHoudiniEngineUtils::ScaleAndSwapVectors(
+        MeshSection.Vertices.GetData(), WedgeCount, GeneratedGeometryScaleFactor, bSwapYZ );
+
+    if ( MeshSection.Normals.Num() > 0 )
+        FHoudiniEngineUtils::ScaleAndSwapVectors( MeshSection.Normals.GetData(), WedgeCount, 1.0f, bSwapYZ );
+
+    for ( FVector2D & UV : MeshSection.UV0 )
+        UV.Y = 1.0f - UV.Y;
+
+    if ( WedgeColors.Num() > 0 )
+    {
+        MeshSection.Colors.SetNumUninitialized( WedgeCount );
+        for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; ++WedgeIdx )
+        {
+            MeshSection.Colors[ WedgeIdx ] = FLinearColor(
+                FMath::Clamp( WedgeColors[ WedgeIdx * 3 + 0 ], 0.0f, 1.0f ),
+                FMath::Clamp( WedgeColors[ WedgeIdx * 3 + 1 ], 0.0f, 1.0f ),
+                FMath::Clamp( WedgeColors[ WedgeIdx * 3 + 2 ], 0.0f, 1.0f ) );
+        }
+    }
+
+    MeshSection.Triangles.SetNumUninitialized( WedgeCount );
+    for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; WedgeIdx += 3 )
+    {
+        MeshSection.Triangles[ WedgeIdx + 0 ] = WedgeIdx + 0;
+        MeshSection.Triangles[ WedgeIdx + 1 ] = bSwapYZ ? WedgeIdx + 2 : WedgeIdx + 1;
+        MeshSection.Triangles[ WedgeIdx + 2 ] = bSwapYZ ? WedgeIdx + 1 : WedgeIdx + 2;
+    }
+
+    // Only already cooked materials can be used, the first material of the part is applied to the whole section.
+    HAPI_AttributeInfo AttribInfoMaterials;
+    FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoMaterials );
+    TArray< FString > MaterialNames;
+    if ( FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+        HoudiniGeoPartObject, HAPI_UNREAL_ATTRIB_MATERIAL, AttribInfoMaterials, MaterialNames )
+        && MaterialNames.Num() > 0 && !MaterialNames[ 0 ].IsEmpty() )
+    {
+        MeshSection.Material = LoadObject< UMaterialInterface >( nullptr, *MaterialNames[ 0 ], nullptr, LOAD_NoWarn, nullptr );
+    }
+
+    return true;
+}
@@ -0,0 +1,64 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#pragma once
+
+#include "HoudiniGeoPartObject.h"
+#include "ProceduralMeshComponent.h"
+
+class USceneComponent;
+class UMaterialInterface;
+
+/** Render buffers of a cooked mesh part, one vertex per wedge in Unreal space. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniRuntimeMeshSection
+{
+    /** Empty all buffers, their allocations are kept for the next part. **/
+    void Reset();
+
+    TArray< FVector > Vertices;
+    TArray< int32 > Triangles;
+    TArray< FVector > Normals;
+    TArray< FVector2D > UV0;
+    TArray< FLinearColor > Colors;
+    TArray< FProcMeshTangent > Tangents;
+
+    /** Material named by the part's material attribute, if any. **/
+    UMaterialInterface * Material = nullptr;
+};
+
+/** Reduced output pipeline usable in game builds: cooked mesh parts are written straight into procedural mesh **/
+/** components, there is no static mesh build, no package and no landscape.                                   **/
+struct HOUDINIENGINERUNTIME_API FHoudiniEngineRuntimeMeshUtils
+{
+    public:
+
+        /** Create or update a mesh component for each visible mesh part of a cooked asset. Components of parts    **/
+        /** found in MeshComponentsIn are reused and removed from it, the ones left there are no longer used.       **/
+        static bool CreateMeshComponentsFromHoudiniAsset(
+            HAPI_NodeId AssetId, USceneComponent * ParentComponent, bool bCreateCollision,
+            TMap< FHoudiniGeoPartObject, UProceduralMeshComponent * > & MeshComponentsIn,
+            TMap< FHoudiniGeoPartObject, UProceduralMeshComponent * > & MeshComponentsOut );
+
+        /** Fetch the render buffers of a triangulated mesh part. **/
+        static bool GetPartMeshSection( const FHoudiniGeoPartObject & HoudiniGeoPartObject, FHoudiniRuntimeMeshSection & MeshSection );
+};
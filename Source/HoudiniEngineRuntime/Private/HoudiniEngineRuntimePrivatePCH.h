@@ -204,6 +204,8 @@
 //#define HAPI_UNREAL_ATTRIB_LANDSCAPE_NAME               "unreal_landscape"
 #define HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME              "unreal_input_mesh_name"
 #define HAPI_UNREAL_ATTRIB_INPUT_SOURCE_FILE            "unreal_input_source_file"
+#define HAPI_UNREAL_ATTRIB_BONE_INDEX                   "unreal_bone_index"
+#define HAPI_UNREAL_ATTRIB_BONE_WEIGHT                  "unreal_bone_weight"
 #define HAPI_UNREAL_ATTRIB_MESH_SOCKET_PREFIX           "mesh_socket"
 #define HAPI_UNREAL_ATTRIB_MESH_SOCKET_NAME             "mesh_socket_name"
 #define HAPI_UNREAL_ATTRIB_MESH_SOCKET_NAME_OLD         "unreal_mesh_socket_name"
@@ -274,6 +276,9 @@
 #define HAPI_UNREAL_MATERIAL_TEXTURE_ALPHA              "A"
 #define HAPI_UNREAL_MATERIAL_TEXTURE_NORMAL             "N"
 
+/** Maximum amount of extracted image data kept between material cooks, in bytes. **/
+#define HAPI_UNREAL_MATERIAL_IMAGE_CACHE_MAX_SIZE       ( 256 * 1024 * 1024 )
+
 /** Materials Diffuse. **/
 #define HAPI_UNREAL_PARAM_TEXTURE_LAYERS_NUM            "ogl_numtex"
 
@@ -365,17 +370,45 @@
 #define HAPI_UNREAL_GROUP_MESH_SOCKETS                  "mesh_socket"
 #define HAPI_UNREAL_GROUP_MESH_SOCKETS_OLD              "socket"
 
+/** Size of the cells mesh sockets are bucketed in, to find duplicate sockets. **/
+#define HAPI_UNREAL_MESH_SOCKET_CELL_SIZE               100.0f
+
+/** Minimum number of elements before raw mesh attribute conversion is spread over worker threads. **/
+#define HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS          4096
+
+/** Maximum number of multi hull decompositions kept by the convex decomposition cache. **/
+#define HAPI_UNREAL_CONVEX_DECOMPOSITION_CACHE_SIZE     8192
+
+/** Parts with more primitives than this are imported in chunks. **/
+#define HAPI_UNREAL_CHUNKED_IMPORT_PRIMITIVE_THRESHOLD  2000000
+
+/** Number of values read per Houdini Engine call when importing in chunks. **/
+#define HAPI_UNREAL_CHUNKED_IMPORT_CHUNK_SIZE           ( 1 << 20 )
+
+/** Instancers with at least this many instances use hierarchical instanced static mesh components. **/
+#define HAPI_UNREAL_INSTANCER_HIERARCHICAL_MIN_INSTANCES 1024
+
+/** Maximum number of reduced LODs generated for meshes above the auto LOD triangle budget. **/
+#define HAPI_UNREAL_AUTO_LOD_MAX_COUNT                  4
+
 /** Details panel desired sizes. **/
 #define HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH              270
 #define HAPI_UNREAL_DESIRED_ROW_FULL_WIDGET_WIDTH               310
 #define HAPI_UNREAL_DESIRED_SETTINGS_ROW_VALUE_WIDGET_WIDTH     350
 #define HAPI_UNREAL_DESIRED_SETTINGS_ROW_FULL_WIDGET_WIDTH      400
 
+/** Details panel list of generated static meshes, used above the given number of meshes. **/
+#define HAPI_UNREAL_DETAILS_STATIC_MESH_LIST_THRESHOLD              64
+#define HAPI_UNREAL_DETAILS_STATIC_MESH_LIST_HEIGHT                 600.0f
+#define HAPI_UNREAL_DETAILS_STATIC_MESH_LIST_THUMBNAIL_POOL_SIZE    64
+#define HAPI_UNREAL_DETAILS_STATIC_MESH_LIST_THUMBNAIL_FRAME_TIME   0.002
+
 /** Various variable names used to store meta information in generated packages. **/
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_OBJECT               TEXT( "HoudiniGeneratedObject" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_NAME                 TEXT( "HoudiniGeneratedName" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_TYPE         TEXT( "HoudiniGeneratedTextureType" )
 #define HAPI_UNREAL_PACKAGE_META_NODE_PATH                      TEXT( "HoudiniNodePath" )
+#define HAPI_UNREAL_PACKAGE_META_GENERATED_MATERIAL_SIGNATURE   TEXT( "HoudiniGeneratedMaterialSignature" )
 
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL       TEXT( "N" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE      TEXT( "C_A" )
@@ -397,6 +430,99 @@
 
 #define HAPI_UNREAL_SESSION_SERVER_AUTOSTART                true
 #define HAPI_UNREAL_SESSION_SERVER_TIMEOUT                  3000.0f
+#define HAPI_UNREAL_SESSION_POOL_MAX_SIZE                   16
+
+/** Interval at which the schedulers check that their session is alive (in seconds). **/
+#define HAPI_UNREAL_SESSION_HEARTBEAT_INTERVAL              1.0f
+
+/** Session recovery settings (in seconds). **/
+#define HAPI_UNREAL_SESSION_RECOVERY_CHECK_INTERVAL         2.0f
+#define HAPI_UNREAL_SESSION_RECOVERY_VISIBILITY_TOLERANCE   0.5f
+
+/** HAPI session slot used by custom session implementations. **/
+#define HAPI_UNREAL_SESSION_CUSTOM_TYPE                     HAPI_SESSION_CUSTOM1
+
+/** Option appended to the custom session info to request compressed payloads, followed by the level. **/
+#define HAPI_UNREAL_SESSION_CUSTOM_COMPRESSION_OPTION       TEXT( ";compression=%d" )
+
+/** Maximum number of cooking threads a Houdini Engine session can be given. **/
+#define HAPI_UNREAL_MAX_COOKING_THREAD_COUNT                1024
+
+/** Environment variable read by Houdini Engine servers to limit their number of cooking threads. **/
+#define HAPI_UNREAL_ENV_MAX_THREADS                         TEXT( "HOUDINI_MAXTHREADS" )
+
+/** HAPI call tracing settings. **/
+#define HAPI_UNREAL_API_TRACE_DUMP_COUNT                    20
+#define HAPI_UNREAL_API_TRACE_CSV_FILE                      TEXT( "HoudiniApiTrace.csv" )
+
+/** HAPI call recording settings, the version is bumped whenever the record layout changes. **/
+#define HAPI_UNREAL_API_RECORDING_FILE                      TEXT( "HoudiniApiRecording.hapirec" )
+#define HAPI_UNREAL_API_RECORDING_MAGIC                     0x52504148
+#define HAPI_UNREAL_API_RECORDING_VERSION                   1
+
+/** Number of actors listed by the cook profile command when none is given. **/
+#define HAPI_UNREAL_COOK_PROFILE_DUMP_COUNT                 10
+
+/** Number of actors listed by the load profile command when none is given. **/
+#define HAPI_UNREAL_LOAD_PROFILE_DUMP_COUNT                 10
+
+/** Number of actors listed by the output memory command when none is given. **/
+#define HAPI_UNREAL_OUTPUT_MEMORY_DUMP_COUNT                10
+
+/** Output memory of a component, in MB, above which a warning is logged after a cook. **/
+#define HAPI_UNREAL_OUTPUT_MEMORY_WARNING_THRESHOLD_MB      1024
+
+/** Cook status polling settings used by the scheduler (in seconds). **/
+#define HAPI_UNREAL_COOK_STATUS_POLL_LATENCY_BUDGET         0.05f
+#define HAPI_UNREAL_COOK_STATUS_POLL_MIN_INTERVAL           0.001f
+#define HAPI_UNREAL_COOK_STATUS_POLL_MAX_INTERVAL           0.1f
+
+/** Number of heightfield values read from HAPI at once when streaming heightfield layers. **/
+#define HAPI_UNREAL_HEIGHTFIELD_TILE_SAMPLES                ( 4 * 1024 * 1024 )
+
+/** Binary backups of input landscapes. **/
+#define HAPI_UNREAL_LANDSCAPE_BACKUP_EXTENSION              TEXT( "hlbak" )
+#define HAPI_UNREAL_LANDSCAPE_BACKUP_MAGIC                  0x4B424C48
+#define HAPI_UNREAL_LANDSCAPE_BACKUP_VERSION                1
+
+/** Minimum time in seconds between two updates of a curve being dragged. **/
+#define HAPI_UNREAL_CURVE_DRAG_UPDATE_INTERVAL              0.1f
+
+/** Minimum time in seconds between two preview cooks of a parameter slider being dragged. **/
+#define HAPI_UNREAL_SLIDER_DRAG_COOK_INTERVAL               0.1f
+
+/** Minimum time in seconds between two updates of a transform handle being dragged. **/
+#define HAPI_UNREAL_HANDLE_DRAG_UPDATE_INTERVAL             0.1f
+
+/** Maximum number of tasks the scheduler dequeues at once. **/
+#define HAPI_UNREAL_SCHEDULER_DEQUEUE_BATCH_SIZE            64
+
+/** Time in milliseconds spent per frame on processing cook results. **/
+#define HAPI_UNREAL_POST_COOK_TIME_BUDGET                   10.0f
+
+/** Maximum number of points of the preview shown while cook results are processed. **/
+#define HAPI_UNREAL_COOK_PREVIEW_MAX_POINTS                 10000
+
+/** Number of evenly spaced ranges of points read per part for the cook preview. **/
+#define HAPI_UNREAL_COOK_PREVIEW_RANGES_PER_PART            16
+
+/** Number of recently cooked presets whose outputs are kept per component. **/
+#define HAPI_UNREAL_PRESET_SNAPSHOT_CACHE_SIZE              4
+
+/** Interval in seconds at which components without a task in progress are ticked. **/
+#define HAPI_UNREAL_COOK_DISPATCHER_POLL_INTERVAL           0.25f
+
+/** Delay in seconds after the last released temporary cook output before the batch is cleaned up. **/
+#define HAPI_UNREAL_TEMP_PACKAGE_CLEANUP_INTERVAL           1.0f
+
+/** Number of times a waiting lane can be skipped for higher priority lanes before it gets to run a task. **/
+#define HAPI_UNREAL_SCHEDULER_STARVATION_LIMIT              8
+
+/** Interval in seconds at which the schedulers publish their telemetry, and at which it is checked for stalls. **/
+#define HAPI_UNREAL_SCHEDULER_TELEMETRY_INTERVAL            0.5f
+
+/** Time in seconds a task can run before it is reported as stalled. **/
+#define HAPI_UNREAL_SCHEDULER_STALL_WARNING_TIME            60.0f
 
 /** Default position and transformation scaling options. **/
 #define HAPI_UNREAL_SCALE_FACTOR_POSITION                   100.0f
@@ -36,40 +36,92 @@
 #include "HoudiniEngine.h"
 #include "HoudiniAsset.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniApiTrace.h"
+#include "HoudiniRuntimeSettings.h"
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "Misc/ScopeExit.h"
 #include "Misc/ScopeLock.h"
 
-const uint32
-FHoudiniEngineScheduler::InitialTaskSize = 256u;
+DECLARE_CYCLE_STAT( TEXT( "Houdini: HAPI Cook" ), STAT_HapiCook, STATGROUP_HoudiniEngine );
 
-FHoudiniEngineScheduler::FHoudiniEngineScheduler()
-    : Tasks( nullptr )
-    , PositionWrite( 0u )
-    , PositionRead( 0u )
-    , bStopping( false )
+FHoudiniEngineSchedulerTelemetry::FHoudiniEngineSchedulerTelemetry()
+    : OldestTaskQueuedTime( 0.0 )
+    , CurrentTaskType( EHoudiniEngineTaskType::None )
+    , CurrentTaskStartTime( 0.0 )
+    , Utilization( 0.0f )
+    , StatusPollFraction( 0.0f )
 {
-    //  Make sure size is power of two.
-    TaskCount = FPlatformMath::RoundUpToPowerOfTwo( FHoudiniEngineScheduler::InitialTaskSize );
+    FMemory::Memzero( PendingTaskCounts );
+}
 
-    if ( TaskCount )
+FHoudiniEngineScheduler::FHoudiniEngineScheduler( int32 InSessionIndex )
+    : TaskEvent( nullptr )
+    , SessionIndex( InSessionIndex )
+    , LastHeartbeatTime( 0.0 )
+    , CurrentTaskStartTime( 0.0 )
+    , CurrentTaskQueueSeconds( 0.0 )
+    , CurrentTaskHapiCallCount( 0 )
+    , CurrentTaskHapiBytes( 0 )
+    , LastTelemetryTime( 0.0 )
+    , TelemetryBusySeconds( 0.0 )
+    , TelemetryPollSeconds( 0.0 )
+    , TelemetryBusyMark( 0.0 )
+    , bProcessingTask( false )
+    , bTelemetryIdle( false )
+    , bStopping( false )
+{
+    for ( int32 Lane = 0; Lane < EHoudiniEngineTaskPriority::MAX; ++Lane )
     {
-        // Allocate buffer to store all tasks.
-        Tasks = static_cast< FHoudiniEngineTask * >( FMemory::Malloc( TaskCount * sizeof( FHoudiniEngineTask ) ) );
-
-        if ( Tasks )
-        {
-            // Zero memory.
-            FMemory::Memset( Tasks, 0x0, TaskCount * sizeof( FHoudiniEngineTask ) );
-        }
+        TaskBacklogHeads[ Lane ] = 0;
+        LaneSkipCounts[ Lane ] = 0;
     }
+
+    // Auto reset event, used to sleep while idle or while waiting on a cook.
+    TaskEvent = FPlatformProcess::GetSynchEventFromPool( false );
 }
 
 FHoudiniEngineScheduler::~FHoudiniEngineScheduler()
 {
-    if ( TaskCount )
+    if ( TaskEvent )
+    {
+        FPlatformProcess::ReturnSynchEventToPool( TaskEvent );
+        TaskEvent = nullptr;
+    }
+}
+
+void
+FHoudiniEngineScheduler::WaitForNextCookStatusPoll( double TaskStartTime, float & PollInterval )
+{
+    const double WaitStartTime = FPlatformTime::Seconds();
+    ON_SCOPE_EXIT
+    {
+        TelemetryPollSeconds += FPlatformTime::Seconds() - WaitStartTime;
+        UpdateTelemetry( false );
+    };
+
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( !HoudiniRuntimeSettings || HoudiniRuntimeSettings->CookWaitMode != HRSCWM_AdaptiveBackoff
+        || !TaskEvent || !FPlatformProcess::SupportsMultithreading() )
+    {
+        // We want to yield.
+        FPlatformProcess::Sleep( 0.0f );
+        return;
+    }
+
+    // Keep polling continuously while the task is within its latency budget, short cooks are reported immediately.
+    if ( FPlatformTime::Seconds() - TaskStartTime < HoudiniRuntimeSettings->CookStatusPollLatencyBudget )
     {
-        FMemory::Free( Tasks );
-        Tasks = nullptr;
+        FPlatformProcess::Sleep( 0.0f );
+        return;
     }
+
+    // Back off exponentially, up to the poll ceiling.
+    const float PollCeiling = FMath::Max( HoudiniRuntimeSettings->CookStatusPollMaxInterval, HAPI_UNREAL_COOK_STATUS_POLL_MIN_INTERVAL );
+    PollInterval = FMath::Clamp( PollInterval * 2.0f, HAPI_UNREAL_COOK_STATUS_POLL_MIN_INTERVAL, PollCeiling );
+
+    // Sleep without spinning, we are woken up early if we are being stopped.
+    TaskEvent->Wait( FTimespan::FromSeconds( PollInterval ) );
 }
 
 void
@@ -179,8 +231,15 @@ FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
         TaskDescription( TaskInfo, Task.ActorName, TEXT( "Started Instantiation" ) );
         FHoudiniEngine::Get().AddTaskInfo( Task.HapiGUID, TaskInfo );
 
-        // We need to spin until instantiation is finished.
-        while( true )
+        // Start time and current poll interval, used when backing off.
+        const double TaskStartTime = FPlatformTime::Seconds();
+        float PollInterval = 0.0f;
+
+        // Last reported cook state.
+        FString LastCookStateMessage;
+
+        // We need to wait until instantiation is finished.
+        while( !bStopping )
         {
             int Status = HAPI_STATE_STARTING_COOK;
             HOUDINI_CHECK_ERROR( &Result, FHoudiniApi::GetStatus(
@@ -217,16 +276,20 @@ FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
                 // Reset update time.
                 LastUpdateTime = FPlatformTime::Seconds();
 
-                const FString& CookStateMessage = FHoudiniEngineUtils::GetCookState();
+                // Only report progress when the cook state has changed.
+                const FString CookStateMessage = FHoudiniEngineUtils::GetCookState();
+                if ( CookStateMessage != LastCookStateMessage )
+                {
+                    LastCookStateMessage = CookStateMessage;
 
-                AddResponseMessageTaskInfo(
-                    HAPI_RESULT_SUCCESS, EHoudiniEngineTaskType::AssetInstantiation,
-                    EHoudiniEngineTaskState::Processing, AssetId, Task,
-                    CookStateMessage );
+                    AddResponseMessageTaskInfo(
+                        HAPI_RESULT_SUCCESS, EHoudiniEngineTaskType::AssetInstantiation,
+                        EHoudiniEngineTaskState::Processing, AssetId, Task,
+                        CookStateMessage );
+                }
             }
 
-            // We want to yield.
-            FPlatformProcess::Sleep( 0.0f );
+            WaitForNextCookStatusPoll( TaskStartTime, PollInterval );
         }
     }
     else
@@ -243,6 +306,8 @@ FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
 void
 FHoudiniEngineScheduler::TaskCookAsset( const FHoudiniEngineTask & Task )
 {
+    SCOPE_CYCLE_COUNTER( STAT_HapiCook );
+
     if ( !FHoudiniEngineUtils::IsInitialized() )
     {
         HOUDINI_LOG_ERROR(
@@ -298,8 +363,15 @@ FHoudiniEngineScheduler::TaskCookAsset( const FHoudiniEngineTask & Task )
     // Initialize last update time.
     double LastUpdateTime = FPlatformTime::Seconds();
 
-    // We need to spin until cooking is finished.
-    while ( true )
+    // Start time and current poll interval, used when backing off.
+    const double TaskStartTime = LastUpdateTime;
+    float PollInterval = 0.0f;
+
+    // Last reported cook state.
+    FString LastCookStateMessage;
+
+    // We need to wait until cooking is finished.
+    while ( !bStopping )
     {
         int32 Status = HAPI_STATE_STARTING_COOK;
         HOUDINI_CHECK_ERROR( &Result, FHoudiniApi::GetStatus(
@@ -332,17 +404,37 @@ FHoudiniEngineScheduler::TaskCookAsset( const FHoudiniEngineTask & Task )
             // Reset update time.
             LastUpdateTime = FPlatformTime::Seconds();
 
-            // Retrieve status string.
-            const FString & CookStateMessage = FHoudiniEngineUtils::GetCookState();
+            // Retrieve status string, progress is only reported when it has changed.
+            const FString CookStateMessage = FHoudiniEngineUtils::GetCookState();
+            if ( CookStateMessage != LastCookStateMessage )
+            {
+                LastCookStateMessage = CookStateMessage;
 
-            AddResponseMessageTaskInfo(
-                HAPI_RESULT_SUCCESS, EHoudiniEngineTaskType::AssetCooking,
-                EHoudiniEngineTaskState::Processing, AssetId, Task,
-                CookStateMessage );
+                AddResponseMessageTaskInfo(
+                    HAPI_RESULT_SUCCESS, EHoudiniEngineTaskType::AssetCooking,
+                    EHoudiniEngineTaskState::Processing, AssetId, Task,
+                    CookStateMessage );
+            }
         }
 
-        // We want to yield.
-        FPlatformProcess::Sleep( 0.0f );
+        bool bSuperseded = false;
+        if ( IsRunningCookStale( Task, bSuperseded ) )
+        {
+            InterruptCook( Task );
+
+            // A superseded cook is reported by the newer cook sharing its GUID.
+            if ( !bSuperseded )
+            {
+                AddResponseMessageTaskInfo(
+                    HAPI_RESULT_USER_INTERRUPTED, EHoudiniEngineTaskType::AssetCooking,
+                    EHoudiniEngineTaskState::Interrupted, AssetId, Task,
+                    TEXT( "Cooking Interrupted" ) );
+            }
+
+            break;
+        }
+
+        WaitForNextCookStatusPoll( TaskStartTime, PollInterval );
     }
 }
 
@@ -361,6 +453,53 @@ FHoudiniEngineScheduler::TaskDeleteAsset( const FHoudiniEngineTask & Task )
     // At this point component most likely does not exist.
 }
 
+void
+FHoudiniEngineScheduler::TaskPreloadAssetLibraries( const FHoudiniEngineTask & Task )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    TArray< FString > SearchPaths;
+    HoudiniRuntimeSettings->OtlSearchPath.ParseIntoArray( SearchPaths, FPlatformMisc::GetPathVarDelimiter() );
+
+    static const TCHAR * AssetLibraryExtensions[] =
+    {
+        TEXT( "hda" ), TEXT( "hdalc" ), TEXT( "hdanc" ), TEXT( "otl" ), TEXT( "otllc" ), TEXT( "otlnc" )
+    };
+
+    const double PreloadStartTime = FPlatformTime::Seconds();
+    int32 LoadedLibraryCount = 0;
+
+    for ( const FString & SearchPath : SearchPaths )
+    {
+        // Skip Houdini's default path token.
+        if ( SearchPath == TEXT( "&" ) || !FPaths::DirectoryExists( SearchPath ) )
+            continue;
+
+        for ( const TCHAR * AssetLibraryExtension : AssetLibraryExtensions )
+        {
+            TArray< FString > AssetLibraryFiles;
+            IFileManager::Get().FindFiles( AssetLibraryFiles, *( SearchPath / TEXT( "*." ) + AssetLibraryExtension ), true, false );
+
+            for ( const FString & AssetLibraryFile : AssetLibraryFiles )
+            {
+                if ( bStopping )
+                    break;
+
+                HAPI_AssetLibraryId AssetLibraryId = -1;
+                if ( FHoudiniEngineUtils::LoadAssetLibraryFromFile( SearchPath / AssetLibraryFile, AssetLibraryId ) == HAPI_RESULT_SUCCESS )
+                    LoadedLibraryCount++;
+            }
+        }
+    }
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Preloaded %d asset libraries in Houdini Engine session %d in %.2f seconds." ),
+        LoadedLibraryCount, SessionIndex, FPlatformTime::Seconds() - PreloadStartTime );
+
+    // Nobody is waiting on this task.
+    FHoudiniEngine::Get().RemoveTaskInfo( Task.HapiGUID );
+}
+
 void
 FHoudiniEngineScheduler::AddResponseTaskInfo(
     HAPI_Result Result, EHoudiniEngineTaskType::Type TaskType, EHoudiniEngineTaskState::Type TaskState,
@@ -370,6 +509,8 @@ FHoudiniEngineScheduler::AddResponseTaskInfo(
     FString StatusString = FHoudiniEngineUtils::GetErrorDescription();
 
     TaskInfo.bLoadedComponent = Task.bLoadedComponent;
+    FillTaskMetrics( TaskInfo );
+    FillQueuedTaskCounts( TaskInfo );
     TaskDescription( TaskInfo, Task.ActorName, StatusString );
     FHoudiniEngine::Get().AddTaskInfo( Task.HapiGUID, TaskInfo );
 }
@@ -382,71 +523,346 @@ FHoudiniEngineScheduler::AddResponseMessageTaskInfo(
     FHoudiniEngineTaskInfo TaskInfo( Result, AssetId, TaskType, TaskState );
 
     TaskInfo.bLoadedComponent = Task.bLoadedComponent;
+    FillTaskMetrics( TaskInfo );
+    FillQueuedTaskCounts( TaskInfo );
     TaskDescription( TaskInfo, Task.ActorName, ErrorMessage );
     FHoudiniEngine::Get().AddTaskInfo( Task.HapiGUID, TaskInfo );
 }
 
 void
-FHoudiniEngineScheduler::ProcessQueuedTasks()
+FHoudiniEngineScheduler::FillTaskMetrics( FHoudiniEngineTaskInfo & TaskInfo ) const
 {
-    while( !bStopping )
+    TaskInfo.QueueSeconds = (float) CurrentTaskQueueSeconds;
+    TaskInfo.ElapsedSeconds = (float) ( FPlatformTime::Seconds() - CurrentTaskStartTime );
+
+    int64 HapiCallCount = 0;
+    int64 HapiBytes = 0;
+    FHoudiniApiTrace::GetThreadTotals( HapiCallCount, HapiBytes );
+    TaskInfo.HapiCallCount = (int32) ( HapiCallCount - CurrentTaskHapiCallCount );
+    TaskInfo.HapiBytes = HapiBytes - CurrentTaskHapiBytes;
+}
+
+void
+FHoudiniEngineScheduler::ProcessTask( const FHoudiniEngineTask & Task )
+{
+    CurrentTaskStartTime = FPlatformTime::Seconds();
+    CurrentTaskQueueSeconds = Task.QueuedTime > 0.0 ? CurrentTaskStartTime - Task.QueuedTime : 0.0;
+    FHoudiniApiTrace::GetThreadTotals( CurrentTaskHapiCallCount, CurrentTaskHapiBytes );
+
+    // Publish the task right away, so a task blocking in HAPI is still seen as running by the stall check.
     {
-        while ( true )
+        FScopeLock ScopeLock( &TelemetryCriticalSection );
+        Telemetry.CurrentTaskType = Task.TaskType;
+        Telemetry.CurrentTaskActorName = Task.ActorName;
+        Telemetry.CurrentTaskStartTime = CurrentTaskStartTime;
+        if ( Task.QueuedTime > 0.0 && ( Telemetry.OldestTaskQueuedTime <= 0.0 || Task.QueuedTime < Telemetry.OldestTaskQueuedTime ) )
+            Telemetry.OldestTaskQueuedTime = Task.QueuedTime;
+    }
+
+    bProcessingTask = true;
+    TelemetryBusyMark = CurrentTaskStartTime;
+    ON_SCOPE_EXIT
+    {
+        TelemetryBusySeconds += FPlatformTime::Seconds() - TelemetryBusyMark;
+        bProcessingTask = false;
+
+        FScopeLock ScopeLock( &TelemetryCriticalSection );
+        Telemetry.CurrentTaskType = EHoudiniEngineTaskType::None;
+        Telemetry.CurrentTaskActorName.Empty();
+        Telemetry.CurrentTaskStartTime = 0.0;
+    };
+
+    switch ( Task.TaskType )
+    {
+        case EHoudiniEngineTaskType::AssetInstantiation:
         {
-            FHoudiniEngineTask Task;
+            TaskInstantiateAsset( Task );
+            break;
+        }
 
-            {
-                FScopeLock ScopeLock( &CriticalSection );
+        case EHoudiniEngineTaskType::AssetCooking:
+        {
+            TaskCookAsset( Task );
+            break;
+        }
 
-                // We have no tasks left.
-                if ( PositionWrite == PositionRead )
-                    break;
+        case EHoudiniEngineTaskType::AssetDeletion:
+        {
+            TaskDeleteAsset( Task );
+            break;
+        }
+
+        case EHoudiniEngineTaskType::AssetLibraryPreload:
+        {
+            TaskPreloadAssetLibraries( Task );
+            break;
+        }
 
-                // Retrieve task.
-                Task = Tasks[ PositionRead ];
-                PositionRead++;
+        case EHoudiniEngineTaskType::SessionStartup:
+        {
+            const double StartupTime = FPlatformTime::Seconds();
+            FHoudiniEngine::Get().StartSessions();
+            FHoudiniEngine::Get().RemoveTaskInfo( Task.HapiGUID );
 
-                // Wrap around if required.
-                PositionRead &= ( TaskCount - 1 );
-            }
+            HOUDINI_LOG_MESSAGE(
+                TEXT( "Houdini Engine sessions started in %.2f seconds." ), FPlatformTime::Seconds() - StartupTime );
+            break;
+        }
 
-            bool bTaskProcessed = true;
+        default:
+        {
+            break;
+        }
+    }
+}
 
-            switch ( Task.TaskType )
-            {
-                case EHoudiniEngineTaskType::AssetInstantiation:
-                {
-                    TaskInstantiateAsset( Task );
-                    break;
-                }
+void
+FHoudiniEngineScheduler::RefillTaskBacklogs()
+{
+    for ( int32 Lane = 0; Lane < EHoudiniEngineTaskPriority::MAX; ++Lane )
+    {
+        TArray< FHoudiniEngineTask > & TaskBacklog = TaskBacklogs[ Lane ];
+        int32 & TaskBacklogHead = TaskBacklogHeads[ Lane ];
 
-                case EHoudiniEngineTaskType::AssetCooking:
-                {
-                    TaskCookAsset( Task );
-                    break;
-                }
+        // Drop the tasks we have already processed.
+        if ( TaskBacklogHead > 0 && ( TaskBacklogHead >= TaskBacklog.Num() || TaskBacklogHead >= HAPI_UNREAL_SCHEDULER_DEQUEUE_BATCH_SIZE ) )
+        {
+            TaskBacklog.RemoveAt( 0, TaskBacklogHead, false );
+            TaskBacklogHead = 0;
+        }
 
-                case EHoudiniEngineTaskType::AssetDeletion:
-                {
-                    TaskDeleteAsset( Task );
-                    break;
-                }
+        if ( DequeueTasks( ( EHoudiniEngineTaskPriority::Type ) Lane, TaskBacklog, HAPI_UNREAL_SCHEDULER_DEQUEUE_BATCH_SIZE ) <= 0 )
+            continue;
 
-                default:
-                {
-                    bTaskProcessed = false;
-                    break;
-                }
-            }
+        // Waiting tasks are kept ordered by their sort key, such as loaded assets closest to the camera first.
+        TArrayView< FHoudiniEngineTask > WaitingTasks( TaskBacklog.GetData() + TaskBacklogHead, TaskBacklog.Num() - TaskBacklogHead );
+        WaitingTasks.StableSort( []( const FHoudiniEngineTask & A, const FHoudiniEngineTask & B )
+        {
+            return A.SortKey < B.SortKey;
+        } );
+    }
+}
+
+int32
+FHoudiniEngineScheduler::PickNextLane()
+{
+    int32 PickedLane = INDEX_NONE;
 
-            if ( !bTaskProcessed )
+    // A lane that has been skipped too many times gets to run first, lowest priority first.
+    for ( int32 Lane = EHoudiniEngineTaskPriority::MAX - 1; Lane >= 0; --Lane )
+    {
+        if ( TaskBacklogHeads[ Lane ] < TaskBacklogs[ Lane ].Num() && LaneSkipCounts[ Lane ] >= HAPI_UNREAL_SCHEDULER_STARVATION_LIMIT )
+        {
+            PickedLane = Lane;
+            break;
+        }
+    }
+
+    // Otherwise pick the highest priority lane with tasks waiting.
+    if ( PickedLane == INDEX_NONE )
+    {
+        for ( int32 Lane = 0; Lane < EHoudiniEngineTaskPriority::MAX; ++Lane )
+        {
+            if ( TaskBacklogHeads[ Lane ] < TaskBacklogs[ Lane ].Num() )
+            {
+                PickedLane = Lane;
                 break;
+            }
+        }
+    }
+
+    if ( PickedLane == INDEX_NONE )
+        return INDEX_NONE;
+
+    for ( int32 Lane = 0; Lane < EHoudiniEngineTaskPriority::MAX; ++Lane )
+    {
+        if ( Lane == PickedLane )
+            LaneSkipCounts[ Lane ] = 0;
+        else if ( TaskBacklogHeads[ Lane ] < TaskBacklogs[ Lane ].Num() )
+            LaneSkipCounts[ Lane ]++;
+    }
+
+    return PickedLane;
+}
+
+void
+FHoudiniEngineScheduler::FillQueuedTaskCounts( FHoudiniEngineTaskInfo & TaskInfo ) const
+{
+    for ( int32 Lane = 0; Lane < EHoudiniEngineTaskPriority::MAX; ++Lane )
+        TaskInfo.QueuedTaskCounts[ Lane ] = QueuedTaskCounts[ Lane ].GetValue();
+}
+
+bool
+FHoudiniEngineScheduler::IsTaskSuperseded( const FHoudiniEngineTask & Task ) const
+{
+    if ( Task.TaskType != EHoudiniEngineTaskType::AssetCooking )
+        return false;
+
+    for ( int32 Lane = 0; Lane < EHoudiniEngineTaskPriority::MAX; ++Lane )
+    {
+        const TArray< FHoudiniEngineTask > & TaskBacklog = TaskBacklogs[ Lane ];
+        for ( int32 Idx = TaskBacklogHeads[ Lane ]; Idx < TaskBacklog.Num(); ++Idx )
+        {
+            const FHoudiniEngineTask & BacklogTask = TaskBacklog[ Idx ];
+            if ( BacklogTask.TaskType == EHoudiniEngineTaskType::AssetCooking && BacklogTask.HapiGUID == Task.HapiGUID )
+                return true;
+        }
+    }
+
+    return false;
+}
+
+bool
+FHoudiniEngineScheduler::IsRunningCookStale( const FHoudiniEngineTask & Task, bool & bOutSuperseded )
+{
+    bOutSuperseded = false;
+
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( !HoudiniRuntimeSettings || !HoudiniRuntimeSettings->bInterruptStaleCooks )
+        return false;
+
+    // Pull the tasks added since we started cooking, we are the only consumer.
+    RefillTaskBacklogs();
+
+    bOutSuperseded = IsTaskSuperseded( Task );
+    return bOutSuperseded || FHoudiniEngine::Get().ConsumeTaskInterruptRequest( Task.HapiGUID );
+}
+
+void
+FHoudiniEngineScheduler::InterruptCook( const FHoudiniEngineTask & Task )
+{
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "HAPI Asynchronous Cooking Interrupted for %s., AssetId = %d" ),
+        *Task.ActorName, Task.AssetId );
+
+    FHoudiniApi::Interrupt( FHoudiniEngine::Get().GetSession() );
+
+    // Wait for the session to leave the cooking state before executing the next task.
+    const double TaskStartTime = FPlatformTime::Seconds();
+    float PollInterval = 0.0f;
+    while ( !bStopping )
+    {
+        int32 Status = HAPI_STATE_STARTING_COOK;
+        if ( FHoudiniApi::GetStatus( FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status ) != HAPI_RESULT_SUCCESS )
+            break;
+
+        if ( Status <= HAPI_STATE_MAX_READY_STATE )
+            break;
+
+        WaitForNextCookStatusPoll( TaskStartTime, PollInterval );
+    }
+}
+
+void
+FHoudiniEngineScheduler::UpdateTelemetry( bool bForce )
+{
+    const double TelemetryTime = FPlatformTime::Seconds();
+    const double ElapsedSeconds = TelemetryTime - LastTelemetryTime;
+    if ( !bForce && ElapsedSeconds < HAPI_UNREAL_SCHEDULER_TELEMETRY_INTERVAL )
+        return;
+
+    if ( bProcessingTask )
+    {
+        TelemetryBusySeconds += TelemetryTime - TelemetryBusyMark;
+        TelemetryBusyMark = TelemetryTime;
+    }
+
+    // Pull the tasks added since the last refill, we are the only consumer.
+    RefillTaskBacklogs();
+
+    int32 PendingTaskCounts[ EHoudiniEngineTaskType::MAX ];
+    FMemory::Memzero( PendingTaskCounts );
+    double OldestTaskQueuedTime = 0.0;
+
+    for ( int32 Lane = 0; Lane < EHoudiniEngineTaskPriority::MAX; ++Lane )
+    {
+        const TArray< FHoudiniEngineTask > & TaskBacklog = TaskBacklogs[ Lane ];
+        for ( int32 Idx = TaskBacklogHeads[ Lane ]; Idx < TaskBacklog.Num(); ++Idx )
+        {
+            const FHoudiniEngineTask & BacklogTask = TaskBacklog[ Idx ];
+            if ( BacklogTask.TaskType >= 0 && BacklogTask.TaskType < EHoudiniEngineTaskType::MAX )
+                PendingTaskCounts[ BacklogTask.TaskType ]++;
+
+            if ( BacklogTask.QueuedTime > 0.0 && ( OldestTaskQueuedTime <= 0.0 || BacklogTask.QueuedTime < OldestTaskQueuedTime ) )
+                OldestTaskQueuedTime = BacklogTask.QueuedTime;
+        }
+    }
+
+    FScopeLock ScopeLock( &TelemetryCriticalSection );
+
+    // The task being processed is still pending.
+    if ( bProcessingTask && Telemetry.CurrentTaskType != EHoudiniEngineTaskType::None )
+    {
+        PendingTaskCounts[ Telemetry.CurrentTaskType ]++;
+        const double CurrentTaskQueuedTime = CurrentTaskStartTime - CurrentTaskQueueSeconds;
+        if ( OldestTaskQueuedTime <= 0.0 || CurrentTaskQueuedTime < OldestTaskQueuedTime )
+            OldestTaskQueuedTime = CurrentTaskQueuedTime;
+    }
+
+    FMemory::Memcpy( Telemetry.PendingTaskCounts, PendingTaskCounts, sizeof( PendingTaskCounts ) );
+    Telemetry.OldestTaskQueuedTime = OldestTaskQueuedTime;
+
+    if ( LastTelemetryTime > 0.0 && ElapsedSeconds > 0.0 )
+    {
+        Telemetry.Utilization = (float) FMath::Clamp( TelemetryBusySeconds / ElapsedSeconds, 0.0, 1.0 );
+        Telemetry.StatusPollFraction = TelemetryBusySeconds > 0.0
+            ? (float) FMath::Clamp( TelemetryPollSeconds / TelemetryBusySeconds, 0.0, 1.0 ) : 0.0f;
+    }
+
+    bTelemetryIdle = !bProcessingTask && OldestTaskQueuedTime <= 0.0;
+    LastTelemetryTime = TelemetryTime;
+    TelemetryBusySeconds = 0.0;
+    TelemetryPollSeconds = 0.0;
+}
+
+void
+FHoudiniEngineScheduler::GetTelemetry( FHoudiniEngineSchedulerTelemetry & OutTelemetry ) const
+{
+    FScopeLock ScopeLock( &TelemetryCriticalSection );
+    OutTelemetry = Telemetry;
+}
+
+void
+FHoudiniEngineScheduler::ProcessQueuedTasks()
+{
+    while( !bStopping )
+    {
+        UpdateSessionHeartbeat();
+        UpdateTelemetry( false );
+        RefillTaskBacklogs();
+
+        const int32 Lane = PickNextLane();
+        if ( Lane != INDEX_NONE )
+        {
+            FHoudiniEngineTask Task = MoveTemp( TaskBacklogs[ Lane ][ TaskBacklogHeads[ Lane ]++ ] );
+            QueuedTaskCounts[ Lane ].Decrement();
+
+            // Only the last of multiple pending cooks of the same task needs to be executed.
+            if ( !IsTaskSuperseded( Task ) )
+                ProcessTask( Task );
+
+            PendingTaskCount.Decrement();
+            continue;
         }
 
+        // Publish that we are idle before going to sleep.
+        if ( !bTelemetryIdle )
+            UpdateTelemetry( true );
+
         if ( FPlatformProcess::SupportsMultithreading() )
         {
-            // We want to yield for a bit.
-            FPlatformProcess::Sleep( 0.0f );
+            const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+            if ( TaskEvent && HoudiniRuntimeSettings && HoudiniRuntimeSettings->CookWaitMode == HRSCWM_AdaptiveBackoff )
+            {
+                // Sleep until a task is added, we are stopped or our next heartbeat is due.
+                const float HeartbeatInterval = HoudiniRuntimeSettings->SessionHeartbeatInterval;
+                TaskEvent->Wait( HeartbeatInterval > 0.0f ? (uint32) ( HeartbeatInterval * 1000.0f ) : MAX_uint32 );
+            }
+            else
+            {
+                // We want to yield for a bit.
+                FPlatformProcess::Sleep( 0.0f );
+            }
         }
         else
         {
@@ -456,65 +872,143 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
     }
 }
 
+void
+FHoudiniEngineScheduler::UpdateSessionHeartbeat()
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( !HoudiniRuntimeSettings || HoudiniRuntimeSettings->SessionHeartbeatInterval <= 0.0f )
+        return;
+
+    const double HeartbeatTime = FPlatformTime::Seconds();
+    if ( HeartbeatTime - LastHeartbeatTime < HoudiniRuntimeSettings->SessionHeartbeatInterval )
+        return;
+
+    LastHeartbeatTime = HeartbeatTime;
+
+    FHoudiniEngine & HoudiniEngine = FHoudiniEngine::Get();
+    if ( HoudiniEngine.IsSessionStarting() || !FHoudiniApi::IsHAPIInitialized() )
+        return;
+
+    // This thread may block on a dead server, callers on the game thread only read the result.
+    const HAPI_Session * Session = HoudiniEngine.GetSession();
+    const bool bAlive = Session
+        && FHoudiniApi::IsSessionValid( Session ) == HAPI_RESULT_SUCCESS
+        && FHoudiniApi::IsInitialized( Session ) == HAPI_RESULT_SUCCESS;
+
+    const EHoudiniSessionHealth::Type PreviousHealth = HoudiniEngine.GetSessionHealth( SessionIndex );
+    const EHoudiniSessionHealth::Type Health = bAlive ? EHoudiniSessionHealth::Alive : EHoudiniSessionHealth::Lost;
+    HoudiniEngine.SetSessionHealth( SessionIndex, Health, FPlatformTime::Seconds() - HeartbeatTime );
+
+    if ( Health == EHoudiniSessionHealth::Lost && PreviousHealth == EHoudiniSessionHealth::Alive )
+        HOUDINI_LOG_WARNING( TEXT( "Houdini Engine session %d stopped responding." ), SessionIndex );
+}
+
 void
 FHoudiniEngineScheduler::AddTask( const FHoudiniEngineTask & Task )
 {
-    FScopeLock ScopeLock( &CriticalSection );
+    AddTask( FHoudiniEngineTask( Task ) );
+}
+
+void
+FHoudiniEngineScheduler::AddTask( FHoudiniEngineTask && Task )
+{
+    const int32 Lane = FMath::Clamp< int32 >( Task.Priority, 0, EHoudiniEngineTaskPriority::MAX - 1 );
+    Task.QueuedTime = FPlatformTime::Seconds();
+
+    // Count the task before it becomes visible to the scheduler thread.
+    PendingTaskCount.Increment();
+    QueuedTaskCounts[ Lane ].Increment();
 
-    // Check if we need to grow our circular buffer.
-    if ( PositionWrite + 1 == PositionRead )
+    if ( !Tasks[ Lane ].Enqueue( MoveTemp( Task ) ) )
     {
-        // Calculate next size (next power of two).
-        uint32 NextTaskCount = FPlatformMath::RoundUpToPowerOfTwo( TaskCount + 1 );
+        QueuedTaskCounts[ Lane ].Decrement();
+        PendingTaskCount.Decrement();
+        return;
+    }
 
-        // Allocate new buffer.
-        FHoudiniEngineTask * Buffer = static_cast< FHoudiniEngineTask * >(
-            FMemory::Malloc( NextTaskCount * sizeof( FHoudiniEngineTask ) ) );
+    // Wake up the scheduler thread.
+    if ( TaskEvent )
+        TaskEvent->Trigger();
+}
 
-        if( !Buffer )
-            return;
+void
+FHoudiniEngineScheduler::AddTasks( TArray< FHoudiniEngineTask > && InTasks )
+{
+    const double QueuedTime = FPlatformTime::Seconds();
+    bool bTaskQueued = false;
 
-        // Zero memory.
-        FMemory::Memset( Buffer, 0x0, NextTaskCount * sizeof( FHoudiniEngineTask ) );
+    for ( FHoudiniEngineTask & Task : InTasks )
+    {
+        const int32 Lane = FMath::Clamp< int32 >( Task.Priority, 0, EHoudiniEngineTaskPriority::MAX - 1 );
+        Task.QueuedTime = QueuedTime;
 
-        // Copy elements from old buffer to new one.
-        if ( PositionRead < PositionWrite )
-        {
-            FMemory::Memcpy( Buffer, Tasks + PositionRead, sizeof( FHoudiniEngineTask ) * ( PositionWrite - PositionRead ) );
+        // Count the task before it becomes visible to the scheduler thread.
+        PendingTaskCount.Increment();
+        QueuedTaskCounts[ Lane ].Increment();
 
-            // Update index positions.
-            PositionRead = 0;
-            PositionWrite = PositionWrite - PositionRead;
-        }
-        else
+        if ( !Tasks[ Lane ].Enqueue( MoveTemp( Task ) ) )
         {
-            FMemory::Memcpy( Buffer, Tasks + PositionRead, sizeof( FHoudiniEngineTask ) * ( TaskCount - PositionRead ) );
-            FMemory::Memcpy( Buffer + TaskCount - PositionRead, Tasks, sizeof( FHoudiniEngineTask ) * PositionWrite );
-
-            // Update index positions.
-            PositionRead = 0;
-            PositionWrite = TaskCount - PositionRead + PositionWrite;
+            QueuedTaskCounts[ Lane ].Decrement();
+            PendingTaskCount.Decrement();
+            continue;
         }
 
-        // Deallocate old buffer.
-        FMemory::Free( Tasks );
+        bTaskQueued = true;
+    }
+
+    InTasks.Empty();
 
-        // Bookkeeping.
-        Tasks = Buffer;
-        TaskCount = NextTaskCount;
+    // Wake up the scheduler thread.
+    if ( bTaskQueued && TaskEvent )
+        TaskEvent->Trigger();
+}
+
+int32
+FHoudiniEngineScheduler::DequeueTasks(
+    EHoudiniEngineTaskPriority::Type Priority, TArray< FHoudiniEngineTask > & OutTasks, int32 MaxTasks )
+{
+    if ( Priority < 0 || Priority >= EHoudiniEngineTaskPriority::MAX )
+        return 0;
+
+    // Only the scheduler thread consumes tasks.
+    int32 DequeuedTaskCount = 0;
+    FHoudiniEngineTask Task;
+    while ( DequeuedTaskCount < MaxTasks && Tasks[ Priority ].Dequeue( Task ) )
+    {
+        OutTasks.Add( MoveTemp( Task ) );
+        DequeuedTaskCount++;
     }
 
-    // Store task.
-    Tasks[ PositionWrite ] = Task;
-    PositionWrite++;
+    return DequeuedTaskCount;
+}
+
+int32
+FHoudiniEngineScheduler::GetQueuedTaskCount( EHoudiniEngineTaskPriority::Type Priority ) const
+{
+    if ( Priority < 0 || Priority >= EHoudiniEngineTaskPriority::MAX )
+        return 0;
 
-    // Wrap around if required.
-    PositionWrite &= ( TaskCount - 1 );
+    return QueuedTaskCounts[ Priority ].GetValue();
+}
+
+int32
+FHoudiniEngineScheduler::GetPendingTaskCount() const
+{
+    return PendingTaskCount.GetValue();
+}
+
+int32
+FHoudiniEngineScheduler::GetSessionIndex() const
+{
+    return SessionIndex;
 }
 
 uint32
 FHoudiniEngineScheduler::Run()
 {
+    // All HAPI calls made by this thread target this scheduler's session.
+    FHoudiniScopedSession ScopedSession( SessionIndex );
+
     ProcessQueuedTasks();
     return 0;
 }
@@ -523,11 +1017,17 @@ void
 FHoudiniEngineScheduler::Stop()
 {
     bStopping = true;
+
+    // Wake up the scheduler thread so it can exit.
+    if ( TaskEvent )
+        TaskEvent->Trigger();
 }
 
 void
 FHoudiniEngineScheduler::Tick()
 {
+    FHoudiniScopedSession ScopedSession( SessionIndex );
+
     ProcessQueuedTasks();
 }
 
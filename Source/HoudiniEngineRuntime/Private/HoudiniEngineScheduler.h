@@ -35,14 +35,39 @@
 #include "HoudiniEngineTaskInfo.h"
 #include "HAL/Runnable.h"
 #include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Containers/Queue.h"
 #include "Misc/SingleThreadRunnable.h"
 
 
+/** Live telemetry of a scheduler, published by its thread and read from the game thread. **/
+struct FHoudiniEngineSchedulerTelemetry
+{
+    FHoudiniEngineSchedulerTelemetry();
+
+    /** Number of tasks queued or being processed, per task type. **/
+    int32 PendingTaskCounts[ EHoudiniEngineTaskType::MAX ];
+
+    /** Time at which the oldest pending task was queued, 0 if there are none. **/
+    double OldestTaskQueuedTime;
+
+    /** Type, actor name and start time of the task being processed, the start time is 0 while idle. **/
+    EHoudiniEngineTaskType::Type CurrentTaskType;
+    FString CurrentTaskActorName;
+    double CurrentTaskStartTime;
+
+    /** Fraction of the last telemetry interval spent processing tasks. **/
+    float Utilization;
+
+    /** Fraction of the processing time spent waiting between two cook status polls. **/
+    float StatusPollFraction;
+};
+
 class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
 {
     public:
 
-        FHoudiniEngineScheduler();
+        FHoudiniEngineScheduler( int32 InSessionIndex = 0 );
         virtual ~FHoudiniEngineScheduler();
 
     /** FRunnable methods. **/
@@ -61,6 +86,25 @@ class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
 
         /** Add a task. **/
         void AddTask( const FHoudiniEngineTask & Task );
+        void AddTask( FHoudiniEngineTask && Task );
+
+        /** Add a batch of tasks, the scheduler thread is only woken up once. **/
+        void AddTasks( TArray< FHoudiniEngineTask > && InTasks );
+
+        /** Move up to MaxTasks tasks queued in the given lane into OutTasks, return the number of dequeued tasks. **/
+        int32 DequeueTasks( EHoudiniEngineTaskPriority::Type Priority, TArray< FHoudiniEngineTask > & OutTasks, int32 MaxTasks );
+
+        /** Return the number of tasks waiting in the given priority lane. **/
+        int32 GetQueuedTaskCount( EHoudiniEngineTaskPriority::Type Priority ) const;
+
+        /** Return the number of tasks queued or being processed. **/
+        int32 GetPendingTaskCount() const;
+
+        /** Return the index of the session this scheduler executes its tasks in. **/
+        int32 GetSessionIndex() const;
+
+        /** Copy the last telemetry published by the scheduler thread. **/
+        void GetTelemetry( FHoudiniEngineSchedulerTelemetry & OutTelemetry ) const;
 
         /** Add instantiation response task info. **/
         void AddResponseTaskInfo(
@@ -78,9 +122,36 @@ class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
         /** Process queued tasks. **/
         void ProcessQueuedTasks();
 
+        /** Execute a single task. **/
+        void ProcessTask( const FHoudiniEngineTask & Task );
+
+        /** Move the tasks queued in each lane into the lane's backlog. **/
+        void RefillTaskBacklogs();
+
+        /** Pick the lane to execute the next task from, return INDEX_NONE if there are no tasks waiting. **/
+        int32 PickNextLane();
+
+        /** Store the current lane depths in the given task info. **/
+        void FillQueuedTaskCounts( FHoudiniEngineTaskInfo & TaskInfo ) const;
+
+        /** Store the queue and processing times and the HAPI traffic of the current task in the given task info. **/
+        void FillTaskMetrics( FHoudiniEngineTaskInfo & TaskInfo ) const;
+
+        /** Return true if a newer cook task with the same GUID is waiting in the backlog. **/
+        bool IsTaskSuperseded( const FHoudiniEngineTask & Task ) const;
+
+        /** Return true if the running cook of this task is stale and should be interrupted. **/
+        bool IsRunningCookStale( const FHoudiniEngineTask & Task, bool & bOutSuperseded );
+
+        /** Interrupt the running cook and wait for the session to be ready again. **/
+        void InterruptCook( const FHoudiniEngineTask & Task );
+
         /** Task : instantiate an asset. **/
         void TaskInstantiateAsset( const FHoudiniEngineTask & Task );
 
+        /** Task : load the asset libraries found in the OTL search path. **/
+        void TaskPreloadAssetLibraries( const FHoudiniEngineTask & Task );
+
         /** Task : cook an asset. **/
         void TaskCookAsset( const FHoudiniEngineTask & Task );
 
@@ -90,27 +161,71 @@ class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
         /** Delete an asset. **/
         void TaskDeleteAsset( const FHoudiniEngineTask & Task );
 
-    protected:
+        /** Check the liveness and round-trip time of our session if the heartbeat interval has elapsed. **/
+        void UpdateSessionHeartbeat();
 
-        /** Initial number of tasks in our circular queue. **/
-        static const uint32 InitialTaskSize;
+        /** Wait before polling the cook status again, PollInterval is updated when backing off. **/
+        void WaitForNextCookStatusPoll( double TaskStartTime, float & PollInterval );
+
+        /** Publish the queue depths, oldest task and utilization if the telemetry interval has elapsed. **/
+        void UpdateTelemetry( bool bForce );
 
     protected:
 
-        /** Synchronization primitive. **/
-        FCriticalSection CriticalSection;
+        /** Event used to wake up the scheduler thread when tasks are added or when stopping. **/
+        FEvent * TaskEvent;
+
+        /** Scheduled tasks per priority lane, lock-free with multiple producers and the scheduler thread as only consumer. **/
+        TQueue< FHoudiniEngineTask, EQueueMode::Mpsc > Tasks[ EHoudiniEngineTaskPriority::MAX ];
+
+        /** Tasks dequeued by the scheduler thread but not yet processed, used to coalesce cook requests. **/
+        TArray< FHoudiniEngineTask > TaskBacklogs[ EHoudiniEngineTaskPriority::MAX ];
+
+        /** Index of the next task to process in each lane's backlog. **/
+        int32 TaskBacklogHeads[ EHoudiniEngineTaskPriority::MAX ];
+
+        /** Number of times each lane has been skipped while it had tasks waiting. **/
+        int32 LaneSkipCounts[ EHoudiniEngineTaskPriority::MAX ];
+
+        /** Number of tasks waiting in each lane. **/
+        FThreadSafeCounter QueuedTaskCounts[ EHoudiniEngineTaskPriority::MAX ];
+
+        /** Number of tasks queued or being processed. **/
+        FThreadSafeCounter PendingTaskCount;
+
+        /** Index of the session, in the session pool, used by this scheduler. **/
+        int32 SessionIndex;
+
+        /** Time of the last heartbeat sent to our session. **/
+        double LastHeartbeatTime;
+
+        /** Time at which the task being processed was started, and the time it spent queued. **/
+        double CurrentTaskStartTime;
+        double CurrentTaskQueueSeconds;
+
+        /** Traced HAPI calls and bytes of the scheduler thread when the current task was started. **/
+        int64 CurrentTaskHapiCallCount;
+        int64 CurrentTaskHapiBytes;
+
+        /** Synchronization primitive for the published telemetry. **/
+        mutable FCriticalSection TelemetryCriticalSection;
+
+        /** Telemetry read by the game thread, guarded by TelemetryCriticalSection. **/
+        FHoudiniEngineSchedulerTelemetry Telemetry;
 
-        /** List of scheduled tasks. **/
-        FHoudiniEngineTask* Tasks;
+        /** Time of the last telemetry update, and the processing and polling time accumulated since. **/
+        double LastTelemetryTime;
+        double TelemetryBusySeconds;
+        double TelemetryPollSeconds;
 
-        /** Head of the circular queue. **/
-        uint32 PositionWrite;
+        /** Time up to which the processing time of the current task has been accumulated. **/
+        double TelemetryBusyMark;
 
-        /** Tail of the circular queue. **/
-        uint32 PositionRead;
+        /** Is set to true while a task is being processed. **/
+        bool bProcessingTask;
 
-        /** Size of the circular queue. **/
-        uint32 TaskCount;
+        /** Is set to true if the last published telemetry had no pending task. **/
+        bool bTelemetryIdle;
 
         /** Stopping flag. **/
         bool bStopping;
@@ -37,6 +37,9 @@
 
 #include <vector>
 
+/** Cache of the innermost string cache scope active on this thread, if any. **/
+static thread_local TMap< int32, FString > * HoudiniEngineThreadStringCache = nullptr;
+
 FHoudiniEngineString::FHoudiniEngineString()
     : StringId( -1 )
 {}
@@ -87,6 +90,15 @@ FHoudiniEngineString::ToStdString( std::string & String ) const
 {
     String = "";
 
+    if ( HoudiniEngineThreadStringCache )
+    {
+        if ( const FString * CachedString = HoudiniEngineThreadStringCache->Find( StringId ) )
+        {
+            String = TCHAR_TO_UTF8( **CachedString );
+            return true;
+        }
+    }
+
     if ( StringId >= 0 )
     {
         int32 NameLength = 0;
@@ -128,11 +140,25 @@ bool
 FHoudiniEngineString::ToFString( FString & String ) const
 {
     String = TEXT( "" );
+
+    if ( HoudiniEngineThreadStringCache )
+    {
+        if ( const FString * CachedString = HoudiniEngineThreadStringCache->Find( StringId ) )
+        {
+            String = *CachedString;
+            return true;
+        }
+    }
+
     std::string NamePlain = "";
 
     if ( ToStdString( NamePlain ) )
     {
         String = UTF8_TO_TCHAR( NamePlain.c_str() );
+
+        if ( HoudiniEngineThreadStringCache )
+            HoudiniEngineThreadStringCache->Add( StringId, String );
+
         return true;
     }
 
@@ -153,3 +179,98 @@ FHoudiniEngineString::ToFText( FText & Text ) const
 
     return false;
 }
+
+bool
+FHoudiniEngineString::ToFStringArray( const TArray< int32 > & InStringIds, TArray< FString > & OutStrings )
+{
+    OutStrings.SetNum( InStringIds.Num() );
+
+    // Resolved strings go to the current cache if there is one.
+    TMap< int32, FString > LocalStrings;
+    TMap< int32, FString > & ResolvedStrings = HoudiniEngineThreadStringCache ? *HoudiniEngineThreadStringCache : LocalStrings;
+
+    // Only request each distinct string once.
+    TArray< int32 > MissingStringIds;
+    TSet< int32 > MissingStringIdSet;
+    for ( int32 StringId : InStringIds )
+    {
+        if ( StringId < 0 || ResolvedStrings.Contains( StringId ) || MissingStringIdSet.Contains( StringId ) )
+            continue;
+
+        MissingStringIds.Add( StringId );
+        MissingStringIdSet.Add( StringId );
+    }
+
+    if ( MissingStringIds.Num() > 0 )
+    {
+        int32 BufferSize = 0;
+        if ( FHoudiniApi::GetStringBatchSize(
+            FHoudiniEngine::Get().GetSession(), MissingStringIds.GetData(),
+            MissingStringIds.Num(), &BufferSize ) != HAPI_RESULT_SUCCESS )
+        {
+            return false;
+        }
+
+        if ( BufferSize > 0 )
+        {
+            // Keep an extra null terminator, in case the last string is truncated.
+            TArray< char > Buffer;
+            Buffer.SetNumZeroed( BufferSize + 1 );
+
+            if ( FHoudiniApi::GetStringBatch(
+                FHoudiniEngine::Get().GetSession(), Buffer.GetData(), BufferSize ) != HAPI_RESULT_SUCCESS )
+            {
+                return false;
+            }
+
+            // Strings are stored in request order, each followed by a null terminator.
+            int32 Offset = 0;
+            for ( int32 Idx = 0; Idx < MissingStringIds.Num() && Offset < BufferSize; ++Idx )
+            {
+                const char * StringStart = &Buffer[ Offset ];
+                ResolvedStrings.Add( MissingStringIds[ Idx ], UTF8_TO_TCHAR( StringStart ) );
+                Offset += FCStringAnsi::Strlen( StringStart ) + 1;
+            }
+        }
+    }
+
+    bool bAllResolved = true;
+    for ( int32 Idx = 0; Idx < InStringIds.Num(); ++Idx )
+    {
+        if ( const FString * ResolvedString = ResolvedStrings.Find( InStringIds[ Idx ] ) )
+        {
+            OutStrings[ Idx ] = *ResolvedString;
+        }
+        else
+        {
+            OutStrings[ Idx ].Empty();
+            bAllResolved = false;
+        }
+    }
+
+    return bAllResolved;
+}
+
+bool
+FHoudiniEngineString::PrefetchStrings( const TArray< int32 > & InStringIds )
+{
+    // Without a cache the strings would be discarded.
+    if ( !HoudiniEngineThreadStringCache )
+        return false;
+
+    TArray< FString > Strings;
+    return ToFStringArray( InStringIds, Strings );
+}
+
+FHoudiniScopedStringCache::FHoudiniScopedStringCache()
+    : bOwnsCache( HoudiniEngineThreadStringCache == nullptr )
+{
+    if ( bOwnsCache )
+        HoudiniEngineThreadStringCache = &Strings;
+}
+
+FHoudiniScopedStringCache::~FHoudiniScopedStringCache()
+{
+    if ( bOwnsCache )
+        HoudiniEngineThreadStringCache = nullptr;
+}
@@ -98,11 +98,19 @@ FHoudiniEngineSubstance::GetSubstanceMaterialName(
 
 #if WITH_EDITOR
 
+/** Substance objects already located, the lookups go through the whole asset registry. **/
+static TMap< FString, TWeakObjectPtr< UObject > > HoudiniSubstanceInstanceFactories;
+static TMap< TWeakObjectPtr< UObject >, TWeakObjectPtr< UObject > > HoudiniSubstanceGraphInstances;
+
 UObject *
 FHoudiniEngineSubstance::LoadSubstanceInstanceFactory(
     UClass * InstanceFactoryClass,
     const FString & SubstanceMaterialName )
 {
+    TWeakObjectPtr< UObject > * CachedInstanceFactory = HoudiniSubstanceInstanceFactories.Find( SubstanceMaterialName );
+    if ( CachedInstanceFactory && CachedInstanceFactory->IsValid() && ( *CachedInstanceFactory )->IsA( InstanceFactoryClass ) )
+        return CachedInstanceFactory->Get();
+
     UObject * SubstanceInstanceFactory = nullptr;
     TArray< FAssetData > SubstanceInstaceFactories;
 
@@ -125,12 +133,19 @@ FHoudiniEngineSubstance::LoadSubstanceInstanceFactory(
         }
     }
 
+    if ( SubstanceInstanceFactory )
+        HoudiniSubstanceInstanceFactories.Add( SubstanceMaterialName, SubstanceInstanceFactory );
+
     return SubstanceInstanceFactory;
 }
 
 UObject *
 FHoudiniEngineSubstance::LoadSubstanceGraphInstance( UClass * GraphInstanceClass, UObject * InstanceFactory )
 {
+    TWeakObjectPtr< UObject > * CachedGraphInstance = HoudiniSubstanceGraphInstances.Find( InstanceFactory );
+    if ( CachedGraphInstance && CachedGraphInstance->IsValid() && ( *CachedGraphInstance )->IsA( GraphInstanceClass ) )
+        return CachedGraphInstance->Get();
+
     UObject * MatchedSubstanceGraphInstance = nullptr;
     TArray< FAssetData > SubstanceGraphInstances;
 
@@ -163,6 +178,9 @@ FHoudiniEngineSubstance::LoadSubstanceGraphInstance( UClass * GraphInstanceClass
         }
     }
 
+    if ( MatchedSubstanceGraphInstance )
+        HoudiniSubstanceGraphInstances.Add( InstanceFactory, MatchedSubstanceGraphInstance );
+
     return MatchedSubstanceGraphInstance;
 }
 
@@ -34,10 +34,14 @@
 
 FHoudiniEngineTask::FHoudiniEngineTask()
     : TaskType( EHoudiniEngineTaskType::None )
+    , Priority( EHoudiniEngineTaskPriority::Normal )
+    , SortKey( 0.0f )
     , ActorName( TEXT( "" ) )
     , AssetId( -1 )
     , AssetLibraryId( -1 )
     , AssetHapiName( -1 )
+    , SessionIndex( 0 )
+    , QueuedTime( 0.0 )
     , bLoadedComponent( false )
 {
     HapiGUID.Invalidate();
@@ -46,9 +50,13 @@ FHoudiniEngineTask::FHoudiniEngineTask()
 FHoudiniEngineTask::FHoudiniEngineTask( EHoudiniEngineTaskType::Type InTaskType, FGuid InHapiGUID )
     : HapiGUID( InHapiGUID )
     , TaskType( InTaskType )
+    , Priority( EHoudiniEngineTaskPriority::Normal )
+    , SortKey( 0.0f )
     , ActorName( TEXT( "" ) )
     , AssetId( -1 )
     , AssetLibraryId( -1 )
     , AssetHapiName( -1 )
+    , SessionIndex( 0 )
+    , QueuedTime( 0.0 )
     , bLoadedComponent( false )
 {}
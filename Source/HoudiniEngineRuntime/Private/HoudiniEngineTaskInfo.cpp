@@ -38,8 +38,14 @@ FHoudiniEngineTaskInfo::FHoudiniEngineTaskInfo()
     , AssetId( -1 )
     , TaskType( EHoudiniEngineTaskType::None )
     , TaskState( EHoudiniEngineTaskState::None )
+    , QueueSeconds( 0.0f )
+    , ElapsedSeconds( 0.0f )
+    , HapiCallCount( 0 )
+    , HapiBytes( 0 )
     , bLoadedComponent( false )
-{}
+{
+    FMemory::Memzero( QueuedTaskCounts, sizeof( QueuedTaskCounts ) );
+}
 
 FHoudiniEngineTaskInfo::FHoudiniEngineTaskInfo(
     HAPI_Result InResult, HAPI_NodeId InAssetId,
@@ -49,5 +55,11 @@ FHoudiniEngineTaskInfo::FHoudiniEngineTaskInfo(
     , AssetId( InAssetId )
     , TaskType( InTaskType )
     , TaskState( InTaskState )
+    , QueueSeconds( 0.0f )
+    , ElapsedSeconds( 0.0f )
+    , HapiCallCount( 0 )
+    , HapiBytes( 0 )
     , bLoadedComponent( false )
-{}
+{
+    FMemory::Memzero( QueuedTaskCounts, sizeof( QueuedTaskCounts ) );
+}
@@ -0,0 +1,144 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineTempPackageCleanup.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniEngine.h"
+
+#include "Engine/StaticMesh.h"
+#include "UObject/Package.h"
+
+#if WITH_EDITOR
+
+DECLARE_CYCLE_STAT( TEXT( "Houdini: Temp Package Cleanup" ), STAT_TempPackageCleanup, STATGROUP_HoudiniEngine );
+
+FHoudiniEngineTempPackageCleanup::FHoudiniEngineTempPackageCleanup()
+    : LastAddTime( 0.0 )
+{}
+
+FHoudiniEngineTempPackageCleanup::~FHoudiniEngineTempPackageCleanup()
+{
+    if ( TickerHandle.IsValid() )
+    {
+        FTicker::GetCoreTicker().RemoveTicker( TickerHandle );
+        TickerHandle.Reset();
+    }
+}
+
+void
+FHoudiniEngineTempPackageCleanup::AddStaticMesh( UStaticMesh * StaticMesh )
+{
+    if ( !StaticMesh || StaticMesh->IsPendingKill() )
+        return;
+
+    StaticMeshes.AddUnique( StaticMesh );
+    LastAddTime = FPlatformTime::Seconds();
+    UpdateTicker();
+}
+
+void
+FHoudiniEngineTempPackageCleanup::AddPackage( UPackage * Package )
+{
+    if ( !Package || Package->IsPendingKill() )
+        return;
+
+    Packages.AddUnique( Package );
+    LastAddTime = FPlatformTime::Seconds();
+    UpdateTicker();
+}
+
+bool
+FHoudiniEngineTempPackageCleanup::HasPendingCleanup() const
+{
+    return StaticMeshes.Num() > 0 || Packages.Num() > 0;
+}
+
+bool
+FHoudiniEngineTempPackageCleanup::Flush()
+{
+    SCOPE_CYCLE_COUNTER( STAT_TempPackageCleanup );
+
+    bool bReleased = false;
+    for ( TWeakObjectPtr< UStaticMesh > & StaticMeshPtr : StaticMeshes )
+    {
+        UStaticMesh * StaticMesh = StaticMeshPtr.Get();
+        if ( !StaticMesh || StaticMesh->IsPendingKill() )
+            continue;
+
+        // Only release generated meshes which have not been saved manually.
+        UPackage * Package = Cast< UPackage >( StaticMesh->GetOuter() );
+        if ( Package && Package->bHasBeenFullyLoaded )
+            continue;
+
+        // Meshes still used elsewhere, by a copy of the component or the undo buffer, survive the collection.
+        StaticMesh->ClearFlags( RF_Standalone );
+        bReleased = true;
+    }
+
+    for ( TWeakObjectPtr< UPackage > & PackagePtr : Packages )
+    {
+        UPackage * Package = PackagePtr.Get();
+        if ( !Package || Package->IsPendingKill() )
+            continue;
+
+        Package->ClearFlags( RF_Standalone );
+        Package->ConditionalBeginDestroy();
+        bReleased = true;
+    }
+
+    StaticMeshes.Empty();
+    Packages.Empty();
+
+    return bReleased;
+}
+
+void
+FHoudiniEngineTempPackageCleanup::UpdateTicker()
+{
+    if ( HasPendingCleanup() && !TickerHandle.IsValid() )
+    {
+        TickerHandle = FTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw( this, &FHoudiniEngineTempPackageCleanup::Tick ),
+            HAPI_UNREAL_TEMP_PACKAGE_CLEANUP_INTERVAL );
+    }
+}
+
+bool
+FHoudiniEngineTempPackageCleanup::Tick( float DeltaTime )
+{
+    // Wait for the cooks and post cooks in progress, and for a quiet moment after the last released object.
+    const bool bCooking = FHoudiniEngine::Get().GetCookDispatcher().HasTickingComponents();
+    const bool bRecentlyAdded = ( FPlatformTime::Seconds() - LastAddTime ) < HAPI_UNREAL_TEMP_PACKAGE_CLEANUP_INTERVAL;
+    if ( HasPendingCleanup() && ( bCooking || bRecentlyAdded ) )
+        return true;
+
+    // A single collection finds whatever is no longer referenced in the whole batch.
+    if ( Flush() && GEngine )
+        GEngine->ForceGarbageCollection( false );
+
+    TickerHandle.Reset();
+    return false;
+}
+
+#endif
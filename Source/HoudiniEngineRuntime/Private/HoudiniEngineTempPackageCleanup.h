@@ -0,0 +1,79 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtr.h"
+
+#if WITH_EDITOR
+
+class UStaticMesh;
+class UPackage;
+
+/** Releases the temporary cook outputs no longer used by their components in deferred batches, once no cook is **/
+/** running. Released objects lose their standalone flag and a single garbage collection deletes the ones nothing **/
+/** references anymore, instead of querying the references of each object.                                        **/
+class FHoudiniEngineTempPackageCleanup
+{
+    public:
+
+        FHoudiniEngineTempPackageCleanup();
+        ~FHoudiniEngineTempPackageCleanup();
+
+    public:
+
+        /** Queue a generated static mesh which is no longer used by its component. **/
+        void AddStaticMesh( UStaticMesh * StaticMesh );
+
+        /** Queue a temporary cook package, its material, texture or layer objects are released with it. **/
+        void AddPackage( UPackage * Package );
+
+        /** Release all the queued objects now. Returns true if anything was released. **/
+        bool Flush();
+
+        /** Return true if objects are waiting to be released. **/
+        bool HasPendingCleanup() const;
+
+    protected:
+
+        /** Ticker callback, releases the queued objects once cooks are done. **/
+        bool Tick( float DeltaTime );
+
+        /** Add our ticker if objects are queued. **/
+        void UpdateTicker();
+
+    protected:
+
+        /** Queued static meshes and packages. **/
+        TArray< TWeakObjectPtr< UStaticMesh > > StaticMeshes;
+        TArray< TWeakObjectPtr< UPackage > > Packages;
+
+        /** Handle of our core ticker delegate, only valid while objects are queued. **/
+        FDelegateHandle TickerHandle;
+
+        /** Last time an object was queued. **/
+        double LastAddTime;
+};
+
+#endif
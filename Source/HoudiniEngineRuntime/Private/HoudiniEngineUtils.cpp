@@ -39,6 +39,7 @@
 #include "LandscapeComponent.h"
 #include "HoudiniInstancedActorComponent.h"
 #include "HoudiniMeshSplitInstancerComponent.h"
+#include "HoudiniCookProfile.h"
 
 #include "CoreMinimal.h"
 #include "AI/Navigation/NavCollisionBase.h"
@@ -64,8 +65,10 @@
 #include "Rendering/SkeletalMeshModel.h"
 #include "SkeletalMeshTypes.h"
 #include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
 #include "Materials/MaterialInterface.h"
 #include "Materials/Material.h"
+#include "Engine/Texture2D.h"
 
 #if PLATFORM_WINDOWS
     #include "Windows/WindowsHWrapper.h"
@@ -81,12 +84,15 @@
 
 #include "HAL/PlatformMisc.h"
 #include "HAL/PlatformApplicationMisc.h"
+#include "Async/ParallelFor.h"
+#include "Async/Async.h"
 
 #include "Internationalization/Internationalization.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
 
 DECLARE_CYCLE_STAT( TEXT( "Houdini: Build Static Mesh" ), STAT_BuildStaticMesh, STATGROUP_HoudiniEngine );
+DECLARE_CYCLE_STAT( TEXT( "Houdini: Create Static Meshes" ), STAT_CreateStaticMeshes, STATGROUP_HoudiniEngine );
 
 const FString kResultStringSuccess( TEXT( "Success" ) );
 const FString kResultStringFailure( TEXT( "Generic Failure" ) );
@@ -111,6 +117,48 @@ const FString kResultStringUserInterrupted(TEXT("User Interrupt"));
 const FString kResultStringInvalidSession(TEXT("Invalid Session"));
 const FString kResultStringUnknowFailure(TEXT("Unknown Failure"));
 
+/** Part buffers of the outermost scratch scope active on this thread, if any. **/
+static thread_local FHoudiniPartScratchBuffers * HoudiniEngineThreadPartScratchBuffers = nullptr;
+
+void
+FHoudiniPartScratchBuffers::Reset()
+{
+    Positions.Reset();
+    Normals.Reset();
+    Colors.Reset();
+    Alphas.Reset();
+
+    UVs.SetNum( MAX_STATIC_TEXCOORDS );
+    for ( TArray< float > & UVChannel : UVs )
+        UVChannel.Reset();
+
+    FaceMaterialOverrideNames.Reset();
+    FaceMaterialOverrides.Reset();
+    FaceSmoothingMasks.Reset();
+    LightMapResolutions.Reset();
+    VertexList.Reset();
+    GroupNames.Reset();
+}
+
+FHoudiniScopedPartScratchBuffers::FHoudiniScopedPartScratchBuffers()
+    : bOwnsBuffers( HoudiniEngineThreadPartScratchBuffers == nullptr )
+{
+    if ( bOwnsBuffers )
+        HoudiniEngineThreadPartScratchBuffers = &Buffers;
+}
+
+FHoudiniScopedPartScratchBuffers::~FHoudiniScopedPartScratchBuffers()
+{
+    if ( bOwnsBuffers )
+        HoudiniEngineThreadPartScratchBuffers = nullptr;
+}
+
+FHoudiniPartScratchBuffers &
+FHoudiniScopedPartScratchBuffers::Get()
+{
+    return *HoudiniEngineThreadPartScratchBuffers;
+}
+
 const int32
 FHoudiniEngineUtils::PackageGUIDComponentNameLength = 12;
 
@@ -257,8 +305,22 @@ FHoudiniEngineUtils::GetCookResult()
 bool
 FHoudiniEngineUtils::IsInitialized()
 {
-    return ( FHoudiniApi::IsHAPIInitialized() &&
-        FHoudiniApi::IsInitialized( FHoudiniEngine::Get().GetSession() ) == HAPI_RESULT_SUCCESS );
+    // The session must not be used while it is being started by the scheduler.
+    if ( !FHoudiniApi::IsHAPIInitialized() || FHoudiniEngine::Get().IsSessionStarting() )
+        return false;
+
+    // Rely on the scheduler's heartbeat when it has measured the session, so we never block on a dead server.
+    switch ( FHoudiniEngine::Get().GetSessionHealth( FHoudiniScopedSession::GetCurrentSessionIndex() ) )
+    {
+        case EHoudiniSessionHealth::Alive:
+            return true;
+
+        case EHoudiniSessionHealth::Lost:
+            return false;
+
+        default:
+            return FHoudiniApi::IsInitialized( FHoudiniEngine::Get().GetSession() ) == HAPI_RESULT_SUCCESS;
+    }
 }
 
 bool
@@ -432,6 +494,12 @@ FHoudiniEngineUtils::ConvertUnrealString( const FString & UnrealString, std::str
 
 void
 FHoudiniEngineUtils::TranslateHapiTransform( const HAPI_Transform & HapiTransform, FTransform & UnrealTransform )
+{
+    FHoudiniEngineUtils::TranslateHapiTransforms( &HapiTransform, 1, &UnrealTransform );
+}
+
+void
+FHoudiniEngineUtils::TranslateHapiTransforms( const HAPI_Transform * HapiTransforms, int32 Count, FTransform * UnrealTransforms )
 {
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
 
@@ -444,40 +512,42 @@ FHoudiniEngineUtils::TranslateHapiTransform( const HAPI_Transform & HapiTransfor
         ImportAxis = HoudiniRuntimeSettings->ImportAxis;
     }
 
-    if ( ImportAxis == HRSAI_Unreal )
+    if ( ImportAxis != HRSAI_Unreal && ImportAxis != HRSAI_Houdini )
     {
-        FQuat ObjectRotation(
-            HapiTransform.rotationQuaternion[ 0 ], HapiTransform.rotationQuaternion[ 1 ],
-            HapiTransform.rotationQuaternion[ 2 ],  -HapiTransform.rotationQuaternion[ 3 ]);
-        Swap( ObjectRotation.Y, ObjectRotation.Z );
-
-        FVector ObjectTranslation( HapiTransform.position[ 0 ], HapiTransform.position[ 1 ], HapiTransform.position[ 2 ] );
-        ObjectTranslation *= TransformScaleFactor;
-        Swap( ObjectTranslation[ 2 ], ObjectTranslation[ 1 ] );
+        // Not valid enum value.
+        check( 0 );
+        return;
+    }
 
-        FVector ObjectScale3D( HapiTransform.scale[ 0 ], HapiTransform.scale[ 1 ], HapiTransform.scale[ 2 ] );
-        Swap( ObjectScale3D.Y, ObjectScale3D.Z );
+    // Unreal's axis swaps Y and Z and inverts the rotation.
+    const bool bSwapYZ = ImportAxis == HRSAI_Unreal;
+    const VectorRegister RotationSign = bSwapYZ ? MakeVectorRegister( 1.0f, 1.0f, 1.0f, -1.0f ) : VectorOne();
+    const VectorRegister TranslationScale = VectorSetFloat1( TransformScaleFactor );
 
-        UnrealTransform.SetComponents( ObjectRotation, ObjectTranslation, ObjectScale3D );
-    }
-    else if ( ImportAxis == HRSAI_Houdini )
+    for ( int32 Idx = 0; Idx < Count; ++Idx )
     {
-        FQuat ObjectRotation(
-            HapiTransform.rotationQuaternion[ 0 ], HapiTransform.rotationQuaternion[ 1 ],
-            HapiTransform.rotationQuaternion[ 2 ], HapiTransform.rotationQuaternion[ 3 ] );
+        const HAPI_Transform & HapiTransform = HapiTransforms[ Idx ];
 
-        FVector ObjectTranslation(
-            HapiTransform.position[ 0 ], HapiTransform.position[ 1 ], HapiTransform.position[ 2 ] );
-        ObjectTranslation *= TransformScaleFactor;
+        VectorRegister Rotation = VectorMultiply( VectorLoad( HapiTransform.rotationQuaternion ), RotationSign );
+        VectorRegister Translation = VectorMultiply( VectorLoadFloat3( HapiTransform.position ), TranslationScale );
+        VectorRegister Scale3D = VectorLoadFloat3( HapiTransform.scale );
 
-        FVector ObjectScale3D( HapiTransform.scale[ 0 ], HapiTransform.scale[ 1 ], HapiTransform.scale[ 2 ] );
+        if ( bSwapYZ )
+        {
+            Rotation = VectorSwizzle( Rotation, 0, 2, 1, 3 );
+            Translation = VectorSwizzle( Translation, 0, 2, 1, 3 );
+            Scale3D = VectorSwizzle( Scale3D, 0, 2, 1, 3 );
+        }
 
-        UnrealTransform.SetComponents( ObjectRotation, ObjectTranslation, ObjectScale3D );
-    }
-    else
-    {
-        // Not valid enum value.
-        check( 0 );
+        FQuat ObjectRotation;
+        FVector ObjectTranslation;
+        FVector ObjectScale3D;
+
+        VectorStoreAligned( Rotation, &ObjectRotation );
+        VectorStoreFloat3( Translation, &ObjectTranslation );
+        VectorStoreFloat3( Scale3D, &ObjectScale3D );
+
+        UnrealTransforms[ Idx ].SetComponents( ObjectRotation, ObjectTranslation, ObjectScale3D );
     }
 }
 
@@ -732,8 +802,10 @@ FHoudiniEngineUtils::HapiGetGroupNames(
 bool
 FHoudiniEngineUtils::HapiGetGroupMembership(
     HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId, HAPI_PartId PartId,
-    HAPI_GroupType GroupType, const FString & GroupName, TArray< int32 > & GroupMembership )
+    HAPI_GroupType GroupType, const FString & GroupName, FHoudiniGroupMembership & GroupMembership )
 {
+    GroupMembership.Reset();
+
     HAPI_PartInfo PartInfo;
     HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetPartInfo(
         FHoudiniEngine::Get().GetSession(), GeoId, PartId, &PartInfo ), false );
@@ -743,24 +815,75 @@ FHoudiniEngineUtils::HapiGetGroupMembership(
     if ( ElementCount < 1 )
         return false;
 
-    GroupMembership.SetNumUninitialized( ElementCount );
+    TArray< int32 > Membership;
+    Membership.SetNumUninitialized( ElementCount );
 
     if ( !PartInfo.isInstanced )
     {
         HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetGroupMembership(
             FHoudiniEngine::Get().GetSession(), GeoId, PartId, GroupType,
-            ConvertedGroupName.c_str(), NULL, &GroupMembership[ 0 ], 0, ElementCount ), false );
+            ConvertedGroupName.c_str(), NULL, &Membership[ 0 ], 0, ElementCount ), false );
     }
     else
     {
         HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetGroupMembershipOnPackedInstancePart(
             FHoudiniEngine::Get().GetSession(), GeoId, PartId, GroupType,
-            ConvertedGroupName.c_str(), NULL, &GroupMembership[ 0 ], 0, ElementCount ), false );
+            ConvertedGroupName.c_str(), NULL, &Membership[ 0 ], 0, ElementCount ), false );
     }
 
+    GroupMembership.Pack( Membership.GetData(), ElementCount );
     return true;
 }
 
+bool
+FHoudiniEngineUtils::HapiGetGroupMemberships(
+    HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId, HAPI_PartId PartId,
+    HAPI_GroupType GroupType, const TArray< FString > & GroupNames, TArray< FHoudiniGroupMembership > & GroupMemberships )
+{
+    GroupMemberships.SetNum( GroupNames.Num() );
+    for ( FHoudiniGroupMembership & GroupMembership : GroupMemberships )
+        GroupMembership.Reset();
+
+    HAPI_PartInfo PartInfo;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetPartInfo(
+        FHoudiniEngine::Get().GetSession(), GeoId, PartId, &PartInfo ), false );
+
+    int32 ElementCount = FHoudiniEngineUtils::HapiGetElementCountByGroupType( GroupType, PartInfo );
+    if ( ElementCount < 1 )
+        return false;
+
+    // HAPI returns one int per element, the same buffer receives all groups before they are packed.
+    TArray< int32 > Membership;
+    Membership.SetNumUninitialized( ElementCount );
+
+    bool bSuccess = true;
+    for ( int32 GroupIdx = 0; GroupIdx < GroupNames.Num(); ++GroupIdx )
+    {
+        std::string ConvertedGroupName = TCHAR_TO_UTF8( *GroupNames[ GroupIdx ] );
+
+        HAPI_Result Result = HAPI_RESULT_SUCCESS;
+        if ( !PartInfo.isInstanced )
+        {
+            Result = FHoudiniApi::GetGroupMembership(
+                FHoudiniEngine::Get().GetSession(), GeoId, PartId, GroupType,
+                ConvertedGroupName.c_str(), NULL, Membership.GetData(), 0, ElementCount );
+        }
+        else
+        {
+            Result = FHoudiniApi::GetGroupMembershipOnPackedInstancePart(
+                FHoudiniEngine::Get().GetSession(), GeoId, PartId, GroupType,
+                ConvertedGroupName.c_str(), NULL, Membership.GetData(), 0, ElementCount );
+        }
+
+        if ( Result == HAPI_RESULT_SUCCESS )
+            GroupMemberships[ GroupIdx ].Pack( Membership.GetData(), ElementCount );
+        else
+            bSuccess = false;
+    }
+
+    return bSuccess;
+}
+
 bool
 FHoudiniEngineUtils::HapiCheckGroupMembership(
     const FHoudiniGeoPartObject & HoudiniGeoPartObject, HAPI_GroupType GroupType, const FString & GroupName )
@@ -775,15 +898,9 @@ FHoudiniEngineUtils::HapiCheckGroupMembership(
     HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId, HAPI_PartId PartId,
     HAPI_GroupType GroupType, const FString & GroupName )
 {
-    TArray< int32 > GroupMembership;
+    FHoudiniGroupMembership GroupMembership;
     if ( FHoudiniEngineUtils::HapiGetGroupMembership( AssetId, ObjectId, GeoId, PartId, GroupType, GroupName, GroupMembership ) )
-    {
-        int32 GroupSum = 0;
-        for ( int32 Idx = 0; Idx < GroupMembership.Num(); ++Idx )
-            GroupSum += GroupMembership[ Idx ];
-
-        return GroupSum > 0;
-    }
+        return GroupMembership.HasMembers();
 
     return false;
 }
@@ -887,6 +1004,17 @@ FHoudiniEngineUtils::HapiCheckAttributeExists(
 }
 
 
+int32
+FHoudiniEngineUtils::GetChunkedImportLength( int32 Count, int32 TupleSize )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    const int32 Threshold = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->ChunkedImportPrimitiveThreshold : 0;
+    if ( Threshold <= 0 || Count <= Threshold )
+        return FMath::Max( Count, 1 );
+
+    return FMath::Max( HAPI_UNREAL_CHUNKED_IMPORT_CHUNK_SIZE / FMath::Max( TupleSize, 1 ), 1 );
+}
+
 bool
 FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
     HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
@@ -930,9 +1058,15 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
     // Allocate sufficient buffer for data.
     Data.SetNumUninitialized( AttributeInfo.count * AttributeInfo.tupleSize );
 
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeFloatData(
-        FHoudiniEngine::Get().GetSession(), GeoId, PartId, Name,
-        &AttributeInfo, -1, &Data[ 0 ], 0, AttributeInfo.count ), false );
+    // Large attributes are read in chunks, so that the transfer buffers stay bounded.
+    const int32 ChunkLength = FHoudiniEngineUtils::GetChunkedImportLength( AttributeInfo.count, AttributeInfo.tupleSize );
+    for ( int32 ChunkStart = 0; ChunkStart < AttributeInfo.count; ChunkStart += ChunkLength )
+    {
+        const int32 Length = FMath::Min( ChunkLength, AttributeInfo.count - ChunkStart );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), GeoId, PartId, Name,
+            &AttributeInfo, -1, Data.GetData() + ChunkStart * AttributeInfo.tupleSize, ChunkStart, Length ), false );
+    }
 
     // Store the retrieved attribute information.
     ResultAttributeInfo = AttributeInfo;
@@ -993,9 +1127,15 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
     // Allocate sufficient buffer for data.
     Data.SetNumUninitialized( AttributeInfo.count * AttributeInfo.tupleSize );
 
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeIntData(
-        FHoudiniEngine::Get().GetSession(),
-        GeoId, PartId, Name, &AttributeInfo, -1, &Data[ 0 ], 0, AttributeInfo.count ), false );
+    // Large attributes are read in chunks, so that the transfer buffers stay bounded.
+    const int32 ChunkLength = FHoudiniEngineUtils::GetChunkedImportLength( AttributeInfo.count, AttributeInfo.tupleSize );
+    for ( int32 ChunkStart = 0; ChunkStart < AttributeInfo.count; ChunkStart += ChunkLength )
+    {
+        const int32 Length = FMath::Min( ChunkLength, AttributeInfo.count - ChunkStart );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeIntData(
+            FHoudiniEngine::Get().GetSession(),
+            GeoId, PartId, Name, &AttributeInfo, -1, Data.GetData() + ChunkStart * AttributeInfo.tupleSize, ChunkStart, Length ), false );
+    }
 
     // Store the retrieved attribute information.
     ResultAttributeInfo = AttributeInfo;
@@ -1020,11 +1160,37 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
     HAPI_PartId PartId, const char * Name, HAPI_AttributeInfo & ResultAttributeInfo,
     TArray< FString > & Data, int32 TupleSize, HAPI_AttributeOwner Owner )
 {
-    ResultAttributeInfo.exists = false;
-
     // Reset container size.
     Data.Empty();
 
+    TArray< FString > Strings;
+    TArray< int32 > StringIndices;
+    if ( !FHoudiniEngineUtils::HapiGetAttributeDataAsStringTable(
+        AssetId, ObjectId, GeoId, PartId, Name, ResultAttributeInfo,
+        Strings, StringIndices, TupleSize, Owner ) )
+    {
+        return false;
+    }
+
+    Data.SetNum( StringIndices.Num() );
+    for ( int32 Idx = 0; Idx < StringIndices.Num(); ++Idx )
+        Data[ Idx ] = Strings[ StringIndices[ Idx ] ];
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiGetAttributeDataAsStringTable(
+    HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
+    HAPI_PartId PartId, const char * Name, HAPI_AttributeInfo & ResultAttributeInfo,
+    TArray< FString > & Strings, TArray< int32 > & StringIndices, int32 TupleSize, HAPI_AttributeOwner Owner )
+{
+    ResultAttributeInfo.exists = false;
+
+    // Reset container sizes.
+    Strings.Empty();
+    StringIndices.Empty();
+
     int32 OriginalTupleSize = TupleSize;
     HAPI_AttributeInfo AttributeInfo;
     FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
@@ -1060,25 +1226,27 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
         FHoudiniEngine::Get().GetSession(), GeoId, PartId, Name, &AttributeInfo,
         &StringHandles[ 0 ], 0, AttributeInfo.count ), false );
 
-    // Use a map to minimize the number of HAPI calls for performance!
-    TMap<int32, FString> StringHandleToStringMap;
+    // Map each distinct handle to an entry of the table, elements often share the handle of the previous one.
+    TArray< HAPI_StringHandle > UniqueStringHandles;
+    TMap< HAPI_StringHandle, int32 > UniqueStringIndices;
+    StringIndices.SetNumUninitialized( StringHandles.Num() );
+
+    int32 LastStringIndex = INDEX_NONE;
     for ( int32 Idx = 0; Idx < StringHandles.Num(); ++Idx )
     {
-        FString* FoundString = StringHandleToStringMap.Find( StringHandles[ Idx ] );
-        if ( FoundString )
-        {
-            Data.Add( *FoundString );
-        }
-        else
+        HAPI_StringHandle StringHandle = StringHandles[ Idx ];
+        if ( LastStringIndex == INDEX_NONE || UniqueStringHandles[ LastStringIndex ] != StringHandle )
         {
-            FString HapiString = TEXT("");
-            FHoudiniEngineString HoudiniEngineString( StringHandles[ Idx ] );
-            HoudiniEngineString.ToFString( HapiString );
-            StringHandleToStringMap.Add( StringHandles[Idx], HapiString );
-            Data.Add( *HapiString );
+            int32 * FoundStringIndex = UniqueStringIndices.Find( StringHandle );
+            LastStringIndex = FoundStringIndex ? *FoundStringIndex : UniqueStringIndices.Add( StringHandle, UniqueStringHandles.Add( StringHandle ) );
         }
+
+        StringIndices[ Idx ] = LastStringIndex;
     }
 
+    // Resolve all the distinct strings with a single batch request.
+    FHoudiniEngineString::ToFStringArray( UniqueStringHandles, Strings );
+
     // Store the retrieved attribute information.
     ResultAttributeInfo = AttributeInfo;
     return true;
@@ -1120,13 +1288,8 @@ FHoudiniEngineUtils::HapiGetInstanceTransforms(
         GeoId, HAPI_SRT, &InstanceTransforms[ 0 ],
         0, PartInfo.pointCount ), false );
 
-    for ( int32 Idx = 0; Idx < PartInfo.pointCount; ++Idx )
-    {
-        const HAPI_Transform& HapiInstanceTransform = InstanceTransforms[ Idx ];
-        FTransform TransformMatrix;
-        FHoudiniEngineUtils::TranslateHapiTransform( HapiInstanceTransform, TransformMatrix );
-        Transforms.Add( TransformMatrix );
-    }
+    Transforms.SetNum( PartInfo.pointCount );
+    FHoudiniEngineUtils::TranslateHapiTransforms( InstanceTransforms.GetData(), PartInfo.pointCount, Transforms.GetData() );
 
     return true;
 }
@@ -1165,6 +1328,153 @@ FHoudiniEngineUtils::PickVertexColorFromTextureMip(
     return ResultColor;
 }
 
+bool
+FHoudiniTextureMipColors::Decode( UTexture2D * Texture, int32 MipIndex )
+{
+    Colors.Reset();
+    Width = 0;
+    Height = 0;
+
+#if WITH_EDITOR
+
+    if ( !Texture )
+        return false;
+
+    const ETextureSourceFormat SourceFormat = Texture->Source.GetFormat();
+    if ( SourceFormat != TSF_BGRA8 && SourceFormat != TSF_G8 )
+        return false;
+
+    TArray< uint8 > MipData;
+    if ( !Texture->Source.GetMipData( MipData, MipIndex ) )
+        return false;
+
+    const int32 MipWidth = FMath::Max( Texture->Source.GetSizeX() >> MipIndex, 1 );
+    const int32 MipHeight = FMath::Max( Texture->Source.GetSizeY() >> MipIndex, 1 );
+    const int32 PixelCount = MipWidth * MipHeight;
+    const int32 BytesPerPixel = SourceFormat == TSF_BGRA8 ? 4 : 1;
+    if ( MipData.Num() < PixelCount * BytesPerPixel )
+        return false;
+
+    Colors.SetNumUninitialized( PixelCount );
+    if ( SourceFormat == TSF_BGRA8 )
+    {
+        // FColor is stored as BGRA, the mip can be copied as is.
+        FMemory::Memcpy( Colors.GetData(), MipData.GetData(), PixelCount * sizeof( FColor ) );
+    }
+    else
+    {
+        for ( int32 PixelIdx = 0; PixelIdx < PixelCount; ++PixelIdx )
+        {
+            const uint8 Gray = MipData[ PixelIdx ];
+            Colors[ PixelIdx ] = FColor( Gray, Gray, Gray, 255 );
+        }
+    }
+
+    Width = MipWidth;
+    Height = MipHeight;
+    return true;
+
+#else
+
+    return false;
+
+#endif // WITH_EDITOR
+}
+
+FColor
+FHoudiniTextureMipColors::Sample( const FVector2D & UVCoord ) const
+{
+    if ( !IsValid() || UVCoord.X < 0.0f || UVCoord.X >= 1.0f || UVCoord.Y < 0.0f || UVCoord.Y >= 1.0f )
+        return FColor( 0, 0, 0, 255 );
+
+    const int32 X = FMath::Min( (int32)( Width * UVCoord.X ), Width - 1 );
+    const int32 Y = FMath::Min( (int32)( Height * UVCoord.Y ), Height - 1 );
+
+    return Colors[ Y * Width + X ];
+}
+
+/** Return the number of set bits of a membership word. **/
+static int32
+HoudiniEngineCountMembershipBits( uint32 Bits )
+{
+    Bits = Bits - ( ( Bits >> 1 ) & 0x55555555u );
+    Bits = ( Bits & 0x33333333u ) + ( ( Bits >> 2 ) & 0x33333333u );
+    return (int32)( ( ( ( Bits + ( Bits >> 4 ) ) & 0x0F0F0F0Fu ) * 0x01010101u ) >> 24 );
+}
+
+void
+FHoudiniGroupMembership::Reset()
+{
+    Words.Reset();
+    ElementCount = 0;
+}
+
+void
+FHoudiniGroupMembership::Init( int32 InElementCount )
+{
+    ElementCount = FMath::Max( InElementCount, 0 );
+    Words.Init( 0u, ( ElementCount + 31 ) >> 5 );
+}
+
+void
+FHoudiniGroupMembership::Pack( const int32 * Membership, int32 InElementCount )
+{
+    Init( InElementCount );
+
+    for ( int32 ElementIdx = 0; ElementIdx < ElementCount; ++ElementIdx )
+    {
+        if ( Membership[ ElementIdx ] > 0 )
+            Words[ ElementIdx >> 5 ] |= 1u << ( ElementIdx & 31 );
+    }
+}
+
+void
+FHoudiniGroupMembership::Combine( const FHoudiniGroupMembership & Other )
+{
+    if ( Other.ElementCount > ElementCount )
+    {
+        ElementCount = Other.ElementCount;
+        Words.SetNumZeroed( Other.Words.Num() );
+    }
+
+    for ( int32 WordIdx = 0; WordIdx < Other.Words.Num(); ++WordIdx )
+        Words[ WordIdx ] |= Other.Words[ WordIdx ];
+}
+
+bool
+FHoudiniGroupMembership::HasMembers() const
+{
+    for ( uint32 Word : Words )
+    {
+        if ( Word )
+            return true;
+    }
+
+    return false;
+}
+
+int32
+FHoudiniGroupMembership::CountMembers() const
+{
+    int32 MemberCount = 0;
+    for ( uint32 Word : Words )
+        MemberCount += HoudiniEngineCountMembershipBits( Word );
+
+    return MemberCount;
+}
+
+int32
+FHoudiniGroupMembership::FindFirstMember() const
+{
+    for ( int32 WordIdx = 0; WordIdx < Words.Num(); ++WordIdx )
+    {
+        if ( Words[ WordIdx ] )
+            return ( WordIdx << 5 ) + (int32) FMath::CountTrailingZeros( Words[ WordIdx ] );
+    }
+
+    return INDEX_NONE;
+}
+
 #if WITH_EDITOR
 
 void
@@ -1187,27 +1497,49 @@ FHoudiniEngineUtils::ResetRawMesh( FRawMesh & RawMesh )
 
 #endif
 
-HAPI_ParmId FHoudiniEngineUtils::HapiFindParameterByNameOrTag( const HAPI_NodeId& NodeId, const std::string ParmName, HAPI_ParmInfo& FoundParmInfo )
+/** Parameters of a node already looked up by name or tag, valid for one cook of one parameter interface. **/
+struct FHoudiniParameterLookupIndex
 {
-    FMemory::Memset< HAPI_ParmInfo >( FoundParmInfo, 0 );
+    /** Node state the index was built for, any change invalidates it. **/
+    int32 UniqueNodeId = -1;
+    int32 TotalCookCount = -1;
+    int32 ParmCount = -1;
 
-    HAPI_NodeInfo NodeInfo;
-    FHoudiniApi::GetNodeInfo( FHoudiniEngine::Get().GetSession(), NodeId, &NodeInfo );
-    if ( NodeInfo.parmCount <= 0 )
-        return -1;
+    /** Parameter ids by name or tag, -1 for the names that weren't found. **/
+    TMap< FString, HAPI_ParmId > ParmIds;
 
-    HAPI_ParmId ParmId = HapiFindParameterByNameOrTag( NodeInfo.id, ParmName );
-    if ( ( ParmId < 0 ) || ( ParmId >= NodeInfo.parmCount ) )
-        return -1;
+    /** Infos of the parameters found so far. **/
+    TMap< HAPI_ParmId, HAPI_ParmInfo > ParmInfos;
+};
 
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmInfo(
-        FHoudiniEngine::Get().GetSession(),
-        NodeId, ParmId, &FoundParmInfo ), -1 );
+/** Lookup indices by session and node id. **/
+static TMap< TPair< int32, HAPI_NodeId >, FHoudiniParameterLookupIndex > HoudiniEngineParameterLookupIndices;
+static FCriticalSection HoudiniEngineParameterLookupIndicesLock;
 
-    return ParmId;
+/** Return the lookup index of a node, reset if the node has cooked or its interface changed since it was filled. Lock must be held. **/
+static FHoudiniParameterLookupIndex &
+GetParameterLookupIndex( const HAPI_NodeInfo & NodeInfo )
+{
+    FHoudiniParameterLookupIndex & LookupIndex = HoudiniEngineParameterLookupIndices.FindOrAdd(
+        TPair< int32, HAPI_NodeId >( FHoudiniScopedSession::GetCurrentSessionIndex(), NodeInfo.id ) );
+
+    if ( LookupIndex.UniqueNodeId != NodeInfo.uniqueHoudiniNodeId
+        || LookupIndex.TotalCookCount != NodeInfo.totalCookCount
+        || LookupIndex.ParmCount != NodeInfo.parmCount )
+    {
+        LookupIndex.UniqueNodeId = NodeInfo.uniqueHoudiniNodeId;
+        LookupIndex.TotalCookCount = NodeInfo.totalCookCount;
+        LookupIndex.ParmCount = NodeInfo.parmCount;
+        LookupIndex.ParmIds.Reset();
+        LookupIndex.ParmInfos.Reset();
+    }
+
+    return LookupIndex;
 }
 
-HAPI_ParmId FHoudiniEngineUtils::HapiFindParameterByNameOrTag( const HAPI_NodeId& NodeId, const std::string ParmName )
+/** Find a parameter by name, then by tag, through HAPI. **/
+static HAPI_ParmId
+HapiFindParameterByNameOrTagUncached( const HAPI_NodeId & NodeId, const std::string & ParmName )
 {
     // First, try to find the parameter by its name
     HAPI_ParmId ParmId = -1;
@@ -1229,6 +1561,72 @@ HAPI_ParmId FHoudiniEngineUtils::HapiFindParameterByNameOrTag( const HAPI_NodeId
     return -1;
 }
 
+HAPI_ParmId FHoudiniEngineUtils::HapiFindParameterByNameOrTag( const HAPI_NodeId& NodeId, const std::string ParmName, HAPI_ParmInfo& FoundParmInfo )
+{
+    FMemory::Memset< HAPI_ParmInfo >( FoundParmInfo, 0 );
+
+    HAPI_NodeInfo NodeInfo;
+    FHoudiniApi::GetNodeInfo( FHoudiniEngine::Get().GetSession(), NodeId, &NodeInfo );
+    if ( NodeInfo.parmCount <= 0 )
+        return -1;
+
+    FScopeLock ScopeLock( &HoudiniEngineParameterLookupIndicesLock );
+    FHoudiniParameterLookupIndex & LookupIndex = GetParameterLookupIndex( NodeInfo );
+
+    const FString ParmKey = UTF8_TO_TCHAR( ParmName.c_str() );
+    HAPI_ParmId ParmId = -1;
+    if ( const HAPI_ParmId * CachedParmId = LookupIndex.ParmIds.Find( ParmKey ) )
+    {
+        ParmId = *CachedParmId;
+    }
+    else
+    {
+        ParmId = HapiFindParameterByNameOrTagUncached( NodeInfo.id, ParmName );
+        LookupIndex.ParmIds.Add( ParmKey, ParmId );
+    }
+
+    if ( ( ParmId < 0 ) || ( ParmId >= NodeInfo.parmCount ) )
+        return -1;
+
+    if ( const HAPI_ParmInfo * CachedParmInfo = LookupIndex.ParmInfos.Find( ParmId ) )
+    {
+        FoundParmInfo = *CachedParmInfo;
+        return ParmId;
+    }
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmInfo(
+        FHoudiniEngine::Get().GetSession(),
+        NodeId, ParmId, &FoundParmInfo ), -1 );
+
+    LookupIndex.ParmInfos.Add( ParmId, FoundParmInfo );
+    return ParmId;
+}
+
+HAPI_ParmId FHoudiniEngineUtils::HapiFindParameterByNameOrTag( const HAPI_NodeId& NodeId, const std::string ParmName )
+{
+    HAPI_NodeInfo NodeInfo;
+    if ( FHoudiniApi::GetNodeInfo( FHoudiniEngine::Get().GetSession(), NodeId, &NodeInfo ) != HAPI_RESULT_SUCCESS )
+        return HapiFindParameterByNameOrTagUncached( NodeId, ParmName );
+
+    FScopeLock ScopeLock( &HoudiniEngineParameterLookupIndicesLock );
+    FHoudiniParameterLookupIndex & LookupIndex = GetParameterLookupIndex( NodeInfo );
+
+    const FString ParmKey = UTF8_TO_TCHAR( ParmName.c_str() );
+    if ( const HAPI_ParmId * CachedParmId = LookupIndex.ParmIds.Find( ParmKey ) )
+        return *CachedParmId;
+
+    HAPI_ParmId ParmId = HapiFindParameterByNameOrTagUncached( NodeId, ParmName );
+    LookupIndex.ParmIds.Add( ParmKey, ParmId );
+    return ParmId;
+}
+
+void
+FHoudiniEngineUtils::InvalidateParameterLookupIndex( const HAPI_NodeId & NodeId )
+{
+    FScopeLock ScopeLock( &HoudiniEngineParameterLookupIndicesLock );
+    HoudiniEngineParameterLookupIndices.Remove(
+        TPair< int32, HAPI_NodeId >( FHoudiniScopedSession::GetCurrentSessionIndex(), NodeId ) );
+}
 
 bool
 FHoudiniEngineUtils::HapiGetParameterDataAsFloat(
@@ -1524,6 +1922,14 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
         CurveClosed = 1;
     }
 
+    // Linear curves made of their CVs need no refinement from the curve SOP,
+    // their points are sent as binary attribute data instead of the coords string.
+    if ( ( CurveTypeValue == HAPI_CURVETYPE_LINEAR ) && ( CurveMethodValue != 2 ) )
+    {
+        return HapiSetLinearCurveGeometry(
+            ConnectedAssetId, *Positions, Rotations, Scales3d, UniformScales, CurveClosed != 0 );
+    }
+
     // For closed NURBS (CVs and Breakpoints), we have to close the curve manually, by duplicating its last point
     // in order to be able to set the rotations and scales attributes properly.
     bool bCloseCurveManually = false;
@@ -2209,6 +2615,145 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
     return true;
 }
 
+bool
+FHoudiniEngineUtils::HapiSetLinearCurveGeometry(
+    HAPI_NodeId NodeId,
+    const TArray< FVector > & Positions,
+    const TArray< FQuat > * Rotations,
+    const TArray< FVector > * Scales3d,
+    const TArray< float > * UniformScales,
+    bool bClosed )
+{
+#if WITH_EDITOR
+
+    const int32 PointCount = Positions.Num();
+    if ( PointCount < 2 )
+        return false;
+
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
+    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
+    if ( HoudiniRuntimeSettings )
+    {
+        GeneratedGeometryScaleFactor = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
+        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
+    }
+
+    const bool bSwapYZ = ( ImportAxis == HRSAI_Unreal );
+
+    // Closed linear curves come out of the curve SOP as a single polygon.
+    HAPI_PartInfo Part;
+    FMemory::Memzero< HAPI_PartInfo >( Part );
+    Part.type = bClosed ? HAPI_PARTTYPE_MESH : HAPI_PARTTYPE_CURVE;
+    Part.pointCount = PointCount;
+    Part.vertexCount = PointCount;
+    Part.faceCount = 1;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetPartInfo(
+        FHoudiniEngine::Get().GetSession(), NodeId, 0, &Part ), false );
+
+    if ( bClosed )
+    {
+        TArray< int32 > VertexList;
+        VertexList.SetNumUninitialized( PointCount );
+        for ( int32 Idx = 0; Idx < PointCount; ++Idx )
+            VertexList[ Idx ] = Idx;
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVertexList(
+            FHoudiniEngine::Get().GetSession(), NodeId, 0, VertexList.GetData(), 0, PointCount ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetFaceCounts(
+            FHoudiniEngine::Get().GetSession(), NodeId, 0, &PointCount, 0, 1 ), false );
+    }
+    else
+    {
+        HAPI_CurveInfo CurveInfo;
+        FMemory::Memzero< HAPI_CurveInfo >( CurveInfo );
+        CurveInfo.curveType = HAPI_CURVETYPE_LINEAR;
+        CurveInfo.curveCount = 1;
+        CurveInfo.vertexCount = PointCount;
+        CurveInfo.order = 2;
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetCurveInfo(
+            FHoudiniEngine::Get().GetSession(), NodeId, 0, &CurveInfo ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetCurveCounts(
+            FHoudiniEngine::Get().GetSession(), NodeId, 0, &PointCount, 0, 1 ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetCurveOrders(
+            FHoudiniEngine::Get().GetSession(), NodeId, 0, &CurveInfo.order, 0, 1 ), false );
+    }
+
+    // Adds a point attribute and uploads its values in one call.
+    auto SetPointAttribute = [&]( const char * AttributeName, int32 TupleSize, const float * Data )
+    {
+        HAPI_AttributeInfo AttributeInfo;
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
+        AttributeInfo.count = PointCount;
+        AttributeInfo.tupleSize = TupleSize;
+        AttributeInfo.exists = true;
+        AttributeInfo.owner = HAPI_ATTROWNER_POINT;
+        AttributeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+        AttributeInfo.originalOwner = HAPI_ATTROWNER_POINT;
+
+        if ( FHoudiniApi::AddAttribute(
+            FHoudiniEngine::Get().GetSession(), NodeId, 0, AttributeName, &AttributeInfo ) != HAPI_RESULT_SUCCESS )
+            return false;
+
+        return FHoudiniApi::SetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), NodeId, 0, AttributeName, &AttributeInfo,
+            Data, 0, PointCount ) == HAPI_RESULT_SUCCESS;
+    };
+
+    // Positions go back to Houdini's scale and axes.
+    TArray< FVector > HoudiniPositions = Positions;
+    FHoudiniEngineUtils::ScaleAndSwapVectors(
+        HoudiniPositions.GetData(), PointCount,
+        GeneratedGeometryScaleFactor != 0.0f ? 1.0f / GeneratedGeometryScaleFactor : 1.0f, bSwapYZ );
+
+    if ( !SetPointAttribute( HAPI_UNREAL_ATTRIB_POSITION, 3, (const float *) HoudiniPositions.GetData() ) )
+        return false;
+
+    if ( Rotations && Rotations->Num() == PointCount )
+    {
+        TArray< float > CurveRotations;
+        CurveRotations.SetNumUninitialized( PointCount * 4 );
+        for ( int32 Idx = 0; Idx < PointCount; ++Idx )
+        {
+            const FQuat & RotationQuaternion = ( *Rotations )[ Idx ];
+            CurveRotations[ Idx * 4 + 0 ] = RotationQuaternion.X;
+            CurveRotations[ Idx * 4 + 1 ] = bSwapYZ ? RotationQuaternion.Z : RotationQuaternion.Y;
+            CurveRotations[ Idx * 4 + 2 ] = bSwapYZ ? RotationQuaternion.Y : RotationQuaternion.Z;
+            CurveRotations[ Idx * 4 + 3 ] = bSwapYZ ? -RotationQuaternion.W : RotationQuaternion.W;
+        }
+
+        if ( !SetPointAttribute( HAPI_UNREAL_ATTRIB_ROTATION, 4, CurveRotations.GetData() ) )
+            return false;
+    }
+
+    if ( Scales3d && Scales3d->Num() == PointCount )
+    {
+        TArray< FVector > CurveScales = *Scales3d;
+        FHoudiniEngineUtils::ScaleAndSwapVectors( CurveScales.GetData(), PointCount, 1.0f, bSwapYZ );
+
+        if ( !SetPointAttribute( HAPI_UNREAL_ATTRIB_SCALE, 3, (const float *) CurveScales.GetData() ) )
+            return false;
+    }
+
+    if ( UniformScales && UniformScales->Num() == PointCount )
+    {
+        if ( !SetPointAttribute( HAPI_UNREAL_ATTRIB_UNIFORM_SCALE, 1, UniformScales->GetData() ) )
+            return false;
+    }
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
+        FHoudiniEngine::Get().GetSession(), NodeId ), false );
+
+#endif // WITH_EDITOR
+
+    return true;
+}
+
 bool
 FHoudiniEngineUtils::HapiGetAssetTransform( HAPI_NodeId AssetId, FTransform & InTransform )
 {
@@ -2374,6 +2919,121 @@ FHoudiniEngineUtils::HapiGetObjectTransforms( HAPI_NodeId AssetId, TArray< HAPI_
     return true;
 }
 
+bool
+FHoudiniEngineUtils::HapiGetCookPreviewPoints(
+    HAPI_NodeId AssetId, int32 MaxPoints, TArray< FVector > & OutPoints, FBox & OutBounds )
+{
+    OutPoints.Empty();
+    OutBounds.Init();
+
+    TArray< HAPI_ObjectInfo > ObjectInfos;
+    TArray< HAPI_Transform > ObjectTransforms;
+    if ( !HapiGetObjectInfos( AssetId, ObjectInfos ) || !HapiGetObjectTransforms( AssetId, ObjectTransforms ) )
+        return false;
+
+    struct FPreviewPart
+    {
+        HAPI_NodeId GeoId;
+        HAPI_PartId PartId;
+        HAPI_AttributeInfo AttributeInfo;
+        FTransform ObjectTransform;
+    };
+
+    // Gather the position attributes of the visible mesh and curve parts.
+    TArray< FPreviewPart > PreviewParts;
+    int64 TotalPointCount = 0;
+    for ( int32 ObjectIdx = 0; ObjectIdx < ObjectInfos.Num(); ++ObjectIdx )
+    {
+        const HAPI_ObjectInfo & ObjectInfo = ObjectInfos[ ObjectIdx ];
+        if ( !ObjectInfo.isVisible || ObjectInfo.isInstancer )
+            continue;
+
+        HAPI_GeoInfo GeoInfo;
+        FMemory::Memzero< HAPI_GeoInfo >( GeoInfo );
+        if ( FHoudiniApi::GetDisplayGeoInfo(
+            FHoudiniEngine::Get().GetSession(), ObjectInfo.nodeId, &GeoInfo ) != HAPI_RESULT_SUCCESS )
+            continue;
+
+        FTransform ObjectTransform = FTransform::Identity;
+        if ( ObjectTransforms.IsValidIndex( ObjectIdx ) )
+            TranslateHapiTransform( ObjectTransforms[ ObjectIdx ], ObjectTransform );
+
+        for ( int32 PartIdx = 0; PartIdx < GeoInfo.partCount; ++PartIdx )
+        {
+            HAPI_PartInfo PartInfo;
+            FMemory::Memzero< HAPI_PartInfo >( PartInfo );
+            if ( FHoudiniApi::GetPartInfo(
+                FHoudiniEngine::Get().GetSession(), GeoInfo.nodeId, PartIdx, &PartInfo ) != HAPI_RESULT_SUCCESS )
+                continue;
+
+            if ( PartInfo.isInstanced || ( PartInfo.type != HAPI_PARTTYPE_MESH && PartInfo.type != HAPI_PARTTYPE_CURVE ) )
+                continue;
+
+            FPreviewPart PreviewPart;
+            PreviewPart.GeoId = GeoInfo.nodeId;
+            PreviewPart.PartId = PartInfo.id;
+            PreviewPart.ObjectTransform = ObjectTransform;
+            FMemory::Memzero< HAPI_AttributeInfo >( PreviewPart.AttributeInfo );
+            if ( FHoudiniApi::GetAttributeInfo(
+                FHoudiniEngine::Get().GetSession(), GeoInfo.nodeId, PartInfo.id, HAPI_UNREAL_ATTRIB_POSITION,
+                HAPI_ATTROWNER_POINT, &PreviewPart.AttributeInfo ) != HAPI_RESULT_SUCCESS )
+                continue;
+
+            if ( !PreviewPart.AttributeInfo.exists || PreviewPart.AttributeInfo.count <= 0 || PreviewPart.AttributeInfo.tupleSize < 3 )
+                continue;
+
+            TotalPointCount += PreviewPart.AttributeInfo.count;
+            PreviewParts.Add( PreviewPart );
+        }
+    }
+
+    if ( TotalPointCount <= 0 || MaxPoints <= 0 )
+        return PreviewParts.Num() > 0;
+
+    // Each part gets a share of the points proportional to its size, read in a few evenly spaced ranges.
+    const double SampleRatio = FMath::Min( 1.0, (double) MaxPoints / (double) TotalPointCount );
+    TArray< float > RangeData;
+    for ( FPreviewPart & PreviewPart : PreviewParts )
+    {
+        const int32 PointCount = PreviewPart.AttributeInfo.count;
+        const int32 TupleSize = PreviewPart.AttributeInfo.tupleSize;
+        const int32 PartSampleCount = FMath::Max( 1, FMath::FloorToInt( PointCount * SampleRatio ) );
+        const int32 RangeCount = FMath::Min( PartSampleCount, HAPI_UNREAL_COOK_PREVIEW_RANGES_PER_PART );
+        const int32 RangeLength = FMath::Max( 1, PartSampleCount / RangeCount );
+
+        for ( int32 RangeIdx = 0; RangeIdx < RangeCount; ++RangeIdx )
+        {
+            int32 RangeStart = (int32)( (int64) PointCount * RangeIdx / RangeCount );
+            int32 Length = FMath::Min( RangeLength, PointCount - RangeStart );
+            if ( Length <= 0 )
+                continue;
+
+            RangeData.SetNumUninitialized( Length * TupleSize );
+            if ( FHoudiniApi::GetAttributeFloatData(
+                FHoudiniEngine::Get().GetSession(), PreviewPart.GeoId, PreviewPart.PartId, HAPI_UNREAL_ATTRIB_POSITION,
+                &PreviewPart.AttributeInfo, -1, RangeData.GetData(), RangeStart, Length ) != HAPI_RESULT_SUCCESS )
+                break;
+
+            int32 FirstPoint = OutPoints.Num();
+            OutPoints.AddUninitialized( Length );
+            for ( int32 PointIdx = 0; PointIdx < Length; ++PointIdx )
+            {
+                const float * Position = &RangeData[ PointIdx * TupleSize ];
+                OutPoints[ FirstPoint + PointIdx ] = FVector( Position[ 0 ], Position[ 1 ], Position[ 2 ] );
+            }
+
+            ConvertScaleAndFlipVectorData( OutPoints.GetData() + FirstPoint, Length );
+            for ( int32 PointIdx = FirstPoint; PointIdx < OutPoints.Num(); ++PointIdx )
+            {
+                OutPoints[ PointIdx ] = PreviewPart.ObjectTransform.TransformPosition( OutPoints[ PointIdx ] );
+                OutBounds += OutPoints[ PointIdx ];
+            }
+        }
+    }
+
+    return true;
+}
+
 bool
 FHoudiniEngineUtils::HapiCreateInputNodeForLandscape(
     const HAPI_NodeId& HostAssetId, ALandscapeProxy * LandscapeProxy,
@@ -2382,7 +3042,8 @@ FHoudiniEngineUtils::HapiCreateInputNodeForLandscape(
     const bool& bExportMaterials, const bool& bExportGeometryAsMesh,
     const bool& bExportLighting, const bool& bExportNormalizedUVs,
     const bool& bExportTileUVs, const FBox& AssetBounds,
-    const bool& bExportAsHeighfield, const bool& bAutoSelectComponents )
+    const bool& bExportAsHeighfield, const bool& bAutoSelectComponents,
+    FHoudiniLandscapeHeightfieldInput* OutHeightfieldInput )
 {
 #if WITH_EDITOR
 
@@ -2453,7 +3114,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForLandscape(
         if ( !bExportOnlySelected || ( SelectedComponents.Num() == NumComponents ) )
         {
             // Export the whole landscape and its layer as a single heightfield node
-            bSuccess = FHoudiniLandscapeUtils::CreateHeightfieldFromLandscape( LandscapeProxy, CreatedHeightfieldNodeId );
+            bSuccess = FHoudiniLandscapeUtils::CreateHeightfieldFromLandscape( LandscapeProxy, CreatedHeightfieldNodeId, OutHeightfieldInput );
         }
         else
         {
@@ -2551,8 +3212,9 @@ FHoudiniEngineUtils::HapiCreateInputNodeForLandscape(
     TArray<FVector> LandscapeUVArray;
     // Array for the vertex index of each point in its component
     TArray<FIntPoint> LandscapeComponentVertexIndicesArray;
-    // Array for the tile names per point
-    TArray<const char *> LandscapeComponentNameArray;
+    // Array for the tile names, and the index of its tile name per point
+    TArray<FString> LandscapeComponentNames;
+    TArray<int32> LandscapeComponentNameIndices;
     // Array for the lightmap values
     TArray<FLinearColor> LandscapeLightmapValues;
 
@@ -2562,7 +3224,8 @@ FHoudiniEngineUtils::HapiCreateInputNodeForLandscape(
         bExportLighting, bExportTileUVs, bExportNormalizedUVs,
         LandscapePositionArray, LandscapeNormalArray,
         LandscapeUVArray, LandscapeComponentVertexIndicesArray,
-        LandscapeComponentNameArray, LandscapeLightmapValues ) )
+        LandscapeComponentNames, LandscapeComponentNameIndices,
+        LandscapeLightmapValues ) )
         return false;
 
     //--------------------------------------------------------------------------------------------------
@@ -2586,7 +3249,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForLandscape(
         return false;
 
     // Create point attribute containing landscape component name.
-    if ( !FHoudiniLandscapeUtils::AddLandscapeComponentNameAttribute( DisplayGeoInfo.nodeId, LandscapeComponentNameArray ) )
+    if ( !FHoudiniLandscapeUtils::AddLandscapeComponentNameAttribute( DisplayGeoInfo.nodeId, LandscapeComponentNames, LandscapeComponentNameIndices ) )
         return false;
 
     // Create point attribute info containing lightmap information.
@@ -2623,6 +3286,176 @@ FHoudiniEngineUtils::HapiCreateInputNodeForLandscape(
 }
 
 
+#if WITH_EDITOR
+
+/** Points sampled along a spline component, with the key of the spline data they were sampled from. **/
+struct FHoudiniSplineSamples
+{
+    FSHAHash Key;
+    TArray< FVector > Positions;
+    TArray< FQuat > Rotations;
+    /** Scale on Unreal's spline will require some tweaking, as the XScale is always 1 **/
+    TArray< FVector > Scales;
+};
+
+/** Last samples of each spline component sent to Houdini. **/
+static TMap< TWeakObjectPtr< USplineComponent >, FHoudiniSplineSamples > HoudiniEngineSplineSamplesCache;
+
+/** Return the resolution splines are sampled at, -1 meaning the one from the runtime settings. **/
+static float
+GetSplineSamplingResolution( const float & SplineResolution )
+{
+    if ( SplineResolution != -1.0f )
+        return SplineResolution;
+
+    // Get runtime settings and extract the spline resolution from it
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings )
+        return HoudiniRuntimeSettings->MarshallingSplineResolution;
+
+    return HAPI_UNREAL_PARAM_SPLINE_RESOLUTION_DEFAULT;
+}
+
+/** Hash everything the samples of a spline depend on: its control points, its rotation and the resolution. **/
+static FSHAHash
+GetSplineSamplesKey( const USplineComponent * SplineComponent, const float & SplineResolution )
+{
+    FSHA1 HashState;
+    auto UpdateCurve = [ &HashState ]( const auto & Curve )
+    {
+        for ( const auto & Point : Curve.Points )
+        {
+            HashState.Update( (const uint8 *) &Point.InVal, sizeof( Point.InVal ) );
+            HashState.Update( (const uint8 *) &Point.OutVal, sizeof( Point.OutVal ) );
+            HashState.Update( (const uint8 *) &Point.ArriveTangent, sizeof( Point.ArriveTangent ) );
+            HashState.Update( (const uint8 *) &Point.LeaveTangent, sizeof( Point.LeaveTangent ) );
+            HashState.Update( (const uint8 *) &Point.InterpMode, sizeof( Point.InterpMode ) );
+        }
+
+        const uint8 bIsLooped = Curve.bIsLooped ? 1 : 0;
+        HashState.Update( &bIsLooped, sizeof( bIsLooped ) );
+        HashState.Update( (const uint8 *) &Curve.LoopKeyOffset, sizeof( Curve.LoopKeyOffset ) );
+    };
+
+    UpdateCurve( SplineComponent->SplineCurves.Position );
+    UpdateCurve( SplineComponent->SplineCurves.Rotation );
+    UpdateCurve( SplineComponent->SplineCurves.Scale );
+
+    // Rotations are sampled in world space.
+    const FQuat ComponentRotation = SplineComponent->GetComponentQuat();
+    const FVector DefaultUpVector = SplineComponent->DefaultUpVector;
+    const int32 ReparamStepsPerSegment = SplineComponent->ReparamStepsPerSegment;
+    HashState.Update( (const uint8 *) &ComponentRotation, sizeof( ComponentRotation ) );
+    HashState.Update( (const uint8 *) &DefaultUpVector, sizeof( DefaultUpVector ) );
+    HashState.Update( (const uint8 *) &ReparamStepsPerSegment, sizeof( ReparamStepsPerSegment ) );
+    HashState.Update( (const uint8 *) &SplineResolution, sizeof( SplineResolution ) );
+
+    FSHAHash Key;
+    HashState.Final();
+    HashState.GetHash( Key.Hash );
+    return Key;
+}
+
+/** Sample the given spline at the given resolution, only reads the spline so can run on any thread. **/
+static void
+SampleSplineComponent( const USplineComponent * SplineComponent, const float & SplineResolution, FHoudiniSplineSamples & OutSamples )
+{
+    int32 NumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
+    float SplineLength = SplineComponent->GetSplineLength();
+
+    // Calculate the number of refined point we want
+    int32 NumberOfRefinedSplinePoints = SplineResolution > 0.0f ? ceil( SplineLength / SplineResolution ) + 1 : NumberOfControlPoints;
+
+    // There's not enough refined points, so we'll use the Spline CVs instead
+    const bool bUseControlPoints = ( NumberOfRefinedSplinePoints < NumberOfControlPoints ) || ( SplineResolution <= 0.0f );
+    const int32 NumberOfPoints = bUseControlPoints ? NumberOfControlPoints : NumberOfRefinedSplinePoints;
+
+    OutSamples.Positions.SetNumZeroed( NumberOfPoints );
+    OutSamples.Rotations.SetNumZeroed( NumberOfPoints );
+    OutSamples.Scales.SetNumZeroed( NumberOfPoints );
+
+    ParallelFor( NumberOfPoints, [ & ]( int32 n )
+    {
+        if ( bUseControlPoints )
+        {
+            OutSamples.Positions[ n ] = SplineComponent->GetLocationAtSplinePoint( n, ESplineCoordinateSpace::Local );
+            OutSamples.Rotations[ n ] = SplineComponent->GetQuaternionAtSplinePoint( n, ESplineCoordinateSpace::World );
+            OutSamples.Scales[ n ] = SplineComponent->GetScaleAtSplinePoint( n );
+        }
+        else
+        {
+            // Calculating the refined spline points
+            const float CurrentDistance = n * SplineResolution;
+            OutSamples.Positions[ n ] = SplineComponent->GetLocationAtDistanceAlongSpline( CurrentDistance, ESplineCoordinateSpace::Local );
+            OutSamples.Rotations[ n ] = SplineComponent->GetQuaternionAtDistanceAlongSpline( CurrentDistance, ESplineCoordinateSpace::World );
+            OutSamples.Scales[ n ] = SplineComponent->GetScaleAtDistanceAlongSpline( CurrentDistance );
+        }
+    }, NumberOfPoints < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
+}
+
+/** Add samples to the cache, dropping the ones of destroyed splines. **/
+static void
+AddSplineSamplesToCache( USplineComponent * SplineComponent, FHoudiniSplineSamples && Samples )
+{
+    for ( auto Iter = HoudiniEngineSplineSamplesCache.CreateIterator(); Iter; ++Iter )
+    {
+        if ( !Iter.Key().IsValid() )
+            Iter.RemoveCurrent();
+    }
+
+    HoudiniEngineSplineSamplesCache.Add( SplineComponent, MoveTemp( Samples ) );
+}
+
+/** Return the samples of a spline, sampling it only if it changed since it was last sampled. **/
+static const FHoudiniSplineSamples &
+GetSplineSamples( USplineComponent * SplineComponent, const float & SplineResolution )
+{
+    const FSHAHash Key = GetSplineSamplesKey( SplineComponent, SplineResolution );
+    const FHoudiniSplineSamples * CachedSamples = HoudiniEngineSplineSamplesCache.Find( SplineComponent );
+    if ( !CachedSamples || CachedSamples->Key != Key )
+    {
+        FHoudiniSplineSamples Samples;
+        Samples.Key = Key;
+        SampleSplineComponent( SplineComponent, SplineResolution, Samples );
+        AddSplineSamplesToCache( SplineComponent, MoveTemp( Samples ) );
+    }
+
+    return HoudiniEngineSplineSamplesCache.FindChecked( SplineComponent );
+}
+
+/** Sample all the changed splines of the given outliner meshes at once, spreading the splines over worker threads. **/
+static void
+PrefetchSplineSamples( const TArray< FHoudiniAssetInputOutlinerMesh > & OutlinerMeshArray, const float & SplineResolution )
+{
+    TArray< USplineComponent * > SplinesToSample;
+    TArray< FHoudiniSplineSamples > Samples;
+    for ( const FHoudiniAssetInputOutlinerMesh & OutlinerMesh : OutlinerMeshArray )
+    {
+        USplineComponent * SplineComponent = OutlinerMesh.SplineComponent;
+        if ( !SplineComponent || SplineComponent->IsPendingKill() || SplinesToSample.Contains( SplineComponent ) )
+            continue;
+
+        const FSHAHash Key = GetSplineSamplesKey( SplineComponent, SplineResolution );
+        const FHoudiniSplineSamples * CachedSamples = HoudiniEngineSplineSamplesCache.Find( SplineComponent );
+        if ( CachedSamples && CachedSamples->Key == Key )
+            continue;
+
+        SplinesToSample.Add( SplineComponent );
+        Samples.AddDefaulted();
+        Samples.Last().Key = Key;
+    }
+
+    ParallelFor( SplinesToSample.Num(), [ & ]( int32 SplineIdx )
+    {
+        SampleSplineComponent( SplinesToSample[ SplineIdx ], SplineResolution, Samples[ SplineIdx ] );
+    }, SplinesToSample.Num() < 2 );
+
+    for ( int32 SplineIdx = 0; SplineIdx < SplinesToSample.Num(); ++SplineIdx )
+        AddSplineSamplesToCache( SplinesToSample[ SplineIdx ], MoveTemp( Samples[ SplineIdx ] ) );
+}
+
+#endif
+
 bool
 FHoudiniEngineUtils::HapiCreateInputNodeForSpline(
     HAPI_NodeId HostAssetId, 
@@ -2637,74 +3470,21 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSpline(
     if ( !SplineComponent || SplineComponent->IsPendingKill() || !FHoudiniEngineUtils::IsHoudiniNodeValid( HostAssetId ) )
         return false;
         
-    float fSplineResolution = SplineResolution;
-    if (fSplineResolution == -1.0f)
-    {
-        // Get runtime settings and extract the spline resolution from it
-        const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-        if (HoudiniRuntimeSettings)
-            fSplineResolution = HoudiniRuntimeSettings->MarshallingSplineResolution;
-        else
-            fSplineResolution = HAPI_UNREAL_PARAM_SPLINE_RESOLUTION_DEFAULT;
-    }
+    float fSplineResolution = GetSplineSamplingResolution( SplineResolution );
 
     int32 nNumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
     float fSplineLength = SplineComponent->GetSplineLength();  
 
-    // Calculate the number of refined point we want
-    int32 nNumberOfRefinedSplinePoints = fSplineResolution > 0.0f ? ceil(fSplineLength / fSplineResolution) + 1 : nNumberOfControlPoints;
-    
-    // Array that will store the attributes we want to add to the curves
-    TArray<FVector> tRefinedSplinePositions;
-    TArray<FQuat> tRefinedSplineRotations;    
-    // Scale on Unreal's spline will require some tweaking, as the XScale is always 1
-    TArray<FVector> tRefinedSplineScales;
-
-    if ( (nNumberOfRefinedSplinePoints < nNumberOfControlPoints) || (fSplineResolution <= 0.0f) )
-    {
-        // There's not enough refined points, so we'll use the Spline CVs instead
-        tRefinedSplinePositions.SetNumZeroed(nNumberOfControlPoints);
-        tRefinedSplineRotations.SetNumZeroed(nNumberOfControlPoints);
-        tRefinedSplineScales.SetNumZeroed(nNumberOfControlPoints);
-
-        FVector Scale;
-        for (int32 n = 0; n < nNumberOfControlPoints; n++)
-        {
-            tRefinedSplinePositions[n] = SplineComponent->GetLocationAtSplinePoint(n, ESplineCoordinateSpace::Local);
-            tRefinedSplineRotations[n] = SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World);
-
-            Scale = SplineComponent->GetScaleAtSplinePoint(n);
-            tRefinedSplineScales[n] = Scale;
-        }
-    }
-    else
-    {
-        // Calculating the refined spline points
-        tRefinedSplinePositions.SetNumZeroed(nNumberOfRefinedSplinePoints);
-        tRefinedSplineRotations.SetNumZeroed(nNumberOfRefinedSplinePoints);
-        tRefinedSplineScales.SetNumZeroed(nNumberOfRefinedSplinePoints);
-
-        FVector Scale;
-        float fCurrentDistance = 0.0f;
-        for (int32 n = 0; n < nNumberOfRefinedSplinePoints; n++)
-        {
-            tRefinedSplinePositions[n] = SplineComponent->GetLocationAtDistanceAlongSpline(fCurrentDistance, ESplineCoordinateSpace::Local);
-            tRefinedSplineRotations[n] = SplineComponent->GetQuaternionAtDistanceAlongSpline(fCurrentDistance, ESplineCoordinateSpace::World);
-            
-            Scale = SplineComponent->GetScaleAtDistanceAlongSpline(fCurrentDistance);
-
-            tRefinedSplineScales[n] = Scale;
-
-            fCurrentDistance += fSplineResolution;
-        }
-    }
+    // Unchanged splines reuse the points they were last sampled at.
+    // The curve creation modifies the arrays, so it works on a copy of the cached samples.
+    FHoudiniSplineSamples SplineSamples = GetSplineSamples( SplineComponent, fSplineResolution );
 
     if ( !HapiCreateCurveInputNodeForData(
             HostAssetId, 
             ConnectedAssetId,
-            &tRefinedSplinePositions,
-            &tRefinedSplineRotations,
-            &tRefinedSplineScales,
+            &SplineSamples.Positions,
+            &SplineSamples.Rotations,
+            &SplineSamples.Scales,
             nullptr,
             SplineComponent->IsClosedLoop() ) )
         return false;
@@ -2752,6 +3532,251 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSpline(
     return true;
 }
 
+#if WITH_EDITOR
+
+/** Geometry of a static mesh uploaded once and shared by the inputs using it through object merges. **/
+struct FHoudiniStaticMeshUploadCacheEntry
+{
+    /** Content key the geometry was uploaded with. **/
+    FString ContentKey;
+
+    /** The node holding the uploaded geometry, and its unique id to detect stale nodes after a session restart. **/
+    HAPI_NodeId NodeId = -1;
+    int32 UniqueNodeId = -1;
+};
+
+/** Uploaded static meshes, by session and by mesh and export flags. **/
+static TMap< TPair< int32, FString >, FHoudiniStaticMeshUploadCacheEntry > HoudiniEngineStaticMeshUploadCache;
+
+/** Object merge nodes created for cached uploads, by session, which can be repointed instead of recreated. **/
+static TSet< TPair< int32, HAPI_NodeId > > HoudiniEngineStaticMeshUploadMergeNodes;
+
+/** Return the key of an upload or object merge node in the current session, nodes of other sessions share their ids. **/
+template< typename KeyType >
+static TPair< int32, KeyType >
+GetSessionUploadKey( const KeyType & Key )
+{
+    return TPair< int32, KeyType >( FHoudiniScopedSession::GetCurrentSessionIndex(), Key );
+}
+
+static bool
+IsCachedUploadNodeValid( const FHoudiniStaticMeshUploadCacheEntry & Entry )
+{
+    if ( Entry.NodeId < 0 )
+        return false;
+
+    HAPI_Bool bIsValid = false;
+    return ( HAPI_RESULT_SUCCESS == FHoudiniApi::IsNodeValid(
+        FHoudiniEngine::Get().GetSession(), Entry.NodeId, Entry.UniqueNodeId, &bIsValid ) ) && bIsValid;
+}
+
+/** Return the node holding the cached upload of a mesh in the current session, UploadMesh is called to upload it **/
+/** again if the cached upload is missing or stale. **/
+static bool
+HapiUploadMeshToCache(
+    TMap< TPair< int32, FString >, FHoudiniStaticMeshUploadCacheEntry > & UploadCache,
+    const FString & UploadKey, const FString & ContentKey,
+    TFunctionRef< bool( HAPI_NodeId & OutUploadNodeId ) > UploadMesh,
+    HAPI_NodeId & OutUploadNodeId )
+{
+    // Upload the geometry, unless an identical upload is still alive in the session.
+    FHoudiniStaticMeshUploadCacheEntry & CacheEntry = UploadCache.FindOrAdd( GetSessionUploadKey( UploadKey ) );
+    if ( CacheEntry.ContentKey != ContentKey || !IsCachedUploadNodeValid( CacheEntry ) )
+    {
+        // The previous upload of this mesh is stale, its object merges will be repointed when their inputs update.
+        if ( IsCachedUploadNodeValid( CacheEntry ) )
+            FHoudiniEngineUtils::DestroyHoudiniAsset( FHoudiniEngineUtils::HapiGetParentNodeId( CacheEntry.NodeId ) );
+
+        HAPI_NodeId UploadNodeId = -1;
+        if ( !UploadMesh( UploadNodeId ) )
+        {
+            UploadCache.Remove( GetSessionUploadKey( UploadKey ) );
+            return false;
+        }
+
+        HAPI_NodeInfo UploadNodeInfo;
+        FMemory::Memzero< HAPI_NodeInfo >( UploadNodeInfo );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetNodeInfo(
+            FHoudiniEngine::Get().GetSession(), UploadNodeId, &UploadNodeInfo ), false );
+
+        CacheEntry.ContentKey = ContentKey;
+        CacheEntry.NodeId = UploadNodeId;
+        CacheEntry.UniqueNodeId = UploadNodeInfo.uniqueHoudiniNodeId;
+    }
+
+    OutUploadNodeId = CacheEntry.NodeId;
+    return true;
+}
+
+/** Hand an input an object merge of a cached upload, its merge node is created if it isn't valid anymore. **/
+static bool
+HapiConnectUploadMergeNode(
+    HAPI_NodeId UploadNodeId, HAPI_NodeId & ConnectedAssetId, TArray< HAPI_NodeId > & OutCreatedNodeIds )
+{
+    if ( !FHoudiniEngineUtils::IsHoudiniNodeValid( ConnectedAssetId ) )
+    {
+        HoudiniEngineStaticMeshUploadMergeNodes.Remove( GetSessionUploadKey( ConnectedAssetId ) );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
+            FHoudiniEngine::Get().GetSession(), -1,
+            "SOP/object_merge", "input", true, &ConnectedAssetId ), false );
+        HoudiniEngineStaticMeshUploadMergeNodes.Add( GetSessionUploadKey( ConnectedAssetId ) );
+    }
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmNodeValue(
+        FHoudiniEngine::Get().GetSession(), ConnectedAssetId, "objpath1", UploadNodeId ), false );
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
+        FHoudiniEngine::Get().GetSession(), ConnectedAssetId, nullptr ), false );
+
+    OutCreatedNodeIds.AddUnique( FHoudiniEngineUtils::HapiGetParentNodeId( ConnectedAssetId ) );
+    return true;
+}
+
+static FString
+GetStaticMeshUploadContentKey( UStaticMesh * StaticMesh, const bool & bExportLODs, const bool & bExportSockets )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    // The render data's DDC key covers the raw mesh and build settings of every LOD.
+    FString ContentKey = StaticMesh->RenderData.IsValid() ? StaticMesh->RenderData->DerivedDataKey : FString();
+    int32 NumLODsToExport = bExportLODs ? StaticMesh->GetNumLODs() : 1;
+    for ( int32 LODIndex = 0; LODIndex < NumLODsToExport && StaticMesh->SourceModels.IsValidIndex( LODIndex ); ++LODIndex )
+    {
+        const FStaticMeshSourceModel & SrcModel = StaticMesh->SourceModels[ LODIndex ];
+        ContentKey += FString::Printf( TEXT( "_%s_%f" ),
+            SrcModel.RawMeshBulkData ? *SrcModel.RawMeshBulkData->GetIdString() : TEXT( "" ),
+            StaticMesh->bAutoComputeLODScreenSize ? 0.0f : SrcModel.ScreenSize.Default );
+    }
+
+    for ( const FStaticMaterial & StaticMaterial : StaticMesh->StaticMaterials )
+        ContentKey += TEXT( "_" ) + ( StaticMaterial.MaterialInterface ? StaticMaterial.MaterialInterface->GetPathName() : FString() );
+
+    if ( bExportSockets )
+    {
+        for ( UStaticMeshSocket * Socket : StaticMesh->Sockets )
+        {
+            if ( Socket && !Socket->IsPendingKill() )
+            {
+                ContentKey += FString::Printf( TEXT( "_%s_%s_%s_%s_%s" ),
+                    *Socket->SocketName.ToString(), *Socket->Tag, *Socket->RelativeLocation.ToString(),
+                    *Socket->RelativeRotation.ToString(), *Socket->RelativeScale.ToString() );
+            }
+        }
+    }
+
+    ContentKey += FString::Printf( TEXT( "_%d" ), StaticMesh->LightMapResolution );
+    if ( HoudiniRuntimeSettings )
+    {
+        ContentKey += FString::Printf( TEXT( "_%f_%d" ),
+            HoudiniRuntimeSettings->GeneratedGeometryScaleFactor, (int32) HoudiniRuntimeSettings->ImportAxis );
+    }
+
+    return ContentKey;
+}
+
+static void
+GetStaticMeshUploadKeys(
+    UStaticMesh * StaticMesh, const bool & ExportAllLODs, const bool & ExportSockets,
+    FString & OutUploadKey, FString & OutContentKey )
+{
+    const bool DoExportSockets = ExportSockets && ( StaticMesh->Sockets.Num() > 0 );
+    const bool DoExportLODs = ExportAllLODs && ( StaticMesh->GetNumLODs() > 1 );
+    OutUploadKey = FString::Printf( TEXT( "%s_%d_%d" ), *StaticMesh->GetPathName(), DoExportLODs, DoExportSockets );
+    OutContentKey = GetStaticMeshUploadContentKey( StaticMesh, DoExportLODs, DoExportSockets );
+}
+
+/** Return true if the upload cache already holds the current geometry of the given mesh. **/
+static bool
+IsStaticMeshUploadCached( UStaticMesh * StaticMesh, const bool & ExportAllLODs, const bool & ExportSockets )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( !HoudiniRuntimeSettings || !HoudiniRuntimeSettings->bCacheInputMeshUploads )
+        return false;
+
+    FHoudiniEngine::Get().GetStaticMeshBuildQueue().FinishBuild( StaticMesh );
+
+    FString UploadKey;
+    FString ContentKey;
+    GetStaticMeshUploadKeys( StaticMesh, ExportAllLODs, ExportSockets, UploadKey, ContentKey );
+
+    const FHoudiniStaticMeshUploadCacheEntry * CacheEntry = HoudiniEngineStaticMeshUploadCache.Find( GetSessionUploadKey( UploadKey ) );
+    return CacheEntry && CacheEntry->ContentKey == ContentKey && IsCachedUploadNodeValid( *CacheEntry );
+}
+
+/** Raw meshes of input static meshes, loaded on worker threads before being uploaded one after the other. **/
+/** The upload of a source model takes its prefetched raw mesh if a scope is active on this thread. **/
+struct FHoudiniScopedRawMeshPrefetch
+{
+    FHoudiniScopedRawMeshPrefetch( const TArray< UStaticMesh * > & StaticMeshes, const bool & ExportAllLODs );
+    ~FHoudiniScopedRawMeshPrefetch();
+
+    /** Move the prefetched raw mesh of a source model out, return false if it was not prefetched. **/
+    static bool Take( const FStaticMeshSourceModel & SrcModel, FRawMesh & OutRawMesh );
+
+    /** Prefetched raw meshes, by source model bulk data. **/
+    TMap< const FRawMeshBulkData *, FRawMesh > RawMeshes;
+
+    /** Is set to true if this scope installed itself, false if an outer scope was already active. **/
+    bool bOwnsPrefetch;
+};
+
+static thread_local FHoudiniScopedRawMeshPrefetch * HoudiniEngineThreadRawMeshPrefetch = nullptr;
+
+FHoudiniScopedRawMeshPrefetch::FHoudiniScopedRawMeshPrefetch(
+    const TArray< UStaticMesh * > & StaticMeshes, const bool & ExportAllLODs )
+    : bOwnsPrefetch( HoudiniEngineThreadRawMeshPrefetch == nullptr )
+{
+    if ( !bOwnsPrefetch )
+        return;
+
+    HoudiniEngineThreadRawMeshPrefetch = this;
+
+    // Add all the entries first, the map must not change once the workers fill it.
+    for ( UStaticMesh * StaticMesh : StaticMeshes )
+    {
+        int32 NumLODsToExport = ( ExportAllLODs && StaticMesh->GetNumLODs() > 1 ) ? StaticMesh->GetNumLODs() : 1;
+        for ( int32 LODIndex = 0; LODIndex < NumLODsToExport && StaticMesh->SourceModels.IsValidIndex( LODIndex ); ++LODIndex )
+        {
+            const FRawMeshBulkData * RawMeshBulkData = StaticMesh->SourceModels[ LODIndex ].RawMeshBulkData;
+            if ( RawMeshBulkData && !RawMeshBulkData->IsEmpty() )
+                RawMeshes.FindOrAdd( RawMeshBulkData );
+        }
+    }
+
+    TArray< TPair< const FRawMeshBulkData *, FRawMesh * > > Loads;
+    Loads.Reserve( RawMeshes.Num() );
+    for ( auto & RawMeshPair : RawMeshes )
+        Loads.Emplace( RawMeshPair.Key, &RawMeshPair.Value );
+
+    ParallelFor( Loads.Num(), [ &Loads ]( int32 LoadIdx )
+    {
+        const_cast< FRawMeshBulkData * >( Loads[ LoadIdx ].Key )->LoadRawMesh( *Loads[ LoadIdx ].Value );
+    }, Loads.Num() < 2 );
+}
+
+FHoudiniScopedRawMeshPrefetch::~FHoudiniScopedRawMeshPrefetch()
+{
+    if ( bOwnsPrefetch )
+        HoudiniEngineThreadRawMeshPrefetch = nullptr;
+}
+
+bool
+FHoudiniScopedRawMeshPrefetch::Take( const FStaticMeshSourceModel & SrcModel, FRawMesh & OutRawMesh )
+{
+    if ( !HoudiniEngineThreadRawMeshPrefetch || !SrcModel.RawMeshBulkData )
+        return false;
+
+    FRawMesh * PrefetchedRawMesh = HoudiniEngineThreadRawMeshPrefetch->RawMeshes.Find( SrcModel.RawMeshBulkData );
+    if ( !PrefetchedRawMesh )
+        return false;
+
+    OutRawMesh = MoveTemp( *PrefetchedRawMesh );
+    HoudiniEngineThreadRawMeshPrefetch->RawMeshes.Remove( SrcModel.RawMeshBulkData );
+    return true;
+}
+
+#endif
+
 bool
 FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
     UStaticMesh * StaticMesh,
@@ -2767,6 +3792,83 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
     if ( !StaticMesh || StaticMesh->IsPendingKill() )
         return false;
 
+    // Component inputs carry per component data (override colors, tags, attribute data) and are always uploaded.
+    // So are inputs reusing a node that isn't one of our object merges.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    bool bUseUploadCache = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bCacheInputMeshUploads && !StaticMeshComponent;
+    if ( ConnectedAssetId >= 0 && !HoudiniEngineStaticMeshUploadMergeNodes.Contains( GetSessionUploadKey( ConnectedAssetId ) ) )
+        bUseUploadCache = false;
+
+    if ( !bUseUploadCache )
+    {
+        return HapiUploadStaticMesh(
+            StaticMesh, ConnectedAssetId, OutCreatedNodeIds, StaticMeshComponent, ExportAllLODs, ExportSockets );
+    }
+
+    HAPI_NodeId UploadNodeId = -1;
+    if ( !HapiUploadStaticMeshToCache( StaticMesh, UploadNodeId, ExportAllLODs, ExportSockets ) )
+        return false;
+
+    // Hand the input an object merge of the uploaded geometry.
+    if ( !HapiConnectUploadMergeNode( UploadNodeId, ConnectedAssetId, OutCreatedNodeIds ) )
+        return false;
+
+#endif
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiUploadStaticMeshToCache(
+    UStaticMesh * StaticMesh,
+    HAPI_NodeId & OutUploadNodeId,
+    const bool& ExportAllLODs /* = false */,
+    const bool& ExportSockets /* = false */ )
+{
+#if WITH_EDITOR
+
+    if ( !StaticMesh || StaticMesh->IsPendingKill() )
+        return false;
+
+    // Generated meshes used as inputs need their render data, which is also part of the content key.
+    FHoudiniEngine::Get().GetStaticMeshBuildQueue().FinishBuild( StaticMesh );
+
+    FString UploadKey;
+    FString ContentKey;
+    GetStaticMeshUploadKeys( StaticMesh, ExportAllLODs, ExportSockets, UploadKey, ContentKey );
+
+    auto UploadMesh = [ & ]( HAPI_NodeId & UploadNodeId )
+    {
+        TArray< HAPI_NodeId > UploadCreatedNodeIds;
+        return HapiUploadStaticMesh( StaticMesh, UploadNodeId, UploadCreatedNodeIds, nullptr, ExportAllLODs, ExportSockets );
+    };
+
+    if ( !HapiUploadMeshToCache( HoudiniEngineStaticMeshUploadCache, UploadKey, ContentKey, UploadMesh, OutUploadNodeId ) )
+        return false;
+
+#endif
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiUploadStaticMesh(
+    UStaticMesh * StaticMesh,
+    HAPI_NodeId & ConnectedAssetId,
+    TArray< HAPI_NodeId >& OutCreatedNodeIds,
+    UStaticMeshComponent* StaticMeshComponent /* = nullptr */,
+    const bool& ExportAllLODs /* = false */,
+    const bool& ExportSockets /* = false */)
+{
+#if WITH_EDITOR
+
+    // If we don't have a static mesh there's nothing to do.
+    if ( !StaticMesh || StaticMesh->IsPendingKill() )
+        return false;
+
+    // Generated meshes used as inputs need their render data.
+    FHoudiniEngine::Get().GetStaticMeshBuildQueue().FinishBuild( StaticMesh );
+
     // Export sockets if there are some
     bool DoExportSockets = ExportSockets && ( StaticMesh->Sockets.Num() > 0 );
 
@@ -2848,9 +3950,10 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             CurrentLODNodeId = ConnectedAssetId;
         }
 
-        // Load the existing raw mesh.
+        // Load the existing raw mesh, unless it has been prefetched.
         FRawMesh RawMesh;
-        SrcModel.RawMeshBulkData->LoadRawMesh( RawMesh );
+        if ( !FHoudiniScopedRawMeshPrefetch::Take( SrcModel, RawMesh ) )
+            SrcModel.RawMeshBulkData->LoadRawMesh( RawMesh );
 
         // Create part.
         HAPI_PartInfo Part;
@@ -2889,7 +3992,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
         // Extract vertices from static mesh.
         TArray< float > StaticMeshVertices;
         StaticMeshVertices.SetNumZeroed( RawMesh.VertexPositions.Num() * 3 );
-        for ( int32 VertexIdx = 0; VertexIdx < RawMesh.VertexPositions.Num(); ++VertexIdx )
+        ParallelFor( RawMesh.VertexPositions.Num(), [ & ]( int32 VertexIdx )
         {
             // Grab vertex at this index.
             const FVector & PositionVector = RawMesh.VertexPositions[ VertexIdx ];
@@ -2911,7 +4014,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
                 // Not valid enum value.
                 check( 0 );
             }
-        }
+        }, RawMesh.VertexPositions.Num() < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
 
         // Now that we have raw positions, we can upload them for our attribute.
         HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
@@ -2929,30 +4032,11 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             {
                 const TArray< FVector2D > & RawMeshUVs = RawMesh.WedgeTexCoords[ MeshTexCoordIdx ];
                 TArray< FVector > StaticMeshUVs;
-                StaticMeshUVs.Reserve( StaticMeshUVCount );
+                StaticMeshUVs.SetNumUninitialized( StaticMeshUVCount );
 
-                // Transfer UV data.
-                for ( int32 UVIdx = 0; UVIdx < StaticMeshUVCount; ++UVIdx )
-                    StaticMeshUVs.Emplace( RawMeshUVs[ UVIdx ].X, 1.0 - RawMeshUVs[ UVIdx ].Y, 0 );
-
-                if ( ImportAxis == HRSAI_Unreal )
-                {
-                    // We need to re-index UVs for wedges we swapped (due to winding differences).
-                    for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
-                    {
-                        // We do not touch wedge 0 of this triangle.
-                        StaticMeshUVs.SwapMemory( WedgeIdx + 1, WedgeIdx + 2 );
-                    }
-                }
-                else if ( ImportAxis == HRSAI_Houdini )
-                {
-                    // Do nothing, data is in proper format.
-                }
-                else
-                {
-                    // Not valid enum value.
-                    check( 0 );
-                }
+                // Transfer UV data, re-indexing wedges we swapped (due to winding differences).
+                FHoudiniEngineUtils::ConvertWedgeUVs(
+                    RawMeshUVs.GetData(), StaticMeshUVs.GetData(), StaticMeshUVCount, ImportAxis == HRSAI_Unreal );
 
                 // Construct attribute name for this index.
                 FString UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
@@ -2984,32 +4068,14 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
         // See if we have normals to upload.
         if ( RawMesh.WedgeTangentZ.Num() > 0 )
         {
-            TArray< FVector > ChangedNormals( RawMesh.WedgeTangentZ );
-
-            if ( ImportAxis == HRSAI_Unreal )
-            {
-                // We need to re-index normals for wedges we swapped (due to winding differences).
-                for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
-                {
-                    FVector TangentZ1 = ChangedNormals[ WedgeIdx + 1 ];
-                    FVector TangentZ2 = ChangedNormals[ WedgeIdx + 2 ];
-
-                    ChangedNormals[ WedgeIdx + 1 ] = TangentZ2;
-                    ChangedNormals[ WedgeIdx + 2 ] = TangentZ1;
-                }
+            TArray< FVector > ChangedNormals;
+            ChangedNormals.SetNumUninitialized( RawMesh.WedgeTangentZ.Num() );
 
-                for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); ++WedgeIdx )
-                    Swap( ChangedNormals[ WedgeIdx ].Y, ChangedNormals[ WedgeIdx ].Z );
-            }
-            else if ( ImportAxis == HRSAI_Houdini )
-            {
-                // Do nothing, data is in proper format.
-            }
-            else
-            {
-                // Not valid enum value.
-                check( 0 );
-            }
+            // We need to re-index normals for wedges we swapped (due to winding differences) and swap their Y and Z.
+            const bool bConvertToHoudini = ( ImportAxis == HRSAI_Unreal );
+            FHoudiniEngineUtils::ConvertWedgeVectors(
+                RawMesh.WedgeTangentZ.GetData(), ChangedNormals.GetData(), ChangedNormals.Num(),
+                1.0f, bConvertToHoudini, bConvertToHoudini );
 
             // Create attribute for normals.
             HAPI_AttributeInfo AttributeInfoVertex;
@@ -3078,28 +4144,9 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             {
                 ChangedColors.SetNumUninitialized( RawMesh.WedgeColors.Num() );
 
-                if ( ImportAxis == HRSAI_Unreal )
-                {
-                    // We need to re-index colors for wedges we swapped (due to winding differences).
-                    for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
-                    {
-                        ChangedColors[WedgeIdx + 0] = RawMesh.WedgeColors[WedgeIdx + 0].ReinterpretAsLinear();
-                        ChangedColors[WedgeIdx + 1] = RawMesh.WedgeColors[WedgeIdx + 2].ReinterpretAsLinear();
-                        ChangedColors[WedgeIdx + 2] = RawMesh.WedgeColors[WedgeIdx + 1].ReinterpretAsLinear();
-                    }
-                }
-                else if ( ImportAxis == HRSAI_Houdini )
-                {
-                    for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); ++WedgeIdx )
-                    {
-                        ChangedColors[WedgeIdx] = RawMesh.WedgeColors[WedgeIdx].ReinterpretAsLinear();
-                    }
-                }
-                else
-                {
-                    // Not valid enum value.
-                    check( 0 );
-                }
+                // We need to re-index colors for wedges we swapped (due to winding differences).
+                FHoudiniEngineUtils::ConvertWedgeColors(
+                    RawMesh.WedgeColors.GetData(), ChangedColors.GetData(), ChangedColors.Num(), ImportAxis == HRSAI_Unreal );
             }
 
             if ( ChangedColors.Num() > 0 )
@@ -3193,9 +4240,10 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             }
 
             // Create list of materials, one for each face.
-            TArray< char * > StaticMeshFaceMaterials;
+            TArray< char * > UniqueMaterialNames;
+            TArray< const char * > StaticMeshFaceMaterials;
             FHoudiniEngineUtils::CreateFaceMaterialArray(
-                MaterialInterfaces, RawMesh.FaceMaterialIndices, StaticMeshFaceMaterials );
+                MaterialInterfaces, RawMesh.FaceMaterialIndices, UniqueMaterialNames, StaticMeshFaceMaterials );
 
             // Get name of attribute used for marshalling materials.
             std::string MarshallingAttributeName = HAPI_UNREAL_ATTRIB_MATERIAL;
@@ -3224,14 +4272,14 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             if ( FHoudiniApi::SetAttributeStringData(
                 FHoudiniEngine::Get().GetSession(),
                 CurrentLODNodeId, 0, MarshallingAttributeName.c_str(), &AttributeInfoMaterial,
-                (const char **) StaticMeshFaceMaterials.GetData(), 0,
+                StaticMeshFaceMaterials.GetData(), 0,
                 StaticMeshFaceMaterials.Num() ) != HAPI_RESULT_SUCCESS )
             {
                 bAttributeError = true;
             }
 
             // Delete material names.
-            FHoudiniEngineUtils::DeleteFaceMaterialArray( StaticMeshFaceMaterials );
+            FHoudiniEngineUtils::DeleteFaceMaterialArray( UniqueMaterialNames );
 
             if ( bAttributeError )
             {
@@ -3329,7 +4377,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             AttributeInfo.exists = true;
             AttributeInfo.owner = HAPI_ATTROWNER_PRIM;
             AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
-            AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+            AttributeInfo.originalOwner = HAPI_ATTROWNER_POINT;
 
             HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
                 FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
@@ -3377,7 +4425,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
                 AttributeInfo.exists = true;
                 AttributeInfo.owner = HAPI_ATTROWNER_PRIM;
                 AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
-                AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+                AttributeInfo.originalOwner = HAPI_ATTROWNER_POINT;
 
                 HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
                     FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
@@ -3773,43 +4821,174 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
                 FHoudiniEngine::Get().GetSession(), SocketsNodeId, 0,
                 TCHAR_TO_ANSI( *TagAttr ), &AttributeInfoTag ), false );
 
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeStringData(
-                FHoudiniEngine::Get().GetSession(),
-                SocketsNodeId, 0,
-                TCHAR_TO_ANSI( *TagAttr ),
-                &AttributeInfoTag,
-                & ( SocketTags[ Idx ] ),
-                0, AttributeInfoTag.count ), false );
-        }
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeStringData(
+                FHoudiniEngine::Get().GetSession(),
+                SocketsNodeId, 0,
+                TCHAR_TO_ANSI( *TagAttr ),
+                &AttributeInfoTag,
+                & ( SocketTags[ Idx ] ),
+                0, AttributeInfoTag.count ), false );
+        }
+
+        // Now add the sockets group
+        const char * SocketGroupStr = "socket_imported";
+        // Add a LOD group
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddGroup(
+            FHoudiniEngine::Get().GetSession(), SocketsNodeId, 0,
+            HAPI_GROUPTYPE_POINT, SocketGroupStr ), false );
+
+        // Set GroupMembership
+        TArray<int> GroupArray;
+        GroupArray.Init( 1, NumSockets );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetGroupMembership(
+            FHoudiniEngine::Get().GetSession(), SocketsNodeId, 0,
+            HAPI_GROUPTYPE_POINT, SocketGroupStr, GroupArray.GetData(), 0, NumSockets ), false );
+
+        // Commit the geo.
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
+            FHoudiniEngine::Get().GetSession(), SocketsNodeId ), false);
+
+        // Now we can connect the socket node to the merge node's last input.
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
+            FHoudiniEngine::Get().GetSession(), ConnectedAssetId, NumLODsToExport,
+            SocketsNodeId, 0), false );
+    }
+#endif
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiSetInstancePointTransforms( HAPI_NodeId PointsNodeId, const TArray< FTransform > & InstanceTransforms )
+{
+#if WITH_EDITOR
+    const int32 NumInstances = InstanceTransforms.Num();
+    HAPI_PartInfo Part;
+    FMemory::Memzero< HAPI_PartInfo >( Part );
+    Part.pointCount = NumInstances;
+    Part.type = HAPI_PARTTYPE_MESH;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetPartInfo(
+        FHoudiniEngine::Get().GetSession(), PointsNodeId, 0, &Part ), false );
+
+    TArray< float > InstancePos;
+    InstancePos.SetNumZeroed( NumInstances * 3 );
+    TArray< float > InstanceRot;
+    InstanceRot.SetNumZeroed( NumInstances * 4 );
+    TArray< float > InstanceScale;
+    InstanceScale.SetNumZeroed( NumInstances * 3 );
+    for ( int32 Idx = 0; Idx < NumInstances; ++Idx )
+    {
+        HAPI_Transform HapiInstanceTransform;
+        FHoudiniEngineUtils::TranslateUnrealTransform( InstanceTransforms[ Idx ], HapiInstanceTransform );
+
+        FMemory::Memcpy( &InstancePos[ 3 * Idx ], HapiInstanceTransform.position, 3 * sizeof( float ) );
+        FMemory::Memcpy( &InstanceRot[ 4 * Idx ], HapiInstanceTransform.rotationQuaternion, 4 * sizeof( float ) );
+        FMemory::Memcpy( &InstanceScale[ 3 * Idx ], HapiInstanceTransform.scale, 3 * sizeof( float ) );
+    }
+
+    auto AddPointAttribute = [ & ]( const char * AttributeName, int32 TupleSize, const TArray< float > & Values )
+    {
+        HAPI_AttributeInfo AttributeInfo;
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
+        AttributeInfo.count = NumInstances;
+        AttributeInfo.tupleSize = TupleSize;
+        AttributeInfo.exists = true;
+        AttributeInfo.owner = HAPI_ATTROWNER_POINT;
+        AttributeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+        AttributeInfo.originalOwner = HAPI_ATTROWNER_POINT;
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+            FHoudiniEngine::Get().GetSession(), PointsNodeId, 0, AttributeName, &AttributeInfo ), false );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), PointsNodeId, 0, AttributeName, &AttributeInfo,
+            Values.GetData(), 0, AttributeInfo.count ), false );
+
+        return true;
+    };
+
+    if ( !AddPointAttribute( HAPI_UNREAL_ATTRIB_POSITION, 3, InstancePos )
+        || !AddPointAttribute( HAPI_UNREAL_ATTRIB_ROTATION, 4, InstanceRot )
+        || !AddPointAttribute( HAPI_UNREAL_ATTRIB_SCALE, 3, InstanceScale ) )
+        return false;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
+        FHoudiniEngine::Get().GetSession(), PointsNodeId ), false );
+
+#endif
+
+    return true;
+}
+
+#if WITH_EDITOR
+
+/** Return true if an outliner mesh has no per component data and can be instanced from its static mesh. **/
+static bool
+CanInstanceWorldOutlinerMesh( const FHoudiniAssetInputOutlinerMesh & OutlinerMesh )
+{
+    UStaticMeshComponent * StaticMeshComponent = OutlinerMesh.StaticMeshComponent;
+    if ( !OutlinerMesh.StaticMesh || OutlinerMesh.StaticMesh->IsPendingKill() )
+        return false;
+
+    if ( !StaticMeshComponent || StaticMeshComponent->IsPendingKill() || StaticMeshComponent->ComponentTags.Num() > 0 )
+        return false;
+
+    for ( UMaterialInterface * OverrideMaterial : StaticMeshComponent->OverrideMaterials )
+    {
+        if ( OverrideMaterial )
+            return false;
+    }
+
+    for ( const FStaticMeshComponentLODInfo & LODInfo : StaticMeshComponent->LODData )
+    {
+        if ( LODInfo.OverrideVertexColors )
+            return false;
+    }
+
+    AActor * ParentActor = StaticMeshComponent->GetOwner();
+    if ( ParentActor && ( ParentActor->Tags.Num() > 0 || ParentActor->FindComponentByClass< UHoudiniAttributeDataComponent >() ) )
+        return false;
+
+    return true;
+}
 
-        // Now add the sockets group
-        const char * SocketGroupStr = "socket_imported";
-        // Add a LOD group
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddGroup(
-            FHoudiniEngine::Get().GetSession(), SocketsNodeId, 0,
-            HAPI_GROUPTYPE_POINT, SocketGroupStr ), false );
+/** Instance a static mesh uploaded once as packed primitives on a point per transform, inside the given network. **/
+static bool
+HapiCreatePackedInstancesForStaticMesh(
+    HAPI_NodeId ParentId, UStaticMesh * StaticMesh, const TArray< FTransform > & InstanceTransforms,
+    const bool & ExportAllLODs, const bool & ExportSockets, HAPI_NodeId & OutInstancesNodeId, HAPI_NodeId & OutPointsNodeId )
+{
+    HAPI_NodeId UploadNodeId = -1;
+    if ( !FHoudiniEngineUtils::HapiUploadStaticMeshToCache( StaticMesh, UploadNodeId, ExportAllLODs, ExportSockets ) )
+        return false;
 
-        // Set GroupMembership
-        TArray<int> GroupArray;
-        GroupArray.Init( 1, NumSockets );
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetGroupMembership(
-            FHoudiniEngine::Get().GetSession(), SocketsNodeId, 0,
-            HAPI_GROUPTYPE_POINT, SocketGroupStr, GroupArray.GetData(), 0, NumSockets ), false );
+    // Bring the shared geometry into the network.
+    HAPI_NodeId MeshNodeId = -1;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
+        FHoudiniEngine::Get().GetSession(), ParentId, "object_merge", "mesh", false, &MeshNodeId ), false );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmNodeValue(
+        FHoudiniEngine::Get().GetSession(), MeshNodeId, "objpath1", UploadNodeId ), false );
 
-        // Commit the geo.
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
-            FHoudiniEngine::Get().GetSession(), SocketsNodeId ), false);
+    // Create a point per instance carrying its transform.
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
+        FHoudiniEngine::Get().GetSession(), ParentId, "null", "instances", false, &OutPointsNodeId ), false );
+    if ( !FHoudiniEngineUtils::HapiSetInstancePointTransforms( OutPointsNodeId, InstanceTransforms ) )
+        return false;
 
-        // Now we can connect the socket node to the merge node's last input.
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
-            FHoudiniEngine::Get().GetSession(), ConnectedAssetId, NumLODsToExport,
-            SocketsNodeId, 0), false );
-    }
-#endif
+    // Copy the mesh to the points as packed instances, so that Houdini keeps a single copy of the geometry.
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
+        FHoudiniEngine::Get().GetSession(), ParentId, "copytopoints", "instancer", false, &OutInstancesNodeId ), false );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmIntValue(
+        FHoudiniEngine::Get().GetSession(), OutInstancesNodeId, "pack", 0, 1 ), false );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
+        FHoudiniEngine::Get().GetSession(), OutInstancesNodeId, 0, MeshNodeId, 0 ), false );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
+        FHoudiniEngine::Get().GetSession(), OutInstancesNodeId, 1, OutPointsNodeId, 0 ), false );
 
     return true;
 }
 
+#endif
+
 bool
 FHoudiniEngineUtils::HapiCreateInputNodeForWorldOutliner(
     HAPI_NodeId HostAssetId,
@@ -3838,9 +5017,64 @@ FHoudiniEngineUtils::HapiCreateInputNodeForWorldOutliner(
         OutCreatedNodeIds.AddUnique( FHoudiniEngineUtils::HapiGetParentNodeId( ConnectedAssetId ) );
     }
 
+    // Meshes shared by several actors can be uploaded once and instanced on a point per actor.
+    // The instanced outliner meshes have no node of their own, their transform changes update the instance points.
+    TMap< UStaticMesh *, TArray< int32 > > InstancedOutlinerMeshes;
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( UseMerge && HoudiniRuntimeSettings && HoudiniRuntimeSettings->bInstanceWorldOutlinerSharedMeshes )
+    {
+        for ( int32 InputIdx = 0; InputIdx < OutlinerMeshArray.Num(); ++InputIdx )
+        {
+            if ( CanInstanceWorldOutlinerMesh( OutlinerMeshArray[ InputIdx ] ) )
+                InstancedOutlinerMeshes.FindOrAdd( OutlinerMeshArray[ InputIdx ].StaticMesh ).Add( InputIdx );
+        }
+    }
+
+    int32 MergeInputIdx = 0;
+    TBitArray<> IsOutlinerMeshInstanced( false, OutlinerMeshArray.Num() );
+    HAPI_NodeId MergeParentId = UseMerge ? FHoudiniEngineUtils::HapiGetParentNodeId( ConnectedAssetId ) : -1;
+    for ( const auto & InstancedMesh : InstancedOutlinerMeshes )
+    {
+        const TArray< int32 > & OutlinerIndices = InstancedMesh.Value;
+        if ( OutlinerIndices.Num() < 2 )
+            continue;
+
+        TArray< FTransform > InstanceTransforms;
+        InstanceTransforms.Reserve( OutlinerIndices.Num() );
+        for ( int32 OutlinerIdx : OutlinerIndices )
+            InstanceTransforms.Add( OutlinerMeshArray[ OutlinerIdx ].ComponentTransform );
+
+        HAPI_NodeId InstancesNodeId = -1;
+        HAPI_NodeId PointsNodeId = -1;
+        if ( !HapiCreatePackedInstancesForStaticMesh(
+            MergeParentId, InstancedMesh.Key, InstanceTransforms, ExportAllLODs, ExportSockets, InstancesNodeId, PointsNodeId ) )
+        {
+            // The outliner meshes will be uploaded one by one instead.
+            continue;
+        }
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
+            FHoudiniEngine::Get().GetSession(), ConnectedAssetId, MergeInputIdx++,
+            InstancesNodeId, 0 ), false );
+
+        for ( int32 OutlinerIdx : OutlinerIndices )
+        {
+            OutlinerMeshArray[ OutlinerIdx ].AssetId = -1;
+            OutlinerMeshArray[ OutlinerIdx ].InstancePointsNodeId = PointsNodeId;
+            IsOutlinerMeshInstanced[ OutlinerIdx ] = true;
+        }
+    }
+
+    // Sample the changed splines on worker threads before creating their curves.
+    PrefetchSplineSamples( OutlinerMeshArray, GetSplineSamplingResolution( SplineResolution ) );
+
     for ( int32 InputIdx = 0; InputIdx < OutlinerMeshArray.Num(); ++InputIdx )
     {
+        if ( IsOutlinerMeshInstanced[ InputIdx ] )
+            continue;
+
         auto & OutlinerMesh = OutlinerMeshArray[ InputIdx ];
+        OutlinerMesh.InstancePointsNodeId = -1;
 
         bool bInputCreated = false;
         if ( OutlinerMesh.StaticMesh && !OutlinerMesh.StaticMesh->IsPendingKill() )
@@ -3876,7 +5110,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForWorldOutliner(
         {
             // Now we can connect the input node to the merge node.
             HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
-                FHoudiniEngine::Get().GetSession(), ConnectedAssetId, InputIdx,
+                FHoudiniEngine::Get().GetSession(), ConnectedAssetId, MergeInputIdx++,
                 OutlinerMesh.AssetId, 0), false );
         }
         else
@@ -3909,6 +5143,17 @@ FHoudiniEngineUtils::HapiCreateInputNodeForObjects(
     if ( InputObjects.Num() <= 0 )
         return true;
 
+    // Load the raw meshes of the static meshes needing an upload in parallel, the HAPI uploads then run one after the other.
+    TArray< UStaticMesh * > StaticMeshesToUpload;
+    for ( UObject * InputObject : InputObjects )
+    {
+        UStaticMesh * InputStaticMesh = Cast< UStaticMesh >( InputObject );
+        if ( InputStaticMesh && !InputStaticMesh->IsPendingKill() && !IsStaticMeshUploadCached( InputStaticMesh, bExportAllLODs, bExportSockets ) )
+            StaticMeshesToUpload.AddUnique( InputStaticMesh );
+    }
+
+    FHoudiniScopedRawMeshPrefetch ScopedRawMeshPrefetch( StaticMeshesToUpload, bExportAllLODs );
+
     bool UseMergeNode = InputObjects.Num() > 1;
     if ( UseMergeNode )
     {
@@ -3980,12 +5225,138 @@ FHoudiniEngineUtils::HapiCreateInputNodeForObjects(
     return true;
 }
 
+#if WITH_EDITOR
+
+/** Uploaded skeletal meshes, by session and by mesh and skeleton export flag. **/
+static TMap< TPair< int32, FString >, FHoudiniStaticMeshUploadCacheEntry > HoudiniEngineSkeletalMeshUploadCache;
+
+static FString
+GetSkeletalMeshUploadContentKey( USkeletalMesh * SkeletalMesh )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    // The imported model's id changes whenever the mesh is reimported or edited.
+    const FSkeletalMeshModel * SkelMeshResource = SkeletalMesh->GetImportedModel();
+    FString ContentKey = SkelMeshResource ? SkelMeshResource->GetIdString() : FString();
+
+    for ( const FSkeletalMaterial & SkeletalMaterial : SkeletalMesh->Materials )
+        ContentKey += TEXT( "_" ) + ( SkeletalMaterial.MaterialInterface ? SkeletalMaterial.MaterialInterface->GetPathName() : FString() );
+
+    ContentKey += FString::Printf( TEXT( "_%d" ), SkeletalMesh->RefSkeleton.GetRawBoneNum() );
+    if ( HoudiniRuntimeSettings )
+    {
+        ContentKey += FString::Printf( TEXT( "_%f_%d_%s_%s_%s" ),
+            HoudiniRuntimeSettings->GeneratedGeometryScaleFactor, (int32) HoudiniRuntimeSettings->ImportAxis,
+            *HoudiniRuntimeSettings->MarshallingAttributeMaterial,
+            *HoudiniRuntimeSettings->MarshallingAttributeInputMeshName,
+            *HoudiniRuntimeSettings->MarshallingAttributeInputSourceFile );
+    }
+
+    return ContentKey;
+}
+
+/** Pack the bone influences of the non cloth vertices in fixed width arrays of MAX_TOTAL_INFLUENCES values per vertex. **/
+/** Bone indices are converted from the sections' bone maps to the reference skeleton. **/
+static bool
+GetSkeletalMeshInfluences(
+    const FSkeletalMeshLODModel & SourceModel, const int32 & VertexCount,
+    TArray< int32 > & OutBoneIndices, TArray< float > & OutBoneWeights )
+{
+    // Find where each section's vertices start, in the order used by GetNonClothVertices.
+    TArray< const FSkelMeshSection * > Sections;
+    TArray< int32 > SectionOffsets;
+    int32 NumVertices = 0;
+    for ( const FSkelMeshSection & Section : SourceModel.Sections )
+    {
+        if ( Section.HasClothingData() )
+            continue;
+
+        Sections.Add( &Section );
+        SectionOffsets.Add( NumVertices );
+        NumVertices += Section.SoftVertices.Num();
+    }
+
+    if ( NumVertices != VertexCount )
+        return false;
+
+    OutBoneIndices.SetNumUninitialized( VertexCount * MAX_TOTAL_INFLUENCES );
+    OutBoneWeights.SetNumUninitialized( VertexCount * MAX_TOTAL_INFLUENCES );
+
+    ParallelFor( Sections.Num(), [ & ]( int32 SectionIdx )
+    {
+        const FSkelMeshSection & Section = *Sections[ SectionIdx ];
+        int32 * BoneIndices = OutBoneIndices.GetData() + SectionOffsets[ SectionIdx ] * MAX_TOTAL_INFLUENCES;
+        float * BoneWeights = OutBoneWeights.GetData() + SectionOffsets[ SectionIdx ] * MAX_TOTAL_INFLUENCES;
+
+        for ( const FSoftSkinVertex & Vertex : Section.SoftVertices )
+        {
+            for ( int32 InfluenceIdx = 0; InfluenceIdx < MAX_TOTAL_INFLUENCES; ++InfluenceIdx )
+            {
+                const int32 SectionBoneIdx = Vertex.InfluenceBones[ InfluenceIdx ];
+                *BoneIndices++ = Section.BoneMap.IsValidIndex( SectionBoneIdx ) ? Section.BoneMap[ SectionBoneIdx ] : -1;
+                *BoneWeights++ = Vertex.InfluenceWeights[ InfluenceIdx ] / 255.0f;
+            }
+        }
+    }, VertexCount < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
+
+    return true;
+}
+
+#endif
+
 bool
 FHoudiniEngineUtils::HapiCreateInputNodeForSkeletalMesh(
     HAPI_NodeId HostAssetId, USkeletalMesh * SkeletalMesh,
     HAPI_NodeId & ConnectedAssetId, TArray< HAPI_NodeId >& OutCreatedNodeIds,
     const bool& bExportSkeleton )
 {
+#if WITH_EDITOR
+
+    // If we don't have a skeletal mesh there's nothing to do.
+    if ( !SkeletalMesh || SkeletalMesh->IsPendingKill() )
+        return false;
+
+    // Inputs reusing a node that isn't one of our object merges are always uploaded.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    bool bUseUploadCache = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bCacheInputMeshUploads;
+    if ( ConnectedAssetId >= 0 && !HoudiniEngineStaticMeshUploadMergeNodes.Contains( GetSessionUploadKey( ConnectedAssetId ) ) )
+        bUseUploadCache = false;
+
+    if ( !bUseUploadCache )
+    {
+        return HapiUploadSkeletalMesh(
+            HostAssetId, SkeletalMesh, ConnectedAssetId, OutCreatedNodeIds, bExportSkeleton );
+    }
+
+    const FString UploadKey = FString::Printf( TEXT( "%s_%d" ), *SkeletalMesh->GetPathName(), bExportSkeleton ? 1 : 0 );
+    const FString ContentKey = GetSkeletalMeshUploadContentKey( SkeletalMesh );
+
+    // The upload is shared by all inputs, so its skeleton isn't tied to a host asset.
+    auto UploadMesh = [ & ]( HAPI_NodeId & UploadNodeId )
+    {
+        TArray< HAPI_NodeId > UploadCreatedNodeIds;
+        return HapiUploadSkeletalMesh( -1, SkeletalMesh, UploadNodeId, UploadCreatedNodeIds, bExportSkeleton );
+    };
+
+    HAPI_NodeId UploadNodeId = -1;
+    if ( !HapiUploadMeshToCache( HoudiniEngineSkeletalMeshUploadCache, UploadKey, ContentKey, UploadMesh, UploadNodeId ) )
+        return false;
+
+    // Hand the input an object merge of the uploaded geometry.
+    if ( !HapiConnectUploadMergeNode( UploadNodeId, ConnectedAssetId, OutCreatedNodeIds ) )
+        return false;
+
+#endif
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiUploadSkeletalMesh(
+    HAPI_NodeId HostAssetId, USkeletalMesh * SkeletalMesh,
+    HAPI_NodeId & ConnectedAssetId, TArray< HAPI_NodeId >& OutCreatedNodeIds,
+    const bool& bExportSkeleton )
+{
 #if WITH_EDITOR
     // If we don't have a skeletal mesh there's nothing to do.
     if ( !SkeletalMesh || SkeletalMesh->IsPendingKill() )
@@ -4136,15 +5507,9 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSkeletalMesh(
             MeshUVs[ UVIdx ] = FVector(UV.X, 1.0 - UV.Y, 0);
         }
 
-        if ( ImportAxis == HRSAI_Unreal )
-        {
-            // We need to re-index UVs due to swapped indices in the faces (due to winding order differences) 
-            for ( int32 WedgeIdx = 0; WedgeIdx < Indices.Num(); WedgeIdx += 3 )
-            {
-                // Swap second and third values for the vertices of the face
-                MeshUVs.SwapMemory( WedgeIdx + 1, WedgeIdx + 2 );
-            }
-        }
+        // We need to re-index UVs due to swapped indices in the faces (due to winding order differences) 
+        FHoudiniEngineUtils::ConvertWedgeVectors(
+            MeshUVs.GetData(), MeshUVs.GetData(), MeshUVs.Num(), 1.0f, false, ImportAxis == HRSAI_Unreal );
 
         // Construct attribute name for this index.
         FString UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
@@ -4188,19 +5553,11 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSkeletalMesh(
         //MeshNormals[ NormalIdx ] = FVector( SoftSkinVertices[ Indices[NormalIdx]  ].TangentZ.Vector. );
     }
 
-    if ( ImportAxis == HRSAI_Unreal )
-    {
-        // We need to re-index normals due to swapped indices on the faces (due to winding differences).
-        for ( int32 WedgeIdx = 0; WedgeIdx < Indices.Num(); WedgeIdx += 3 )
-        {
-            // Swap second and third values for the vertices of the face
-            MeshNormals.SwapMemory( WedgeIdx + 1, WedgeIdx + 2 );
-        }
-
-        // Also swap the normal's Y and Z
-        for ( int32 WedgeIdx = 0; WedgeIdx < Indices.Num(); ++WedgeIdx )
-            Swap( MeshNormals[ WedgeIdx ].Y, MeshNormals[ WedgeIdx ].Z );
-    }
+    // We need to re-index normals due to swapped indices on the faces (due to winding differences),
+    // and also swap the normal's Y and Z.
+    const bool bConvertToHoudini = ( ImportAxis == HRSAI_Unreal );
+    FHoudiniEngineUtils::ConvertWedgeVectors(
+        MeshNormals.GetData(), MeshNormals.GetData(), MeshNormals.Num(), 1.0f, bConvertToHoudini, bConvertToHoudini );
 
     // Create attribute for normals.
     HAPI_AttributeInfo AttributeInfoNormals;
@@ -4326,9 +5683,10 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSkeletalMesh(
         MaterialInterfaces[MatIdx] = SkeletalMesh->Materials[ MatIdx ].MaterialInterface;
 
     // Create list of materials, one for each face.
-    TArray< char * > MeshFaceMaterials;
+    TArray< char * > UniqueMaterialNames;
+    TArray< const char * > MeshFaceMaterials;
     FHoudiniEngineUtils::CreateFaceMaterialArray(
-        MaterialInterfaces, FaceMaterialIds, MeshFaceMaterials );
+        MaterialInterfaces, FaceMaterialIds, UniqueMaterialNames, MeshFaceMaterials );
 
     // Get name of attribute used for marshalling materials.
     std::string MarshallingAttributeName = HAPI_UNREAL_ATTRIB_MATERIAL;
@@ -4355,14 +5713,14 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSkeletalMesh(
     if ( FHoudiniApi::SetAttributeStringData(
         FHoudiniEngine::Get().GetSession(),
         DisplayGeoInfo.nodeId, 0, MarshallingAttributeName.c_str(), &AttributeInfoMaterial,
-        (const char **) MeshFaceMaterials.GetData(), 0,
+        MeshFaceMaterials.GetData(), 0,
         MeshFaceMaterials.Num() ) != HAPI_RESULT_SUCCESS )
     {
         bAttributeError = true;
     }
 
     // Delete material names.
-    FHoudiniEngineUtils::DeleteFaceMaterialArray( MeshFaceMaterials );
+    FHoudiniEngineUtils::DeleteFaceMaterialArray( UniqueMaterialNames );
 
     if ( bAttributeError )
     {
@@ -4397,7 +5755,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSkeletalMesh(
         AttributeInfo.exists = true;
         AttributeInfo.owner = HAPI_ATTROWNER_PRIM;
         AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
-        AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+        AttributeInfo.originalOwner = HAPI_ATTROWNER_POINT;
 
         HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
             FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
@@ -4447,7 +5805,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSkeletalMesh(
             AttributeInfo.exists = true;
             AttributeInfo.owner = HAPI_ATTROWNER_PRIM;
             AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
-            AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+            AttributeInfo.originalOwner = HAPI_ATTROWNER_POINT;
 
             HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
                 FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
@@ -4460,6 +5818,44 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSkeletalMesh(
         }
     }
 
+    //-------------------------------------------------------------------------
+    // Bone influences
+    //-------------------------------------------------------------------------
+    // Each point gets MAX_TOTAL_INFLUENCES bone indices and weights, sent as two fixed width point attributes.
+    TArray< int32 > BoneIndices;
+    TArray< float > BoneWeights;
+    if ( GetSkeletalMeshInfluences( SourceModel, VertexCount, BoneIndices, BoneWeights ) )
+    {
+        HAPI_AttributeInfo AttributeInfoInfluence;
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoInfluence );
+        AttributeInfoInfluence.count = VertexCount;
+        AttributeInfoInfluence.tupleSize = MAX_TOTAL_INFLUENCES;
+        AttributeInfoInfluence.exists = true;
+        AttributeInfoInfluence.owner = HAPI_ATTROWNER_POINT;
+        AttributeInfoInfluence.storage = HAPI_STORAGETYPE_INT;
+        AttributeInfoInfluence.originalOwner = HAPI_ATTROWNER_INVALID;
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
+            0, HAPI_UNREAL_ATTRIB_BONE_INDEX, &AttributeInfoInfluence ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeIntData(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
+            0, HAPI_UNREAL_ATTRIB_BONE_INDEX, &AttributeInfoInfluence,
+            BoneIndices.GetData(), 0, AttributeInfoInfluence.count ), false );
+
+        AttributeInfoInfluence.storage = HAPI_STORAGETYPE_FLOAT;
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
+            0, HAPI_UNREAL_ATTRIB_BONE_WEIGHT, &AttributeInfoInfluence ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
+            0, HAPI_UNREAL_ATTRIB_BONE_WEIGHT, &AttributeInfoInfluence,
+            BoneWeights.GetData(), 0, AttributeInfoInfluence.count ), false );
+    }
+
     // Commit the geo before doing the skeleton.
     HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
         FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId), false);
@@ -4852,7 +6248,7 @@ FHoudiniEngineUtils::HapiCreateSkeletonFromData(
         AttributeInfo.exists = true;
         AttributeInfo.owner = HAPI_ATTROWNER_DETAIL;
         AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
-        AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+        AttributeInfo.originalOwner = HAPI_ATTROWNER_POINT;
 
         HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
             FHoudiniEngine::Get().GetSession(), SkelMeshNodeInfo.id,
@@ -4916,6 +6312,142 @@ FHoudiniEngineUtils::HapiSetAssetTransform( HAPI_NodeId AssetId, const FTransfor
     return true;
 }
 
+uint32
+FHoudiniEngineUtils::HashSplitGeometry(
+    HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId, HAPI_PartId PartId,
+    const TArray< int32 > & SplitGroupVertexList,
+    TArray< float > & PartPositions, HAPI_AttributeInfo & AttribInfoPositions,
+    TArray< float > & PartNormals, HAPI_AttributeInfo & AttribInfoNormals,
+    TArray< float > & PartColors, HAPI_AttributeInfo & AttribInfoColors,
+    TArray< float > & PartAlphas, HAPI_AttributeInfo & AttribInfoAlpha,
+    TArray< TArray< float > > & PartUVs, TArray< HAPI_AttributeInfo > & AttribInfoUVs,
+    TArray< int32 > & PartFaceSmoothingMasks, HAPI_AttributeInfo & AttribInfoFaceSmoothingMasks,
+    TArray< int32 > & PartLightMapResolutions, HAPI_AttributeInfo & AttribLightmapResolution )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    // Attribute names can be remapped in the settings.
+    std::string MarshallingAttributeNameLightmapResolution = HAPI_UNREAL_ATTRIB_LIGHTMAP_RESOLUTION;
+    std::string MarshallingAttributeNameMaterial = HAPI_UNREAL_ATTRIB_MATERIAL;
+    std::string MarshallingAttributeNameFaceSmoothingMask = HAPI_UNREAL_ATTRIB_FACE_SMOOTHING_MASK;
+
+    if ( !HoudiniRuntimeSettings->MarshallingAttributeLightmapResolution.IsEmpty() )
+        FHoudiniEngineUtils::ConvertUnrealString(
+            HoudiniRuntimeSettings->MarshallingAttributeLightmapResolution, MarshallingAttributeNameLightmapResolution );
+
+    if ( !HoudiniRuntimeSettings->MarshallingAttributeMaterial.IsEmpty() )
+        FHoudiniEngineUtils::ConvertUnrealString(
+            HoudiniRuntimeSettings->MarshallingAttributeMaterial, MarshallingAttributeNameMaterial );
+
+    if ( !HoudiniRuntimeSettings->MarshallingAttributeFaceSmoothingMask.IsEmpty() )
+        FHoudiniEngineUtils::ConvertUnrealString(
+            HoudiniRuntimeSettings->MarshallingAttributeFaceSmoothingMask, MarshallingAttributeNameFaceSmoothingMask );
+
+    if ( PartPositions.Num() <= 0 )
+    {
+        if ( !FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+            AssetId, ObjectId, GeoId, PartId, HAPI_UNREAL_ATTRIB_POSITION, AttribInfoPositions, PartPositions ) )
+            return 0u;
+    }
+
+    // Normals are not read when they are always recomputed.
+    bool bReadNormals = HoudiniRuntimeSettings->RecomputeNormalsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always;
+    if ( bReadNormals && PartNormals.Num() <= 0 )
+    {
+        FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+            AssetId, ObjectId, GeoId, PartId, HAPI_UNREAL_ATTRIB_NORMAL, AttribInfoNormals, PartNormals );
+    }
+
+    if ( PartColors.Num() <= 0 )
+    {
+        FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+            AssetId, ObjectId, GeoId, PartId, HAPI_UNREAL_ATTRIB_COLOR, AttribInfoColors, PartColors );
+    }
+
+    if ( PartAlphas.Num() <= 0 )
+    {
+        FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+            AssetId, ObjectId, GeoId, PartId, HAPI_UNREAL_ATTRIB_ALPHA, AttribInfoAlpha, PartAlphas );
+    }
+
+    if ( PartUVs.Num() && PartUVs[ 0 ].Num() <= 0 )
+        FHoudiniEngineUtils::GetAllUVAttributesInfoAndTexCoords( AssetId, ObjectId, GeoId, PartId, AttribInfoUVs, PartUVs );
+
+    if ( PartFaceSmoothingMasks.Num() <= 0 )
+    {
+        FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+            AssetId, ObjectId, GeoId, PartId, MarshallingAttributeNameFaceSmoothingMask.c_str(),
+            AttribInfoFaceSmoothingMasks, PartFaceSmoothingMasks );
+    }
+
+    if ( PartLightMapResolutions.Num() <= 0 )
+    {
+        FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+            AssetId, ObjectId, GeoId, PartId, MarshallingAttributeNameLightmapResolution.c_str(),
+            AttribLightmapResolution, PartLightMapResolutions );
+    }
+
+    // Material overrides are resolved later on, only their values matter here.
+    TArray< FString > MaterialOverrides;
+    HAPI_AttributeInfo AttribInfoMaterialOverrides;
+    FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoMaterialOverrides );
+    FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+        AssetId, ObjectId, GeoId, PartId, MarshallingAttributeNameMaterial.c_str(),
+        AttribInfoMaterialOverrides, MaterialOverrides );
+
+    uint32 Hash = 0u;
+    auto HashMemory = [ &Hash ]( const void * Data, int32 Size )
+    {
+        if ( Size > 0 )
+            Hash = FCrc::MemCrc32( Data, Size, Hash );
+    };
+
+    auto HashAttribute = [ &HashMemory ]( const HAPI_AttributeInfo & AttribInfo, const void * Data, int32 Size )
+    {
+        int32 AttribLayout[ 3 ] = { AttribInfo.exists, (int32) AttribInfo.owner, AttribInfo.tupleSize };
+        HashMemory( AttribLayout, sizeof( AttribLayout ) );
+        HashMemory( Data, Size );
+    };
+
+    // Import settings which affect the generated geometry.
+    float GeneratedGeometryScaleFactor = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
+    int32 ImportSettings[ 3 ] =
+    {
+        (int32) HoudiniRuntimeSettings->ImportAxis,
+        (int32) HoudiniRuntimeSettings->RecomputeNormalsFlag,
+        (int32) HoudiniRuntimeSettings->RecomputeTangentsFlag
+    };
+    HashMemory( &GeneratedGeometryScaleFactor, sizeof( float ) );
+    HashMemory( ImportSettings, sizeof( ImportSettings ) );
+
+    HashMemory( SplitGroupVertexList.GetData(), SplitGroupVertexList.Num() * sizeof( int32 ) );
+    HashAttribute( AttribInfoPositions, PartPositions.GetData(), PartPositions.Num() * sizeof( float ) );
+
+    if ( bReadNormals )
+        HashAttribute( AttribInfoNormals, PartNormals.GetData(), PartNormals.Num() * sizeof( float ) );
+
+    HashAttribute( AttribInfoColors, PartColors.GetData(), PartColors.Num() * sizeof( float ) );
+    HashAttribute( AttribInfoAlpha, PartAlphas.GetData(), PartAlphas.Num() * sizeof( float ) );
+
+    for ( int32 TexCoordIdx = 0; TexCoordIdx < PartUVs.Num() && TexCoordIdx < AttribInfoUVs.Num(); ++TexCoordIdx )
+    {
+        HashAttribute(
+            AttribInfoUVs[ TexCoordIdx ], PartUVs[ TexCoordIdx ].GetData(), PartUVs[ TexCoordIdx ].Num() * sizeof( float ) );
+    }
+
+    HashAttribute(
+        AttribInfoFaceSmoothingMasks, PartFaceSmoothingMasks.GetData(), PartFaceSmoothingMasks.Num() * sizeof( int32 ) );
+    HashAttribute(
+        AttribLightmapResolution, PartLightMapResolutions.GetData(), PartLightMapResolutions.Num() * sizeof( int32 ) );
+
+    HashAttribute( AttribInfoMaterialOverrides, nullptr, 0 );
+    for ( const FString & MaterialOverride : MaterialOverrides )
+        Hash = FCrc::StrCrc32( *MaterialOverride, Hash );
+
+    // Keep 0 for "unknown".
+    return Hash != 0u ? Hash : 1u;
+}
+
 bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
     HAPI_NodeId AssetId,
     FHoudiniCookParams& HoudiniCookParams,
@@ -4925,6 +6457,9 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
     FTransform & ComponentTransform )
 {
 #if WITH_EDITOR
+    SCOPE_CYCLE_COUNTER( STAT_CreateStaticMeshes );
+    FHoudiniCookProfileStageScope ProfileStageScope( EHoudiniCookProfileStage::GeometryFetch );
+
     /*
     // When called via commandlet, this might be perfectly valid
     if ( !FHoudiniEngineUtils::IsHoudiniAssetValid( AssetId ) || !HoudiniCookParams.HoudiniAsset )
@@ -4934,6 +6469,15 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
     // Make sure rendering is done - so we are not changing data being used by collision drawing.
     FlushRenderingCommands();
 
+    // Static meshes from the previous cook may still be building, we are about to modify their source models.
+    FHoudiniEngineMeshBuildQueue & StaticMeshBuildQueue = FHoudiniEngine::Get().GetStaticMeshBuildQueue();
+    for ( const TPair< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshIn : StaticMeshesIn )
+        StaticMeshBuildQueue.FinishBuild( StaticMeshIn.Value );
+
+    // The raw data of every part is extracted into the same buffers, in the post cook's if one is running.
+    FHoudiniScopedPartScratchBuffers ScopedPartScratchBuffers;
+    FHoudiniPartScratchBuffers & PartScratchBuffers = ScopedPartScratchBuffers.Get();
+
     // Get runtime settings.
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
     check( HoudiniRuntimeSettings );
@@ -5127,6 +6671,9 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
         FKAggregateGeom AggregateCollisionGeo;
         bool bHasAggregateGeometryCollision = false;
 
+        // Multi hull decompositions of the UCX colliders run on worker threads until the aggregate is needed.
+        FHoudiniConvexDecompositionTasks ConvexDecompositionTasks;
+
         // Prepare the object that will store the mesh sockets and their names
         TArray< FTransform > AllSockets;
         TArray< FString > AllSocketsNames;
@@ -5257,6 +6804,9 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
             // Retrieve material information for this geo part.
             TArray< HAPI_NodeId > PartFaceMaterialIds;
+            // Distinct material ids of the part, and the index in it of each face's material
+            TArray< HAPI_NodeId > PartMaterialSlotIds;
+            TArray< int32 > PartFaceMaterialSlots;
             HAPI_Bool bSingleFaceMaterial = false;
             bool bPartHasMaterials = false;
             bool bMaterialsChanged = false;
@@ -5277,11 +6827,26 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     continue;
                 }
 
-                // Set flag if we have materials.
-                TArray< HAPI_NodeId > PartUniqueMaterialIds;
-                for ( int32 MaterialIdx = 0; MaterialIdx < PartFaceMaterialIds.Num(); ++MaterialIdx )
-                    PartUniqueMaterialIds.AddUnique( PartFaceMaterialIds[ MaterialIdx ] );
+                // Gather the distinct materials and the material slot of each face in a single pass.
+                TMap< HAPI_NodeId, int32 > PartMaterialSlotIndices;
+                PartFaceMaterialSlots.SetNumUninitialized( PartFaceMaterialIds.Num() );
+                HAPI_NodeId PreviousMaterialId = -1;
+                int32 PreviousMaterialSlot = INDEX_NONE;
+                for ( int32 FaceIdx = 0; FaceIdx < PartFaceMaterialIds.Num(); ++FaceIdx )
+                {
+                    const HAPI_NodeId MaterialId = PartFaceMaterialIds[ FaceIdx ];
+                    if ( PreviousMaterialSlot == INDEX_NONE || MaterialId != PreviousMaterialId )
+                    {
+                        const int32 * FoundSlot = PartMaterialSlotIndices.Find( MaterialId );
+                        PreviousMaterialSlot = FoundSlot ? *FoundSlot : PartMaterialSlotIndices.Add( MaterialId, PartMaterialSlotIds.Add( MaterialId ) );
+                        PreviousMaterialId = MaterialId;
+                    }
+
+                    PartFaceMaterialSlots[ FaceIdx ] = PreviousMaterialSlot;
+                }
 
+                // Set flag if we have materials.
+                TArray< HAPI_NodeId > PartUniqueMaterialIds = PartMaterialSlotIds;
                 PartUniqueMaterialIds.RemoveSingle( -1 );
                 bPartHasMaterials = PartUniqueMaterialIds.Num() > 0;
 
@@ -5317,7 +6882,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     if ( InstancerMaterialId > -1 && FHoudiniEngineMaterialUtils::GetUniqueMaterialShopName( AssetId, InstancerMaterialId, InstancerMaterialShopName ) )
                     {
                         HoudiniGeoPartObject.bInstancerMaterialAvailable = true;
-                        HoudiniGeoPartObject.InstancerMaterialName = InstancerMaterialShopName;
+                        HoudiniGeoPartObject.InstancerMaterialName = FName( *InstancerMaterialShopName );
                     }
                 }
 
@@ -5339,7 +6904,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         if ( !InstancerAttribMaterialName.IsEmpty() )
                         {
                             HoudiniGeoPartObject.bInstancerAttributeMaterialAvailable = true;
-                            HoudiniGeoPartObject.InstancerAttributeMaterialName = InstancerAttribMaterialName;
+                            HoudiniGeoPartObject.InstancerAttributeMaterialName = FName( *InstancerAttribMaterialName );
                         }
                     }
                 }
@@ -5349,56 +6914,68 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 continue;
             }
 
-            // Containers used for raw data extraction.
+            // Containers used for raw data extraction, they keep their allocations from the previous parts.
+            PartScratchBuffers.Reset();
 
             // Vertex Positions
-            TArray< float > PartPositions;
+            TArray< float > & PartPositions = PartScratchBuffers.Positions;
             HAPI_AttributeInfo AttribInfoPositions;
             FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoPositions );
 
             // Vertex Normals
-            TArray< float > PartNormals;
+            TArray< float > & PartNormals = PartScratchBuffers.Normals;
             HAPI_AttributeInfo AttribInfoNormals;
             FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoNormals );
 
             // Vertex Colors
-            TArray< float > PartColors;
+            TArray< float > & PartColors = PartScratchBuffers.Colors;
             HAPI_AttributeInfo AttribInfoColors;
             FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoColors );
 
             // Vertex Alpha values
-            TArray< float > PartAlphas;
+            TArray< float > & PartAlphas = PartScratchBuffers.Alphas;
             HAPI_AttributeInfo AttribInfoAlpha;
             FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoAlpha );
 
             // UVs
-            TArray< TArray< float > > PartUVs;
-            PartUVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
+            TArray< TArray< float > > & PartUVs = PartScratchBuffers.UVs;
             TArray< HAPI_AttributeInfo > AttribInfoUVs;
             AttribInfoUVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
 
-            // Material Overrides per face
-            TArray< FString > PartFaceMaterialAttributeOverrides;
+            // Material Overrides per face, as indices into the table of distinct material names
+            TArray< FString > & PartFaceMaterialOverrideNames = PartScratchBuffers.FaceMaterialOverrideNames;
+            TArray< int32 > & PartFaceMaterialAttributeOverrides = PartScratchBuffers.FaceMaterialOverrides;
             HAPI_AttributeInfo AttribFaceMaterials;
             FMemory::Memzero< HAPI_AttributeInfo >( AttribFaceMaterials );
 
             // Face Smoothing masks
-            TArray< int32 > PartFaceSmoothingMasks;
+            TArray< int32 > & PartFaceSmoothingMasks = PartScratchBuffers.FaceSmoothingMasks;
             HAPI_AttributeInfo AttribInfoFaceSmoothingMasks;
             FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoFaceSmoothingMasks );
 
             // Lightmap resolution
-            TArray< int32 > PartLightMapResolutions;
+            TArray< int32 > & PartLightMapResolutions = PartScratchBuffers.LightMapResolutions;
             HAPI_AttributeInfo AttribLightmapResolution;
             FMemory::Memzero< HAPI_AttributeInfo >( AttribLightmapResolution );
 
             // Vertex Indices
-            TArray< int32 > PartVertexList;
+            TArray< int32 > & PartVertexList = PartScratchBuffers.VertexList;
             PartVertexList.SetNumUninitialized( PartInfo.vertexCount );
 
-            if ( HAPI_RESULT_SUCCESS != FHoudiniApi::GetVertexList(
-                FHoudiniEngine::Get().GetSession(), GeoInfo.nodeId, PartInfo.id,
-                &PartVertexList[ 0 ], 0, PartInfo.vertexCount ) )
+            // Very large parts are imported in chunks, their vertex list is read range by range.
+            const bool bChunkedImport = HoudiniRuntimeSettings->ChunkedImportPrimitiveThreshold > 0
+                && PartInfo.faceCount > HoudiniRuntimeSettings->ChunkedImportPrimitiveThreshold;
+
+            bool bVertexListRetrieved = true;
+            const int32 VertexChunkLength = bChunkedImport ? HAPI_UNREAL_CHUNKED_IMPORT_CHUNK_SIZE : FMath::Max( PartInfo.vertexCount, 1 );
+            for ( int32 ChunkStart = 0; bVertexListRetrieved && ChunkStart < PartInfo.vertexCount; ChunkStart += VertexChunkLength )
+            {
+                bVertexListRetrieved = HAPI_RESULT_SUCCESS == FHoudiniApi::GetVertexList(
+                    FHoudiniEngine::Get().GetSession(), GeoInfo.nodeId, PartInfo.id,
+                    PartVertexList.GetData() + ChunkStart, ChunkStart, FMath::Min( VertexChunkLength, PartInfo.vertexCount - ChunkStart ) );
+            }
+
+            if ( !bVertexListRetrieved )
             {
                 // Error getting the vertex list.
                 HOUDINI_LOG_MESSAGE(
@@ -5409,7 +6986,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
             }
 
             // Array Storing the GroupNames for the current part
-            TArray< FString > GroupNames;
+            TArray< FString > & GroupNames = PartScratchBuffers.GroupNames;
             if ( !PartInfo.isInstanced )
             {
                 GroupNames = ObjectGeoGroupNames;
@@ -5479,33 +7056,32 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
             if ( bRequireSplit )
             {
-                // Buffer for all vertex indices used for split groups.
-                // We need this to figure out all vertex indices that are not part of them. 
-                TArray< int32 > AllSplitVertexList;
-                AllSplitVertexList.SetNumZeroed( PartVertexList.Num() );
+                // Retrieve the membership of all split groups at once, and partition the part's faces between them in a single pass.
+                TArray< FHoudiniGroupMembership > SplitGroupMemberships;
+                FHoudiniEngineUtils::HapiGetGroupMemberships(
+                    AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id, HAPI_GROUPTYPE_PRIM,
+                    SplitGroupNames, SplitGroupMemberships );
 
-                // Buffer for all face indices used for split groups.
-                // We need this to figure out all face indices that are not part of them.
-                TArray< int32 > AllSplitFaceIndices;
-                AllSplitFaceIndices.SetNumZeroed( PartFaceMaterialIds.Num() );
+                TArray< TArray< int32 > > SplitGroupVertexLists;
+                TArray< TArray< int32 > > SplitGroupFaceLists;
+                TArray< int32 > SplitGroupWedgeCounts;
+                TArray< int32 > GroupSplitFacesRemaining;
+                TArray< int32 > GroupSplitFaceIndicesRemaining;
+                int32 RemainingWedgeCount = 0;
+                FHoudiniEngineUtils::PartitionVertexListByGroups(
+                    PartVertexList, PartFaceMaterialIds.Num(), SplitGroupMemberships,
+                    SplitGroupVertexLists, SplitGroupFaceLists, SplitGroupWedgeCounts,
+                    GroupSplitFacesRemaining, GroupSplitFaceIndicesRemaining, RemainingWedgeCount );
 
                 // Some of the groups may contain invalid geometry 
                 // Store them here so we can remove them afterwards
                 TArray< int32 > InvalidGroupNameIndices;
 
-                // Extract the vertices/faces for each of the split groups
+                // Store the vertices/faces for each of the split groups
                 for ( int32 SplitIdx = 0; SplitIdx < SplitGroupNames.Num(); SplitIdx++ )
                 {
-                    FString GroupName = SplitGroupNames[ SplitIdx ];
-
-                    // New vertex list just for this group.
-                    TArray< int32 > GroupVertexList;
-                    TArray< int32 > AllFaceList;
-
-                    // Extract vertex indices for this split.
-                    GroupVertexListCount = FHoudiniEngineUtils::HapiGetVertexListForGroup(
-                        AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id, GroupName, PartVertexList, GroupVertexList,
-                        AllSplitVertexList, AllFaceList, AllSplitFaceIndices, PartInfo.isInstanced );
+                    const FString & GroupName = SplitGroupNames[ SplitIdx ];
+                    GroupVertexListCount = SplitGroupWedgeCounts[ SplitIdx ];
 
                     if ( GroupVertexListCount <= 0 )
                     {
@@ -5521,9 +7097,9 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     }
 
                     // If list is not empty, we store it for this group - this will define new mesh.
-                    GroupSplitFaces.Add( GroupName, GroupVertexList );
+                    GroupSplitFaces.Add( GroupName, MoveTemp( SplitGroupVertexLists[ SplitIdx ] ) );
                     GroupSplitFaceCounts.Add( GroupName, GroupVertexListCount );
-                    GroupSplitFaceIndices.Add( GroupName, AllFaceList );
+                    GroupSplitFaceIndices.Add( GroupName, MoveTemp( SplitGroupFaceLists[ SplitIdx ] ) );
                 }
 
                 if ( InvalidGroupNameIndices.Num() > 0 )
@@ -5543,55 +7119,37 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     }
                 }
 
-                // We also need to figure out / construct vertex list for everything that's not in a split group
-                TArray< int32 > GroupSplitFacesRemaining;
-                GroupSplitFacesRemaining.Init( -1, PartVertexList.Num() );
-                bool bMainSplitGroup = false;
-                GroupVertexListCount = 0;
-
-                TArray< int32 > GroupSplitFaceIndicesRemaining;
-                for ( int32 SplitVertexIdx = 0; SplitVertexIdx < AllSplitVertexList.Num(); SplitVertexIdx++ )
-                {
-                    if ( AllSplitVertexList[ SplitVertexIdx ] == 0 )
-                    {
-                        // This is unused index, we need to add it to unused vertex list.
-                        GroupSplitFacesRemaining[ SplitVertexIdx ] = PartVertexList[ SplitVertexIdx ];
-                        bMainSplitGroup = true;
-                        GroupVertexListCount++;
-                    }
-                }
-
-                for ( int32 SplitFaceIdx = 0; SplitFaceIdx < AllSplitFaceIndices.Num(); SplitFaceIdx++ )
-                {
-                    if ( AllSplitFaceIndices[ SplitFaceIdx ] == 0 )
-                    {
-                        // This is unused face, we need to add it to unused faces list.
-                        GroupSplitFaceIndicesRemaining.Add( SplitFaceIdx );
-                    }
-                }
-
-                // We store the remaining geo vertex list as a special name (main geo)
+                // We store the remaining geo vertex list, everything that's not in a split group, as a special name (main geo)
                 // and make sure its treated before the collider meshes
-                if ( bMainSplitGroup )
+                if ( RemainingWedgeCount > 0 )
                 {
                     SplitGroupNames.Insert( RemainingGroupName, nLODInsertPos );
-                    GroupSplitFaces.Add( RemainingGroupName, GroupSplitFacesRemaining );
-                    GroupSplitFaceCounts.Add( RemainingGroupName, GroupVertexListCount );
-                    GroupSplitFaceIndices.Add( RemainingGroupName, GroupSplitFaceIndicesRemaining );
+                    GroupSplitFaces.Add( RemainingGroupName, MoveTemp( GroupSplitFacesRemaining ) );
+                    GroupSplitFaceCounts.Add( RemainingGroupName, RemainingWedgeCount );
+                    GroupSplitFaceIndices.Add( RemainingGroupName, MoveTemp( GroupSplitFaceIndicesRemaining ) );
                 }
             }
             else
             {
                 // No splitting required
                 SplitGroupNames.Add( RemainingGroupName );
-                GroupSplitFaces.Add( RemainingGroupName, PartVertexList );
                 GroupSplitFaceCounts.Add( RemainingGroupName, PartVertexList.Num() );
+                if ( bChunkedImport )
+                {
+                    // Hand the vertex list over rather than keeping a second copy of a very large part.
+                    GroupSplitFaces.Add( RemainingGroupName, MoveTemp( PartVertexList ) );
+                }
+                else
+                {
+                    GroupSplitFaces.Add( RemainingGroupName, PartVertexList );
+                }
 
                 TArray<int32> AllFaces;
+                AllFaces.Reserve( PartInfo.faceCount );
                 for ( int32 FaceIdx = 0; FaceIdx < PartInfo.faceCount; ++FaceIdx )
                     AllFaces.Add( FaceIdx );
 
-                GroupSplitFaceIndices.Add( RemainingGroupName, AllFaces );
+                GroupSplitFaceIndices.Add( RemainingGroupName, MoveTemp( AllFaces ) );
             }
 
             // Look for LOD Specific attributes, "lod_screensize" by default
@@ -5608,8 +7166,10 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
             // Map of Houdini Material IDs to Unreal Material Indices
             TMap< HAPI_NodeId, int32 > MapHoudiniMatIdToUnrealIndex;
-            // Map of Houdini Material Attributes to Unreal Material Indices
-            TMap< FString, int32 > MapHoudiniMatAttributesToUnrealIndex;
+            // Unreal Material Indices of the Houdini Material Attributes, indexed like the table of material names
+            TArray< int32 > HoudiniMatAttributesUnrealIndices;
+            // Unreal Material Indices of the Houdini Materials, indexed like the part's material slots
+            TArray< int32 > HoudiniMatSlotsUnrealIndices;
 
             // Iterate through all detected split groups we care about and split geometry.
             // The split are ordered in the following way:
@@ -5650,7 +7210,8 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 if ( !IsLOD || ( IsLOD && LodIndex == 0 ) )
                 {
                     MapHoudiniMatIdToUnrealIndex.Empty();
-                    MapHoudiniMatAttributesToUnrealIndex.Empty();
+                    HoudiniMatAttributesUnrealIndices.Reset();
+                    HoudiniMatSlotsUnrealIndices.Reset();
                 }
 
                 // Record split id in geo part.
@@ -5728,7 +7289,8 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         MultiHullDecomp = true;
 
                     // Create the convex hull colliders and add them to the Aggregate
-                    if ( AddConvexCollisionToAggregate( PartPositions, SplitGroupVertexList, MultiHullDecomp, AggregateCollisionGeo ) )
+                    if ( AddConvexCollisionToAggregate(
+                        PartPositions, SplitGroupVertexList, MultiHullDecomp, AggregateCollisionGeo, &ConvexDecompositionTasks ) )
                     {
                         // We'll add the collision after all the meshes are generated unless this a rendered_collision_geo_ucx
                         bHasAggregateGeometryCollision = true;
@@ -5740,7 +7302,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 }
 
                 // Record split group name.
-                HoudiniGeoPartObject.SplitName = SplitGroupName;
+                HoudiniGeoPartObject.SplitName = SplitGroupName.IsEmpty() ? NAME_None : FName( *SplitGroupName );
 
                 // Attempt to locate static mesh from previous instantiation.
                 UStaticMesh * const * FoundStaticMesh = StaticMeshesIn.Find( HoudiniGeoPartObject );
@@ -5757,6 +7319,30 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 if ( GeoInfo.hasGeoChanged || ForceRebuildStaticMesh || ForceRecookAll )
                     bRebuildStaticMesh = true;
 
+                // Geometry changes are only reported per geo, so hash the content of this split and compare it with
+                // the one its previous static mesh was built from. Collisions and LODs are merged across splits
+                // and always get rebuilt.
+                if ( bRebuildStaticMesh && !IsLOD && !bHasAggregateGeometryCollision
+                    && !HoudiniGeoPartObject.bIsSimpleCollisionGeo && !HoudiniGeoPartObject.bIsUCXCollisionGeo )
+                {
+                    HoudiniGeoPartObject.GeometryHash = HashSplitGeometry(
+                        AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id, SplitGroupVertexList,
+                        PartPositions, AttribInfoPositions, PartNormals, AttribInfoNormals,
+                        PartColors, AttribInfoColors, PartAlphas, AttribInfoAlpha, PartUVs, AttribInfoUVs,
+                        PartFaceSmoothingMasks, AttribInfoFaceSmoothingMasks, PartLightMapResolutions, AttribLightmapResolution );
+
+                    // A manual recook always rebuilds, otherwise reuse the mesh if this split's content is unchanged.
+                    const FHoudiniGeoPartObject * PreviousHoudiniGeoPartObject =
+                        ( FoundStaticMesh && *FoundStaticMesh ) ? StaticMeshesIn.FindKey( *FoundStaticMesh ) : nullptr;
+
+                    if ( !ForceRecookAll && !bMaterialsChanged && PreviousHoudiniGeoPartObject
+                        && HoudiniGeoPartObject.GeometryHash != 0u
+                        && HoudiniGeoPartObject.GeometryHash == PreviousHoudiniGeoPartObject->GeometryHash )
+                    {
+                        bRebuildStaticMesh = false;
+                    }
+                }
+
                 // The geometry has not changed,
                 if ( !bRebuildStaticMesh )
                 {
@@ -5850,12 +7436,16 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 // Compute number of faces.
                 int32 SplitGroupFaceCount = SplitGroupFaceIndices.Num();
 
+                // Degenerate triangles and lightmap uvs of the raw mesh, once its geometry is known.
+                FHoudiniRawMeshStats RawMeshStats;
+
                 if ( bRebuildStaticMesh )
                 {
                     //--------------------------------------------------------------------------------------------------------------------- 
                     // NORMALS
                     //--------------------------------------------------------------------------------------------------------------------- 
-                    TArray< float > SplitGroupNormals;
+                    // Normals are transferred straight into the raw mesh and converted in place.
+                    int32 WedgeNormalCount = 0;
 
                     // No need to read the normals if we'll recompute them after
                     bool bReadNormals = HoudiniRuntimeSettings->RecomputeNormalsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always;                
@@ -5869,59 +7459,49 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                                 PartInfo.id, HAPI_UNREAL_ATTRIB_NORMAL, AttribInfoNormals, PartNormals );
                         }
 
-                        // See if we need to transfer normal point attributes to vertex attributes.
-                        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                            SplitGroupVertexList, AttribInfoNormals, PartNormals, SplitGroupNormals );
+                        // Ensure the normals have the expected number of values.
+                        if ( AttribInfoNormals.exists && AttribInfoNormals.tupleSize < 3 )
+                        {
+                            HOUDINI_LOG_WARNING(TEXT("Invalid normal count detected - Skipping normals."));
+                        }
+                        else
+                        {
+                            // See if we need to transfer normal point attributes to vertex attributes.
+                            RawMesh.WedgeTangentZ.SetNumUninitialized( SplitGroupVertexList.Num() );
+                            WedgeNormalCount = FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+                                SplitGroupVertexList, AttribInfoNormals, PartNormals,
+                                (float *) RawMesh.WedgeTangentZ.GetData(), 3 );
+                        }
                     }
 
+                    RawMesh.WedgeTangentZ.SetNum( WedgeNormalCount, false );
+
                     // See if we need to generate tangents, we do this only if normals are present, and if we do not recompute them after
-                    bool bGenerateTangents = ( SplitGroupNormals.Num() > 0 );
+                    bool bGenerateTangents = ( WedgeNormalCount > 0 );
                     if ( bGenerateTangents && ( HoudiniRuntimeSettings->RecomputeTangentsFlag == EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always ) )
                     {
                         // No need to generate tangents if we'll recompute them after
                         bGenerateTangents = false;
                     }
 
-                    // Transfer normals.
-                    int32 WedgeNormalCount = SplitGroupNormals.Num() / 3;
-
-                    // Ensure the number of Normal values is correct
-                    if ( SplitGroupNormals.Num() > 0
-                        && !SplitGroupNormals.IsValidIndex( (WedgeNormalCount - 1) * 3 + 2 ) )
+                    if ( bGenerateTangents )
                     {
-                        // Ignore normals
-                        WedgeNormalCount = 0;
-                        HOUDINI_LOG_WARNING(TEXT("Invalid normal count detected - Skipping normals."));
+                        RawMesh.WedgeTangentX.SetNumZeroed( WedgeNormalCount );
+                        RawMesh.WedgeTangentY.SetNumZeroed( WedgeNormalCount );
                     }
 
-                    RawMesh.WedgeTangentZ.SetNumZeroed( WedgeNormalCount );
-                    for ( int32 WedgeTangentZIdx = 0; WedgeTangentZIdx < WedgeNormalCount; ++WedgeTangentZIdx )
-                    {
-                        FVector WedgeTangentZ;
-                        WedgeTangentZ.X = SplitGroupNormals[ WedgeTangentZIdx * 3 + 0 ];
-                        if ( ImportAxis == HRSAI_Unreal )
-                        {
-                            // We need to flip Z and Y coordinate
-                            WedgeTangentZ.Y = SplitGroupNormals[ WedgeTangentZIdx * 3 + 2 ];
-                            WedgeTangentZ.Z = SplitGroupNormals[ WedgeTangentZIdx * 3 + 1 ];
-                        }
-                        else
-                        {
-                            WedgeTangentZ.Y = SplitGroupNormals[ WedgeTangentZIdx * 3 + 1 ];
-                            WedgeTangentZ.Z = SplitGroupNormals[ WedgeTangentZIdx * 3 + 2 ];
-                        }
-
-                        RawMesh.WedgeTangentZ[ WedgeTangentZIdx ] = WedgeTangentZ;
+                    // We need to flip Z and Y coordinate
+                    FHoudiniEngineUtils::ScaleAndSwapVectors(
+                        RawMesh.WedgeTangentZ.GetData(), WedgeNormalCount, 1.0f, ImportAxis == HRSAI_Unreal );
 
-                        // If we need to generate tangents.
-                        if ( bGenerateTangents )
+                    // If we need to generate tangents, each wedge is done independently on worker threads for large splits.
+                    if ( bGenerateTangents )
+                    {
+                        ParallelFor( WedgeNormalCount, [&]( int32 WedgeTangentZIdx )
                         {
-                            FVector TangentX, TangentY;
-                            WedgeTangentZ.FindBestAxisVectors( TangentX, TangentY );
-
-                            RawMesh.WedgeTangentX.Add( TangentX );
-                            RawMesh.WedgeTangentY.Add( TangentY );
-                        }
+                            RawMesh.WedgeTangentZ[ WedgeTangentZIdx ].FindBestAxisVectors(
+                                RawMesh.WedgeTangentX[ WedgeTangentZIdx ], RawMesh.WedgeTangentY[ WedgeTangentZIdx ] );
+                        }, WedgeNormalCount < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
                     }
 
                     //--------------------------------------------------------------------------------------------------------------------- 
@@ -5936,10 +7516,6 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                             PartInfo.id, HAPI_UNREAL_ATTRIB_COLOR, AttribInfoColors, PartColors );
                     }
 
-                    // See if we need to transfer color point attributes to vertex attributes.
-                    FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                        SplitGroupVertexList, AttribInfoColors, PartColors, SplitGroupColors );
-
                     TArray< float > SplitGroupAlphas;
                     if ( PartAlphas.Num() <= 0 )
                     {
@@ -5949,9 +7525,51 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                             PartInfo.id, HAPI_UNREAL_ATTRIB_ALPHA, AttribInfoAlpha, PartAlphas );
                     }
 
-                    // See if we need to transfer alpha point attributes to vertex attributes.
-                    FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                        SplitGroupVertexList, AttribInfoAlpha, PartAlphas, SplitGroupAlphas );
+                    // Extract all UV sets
+                    if ( PartUVs.Num() && PartUVs[0].Num() <= 0 )
+                    {
+                        // Retrieve all the UVs sets for this part
+                        FHoudiniEngineUtils::GetAllUVAttributesInfoAndTexCoords(
+                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
+                            AttribInfoUVs, PartUVs );
+                    }
+
+                    // Colors, alphas and UVs are transferred to vertex attributes in a single pass over the split's wedges.
+                    // UVs are written straight into the Raw Mesh.
+                    TArray< FHoudiniWedgeAttributeTransfer > WedgeAttributeTransfers;
+                    if ( AttribInfoColors.exists && AttribInfoColors.tupleSize > 0 )
+                    {
+                        SplitGroupColors.SetNumUninitialized( SplitGroupVertexList.Num() * AttribInfoColors.tupleSize );
+                        WedgeAttributeTransfers.Emplace(
+                            AttribInfoColors, PartColors, SplitGroupColors.GetData(), AttribInfoColors.tupleSize );
+                    }
+
+                    if ( AttribInfoAlpha.exists && AttribInfoAlpha.tupleSize > 0 )
+                    {
+                        SplitGroupAlphas.SetNumUninitialized( SplitGroupVertexList.Num() * AttribInfoAlpha.tupleSize );
+                        WedgeAttributeTransfers.Emplace(
+                            AttribInfoAlpha, PartAlphas, SplitGroupAlphas.GetData(), AttribInfoAlpha.tupleSize );
+                    }
+
+                    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
+                    {
+                        if ( AttribInfoUVs[ TexCoordIdx ].exists && AttribInfoUVs[ TexCoordIdx ].tupleSize >= 2 )
+                        {
+                            TArray< FVector2D > & WedgeTexCoords = RawMesh.WedgeTexCoords[ TexCoordIdx ];
+                            WedgeTexCoords.SetNumUninitialized( SplitGroupVertexList.Num() );
+                            WedgeAttributeTransfers.Emplace(
+                                AttribInfoUVs[ TexCoordIdx ], PartUVs[ TexCoordIdx ], (float *) WedgeTexCoords.GetData(), 2 );
+                        }
+                    }
+
+                    int32 WedgeAttributeCount = FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+                        SplitGroupVertexList, WedgeAttributeTransfers );
+
+                    if ( AttribInfoColors.exists && AttribInfoColors.tupleSize > 0 )
+                        SplitGroupColors.SetNum( WedgeAttributeCount * AttribInfoColors.tupleSize, false );
+
+                    if ( AttribInfoAlpha.exists && AttribInfoAlpha.tupleSize > 0 )
+                        SplitGroupAlphas.SetNum( WedgeAttributeCount * AttribInfoAlpha.tupleSize, false );
 
                     // Transfer colors and alphas to the raw mesh
                     if ( AttribInfoColors.exists && ( AttribInfoColors.tupleSize > 0 ) )
@@ -5967,7 +7585,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         }
 
                         RawMesh.WedgeColors.SetNumZeroed( WedgeColorsCount );
-                        for ( int32 WedgeColorIdx = 0; WedgeColorIdx < WedgeColorsCount; ++WedgeColorIdx )
+                        ParallelFor( WedgeColorsCount, [&]( int32 WedgeColorIdx )
                         {
                             FLinearColor WedgeColor;
                             WedgeColor.R = FMath::Clamp(
@@ -5994,7 +7612,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
                             // Convert linear color to fixed color.
                             RawMesh.WedgeColors[ WedgeColorIdx ] = WedgeColor.ToFColor( false );
-                        }
+                        }, WedgeColorsCount < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
                     }
                     else
                     {
@@ -6038,45 +7656,25 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     //  UVS
                     //--------------------------------------------------------------------------------------------------------------------- 
 
-                    // Extract all UV sets
-                    TArray< TArray< float > > SplitGroupUVs;
-                    SplitGroupUVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
-
-                    if ( PartUVs.Num() && PartUVs[0].Num() <= 0 )
-                    {
-                        // Retrieve all the UVs sets for this part
-                        FHoudiniEngineUtils::GetAllUVAttributesInfoAndTexCoords(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
-                            AttribInfoUVs, PartUVs );
-                    }
-
-                    // See if we need to transfer uv point attributes to vertex attributes.
-                    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
-                    {
-                        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                            SplitGroupVertexList, AttribInfoUVs[ TexCoordIdx ], PartUVs[ TexCoordIdx ], SplitGroupUVs[ TexCoordIdx ] );
-                    }
-
-                    // Transfer UVs to the Raw Mesh
+                    // UVs have been transferred to the Raw Mesh along with the colors.
                     int32 UVChannelCount = 0;
                     int32 LightMapUVChannel = 0;
                     for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
                     {
-                        TArray< float > & TextureCoordinate = SplitGroupUVs[ TexCoordIdx ];
-                        int32 WedgeUVCount = TextureCoordinate.Num() / 2;
+                        TArray< FVector2D > & WedgeTexCoords = RawMesh.WedgeTexCoords[ TexCoordIdx ];
+                        int32 WedgeUVCount = 0;
+
+                        if ( AttribInfoUVs[ TexCoordIdx ].exists && AttribInfoUVs[ TexCoordIdx ].tupleSize >= 2 )
+                            WedgeUVCount = WedgeAttributeCount;
 
-                        if ( TextureCoordinate.Num() > 0 && TextureCoordinate.IsValidIndex((WedgeUVCount - 1) * 2 + 1) )
+                        if ( WedgeUVCount > 0 )
                         {
-                            RawMesh.WedgeTexCoords[ TexCoordIdx ].SetNumZeroed( WedgeUVCount );
-                            for ( int32 WedgeUVIdx = 0; WedgeUVIdx < WedgeUVCount; ++WedgeUVIdx )
+                            WedgeTexCoords.SetNum( WedgeUVCount, false );
+                            ParallelFor( WedgeUVCount, [&]( int32 WedgeUVIdx )
                             {
                                 // We need to flip V coordinate when it's coming from HAPI.
-                                FVector2D WedgeUV;
-                                WedgeUV.X = TextureCoordinate[ WedgeUVIdx * 2 + 0 ];
-                                WedgeUV.Y = 1.0f - TextureCoordinate[ WedgeUVIdx * 2 + 1 ];
-
-                                RawMesh.WedgeTexCoords[ TexCoordIdx ][ WedgeUVIdx ] = WedgeUV;
-                            }
+                                WedgeTexCoords[ WedgeUVIdx ].Y = 1.0f - WedgeTexCoords[ WedgeUVIdx ].Y;
+                            }, WedgeUVCount < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
 
                             UVChannelCount++;
 
@@ -6259,7 +7857,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     //
                     int32 VertexPositionsCount = NeededVertices.Num();
                     RawMesh.VertexPositions.SetNumZeroed( VertexPositionsCount );
-                    for ( int32 VertexPositionIdx = 0; VertexPositionIdx < VertexPositionsCount; ++VertexPositionIdx )
+                    ParallelFor( VertexPositionsCount, [&]( int32 VertexPositionIdx )
                     {
                         int32 NeededVertexIndex = NeededVertices[ VertexPositionIdx ];
                         if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
@@ -6269,28 +7867,24 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                                 TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
                                 TEXT("- skipping."),
                                 ObjectInfo.nodeId, *ObjectName, GeoInfo.nodeId, PartIdx, *PartName, SplitId, *SplitGroupName);
-                        }
 
-                        FVector VertexPosition;
-                        VertexPosition.X = PartPositions[ NeededVertexIndex * 3 + 0 ] * GeneratedGeometryScaleFactor;
-                        if ( ImportAxis == HRSAI_Unreal )
-                        {
-                            // We need to swap Z and Y coordinate here.                            
-                            VertexPosition.Y = PartPositions[ NeededVertexIndex * 3 + 2 ] * GeneratedGeometryScaleFactor;
-                            VertexPosition.Z = PartPositions[ NeededVertexIndex * 3 + 1 ] * GeneratedGeometryScaleFactor;
-                        }
-                        else if ( ImportAxis == HRSAI_Houdini )
-                        {
-                            // No swap required.
-                            VertexPosition.Y = PartPositions[ NeededVertexIndex * 3 + 1 ] * GeneratedGeometryScaleFactor;
-                            VertexPosition.Z = PartPositions[ NeededVertexIndex * 3 + 2 ] * GeneratedGeometryScaleFactor;
+                            return;
                         }
 
-                        RawMesh.VertexPositions[ VertexPositionIdx ] = VertexPosition;
-                    }
+                        FMemory::Memcpy(
+                            &RawMesh.VertexPositions[ VertexPositionIdx ], &PartPositions[ NeededVertexIndex * 3 ], sizeof( FVector ) );
+                    }, VertexPositionsCount < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
+
+                    // Scale the gathered positions and swap Z and Y coordinate if needed.
+                    FHoudiniEngineUtils::ScaleAndSwapVectors(
+                        RawMesh.VertexPositions.GetData(), VertexPositionsCount,
+                        GeneratedGeometryScaleFactor, ImportAxis == HRSAI_Unreal );
+
+                    // Gather the statistics we need on this mesh in one pass.
+                    FHoudiniEngineUtils::ComputeRawMeshStats( RawMesh, StaticMesh->LightMapCoordinateIndex, RawMeshStats );
 
                     // We need to check if this mesh contains only degenerate triangles.
-                    if ( FHoudiniEngineUtils::CountDegenerateTriangles( RawMesh ) == SplitGroupFaceCount )
+                    if ( RawMeshStats.DegenerateTriangleCount == SplitGroupFaceCount )
                     {
                         // This mesh contains only degenerate triangles, there's nothing we can do.
                         if ( bStaticMeshCreated )
@@ -6305,6 +7899,8 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     // So we can just load the old data into the Raw mesh and reuse it.
                     FRawMeshBulkData * InRawMeshBulkData = SrcModel->RawMeshBulkData;
                     InRawMeshBulkData->LoadRawMesh( RawMesh );
+
+                    FHoudiniEngineUtils::ComputeRawMeshStats( RawMesh, StaticMesh->LightMapCoordinateIndex, RawMeshStats );
                 }
 
                 //--------------------------------------------------------------------------------------------------------------------- 
@@ -6314,29 +7910,27 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 // See if we have material override attributes
                 if ( PartFaceMaterialAttributeOverrides.Num() <= 0 )
                 {
-                    FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+                    FHoudiniEngineUtils::HapiGetAttributeDataAsStringTable(
                         AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
                         MarshallingAttributeNameMaterial.c_str(),
-                        AttribFaceMaterials, PartFaceMaterialAttributeOverrides );
+                        AttribFaceMaterials, PartFaceMaterialOverrideNames, PartFaceMaterialAttributeOverrides );
 
                     // If material attribute was not found, check fallback compatibility attribute.
                     if ( !AttribFaceMaterials.exists )
                     {
-                        PartFaceMaterialAttributeOverrides.Empty();
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+                        FHoudiniEngineUtils::HapiGetAttributeDataAsStringTable(
                             AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
                             MarshallingAttributeNameMaterialFallback.c_str(),
-                            AttribFaceMaterials, PartFaceMaterialAttributeOverrides );
+                            AttribFaceMaterials, PartFaceMaterialOverrideNames, PartFaceMaterialAttributeOverrides );
                     }
 
                     // If material attribute and fallbacks were not found, check the material instance attribute.
                     if ( !AttribFaceMaterials.exists )
                     {
-                        PartFaceMaterialAttributeOverrides.Empty();
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+                        FHoudiniEngineUtils::HapiGetAttributeDataAsStringTable(
                             AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
                             MarshallingAttributeNameMaterialInstance.c_str(),
-                            AttribFaceMaterials, PartFaceMaterialAttributeOverrides);
+                            AttribFaceMaterials, PartFaceMaterialOverrideNames, PartFaceMaterialAttributeOverrides );
                     }
 
                     if ( AttribFaceMaterials.exists && AttribFaceMaterials.owner != HAPI_ATTROWNER_PRIM && AttribFaceMaterials.owner != HAPI_ATTROWNER_DETAIL )
@@ -6344,14 +7938,15 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         HOUDINI_LOG_WARNING( TEXT( "Static Mesh [%d %s], Geo [%d], Part [%d %s]: unreal_material must be a primitive or detail attribute, ignoring attribute." ),
                             ObjectInfo.nodeId, *ObjectName, GeoInfo.nodeId, PartIdx, *PartName);
                         AttribFaceMaterials.exists = false;
+                        PartFaceMaterialOverrideNames.Empty();
                         PartFaceMaterialAttributeOverrides.Empty();
                     }
 
                     // If the material name was assigned per detail we replicate it for each primitive.
                     if ( PartFaceMaterialAttributeOverrides.Num() > 0 && AttribFaceMaterials.owner == HAPI_ATTROWNER_DETAIL )
                     {
-                        FString SingleFaceMaterial = PartFaceMaterialAttributeOverrides[ 0 ];
-                        PartFaceMaterialAttributeOverrides.Init( SingleFaceMaterial, SplitGroupVertexList.Num() / 3 );
+                        int32 SingleFaceMaterialIdx = PartFaceMaterialAttributeOverrides[ 0 ];
+                        PartFaceMaterialAttributeOverrides.Init( SingleFaceMaterialIdx, SplitGroupVertexList.Num() / 3 );
                     }
                 }
 
@@ -6366,6 +7961,9 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     if ( !IsLOD || ( IsLOD && LodIndex == 0 ) )
                         StaticMesh->StaticMaterials.Empty();
 
+                    if ( HoudiniMatAttributesUnrealIndices.Num() != PartFaceMaterialOverrideNames.Num() )
+                        HoudiniMatAttributesUnrealIndices.Init( INDEX_NONE, PartFaceMaterialOverrideNames.Num() );
+
                     RawMesh.FaceMaterialIndices.SetNumZeroed( SplitGroupFaceCount );
                     for ( int32 FaceIdx = 0; FaceIdx < SplitGroupFaceIndices.Num(); ++FaceIdx )
                     {
@@ -6373,12 +7971,12 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         if ( !PartFaceMaterialAttributeOverrides.IsValidIndex( SplitFaceIndex ) )
                             continue;
 
-                        const FString & MaterialName = PartFaceMaterialAttributeOverrides[ SplitFaceIndex ];
-                        int32 const * FoundFaceMaterialIdx = MapHoudiniMatAttributesToUnrealIndex.Find( MaterialName );
+                        int32 MaterialNameIdx = PartFaceMaterialAttributeOverrides[ SplitFaceIndex ];
+                        const FString & MaterialName = PartFaceMaterialOverrideNames[ MaterialNameIdx ];
                         int32 CurrentFaceMaterialIdx = 0;
-                        if ( FoundFaceMaterialIdx )
+                        if ( HoudiniMatAttributesUnrealIndices[ MaterialNameIdx ] != INDEX_NONE )
                         {
-                            CurrentFaceMaterialIdx = *FoundFaceMaterialIdx;
+                            CurrentFaceMaterialIdx = HoudiniMatAttributesUnrealIndices[ MaterialNameIdx ];
                         }
                         else
                         {
@@ -6399,7 +7997,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
                                 // Add this material to the map
                                 CurrentFaceMaterialIdx = StaticMesh->StaticMaterials.Add( FStaticMaterial( MaterialInterface ) );
-                                MapHoudiniMatAttributesToUnrealIndex.Add( MaterialName, CurrentFaceMaterialIdx );
+                                HoudiniMatAttributesUnrealIndices[ MaterialNameIdx ] = CurrentFaceMaterialIdx;
                             }
                             else
                             {
@@ -6488,6 +8086,9 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                             // Get default Houdini material.
                             UMaterial * MaterialDefault = FHoudiniEngine::Get().GetHoudiniDefaultMaterial().Get();
 
+                            if ( HoudiniMatSlotsUnrealIndices.Num() != PartMaterialSlotIds.Num() )
+                                HoudiniMatSlotsUnrealIndices.Init( INDEX_NONE, PartMaterialSlotIds.Num() );
+
                             // Reset Rawmesh material face assignments.
                             RawMesh.FaceMaterialIndices.SetNumZeroed( SplitGroupFaceCount );
                             for ( int32 FaceIdx = 0; FaceIdx < SplitGroupFaceIndices.Num(); ++FaceIdx )
@@ -6496,6 +8097,14 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                                 if ( !PartFaceMaterialIds.IsValidIndex( SplitFaceIndex ) )
                                     continue;
 
+                                // Faces whose material slot has been resolved only need the index
+                                int32 MaterialSlot = PartFaceMaterialSlots[ SplitFaceIndex ];
+                                if ( HoudiniMatSlotsUnrealIndices[ MaterialSlot ] != INDEX_NONE )
+                                {
+                                    RawMesh.FaceMaterialIndices[ FaceIdx ] = HoudiniMatSlotsUnrealIndices[ MaterialSlot ];
+                                    continue;
+                                }
+
                                 // Get material id for this face.
                                 HAPI_NodeId MaterialId = PartFaceMaterialIds[ SplitFaceIndex ];
 
@@ -6505,6 +8114,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                                 {
                                     // This material has been mapped already, just assign the mat index
                                     RawMesh.FaceMaterialIndices[ FaceIdx ] = *FoundUnrealMatIndex;
+                                    HoudiniMatSlotsUnrealIndices[ MaterialSlot ] = *FoundUnrealMatIndex;
                                     continue;
                                 }
 
@@ -6528,6 +8138,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
                                 // Map the houdini ID to the unreal one
                                 MapHoudiniMatIdToUnrealIndex.Add( MaterialId, UnrealMatIndex );
+                                HoudiniMatSlotsUnrealIndices[ MaterialSlot ] = UnrealMatIndex;
 
                                 // Update the face index
                                 RawMesh.FaceMaterialIndices[ FaceIdx ] = UnrealMatIndex;
@@ -6566,7 +8177,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 if ( SrcModel->BuildSettings.bGenerateLightmapUVs )
                 {
                     // See if we need to disable lightmap generation because of bad UVs.
-                    if ( FHoudiniEngineUtils::ContainsInvalidLightmapFaces( RawMesh, StaticMesh->LightMapCoordinateIndex ) )
+                    if ( RawMeshStats.ContainsInvalidLightmapFaces() )
                     {
                         SrcModel->BuildSettings.bGenerateLightmapUVs = false;
 
@@ -6599,6 +8210,14 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
                 // Store the new raw mesh.
                 SrcModel->RawMeshBulkData->SaveRawMesh( RawMesh );
+                const int32 RawMeshTriangleCount = RawMesh.WedgeIndices.Num() / 3;
+
+                // The bulk data now owns the mesh, release our copy before the build allocates its own.
+                RawMesh.Empty();
+
+                // Key the derived data on the mesh content rather than on a new guid, so that identical meshes
+                // built by other components or in previous sessions are fetched from the DDC instead of rebuilt.
+                SrcModel->RawMeshBulkData->UseHashAsGuid( StaticMesh );
 
                 // Lambda for initializing a LOD level
                 auto InitLODLevel = [ & ]( const int32& LODLevelIndex )
@@ -6625,6 +8244,24 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     // For non LODed mesh, init the default number of LODs
                     for ( int32 ModelLODIndex = 0; ModelLODIndex < DefaultNumLODs; ++ModelLODIndex )
                         InitLODLevel( ModelLODIndex );
+
+                    // Meshes above the asset's triangle budget get a chain of reduced LODs, each halving the triangles
+                    // of the previous one until the budget is met. The reduction runs as part of the mesh build, and
+                    // its result is cached in the DDC along with the rest of the render data, keyed on the mesh content.
+                    const int32 AutoLODTriangleBudget = HoudiniCookParams.GeneratedAutoLODTriangleBudget;
+                    if ( AutoLODTriangleBudget > 0 )
+                    {
+                        float PercentTriangles = 1.0f;
+                        int32 AutoLODIndex = StaticMesh->SourceModels.Num();
+                        while ( AutoLODIndex < MAX_STATIC_MESH_LODS && AutoLODIndex <= HAPI_UNREAL_AUTO_LOD_MAX_COUNT
+                            && RawMeshTriangleCount * PercentTriangles > AutoLODTriangleBudget )
+                        {
+                            PercentTriangles *= 0.5f;
+                            InitLODLevel( AutoLODIndex );
+                            StaticMesh->SourceModels[ AutoLODIndex ].ReductionSettings.PercentTriangles = PercentTriangles;
+                            AutoLODIndex++;
+                        }
+                    }
                 }
                 else
                 {
@@ -6744,15 +8381,14 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 // Try to update the uproperties of the StaticMesh
                 UpdateUPropertyAttributesOnObject( StaticMesh, HoudiniGeoPartObject);
 
-                // Free any RHI resources.
-                StaticMesh->PreEditChange( nullptr );
-
-                // BUILD the Static Mesh
+                // BUILD the Static Mesh, on worker threads when asynchronous builds are enabled.
+                // Until then the mesh keeps its previous render data.
                 FHoudiniScopedGlobalSilence ScopedGlobalSilence;
                 TArray< FText > BuildErrors;
                 {
                     SCOPE_CYCLE_COUNTER( STAT_BuildStaticMesh );
-                    StaticMesh->Build( true, &BuildErrors );
+                    FHoudiniCookProfileStageScope BuildProfileStageScope( EHoudiniCookProfileStage::MeshBuild );
+                    StaticMeshBuildQueue.BuildStaticMesh( StaticMesh, &BuildErrors );
                 }
 
                 for ( int32 BuildErrorIdx = 0; BuildErrorIdx < BuildErrors.Num(); ++BuildErrorIdx )
@@ -6801,6 +8437,8 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 // If any simple collider was added to the aggregate, and this mesh is visible, add the colliders now
                 if ( bHasAggregateGeometryCollision )
                 {
+                    ConvexDecompositionTasks.Gather( AggregateCollisionGeo );
+
                     // Add the aggregate collision geo to the static mesh
                     if ( AddAggregateCollisionGeometryToStaticMesh( StaticMesh, HoudiniGeoPartObject, AggregateCollisionGeo ) )
                         bHasAggregateGeometryCollision = false;
@@ -6951,6 +8589,77 @@ FHoudiniEngineUtils::CountDegenerateTriangles( const FRawMesh & RawMesh )
     return DegenerateTriangleCount;
 }
 
+void
+FHoudiniEngineUtils::ComputeRawMeshStats( const FRawMesh & RawMesh, int32 LightmapSourceIdx, FHoudiniRawMeshStats & OutStats )
+{
+    OutStats = FHoudiniRawMeshStats();
+    OutStats.UVSetCount = FHoudiniEngineUtils::CountUVSets( RawMesh );
+
+    const TArray< uint32 > & Indices = RawMesh.WedgeIndices;
+    const TArray< FVector2D > * LightmapUVs = nullptr;
+    if ( LightmapSourceIdx >= 0 && LightmapSourceIdx < MAX_MESH_TEXTURE_COORDS )
+    {
+        LightmapUVs = &RawMesh.WedgeTexCoords[ LightmapSourceIdx ];
+
+        // This is invalid raw mesh; by design we consider that it contains invalid lightmap faces.
+        if ( LightmapUVs->Num() != Indices.Num() )
+        {
+            OutStats.bLightmapUVsMismatch = true;
+            LightmapUVs = nullptr;
+        }
+    }
+
+    // Faces are processed in chunks, each chunk counting on its own.
+    const int32 FaceCount = Indices.Num() / 3;
+    const int32 ChunkSize = HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS;
+    const int32 ChunkCount = FMath::DivideAndRoundUp( FaceCount, ChunkSize );
+
+    TArray< int32 > ChunkDegenerateCounts;
+    TArray< int32 > ChunkInvalidLightmapCounts;
+    ChunkDegenerateCounts.SetNumZeroed( ChunkCount );
+    ChunkInvalidLightmapCounts.SetNumZeroed( ChunkCount );
+
+    ParallelFor( ChunkCount, [ & ]( int32 ChunkIdx )
+    {
+        const int32 FaceStart = ChunkIdx * ChunkSize;
+        const int32 FaceEnd = FMath::Min( FaceStart + ChunkSize, FaceCount );
+
+        int32 DegenerateCount = 0;
+        int32 InvalidLightmapCount = 0;
+        for ( int32 FaceIdx = FaceStart; FaceIdx < FaceEnd; ++FaceIdx )
+        {
+            const int32 WedgeIdx = FaceIdx * 3;
+            const FVector & Vertex0 = RawMesh.VertexPositions[ Indices[ WedgeIdx + 0 ] ];
+            const FVector & Vertex1 = RawMesh.VertexPositions[ Indices[ WedgeIdx + 1 ] ];
+            const FVector & Vertex2 = RawMesh.VertexPositions[ Indices[ WedgeIdx + 2 ] ];
+
+            // Strict equality will not detect properly all the degenerated triangles, we need to use Equals here
+            if ( Vertex0.Equals( Vertex1, THRESH_POINTS_ARE_SAME ) || Vertex0.Equals( Vertex2, THRESH_POINTS_ARE_SAME )
+                || Vertex1.Equals( Vertex2, THRESH_POINTS_ARE_SAME ) )
+                DegenerateCount++;
+
+            if ( LightmapUVs )
+            {
+                const FVector2D & uv0 = ( *LightmapUVs )[ WedgeIdx + 0 ];
+                const FVector2D & uv1 = ( *LightmapUVs )[ WedgeIdx + 1 ];
+                const FVector2D & uv2 = ( *LightmapUVs )[ WedgeIdx + 2 ];
+
+                if ( uv0 == uv1 && uv1 == uv2 )
+                    InvalidLightmapCount++;
+            }
+        }
+
+        ChunkDegenerateCounts[ ChunkIdx ] = DegenerateCount;
+        ChunkInvalidLightmapCounts[ ChunkIdx ] = InvalidLightmapCount;
+    }, ChunkCount <= 1 );
+
+    for ( int32 ChunkIdx = 0; ChunkIdx < ChunkCount; ++ChunkIdx )
+    {
+        OutStats.DegenerateTriangleCount += ChunkDegenerateCounts[ ChunkIdx ];
+        OutStats.InvalidLightmapFaceCount += ChunkInvalidLightmapCounts[ ChunkIdx ];
+    }
+}
+
 #endif
 
 int32
@@ -6961,7 +8670,7 @@ FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
     int32 ValidWedgeCount = TransferRegularPointAttributesToVertices( VertexList, AttribInfo, Data, VertexData );
 
     if ( ValidWedgeCount > 0 )
-        Data = VertexData;
+        Data = MoveTemp( VertexData );
 
     return ValidWedgeCount;
 }
@@ -6973,74 +8682,132 @@ FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
     if ( !AttribInfo.exists || AttribInfo.tupleSize <= 0 )
         return 0;
 
-    int32 ValidWedgeCount = 0;
+    VertexData.SetNumUninitialized( VertexList.Num() * AttribInfo.tupleSize );
+    int32 ValidWedgeCount = TransferRegularPointAttributesToVertices(
+        VertexList, AttribInfo, Data, VertexData.GetData(), AttribInfo.tupleSize );
+
+    VertexData.SetNum( ValidWedgeCount * AttribInfo.tupleSize, false );
+
+    return ValidWedgeCount;
+}
+
+int32
+FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+    const TArray< int32 > & VertexList, const HAPI_AttributeInfo & AttribInfo,
+    const TArray< float > & Data, float * VertexData, int32 TupleSize )
+{
+    TArray< FHoudiniWedgeAttributeTransfer > Transfers;
+    Transfers.Emplace( AttribInfo, Data, VertexData, TupleSize );
 
-    // Future optimization - see if we can do direct vertex transfer.
-    int32 WedgeCount = VertexList.Num();
-    VertexData.SetNumZeroed( WedgeCount * AttribInfo.tupleSize );
+    return TransferRegularPointAttributesToVertices( VertexList, Transfers );
+}
 
-    int32 LastValidWedgeIdx = 0;
-    for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; ++WedgeIdx )
+int32
+FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+    const TArray< int32 > & VertexList, const TArray< FHoudiniWedgeAttributeTransfer > & Transfers )
+{
+    // Skip the attributes that have nothing to transfer.
+    TArray< const FHoudiniWedgeAttributeTransfer *, TInlineAllocator< 16 > > ValidTransfers;
+    for ( const FHoudiniWedgeAttributeTransfer & Transfer : Transfers )
     {
-        int32 VertexId = VertexList[ WedgeIdx ];
+        if ( !Transfer.AttribInfo->exists || Transfer.AttribInfo->tupleSize <= 0 || Transfer.TupleSize <= 0 || !Transfer.VertexData )
+            continue;
 
-        if ( VertexId == -1 )
+        switch ( Transfer.AttribInfo->owner )
         {
-            // This is an index/wedge we are skipping due to split.
-            continue;
+            case HAPI_ATTROWNER_POINT:
+            case HAPI_ATTROWNER_PRIM:
+            case HAPI_ATTROWNER_DETAIL:
+            case HAPI_ATTROWNER_VERTEX:
+            {
+                ValidTransfers.Add( &Transfer );
+                break;
+            }
+
+            default:
+            {
+                check( false );
+                break;
+            }
         }
+    }
+
+    if ( ValidTransfers.Num() <= 0 )
+        return 0;
+
+    // Resolve the valid wedges a single time, they are shared by all the attributes.
+    TArray< int32 > ValidWedges;
+    ValidWedges.Reserve( VertexList.Num() );
+    for ( int32 WedgeIdx = 0; WedgeIdx < VertexList.Num(); ++WedgeIdx )
+    {
+        // Indices/wedges we are skipping due to split are marked with -1.
+        if ( VertexList[ WedgeIdx ] != -1 )
+            ValidWedges.Add( WedgeIdx );
+    }
 
-        // Increment wedge count, since this is a valid wedge.
-        ValidWedgeCount++;
+    const int32 ValidWedgeCount = ValidWedges.Num();
+    const int32 ChunkSize = HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS;
+    const int32 ChunkCount = FMath::DivideAndRoundUp( ValidWedgeCount, ChunkSize );
 
-        int32 PrimIdx = WedgeIdx / 3;
-        int32 SaveIdx = 0;
-        float Value = 0.0f;
+    // Each chunk of wedges gathers all the attributes while its indices are still in cache,
+    // every attribute is written to its own contiguous destination buffer.
+    ParallelFor( ChunkCount, [&]( int32 ChunkIdx )
+    {
+        const int32 FirstIdx = ChunkIdx * ChunkSize;
+        const int32 LastIdx = FMath::Min( FirstIdx + ChunkSize, ValidWedgeCount );
 
-        for ( int32 AttributeIndexIdx = 0; AttributeIndexIdx < AttribInfo.tupleSize; ++AttributeIndexIdx )
+        for ( const FHoudiniWedgeAttributeTransfer * Transfer : ValidTransfers )
         {
-            switch ( AttribInfo.owner )
+            const HAPI_AttributeInfo & AttribInfo = *Transfer->AttribInfo;
+            const TArray< float > & Data = *Transfer->Data;
+            const int32 TupleSize = Transfer->TupleSize;
+
+            // Values missing from the attribute tuple are zeroed.
+            const int32 TransferredTupleSize = FMath::Min( TupleSize, AttribInfo.tupleSize );
+
+            for ( int32 ValidWedgeIdx = FirstIdx; ValidWedgeIdx < LastIdx; ++ValidWedgeIdx )
             {
-                case HAPI_ATTROWNER_POINT:
-                {
-                    Value = Data[ VertexId * AttribInfo.tupleSize + AttributeIndexIdx ];
-                    break;
-                }
+                const int32 WedgeIdx = ValidWedges[ ValidWedgeIdx ];
 
-                case HAPI_ATTROWNER_PRIM:
+                int32 SourceIdx = 0;
+                switch ( AttribInfo.owner )
                 {
-                    Value = Data[ PrimIdx * AttribInfo.tupleSize + AttributeIndexIdx ];
-                    break;
-                }
+                    case HAPI_ATTROWNER_POINT:
+                    {
+                        SourceIdx = VertexList[ WedgeIdx ];
+                        break;
+                    }
 
-                case HAPI_ATTROWNER_DETAIL:
-                {
-                    Value = Data[ AttributeIndexIdx ];
-                    break;
-                }
+                    case HAPI_ATTROWNER_PRIM:
+                    {
+                        SourceIdx = WedgeIdx / 3;
+                        break;
+                    }
 
-                case HAPI_ATTROWNER_VERTEX:
-                {
-                    Value = Data[ WedgeIdx * AttribInfo.tupleSize + AttributeIndexIdx ];
-                    break;
-                }
+                    case HAPI_ATTROWNER_VERTEX:
+                    {
+                        SourceIdx = WedgeIdx;
+                        break;
+                    }
 
-                default:
-                {
-                    check( false );
-                    continue;
+                    default:
+                    {
+                        // Detail attributes only have a single tuple.
+                        break;
+                    }
                 }
-            }
 
-            SaveIdx = LastValidWedgeIdx * AttribInfo.tupleSize + AttributeIndexIdx;
-            VertexData[ SaveIdx ] = Value;
-        }
+                const int32 SourceValueIdx = SourceIdx * AttribInfo.tupleSize;
+                float * WedgeData = Transfer->VertexData + ValidWedgeIdx * TupleSize;
 
-        // We are re-indexing wedges.
-        LastValidWedgeIdx++;
-    }
+                for ( int32 AttributeIndexIdx = 0; AttributeIndexIdx < TransferredTupleSize; ++AttributeIndexIdx )
+                    WedgeData[ AttributeIndexIdx ] = Data[ SourceValueIdx + AttributeIndexIdx ];
 
-    VertexData.SetNumZeroed( ValidWedgeCount * AttribInfo.tupleSize );
+                for ( int32 AttributeIndexIdx = TransferredTupleSize; AttributeIndexIdx < TupleSize; ++AttributeIndexIdx )
+                    WedgeData[ AttributeIndexIdx ] = 0.0f;
+            }
+        }
+    }, ChunkCount <= 1 );
 
     return ValidWedgeCount;
 }
@@ -7070,10 +8837,11 @@ FHoudiniEngineUtils::ExtractRawName( const FString & Name )
 #if WITH_EDITOR
 void
 FHoudiniEngineUtils::CreateFaceMaterialArray(
-    const TArray< UMaterialInterface * >& Materials, const TArray< int32 > & FaceMaterialIndices, TArray< char * > & OutStaticMeshFaceMaterials )
+    const TArray< UMaterialInterface * >& Materials, const TArray< int32 > & FaceMaterialIndices,
+    TArray< char * > & OutUniqueMaterialNames, TArray< const char * > & OutStaticMeshFaceMaterials )
 {
     // We need to create list of unique materials.
-    TArray< char * > UniqueMaterialList;
+    TArray< char * > & UniqueMaterialList = OutUniqueMaterialNames;
     UMaterialInterface * MaterialInterface;
     char * UniqueName = nullptr;
 
@@ -7104,26 +8872,24 @@ FHoudiniEngineUtils::CreateFaceMaterialArray(
         UniqueMaterialList.Add( UniqueName );
     }
 
+    // Faces only point into the list of unique names.
+    OutStaticMeshFaceMaterials.SetNumUninitialized( FaceMaterialIndices.Num() );
     for ( int32 FaceIdx = 0; FaceIdx < FaceMaterialIndices.Num(); ++FaceIdx )
     {
         int32 FaceMaterialIdx = FaceMaterialIndices[ FaceIdx ];
         check( UniqueMaterialList.IsValidIndex(FaceMaterialIdx) );
 
-        OutStaticMeshFaceMaterials.Add( UniqueMaterialList[ FaceMaterialIdx ] );
+        OutStaticMeshFaceMaterials[ FaceIdx ] = UniqueMaterialList[ FaceMaterialIdx ];
     }
 }
 
 void
-FHoudiniEngineUtils::DeleteFaceMaterialArray( TArray< char * > & OutStaticMeshFaceMaterials )
+FHoudiniEngineUtils::DeleteFaceMaterialArray( TArray< char * > & OutUniqueMaterialNames )
 {
-    TSet< char * > UniqueMaterials( OutStaticMeshFaceMaterials );
-    for ( TSet< char * >::TIterator Iter = UniqueMaterials.CreateIterator(); Iter; ++Iter )
-    {
-        char* MaterialName = *Iter;
+    for ( char * MaterialName : OutUniqueMaterialNames )
         FMemory::Free( MaterialName );
-    }
 
-    OutStaticMeshFaceMaterials.Empty();
+    OutUniqueMaterialNames.Empty();
 }
 
 #endif // WITH_EDITOR
@@ -7223,6 +8989,19 @@ FHoudiniEngineUtils::CreatePositionsString( const TArray< FVector > & Positions,
 void
 FHoudiniEngineUtils::ConvertScaleAndFlipVectorData( const TArray< float > & DataRaw, TArray< FVector > & DataOut )
 {
+    // Copy the raw values once and convert them in place.
+    int32 Count = DataRaw.Num() / 3;
+    int32 FirstIdx = DataOut.AddUninitialized( Count );
+    FMemory::Memcpy( DataOut.GetData() + FirstIdx, DataRaw.GetData(), Count * sizeof( FVector ) );
+
+    ConvertScaleAndFlipVectorData( DataOut.GetData() + FirstIdx, Count );
+}
+
+void
+FHoudiniEngineUtils::ConvertScaleAndFlipVectorData( FVector * Data, int32 Count )
+{
+    static_assert( sizeof( FVector ) == 3 * sizeof( float ), "FVector is expected to be tightly packed." );
+
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
 
     float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
@@ -7234,28 +9013,165 @@ FHoudiniEngineUtils::ConvertScaleAndFlipVectorData( const TArray< float > & Data
         ImportAxis = HoudiniRuntimeSettings->ImportAxis;
     }
 
-    for ( int32 Idx = 0; Idx < DataRaw.Num(); Idx += 3 )
+    if ( ImportAxis != HRSAI_Unreal && ImportAxis != HRSAI_Houdini )
     {
-        FVector Point( DataRaw[ Idx + 0 ], DataRaw[ Idx + 1 ], DataRaw[ Idx + 2 ] );
+        // Not valid enum value.
+        check( 0 );
+        return;
+    }
 
-        Point *= GeneratedGeometryScaleFactor;
+    FHoudiniEngineUtils::ScaleAndSwapVectors( Data, Count, GeneratedGeometryScaleFactor, ImportAxis == HRSAI_Unreal );
+}
 
-        if ( ImportAxis == HRSAI_Unreal )
+/** Scale and optionally swap Y and Z of a contiguous range of vectors, four vectors at a time. **/
+static void
+ScaleAndSwapVectorRange( FVector * RangeData, int32 RangeCount, const VectorRegister & Scale, bool bSwapYZ )
+{
+    float * Values = (float *) RangeData;
+    int32 Idx = 0;
+
+    // Four vectors fill three registers: ( x0 y0 z0 x1 ) ( y1 z1 x2 y2 ) ( z2 x3 y3 z3 ).
+    for ( ; Idx + 4 <= RangeCount; Idx += 4, Values += 12 )
+    {
+        VectorRegister A = VectorMultiply( VectorLoad( Values + 0 ), Scale );
+        VectorRegister B = VectorMultiply( VectorLoad( Values + 4 ), Scale );
+        VectorRegister C = VectorMultiply( VectorLoad( Values + 8 ), Scale );
+
+        if ( bSwapYZ )
         {
-            Swap(Point.Z, Point.Y);
+            // Swapped: ( x0 z0 y0 x1 ) ( z1 y1 x2 z2 ) ( y2 x3 z3 y3 ).
+            VectorRegister X2Z2 = VectorShuffle( B, C, 2, 2, 0, 0 );
+            VectorRegister Y2X3 = VectorShuffle( B, C, 3, 3, 1, 1 );
+
+            A = VectorSwizzle( A, 0, 2, 1, 3 );
+            B = VectorShuffle( B, X2Z2, 1, 0, 0, 2 );
+            C = VectorShuffle( Y2X3, C, 0, 2, 3, 2 );
         }
-        else if ( ImportAxis == HRSAI_Houdini )
+
+        VectorStore( A, Values + 0 );
+        VectorStore( B, Values + 4 );
+        VectorStore( C, Values + 8 );
+    }
+
+    // Remaining vectors.
+    for ( ; Idx < RangeCount; ++Idx, Values += 3 )
+    {
+        VectorRegister Vector = VectorMultiply( VectorLoadFloat3( Values ), Scale );
+        if ( bSwapYZ )
+            Vector = VectorSwizzle( Vector, 0, 2, 1, 3 );
+
+        VectorStoreFloat3( Vector, Values );
+    }
+}
+
+/** Run the given functor over whole-triangle ranges of wedges, splitting large arrays over worker threads. **/
+template < typename FWedgeRangeFunc >
+static void
+ForEachWedgeChunk( int32 WedgeCount, FWedgeRangeFunc Func )
+{
+    // Chunks hold whole triangles so winding can be reversed independently in each of them.
+    const int32 ChunkSize = ( HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS / 3 ) * 3;
+    const int32 ChunkCount = FMath::DivideAndRoundUp( WedgeCount, ChunkSize );
+    ParallelFor( ChunkCount, [ & ]( int32 ChunkIdx )
+    {
+        const int32 FirstIdx = ChunkIdx * ChunkSize;
+        Func( FirstIdx, FMath::Min( ChunkSize, WedgeCount - FirstIdx ) );
+    }, ChunkCount < 2 );
+}
+
+/** Copy a range of wedge values, swapping the second and third wedge of each triangle if requested. **/
+template < typename TSource, typename TDest, typename FConvertFunc >
+static void
+CopyWedgeRange( const TSource * Source, TDest * Dest, int32 RangeCount, bool bReverseWinding, FConvertFunc Convert )
+{
+    int32 Idx = 0;
+    if ( bReverseWinding )
+    {
+        // Read the whole triangle before writing it, so source and destination may alias.
+        for ( ; Idx + 3 <= RangeCount; Idx += 3 )
         {
-            // No action required.
+            const TDest Wedge0 = Convert( Source[ Idx + 0 ] );
+            const TDest Wedge1 = Convert( Source[ Idx + 1 ] );
+            const TDest Wedge2 = Convert( Source[ Idx + 2 ] );
+
+            Dest[ Idx + 0 ] = Wedge0;
+            Dest[ Idx + 1 ] = Wedge2;
+            Dest[ Idx + 2 ] = Wedge1;
         }
-        else
+    }
+
+    // Remaining wedges of an incomplete triangle are copied as is.
+    for ( ; Idx < RangeCount; ++Idx )
+        Dest[ Idx ] = Convert( Source[ Idx ] );
+}
+
+void
+FHoudiniEngineUtils::ScaleAndSwapVectors( FVector * Data, int32 Count, float ScaleFactor, bool bSwapYZ )
+{
+    static_assert( sizeof( FVector ) == 3 * sizeof( float ), "FVector is expected to be tightly packed." );
+
+    if ( Count <= 0 || ( ScaleFactor == 1.0f && !bSwapYZ ) )
+        return;
+
+    const VectorRegister Scale = VectorSetFloat1( ScaleFactor );
+
+    const int32 ChunkSize = HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS;
+    const int32 ChunkCount = FMath::DivideAndRoundUp( Count, ChunkSize );
+    ParallelFor( ChunkCount, [ & ]( int32 ChunkIdx )
+    {
+        const int32 FirstIdx = ChunkIdx * ChunkSize;
+        ScaleAndSwapVectorRange( Data + FirstIdx, FMath::Min( ChunkSize, Count - FirstIdx ), Scale, bSwapYZ );
+    }, ChunkCount < 2 );
+}
+
+void
+FHoudiniEngineUtils::ConvertWedgeVectors(
+    const FVector * Source, FVector * Dest, int32 WedgeCount, float ScaleFactor, bool bSwapYZ, bool bReverseWinding )
+{
+    if ( WedgeCount <= 0 )
+        return;
+
+    const bool bScaleOrSwap = ( ScaleFactor != 1.0f || bSwapYZ );
+    const VectorRegister Scale = VectorSetFloat1( ScaleFactor );
+
+    ForEachWedgeChunk( WedgeCount, [ & ]( int32 FirstIdx, int32 RangeCount )
+    {
+        if ( Source != Dest || bReverseWinding )
         {
-            // Not valid enum value.
-            check( 0 );
+            CopyWedgeRange( Source + FirstIdx, Dest + FirstIdx, RangeCount, bReverseWinding,
+                []( const FVector & Vector ) { return Vector; } );
         }
 
-        DataOut.Add( Point );
-    }
+        // Converted while the chunk we just wrote is still in cache.
+        if ( bScaleOrSwap )
+            ScaleAndSwapVectorRange( Dest + FirstIdx, RangeCount, Scale, bSwapYZ );
+    } );
+}
+
+void
+FHoudiniEngineUtils::ConvertWedgeUVs( const FVector2D * Source, FVector * Dest, int32 WedgeCount, bool bReverseWinding )
+{
+    if ( WedgeCount <= 0 )
+        return;
+
+    ForEachWedgeChunk( WedgeCount, [ & ]( int32 FirstIdx, int32 RangeCount )
+    {
+        CopyWedgeRange( Source + FirstIdx, Dest + FirstIdx, RangeCount, bReverseWinding,
+            []( const FVector2D & UV ) { return FVector( UV.X, 1.0f - UV.Y, 0.0f ); } );
+    } );
+}
+
+void
+FHoudiniEngineUtils::ConvertWedgeColors( const FColor * Source, FLinearColor * Dest, int32 WedgeCount, bool bReverseWinding )
+{
+    if ( WedgeCount <= 0 )
+        return;
+
+    ForEachWedgeChunk( WedgeCount, [ & ]( int32 FirstIdx, int32 RangeCount )
+    {
+        CopyWedgeRange( Source + FirstIdx, Dest + FirstIdx, RangeCount, bReverseWinding,
+            []( const FColor & Color ) { return Color.ReinterpretAsLinear(); } );
+    } );
 }
 
 FString
@@ -7563,14 +9479,14 @@ FHoudiniEngineUtils::HapiGetVertexListForGroup(
 
     AllFaceList.Empty();
 
-    TArray< int32 > PartGroupMembership;
+    FHoudiniGroupMembership PartGroupMembership;
     FHoudiniEngineUtils::HapiGetGroupMembership(
         AssetId, ObjectId, GeoId, PartId, HAPI_GROUPTYPE_PRIM, GroupName, PartGroupMembership );
 
     // Go through all primitives.
     for ( int32 FaceIdx = 0; FaceIdx < PartGroupMembership.Num(); ++FaceIdx )
     {
-        if ( PartGroupMembership[ FaceIdx ] > 0 )
+        if ( PartGroupMembership.IsMember( FaceIdx ) )
         {
             // Add face.
             AllFaceList.Add( FaceIdx );
@@ -7602,6 +9518,82 @@ FHoudiniEngineUtils::HapiGetVertexListForGroup(
     return ProcessedWedges;
 }
 
+void
+FHoudiniEngineUtils::PartitionVertexListByGroups(
+    const TArray< int32 > & FullVertexList, int32 FaceCount, const TArray< FHoudiniGroupMembership > & GroupMemberships,
+    TArray< TArray< int32 > > & GroupVertexLists, TArray< TArray< int32 > > & GroupFaceLists, TArray< int32 > & GroupWedgeCounts,
+    TArray< int32 > & RemainingVertexList, TArray< int32 > & RemainingFaceList, int32 & RemainingWedgeCount )
+{
+    const int32 GroupCount = GroupMemberships.Num();
+
+    GroupVertexLists.SetNum( GroupCount );
+    GroupFaceLists.SetNum( GroupCount );
+    GroupWedgeCounts.Init( 0, GroupCount );
+    for ( int32 GroupIdx = 0; GroupIdx < GroupCount; ++GroupIdx )
+    {
+        GroupVertexLists[ GroupIdx ].Init( -1, FullVertexList.Num() );
+        GroupFaceLists[ GroupIdx ].Reset();
+    }
+
+    RemainingVertexList.Init( -1, FullVertexList.Num() );
+    RemainingFaceList.Reset();
+    RemainingWedgeCount = 0;
+
+    // Faces which are in at least one of the groups, the others are the remaining geometry.
+    FHoudiniGroupMembership GroupedFaces;
+    GroupedFaces.Init( FaceCount );
+
+    // Each group only visits its own members, skipping the words with no member.
+    for ( int32 GroupIdx = 0; GroupIdx < GroupCount; ++GroupIdx )
+    {
+        const FHoudiniGroupMembership & GroupMembership = GroupMemberships[ GroupIdx ];
+        GroupedFaces.Combine( GroupMembership );
+
+        TArray< int32 > & GroupVertexList = GroupVertexLists[ GroupIdx ];
+        TArray< int32 > & GroupFaceList = GroupFaceLists[ GroupIdx ];
+        GroupFaceList.Reserve( GroupMembership.CountMembers() );
+
+        GroupMembership.ForEachElement( true, [ & ]( int32 FaceIdx )
+        {
+            if ( FaceIdx >= FaceCount )
+                return;
+
+            GroupFaceList.Add( FaceIdx );
+            GroupWedgeCounts[ GroupIdx ] += 3;
+
+            if ( FullVertexList.IsValidIndex( FaceIdx * 3 + 2 ) )
+            {
+                GroupVertexList[ FaceIdx * 3 + 0 ] = FullVertexList[ FaceIdx * 3 + 0 ];
+                GroupVertexList[ FaceIdx * 3 + 1 ] = FullVertexList[ FaceIdx * 3 + 1 ];
+                GroupVertexList[ FaceIdx * 3 + 2 ] = FullVertexList[ FaceIdx * 3 + 2 ];
+            }
+        } );
+    }
+
+    GroupedFaces.ForEachElement( false, [ & ]( int32 FaceIdx )
+    {
+        if ( FaceIdx >= FaceCount )
+            return;
+
+        RemainingFaceList.Add( FaceIdx );
+
+        if ( FullVertexList.IsValidIndex( FaceIdx * 3 + 2 ) )
+        {
+            RemainingVertexList[ FaceIdx * 3 + 0 ] = FullVertexList[ FaceIdx * 3 + 0 ];
+            RemainingVertexList[ FaceIdx * 3 + 1 ] = FullVertexList[ FaceIdx * 3 + 1 ];
+            RemainingVertexList[ FaceIdx * 3 + 2 ] = FullVertexList[ FaceIdx * 3 + 2 ];
+            RemainingWedgeCount += 3;
+        }
+    } );
+
+    // Wedges past the faces are not part of any group either.
+    for ( int32 WedgeIdx = FaceCount * 3; WedgeIdx < FullVertexList.Num(); ++WedgeIdx )
+    {
+        RemainingVertexList[ WedgeIdx ] = FullVertexList[ WedgeIdx ];
+        RemainingWedgeCount++;
+    }
+}
+
 
 #if WITH_EDITOR
 
@@ -7819,6 +9811,54 @@ FHoudiniEngineUtils::LocateClipboardActor( const AActor* IgnoreActor, const FStr
     return HoudiniAssetActor;
 }
 
+HAPI_Result
+FHoudiniEngineUtils::LoadAssetLibraryFromFile( const FString & AssetFileName, HAPI_AssetLibraryId & OutAssetLibraryId )
+{
+    FString FullAssetFileName = FPaths::ConvertRelativePathToFull( AssetFileName );
+    FPaths::NormalizeFilename( FullAssetFileName );
+
+    // Reuse the library if it has already been loaded in this session, by a preload or a previous instantiation.
+    if ( FHoudiniEngine::Get().FindLoadedAssetLibrary( FullAssetFileName, OutAssetLibraryId ) )
+        return HAPI_RESULT_SUCCESS;
+
+    std::string AssetFileNamePlain;
+    FHoudiniEngineUtils::ConvertUnrealString( AssetFileName, AssetFileNamePlain );
+
+    HAPI_Result Result = FHoudiniApi::LoadAssetLibraryFromFile(
+        FHoudiniEngine::Get().GetSession(), AssetFileNamePlain.c_str(), true, &OutAssetLibraryId );
+
+    if ( Result == HAPI_RESULT_SUCCESS )
+        FHoudiniEngine::Get().AddLoadedAssetLibrary( FullAssetFileName, OutAssetLibraryId );
+
+    return Result;
+}
+
+HAPI_Result
+FHoudiniEngineUtils::LoadAssetLibraryFromMemory( const UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & OutAssetLibraryId )
+{
+    // Identical buffers are only uploaded once per session, whichever asset they belong to.
+    const FString & AssetBytesHash = HoudiniAsset->GetAssetBytesHash();
+    if ( FHoudiniEngine::Get().FindLoadedAssetLibraryBuffer( AssetBytesHash, OutAssetLibraryId ) )
+        return HAPI_RESULT_SUCCESS;
+
+    // The raw OTL data is only loaded here, when a library actually needs to be uploaded.
+    const uint8 * AssetBytes = HoudiniAsset->LockAssetBytes();
+    if ( !AssetBytes )
+        return HAPI_RESULT_FAILURE;
+
+    HAPI_Result Result = FHoudiniApi::LoadAssetLibraryFromMemory(
+        FHoudiniEngine::Get().GetSession(),
+        reinterpret_cast<const char *>( AssetBytes ),
+        HoudiniAsset->GetAssetBytesCount(), true, &OutAssetLibraryId );
+
+    HoudiniAsset->UnlockAssetBytes();
+
+    if ( Result == HAPI_RESULT_SUCCESS )
+        FHoudiniEngine::Get().AddLoadedAssetLibraryBuffer( AssetBytesHash, OutAssetLibraryId );
+
+    return Result;
+}
+
 bool
 FHoudiniEngineUtils::GetAssetNames(
     UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & OutAssetLibraryId,
@@ -7849,11 +9889,7 @@ FHoudiniEngineUtils::GetAssetNames(
             }
 
             // File does exist, we can load asset from file.
-            std::string AssetFileNamePlain;
-            FHoudiniEngineUtils::ConvertUnrealString( AssetFileName, AssetFileNamePlain );
-
-            Result = FHoudiniApi::LoadAssetLibraryFromFile(
-                FHoudiniEngine::Get().GetSession(), AssetFileNamePlain.c_str(), true, &AssetLibraryId );
+            Result = FHoudiniEngineUtils::LoadAssetLibraryFromFile( AssetFileName, AssetLibraryId );
         }
 
         // Try to load the asset from memory if loading from file failed
@@ -7872,10 +9908,7 @@ FHoudiniEngineUtils::GetAssetNames(
                 HOUDINI_LOG_WARNING( TEXT( "Asset %s, loading from Memory: source asset file not found."), *AssetFileName );
 
                 // Otherwise we will try to load from buffer we've cached.
-                Result = FHoudiniApi::LoadAssetLibraryFromMemory(
-                    FHoudiniEngine::Get().GetSession(),
-                    reinterpret_cast<const char *>( HoudiniAsset->GetAssetBytes() ),
-                    HoudiniAsset->GetAssetBytesCount(), true, &AssetLibraryId );
+                Result = FHoudiniEngineUtils::LoadAssetLibraryFromMemory( HoudiniAsset, AssetLibraryId );
             }
         }
 
@@ -7986,6 +10019,45 @@ FHoudiniEngineUtils::AddMeshSocketToList(
         ImportAxis = HoudiniRuntimeSettings->ImportAxis;
     }
 
+    // Sockets already in the list, by location cell, so duplicates are found without scanning the whole list
+    auto GetSocketCell = []( const FVector & Location )
+    {
+        return FIntVector(
+            FMath::FloorToInt( Location.X / HAPI_UNREAL_MESH_SOCKET_CELL_SIZE ),
+            FMath::FloorToInt( Location.Y / HAPI_UNREAL_MESH_SOCKET_CELL_SIZE ),
+            FMath::FloorToInt( Location.Z / HAPI_UNREAL_MESH_SOCKET_CELL_SIZE ) );
+    };
+
+    TMultiMap< FIntVector, int32 > SocketCells;
+    for ( int32 ExistingIdx = 0; ExistingIdx < AllSockets.Num(); ++ExistingIdx )
+        SocketCells.Add( GetSocketCell( AllSockets[ ExistingIdx ].GetLocation() ), ExistingIdx );
+
+    // Return the index of the first socket with an equal transform, or INDEX_NONE
+    TArray< int32 > CellSocketIndices;
+    auto FindEqualSocket = [&]( const FTransform & SocketTransform )
+    {
+        // Equal transforms can only be in the cells overlapping the comparison tolerance
+        const FVector Tolerance( KINDA_SMALL_NUMBER );
+        const FIntVector MinCell = GetSocketCell( SocketTransform.GetLocation() - Tolerance );
+        const FIntVector MaxCell = GetSocketCell( SocketTransform.GetLocation() + Tolerance );
+
+        int32 FoundIdx = INDEX_NONE;
+        for ( int32 X = MinCell.X; X <= MaxCell.X; ++X )
+        for ( int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y )
+        for ( int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z )
+        {
+            CellSocketIndices.Reset();
+            SocketCells.MultiFind( FIntVector( X, Y, Z ), CellSocketIndices );
+            for ( int32 CellSocketIdx : CellSocketIndices )
+            {
+                if ( ( FoundIdx == INDEX_NONE || CellSocketIdx < FoundIdx ) && AllSockets[ CellSocketIdx ].Equals( SocketTransform ) )
+                    FoundIdx = CellSocketIdx;
+            }
+        }
+
+        return FoundIdx;
+    };
+
     // Lambda function for creating the socket and adding it to the array
     // Shared between the by Attribute / by Group methods
     int32 FoundSocketCount = 0;
@@ -8087,8 +10159,7 @@ FHoudiniEngineUtils::AddMeshSocketToList(
         currentSocketTransform.SetScale3D( currentScale );
 
         // We want to make sure we're not adding the same socket multiple times
-        int32 FoundIx = AllSockets.IndexOfByPredicate(
-            [ currentSocketTransform ]( const FTransform InTransform ){ return InTransform.Equals( currentSocketTransform); } );
+        int32 FoundIx = FindEqualSocket( currentSocketTransform );
 
         if ( FoundIx >= 0 )
         {
@@ -8097,6 +10168,7 @@ FHoudiniEngineUtils::AddMeshSocketToList(
                 return false;
         }
 
+        SocketCells.Add( GetSocketCell( currentSocketTransform.GetLocation() ), AllSockets.Num() );
         AllSockets.Add( currentSocketTransform );
         AllSocketsNames.Add( currentName );
         AllSocketsActors.Add( currentActors );
@@ -8309,20 +10381,13 @@ FHoudiniEngineUtils::AddMeshSocketToList(
             && !GroupName.StartsWith ( TEXT ( HAPI_UNREAL_GROUP_MESH_SOCKETS_OLD ) , ESearchCase::IgnoreCase ) )
             continue;
 
-        TArray< int32 > PointGroupMembership;
+        FHoudiniGroupMembership PointGroupMembership;
         FHoudiniEngineUtils::HapiGetGroupMembership(
             AssetId, ObjectId, GeoId, PartId, 
             HAPI_GROUPTYPE_POINT, GroupName, PointGroupMembership );
 
-        // Go through all primitives.
-        for ( int32 PointIdx = 0; PointIdx < PointGroupMembership.Num(); ++PointIdx )
-        {
-            if ( PointGroupMembership[ PointIdx ] == 0 )
-                continue;
-
-            // Add the corresponding socket to the array
-            AddSocketToArray( PointIdx );
-        }
+        // Add the socket of each point of the group to the array.
+        PointGroupMembership.ForEachElement( true, [ & ]( int32 PointIdx ) { AddSocketToArray( PointIdx ); } );
     }
 
     return FoundSocketCount;
@@ -8348,6 +10413,8 @@ FHoudiniEngineUtils::AddMeshSocketsToStaticMesh(
     if ( !HoudiniGeoPartObject.bHasSocketBeenAdded )
         StaticMesh->Sockets.Empty();
 
+    StaticMesh->Sockets.Reserve( StaticMesh->Sockets.Num() + AllSockets.Num() );
+
     for ( int32 nSocket = 0; nSocket < AllSockets.Num(); nSocket++ )
     {
         // Create a new Socket
@@ -8431,8 +10498,35 @@ FHoudiniEngineUtils::AddAggregateCollisionGeometryToStaticMesh(
     return true;
 }
 
+void
+FHoudiniEngineUtils::BuildActorNameIndex( UWorld* World, TMultiMap< FString, TWeakObjectPtr< AActor > > & OutActorsByName )
+{
+    OutActorsByName.Empty();
+
+#if WITH_EDITOR
+    if ( !World || World->IsPendingKill() )
+        return;
+
+    for ( TActorIterator<AActor> ActorItr( World ); ActorItr; ++ActorItr )
+    {
+        AActor *Actor = *ActorItr;
+        if ( !Actor || Actor->IsPendingKillOrUnreachable() )
+            continue;
+
+        const FString ActorName = Actor->GetName();
+        const FString ActorLabel = Actor->GetActorLabel();
+
+        OutActorsByName.Add( ActorName, Actor );
+        if ( ActorLabel != ActorName )
+            OutActorsByName.Add( ActorLabel, Actor );
+    }
+#endif
+}
+
 bool
-FHoudiniEngineUtils::AddActorsToMeshSocket( UStaticMeshSocket* Socket, UStaticMeshComponent* StaticMeshComponent )
+FHoudiniEngineUtils::AddActorsToMeshSocket(
+    UStaticMeshSocket* Socket, UStaticMeshComponent* StaticMeshComponent,
+    const TMultiMap< FString, TWeakObjectPtr< AActor > > * ActorsByName )
 {
     if ( !Socket || Socket->IsPendingKill()
         || !StaticMeshComponent || StaticMeshComponent->IsPendingKill() )
@@ -8469,21 +10563,27 @@ FHoudiniEngineUtils::AddActorsToMeshSocket( UStaticMeshSocket* Socket, UStaticMe
     // And try to find the corresponding HoudiniAssetActor in the editor world
     // to avoid finding "deleted" assets with the same name
     //UWorld* editorWorld = GEditor->GetEditorWorldContext().World();
-    UWorld* editorWorld = StaticMeshComponent->GetOwner() ? StaticMeshComponent->GetOwner()->GetWorld() : nullptr;
-    if ( !editorWorld || editorWorld->IsPendingKill() )
-        return false;
+    TMultiMap< FString, TWeakObjectPtr< AActor > > WorldActorsByName;
+    if ( !ActorsByName )
+    {
+        UWorld* editorWorld = StaticMeshComponent->GetOwner() ? StaticMeshComponent->GetOwner()->GetWorld() : nullptr;
+        if ( !editorWorld || editorWorld->IsPendingKill() )
+            return false;
+
+        BuildActorNameIndex( editorWorld, WorldActorsByName );
+        ActorsByName = &WorldActorsByName;
+    }
 
-    for ( TActorIterator<AActor> ActorItr( editorWorld ); ActorItr; ++ActorItr )
+    TArray< TWeakObjectPtr< AActor > > FoundActors;
+    for ( int32 StringIdx = 0; StringIdx < ActorStringArray.Num(); StringIdx++ )
     {
-        // Same as with the Object Iterator, access the subclass instance with the * or -> operators.
-        AActor *Actor = *ActorItr;
-        if ( !Actor || Actor->IsPendingKillOrUnreachable() )
-            continue;
+        FoundActors.Reset();
+        ActorsByName->MultiFind( ActorStringArray[ StringIdx ], FoundActors );
 
-        for ( int32 StringIdx = 0; StringIdx < ActorStringArray.Num(); StringIdx++ )
+        for ( const TWeakObjectPtr< AActor > & FoundActor : FoundActors )
         {
-            if ( Actor->GetName() != ActorStringArray[ StringIdx ]
-                 && Actor->GetActorLabel() != ActorStringArray[ StringIdx ] )
+            AActor *Actor = FoundActor.Get();
+            if ( !Actor || Actor->IsPendingKillOrUnreachable() )
                 continue;
 
             Socket->AttachActor( Actor, StaticMeshComponent );
@@ -8547,36 +10647,30 @@ FHoudiniEngineUtils::GetGenericAttributeList(
             HandleSplit = true;
             PrimIndexForSplit = PrimitiveIndex;
         }
-        else if ( !GeoPartObject.SplitName.IsEmpty() && ( GeoPartObject.SplitName != TEXT("main_geo") ) )
+        else if ( !GeoPartObject.SplitName.IsNone() && ( GeoPartObject.SplitName != TEXT("main_geo") ) )
         {
             HandleSplit = true;
 
             // Since the meshes have been split, we need to find a primitive that belongs to the proper group
             // so we can read the proper value for its generic attribute
-            TArray< int32 > PartGroupMembership;
+            FHoudiniGroupMembership PartGroupMembership;
             FHoudiniEngineUtils::HapiGetGroupMembership(
                 GeoPartObject.AssetId, GeoPartObject.GetObjectId(), GeoPartObject.GetGeoId(), GeoPartObject.GetPartId(), 
-                HAPI_GROUPTYPE_PRIM, GeoPartObject.SplitName, PartGroupMembership );
+                HAPI_GROUPTYPE_PRIM, GeoPartObject.GetSplitName(), PartGroupMembership );
 
-            for ( int32 n = 0; n < PartGroupMembership.Num(); n++ )
-            {
-                if ( PartGroupMembership[ n ] > 0 )
-                {
-                    PrimIndexForSplit = n;
-                    break;
-                }
-            }
+            PrimIndexForSplit = PartGroupMembership.FindFirstMember();
         }
 
         if ( PrimIndexForSplit < 0 )
             PrimIndexForSplit = 0;
     }
 
+    TArray< FString > AttribNames;
+    FHoudiniEngineString::ToFStringArray( AttribNameSHArray, AttribNames );
+
     for ( int32 Idx = 0; Idx < AttribNameSHArray.Num(); ++Idx )
     {
-        FString HapiString = TEXT("");
-        FHoudiniEngineString HoudiniEngineString( AttribNameSHArray[ Idx ] );
-        HoudiniEngineString.ToFString( HapiString );
+        FString HapiString = AttribNames[ Idx ];
 
         if ( HapiString.StartsWith( GenericAttributePrefix,  ESearchCase::IgnoreCase ) )
         {
@@ -8682,16 +10776,7 @@ FHoudiniEngineUtils::GetGenericAttributeList(
                     HapiSHArray.GetData(), 0, AttribInfo.count ), false );
 
                 // Convert them to FString
-                CurrentUProperty.StringValues.SetNumZeroed( AttribInfo.count * AttribInfo.tupleSize );
-
-                for( int32 IdxSH = 0; IdxSH < HapiSHArray.Num(); IdxSH++ )
-                {
-                    FString CurrentString;
-                    FHoudiniEngineString HEngineString( HapiSHArray[ IdxSH ] );
-                    HEngineString.ToFString( CurrentString );
-
-                    CurrentUProperty.StringValues[ IdxSH ] = CurrentString;
-                }
+                FHoudiniEngineString::ToFStringArray( HapiSHArray, CurrentUProperty.StringValues );
             }
             else
             {
@@ -8905,60 +10990,32 @@ FHoudiniEngineUtils::TryToFindInArrayProperty(UObject* Object, FString UProperty
 */
 
 
-bool FHoudiniEngineUtils::FindUPropertyAttributesOnObject(
-    UObject* ParentObject, const UGenericAttribute& UPropertiesToFind,
-    UProperty*& FoundProperty, UObject*& FoundPropertyObject, void*& StructContainer )
-{
 #if WITH_EDITOR
-    if ( !ParentObject || ParentObject->IsPendingKill() )
-        return false;
 
-    // Get the name of the uprop we're looking for
-    FString CurrentUPropertyName = UPropertiesToFind.AttributeName;
-    if ( CurrentUPropertyName.IsEmpty() )
-        return false;
+/** Property resolved for a uproperty attribute name on a class. **/
+struct FHoudiniCachedUProperty
+{
+    /** Class the property was resolved on, detects classes recompiled or reloaded at the same address. **/
+    TWeakObjectPtr< UClass > Class;
 
-    UClass* MeshClass = ParentObject->GetClass();
-    if ( !MeshClass || MeshClass->IsPendingKill() )
-        return false;
+    /** Resolved property, null if none was found. **/
+    TWeakObjectPtr< UProperty > Property;
 
-    // Set the result pointer to null
-    StructContainer = nullptr;
-    FoundProperty = nullptr;
+    /** Struct property containing the resolved property, null if it is a member of the class itself. **/
+    TWeakObjectPtr< UStructProperty > StructProperty;
+};
 
-    FoundPropertyObject = ParentObject;
+/** Resolved properties, per class and uproperty attribute name. **/
+static TMap< TPair< const UClass *, FString >, FHoudiniCachedUProperty > HoudiniEngineUPropertyCache;
 
+/** Walks the properties of a class, and of its struct properties, to find a uproperty by name or label. **/
+static void
+FindUPropertyOnClass(
+    UClass* MeshClass, const FString& CurrentUPropertyName,
+    UProperty*& FoundProperty, UStructProperty*& FoundStructProperty )
+{
     bool bPropertyHasBeenFound = false;
 
-    /*
-    // Try to find the uprop using a TPropValueIterator??
-    for ( TPropertyValueIterator<UProperty> It( MeshClass, ParentObject, EPropertyValueIteratorFlags::FullRecursion ); It; ++It )
-    {
-        UProperty* CurrentProperty = It.Key();
-        void* CurrentPropertyValue = (void*)It.Value();
-        UObject* ObjectValue = *((UObject**)CurrentPropertyValue);
-
-        FString DisplayName = CurrentProperty->GetDisplayNameText().ToString().Replace(TEXT(" "), TEXT(""));
-        FString Name = CurrentProperty->GetName();
-
-        // If the property name contains the uprop attribute name, we have a candidate
-        if ( Name.Contains( CurrentUPropertyName ) || DisplayName.Contains( CurrentUPropertyName ) )
-        {
-            FoundProperty = CurrentProperty;
-
-            // If it's an equality, we dont need to keep searching
-            if ( ( Name == CurrentUPropertyName ) || ( DisplayName == CurrentUPropertyName ) )
-            {
-                bPropertyHasBeenFound = true;
-                break;
-            }
-        }
-    }
-
-    if ( bPropertyHasBeenFound )
-        return true;
-    */
-
     // Iterate manually on the properties, in order to handle structProperties correctly
     for ( TFieldIterator< UProperty > PropIt( MeshClass, EFieldIteratorFlags::IncludeSuper ); PropIt; ++PropIt )
     {
@@ -8982,14 +11039,6 @@ bool FHoudiniEngineUtils::FindUPropertyAttributesOnObject(
             }
         }
 
-        /*
-        // StructProperty need to be a nested struct
-        if (UStructProperty* StructProperty = Cast< UStructProperty >(CurrentProperty))
-            bPropertyHasBeenFound = TryToFindInStructProperty(MeshComponent, CurrentUPropertyName, StructProperty, FoundProperty, StructContainer);
-        else if (UArrayProperty* ArrayProperty = Cast< UArrayProperty >(CurrentProperty))
-            bPropertyHasBeenFound = TryToFindInArrayProperty(MeshComponent, CurrentUPropertyName, ArrayProperty, FoundProperty, StructContainer);
-        */
-
         // StructProperty need to be a nested struct
         UStructProperty* StructProperty = Cast< UStructProperty >(CurrentProperty);
         if ( StructProperty && !StructProperty->IsPendingKill() )
@@ -9011,10 +11060,10 @@ bool FHoudiniEngineUtils::FindUPropertyAttributesOnObject(
                 // If the property name contains the uprop attribute name, we have a candidate
                 if ( Name.Contains( CurrentUPropertyName ) || DisplayName.Contains( CurrentUPropertyName ) )
                 {
-                    // We found the property in the struct property, we need to keep the ValuePtr in the object
-                    // of the structProp in order to be able to access the property value afterwards...
+                    // We found the property in the struct property, we need to keep the struct property
+                    // in order to be able to access the property value in the object afterwards...
                     FoundProperty = Property;
-                    StructContainer = StructProperty->ContainerPtrToValuePtr< void >( ParentObject, 0 );
+                    FoundStructProperty = StructProperty;
 
                     // If it's an equality, we dont need to keep searching
                     if ( ( Name == CurrentUPropertyName ) || ( DisplayName == CurrentUPropertyName ) )
@@ -9031,7 +11080,7 @@ bool FHoudiniEngineUtils::FindUPropertyAttributesOnObject(
     }
 
     if ( bPropertyHasBeenFound )
-        return true;
+        return;
 
     // Try with FindField??
     if ( !FoundProperty || FoundProperty->IsPendingKill() )
@@ -9040,6 +11089,65 @@ bool FHoudiniEngineUtils::FindUPropertyAttributesOnObject(
     // Try with FindPropertyByName ??
     if ( !FoundProperty || FoundProperty->IsPendingKill() )
         FoundProperty = MeshClass->FindPropertyByName( *CurrentUPropertyName );
+}
+
+/** Returns the property resolved for a class and uproperty attribute name, walking the class on first use only. **/
+static void
+FindCachedUPropertyOnClass(
+    UClass* MeshClass, const FString& CurrentUPropertyName,
+    UProperty*& FoundProperty, UStructProperty*& FoundStructProperty )
+{
+    FoundProperty = nullptr;
+    FoundStructProperty = nullptr;
+
+    FHoudiniCachedUProperty & CachedUProperty = HoudiniEngineUPropertyCache.FindOrAdd( TPair< const UClass *, FString >( MeshClass, CurrentUPropertyName ) );
+    if ( CachedUProperty.Class.Get() == MeshClass
+        && !CachedUProperty.Property.IsStale()
+        && !CachedUProperty.StructProperty.IsStale() )
+    {
+        FoundProperty = CachedUProperty.Property.Get();
+        FoundStructProperty = CachedUProperty.StructProperty.Get();
+        return;
+    }
+
+    FindUPropertyOnClass( MeshClass, CurrentUPropertyName, FoundProperty, FoundStructProperty );
+
+    CachedUProperty.Class = MeshClass;
+    CachedUProperty.Property = FoundProperty;
+    CachedUProperty.StructProperty = FoundStructProperty;
+}
+
+#endif
+
+bool FHoudiniEngineUtils::FindUPropertyAttributesOnObject(
+    UObject* ParentObject, const UGenericAttribute& UPropertiesToFind,
+    UProperty*& FoundProperty, UObject*& FoundPropertyObject, void*& StructContainer )
+{
+#if WITH_EDITOR
+    if ( !ParentObject || ParentObject->IsPendingKill() )
+        return false;
+
+    // Get the name of the uprop we're looking for
+    FString CurrentUPropertyName = UPropertiesToFind.AttributeName;
+    if ( CurrentUPropertyName.IsEmpty() )
+        return false;
+
+    UClass* MeshClass = ParentObject->GetClass();
+    if ( !MeshClass || MeshClass->IsPendingKill() )
+        return false;
+
+    // Set the result pointer to null
+    StructContainer = nullptr;
+    FoundProperty = nullptr;
+
+    FoundPropertyObject = ParentObject;
+
+    // The property resolved for a class and name is cached, only the container depends on the object.
+    UStructProperty* FoundStructProperty = nullptr;
+    FindCachedUPropertyOnClass( MeshClass, CurrentUPropertyName, FoundProperty, FoundStructProperty );
+
+    if ( FoundStructProperty )
+        StructContainer = FoundStructProperty->ContainerPtrToValuePtr< void >( ParentObject, 0 );
 
     // We found the UProperty we were looking for
     if ( FoundProperty && !FoundProperty->IsPendingKill())
@@ -9689,13 +11797,14 @@ FHoudiniEngineUtils::HapiGetAttributeOfType(
         GeoId, PartInfo.id, AttributeOwner,
         AttribNameSHArray.GetData(), nAttribCount ), NumberOfAttributeFound );
 
+    TArray< FString > AttribNames;
+    FHoudiniEngineString::ToFStringArray( AttribNameSHArray, AttribNames );
+
     // Iterate on all the attributes, and get their part infos to get their type    
     for ( int32 Idx = 0; Idx < AttribNameSHArray.Num(); ++Idx )
     {
         // Get the name ...
-        FString HapiString = TEXT("");
-        FHoudiniEngineString HoudiniEngineString( AttribNameSHArray[ Idx ] );
-        HoudiniEngineString.ToFString( HapiString );
+        FString HapiString = AttribNames[ Idx ];
 
         // ... then the attribute info
         HAPI_AttributeInfo AttrInfo;
@@ -9831,10 +11940,25 @@ FHoudiniEngineUtils::GetAllUVAttributesInfoAndTexCoords(
     }
 }
 
+/** Hulls of the multi hull decompositions, keyed by the SHA1 of the collision geometry they were decomposed from. **/
+static TMap< FSHAHash, TArray< FKConvexElem > > HoudiniEngineConvexDecompositionCache;
+
+/** Remember the hulls decomposed from the given collision geometry. **/
+static void
+HoudiniEngineAddCachedConvexDecomposition( const FSHAHash & GeometryHash, const TArray< FKConvexElem > & ConvexElems )
+{
+    // Start over rather than growing without bounds, outputs of the current cooks get cached again.
+    if ( HoudiniEngineConvexDecompositionCache.Num() >= HAPI_UNREAL_CONVEX_DECOMPOSITION_CACHE_SIZE )
+        HoudiniEngineConvexDecompositionCache.Empty();
+
+    HoudiniEngineConvexDecompositionCache.Add( GeometryHash, ConvexElems );
+}
+
 bool
 FHoudiniEngineUtils::AddConvexCollisionToAggregate(
     const TArray<float>& Positions, const TArray<int32>& SplitGroupVertexList,
-    const bool& MultiHullDecomp, FKAggregateGeom& AggregateCollisionGeo )
+    const bool& MultiHullDecomp, FKAggregateGeom& AggregateCollisionGeo,
+    FHoudiniConvexDecompositionTasks * DecompositionTasks )
 {
 #if WITH_EDITOR
     // Get runtime settings.
@@ -9850,15 +11974,18 @@ FHoudiniEngineUtils::AddConvexCollisionToAggregate(
         ImportAxis = HoudiniRuntimeSettings->ImportAxis;
     }
 
-    // We're only interested in the unique vertices
+    // We're only interested in the unique vertices, remember where each of them ends up.
     TArray<int32> UniqueVertexIndexes;
+    TMap< int32, int32 > UniqueVertexRemap;
+    UniqueVertexRemap.Reserve( SplitGroupVertexList.Num() );
     for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx++ )
     {
         int32 Index = SplitGroupVertexList[ VertexIdx ];
         if ( Index < 0 || ( Index >= Positions.Num() ) )
             continue;
 
-        UniqueVertexIndexes.AddUnique( Index );
+        if ( !UniqueVertexRemap.Contains( Index ) )
+            UniqueVertexRemap.Add( Index, UniqueVertexIndexes.Add( Index ) );
     }
 
     // Extract the collision geo's vertices
@@ -9888,33 +12015,44 @@ FHoudiniEngineUtils::AddConvexCollisionToAggregate(
         // creating multiple convex hull collision
         // ... this might take a while
 
-        // We're only interested in the valid indices!
+        // We're only interested in the valid indices, remapped to the collision geo's vertices.
+        // Only the vertices used by this collision geo are decomposed, not all the part's positions.
         TArray<uint32> Indices;
+        Indices.Reserve( SplitGroupVertexList.Num() );
         for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx++ )
         {
             int32 Index = SplitGroupVertexList[ VertexIdx ];
             if ( Index < 0 || ( Index >= Positions.Num() ) )
                 continue;
 
-            Indices.Add( Index );
+            Indices.Add( (uint32) UniqueVertexRemap.FindChecked( Index ) );
         }
 
-        // But we need all the positions as vertex
-        TArray< FVector > Vertices;
-        Vertices.SetNum(Positions.Num() / 3);
-        for ( int32 Idx = 0; Idx < Vertices.Num(); Idx++ )
+        TArray< FVector > Vertices = VertexArray;
+
+        // Identical collision geometry gives identical hulls, either from a previous cook or from another part.
+        // A hit reuses the hulls without looking at the geometry again, so the key must not collide.
+        FSHA1 HashState;
+        const int32 VertexCount = Vertices.Num();
+        HashState.Update( (const uint8 *) &VertexCount, sizeof( VertexCount ) );
+        HashState.Update( (const uint8 *) Vertices.GetData(), Vertices.Num() * Vertices.GetTypeSize() );
+        HashState.Update( (const uint8 *) Indices.GetData(), Indices.Num() * Indices.GetTypeSize() );
+        HashState.Final();
+
+        FSHAHash GeometryHash;
+        HashState.GetHash( GeometryHash.Hash );
+
+        if ( const TArray< FKConvexElem > * CachedConvexElems = HoudiniEngineConvexDecompositionCache.Find( GeometryHash ) )
         {
-            Vertices[ Idx ].X = Positions[ Idx * 3 + 0 ] * GeneratedGeometryScaleFactor;
-            if ( ImportAxis == HRSAI_Unreal )
-            {
-                Vertices[ Idx ].Y = Positions[ Idx * 3 + 2 ] * GeneratedGeometryScaleFactor;
-                Vertices[ Idx ].Z = Positions[ Idx * 3 + 1 ] * GeneratedGeometryScaleFactor;
-            }
-            else
-            {
-                Vertices[ Idx ].Y = Positions[ Idx * 3 + 1 ] * GeneratedGeometryScaleFactor;
-                Vertices[ Idx ].Z = Positions[ Idx * 3 + 2 ] * GeneratedGeometryScaleFactor;
-            }
+            AggregateCollisionGeo.ConvexElems.Append( *CachedConvexElems );
+            return true;
+        }
+
+        // Decompose on a worker thread, the hulls are gathered into the aggregate before it is used.
+        if ( DecompositionTasks )
+        {
+            DecompositionTasks->Add( MoveTemp( Vertices ), MoveTemp( Indices ), MoveTemp( VertexArray ), GeometryHash );
+            return true;
         }
 
         // We are using Unreal's DecomposeMeshToHulls() so we have to create a fake BodySetup
@@ -9928,8 +12066,8 @@ FHoudiniEngineUtils::AddConvexCollisionToAggregate(
         if ( BodySetup->AggGeom.ConvexElems.Num() > 0 )
         {
             // Copy the convex elem to our aggregate
-            for ( int32 n = 0; n < BodySetup->AggGeom.ConvexElems.Num(); n++ )
-                AggregateCollisionGeo.ConvexElems.Add( BodySetup->AggGeom.ConvexElems[ n ] );
+            HoudiniEngineAddCachedConvexDecomposition( GeometryHash, BodySetup->AggGeom.ConvexElems );
+            AggregateCollisionGeo.ConvexElems.Append( BodySetup->AggGeom.ConvexElems );
 
             return true;
         }
@@ -9945,6 +12083,109 @@ FHoudiniEngineUtils::AddConvexCollisionToAggregate(
     return true;
 }
 
+FHoudiniConvexDecompositionTasks::FHoudiniConvexDecompositionTasks()
+{}
+
+FHoudiniConvexDecompositionTasks::~FHoudiniConvexDecompositionTasks()
+{
+    // Decompositions that were never gathered are dropped, the workers must be done with their body setups first.
+    for ( TUniquePtr< FTask > & Task : Tasks )
+    {
+        if ( !Task->BodySetup )
+            continue;
+
+        Task->Future.Wait();
+        Task->BodySetup->RemoveFromRoot();
+    }
+}
+
+void
+FHoudiniConvexDecompositionTasks::Add(
+    TArray< FVector > && Vertices, TArray< uint32 > && Indices, TArray< FVector > && HullVertices, const FSHAHash & GeometryHash )
+{
+#if WITH_EDITOR
+    TUniquePtr< FTask > Task = MakeUnique< FTask >();
+    Task->BodySetup = nullptr;
+    Task->HullVertices = MoveTemp( HullVertices );
+    Task->GeometryHash = GeometryHash;
+    Task->SourceTaskIdx = INDEX_NONE;
+
+    // The same geometry is already being decomposed, reuse its hulls.
+    if ( const int32 * SourceTaskIdx = SourceTaskIndices.Find( GeometryHash ) )
+    {
+        Task->SourceTaskIdx = *SourceTaskIdx;
+        Tasks.Add( MoveTemp( Task ) );
+        return;
+    }
+
+    SourceTaskIndices.Add( GeometryHash, Tasks.Num() );
+
+    // We are using Unreal's DecomposeMeshToHulls() so we have to create a fake BodySetup, on the game thread.
+    Task->BodySetup = NewObject< UBodySetup >();
+    Task->BodySetup->AddToRoot();
+    Task->Vertices = MoveTemp( Vertices );
+    Task->Indices = MoveTemp( Indices );
+
+    FTask * TaskPtr = Task.Get();
+    Task->Future = Async< void >( EAsyncExecution::ThreadPool, [ TaskPtr ]()
+    {
+        DecomposeMeshToHulls( TaskPtr->BodySetup, TaskPtr->Vertices, TaskPtr->Indices, 8, 16 );
+    } );
+
+    Tasks.Add( MoveTemp( Task ) );
+#endif
+}
+
+void
+FHoudiniConvexDecompositionTasks::Gather( FKAggregateGeom & AggregateCollisionGeo )
+{
+    // Source tasks are always gathered before the tasks reusing their hulls, body setups are unrooted at the end.
+    for ( TUniquePtr< FTask > & Task : Tasks )
+    {
+        UBodySetup * BodySetup = Task->BodySetup;
+        if ( BodySetup )
+        {
+            Task->Future.Wait();
+            if ( BodySetup->AggGeom.ConvexElems.Num() > 0 )
+                HoudiniEngineAddCachedConvexDecomposition( Task->GeometryHash, BodySetup->AggGeom.ConvexElems );
+        }
+        else if ( Tasks.IsValidIndex( Task->SourceTaskIdx ) )
+        {
+            BodySetup = Tasks[ Task->SourceTaskIdx ]->BodySetup;
+        }
+
+        if ( BodySetup && BodySetup->AggGeom.ConvexElems.Num() > 0 )
+        {
+            // Copy the convex elem to our aggregate
+            AggregateCollisionGeo.ConvexElems.Append( BodySetup->AggGeom.ConvexElems );
+        }
+        else
+        {
+            // Decomposition failed, fall back to a single convex collision
+            FKConvexElem ConvexCollision;
+            ConvexCollision.VertexData = Task->HullVertices;
+            ConvexCollision.UpdateElemBox();
+
+            AggregateCollisionGeo.ConvexElems.Add( ConvexCollision );
+        }
+    }
+
+    for ( TUniquePtr< FTask > & Task : Tasks )
+    {
+        if ( Task->BodySetup )
+            Task->BodySetup->RemoveFromRoot();
+    }
+
+    Tasks.Empty();
+    SourceTaskIndices.Empty();
+}
+
+bool
+FHoudiniConvexDecompositionTasks::HasTasks() const
+{
+    return Tasks.Num() > 0;
+}
+
 bool
 FHoudiniEngineUtils::AddSimpleCollision(
     const FString& SplitGroupName, UStaticMesh* StaticMesh,
@@ -10138,7 +12379,7 @@ FHoudiniEngineUtils::CreateGroupOrAttributeFromTags( const HAPI_NodeId& NodeId,
             AttributeInfo.exists = true;
             AttributeInfo.owner = HAPI_ATTROWNER_PRIM;
             AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
-            AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+            AttributeInfo.originalOwner = HAPI_ATTROWNER_POINT;
             AttributeInfo.typeInfo = HAPI_ATTRIBUTE_TYPE_NONE;
 
             FString AttributeName = TEXT("unreal_tag_") + TagString;
@@ -29,6 +29,8 @@
 #include "Engine/StaticMesh.h"
 #include "PhysicsEngine/AggregateGeom.h"
 #include "Engine/StaticMeshSocket.h"
+#include "Async/Future.h"
+#include "Misc/SecureHash.h"
 
 class UStaticMesh;
 class UHoudiniAsset;
@@ -36,8 +38,11 @@ class ALandscapeProxy;
 class AHoudiniAssetActor;
 class USplineComponent;
 class USkeletalMesh;
+class UBodySetup;
+class UTexture2D;
 
 struct FRawMesh;
+struct FHoudiniLandscapeHeightfieldInput;
 
 DECLARE_STATS_GROUP( TEXT( "HoudiniEngine" ), STATGROUP_HoudiniEngine, STATCAT_Advanced );
 
@@ -191,6 +196,220 @@ struct HOUDINIENGINERUNTIME_API UGenericAttribute
     }
 };
 
+/** One attribute of a batched point to vertex attribute transfer. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniWedgeAttributeTransfer
+{
+    FHoudiniWedgeAttributeTransfer(
+        const HAPI_AttributeInfo & InAttribInfo, const TArray< float > & InData,
+        float * InVertexData, int32 InTupleSize )
+        : AttribInfo( &InAttribInfo )
+        , Data( &InData )
+        , VertexData( InVertexData )
+        , TupleSize( InTupleSize )
+    {}
+
+    /** Attribute info and values of the part attribute. **/
+    const HAPI_AttributeInfo * AttribInfo;
+    const TArray< float > * Data;
+
+    /** Destination buffer, must have room for TupleSize values per entry of the vertex list. **/
+    float * VertexData;
+    int32 TupleSize;
+};
+
+/** Statistics gathered on a generated raw mesh, in a single pass over its faces. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniRawMeshStats
+{
+    FHoudiniRawMeshStats()
+        : DegenerateTriangleCount( 0 )
+        , InvalidLightmapFaceCount( 0 )
+        , UVSetCount( 0 )
+        , bLightmapUVsMismatch( false )
+    {}
+
+    /** Return true if the lightmap uvs cannot be used to generate lightmaps. **/
+    bool ContainsInvalidLightmapFaces() const { return bLightmapUVsMismatch || InvalidLightmapFaceCount > 0; }
+
+    /** Number of triangles with collapsed vertices. **/
+    int32 DegenerateTriangleCount;
+
+    /** Number of faces whose lightmap uvs are all identical. **/
+    int32 InvalidLightmapFaceCount;
+
+    /** Number of non empty uv sets. **/
+    int32 UVSetCount;
+
+    /** True if the lightmap uv set doesn't have one uv per wedge. **/
+    bool bLightmapUVsMismatch;
+};
+
+/** Colors of a texture mip decoded once, so they can be sampled per vertex from multiple threads. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniTextureMipColors
+{
+    FHoudiniTextureMipColors()
+        : Width( 0 )
+        , Height( 0 )
+    {}
+
+    /** Decode the given source mip of the texture, returns false if the texture has no usable source data. **/
+    bool Decode( UTexture2D * Texture, int32 MipIndex );
+
+    /** Return true if colors have been decoded. **/
+    bool IsValid() const { return Colors.Num() > 0; }
+
+    /** Return the color at the given uv coordinates, black if they are outside of [0, 1). **/
+    FColor Sample( const FVector2D & UVCoord ) const;
+
+    /** Decoded colors, row by row. **/
+    TArray< FColor > Colors;
+
+    /** Size of the decoded mip. **/
+    int32 Width;
+    int32 Height;
+};
+
+/** Membership of the points or primitives of a part in a group, packed one bit per element. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniGroupMembership
+{
+    FHoudiniGroupMembership()
+        : ElementCount( 0 )
+    {}
+
+    /** Remove all elements. **/
+    void Reset();
+
+    /** Set the number of elements of the part, none of them being a member. **/
+    void Init( int32 InElementCount );
+
+    /** Pack the per element membership returned by HAPI. **/
+    void Pack( const int32 * Membership, int32 InElementCount );
+
+    /** Add the members of another group of the same part to this one. **/
+    void Combine( const FHoudiniGroupMembership & Other );
+
+    /** Number of elements of the part. **/
+    int32 Num() const { return ElementCount; }
+
+    /** Return true if the given element is a member of the group. **/
+    bool IsMember( int32 ElementIdx ) const
+    {
+        return ElementIdx >= 0 && ElementIdx < ElementCount && ( Words[ ElementIdx >> 5 ] & ( 1u << ( ElementIdx & 31 ) ) ) != 0;
+    }
+
+    /** Return true if at least one element is a member of the group. **/
+    bool HasMembers() const;
+
+    /** Return the number of members of the group. **/
+    int32 CountMembers() const;
+
+    /** Return the index of the first member of the group, or INDEX_NONE. **/
+    int32 FindFirstMember() const;
+
+    /** Call the functor with the index of each element of the group, in increasing order. **/
+    /** Non member elements are visited instead if bMembers is false. **/
+    template< typename FunctorType >
+    void ForEachElement( bool bMembers, FunctorType Functor ) const
+    {
+        for ( int32 WordIdx = 0; WordIdx < Words.Num(); ++WordIdx )
+        {
+            uint32 Bits = bMembers ? Words[ WordIdx ] : ~Words[ WordIdx ];
+            while ( Bits )
+            {
+                const int32 ElementIdx = ( WordIdx << 5 ) + (int32) FMath::CountTrailingZeros( Bits );
+                if ( ElementIdx >= ElementCount )
+                    return;
+
+                Functor( ElementIdx );
+                Bits &= Bits - 1;
+            }
+        }
+    }
+
+    /** Membership bits, 32 elements per word. **/
+    TArray< uint32 > Words;
+
+    /** Number of elements of the part. **/
+    int32 ElementCount;
+};
+
+/** Transient buffers receiving the raw data of a part, reused from part to part so their allocations are kept. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniPartScratchBuffers
+{
+    /** Empty all buffers, their allocations are kept for the next part. **/
+    void Reset();
+
+    TArray< float > Positions;
+    TArray< float > Normals;
+    TArray< float > Colors;
+    TArray< float > Alphas;
+    TArray< TArray< float > > UVs;
+    TArray< FString > FaceMaterialOverrideNames;
+    TArray< int32 > FaceMaterialOverrides;
+    TArray< int32 > FaceSmoothingMasks;
+    TArray< int32 > LightMapResolutions;
+    TArray< int32 > VertexList;
+    TArray< FString > GroupNames;
+};
+
+/** Scope during which the part buffers used on this thread are shared, nested scopes share the outermost buffers. **/
+/** The buffers and their allocations are released when the outermost scope ends. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniScopedPartScratchBuffers
+{
+    FHoudiniScopedPartScratchBuffers();
+    ~FHoudiniScopedPartScratchBuffers();
+
+    /** Return the buffers of the outermost scope active on this thread. **/
+    FHoudiniPartScratchBuffers & Get();
+
+    /** Buffers owned by this scope, only used if no outer scope was active. **/
+    FHoudiniPartScratchBuffers Buffers;
+
+    /** Is set to true if this scope installed its buffers, false if an outer scope was already active. **/
+    bool bOwnsBuffers;
+};
+
+/** Multi hull convex decompositions of UCX colliders, running on worker threads. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniConvexDecompositionTasks
+{
+    FHoudiniConvexDecompositionTasks();
+    ~FHoudiniConvexDecompositionTasks();
+
+    /** Start decomposing the given collision mesh, the single hull of HullVertices is used if decomposition fails. **/
+    /** Meshes with the same GeometryHash are only decomposed once, the result is cached for the next cooks.       **/
+    void Add( TArray< FVector > && Vertices, TArray< uint32 > && Indices, TArray< FVector > && HullVertices, const FSHAHash & GeometryHash );
+
+    /** Wait for all decompositions and add their convex hulls to the aggregate geometry. **/
+    void Gather( FKAggregateGeom & AggregateCollisionGeo );
+
+    /** Return true if decompositions have been started and not gathered yet. **/
+    bool HasTasks() const;
+
+    protected:
+
+        struct FTask
+        {
+            /** Body setup receiving the decomposed hulls, rooted while the task runs. **/
+            UBodySetup * BodySetup;
+
+            TArray< FVector > Vertices;
+            TArray< uint32 > Indices;
+            TArray< FVector > HullVertices;
+
+            /** SHA1 of the collision geometry, used as the decomposition cache key. **/
+            FSHAHash GeometryHash;
+
+            /** Index of the task decomposing the same geometry, the body setup is only valid if this is INDEX_NONE. **/
+            int32 SourceTaskIdx;
+
+            TFuture< void > Future;
+        };
+
+        TArray< TUniquePtr< FTask > > Tasks;
+
+        /** Index of the task decomposing each geometry hash. **/
+        TMap< FSHAHash, int32 > SourceTaskIndices;
+};
+
 struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
 {
     public:
@@ -240,6 +459,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** HAPI : Translate HAPI transform to Unreal one. **/
         static void TranslateHapiTransform( const HAPI_Transform & HapiTransform, FTransform & UnrealTransform );
 
+        /** HAPI : Translate an array of HAPI transforms to Unreal ones, using vector registers. **/
+        static void TranslateHapiTransforms( const HAPI_Transform * HapiTransforms, int32 Count, FTransform * UnrealTransforms );
+
         /** HAPI : Translate HAPI Euler transform to Unreal one. **/
         static void TranslateHapiTransform( const HAPI_TransformEuler & HapiTransformEuler, FTransform & UnrealTransform );
 
@@ -262,6 +484,19 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshesIn,
             TMap< FHoudiniGeoPartObject, UStaticMesh * > & StaticMeshesOut, FTransform & ComponentTransform );
 
+        /** Hash the positions, topology and attributes used to build a split's static mesh. Missing part attributes **/
+        /** are fetched into the given arrays so they can be reused for building. Returns 0 if positions are missing. **/
+        static uint32 HashSplitGeometry(
+            HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId, HAPI_PartId PartId,
+            const TArray< int32 > & SplitGroupVertexList,
+            TArray< float > & PartPositions, HAPI_AttributeInfo & AttribInfoPositions,
+            TArray< float > & PartNormals, HAPI_AttributeInfo & AttribInfoNormals,
+            TArray< float > & PartColors, HAPI_AttributeInfo & AttribInfoColors,
+            TArray< float > & PartAlphas, HAPI_AttributeInfo & AttribInfoAlpha,
+            TArray< TArray< float > > & PartUVs, TArray< HAPI_AttributeInfo > & AttribInfoUVs,
+            TArray< int32 > & PartFaceSmoothingMasks, HAPI_AttributeInfo & AttribInfoFaceSmoothingMasks,
+            TArray< int32 > & PartLightMapResolutions, HAPI_AttributeInfo & AttribLightmapResolution );
+
         /** Extract position information from coords string. **/
         static void ExtractStringPositions( const FString & Positions, TArray< FVector > & OutPositions );
 
@@ -272,6 +507,25 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** scaling.                                                                                                    **/
         static void ConvertScaleAndFlipVectorData( const TArray< float > & DataRaw, TArray< FVector > & DataOut );
 
+        /** Scale and swap axes of the given vectors in place. **/
+        static void ConvertScaleAndFlipVectorData( FVector * Data, int32 Count );
+
+        /** Scale the given vectors and optionally swap their Y and Z axes in place. Four vectors are converted at **/
+        /** a time using vector registers, large arrays are split over worker threads.                              **/
+        static void ScaleAndSwapVectors( FVector * Data, int32 Count, float ScaleFactor, bool bSwapYZ );
+
+        /** Convert per wedge vectors in a single pass: copy them to Dest (which may be Source), swapping the second **/
+        /** and third wedge of each triangle if bReverseWinding is set, then scale them and optionally swap Y and Z.  **/
+        static void ConvertWedgeVectors(
+            const FVector * Source, FVector * Dest, int32 WedgeCount,
+            float ScaleFactor, bool bSwapYZ, bool bReverseWinding );
+
+        /** Convert per wedge Unreal UVs to Houdini uvw values, optionally reversing the winding of each triangle. **/
+        static void ConvertWedgeUVs( const FVector2D * Source, FVector * Dest, int32 WedgeCount, bool bReverseWinding );
+
+        /** Convert per wedge colors to linear colors, optionally reversing the winding of each triangle. **/
+        static void ConvertWedgeColors( const FColor * Source, FLinearColor * Dest, int32 WedgeCount, bool bReverseWinding );
+
         /** Returns platform specific name of libHAPI. **/
         static FString HoudiniGetLibHAPIName();
 
@@ -284,6 +538,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** Helper function to extract copied Houdini actor from clipboard. **/
         static AHoudiniAssetActor * LocateClipboardActor( const AActor* IgnoreActor, const FString & ClipboardText );
 
+        /** HAPI : Load the asset library from the given file, unless it has already been loaded in the current session. **/
+        static HAPI_Result LoadAssetLibraryFromFile( const FString & AssetFileName, HAPI_AssetLibraryId & OutAssetLibraryId );
+
+        /** HAPI : Load the asset library from the asset's buffer, unless the same buffer has already been loaded in the current session. **/
+        static HAPI_Result LoadAssetLibraryFromMemory( const UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & OutAssetLibraryId );
+
         /** Retrieves list of asset names contained within the HDA. **/
         static bool GetAssetNames(
             UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & AssetLibraryId,
@@ -310,6 +570,10 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** HAPI : Retrieve object transforms from given asset node id. **/
         static bool HapiGetObjectTransforms( HAPI_NodeId AssetId, TArray< HAPI_Transform > & ObjectTransforms );
 
+        /** HAPI : Sample up to MaxPoints positions of the asset's visible display geometry, in asset space. **/
+        static bool HapiGetCookPreviewPoints(
+            HAPI_NodeId AssetId, int32 MaxPoints, TArray< FVector > & OutPoints, FBox & OutBounds );
+
         /** HAPI : Marshalling, extract landscape geometry and upload it. Return true on success. **/
         static bool HapiCreateInputNodeForLandscape(
             const HAPI_NodeId& HostAssetId, ALandscapeProxy * LandscapeProxy,
@@ -317,7 +581,7 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const bool& bExportOnlySelected, const bool& bExportCurves, const bool& bExportMaterials,
             const bool& bExportAsMesh, const bool& bExportLighting, const bool& bExportNormalizedUVs,
             const bool& bExportTileUVs, const FBox& AssetBounds, const bool& bExportAsHeightfield,
-            const bool& bAutoSelectComponents );
+            const bool& bAutoSelectComponents, FHoudiniLandscapeHeightfieldInput* OutHeightfieldInput = nullptr );
 
         /** HAPI : Marshaling, extract geometry and create input asset for it - return true on success **/
         static bool HapiCreateInputNodeForStaticMesh(
@@ -328,6 +592,25 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const bool& ExportAllLODs = false,
             const bool& ExportSockets = false );
 
+        /** HAPI : Marshaling, upload the geometry of a static mesh once per content, return the node holding it. **/
+        static bool HapiUploadStaticMeshToCache(
+            UStaticMesh * Mesh,
+            HAPI_NodeId & OutUploadNodeId,
+            const bool& ExportAllLODs = false,
+            const bool& ExportSockets = false );
+
+        /** HAPI : Marshaling, set the points of an instancing node to the given transforms - return true on success **/
+        static bool HapiSetInstancePointTransforms( HAPI_NodeId PointsNodeId, const TArray< FTransform > & InstanceTransforms );
+
+        /** HAPI : Marshaling, upload the geometry of a static mesh, bypassing the upload cache - return true on success **/
+        static bool HapiUploadStaticMesh(
+            UStaticMesh * Mesh,
+            HAPI_NodeId & ConnectedAssetId,
+            TArray< HAPI_NodeId >& OutCreatedNodeIds,
+            class UStaticMeshComponent* StaticMeshComponent = nullptr,
+            const bool& ExportAllLODs = false,
+            const bool& ExportSockets = false );
+
         /** HAPI : Marshaling, extract geometry and create input asset for it - return true on success **/
         static bool HapiCreateInputNodeForObjects(
             HAPI_NodeId HostAssetId,
@@ -366,12 +649,29 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             TArray<float>* UniformScales = nullptr,
             bool ForceClose = false );
 
+        /** HAPI : Write the curve points straight to the node geometry as binary P attribute data, as a single linear   **/
+        /** curve, or a polygon when closed. Rotations and scales are optional and must match the number of positions. **/
+        /** This bypasses the coords string of the curve SOP, which is only needed for curves it has to refine.         **/
+        static bool HapiSetLinearCurveGeometry(
+            HAPI_NodeId NodeId,
+            const TArray< FVector > & Positions,
+            const TArray< FQuat > * Rotations,
+            const TArray< FVector > * Scales3d,
+            const TArray< float > * UniformScales,
+            bool bClosed );
+
         /** HAPI : Marshaling, extract geometry and skeleton and create input asset for it - return true on success **/
         static bool HapiCreateInputNodeForSkeletalMesh(
             HAPI_NodeId HostAssetId, USkeletalMesh * SkeletalMesh,
             HAPI_NodeId & ConnectedAssetId, TArray< HAPI_NodeId >& OutCreatedNodeIds,
             const bool& bExportSkeleton = true );
 
+        /** HAPI : Marshaling, upload the geometry and skeleton of a skeletal mesh, bypassing the upload cache - return true on success **/
+        static bool HapiUploadSkeletalMesh(
+            HAPI_NodeId HostAssetId, USkeletalMesh * SkeletalMesh,
+            HAPI_NodeId & ConnectedAssetId, TArray< HAPI_NodeId >& OutCreatedNodeIds,
+            const bool& bExportSkeleton = true );
+
         /** HAPI : Marshaling, extract skeleton and creates its Houdini equivalent - return true on success **/
         static bool HapiCreateSkeletonFromData(
                 HAPI_NodeId HostAssetId,
@@ -393,7 +693,13 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** HAPI : Retrieve group membership. **/
         static bool HapiGetGroupMembership(
             HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId, HAPI_PartId PartId,
-            HAPI_GroupType GroupType, const FString & GroupName, TArray< int32 > & GroupMembership );
+            HAPI_GroupType GroupType, const FString & GroupName, FHoudiniGroupMembership & GroupMembership );
+
+        /** HAPI : Retrieve the membership of several groups, the part is only queried once. **/
+        /** Groups whose membership could not be retrieved get an empty membership. **/
+        static bool HapiGetGroupMemberships(
+            HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId, HAPI_PartId PartId,
+            HAPI_GroupType GroupType, const TArray< FString > & GroupNames, TArray< FHoudiniGroupMembership > & GroupMemberships );
 
         /** HAPI : Get group count by type. **/
         static int32 HapiGetGroupCountByType( HAPI_GroupType GroupType, HAPI_GeoInfo & GeoInfo );
@@ -429,6 +735,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
                 TArray< HAPI_AttributeInfo >& MatchingAttributesInfo,
                 TArray< FString >& MatchingAttributesName );
 
+        /** Return the number of elements to read per HAPI call, very large parts are imported in chunks. **/
+        static int32 GetChunkedImportLength( int32 Count, int32 TupleSize );
+
         /** HAPI : Get attribute data as float. **/
         static bool HapiGetAttributeDataAsFloat(
             HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
@@ -459,6 +768,13 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
              const FHoudiniGeoPartObject & HoudiniGeoPartObject, const char * Name,
              HAPI_AttributeInfo & ResultAttributeInfo, TArray< FString > & Data, int32 TupleSize = 0, HAPI_AttributeOwner Owner = HAPI_ATTROWNER_INVALID );
 
+        /** HAPI : Get attribute data as a table of distinct strings, and the index of each element's string in it. **/
+        static bool HapiGetAttributeDataAsStringTable(
+            HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
+            HAPI_PartId PartId, const char * Name, HAPI_AttributeInfo & ResultAttributeInfo,
+            TArray< FString > & Strings, TArray< int32 > & StringIndices,
+            int32 TupleSize = 0, HAPI_AttributeOwner Owner = HAPI_ATTROWNER_INVALID );
+
         /** HAPI : Get parameter data as float. **/
         static bool HapiGetParameterDataAsFloat(
             HAPI_NodeId NodeId, const std::string ParmName, float DefaultValue, float & Value );
@@ -489,6 +805,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         static HAPI_ParmId HapiFindParameterByNameOrTag( const HAPI_NodeId& NodeId, const std::string ParmName );
         static HAPI_ParmId HapiFindParameterByNameOrTag( const HAPI_NodeId& NodeId, const std::string ParmName, HAPI_ParmInfo& FoundParmInfo );
 
+        /** Forget the parameters looked up by name or tag on a node, after its parameter interface has changed. **/
+        static void InvalidateParameterLookupIndex( const HAPI_NodeId & NodeId );
+
         /** HAPI : Return a give node's parent ID, -1 if none **/
         static HAPI_NodeId HapiGetParentNodeId( const HAPI_NodeId& NodeId );
 #if WITH_EDITOR
@@ -515,6 +834,13 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             TArray< int32 > & NewVertexList, TArray< int32 > & AllVertexList, TArray< int32 > & AllFaceList,
             TArray< int32 > & AllCollisionFaceIndices, const bool& isPackedPrim );
 
+        /** Partition the vertex list of a part between primitive groups, in a single pass over its faces. **/
+        /** Faces that are not in any of the groups go to the remaining lists. Vertex lists have -1 for wedges of other faces. **/
+        static void PartitionVertexListByGroups(
+            const TArray< int32 > & FullVertexList, int32 FaceCount, const TArray< FHoudiniGroupMembership > & GroupMemberships,
+            TArray< TArray< int32 > > & GroupVertexLists, TArray< TArray< int32 > > & GroupFaceLists, TArray< int32 > & GroupWedgeCounts,
+            TArray< int32 > & RemainingVertexList, TArray< int32 > & RemainingFaceList, int32 & RemainingWedgeCount );
+
         /** HAPI : Retrieves the mesh sockets list for the current part **/
         static int32 AddMeshSocketToList(
             HAPI_NodeId AssetId, HAPI_NodeId ObjectId,
@@ -535,7 +861,13 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             TArray< FString >& AllSocketsTags );
 
         /** Add the actor stored in the socket tag to the socket for the given static mesh component **/
-        static bool AddActorsToMeshSocket( UStaticMeshSocket* Socket, class UStaticMeshComponent* StaticMeshComponent );
+        /** The actors are looked up in ActorsByName if given, otherwise in the component's world. **/
+        static bool AddActorsToMeshSocket(
+            UStaticMeshSocket* Socket, class UStaticMeshComponent* StaticMeshComponent,
+            const TMultiMap< FString, TWeakObjectPtr< AActor > > * ActorsByName = nullptr );
+
+        /** Index the actors of a world by name and label, to resolve the actors attached to mesh sockets **/
+        static void BuildActorNameIndex( UWorld* World, TMultiMap< FString, TWeakObjectPtr< AActor > > & OutActorsByName );
 
         /** Add the mesh aggregate collision geo to the specified StaticMesh **/
         static bool AddAggregateCollisionGeometryToStaticMesh(
@@ -544,9 +876,11 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             FKAggregateGeom& AggregateCollisionGeo );
 
         /** Add convex hull to the mesh's aggregate collision geometry **/
+        /** If decomposition tasks are given, multi hull decompositions are queued on them instead of blocking. **/
         static bool AddConvexCollisionToAggregate(
             const TArray<float>& Positions, const TArray<int32>& SplitGroupVertexList,
-            const bool& MultiHullDecomp, FKAggregateGeom& AggregateCollisionGeo );
+            const bool& MultiHullDecomp, FKAggregateGeom& AggregateCollisionGeo,
+            FHoudiniConvexDecompositionTasks * DecompositionTasks = nullptr );
 
         /** Add convex hull to the mesh's aggregate collision geometry **/
         static bool AddSimpleCollision(
@@ -623,6 +957,17 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const TArray< int32 > & VertexList, const HAPI_AttributeInfo & AttribInfo, 
             const TArray< float > & Data, TArray< float >& VertexData );
 
+        /** Transfer attribute values of valid wedges straight into a caller-provided buffer, TupleSize values per wedge. **/
+        /** The buffer must have room for every entry of the vertex list. Returns number of wedges. **/
+        static int32 TransferRegularPointAttributesToVertices(
+            const TArray< int32 > & VertexList, const HAPI_AttributeInfo & AttribInfo,
+            const TArray< float > & Data, float * VertexData, int32 TupleSize );
+
+        /** Transfer several attributes at once, the valid wedges of the vertex list are resolved a single time and **/
+        /** shared by all attributes, which are gathered together chunk by chunk. Returns number of wedges. **/
+        static int32 TransferRegularPointAttributesToVertices(
+            const TArray< int32 > & VertexList, const TArray< FHoudiniWedgeAttributeTransfer > & Transfers );
+
 #if WITH_EDITOR
 
         /** Helper routine to check if Raw Mesh contains degenerate triangles. **/
@@ -631,14 +976,19 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** Helper routine to count number of degenerate triangles. **/
         static int32 CountDegenerateTriangles( const FRawMesh & RawMesh );
 
+        /** Gather the degenerate triangles, invalid lightmap faces and uv sets of a raw mesh in a single pass. **/
+        static void ComputeRawMeshStats( const FRawMesh & RawMesh, int32 LightmapSourceIdx, FHoudiniRawMeshStats & OutStats );
+
         /** Create helper array of material names, we use it for marshalling. **/
+        /** Faces point into the list of unique names, which is the only one that needs to be deleted. **/
         static void CreateFaceMaterialArray(
             const TArray< UMaterialInterface * >& Materials,
             const TArray< int32 > & FaceMaterialIndices,
-            TArray< char * > & OutStaticMeshFaceMaterials );
+            TArray< char * > & OutUniqueMaterialNames,
+            TArray< const char * > & OutStaticMeshFaceMaterials );
 
-        /** Delete helper array of material names. **/
-        static void DeleteFaceMaterialArray( TArray< char * > & OutStaticMeshFaceMaterials );
+        /** Delete helper array of unique material names. **/
+        static void DeleteFaceMaterialArray( TArray< char * > & OutUniqueMaterialNames );
 
 #endif // WITH_EDITOR
 
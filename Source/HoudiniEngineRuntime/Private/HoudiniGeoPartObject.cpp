@@ -37,6 +37,27 @@
 #include "HoudiniPluginSerializationVersion.h"
 #include "HoudiniEngineString.h"
 
+/** Name of the parts and objects that have not been named. **/
+static const FName HoudiniGeoPartObjectEmptyName( TEXT( "Empty" ) );
+
+/** Serialize an interned name as a string, like the names were stored before being interned. **/
+static void
+SerializeNameAsString( FArchive & Ar, FName & Name )
+{
+    FString NameString = Name.IsNone() ? FString() : Name.ToString();
+    Ar << NameString;
+
+    if ( Ar.IsLoading() )
+        Name = NameString.IsEmpty() ? NAME_None : FName( *NameString );
+}
+
+/** Return the string of an interned name, empty if there is none. **/
+static FString
+NameToString( const FName & Name )
+{
+    return Name.IsNone() ? FString() : Name.ToString();
+}
+
 uint32
 GetTypeHash( const FHoudiniGeoPartObject & HoudiniGeoPartObject )
 {
@@ -76,16 +97,17 @@ FHoudiniGeoPartObjectSortPredicate::operator()( const FHoudiniGeoPartObject & A,
 
 FHoudiniGeoPartObject::FHoudiniGeoPartObject()
     : TransformMatrix( FMatrix::Identity )
-    , ObjectName( TEXT("Empty" ) )
-    , PartName( TEXT( "Empty" ) )
-    , SplitName( TEXT( "" ) )
-    , InstancerMaterialName( TEXT( "" ) )
-    , InstancerAttributeMaterialName( TEXT( "" ) )
+    , ObjectName( HoudiniGeoPartObjectEmptyName )
+    , PartName( HoudiniGeoPartObjectEmptyName )
+    , SplitName( NAME_None )
+    , InstancerMaterialName( NAME_None )
+    , InstancerAttributeMaterialName( NAME_None )
     , AssetId( -1 )
     , ObjectId( -1 )
     , GeoId( -1 )
     , PartId( -1 )
     , SplitId( 0 )
+    , GeometryHash( 0u )
     , bIsVisible( true )
     , bIsInstancer( false )
     , bIsCurve( false )
@@ -114,15 +136,16 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject()
 FHoudiniGeoPartObject::FHoudiniGeoPartObject(
     HAPI_NodeId InAssetId, HAPI_NodeId InObjectId, HAPI_NodeId InGeoId, HAPI_PartId InPartId )
     : TransformMatrix( FMatrix::Identity )
-    , ObjectName( TEXT( "Empty" ) )
-    , PartName( TEXT( "Empty" ) )
-    , SplitName( TEXT( "" ) )
-    , InstancerMaterialName( TEXT( "" ) )
+    , ObjectName( HoudiniGeoPartObjectEmptyName )
+    , PartName( HoudiniGeoPartObjectEmptyName )
+    , SplitName( NAME_None )
+    , InstancerMaterialName( NAME_None )
     , AssetId( InAssetId )
     , ObjectId( InObjectId )
     , GeoId( InGeoId )
     , PartId( InPartId )
     , SplitId( 0 )
+    , GeometryHash( 0u )
     , bIsVisible( true )
     , bIsInstancer( false )
     , bIsCurve( false )
@@ -152,15 +175,16 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject(
     const FTransform & InTransform, HAPI_NodeId InAssetId,
     const HAPI_ObjectInfo & ObjectInfo, const HAPI_GeoInfo & GeoInfo, const HAPI_PartInfo & PartInfo )
     : TransformMatrix( InTransform )
-    , ObjectName( TEXT( "Empty" ) )
-    , PartName( TEXT( "Empty" ) )
-    , SplitName( TEXT( "" ) )
-    , InstancerMaterialName( TEXT( "" ) )
+    , ObjectName( HoudiniGeoPartObjectEmptyName )
+    , PartName( HoudiniGeoPartObjectEmptyName )
+    , SplitName( NAME_None )
+    , InstancerMaterialName( NAME_None )
     , AssetId( InAssetId )
     , ObjectId( ObjectInfo.nodeId )
     , GeoId( GeoInfo.nodeId )
     , PartId( PartInfo.id )
     , SplitId( 0 )
+    , GeometryHash( 0u )
     , bIsVisible( ObjectInfo.isVisible )
     , bIsInstancer( ObjectInfo.isInstancer )
     , bIsCurve( PartInfo.type == HAPI_PARTTYPE_CURVE )
@@ -192,15 +216,16 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject(
     HAPI_NodeId InObjectId, HAPI_NodeId InGeoId,
     HAPI_PartId InPartId )
     : TransformMatrix( InTransform )
-    , ObjectName( InObjectName )
-    , PartName( InPartName )
-    , SplitName( TEXT( "" ) )
-    , InstancerMaterialName( TEXT( "" ) )
+    , ObjectName( *InObjectName )
+    , PartName( *InPartName )
+    , SplitName( NAME_None )
+    , InstancerMaterialName( NAME_None )
     , AssetId( InAssetId )
     , ObjectId( InObjectId )
     , GeoId( InGeoId )
     , PartId( InPartId )
     , SplitId( 0 )
+    , GeometryHash( 0u )
     , bIsVisible( true )
     , bIsInstancer( false )
     , bIsCurve( false )
@@ -237,6 +262,7 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject( const FHoudiniGeoPartObject & GeoP
     , GeoId( GeoPartObject.GeoId )
     , PartId( GeoPartObject.PartId )
     , SplitId( GeoPartObject.SplitId )
+    , GeometryHash( GeoPartObject.GeometryHash )
     , bIsVisible( GeoPartObject.bIsVisible )
     , bIsInstancer( GeoPartObject.bIsInstancer )
     , bIsCurve( GeoPartObject.bIsCurve )
@@ -386,23 +412,6 @@ FHoudiniGeoPartObject::GetNodePath() const
     return NodePath;
 }
 
-bool
-FHoudiniGeoPartObject::operator==( const FHoudiniGeoPartObject & GeoPartObject ) const
-{
-    return (
-        ObjectId == GeoPartObject.ObjectId &&
-        GeoId == GeoPartObject.GeoId &&
-        PartId == GeoPartObject.PartId &&
-        SplitId == GeoPartObject.SplitId );
-}
-
-uint32
-FHoudiniGeoPartObject::GetTypeHash() const
-{
-    int32 HashBuffer[ 4 ] = { ObjectId, GeoId, PartId, SplitId };
-    return FCrc::MemCrc_DEPRECATED( (void *) &HashBuffer[ 0 ], sizeof( HashBuffer ) );
-}
-
 void
 FHoudiniGeoPartObject::Serialize( FArchive & Ar )
 {
@@ -413,17 +422,17 @@ FHoudiniGeoPartObject::Serialize( FArchive & Ar )
 
     Ar << TransformMatrix;
 
-    Ar << ObjectName;
-    Ar << PartName;
-    Ar << SplitName;
+    SerializeNameAsString( Ar, ObjectName );
+    SerializeNameAsString( Ar, PartName );
+    SerializeNameAsString( Ar, SplitName );
 
     // Serialize instancer material.
     if ( HoudiniGeoPartObjectVersion >= VER_HOUDINI_ENGINE_GEOPARTOBJECT_INSTANCER_MATERIAL_NAME )
-        Ar << InstancerMaterialName;
+        SerializeNameAsString( Ar, InstancerMaterialName );
 
     // Serialize instancer attribute material.
     if ( HoudiniGeoPartObjectVersion >= VER_HOUDINI_ENGINE_GEOPARTOBJECT_INSTANCER_ATTRIBUTE_MATERIAL_NAME )
-        Ar << InstancerAttributeMaterialName;
+        SerializeNameAsString( Ar, InstancerAttributeMaterialName );
 
     Ar << AssetId;
     Ar << ObjectId;
@@ -483,6 +492,36 @@ FHoudiniGeoPartObject::CompareNames( const FHoudiniGeoPartObject & HoudiniGeoPar
     return ( ObjectName == HoudiniGeoPartObject.ObjectName && PartName == HoudiniGeoPartObject.PartName );
 }
 
+FString
+FHoudiniGeoPartObject::GetObjectName() const
+{
+    return NameToString( ObjectName );
+}
+
+FString
+FHoudiniGeoPartObject::GetPartName() const
+{
+    return NameToString( PartName );
+}
+
+FString
+FHoudiniGeoPartObject::GetSplitName() const
+{
+    return NameToString( SplitName );
+}
+
+FString
+FHoudiniGeoPartObject::GetInstancerMaterialName() const
+{
+    return NameToString( InstancerMaterialName );
+}
+
+FString
+FHoudiniGeoPartObject::GetInstancerAttributeMaterialName() const
+{
+    return NameToString( InstancerAttributeMaterialName );
+}
+
 bool
 FHoudiniGeoPartObject::HasParameters() const
 {
@@ -528,7 +567,7 @@ FHoudiniGeoPartObject::HasCustomName() const
 void
 FHoudiniGeoPartObject::SetCustomName( const FString & CustomName )
 {
-    PartName = CustomName;
+    PartName = CustomName.IsEmpty() ? NAME_None : FName( *CustomName );
     bHasCustomName = true;
 }
 
@@ -623,15 +662,8 @@ FHoudiniGeoPartObject::HapiGetInstanceTransforms( HAPI_NodeId OtherAssetId, TArr
             FHoudiniEngine::Get().GetSession(), GeoId, PartId, HAPI_SRT, &InstanceTransforms[ 0 ],
             0, PointCount) == HAPI_RESULT_SUCCESS )
         {
-            for ( int32 PointIdx = 0; PointIdx < PointCount; ++PointIdx )
-            {
-                FTransform TempTransformMatrix;
-
-                const HAPI_Transform & HapiInstanceTransform = InstanceTransforms[ PointIdx ];
-                FHoudiniEngineUtils::TranslateHapiTransform( HapiInstanceTransform, TempTransformMatrix );
-
-                AllTransforms.Add( TempTransformMatrix );
-            }
+            AllTransforms.SetNumUninitialized( PointCount );
+            FHoudiniEngineUtils::TranslateHapiTransforms( InstanceTransforms.GetData(), PointCount, AllTransforms.GetData() );
         }
         else
         {
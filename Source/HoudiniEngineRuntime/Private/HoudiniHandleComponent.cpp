@@ -36,6 +36,9 @@
 #include "HoudiniEngineString.h"
 #include "HoudiniAssetComponent.h"
 
+#include "Internationalization/Internationalization.h"
+#define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
+
 HAPI_RSTOrder
 UHoudiniHandleComponent::GetHapiRSTOrder( const TSharedPtr< FString > & StrPtr )
 {
@@ -91,6 +94,10 @@ UHoudiniHandleComponent::Construct(
     TArray< HAPI_HandleBindingInfo > BindingInfos;
     BindingInfos.SetNumZeroed( HandleInfo.bindingsCount );
 
+    // The handle belongs to the asset in the session of the component we are attached to.
+    UHoudiniAssetComponent * AttachComponent = Cast< UHoudiniAssetComponent >( GetAttachParent() );
+    FHoudiniScopedSession ScopedSession( AttachComponent ? AttachComponent->GetSessionIndex() : 0 );
+
     if ( FHoudiniApi::GetHandleBindingInfo(
         FHoudiniEngine::Get().GetSession(),
         AssetId, HandleIdx, &BindingInfos[ 0 ], 0,
@@ -157,8 +164,8 @@ UHoudiniHandleComponent::ResolveDuplicatedParameters( const TMap< HAPI_ParmId, U
     RotOrderParm.ResolveDuplicated( NewParameters );
 }
 
-void
-UHoudiniHandleComponent::UpdateTransformParameters()
+bool
+UHoudiniHandleComponent::UpdateTransformParameters( bool bRecordUndo )
 {
     HAPI_Transform HapiXform;
     FMemory::Memzero< HAPI_Transform >( HapiXform );
@@ -179,23 +186,47 @@ UHoudiniHandleComponent::UpdateTransformParameters()
         &HapiEulerXform
     );
 
-    XformParms[ EXformParameter::TX ] = HapiEulerXform.position[ 0 ];
-    XformParms[ EXformParameter::TY ] = HapiEulerXform.position[ 1 ];
-    XformParms[ EXformParameter::TZ ] = HapiEulerXform.position[ 2 ];
-
-    XformParms[ EXformParameter::RX ] = FMath::RadiansToDegrees(HapiEulerXform.rotationEuler[ 0 ]);
-    XformParms[ EXformParameter::RY ] = FMath::RadiansToDegrees(HapiEulerXform.rotationEuler[ 1 ]);
-    XformParms[ EXformParameter::RZ ] = FMath::RadiansToDegrees(HapiEulerXform.rotationEuler[ 2 ]);
-
     constexpr float MaxFloat = TNumericLimits<float>::Max();
     constexpr float MinFloat = TNumericLimits<float>::Min();
     HapiEulerXform.scale[ 0 ] = FMath::Clamp( HapiEulerXform.scale[ 0 ], MinFloat, MaxFloat );
     HapiEulerXform.scale[ 1 ] = FMath::Clamp( HapiEulerXform.scale[ 1 ], MinFloat, MaxFloat );
     HapiEulerXform.scale[ 2 ] = FMath::Clamp( HapiEulerXform.scale[ 2 ], MinFloat, MaxFloat );
 
-    XformParms[ EXformParameter::SX ] = HapiEulerXform.scale[ 0 ];
-    XformParms[ EXformParameter::SY ] = HapiEulerXform.scale[ 1 ];
-    XformParms[ EXformParameter::SZ ] = HapiEulerXform.scale[ 2 ];
+    const float XformValues[ EXformParameter::COUNT ] =
+    {
+        HapiEulerXform.position[ 0 ], HapiEulerXform.position[ 1 ], HapiEulerXform.position[ 2 ],
+        FMath::RadiansToDegrees( HapiEulerXform.rotationEuler[ 0 ] ),
+        FMath::RadiansToDegrees( HapiEulerXform.rotationEuler[ 1 ] ),
+        FMath::RadiansToDegrees( HapiEulerXform.rotationEuler[ 2 ] ),
+        HapiEulerXform.scale[ 0 ], HapiEulerXform.scale[ 1 ], HapiEulerXform.scale[ 2 ]
+    };
+
+#if WITH_EDITOR
+    // The values set on release are a single undo step, the ones set while dragging are not recorded.
+    FScopedTransaction Transaction(
+        TEXT( HOUDINI_MODULE_RUNTIME ),
+        LOCTEXT( "HoudiniHandleChange", "Houdini Handle: Changing a transform" ),
+        this, bRecordUndo );
+#endif
+
+    // The parameters are only marked as changed here, the changed tuples are uploaded together before the next cook.
+    UHoudiniAssetParameter * ChangedParameter = nullptr;
+    for ( int32 Idx = 0; Idx < EXformParameter::COUNT; ++Idx )
+    {
+        if ( XformParms[ Idx ].SetWithoutNotify( XformValues[ Idx ], bRecordUndo ) )
+            ChangedParameter = XformParms[ Idx ].AssetParameter;
+    }
+
+    if ( !ChangedParameter )
+        return false;
+
+#if WITH_EDITOR
+    UHoudiniAssetComponent * AttachComponent = Cast< UHoudiniAssetComponent >( GetAttachParent() );
+    if ( AttachComponent && !AttachComponent->IsPendingKill() )
+        AttachComponent->NotifyParameterChanged( ChangedParameter );
+#endif
+
+    return true;
 }
 
 void
@@ -243,3 +274,5 @@ UHoudiniHandleComponent::PostEditUndo()
 }
 
 #endif // WITH_EDITOR
+
+#undef LOCTEXT_NAMESPACE
@@ -82,8 +82,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniHandleComponent : public USceneComponent
 
         void ResolveDuplicatedParameters( const TMap< HAPI_ParmId, UHoudiniAssetParameter * > & );
 
-        // Update HAPI transform handle parameters from the current ComponentToWorld Unreal transform
-        void UpdateTransformParameters();
+        // Update HAPI transform handle parameters from the current ComponentToWorld Unreal transform.
+        // All bound parameters are set at once and the asset is notified a single time, return true if any changed.
+        bool UpdateTransformParameters( bool bRecordUndo = true );
 
         static void AddReferencedObjects( UObject * InThis, FReferenceCollector & Collector );
 
@@ -168,6 +169,17 @@ class HOUDINIENGINERUNTIME_API UHoudiniHandleComponent : public USceneComponent
                     return DefaulValue;
                 }
 
+                /** Set the value without notifying the component, return true if it has changed. **/
+                template < typename VALUE >
+                bool SetWithoutNotify( VALUE Value, bool bRecordUndo )
+                {
+                    if ( !AssetParameter || Get< VALUE >( Value ) == Value )
+                        return false;
+
+                    AssetParameter->SetValue( Value, TupleIdx, false, bRecordUndo );
+                    return true;
+                }
+
                 template < typename VALUE >
                 THandleParameter & operator=( VALUE Value )
                 {
@@ -23,6 +23,7 @@
 
 #include "HoudiniApi.h"
 #include "Components/InstancedStaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "HoudiniInstancedActorComponent.h"
 #include "HoudiniMeshSplitInstancerComponent.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
@@ -54,6 +55,9 @@ UHoudiniInstancedActorComponent::Serialize( FArchive & Ar )
 
     Ar << InstancedAsset;
     Ar << Instances;
+
+    if ( Ar.IsLoading() )
+        InstancesAsset = InstancedAsset;
 }
 
 void 
@@ -77,17 +81,37 @@ UHoudiniInstancedActorComponent::SetInstances( const TArray<FTransform>& Instanc
     {
         const FScopedTransaction Transaction( LOCTEXT( "UpdateInstances", "Update Instances" ) );
         GetOwner()->Modify();
-        ClearInstances();
 
         if( InstancedAsset && !InstancedAsset->IsPendingKill() )
         {
-            for( const FTransform& InstanceTransform : InstanceTransforms )
+            // Actors spawned from another asset cannot be reused.
+            if ( InstancesAsset.Get() != InstancedAsset )
+                ClearInstances();
+
+            Instances.RemoveAll( []( const AActor* Instance ) { return !Instance || Instance->IsPendingKill(); } );
+
+            // Move the actors we already have, spawning is far more expensive.
+            int32 ReusedCount = FMath::Min( Instances.Num(), InstanceTransforms.Num() );
+            for ( int32 Idx = 0; Idx < ReusedCount; ++Idx )
             {
-                AddInstance( InstanceTransform );
+                AActor* Instance = Instances[ Idx ];
+                if ( !Instance->GetRootComponent()
+                    || !Instance->GetRootComponent()->GetRelativeTransform().Equals( InstanceTransforms[ Idx ] ) )
+                    Instance->SetActorRelativeTransform( InstanceTransforms[ Idx ] );
             }
+
+            for ( int32 Idx = Instances.Num() - 1; Idx >= InstanceTransforms.Num(); --Idx )
+                Instances[ Idx ]->Destroy();
+            Instances.SetNum( ReusedCount );
+
+            for ( int32 Idx = ReusedCount; Idx < InstanceTransforms.Num(); ++Idx )
+                AddInstance( InstanceTransforms[ Idx ] );
+
+            InstancesAsset = InstancedAsset;
         }
         else
         {
+            ClearInstances();
             HOUDINI_LOG_ERROR( TEXT( "%s: Null InstancedAsset for instanced actor override" ), *GetOwner()->GetName() );
         }
     }
@@ -187,10 +211,58 @@ void UHoudiniInstancedActorComponent::UpdateInstancerComponentInstances(
 
     if( ISMC && !ISMC->IsPendingKill() )
     {
-        ISMC->ClearInstances();
-        for(int32 InstanceIdx = 0; InstanceIdx < ProcessedTransforms.Num(); ++InstanceIdx)
+        // Hierarchical components would rebuild their cluster tree for every instance change,
+        // hold the rebuild until all instances are in and build it once on a worker thread.
+        UHierarchicalInstancedStaticMeshComponent* HISMC = Cast<UHierarchicalInstancedStaticMeshComponent>( ISMC );
+        bool bAutoRebuildTree = HISMC ? HISMC->bAutoRebuildTreeOnInstanceChanges : false;
+        if ( HISMC )
+            HISMC->bAutoRebuildTreeOnInstanceChanges = false;
+
+        // Only touch the instances that changed: update the moved ones, then append or remove the difference.
+        int32 OldInstanceCount = ISMC->GetInstanceCount();
+        int32 NewInstanceCount = ProcessedTransforms.Num();
+        int32 UpdatedInstanceCount = FMath::Min( OldInstanceCount, NewInstanceCount );
+        bool bInstancesChanged = OldInstanceCount != NewInstanceCount;
+
+        for ( int32 InstanceIdx = 0; InstanceIdx < UpdatedInstanceCount; ++InstanceIdx )
+        {
+            FTransform OldTransform;
+            if ( ISMC->GetInstanceTransform( InstanceIdx, OldTransform, false )
+                && OldTransform.Equals( ProcessedTransforms[ InstanceIdx ] ) )
+                continue;
+
+            ISMC->UpdateInstanceTransform( InstanceIdx, ProcessedTransforms[ InstanceIdx ], false, false, true );
+            bInstancesChanged = true;
+        }
+
+        if ( NewInstanceCount < OldInstanceCount )
+        {
+            if ( NewInstanceCount == 0 )
+            {
+                ISMC->ClearInstances();
+            }
+            else
+            {
+                // Remove from the end so the remaining indices stay valid.
+                for ( int32 InstanceIdx = OldInstanceCount - 1; InstanceIdx >= NewInstanceCount; --InstanceIdx )
+                    ISMC->RemoveInstance( InstanceIdx );
+            }
+        }
+        else
+        {
+            ISMC->PerInstanceSMData.Reserve( NewInstanceCount );
+            for ( int32 InstanceIdx = OldInstanceCount; InstanceIdx < NewInstanceCount; ++InstanceIdx )
+                ISMC->AddInstance( ProcessedTransforms[ InstanceIdx ] );
+        }
+
+        if ( bInstancesChanged )
+            ISMC->MarkRenderStateDirty();
+
+        if ( HISMC )
         {
-            ISMC->AddInstance(ProcessedTransforms[InstanceIdx]);
+            HISMC->bAutoRebuildTreeOnInstanceChanges = bAutoRebuildTree;
+            if ( bInstancesChanged )
+                HISMC->BuildTreeIfOutdated( true, true );
         }
     }
     else if( IAC && !IAC->IsPendingKill() )
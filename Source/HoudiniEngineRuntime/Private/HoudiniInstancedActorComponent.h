@@ -48,6 +48,7 @@ public:
     static void AddReferencedObjects( UObject * InThis, FReferenceCollector & Collector );
     
     /** Set the instances. Transforms are given in local space of this component. */
+    /** Actors already spawned from the same asset are reused and moved, only the difference is spawned or destroyed. */
     void SetInstances( const TArray<FTransform>& InstanceTransforms );
 
     /** Add an instance to this component. Transform is given in local space of this component. */
@@ -71,4 +72,9 @@ public:
     UPROPERTY( SkipSerialization, VisibleInstanceOnly, Category = Instances )
     TArray< AActor* > Instances;
 
+protected:
+
+    /** Asset the current instances were spawned from, they can only be reused for that asset. */
+    TWeakObjectPtr< UObject > InstancesAsset;
+
 };
@@ -47,12 +47,21 @@
 #include "LandscapeLayerInfoObject.h"
 #include "LightMap.h"
 #include "Engine/MapBuildDataRegistry.h"
+#include "Async/ParallelFor.h"
+#include "Async/Async.h"
 
 #if WITH_EDITOR
     #include "FileHelpers.h"
     #include "EngineUtils.h"
     #include "Editor/LandscapeEditor/Public/LandscapeEditorModule.h"
     #include "Editor/LandscapeEditor/Public/LandscapeFileFormatInterface.h"
+    #include "Async/MappedFileHandle.h"
+    #include "HAL/PlatformFilemanager.h"
+    #include "Misc/Compression.h"
+    #include "Misc/FileHelper.h"
+    #include "Misc/PackageName.h"
+    #include "Serialization/BufferArchive.h"
+    #include "Serialization/LargeMemoryReader.h"
 #endif
 
 void
@@ -202,6 +211,145 @@ FHoudiniLandscapeUtils::GetHeightfieldsLayersInArray(
     }
 }
 
+/** Z range of a volume, cached until its geo changes. **/
+/** Also stores the global range that was applied when the volume was last converted to a landscape. **/
+struct FHoudiniVolumeZRange
+{
+    HAPI_NodeId NodeId = -1;
+    FString VolumeName;
+    float Min = 0.0f;
+    float Max = 0.0f;
+    bool bHasAppliedRange = false;
+    float AppliedMin = 0.0f;
+    float AppliedMax = 0.0f;
+};
+
+/** Volume node ids are reused by the other sessions of the pool, so the ranges are cached by session. **/
+static TMap< TPair< int32, FHoudiniGeoPartObject >, FHoudiniVolumeZRange > HoudiniVolumeZRangeCache;
+
+/** Returns the key of a volume in the Z range cache, for the current session. **/
+static TPair< int32, FHoudiniGeoPartObject >
+GetVolumeZRangeKey( const FHoudiniGeoPartObject& Volume )
+{
+    return TPair< int32, FHoudiniGeoPartObject >( FHoudiniScopedSession::GetCurrentSessionIndex(), Volume );
+}
+
+/** Returns the name and Z range of a volume, only querying HAPI if the volume has changed since it was cached. **/
+static bool
+GetVolumeZRange( const FHoudiniGeoPartObject& Volume, FString& VolumeName, float& Min, float& Max )
+{
+    // Retrieve node id from geo part.
+    HAPI_NodeId NodeId = Volume.HapiGeoGetNodeId();
+    if ( NodeId == -1 )
+        return false;
+
+    FHoudiniVolumeZRange * CachedRange = HoudiniVolumeZRangeCache.Find( GetVolumeZRangeKey( Volume ) );
+    if ( CachedRange && CachedRange->NodeId == NodeId && !Volume.bHasGeoChanged )
+    {
+        VolumeName = CachedRange->VolumeName;
+        Min = CachedRange->Min;
+        Max = CachedRange->Max;
+        return true;
+    }
+
+    // Retrieve the VolumeInfo
+    HAPI_VolumeInfo CurrentVolumeInfo;
+    if ( HAPI_RESULT_SUCCESS != FHoudiniApi::GetVolumeInfo(
+        FHoudiniEngine::Get().GetSession(),
+        NodeId, Volume.PartId,
+        &CurrentVolumeInfo ) )
+        return false;
+
+    // Unreal's Z values are Y in Houdini
+    if ( HAPI_RESULT_SUCCESS != FHoudiniApi::GetVolumeBounds( FHoudiniEngine::Get().GetSession(),
+        NodeId, Volume.PartId,
+        nullptr, &Min, nullptr,
+        nullptr, &Max, nullptr,
+        nullptr, nullptr, nullptr ) )
+        return false;
+
+    // Retrieve the volume name.
+    FHoudiniEngineString HoudiniEngineStringPartName( CurrentVolumeInfo.nameSH );
+    HoudiniEngineStringPartName.ToFString( VolumeName );
+
+    // The volume changed, the range applied to its previous conversion doesn't apply anymore
+    FHoudiniVolumeZRange& NewRange = HoudiniVolumeZRangeCache.FindOrAdd( GetVolumeZRangeKey( Volume ) );
+    NewRange = FHoudiniVolumeZRange();
+    NewRange.NodeId = NodeId;
+    NewRange.VolumeName = VolumeName;
+    NewRange.Min = Min;
+    NewRange.Max = Max;
+
+    return true;
+}
+
+/** Returns true if Volume was last converted using the global range AppliedMin/AppliedMax. **/
+/** Volumes converted before the range was recorded are assumed to have used their own range. **/
+static bool
+IsVolumeAppliedZRangeUnchanged( const FHoudiniGeoPartObject& Volume, float AppliedMin, float AppliedMax )
+{
+    const FHoudiniVolumeZRange * CachedRange = HoudiniVolumeZRangeCache.Find( GetVolumeZRangeKey( Volume ) );
+    if ( !CachedRange || !CachedRange->bHasAppliedRange || CachedRange->NodeId != Volume.HapiGeoGetNodeId() )
+        return ( AppliedMin == 0.0f ) && ( AppliedMax == 0.0f );
+
+    return CachedRange->AppliedMin == AppliedMin && CachedRange->AppliedMax == AppliedMax;
+}
+
+/** Stores the global range used for converting Volume. **/
+static void
+SetVolumeAppliedZRange( const FHoudiniGeoPartObject& Volume, float AppliedMin, float AppliedMax )
+{
+    FHoudiniVolumeZRange * CachedRange = HoudiniVolumeZRangeCache.Find( GetVolumeZRangeKey( Volume ) );
+    if ( !CachedRange || CachedRange->NodeId != Volume.HapiGeoGetNodeId() )
+    {
+        // The volume hasn't been scanned, its own range was used
+        CachedRange = &HoudiniVolumeZRangeCache.FindOrAdd( GetVolumeZRangeKey( Volume ) );
+        *CachedRange = FHoudiniVolumeZRange();
+        CachedRange->NodeId = Volume.HapiGeoGetNodeId();
+    }
+
+    CachedRange->bHasAppliedRange = true;
+    CachedRange->AppliedMin = AppliedMin;
+    CachedRange->AppliedMax = AppliedMax;
+}
+
+/** Returns the global range applied to a layer, 0/0 when the layer is converted using its own range. **/
+static void
+GetLayerAppliedZRange(
+    const FHoudiniGeoPartObject& Layer,
+    const TMap< FString, float >& GlobalMinimums, const TMap< FString, float >& GlobalMaximums,
+    float& AppliedMin, float& AppliedMax )
+{
+    AppliedMin = 0.0f;
+    AppliedMax = 0.0f;
+
+    const FHoudiniVolumeZRange * CachedRange = HoudiniVolumeZRangeCache.Find( GetVolumeZRangeKey( Layer ) );
+    if ( !CachedRange || CachedRange->VolumeName.IsEmpty() )
+        return;
+
+    if ( const float * GlobalMin = GlobalMinimums.Find( CachedRange->VolumeName ) )
+        AppliedMin = *GlobalMin;
+
+    if ( const float * GlobalMax = GlobalMaximums.Find( CachedRange->VolumeName ) )
+        AppliedMax = *GlobalMax;
+}
+
+void
+FHoudiniLandscapeUtils::ReleaseVolumeZRanges( int32 SessionIndex, const TSet< HAPI_NodeId >& AssetIds )
+{
+    for ( auto Iter = HoudiniVolumeZRangeCache.CreateIterator(); Iter; ++Iter )
+    {
+        if ( Iter.Key().Key == SessionIndex && AssetIds.Contains( Iter.Key().Value.AssetId ) )
+            Iter.RemoveCurrent();
+    }
+}
+
+void
+FHoudiniLandscapeUtils::ClearVolumeZRanges()
+{
+    HoudiniVolumeZRangeCache.Empty();
+}
+
 void
 FHoudiniLandscapeUtils::CalcHeightfieldsArrayGlobalZMinZMax(
     const TArray< FHoudiniGeoPartObject > & InHeightfieldArray,
@@ -220,33 +368,12 @@ FHoudiniLandscapeUtils::CalcHeightfieldsArrayGlobalZMinZMax(
         if (!CurrentHeightfield->IsVolume())
             continue;
 
-        // Retrieve node id from geo part.
-        HAPI_NodeId NodeId = CurrentHeightfield->HapiGeoGetNodeId();
-        if (NodeId == -1)
-            continue;
-
-        // Retrieve the VolumeInfo
-        HAPI_VolumeInfo CurrentVolumeInfo;
-        if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetVolumeInfo(
-            FHoudiniEngine::Get().GetSession(),
-            NodeId, CurrentHeightfield->PartId,
-            &CurrentVolumeInfo))
-            continue;
-
-        // Unreal's Z values are Y in Houdini
+        // Get the volume's name and range, unchanged volumes are not queried again
+        FString VolumeName;
         float ymin, ymax;
-        if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetVolumeBounds(FHoudiniEngine::Get().GetSession(),
-            NodeId, CurrentHeightfield->PartId,
-            nullptr, &ymin, nullptr,
-            nullptr, &ymax, nullptr,
-            nullptr, nullptr, nullptr))
+        if ( !GetVolumeZRange( *CurrentHeightfield, VolumeName, ymin, ymax ) )
             continue;
 
-        // Retrieve the volume name.
-        FString VolumeName;
-        FHoudiniEngineString HoudiniEngineStringPartName(CurrentVolumeInfo.nameSH);
-        HoudiniEngineStringPartName.ToFString(VolumeName);
-
         // Read the global min value for this volume
         if ( !GlobalMinimums.Contains(VolumeName) )
         {
@@ -293,26 +420,10 @@ FHoudiniLandscapeUtils::CalcHeightfieldsArrayGlobalZMinZMax(
         if ( !CurrentHeightfield->IsVolume() )
             continue;
 
-        // Retrieve node id from geo part.
-        HAPI_NodeId NodeId = CurrentHeightfield->HapiGeoGetNodeId();
-        if ( NodeId == -1 )
-            continue;
-
-        // Retrieve the VolumeInfo
-        HAPI_VolumeInfo CurrentVolumeInfo;
-        if ( HAPI_RESULT_SUCCESS != FHoudiniApi::GetVolumeInfo(
-            FHoudiniEngine::Get().GetSession(),
-            NodeId, CurrentHeightfield->PartId,
-            &CurrentVolumeInfo ) )
-            continue;
-
-        // Unreal's Z values are Y in Houdini
+        // Get the volume's range, unchanged volumes are not queried again
+        FString VolumeName;
         float ymin, ymax;
-        if ( HAPI_RESULT_SUCCESS != FHoudiniApi::GetVolumeBounds( FHoudiniEngine::Get().GetSession(),
-            NodeId, CurrentHeightfield->PartId,
-            nullptr, &ymin, nullptr,
-            nullptr, &ymax, nullptr,
-            nullptr, nullptr, nullptr ) )
+        if ( !GetVolumeZRange( *CurrentHeightfield, VolumeName, ymin, ymax ) )
             continue;
 
         if ( ymin < fGlobalMin )
@@ -330,21 +441,72 @@ FHoudiniLandscapeUtils::CalcHeightfieldsArrayGlobalZMinZMax(
     }
 }
 
-bool FHoudiniLandscapeUtils::GetHeightfieldData(
-    const FHoudiniGeoPartObject& Heightfield,
-    TArray<float>& FloatValues,
-    HAPI_VolumeInfo& VolumeInfo,
-    float& FloatMin, float& FloatMax )
+/** Return the min and max of a float array, scanned in parallel chunks of SIMD registers. **/
+static void
+GetFloatArrayMinMax( const float * Values, int32 Count, float & OutMin, float & OutMax )
 {
-    FloatValues.Empty();
-    FloatMin = 0.0f;
-    FloatMax = 0.0f;
+    OutMin = Count > 0 ? Values[ 0 ] : 0.0f;
+    OutMax = OutMin;
+    if ( Count <= 0 )
+        return;
+
+    const int32 ChunkSize = HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS * 16;
+    const int32 NumChunks = FMath::DivideAndRoundUp( Count, ChunkSize );
+
+    TArray< float > ChunkMins;
+    TArray< float > ChunkMaxs;
+    ChunkMins.Init( OutMin, NumChunks );
+    ChunkMaxs.Init( OutMax, NumChunks );
+
+    ParallelFor( NumChunks, [ & ]( int32 ChunkIdx )
+    {
+        const int32 Start = ChunkIdx * ChunkSize;
+        const int32 End = FMath::Min( Start + ChunkSize, Count );
+
+        VectorRegister MinRegister = VectorSetFloat1( Values[ Start ] );
+        VectorRegister MaxRegister = MinRegister;
+
+        int32 Idx = Start;
+        for ( ; Idx + 4 <= End; Idx += 4 )
+        {
+            const VectorRegister Register = VectorLoad( Values + Idx );
+            MinRegister = VectorMin( MinRegister, Register );
+            MaxRegister = VectorMax( MaxRegister, Register );
+        }
+
+        float Mins[ 4 ];
+        float Maxs[ 4 ];
+        VectorStore( MinRegister, Mins );
+        VectorStore( MaxRegister, Maxs );
+
+        float ChunkMin = FMath::Min( FMath::Min( Mins[ 0 ], Mins[ 1 ] ), FMath::Min( Mins[ 2 ], Mins[ 3 ] ) );
+        float ChunkMax = FMath::Max( FMath::Max( Maxs[ 0 ], Maxs[ 1 ] ), FMath::Max( Maxs[ 2 ], Maxs[ 3 ] ) );
+        for ( ; Idx < End; ++Idx )
+        {
+            ChunkMin = FMath::Min( ChunkMin, Values[ Idx ] );
+            ChunkMax = FMath::Max( ChunkMax, Values[ Idx ] );
+        }
+
+        ChunkMins[ ChunkIdx ] = ChunkMin;
+        ChunkMaxs[ ChunkIdx ] = ChunkMax;
+    }, NumChunks < 2 );
+
+    for ( int32 ChunkIdx = 0; ChunkIdx < NumChunks; ++ChunkIdx )
+    {
+        OutMin = FMath::Min( OutMin, ChunkMins[ ChunkIdx ] );
+        OutMax = FMath::Max( OutMax, ChunkMaxs[ ChunkIdx ] );
+    }
+}
 
+/** Retrieve the node id and volume info of a heightfield, return false if it can't be converted to a landscape. **/
+static bool
+GetHeightfieldVolumeInfo( const FHoudiniGeoPartObject& Heightfield, HAPI_NodeId& NodeId, HAPI_VolumeInfo& VolumeInfo )
+{
     if ( !Heightfield.IsVolume() )
         return false;
 
     // Retrieve node id from geo part.
-    HAPI_NodeId NodeId = Heightfield.HapiGeoGetNodeId();
+    NodeId = Heightfield.HapiGeoGetNodeId();
     if ( NodeId == -1 )
         return false;
 
@@ -369,6 +531,78 @@ bool FHoudiniLandscapeUtils::GetHeightfieldData(
     if ( ( VolumeInfo.xLength < 2 ) || ( VolumeInfo.yLength < 2 ) )
         return false;
 
+    return true;
+}
+
+/** Read a heightfield's values one tile of whole Houdini rows at a time, so its whole float data is never held in memory. **/
+/** ProcessTile receives the values of NumRows rows of VolumeInfo.xLength values, starting at FirstRow. **/
+static bool
+ReadHeightfieldTiles(
+    const FHoudiniGeoPartObject& Heightfield, const HAPI_NodeId& NodeId, const HAPI_VolumeInfo& VolumeInfo,
+    TFunctionRef< void( const float * Values, int32 FirstRow, int32 NumRows ) > ProcessTile )
+{
+    const int32 RowSize = VolumeInfo.xLength;
+    const int32 NumRows = VolumeInfo.yLength;
+    const int32 RowsPerTile = FMath::Clamp( HAPI_UNREAL_HEIGHTFIELD_TILE_SAMPLES / RowSize, 1, NumRows );
+
+    TArray< float > TileValues;
+    TileValues.SetNumUninitialized( RowsPerTile * RowSize );
+    for ( int32 FirstRow = 0; FirstRow < NumRows; FirstRow += RowsPerTile )
+    {
+        const int32 TileRows = FMath::Min( RowsPerTile, NumRows - FirstRow );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetHeightFieldData(
+            FHoudiniEngine::Get().GetSession(),
+            NodeId, Heightfield.PartId,
+            TileValues.GetData(),
+            FirstRow * RowSize, TileRows * RowSize ), false );
+
+        ProcessTile( TileValues.GetData(), FirstRow, TileRows );
+    }
+
+    return true;
+}
+
+bool
+FHoudiniLandscapeUtils::GetHeightfieldMinMax(
+    const FHoudiniGeoPartObject& Heightfield,
+    HAPI_VolumeInfo& VolumeInfo,
+    float& FloatMin, float& FloatMax )
+{
+    FloatMin = 0.0f;
+    FloatMax = 0.0f;
+
+    HAPI_NodeId NodeId = -1;
+    if ( !GetHeightfieldVolumeInfo( Heightfield, NodeId, VolumeInfo ) )
+        return false;
+
+    bool bFirstTile = true;
+    return ReadHeightfieldTiles( Heightfield, NodeId, VolumeInfo,
+        [ & ]( const float * Values, int32 FirstRow, int32 NumRows )
+    {
+        float TileMin = 0.0f;
+        float TileMax = 0.0f;
+        GetFloatArrayMinMax( Values, NumRows * VolumeInfo.xLength, TileMin, TileMax );
+
+        FloatMin = bFirstTile ? TileMin : FMath::Min( FloatMin, TileMin );
+        FloatMax = bFirstTile ? TileMax : FMath::Max( FloatMax, TileMax );
+        bFirstTile = false;
+    } );
+}
+
+bool FHoudiniLandscapeUtils::GetHeightfieldData(
+    const FHoudiniGeoPartObject& Heightfield,
+    TArray<float>& FloatValues,
+    HAPI_VolumeInfo& VolumeInfo,
+    float& FloatMin, float& FloatMax )
+{
+    FloatValues.Empty();
+    FloatMin = 0.0f;
+    FloatMax = 0.0f;
+
+    HAPI_NodeId NodeId = -1;
+    if ( !GetHeightfieldVolumeInfo( Heightfield, NodeId, VolumeInfo ) )
+        return false;
+
     int32 SizeInPoints = VolumeInfo.xLength *  VolumeInfo.yLength;
     int32 TotalSize = SizeInPoints * VolumeInfo.tupleSize;
 
@@ -385,15 +619,7 @@ bool FHoudiniLandscapeUtils::GetHeightfieldData(
         0, SizeInPoints ), false );
 
     // We will need the min and max value for the conversion to uint16
-    FloatMin = FloatValues[0];
-    FloatMax = FloatMin;
-    for ( int32 n = 0; n < SizeInPoints; n++ )
-    {
-        if ( FloatValues[ n ] > FloatMax )
-            FloatMax = FloatValues[ n ];
-        else if ( FloatValues[ n ] < FloatMin )
-            FloatMin = FloatValues[ n ];
-    }
+    GetFloatArrayMinMax( FloatValues.GetData(), SizeInPoints, FloatMin, FloatMax );
 
     return true;
 }
@@ -490,9 +716,10 @@ FHoudiniLandscapeUtils::ConvertHeightfieldDataToLandscapeData(
     // For correct orientation in unreal, the point matrix has to be transposed.
     IntHeightData.SetNumUninitialized( SizeInPoints );
 
-    int32 nUnreal = 0;
-    for (int32 nY = 0; nY < HoudiniYSize; nY++)
+    // Rows are converted in parallel
+    ParallelFor( HoudiniYSize, [ & ]( int32 nY )
     {
+        int32 nUnreal = nY * HoudiniXSize;
         for (int32 nX = 0; nX < HoudiniXSize; nX++)
         {
             // Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
@@ -505,7 +732,7 @@ FHoudiniLandscapeUtils::ConvertHeightfieldDataToLandscapeData(
             DoubleValue = DoubleValue * ZSpacing + DigitCenterOffset;
             IntHeightData[nUnreal++] = FMath::RoundToInt(DoubleValue);
         }
-    }
+    }, SizeInPoints < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
 
     //--------------------------------------------------------------------------------------------------
     // 2. Resample / Pad the int data so that if fits unreal size requirements
@@ -586,37 +813,81 @@ FHoudiniLandscapeUtils::ConvertHeightfieldDataToLandscapeData(
     return true;
 }
 
-bool FHoudiniLandscapeUtils::ConvertHeightfieldLayerToLandscapeLayer(
-    const TArray<float>& FloatLayerData,
-    const int32& HoudiniXSize, const int32& HoudiniYSize,
-    const float& LayerMin, const float& LayerMax,
-    const int32& LandscapeXSize, const int32& LandscapeYSize,
-    TArray<uint8>& LayerData, const bool& NoResize )
+/** Convert the float values of NumColumns Houdini rows, starting at FirstColumn, to Unreal's uint8 layer values. **/
+/** The layer data is transposed, each Houdini row is a column of the Unreal layer. **/
+static void
+ConvertHeightfieldLayerTile(
+    const float * FloatLayerData, int32 FirstColumn, int32 NumColumns,
+    int32 HoudiniXSize, int32 HoudiniYSize,
+    float LayerMin, float LayerMax, TArray< uint8 >& LayerData )
 {
-    // Convert the float data to uint8
-    LayerData.SetNumUninitialized( HoudiniXSize * HoudiniYSize );
-
     // Calculating the factor used to convert from Houdini's ZRange to [0 255]
     double LayerZRange = ( LayerMax - LayerMin );
     double LayerZSpacing = ( LayerZRange != 0.0 ) ? ( 255.0 / (double)( LayerZRange ) ) : 0.0;
 
-    int32 nUnrealIndex = 0;
-    for ( int32 nY = 0; nY < HoudiniYSize; nY++ )
+    // Columns are converted in parallel
+    ParallelFor( NumColumns, [ & ]( int32 nColumn )
     {
-        for ( int32 nX = 0; nX < HoudiniXSize; nX++ )
+        const int32 nX = FirstColumn + nColumn;
+        const float * ColumnData = FloatLayerData + nColumn * HoudiniYSize;
+        for ( int32 nY = 0; nY < HoudiniYSize; nY++ )
         {
             // Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
-            int32 nHoudini = nY + nX * HoudiniYSize;
-
             // Get the double values in [0 - ZRange]
-            double DoubleValue = (double)FMath::Clamp(FloatLayerData[ nHoudini ], LayerMin, LayerMax) - (double)LayerMin;
+            double DoubleValue = (double)FMath::Clamp( ColumnData[ nY ], LayerMin, LayerMax ) - (double)LayerMin;
 
             // Then convert it to [0 - 255]
             DoubleValue *= LayerZSpacing;
 
-            LayerData[ nUnrealIndex++ ] = FMath::RoundToInt( DoubleValue );
+            LayerData[ nY * HoudiniXSize + nX ] = FMath::RoundToInt( DoubleValue );
         }
-    }
+    }, NumColumns * HoudiniYSize < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
+}
+
+bool FHoudiniLandscapeUtils::ConvertHeightfieldLayerToLandscapeLayer(
+    const TArray<float>& FloatLayerData,
+    const int32& HoudiniXSize, const int32& HoudiniYSize,
+    const float& LayerMin, const float& LayerMax,
+    const int32& LandscapeXSize, const int32& LandscapeYSize,
+    TArray<uint8>& LayerData, const bool& NoResize )
+{
+    // Convert the float data to uint8
+    LayerData.SetNumUninitialized( HoudiniXSize * HoudiniYSize );
+    ConvertHeightfieldLayerTile( FloatLayerData.GetData(), 0, HoudiniXSize, HoudiniXSize, HoudiniYSize, LayerMin, LayerMax, LayerData );
+
+    // Finally, resize the data to fit with the new landscape size if needed
+    if ( NoResize )
+        return true;
+
+    return FHoudiniLandscapeUtils::ResizeLayerDataForLandscape(
+        LayerData, HoudiniXSize, HoudiniYSize,
+        LandscapeXSize, LandscapeYSize );
+}
+
+bool
+FHoudiniLandscapeUtils::GetHeightfieldLayerAsLandscapeLayer(
+    const FHoudiniGeoPartObject& LayerGeoPartObject,
+    const float& LayerMin, const float& LayerMax,
+    const int32& LandscapeXSize, const int32& LandscapeYSize,
+    TArray< uint8 >& LayerData, const bool& NoResize )
+{
+    HAPI_NodeId NodeId = -1;
+    HAPI_VolumeInfo LayerVolumeInfo;
+    if ( !GetHeightfieldVolumeInfo( LayerGeoPartObject, NodeId, LayerVolumeInfo ) )
+        return false;
+
+    // HF masks need their X/Y sizes swapped
+    const int32 HoudiniXSize = LayerVolumeInfo.yLength;
+    const int32 HoudiniYSize = LayerVolumeInfo.xLength;
+    LayerData.SetNumUninitialized( HoudiniXSize * HoudiniYSize );
+
+    // Each tile is converted before the next one is read
+    if ( !ReadHeightfieldTiles( LayerGeoPartObject, NodeId, LayerVolumeInfo,
+        [ & ]( const float * Values, int32 FirstRow, int32 NumRows )
+    {
+        ConvertHeightfieldLayerTile( Values, FirstRow, NumRows, HoudiniXSize, HoudiniYSize, LayerMin, LayerMax, LayerData );
+    } ) )
+        return false;
 
     // Finally, resize the data to fit with the new landscape size if needed
     if ( NoResize )
@@ -772,6 +1043,137 @@ TArray<T> ExpandData(const TArray<T>& Data,
     return Result;
 }
 
+/** Source samples and weights contributing to each resampled coordinate along one axis. **/
+struct FHoudiniLandscapeResampleAxis
+{
+    int32 NumTaps = 0;
+    TArray< int32 > Indices;
+    TArray< float > Weights;
+};
+
+static void
+BuildLandscapeResampleAxis(
+    int32 OldSize, int32 NewSize,
+    EHoudiniRuntimeSettingsLandscapeResampleFilter Filter,
+    FHoudiniLandscapeResampleAxis& Axis )
+{
+    Axis.NumTaps = ( Filter == HRSLRF_Nearest ) ? 1 : ( Filter == HRSLRF_Bicubic ) ? 4 : 2;
+    Axis.Indices.SetNumUninitialized( NewSize * Axis.NumTaps );
+    Axis.Weights.SetNumUninitialized( NewSize * Axis.NumTaps );
+
+    const float Scale = ( NewSize > 1 ) ? (float)( OldSize - 1 ) / ( NewSize - 1 ) : 0.0f;
+    for ( int32 NewIdx = 0; NewIdx < NewSize; ++NewIdx )
+    {
+        const float OldPos = NewIdx * Scale;
+        const int32 Old0 = FMath::Min( FMath::FloorToInt( OldPos ), OldSize - 1 );
+        const float T = FMath::Fractional( OldPos );
+
+        int32 * Indices = &Axis.Indices[ NewIdx * Axis.NumTaps ];
+        float * Weights = &Axis.Weights[ NewIdx * Axis.NumTaps ];
+        if ( Filter == HRSLRF_Nearest )
+        {
+            Indices[ 0 ] = FMath::Min( FMath::RoundToInt( OldPos ), OldSize - 1 );
+            Weights[ 0 ] = 1.0f;
+        }
+        else if ( Filter == HRSLRF_Bicubic )
+        {
+            // Catmull-Rom weights for the samples at Old0 - 1 .. Old0 + 2
+            Weights[ 0 ] = ( ( -T + 2.0f ) * T - 1.0f ) * T * 0.5f;
+            Weights[ 1 ] = ( ( 3.0f * T - 5.0f ) * T * T + 2.0f ) * 0.5f;
+            Weights[ 2 ] = ( ( -3.0f * T + 4.0f ) * T + 1.0f ) * T * 0.5f;
+            Weights[ 3 ] = ( T - 1.0f ) * T * T * 0.5f;
+            for ( int32 Tap = 0; Tap < 4; ++Tap )
+                Indices[ Tap ] = FMath::Clamp( Old0 - 1 + Tap, 0, OldSize - 1 );
+        }
+        else
+        {
+            Indices[ 0 ] = Old0;
+            Indices[ 1 ] = FMath::Min( Old0 + 1, OldSize - 1 );
+            Weights[ 0 ] = 1.0f - T;
+            Weights[ 1 ] = T;
+        }
+    }
+}
+
+/** Resamples several layers of identical size at once, the filter taps are computed once for all of them. **/
+/** The filter is applied separably: rows are first resampled to NewWidth, then columns to NewHeight. **/
+template< typename T >
+void ResampleLayersData(
+    const TArray< const T * >& InLayers, const TArray< T * >& OutLayers,
+    int32 OldWidth, int32 OldHeight, int32 NewWidth, int32 NewHeight,
+    EHoudiniRuntimeSettingsLandscapeResampleFilter Filter )
+{
+    const int32 NumLayers = InLayers.Num();
+    if ( NumLayers <= 0 || OutLayers.Num() != NumLayers )
+        return;
+
+    FHoudiniLandscapeResampleAxis AxisX;
+    FHoudiniLandscapeResampleAxis AxisY;
+    BuildLandscapeResampleAxis( OldWidth, NewWidth, Filter, AxisX );
+    BuildLandscapeResampleAxis( OldHeight, NewHeight, Filter, AxisY );
+
+    // Horizontal pass, each source row is resampled to NewWidth float values
+    // Keeping the intermediate values as floats avoids rounding them twice
+    TArray< float > RowsData;
+    RowsData.SetNumUninitialized( NumLayers * OldHeight * NewWidth );
+    ParallelFor( NumLayers * OldHeight, [ & ]( int32 RowIdx )
+    {
+        const T * InRow = InLayers[ RowIdx / OldHeight ] + ( RowIdx % OldHeight ) * OldWidth;
+        float * OutRow = RowsData.GetData() + RowIdx * NewWidth;
+        const int32 * Indices = AxisX.Indices.GetData();
+        const float * Weights = AxisX.Weights.GetData();
+        for ( int32 X = 0; X < NewWidth; ++X )
+        {
+            float Value = 0.0f;
+            for ( int32 Tap = 0; Tap < AxisX.NumTaps; ++Tap )
+                Value += Weights[ Tap ] * (float)InRow[ Indices[ Tap ] ];
+
+            OutRow[ X ] = Value;
+            Indices += AxisX.NumTaps;
+            Weights += AxisX.NumTaps;
+        }
+    }, NumLayers * OldHeight * NewWidth < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
+
+    // Vertical pass, every output value of a row uses the same source rows and weights so it is vectorized
+    const float MaxValue = (float)TNumericLimits< T >::Max();
+    ParallelFor( NumLayers * NewHeight, [ & ]( int32 RowIdx )
+    {
+        const int32 LayerIdx = RowIdx / NewHeight;
+        const int32 Y = RowIdx % NewHeight;
+        const float * LayerRows = RowsData.GetData() + LayerIdx * OldHeight * NewWidth;
+        const int32 * Indices = &AxisY.Indices[ Y * AxisY.NumTaps ];
+        const float * Weights = &AxisY.Weights[ Y * AxisY.NumTaps ];
+        T * OutRow = OutLayers[ LayerIdx ] + Y * NewWidth;
+
+        const VectorRegister Zero = VectorZero();
+        const VectorRegister Max = VectorSetFloat1( MaxValue );
+        int32 X = 0;
+        for ( ; X + 4 <= NewWidth; X += 4 )
+        {
+            VectorRegister Sum = Zero;
+            for ( int32 Tap = 0; Tap < AxisY.NumTaps; ++Tap )
+                Sum = VectorMultiplyAdd( VectorLoad( LayerRows + Indices[ Tap ] * NewWidth + X ), VectorSetFloat1( Weights[ Tap ] ), Sum );
+
+            // The bicubic filter can overshoot the source range
+            Sum = VectorMin( VectorMax( Sum, Zero ), Max );
+
+            float Values[ 4 ];
+            VectorStore( Sum, Values );
+            for ( int32 Idx = 0; Idx < 4; ++Idx )
+                OutRow[ X + Idx ] = (T)FMath::RoundToInt( Values[ Idx ] );
+        }
+
+        for ( ; X < NewWidth; ++X )
+        {
+            float Value = 0.0f;
+            for ( int32 Tap = 0; Tap < AxisY.NumTaps; ++Tap )
+                Value += Weights[ Tap ] * LayerRows[ Indices[ Tap ] * NewWidth + X ];
+
+            OutRow[ X ] = (T)FMath::RoundToInt( FMath::Clamp( Value, 0.0f, MaxValue ) );
+        }
+    }, NumLayers * NewHeight * NewWidth < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
+}
+
 template<typename T>
 TArray<T> ResampleData( const TArray<T>& Data, int32 OldWidth, int32 OldHeight, int32 NewWidth, int32 NewHeight )
 {
@@ -779,25 +1181,15 @@ TArray<T> ResampleData( const TArray<T>& Data, int32 OldWidth, int32 OldHeight,
     Result.Empty( NewWidth * NewHeight );
     Result.AddUninitialized( NewWidth * NewHeight );
 
-    const float XScale = (float)( OldWidth - 1 ) / ( NewWidth - 1 );
-    const float YScale = (float)( OldHeight - 1 ) / ( NewHeight - 1 );
-    for ( int32 Y = 0; Y < NewHeight; ++Y )
-    {
-        for ( int32 X = 0; X < NewWidth; ++X )
-        {
-            const float OldY = Y * YScale;
-            const float OldX = X * XScale;
-            const int32 X0 = FMath::FloorToInt( OldX );
-            const int32 X1 = FMath::Min( FMath::FloorToInt( OldX ) + 1, OldWidth - 1 );
-            const int32 Y0 = FMath::FloorToInt( OldY );
-            const int32 Y1 = FMath::Min( FMath::FloorToInt( OldY ) + 1, OldHeight - 1 );
-            const T& Original00 = Data[ Y0 * OldWidth + X0 ];
-            const T& Original10 = Data[ Y0 * OldWidth + X1 ];
-            const T& Original01 = Data[ Y1 * OldWidth + X0 ];
-            const T& Original11 = Data[ Y1 * OldWidth + X1 ];
-            Result[ Y * NewWidth + X ] = FMath::BiLerp( Original00, Original10, Original01, Original11, FMath::Fractional( OldX ), FMath::Fractional( OldY ) );
-        }
-    }
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    EHoudiniRuntimeSettingsLandscapeResampleFilter Filter = HoudiniRuntimeSettings ?
+        HoudiniRuntimeSettings->MarshallingLandscapesResampleFilter.GetValue() : HRSLRF_Bilinear;
+
+    TArray< const T * > InLayers;
+    InLayers.Add( Data.GetData() );
+    TArray< T * > OutLayers;
+    OutLayers.Add( Result.GetData() );
+    ResampleLayersData( InLayers, OutLayers, OldWidth, OldHeight, NewWidth, NewHeight, Filter );
 
     return Result;
 }
@@ -964,92 +1356,281 @@ FHoudiniLandscapeUtils::ResizeHeightDataForLandscape(
         int32 PadOffsetX = 0;
         int32 PadOffsetY = 0;
 
-        // Expanding the Data
-        NewData = ExpandData(
-            HeightData, 0, 0, SizeX - 1, SizeY - 1,
-            -OffsetX, -OffsetY, NewSizeX - OffsetX - 1, NewSizeY - OffsetY - 1,
-            &PadOffsetX, &PadOffsetY );
+        // Expanding the Data
+        NewData = ExpandData(
+            HeightData, 0, 0, SizeX - 1, SizeY - 1,
+            -OffsetX, -OffsetY, NewSizeX - OffsetX - 1, NewSizeY - OffsetY - 1,
+            &PadOffsetX, &PadOffsetY );
+
+        // We will need to offset the landscape position due to the value added by the padding
+        LandscapePositionOffset.X = (float)PadOffsetX;
+        LandscapePositionOffset.Y = (float)PadOffsetY;
+
+        // Notify the user that the data was padded
+        HOUDINI_LOG_WARNING(
+            TEXT("Landscape data was padded from ( %d x %d ) to ( %d x %d )."),
+            SizeX, SizeY, NewSizeX, NewSizeY );
+    }
+    else
+    {
+        // Resampling the data
+        NewData = ResampleData( HeightData, SizeX, SizeY, NewSizeX, NewSizeY );
+
+        // The landscape has been resized, we'll need to take that into account when sizing it
+        LandscapeResizeFactor.X = (float)SizeX / (float)NewSizeX;
+        LandscapeResizeFactor.Y = (float)SizeY / (float)NewSizeY;
+        LandscapeResizeFactor.Z = 1.0f;
+
+        // Notify the user if the heightfield data was resized
+        HOUDINI_LOG_WARNING(
+            TEXT("Landscape data was resized from ( %d x %d ) to ( %d x %d )."),
+            SizeX, SizeY, NewSizeX, NewSizeY );
+    }
+
+    // Replaces Old data with the new one
+    HeightData = MoveTemp( NewData );
+
+    return true;
+}
+
+bool
+FHoudiniLandscapeUtils::ResizeLayerDataForLandscape(
+    TArray< uint8 >& LayerData,
+    const int32& SizeX, const int32& SizeY,
+    const int32& NewSizeX, const int32& NewSizeY )
+{
+    TArray< TArray< uint8 > * > Layers;
+    Layers.Add( &LayerData );
+
+    return ResizeLayersDataForLandscape( Layers, SizeX, SizeY, NewSizeX, NewSizeY );
+}
+
+bool
+FHoudiniLandscapeUtils::ResizeLayersDataForLandscape(
+    const TArray< TArray< uint8 > * >& Layers,
+    const int32& SizeX, const int32& SizeY,
+    const int32& NewSizeX, const int32& NewSizeY )
+{
+    if ( ( NewSizeX == SizeX ) && ( NewSizeY == SizeY ) )
+        return true; 
+
+    bool bForceResample = false;
+    bool bResample = bForceResample ? true : ( ( NewSizeX <= SizeX ) && ( NewSizeY <= SizeY ) );
+
+    if (!bResample)
+    {
+        const int32 OffsetX = (int32)( NewSizeX - SizeX ) / 2;
+        const int32 OffsetY = (int32)( NewSizeY - SizeY ) / 2;
+
+        // Expanding the Data
+        for ( TArray< uint8 > * LayerData : Layers )
+        {
+            *LayerData = ExpandData(
+                *LayerData,
+                0, 0, SizeX - 1, SizeY - 1,
+                -OffsetX, -OffsetY, NewSizeX - OffsetX - 1, NewSizeY - OffsetY - 1 );
+        }
+
+        return true;
+    }
+
+    // Resampling all the layers in a single pass
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    EHoudiniRuntimeSettingsLandscapeResampleFilter Filter = HoudiniRuntimeSettings ?
+        HoudiniRuntimeSettings->MarshallingLandscapesResampleFilter.GetValue() : HRSLRF_Bilinear;
+
+    TArray< TArray< uint8 > > NewData;
+    NewData.SetNum( Layers.Num() );
+
+    TArray< const uint8 * > InLayers;
+    TArray< uint8 * > OutLayers;
+    for ( int32 LayerIdx = 0; LayerIdx < Layers.Num(); LayerIdx++ )
+    {
+        NewData[ LayerIdx ].SetNumUninitialized( NewSizeX * NewSizeY );
+        InLayers.Add( Layers[ LayerIdx ]->GetData() );
+        OutLayers.Add( NewData[ LayerIdx ].GetData() );
+    }
+
+    ResampleLayersData( InLayers, OutLayers, SizeX, SizeY, NewSizeX, NewSizeY, Filter );
+
+    // Replaces Old data with the new one
+    for ( int32 LayerIdx = 0; LayerIdx < Layers.Num(); LayerIdx++ )
+        *Layers[ LayerIdx ] = MoveTemp( NewData[ LayerIdx ] );
+
+    return true;
+}
+
+// Returns the values used to convert the landscape's uint16 heights to Houdini's metric values
+static void
+GetLandscapeHeightConversion(
+    const FTransform& LandscapeTransform,
+    double& ZSpacing, double& ZCenterOffset, double& ZPositionOffset )
+{
+    // Unreal's landscape uses 16bits precision and range from -256m to 256m with the default scale of 100.0
+    // To convert the uint16 values to float "metric" values, offset the int by 32768 to center it,
+    // then scale it
+
+    // Spacing used to convert from uint16 to meters
+    ZSpacing = 512.0 / ((double)UINT16_MAX);
+    ZSpacing *= ( (double)LandscapeTransform.GetScale3D().Z / 100.0 );
+
+    // Center value in meters (Landscape ranges from [-255:257] meters at default scale
+    ZCenterOffset = 32767;
+    ZPositionOffset = LandscapeTransform.GetLocation().Z / 100.0f;
+}
+
+// Returns the values used to convert a layer's uint8 values to Houdini's float values
+static void
+GetLandscapeLayerConversion(
+    const TArray<uint8>& IntLayerData,
+    const FLinearColor& LayerUsageDebugColor,
+    uint8& IntMin, uint8& IntMax,
+    float& LayerMin, float& LayerSpacing )
+{
+    // We need the ZMin / ZMax unt8 values
+    IntMin = IntLayerData.Num() > 0 ? IntLayerData[ 0 ] : 0;
+    IntMax = IntMin;
+
+    for ( int n = 0; n < IntLayerData.Num(); n++ )
+    {
+        if ( IntLayerData[ n ] < IntMin )
+            IntMin = IntLayerData[ n ];
+        if ( IntLayerData[ n ] > IntMax )
+            IntMax = IntLayerData[ n ];
+    }
+
+    // The range in Digits
+    double DigitRange = (double)IntMax - (double)IntMin;
+
+    // By default, the values will be converted to [0, 1]
+    LayerMin = 0.0f;
+    float LayerMax = 1.0f;
+    LayerSpacing = 1.0f / DigitRange;
+
+    // If this layer came from Houdini, its alpha value should be PI
+    // So we can extract the additionnal infos stored its debug usage color
+    if ( LayerUsageDebugColor.A == PI )
+    {
+        LayerMin = LayerUsageDebugColor.R;
+        LayerMax = LayerUsageDebugColor.G;
+        LayerSpacing = LayerUsageDebugColor.B;
+    }
+
+    LayerSpacing = ( LayerMax - LayerMin ) / DigitRange;
+}
 
-        // We will need to offset the landscape position due to the value added by the padding
-        LandscapePositionOffset.X = (float)PadOffsetX;
-        LandscapePositionOffset.Y = (float)PadOffsetY;
+#if WITH_EDITOR
+// A landscape layer extracted on the game thread, and converted to heightfield values on a worker thread
+struct FHoudiniLandscapeLayerUpload
+{
+    FHoudiniLandscapeLayerUpload()
+        : LayerIndex( -1 )
+        , bConverted( false )
+    {}
 
-        // Notify the user that the data was padded
-        HOUDINI_LOG_WARNING(
-            TEXT("Landscape data was padded from ( %d x %d ) to ( %d x %d )."),
-            SizeX, SizeY, NewSizeX, NewSizeY );
-    }
-    else
+    // The conversion must be done before the buffers it writes to are released
+    ~FHoudiniLandscapeLayerUpload()
     {
-        // Resampling the data
-        NewData.SetNumUninitialized( NewSizeX * NewSizeY );
-        NewData = ResampleData( HeightData, SizeX, SizeY, NewSizeX, NewSizeY );
+        if ( Future.IsValid() )
+            Future.Wait();
+    }
 
-        // The landscape has been resized, we'll need to take that into account when sizing it
-        LandscapeResizeFactor.X = (float)SizeX / (float)NewSizeX;
-        LandscapeResizeFactor.Y = (float)SizeY / (float)NewSizeY;
-        LandscapeResizeFactor.Z = 1.0f;
+    // Wait for the conversion, returns false if the layer could not be extracted or converted
+    bool Finish()
+    {
+        if ( Future.IsValid() )
+            Future.Wait();
 
-        // Notify the user if the heightfield data was resized
-        HOUDINI_LOG_WARNING(
-            TEXT("Landscape data was resized from ( %d x %d ) to ( %d x %d )."),
-            SizeX, SizeY, NewSizeX, NewSizeY );
+        return bConverted;
     }
 
-    // Replaces Old data with the new one
-    HeightData = NewData;
+    int32 LayerIndex;
+    TArray<uint8> IntData;
+    FLinearColor LayerUsageDebugColor;
+    FString LayerName;
 
-    return true;
+    TArray<float> FloatData;
+    HAPI_VolumeInfo VolumeInfo;
+    bool bConverted;
+
+    TFuture<void> Future;
+};
+
+// Extracts a layer of the landscape and starts its conversion,
+// so it can be converted while the previous layer is sent to the session
+static TUniquePtr<FHoudiniLandscapeLayerUpload>
+StartLandscapeLayerUpload(
+    ULandscapeInfo* LandscapeInfo, const int32& LayerIndex,
+    const int32& MinX, const int32& MinY, const int32& MaxX, const int32& MaxY,
+    const int32& XSize, const int32& YSize )
+{
+    TUniquePtr<FHoudiniLandscapeLayerUpload> Layer = MakeUnique<FHoudiniLandscapeLayerUpload>();
+    Layer->LayerIndex = LayerIndex;
+
+    // Reading the weightmaps is only possible on the game thread
+    if ( !FHoudiniLandscapeUtils::GetLandscapeLayerData(
+        LandscapeInfo, LayerIndex, MinX, MinY, MaxX, MaxY,
+        Layer->IntData, Layer->LayerUsageDebugColor, Layer->LayerName ) )
+        return Layer;
+
+    // If the layer came from Houdini, additional info might have been stored in the DebugColor to convert the data back to float
+    FHoudiniLandscapeLayerUpload* LayerPtr = Layer.Get();
+    Layer->Future = Async< void >( EAsyncExecution::ThreadPool, [ LayerPtr, XSize, YSize ]()
+    {
+        LayerPtr->bConverted = FHoudiniLandscapeUtils::ConvertLandscapeLayerDataToHeightfieldData(
+            LayerPtr->IntData, XSize, YSize, LayerPtr->LayerUsageDebugColor,
+            LayerPtr->FloatData, LayerPtr->VolumeInfo );
+    } );
+
+    return Layer;
 }
 
-bool
-FHoudiniLandscapeUtils::ResizeLayerDataForLandscape(
-    TArray< uint8 >& LayerData,
-    const int32& SizeX, const int32& SizeY,
-    const int32& NewSizeX, const int32& NewSizeY )
+// Sets the values of a rectangle of a heightfield volume, values are ordered as in the volume
+static bool
+SetHeightfieldDataRect(
+    const HAPI_NodeId& VolumeNodeId, const FString& VolumeName,
+    const TArray<float>& FloatValues, const int32& VolumeXSize,
+    const int32& RectX, const int32& RectY, const int32& RectXSize, const int32& RectYSize )
 {
-    if ( ( NewSizeX == SizeX ) && ( NewSizeY == SizeY ) )
-        return true; 
+    if ( FloatValues.Num() != RectXSize * RectYSize )
+        return false;
 
-    bool bForceResample = false;
-    bool bResample = bForceResample ? true : ( ( NewSizeX <= SizeX ) && ( NewSizeY <= SizeY ) );
+    std::string NameStr;
+    FHoudiniEngineUtils::ConvertUnrealString( VolumeName, NameStr );
 
-    TArray<uint8> NewData;
-    if (!bResample)
+    // Rows covering the whole volume are contiguous and can be sent at once
+    if ( RectX == 0 && RectXSize == VolumeXSize )
     {
-        NewData.SetNumUninitialized( NewSizeX * NewSizeY );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetHeightFieldData(
+            FHoudiniEngine::Get().GetSession(), VolumeNodeId, 0, NameStr.c_str(),
+            FloatValues.GetData(), RectY * VolumeXSize, FloatValues.Num() ), false );
 
-        const int32 OffsetX = (int32)( NewSizeX - SizeX ) / 2;
-        const int32 OffsetY = (int32)( NewSizeY - SizeY ) / 2;
-
-        // Expanding the Data
-        NewData = ExpandData(
-            LayerData,
-            0, 0, SizeX - 1, SizeY - 1,
-            -OffsetX, -OffsetY, NewSizeX - OffsetX - 1, NewSizeY - OffsetY - 1 );
+        return true;
     }
-    else
+
+    for ( int32 Row = 0; Row < RectYSize; Row++ )
     {
-        // Resampling the data
-        NewData.SetNumUninitialized( NewSizeX * NewSizeY );
-        NewData = ResampleData( LayerData, SizeX, SizeY, NewSizeX, NewSizeY );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetHeightFieldData(
+            FHoudiniEngine::Get().GetSession(), VolumeNodeId, 0, NameStr.c_str(),
+            FloatValues.GetData() + Row * RectXSize, RectX + ( RectY + Row ) * VolumeXSize, RectXSize ), false );
     }
 
-    LayerData = NewData;
-
     return true;
 }
 
-#if WITH_EDITOR
 bool
 FHoudiniLandscapeUtils::CreateHeightfieldFromLandscape(
-    ALandscapeProxy* LandscapeProxy, HAPI_NodeId& CreatedHeightfieldNodeId )
+    ALandscapeProxy* LandscapeProxy, HAPI_NodeId& CreatedHeightfieldNodeId,
+    FHoudiniLandscapeHeightfieldInput* OutHeightfieldInput )
 {
     if ( !LandscapeProxy )
         return false;
 
     // Export the whole landscape and its layer as a single heightfield
 
+    if ( OutHeightfieldInput )
+        OutHeightfieldInput->Reset();
+
     //--------------------------------------------------------------------------------------------------
     // 1. Extracting the height data
     //--------------------------------------------------------------------------------------------------
@@ -1105,27 +1686,37 @@ FHoudiniLandscapeUtils::CreateHeightfieldFromLandscape(
     if ( !LandscapeInfo )
         return false;
 
+    int32 LayerMinX = MAX_int32;
+    int32 LayerMinY = MAX_int32;
+    int32 LayerMaxX = -MAX_int32;
+    int32 LayerMaxY = -MAX_int32;
+    bool bHasLayerExtent = LandscapeInfo->GetLandscapeExtent( LayerMinX, LayerMinY, LayerMaxX, LayerMaxY );
+
     bool MaskInitialized = false;
     int32 MergeInputIndex = 2;
-    int32 NumLayers = LandscapeInfo->Layers.Num();
+    int32 NumLayers = bHasLayerExtent ? LandscapeInfo->Layers.Num() : 0;
+
+    // 1. Extract the uint8 values from the first layer, and start converting them to float
+    TUniquePtr<FHoudiniLandscapeLayerUpload> NextLayer;
+    if ( NumLayers > 0 )
+        NextLayer = StartLandscapeLayerUpload( LandscapeInfo, 0, LayerMinX, LayerMinY, LayerMaxX, LayerMaxY, XSize, YSize );
+
     for ( int32 n = 0; n < NumLayers; n++ )
     {
-        // 1. Extract the uint8 values from the layer
-        TArray<uint8> CurrentLayerIntData;
-        FLinearColor LayerUsageDebugColor;
-        FString LayerName;
-        if ( !GetLandscapeLayerData( LandscapeInfo, n, CurrentLayerIntData, LayerUsageDebugColor, LayerName ) )
-            continue;
+        // 2. The next layer is converted while this one is sent to the session
+        TUniquePtr<FHoudiniLandscapeLayerUpload> CurrentLayer = MoveTemp( NextLayer );
+        if ( n + 1 < NumLayers )
+            NextLayer = StartLandscapeLayerUpload( LandscapeInfo, n + 1, LayerMinX, LayerMinY, LayerMaxX, LayerMaxY, XSize, YSize );
 
-        // 2. Convert unreal uint8 values to floats
-        // If the layer came from Houdini, additional info might have been stored in the DebugColor to convert the data back to float
-        HAPI_VolumeInfo CurrentLayerVolumeInfo;
-        TArray < float > CurrentLayerFloatData;
-        if ( !ConvertLandscapeLayerDataToHeightfieldData(
-            CurrentLayerIntData, XSize, YSize, LayerUsageDebugColor,
-            CurrentLayerFloatData, CurrentLayerVolumeInfo ) )
+        if ( !CurrentLayer->Finish() )
             continue;
 
+        const TArray<uint8>& CurrentLayerIntData = CurrentLayer->IntData;
+        const FLinearColor& LayerUsageDebugColor = CurrentLayer->LayerUsageDebugColor;
+        const FString& LayerName = CurrentLayer->LayerName;
+        HAPI_VolumeInfo& CurrentLayerVolumeInfo = CurrentLayer->VolumeInfo;
+        TArray < float >& CurrentLayerFloatData = CurrentLayer->FloatData;
+
         // We reuse the height layer's transform
         CurrentLayerVolumeInfo.transform = HeightfieldVolumeInfo.transform;
 
@@ -1167,6 +1758,19 @@ FHoudiniLandscapeUtils::CreateHeightfieldFromLandscape(
         HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
             FHoudiniEngine::Get().GetSession(), LayerVolumeNodeId ), false);
 
+        if ( OutHeightfieldInput )
+        {
+            // Keep the conversion used for this layer, patched values will have to use the same one
+            int32 LayerIdx = OutHeightfieldInput->Layers.AddDefaulted();
+            FHoudiniLandscapeHeightfieldInput::FLayer& Layer = OutHeightfieldInput->Layers[ LayerIdx ];
+            Layer.LayerIndex = n;
+            Layer.VolumeNodeId = LayerVolumeNodeId;
+            Layer.LayerUsageDebugColor = LayerUsageDebugColor;
+            GetLandscapeLayerConversion(
+                CurrentLayerIntData, LayerUsageDebugColor,
+                Layer.IntMin, Layer.IntMax, Layer.LayerMin, Layer.LayerSpacing );
+        }
+
         if ( !IsMask )
         {
             // We had to create a new volume for this layer, so we need to connect it to the HF's merge node
@@ -1217,6 +1821,187 @@ FHoudiniLandscapeUtils::CreateHeightfieldFromLandscape(
 
     CreatedHeightfieldNodeId = HeightFieldId;
 
+    if ( OutHeightfieldInput && LandscapeInfo->GetLandscapeExtent(
+        OutHeightfieldInput->MinX, OutHeightfieldInput->MinY, OutHeightfieldInput->MaxX, OutHeightfieldInput->MaxY ) )
+    {
+        OutHeightfieldInput->LandscapeProxy = LandscapeProxy;
+        OutHeightfieldInput->LandscapeMaterial = LandscapeMat;
+        OutHeightfieldInput->LandscapeHoleMaterial = LandscapeHoleMat;
+        OutHeightfieldInput->LandscapeTransform = LandscapeProxy->LandscapeActorToWorld();
+        OutHeightfieldInput->NumLayers = NumLayers;
+        OutHeightfieldInput->HeightfieldNodeId = HeightFieldId;
+        OutHeightfieldInput->HeightNodeId = HeightId;
+    }
+
+    return true;
+}
+
+bool
+FHoudiniLandscapeUtils::UpdateHeightfieldFromLandscapeComponents(
+    const TSet< TWeakObjectPtr< ULandscapeComponent > >& DirtyComponents,
+    FHoudiniLandscapeHeightfieldInput& HeightfieldInput )
+{
+    ALandscapeProxy* LandscapeProxy = HeightfieldInput.LandscapeProxy.Get();
+    if ( !HeightfieldInput.IsValid() || !LandscapeProxy || LandscapeProxy->IsPendingKill() )
+        return false;
+
+    if ( !FHoudiniEngineUtils::IsHoudiniNodeValid( HeightfieldInput.HeightfieldNodeId )
+        || !FHoudiniEngineUtils::IsHoudiniNodeValid( HeightfieldInput.HeightNodeId ) )
+        return false;
+
+    //--------------------------------------------------------------------------------------------------
+    // 1. Anything else than the components' data changing requires the heightfield to be created again
+    //--------------------------------------------------------------------------------------------------
+    ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+    if ( !LandscapeInfo )
+        return false;
+
+    int32 MinX = MAX_int32;
+    int32 MinY = MAX_int32;
+    int32 MaxX = -MAX_int32;
+    int32 MaxY = -MAX_int32;
+    if ( !LandscapeInfo->GetLandscapeExtent( MinX, MinY, MaxX, MaxY ) )
+        return false;
+
+    if ( MinX != HeightfieldInput.MinX || MinY != HeightfieldInput.MinY
+        || MaxX != HeightfieldInput.MaxX || MaxY != HeightfieldInput.MaxY )
+        return false;
+
+    if ( LandscapeInfo->Layers.Num() != HeightfieldInput.NumLayers )
+        return false;
+
+    if ( !LandscapeProxy->LandscapeActorToWorld().Equals( HeightfieldInput.LandscapeTransform ) )
+        return false;
+
+    if ( LandscapeProxy->GetLandscapeMaterial() != HeightfieldInput.LandscapeMaterial.Get()
+        || LandscapeProxy->GetLandscapeHoleMaterial() != HeightfieldInput.LandscapeHoleMaterial.Get() )
+        return false;
+
+    // Nothing was modified since the heightfield was sent
+    if ( DirtyComponents.Num() <= 0 )
+        return true;
+
+    //--------------------------------------------------------------------------------------------------
+    // 2. Get the region covered by the modified components
+    //--------------------------------------------------------------------------------------------------
+    int32 DirtyMinX = MAX_int32;
+    int32 DirtyMinY = MAX_int32;
+    int32 DirtyMaxX = -MAX_int32;
+    int32 DirtyMaxY = -MAX_int32;
+    for ( const TWeakObjectPtr< ULandscapeComponent >& DirtyComponent : DirtyComponents )
+    {
+        // A removed component changes the landscape's structure
+        if ( !DirtyComponent.IsValid() || DirtyComponent->IsPendingKill() )
+            return false;
+
+        DirtyComponent->GetComponentExtent( DirtyMinX, DirtyMinY, DirtyMaxX, DirtyMaxY );
+    }
+
+    DirtyMinX = FMath::Max( DirtyMinX, MinX );
+    DirtyMinY = FMath::Max( DirtyMinY, MinY );
+    DirtyMaxX = FMath::Min( DirtyMaxX, MaxX );
+    DirtyMaxY = FMath::Min( DirtyMaxY, MaxY );
+
+    // Patching most of the landscape row by row is slower than sending it again
+    const int64 LandscapeSize = (int64)( MaxX - MinX + 1 ) * (int64)( MaxY - MinY + 1 );
+    const int64 DirtySize = (int64)( DirtyMaxX - DirtyMinX + 1 ) * (int64)( DirtyMaxY - DirtyMinY + 1 );
+    if ( DirtySize * 2 > LandscapeSize )
+        return false;
+
+    // Houdini's X and Y are Unreal's Y and X
+    const int32 VolumeXSize = MaxY - MinY + 1;
+    const int32 RectX = DirtyMinY - MinY;
+    const int32 RectY = DirtyMinX - MinX;
+
+    //--------------------------------------------------------------------------------------------------
+    // 3. Extract, convert and patch the height values of the region
+    //--------------------------------------------------------------------------------------------------
+    TArray<uint16> HeightData;
+    int32 DirtyXSize, DirtyYSize;
+    if ( !GetLandscapeData( LandscapeInfo, DirtyMinX, DirtyMinY, DirtyMaxX, DirtyMaxY, HeightData, DirtyXSize, DirtyYSize ) )
+        return false;
+
+    double ZSpacing, ZCenterOffset, ZPositionOffset;
+    GetLandscapeHeightConversion( HeightfieldInput.LandscapeTransform, ZSpacing, ZCenterOffset, ZPositionOffset );
+
+    TArray<float> FloatValues;
+    FloatValues.SetNumUninitialized( DirtyXSize * DirtyYSize );
+    for ( int32 nY = 0; nY < DirtyXSize; nY++ )
+    {
+        for ( int32 nX = 0; nX < DirtyYSize; nX++ )
+        {
+            // We need to invert X/Y when reading the value from Unreal
+            double DoubleValue = ( (double)HeightData[ nY + nX * DirtyXSize ] - ZCenterOffset ) * ZSpacing + ZPositionOffset;
+            FloatValues[ nX + nY * DirtyYSize ] = (float)DoubleValue;
+        }
+    }
+
+    if ( !SetHeightfieldDataRect(
+        HeightfieldInput.HeightNodeId, TEXT("height"), FloatValues,
+        VolumeXSize, RectX, RectY, DirtyYSize, DirtyXSize ) )
+        return false;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
+        FHoudiniEngine::Get().GetSession(), HeightfieldInput.HeightNodeId ), false );
+
+    //--------------------------------------------------------------------------------------------------
+    // 4. Extract, convert and patch the layers' values of the region
+    //--------------------------------------------------------------------------------------------------
+    for ( int32 LayerIndex = 0; LayerIndex < HeightfieldInput.NumLayers; LayerIndex++ )
+    {
+        const FHoudiniLandscapeHeightfieldInput::FLayer* Layer = HeightfieldInput.Layers.FindByPredicate(
+            [ LayerIndex ]( const FHoudiniLandscapeHeightfieldInput::FLayer& CurrentLayer ) { return CurrentLayer.LayerIndex == LayerIndex; } );
+
+        TArray<uint8> LayerData;
+        FLinearColor LayerUsageDebugColor;
+        FString LayerName;
+        bool bHasLayerData = GetLandscapeLayerData(
+            LandscapeInfo, LayerIndex, DirtyMinX, DirtyMinY, DirtyMaxX, DirtyMaxY, LayerData, LayerUsageDebugColor, LayerName );
+
+        // A layer that was not sent before has been added
+        if ( !Layer )
+        {
+            if ( bHasLayerData )
+                return false;
+
+            continue;
+        }
+
+        if ( !bHasLayerData || LayerUsageDebugColor != Layer->LayerUsageDebugColor )
+            return false;
+
+        if ( !FHoudiniEngineUtils::IsHoudiniNodeValid( Layer->VolumeNodeId ) )
+            return false;
+
+        // The layer's values were normalized over the whole landscape, values outside of that range need a full update
+        for ( const uint8& Value : LayerData )
+        {
+            if ( Value < Layer->IntMin || Value > Layer->IntMax )
+                return false;
+        }
+
+        for ( int32 nY = 0; nY < DirtyXSize; nY++ )
+        {
+            for ( int32 nX = 0; nX < DirtyYSize; nX++ )
+            {
+                double DoubleValue = ( (double)LayerData[ nY + nX * DirtyXSize ] - (double)Layer->IntMin ) * Layer->LayerSpacing + Layer->LayerMin;
+                FloatValues[ nX + nY * DirtyYSize ] = (float)DoubleValue;
+            }
+        }
+
+        if ( !SetHeightfieldDataRect(
+            Layer->VolumeNodeId, LayerName, FloatValues,
+            VolumeXSize, RectX, RectY, DirtyYSize, DirtyXSize ) )
+            return false;
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
+            FHoudiniEngine::Get().GetSession(), Layer->VolumeNodeId ), false );
+    }
+
+    // Finally, cook the Heightfield node
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
+        FHoudiniEngine::Get().GetSession(), HeightfieldInput.HeightfieldNodeId, nullptr ), false );
+
     return true;
 }
 
@@ -1390,24 +2175,28 @@ FHoudiniLandscapeUtils::CreateHeightfieldFromLandscapeComponent(
     //--------------------------------------------------------------------------------------------------
     bool MaskInitialized = false;
     int32 NumLayers = LandscapeInfo->Layers.Num();
+
+    // 1. Extract the uint8 values from the first layer, and start converting them to float
+    TUniquePtr<FHoudiniLandscapeLayerUpload> NextLayer;
+    if ( NumLayers > 0 )
+        NextLayer = StartLandscapeLayerUpload( LandscapeInfo, 0, MinX, MinY, MaxX, MaxY, XSize, YSize );
+
     for ( int32 n = 0; n < NumLayers; n++ )
     {
-        // 1. Extract the uint8 values from the layer
-        TArray<uint8> CurrentLayerIntData;
-        FLinearColor LayerUsageDebugColor;
-        FString LayerName;
-        if ( !GetLandscapeLayerData(LandscapeInfo, n, MinX, MinY, MaxX, MaxY, CurrentLayerIntData, LayerUsageDebugColor, LayerName) )
-            continue;
+        // 2. The next layer is converted while this one is sent to the session
+        TUniquePtr<FHoudiniLandscapeLayerUpload> CurrentLayer = MoveTemp( NextLayer );
+        if ( n + 1 < NumLayers )
+            NextLayer = StartLandscapeLayerUpload( LandscapeInfo, n + 1, MinX, MinY, MaxX, MaxY, XSize, YSize );
 
-        // 2. Convert unreal uint8 to float
-        // If the layer came from Houdini, additional info might have been stored in the DebugColor
-        HAPI_VolumeInfo CurrentLayerVolumeInfo;
-        TArray < float > CurrentLayerFloatData;
-        if ( !ConvertLandscapeLayerDataToHeightfieldData(
-            CurrentLayerIntData, XSize, YSize, LayerUsageDebugColor,
-            CurrentLayerFloatData, CurrentLayerVolumeInfo ) )
+        if ( !CurrentLayer->Finish() )
             continue;
 
+        const TArray<uint8>& CurrentLayerIntData = CurrentLayer->IntData;
+        const FLinearColor& LayerUsageDebugColor = CurrentLayer->LayerUsageDebugColor;
+        const FString& LayerName = CurrentLayer->LayerName;
+        HAPI_VolumeInfo& CurrentLayerVolumeInfo = CurrentLayer->VolumeInfo;
+        TArray < float >& CurrentLayerFloatData = CurrentLayer->FloatData;
+
         // We reuse the transform used for the height volume
         CurrentLayerVolumeInfo.transform = HeightfieldVolumeInfo.transform;
 
@@ -1749,21 +2538,13 @@ FHoudiniLandscapeUtils::ConvertLandscapeDataToHeightfieldData(
     Min /= 100.0;
     Max /= 100.0;
 
-    // Unreal's landscape uses 16bits precision and range from -256m to 256m with the default scale of 100.0
-    // To convert the uint16 values to float "metric" values, offset the int by 32768 to center it,
-    // then scale it
-
-    // Spacing used to convert from uint16 to meters
-    double ZSpacing = 512.0 / ((double)UINT16_MAX);
-    ZSpacing *= ( (double)LandscapeTransform.GetScale3D().Z / 100.0 );
+    double ZSpacing, ZCenterOffset, ZPositionOffset;
+    GetLandscapeHeightConversion( LandscapeTransform, ZSpacing, ZCenterOffset, ZPositionOffset );
 
-    // Center value in meters (Landscape ranges from [-255:257] meters at default scale
-    double ZCenterOffset = 32767;
-    double ZPositionOffset = LandscapeTransform.GetLocation().Z / 100.0f;
-    // Convert the Int data to Float
+    // Convert the Int data to Float, rows are converted and transposed in parallel
     HeightfieldFloatValues.SetNumUninitialized( SizeInPoints );
 
-    for ( int32 nY = 0; nY < HoudiniYSize; nY++ )
+    ParallelFor( HoudiniYSize, [ & ]( int32 nY )
     {
         for ( int32 nX = 0; nX < HoudiniXSize; nX++ )
         {
@@ -1776,7 +2557,7 @@ FHoudiniLandscapeUtils::ConvertLandscapeDataToHeightfieldData(
             double DoubleValue = ((double)IntHeightData[nUnreal] - ZCenterOffset) * ZSpacing + ZPositionOffset;
             HeightfieldFloatValues[nHoudini] = (float)DoubleValue;
         }
-    }
+    }, SizeInPoints < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
 
     //--------------------------------------------------------------------------------------------------
     // 2. Convert the Unreal Transform to a HAPI_transform
@@ -1871,41 +2652,14 @@ FHoudiniLandscapeUtils::ConvertLandscapeLayerDataToHeightfieldData(
     // 1. Convert values to float
     //--------------------------------------------------------------------------------------------------
 
-    // We need the ZMin / ZMax unt8 values
-    uint8 IntMin = IntHeightData[ 0 ];
-    uint8 IntMax = IntMin;
-
-    for ( int n = 0; n < IntHeightData.Num(); n++ )
-    {
-        if ( IntHeightData[ n ] < IntMin )
-            IntMin = IntHeightData[ n ];
-        if ( IntHeightData[ n ] > IntMax )
-            IntMax = IntHeightData[ n ];
-    }
-
-    // The range in Digits
-    double DigitRange = (double)IntMax - (double)IntMin;
-
-    // By default, the values will be converted to [0, 1]
-    float LayerMin = 0.0f;
-    float LayerMax = 1.0f;
-    float LayerSpacing = 1.0f / DigitRange;
-
-    // If this layer came from Houdini, its alpha value should be PI
-    // So we can extract the additionnal infos stored its debug usage color
-    if ( LayerUsageDebugColor.A == PI )
-    {
-        LayerMin = LayerUsageDebugColor.R;
-        LayerMax = LayerUsageDebugColor.G;
-        LayerSpacing = LayerUsageDebugColor.B;
-    }
-
-    LayerSpacing = ( LayerMax - LayerMin ) / DigitRange;
+    uint8 IntMin, IntMax;
+    float LayerMin, LayerSpacing;
+    GetLandscapeLayerConversion( IntHeightData, LayerUsageDebugColor, IntMin, IntMax, LayerMin, LayerSpacing );
 
-    // Convert the Int data to Float
+    // Convert the Int data to Float, rows are converted and transposed in parallel
     LayerFloatValues.SetNumUninitialized( SizeInPoints );
 
-    for ( int32 nY = 0; nY < HoudiniYSize; nY++ )
+    ParallelFor( HoudiniYSize, [ & ]( int32 nY )
     {
         for ( int32 nX = 0; nX < HoudiniXSize; nX++ )
         {
@@ -1918,18 +2672,7 @@ FHoudiniLandscapeUtils::ConvertLandscapeLayerDataToHeightfieldData(
             double DoubleValue = ( (double)IntHeightData[ nUnreal ] - (double)IntMin ) * LayerSpacing + LayerMin;
             LayerFloatValues[ nHoudini ] = (float)DoubleValue;
         }
-    }
-
-    // Verifying the converted ZMin / ZMax
-    float FloatMin = LayerFloatValues[ 0 ];
-    float FloatMax = FloatMin;
-    for ( int32 n = 0; n < LayerFloatValues.Num(); n++ )
-    {
-        if ( LayerFloatValues[ n ] < FloatMin )
-            FloatMin = LayerFloatValues[ n ];
-        if ( LayerFloatValues[ n ] > FloatMax )
-            FloatMax = LayerFloatValues[ n ];
-    }
+    }, SizeInPoints < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
 
     //--------------------------------------------------------------------------------------------------
     // 2. Fill the volume info
@@ -2108,30 +2851,6 @@ FHoudiniLandscapeUtils::DestroyLandscapeAssetNode( HAPI_NodeId& ConnectedAssetId
     return FHoudiniEngineUtils::DestroyHoudiniAsset( ConnectedAssetId );
 }
 
-FColor
-FHoudiniLandscapeUtils::PickVertexColorFromTextureMip(
-    const uint8 * MipBytes, FVector2D & UVCoord, int32 MipWidth, int32 MipHeight )
-{
-    check( MipBytes );
-
-    FColor ResultColor( 0, 0, 0, 255 );
-
-    if ( UVCoord.X >= 0.0f && UVCoord.X < 1.0f && UVCoord.Y >= 0.0f && UVCoord.Y < 1.0f )
-    {
-        const int32 X = MipWidth * UVCoord.X;
-        const int32 Y = MipHeight * UVCoord.Y;
-
-        const int32 Index = ( ( Y * MipWidth ) + X ) * 4;
-
-        ResultColor.B = MipBytes[ Index + 0 ];
-        ResultColor.G = MipBytes[ Index + 1 ];
-        ResultColor.R = MipBytes[ Index + 2 ];
-        ResultColor.A = MipBytes[ Index + 3 ];
-    }
-
-    return ResultColor;
-}
-
 #if WITH_EDITOR
 bool 
 FHoudiniLandscapeUtils::ExtractLandscapeData(
@@ -2141,7 +2860,8 @@ FHoudiniLandscapeUtils::ExtractLandscapeData(
     TArray<FVector>& LandscapeNormalArray,
     TArray<FVector>& LandscapeUVArray, 
     TArray<FIntPoint>& LandscapeComponentVertexIndicesArray, 
-    TArray<const char *>& LandscapeComponentNameArray,
+    TArray<FString>& LandscapeComponentNames,
+    TArray<int32>& LandscapeComponentNameIndices,
     TArray<FLinearColor>& LandscapeLightmapValues )
 {
     if ( !LandscapeProxy )
@@ -2178,7 +2898,8 @@ FHoudiniLandscapeUtils::ExtractLandscapeData(
     LandscapePositionArray.SetNumUninitialized( VertexCount );
     LandscapeNormalArray.SetNumUninitialized( VertexCount );
     LandscapeUVArray.SetNumUninitialized( VertexCount );
-    LandscapeComponentNameArray.SetNumUninitialized( VertexCount );
+    LandscapeComponentNames.Empty( NumComponents );
+    LandscapeComponentNameIndices.SetNumUninitialized( VertexCount );
     LandscapeComponentVertexIndicesArray.SetNumUninitialized( VertexCount );    
     if ( bExportLighting )
         LandscapeLightmapValues.SetNumUninitialized( VertexCount );
@@ -2188,6 +2909,9 @@ FHoudiniLandscapeUtils::ExtractLandscapeData(
     //-----------------------------------------------------------------------------------------------------------------
     FIntPoint IntPointMax = FIntPoint::ZeroValue;
 
+    // Lightmap textures decoded for this export, they are shared by the components.
+    TMap< UTexture2D *, FHoudiniTextureMipColors > LightmapColorsCache;
+
     int32 AllPositionsIdx = 0;
     for ( int32 ComponentIdx = 0; ComponentIdx < LandscapeProxy->LandscapeComponents.Num(); ComponentIdx++ )
     {
@@ -2195,11 +2919,8 @@ FHoudiniLandscapeUtils::ExtractLandscapeData(
         if ( bExportOnlySelected && !SelectedComponents.Contains( LandscapeComponent ) )
             continue;
 
-        TArray< uint8 > LightmapMipData;
-        int32 LightmapMipSizeX = 0;
-        int32 LightmapMipSizeY = 0;
-
         // See if we need to export lighting information.
+        const FHoudiniTextureMipColors * LightmapColors = nullptr;
         if ( bExportLighting )
         {
             const FMeshMapBuildData* MapBuildData = LandscapeComponent->GetMeshMapBuildData();
@@ -2209,15 +2930,16 @@ FHoudiniLandscapeUtils::ExtractLandscapeData(
                 UTexture2D * TextureLightmap = LightMap2D->GetTexture( 0 );
                 if ( TextureLightmap )
                 {
-                    if ( TextureLightmap->Source.GetMipData( LightmapMipData, 0 ) )
+                    // Components usually share the same lightmap texture, only decode it the first time we see it.
+                    FHoudiniTextureMipColors * CachedColors = LightmapColorsCache.Find( TextureLightmap );
+                    if ( !CachedColors )
                     {
-                        LightmapMipSizeX = TextureLightmap->Source.GetSizeX();
-                        LightmapMipSizeY = TextureLightmap->Source.GetSizeY();
-                    }
-                    else
-                    {
-                        LightmapMipData.Empty();
+                        CachedColors = &LightmapColorsCache.Add( TextureLightmap );
+                        CachedColors->Decode( TextureLightmap, 0 );
                     }
+
+                    if ( CachedColors->IsValid() )
+                        LightmapColors = CachedColors;
                 }
             }
         }
@@ -2225,11 +2947,23 @@ FHoudiniLandscapeUtils::ExtractLandscapeData(
         // Construct landscape component data interface to access raw data.
         FLandscapeComponentDataInterface CDI( LandscapeComponent, LandscapeProxy->ExportLOD );
 
-        // Get name of this landscape component.
-        char * LandscapeComponentNameStr = FHoudiniEngineUtils::ExtractRawName( LandscapeComponent->GetName() );
+        // Add the name of this landscape component to the name table.
+        const int32 LandscapeComponentNameIdx = LandscapeComponentNames.Add( LandscapeComponent->GetName() );
+
+        // Retrieve the component's data once, the vertices are then extracted in parallel.
+        const FTransform & ComponentTransform = LandscapeComponent->GetComponentTransform();
+        const FVector ScaleVector = ComponentTransform.GetScale3D();
+        const FIntPoint SectionBase = LandscapeComponent->GetSectionBase();
 
-        for ( int32 VertexIdx = 0; VertexIdx < VertexCountPerComponent; VertexIdx++ )
+        // Keep track of max offset.
+        if ( !bExportTileUVs )
+            IntPointMax = IntPointMax.ComponentMax( SectionBase );
+
+        const int32 ComponentFirstIdx = AllPositionsIdx;
+        ParallelFor( VertexCountPerComponent, [ & ]( int32 VertexIdx )
         {
+            const int32 PositionIdx = ComponentFirstIdx + VertexIdx;
+
             int32 VertX = 0;
             int32 VertY = 0;
             CDI.VertexIndexToXY( VertexIdx, VertX, VertY );
@@ -2257,83 +2991,57 @@ FHoudiniLandscapeUtils::ExtractLandscapeData(
             else
             {
                 // We want to export global uvs (default).
-                FIntPoint IntPoint = LandscapeComponent->GetSectionBase();
-                TextureUV = FVector( VertX * ScaleFactor + IntPoint.X, VertY * ScaleFactor + IntPoint.Y, 0.0f );
-
-                // Keep track of max offset.
-                IntPointMax = IntPointMax.ComponentMax( IntPoint );
+                TextureUV = FVector( VertX * ScaleFactor + SectionBase.X, VertY * ScaleFactor + SectionBase.Y, 0.0f );
             }
 
             if ( bExportLighting )
             {
                 FLinearColor VertexLightmapColor( 0.0f, 0.0f, 0.0f, 1.0f );
-                if ( LightmapMipData.Num() > 0 )
+                if ( LightmapColors )
                 {
                     FVector2D UVCoord( VertX, VertY );
                     UVCoord /= ( ComponentSizeQuads + 1 );
 
-                    FColor LightmapColorRaw = PickVertexColorFromTextureMip(
-                        LightmapMipData.GetData(), UVCoord, LightmapMipSizeX, LightmapMipSizeY );
-
-                    VertexLightmapColor = LightmapColorRaw.ReinterpretAsLinear();
+                    VertexLightmapColor = LightmapColors->Sample( UVCoord ).ReinterpretAsLinear();
                 }
 
-                LandscapeLightmapValues[ AllPositionsIdx ] = VertexLightmapColor;
+                LandscapeLightmapValues[ PositionIdx ] = VertexLightmapColor;
             }
 
-            // Retrieve component transform.
-            const FTransform & ComponentTransform = LandscapeComponent->GetComponentTransform();
-
-            // Retrieve component scale.
-            const FVector & ScaleVector = ComponentTransform.GetScale3D();
-
             // Perform normalization.
             Normal /= ScaleVector;
             Normal.Normalize();
 
-            TangentX /= ScaleVector;
-            TangentX.Normalize();
-
-            TangentY /= ScaleVector;
-            TangentY.Normalize();
-
             // Perform position scaling.
             FVector PositionTransformed = PositionVector / GeneratedGeometryScaleFactor;
             if ( ImportAxis == HRSAI_Unreal )
             {
-                LandscapePositionArray[ AllPositionsIdx ].X = PositionTransformed.X;
-                LandscapePositionArray[ AllPositionsIdx ].Y = PositionTransformed.Z;
-                LandscapePositionArray[ AllPositionsIdx ].Z = PositionTransformed.Y;
+                LandscapePositionArray[ PositionIdx ].X = PositionTransformed.X;
+                LandscapePositionArray[ PositionIdx ].Y = PositionTransformed.Z;
+                LandscapePositionArray[ PositionIdx ].Z = PositionTransformed.Y;
 
                 Swap( Normal.Y, Normal.Z );
             }
-            else if ( ImportAxis == HRSAI_Houdini )
-            {
-                LandscapePositionArray[ AllPositionsIdx ].X = PositionTransformed.X;
-                LandscapePositionArray[ AllPositionsIdx ].Y = PositionTransformed.Y;
-                LandscapePositionArray[ AllPositionsIdx ].Z = PositionTransformed.Z;
-            }
             else
             {
-                // Not a valid enum value.
-                check( 0 );
+                LandscapePositionArray[ PositionIdx ] = PositionTransformed;
             }
 
-            // Store landscape component name for this point.
-            LandscapeComponentNameArray[ AllPositionsIdx ] = LandscapeComponentNameStr;
+            // Store landscape component name index for this point.
+            LandscapeComponentNameIndices[ PositionIdx ] = LandscapeComponentNameIdx;
 
             // Store vertex index (x,y) for this point.
-            LandscapeComponentVertexIndicesArray[ AllPositionsIdx ].X = VertX;
-            LandscapeComponentVertexIndicesArray[ AllPositionsIdx ].Y = VertY;
+            LandscapeComponentVertexIndicesArray[ PositionIdx ].X = VertX;
+            LandscapeComponentVertexIndicesArray[ PositionIdx ].Y = VertY;
 
             // Store point normal.
-            LandscapeNormalArray[ AllPositionsIdx ] = Normal;
+            LandscapeNormalArray[ PositionIdx ] = Normal;
 
             // Store uv.
-            LandscapeUVArray[ AllPositionsIdx ] = TextureUV;
+            LandscapeUVArray[ PositionIdx ] = TextureUV;
+        }, VertexCountPerComponent < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
 
-            AllPositionsIdx++;
-        }
+        AllPositionsIdx += VertexCountPerComponent;
     }
 
     // If we need to normalize UV space and we are doing global UVs.
@@ -2467,12 +3175,25 @@ bool FHoudiniLandscapeUtils::AddLandscapeComponentVertexIndicesAttribute( const
     return true;
 }
 
-bool FHoudiniLandscapeUtils::AddLandscapeComponentNameAttribute( const HAPI_NodeId& NodeId, const TArray<const char *>& LandscapeComponentNameArray )
+bool FHoudiniLandscapeUtils::AddLandscapeComponentNameAttribute(
+    const HAPI_NodeId& NodeId, const TArray<FString>& LandscapeComponentNames,
+    const TArray<int32>& LandscapeComponentNameIndices )
 {
-    int32 VertexCount = LandscapeComponentNameArray.Num();
+    int32 VertexCount = LandscapeComponentNameIndices.Num();
     if ( VertexCount < 3 )
         return false;
 
+    // Convert each component name only once, the points then share the converted strings
+    TArray< std::string > ConvertedNames;
+    ConvertedNames.SetNum( LandscapeComponentNames.Num() );
+    for ( int32 NameIdx = 0; NameIdx < LandscapeComponentNames.Num(); NameIdx++ )
+        ConvertedNames[ NameIdx ] = TCHAR_TO_UTF8( *LandscapeComponentNames[ NameIdx ] );
+
+    TArray< const char * > LandscapeComponentNameArray;
+    LandscapeComponentNameArray.SetNumUninitialized( VertexCount );
+    for ( int32 VertexIdx = 0; VertexIdx < VertexCount; VertexIdx++ )
+        LandscapeComponentNameArray[ VertexIdx ] = ConvertedNames[ LandscapeComponentNameIndices[ VertexIdx ] ].c_str();
+
     // Create point attribute containing landscape component name.
     HAPI_AttributeInfo AttributeInfoPointLandscapeComponentNames;
     FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoPointLandscapeComponentNames );
@@ -2557,71 +3278,72 @@ bool FHoudiniLandscapeUtils::AddLandscapeMeshIndicesAndMaterialsAttribute(
     FaceMaterials.SetNumUninitialized( QuadCount );
     FaceHoleMaterials.SetNumUninitialized( QuadCount );
 
-    int32 VertIdx = 0;
-    int32 QuadIdx = 0;
-
-    char * MaterialRawStr = nullptr;
-    char * MaterialHoleRawStr = nullptr;
-
-    const int32 QuadComponentCount = ComponentSizeQuads + 1;
+    // Gather the exported components in the order their vertices were extracted,
+    // along with their override material names (if exporting materials).
+    TArray< int32 > ComponentMaterialIndices;
+    TArray< int32 > ComponentHoleMaterialIndices;
+    TArray< std::string > MaterialNames;
     for ( int32 ComponentIdx = 0; ComponentIdx < LandscapeProxy->LandscapeComponents.Num(); ComponentIdx++ )
     {
         ULandscapeComponent * LandscapeComponent = LandscapeProxy->LandscapeComponents[ ComponentIdx ];
         if ( !SelectedComponents.Contains( LandscapeComponent ) )
             continue;
 
+        int32 MaterialIdx = INDEX_NONE;
+        int32 HoleMaterialIdx = INDEX_NONE;
         if ( bExportMaterials )
         {
             // If component has an override material, we need to get the raw name (if exporting materials).
             if ( LandscapeComponent->OverrideMaterial )
-            {
-                MaterialRawStr = FHoudiniEngineUtils::ExtractRawName(LandscapeComponent->OverrideMaterial->GetName());
-            }
+                MaterialIdx = MaterialNames.Add( TCHAR_TO_UTF8( *LandscapeComponent->OverrideMaterial->GetName() ) );
 
             // If component has an override hole material, we need to get the raw name (if exporting materials).
             if ( LandscapeComponent->OverrideHoleMaterial )
-            {
-                MaterialHoleRawStr = FHoudiniEngineUtils::ExtractRawName(LandscapeComponent->OverrideHoleMaterial->GetName());
-            }
+                HoleMaterialIdx = MaterialNames.Add( TCHAR_TO_UTF8( *LandscapeComponent->OverrideHoleMaterial->GetName() ) );
         }
 
+        ComponentMaterialIndices.Add( MaterialIdx );
+        ComponentHoleMaterialIndices.Add( HoleMaterialIdx );
+    }
+
+    const int32 QuadsPerComponent = ComponentSizeQuads * ComponentSizeQuads;
+    if ( QuadsPerComponent <= 0 || ComponentMaterialIndices.Num() * QuadsPerComponent != QuadCount )
+        return false;
+
+    // All the quads are independent, build them in parallel
+    const int32 QuadComponentCount = ComponentSizeQuads + 1;
+    ParallelFor( QuadCount, [ & ]( int32 QuadIdx )
+    {
+        const int32 ComponentIdx = QuadIdx / QuadsPerComponent;
+        const int32 XIdx = ( QuadIdx % QuadsPerComponent ) % ComponentSizeQuads;
+        const int32 YIdx = ( QuadIdx % QuadsPerComponent ) / ComponentSizeQuads;
+        const int32 VertIdx = QuadIdx * 4;
+
         int32 BaseVertIndex = ComponentIdx * VertexCountPerComponent;
-        for ( int32 YIdx = 0; YIdx < ComponentSizeQuads; YIdx++ )
+        if ( ImportAxis == HRSAI_Unreal )
         {
-            for ( int32 XIdx = 0; XIdx < ComponentSizeQuads; XIdx++ )
-            {
-                if ( ImportAxis == HRSAI_Unreal )
-                {
-                    LandscapeIndices[ VertIdx + 0 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 0 ) * QuadComponentCount;
-                    LandscapeIndices[ VertIdx + 1 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 0 ) * QuadComponentCount;
-                    LandscapeIndices[ VertIdx + 2 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 1 ) * QuadComponentCount;
-                    LandscapeIndices[ VertIdx + 3 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 1 ) * QuadComponentCount;
-                }
-                else if (ImportAxis == HRSAI_Houdini)
-                {
-                    LandscapeIndices[ VertIdx + 0 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 0 ) * QuadComponentCount;
-                    LandscapeIndices[ VertIdx + 1 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 1 ) * QuadComponentCount;
-                    LandscapeIndices[ VertIdx + 2 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 1 ) * QuadComponentCount;
-                    LandscapeIndices[ VertIdx + 3 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 0 ) * QuadComponentCount;
-                }
-                else
-                {
-                   // Not a valid enum value.
-                    check( 0 );
-                }
-
-                // Store override materials (if exporting materials).
-                if ( bExportMaterials )
-                {
-                    FaceMaterials[ QuadIdx ] = MaterialRawStr;
-                    FaceHoleMaterials[ QuadIdx ] = MaterialHoleRawStr;
-                }
+            LandscapeIndices[ VertIdx + 0 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 0 ) * QuadComponentCount;
+            LandscapeIndices[ VertIdx + 1 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 0 ) * QuadComponentCount;
+            LandscapeIndices[ VertIdx + 2 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 1 ) * QuadComponentCount;
+            LandscapeIndices[ VertIdx + 3 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 1 ) * QuadComponentCount;
+        }
+        else
+        {
+            LandscapeIndices[ VertIdx + 0 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 0 ) * QuadComponentCount;
+            LandscapeIndices[ VertIdx + 1 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 1 ) * QuadComponentCount;
+            LandscapeIndices[ VertIdx + 2 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 1 ) * QuadComponentCount;
+            LandscapeIndices[ VertIdx + 3 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 0 ) * QuadComponentCount;
+        }
 
-                VertIdx += 4;
-                QuadIdx++;
-            }
+        // Store override materials (if exporting materials).
+        if ( bExportMaterials )
+        {
+            const int32 MaterialIdx = ComponentMaterialIndices[ ComponentIdx ];
+            const int32 HoleMaterialIdx = ComponentHoleMaterialIndices[ ComponentIdx ];
+            FaceMaterials[ QuadIdx ] = MaterialNames.IsValidIndex( MaterialIdx ) ? MaterialNames[ MaterialIdx ].c_str() : nullptr;
+            FaceHoleMaterials[ QuadIdx ] = MaterialNames.IsValidIndex( HoleMaterialIdx ) ? MaterialNames[ HoleMaterialIdx ].c_str() : nullptr;
         }
-    }
+    }, QuadCount < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
 
     // We can now set vertex list.
     HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVertexList(
@@ -2841,6 +3563,70 @@ bool FHoudiniLandscapeUtils::GetLandscapeComponentExtentAttributes(
 }
 
 #if WITH_EDITOR
+
+/** Write the component sized blocks of a landscape whose data differs from the current one. **/
+/** GetData reads a rectangle of the current data, SetData writes a rectangle, both take inclusive vertex bounds. **/
+template< typename DataType, typename GetDataFunc, typename SetDataFunc >
+static void
+SetChangedLandscapeData(
+    const TArray< DataType > & NewData, int32 SizeX, int32 SizeY, int32 BlockSizeQuads,
+    GetDataFunc GetData, SetDataFunc SetData )
+{
+    TArray< DataType > OldData;
+    OldData.SetNumZeroed( SizeX * SizeY );
+    GetData( 0, 0, SizeX - 1, SizeY - 1, OldData.GetData() );
+
+    // Blocks share their edge vertices with their neighbours.
+    TArray< FIntRect > ChangedBlocks;
+    const int32 BlockSize = FMath::Max( BlockSizeQuads, 1 );
+    for ( int32 BlockY = 0; BlockY < SizeY - 1; BlockY += BlockSize )
+    {
+        for ( int32 BlockX = 0; BlockX < SizeX - 1; BlockX += BlockSize )
+        {
+            const FIntRect Block( BlockX, BlockY, FMath::Min( BlockX + BlockSize, SizeX - 1 ), FMath::Min( BlockY + BlockSize, SizeY - 1 ) );
+
+            bool bChanged = false;
+            for ( int32 Y = Block.Min.Y; Y <= Block.Max.Y && !bChanged; ++Y )
+            {
+                const int32 RowStart = Y * SizeX + Block.Min.X;
+                bChanged = FMemory::Memcmp(
+                    NewData.GetData() + RowStart, OldData.GetData() + RowStart,
+                    ( Block.Max.X - Block.Min.X + 1 ) * sizeof( DataType ) ) != 0;
+            }
+
+            if ( bChanged )
+                ChangedBlocks.Add( Block );
+        }
+    }
+
+    if ( ChangedBlocks.Num() <= 0 )
+        return;
+
+    // When most of the landscape changed, a single write is cheaper than many small ones.
+    const int32 NumBlocks = FMath::DivideAndRoundUp( SizeX - 1, BlockSize ) * FMath::DivideAndRoundUp( SizeY - 1, BlockSize );
+    if ( ChangedBlocks.Num() * 2 > NumBlocks )
+    {
+        SetData( 0, 0, SizeX - 1, SizeY - 1, NewData.GetData() );
+        return;
+    }
+
+    TArray< DataType > BlockData;
+    for ( const FIntRect & Block : ChangedBlocks )
+    {
+        const int32 BlockSizeX = Block.Max.X - Block.Min.X + 1;
+        BlockData.SetNumUninitialized( BlockSizeX * ( Block.Max.Y - Block.Min.Y + 1 ), false );
+        for ( int32 Y = Block.Min.Y; Y <= Block.Max.Y; ++Y )
+        {
+            FMemory::Memcpy(
+                BlockData.GetData() + ( Y - Block.Min.Y ) * BlockSizeX,
+                NewData.GetData() + Y * SizeX + Block.Min.X,
+                BlockSizeX * sizeof( DataType ) );
+        }
+
+        SetData( Block.Min.X, Block.Min.Y, Block.Max.X, Block.Max.Y, BlockData.GetData() );
+    }
+}
+
 bool
 FHoudiniLandscapeUtils::CreateAllLandscapes( 
     FHoudiniCookParams& HoudiniCookParams,
@@ -2874,6 +3660,52 @@ FHoudiniLandscapeUtils::CreateAllLandscapes(
     if ( FoundVolumes.Num() > 1 )
         FHoudiniLandscapeUtils::CalcHeightfieldsArrayGlobalZMinZMax( FoundVolumes, GlobalMinimums, GlobalMaximums );
 
+    // The global range applied to a heightfield, 0/0 if it is converted using its own range
+    const float fAppliedMin = ( fGlobalMin != fGlobalMax ) ? fGlobalMin : 0.0f;
+    const float fAppliedMax = ( fGlobalMin != fGlobalMax ) ? fGlobalMax : 0.0f;
+
+    // Unchanged heightfields and layers only need to be converted again if their applied global range has changed
+    auto HasAppliedZRangeChanged = [ & ]( const FHoudiniGeoPartObject& Heightfield, const TArray< const FHoudiniGeoPartObject* >& Layers )
+    {
+        if ( !IsVolumeAppliedZRangeUnchanged( Heightfield, fAppliedMin, fAppliedMax ) )
+            return true;
+
+        for ( const FHoudiniGeoPartObject* Layer : Layers )
+        {
+            if ( !Layer )
+                continue;
+
+            float LayerAppliedMin, LayerAppliedMax;
+            GetLayerAppliedZRange( *Layer, GlobalMinimums, GlobalMaximums, LayerAppliedMin, LayerAppliedMax );
+            if ( !IsVolumeAppliedZRangeUnchanged( *Layer, LayerAppliedMin, LayerAppliedMax ) )
+                return true;
+        }
+
+        return false;
+    };
+
+    auto SetAppliedZRanges = [ & ]( const FHoudiniGeoPartObject& Heightfield )
+    {
+        TArray< const FHoudiniGeoPartObject* > Layers;
+        FHoudiniLandscapeUtils::GetHeightfieldsLayersInArray( FoundVolumes, Heightfield, Layers );
+
+        SetVolumeAppliedZRange( Heightfield, fAppliedMin, fAppliedMax );
+        for ( const FHoudiniGeoPartObject* Layer : Layers )
+        {
+            if ( !Layer )
+                continue;
+
+            float LayerAppliedMin, LayerAppliedMax;
+            GetLayerAppliedZRange( *Layer, GlobalMinimums, GlobalMaximums, LayerAppliedMin, LayerAppliedMax );
+            SetVolumeAppliedZRange( *Layer, LayerAppliedMin, LayerAppliedMax );
+        }
+    };
+
+    // Layer packages and components of the created landscapes are saved and registered in one batch once all
+    // the heightfields, or tiles of a heightfield, have been converted
+    TArray< UPackage * > LayerPackagesToSave;
+    TArray< ALandscape * > LandscapesToRegister;
+
     // Try to create a Landscape for each HeightData found
     NewLandscapes.Empty();
     for (TArray< const FHoudiniGeoPartObject* >::TConstIterator IterHeighfields(FoundHeightfields); IterHeighfields; ++IterHeighfields)
@@ -2908,6 +3740,10 @@ FHoudiniLandscapeUtils::CreateAllLandscapes(
                     }
                 }
 
+                // The global range used to convert them must not have changed either
+                if ( !bLayersHaveChanged && HasAppliedZRangeChanged( *CurrentHeightfield, FoundLayers ) )
+                    bLayersHaveChanged = true;
+
                 if (!bLayersHaveChanged)
                 {
                     // Height and layers/masks have not changed, there is no need to reimport the landscape
@@ -3047,6 +3883,11 @@ FHoudiniLandscapeUtils::CreateAllLandscapes(
                     && (PrevMaxY - PrevMinY + 1) == UnrealYSize )
                     SizeMatch = true;
 
+                // The component layout must match too, or the landscape would keep its old components
+                if ( FoundLandscape->NumSubsections != NumSectionPerLandscapeComponent
+                    || FoundLandscape->SubsectionSizeQuads != NumQuadsPerLandscapeSection )
+                    SizeMatch = false;
+
                 /*
                 // If not, see if we could update that landscape's component
                 if (!SizeMatch && HasComponentExtent)
@@ -3085,6 +3926,9 @@ FHoudiniLandscapeUtils::CreateAllLandscapes(
                 IntHeightData, LandscapeTransform))
                 continue;
 
+            // The float heights aren't needed anymore, free them before reading the layers
+            FloatValues.Empty();
+
             // Look for all the layers/masks corresponding to the current heightfield
             TArray< const FHoudiniGeoPartObject* > FoundLayers;
             FHoudiniLandscapeUtils::GetHeightfieldsLayersInArray(FoundVolumes, *CurrentHeightfield, FoundLayers);
@@ -3092,15 +3936,20 @@ FHoudiniLandscapeUtils::CreateAllLandscapes(
             // Extract and convert the Landscape layers
             TArray< FLandscapeImportLayerInfo > ImportLayerInfos;
             if (!FHoudiniLandscapeUtils::CreateLandscapeLayers(HoudiniCookParams, FoundLayers, *CurrentHeightfield,
-                UnrealXSize, UnrealYSize, GlobalMinimums, GlobalMaximums, ImportLayerInfos))
+                UnrealXSize, UnrealYSize, GlobalMinimums, GlobalMaximums, ImportLayerInfos, &LayerPackagesToSave))
                 continue;
 
-            // Create the actual Landscape
+            // Create the actual Landscape, its components are registered after all landscapes are created
             ALandscape * CurrentLandscape = CreateLandscape(
                 IntHeightData, ImportLayerInfos,
                 LandscapeTransform, UnrealXSize, UnrealYSize,
                 NumSectionPerLandscapeComponent, NumQuadsPerLandscapeSection,
-                LandscapeMaterial, LandscapeHoleMaterial );
+                LandscapeMaterial, LandscapeHoleMaterial, false );
+
+            if (!CurrentLandscape)
+                continue;
+
+            LandscapesToRegister.Add( CurrentLandscape );
 
             for (auto CurrLayerInfo : ImportLayerInfos)
             {
@@ -3112,11 +3961,9 @@ FHoudiniLandscapeUtils::CreateAllLandscapes(
                 }
             }
 
-            if (!CurrentLandscape)
-                continue;
-
             // Add the new landscape to the map
             NewLandscapes.Add(*CurrentHeightfield, CurrentLandscape);
+            SetAppliedZRanges( *CurrentHeightfield );
         }
         else
         {
@@ -3138,8 +3985,9 @@ FHoudiniLandscapeUtils::CreateAllLandscapes(
 
             FLandscapeEditDataInterface LandscapeEdit(PreviousInfo);
 
-            // Update the height data only if it's marked as changed
-            if ( CurrentHeightfield->bHasGeoChanged )
+            // Update the height data only if it's marked as changed, or if the global range used to convert it has
+            if ( CurrentHeightfield->bHasGeoChanged
+                || !IsVolumeAppliedZRangeUnchanged( *CurrentHeightfield, fAppliedMin, fAppliedMax ) )
             {
                 // Convert the height data from Houdini's heightfield to Unreal's Landscape
                 TArray< uint16 > IntHeightData;
@@ -3152,8 +4000,23 @@ FHoudiniLandscapeUtils::CreateAllLandscapes(
                     UpdateLandscapeComponent ) )
                     continue;
 
+                // The float heights aren't needed anymore, free them before reading the layers
+                FloatValues.Empty();
+
                 if ( !UpdateLandscapeComponent )
-                    LandscapeEdit.SetHeightData(0, 0, UnrealXSize - 1, UnrealYSize - 1, IntHeightData.GetData(), 0, true);
+                {
+                    // Only rewrite the components whose heights have changed
+                    SetChangedLandscapeData(
+                        IntHeightData, UnrealXSize, UnrealYSize, FoundLandscape->ComponentSizeQuads,
+                        [ &LandscapeEdit ]( int32 X1, int32 Y1, int32 X2, int32 Y2, uint16 * Data )
+                        {
+                            LandscapeEdit.GetHeightDataFast( X1, Y1, X2, Y2, Data, 0 );
+                        },
+                        [ &LandscapeEdit ]( int32 X1, int32 Y1, int32 X2, int32 Y2, const uint16 * Data )
+                        {
+                            LandscapeEdit.SetHeightData( X1, Y1, X2, Y2, Data, 0, true );
+                        } );
+                }
                 else
                     LandscapeEdit.SetHeightData(MinX, MinY, MaxX, MaxY, IntHeightData.GetData(), 0, true);
 
@@ -3177,15 +4040,17 @@ FHoudiniLandscapeUtils::CreateAllLandscapes(
                 if (LayerGeoPartObject->AssetId == -1)
                     continue;
 
-                if ( !LayerGeoPartObject->bHasGeoChanged )
+                float LayerAppliedMin, LayerAppliedMax;
+                GetLayerAppliedZRange( *LayerGeoPartObject, GlobalMinimums, GlobalMaximums, LayerAppliedMin, LayerAppliedMax );
+                if ( !LayerGeoPartObject->bHasGeoChanged
+                    && IsVolumeAppliedZRangeUnchanged( *LayerGeoPartObject, LayerAppliedMin, LayerAppliedMax ) )
                     continue;
 
-                // Extract the layer's float data from the HF
-                TArray< float > FloatLayerData;
+                // Extract the layer's min / max values from the HF
                 HAPI_VolumeInfo LayerVolumeInfo;
                 float LayerMin = 0;
                 float LayerMax = 0;
-                if (!FHoudiniLandscapeUtils::GetHeightfieldData(*LayerGeoPartObject, FloatLayerData, LayerVolumeInfo, LayerMin, LayerMax))
+                if (!FHoudiniLandscapeUtils::GetHeightfieldMinMax(*LayerGeoPartObject, LayerVolumeInfo, LayerMin, LayerMax))
                     continue;
 
                 // No need to create flat layers as Unreal will remove them afterwards..
@@ -3222,9 +4087,9 @@ FHoudiniLandscapeUtils::CreateAllLandscapes(
                 if (!currentLayerInfo.LayerInfo || !Package)
                     continue;
 
-                // Convert the float data to uint8
-                if ( !FHoudiniLandscapeUtils::ConvertHeightfieldLayerToLandscapeLayer(
-                    FloatLayerData, LayerVolumeInfo.yLength, LayerVolumeInfo.xLength,
+                // Read the layer's float data tile by tile and convert it to uint8
+                if ( !FHoudiniLandscapeUtils::GetHeightfieldLayerAsLandscapeLayer(
+                    *LayerGeoPartObject,
                     LayerMin, LayerMax,
                     UnrealXSize, UnrealYSize,
                     currentLayerInfo.LayerData,
@@ -3241,7 +4106,20 @@ FHoudiniLandscapeUtils::CreateAllLandscapes(
 
                 // Update the layer on the heightfield
                 if ( !UpdateLandscapeComponent )
-                    LandscapeEdit.SetAlphaData( currentLayerInfo.LayerInfo, 0, 0, UnrealXSize - 1, UnrealYSize - 1, currentLayerInfo.LayerData.GetData(), 0 );
+                {
+                    // Only rewrite the components whose weights have changed
+                    ULandscapeLayerInfoObject * LayerInfo = currentLayerInfo.LayerInfo;
+                    SetChangedLandscapeData(
+                        currentLayerInfo.LayerData, UnrealXSize, UnrealYSize, FoundLandscape->ComponentSizeQuads,
+                        [ &LandscapeEdit, LayerInfo ]( int32 X1, int32 Y1, int32 X2, int32 Y2, uint8 * Data )
+                        {
+                            LandscapeEdit.GetWeightDataFast( LayerInfo, X1, Y1, X2, Y2, Data, 0 );
+                        },
+                        [ &LandscapeEdit, LayerInfo ]( int32 X1, int32 Y1, int32 X2, int32 Y2, const uint8 * Data )
+                        {
+                            LandscapeEdit.SetAlphaData( LayerInfo, X1, Y1, X2, Y2, Data, 0 );
+                        } );
+                }
                 else
                     LandscapeEdit.SetAlphaData( currentLayerInfo.LayerInfo, MinX, MinY, MaxX, MaxY, currentLayerInfo.LayerData.GetData(), 0 );
 
@@ -3262,9 +4140,21 @@ FHoudiniLandscapeUtils::CreateAllLandscapes(
 
             // We can add the landscape to the new map
             NewLandscapes.Add(*CurrentHeightfield, FoundLandscape);        
+            SetAppliedZRanges( *CurrentHeightfield );
         }
     }
 
+    // Save all the layer infos created for the landscapes at once
+    if ( LayerPackagesToSave.Num() > 0 )
+        FEditorFileUtils::PromptForCheckoutAndSave( LayerPackagesToSave, true, false );
+
+    // Register the new landscapes' components
+    for ( ALandscape * CurrentLandscape : LandscapesToRegister )
+    {
+        if ( CurrentLandscape && !CurrentLandscape->IsPendingKill() )
+            CurrentLandscape->RegisterAllComponents();
+    }
+
     return true;
 }
 
@@ -3275,7 +4165,8 @@ FHoudiniLandscapeUtils::CreateLandscape(
     const FTransform& LandscapeTransform,
     const int32& XSize, const int32& YSize, 
     const int32& NumSectionPerLandscapeComponent, const int32& NumQuadsPerLandscapeSection,
-    UMaterialInterface* LandscapeMaterial, UMaterialInterface* LandscapeHoleMaterial )
+    UMaterialInterface* LandscapeMaterial, UMaterialInterface* LandscapeHoleMaterial,
+    const bool& bRegisterComponents )
 {
     if ( ( XSize < 2 ) || ( YSize < 2 ) )
         return nullptr;
@@ -3342,7 +4233,8 @@ FHoudiniLandscapeUtils::CreateLandscape(
     Landscape->StaticLightingLOD = FMath::DivideAndRoundUp( FMath::CeilLogTwo( ( XSize * YSize ) / ( 2048 * 2048 ) + 1 ), ( uint32 )2 );
 
     // Register all the landscape components
-    Landscape->RegisterAllComponents();
+    if ( bRegisterComponents )
+        Landscape->RegisterAllComponents();
 
     return Landscape;
 }
@@ -3447,6 +4339,59 @@ void FHoudiniLandscapeUtils::GetHeightFieldLandscapeMaterials(
     }
 }
 
+/** Normalizes the weight blended layers together, so that their weights sum to 255 for every point. **/
+/** Points where all the weight blended layers are 0 are left untouched. **/
+static void
+NormalizeWeightBlendedLayers( TArray< FLandscapeImportLayerInfo >& ImportLayerInfos, int32 LandscapeXSize, int32 LandscapeYSize )
+{
+    const int32 NumPoints = LandscapeXSize * LandscapeYSize;
+    TArray< uint8 * > WeightLayers;
+    for ( FLandscapeImportLayerInfo& ImportLayerInfo : ImportLayerInfos )
+    {
+        if ( !ImportLayerInfo.LayerInfo || ImportLayerInfo.LayerInfo->bNoWeightBlend )
+            continue;
+
+        if ( ImportLayerInfo.LayerData.Num() != NumPoints )
+            continue;
+
+        WeightLayers.Add( ImportLayerInfo.LayerData.GetData() );
+    }
+
+    // A single layer is left as is, Unreal blends it with the landscape's base
+    const int32 NumLayers = WeightLayers.Num();
+    if ( NumLayers < 2 )
+        return;
+
+    ParallelFor( LandscapeYSize, [ & ]( int32 Y )
+    {
+        for ( int32 Idx = Y * LandscapeXSize; Idx < ( Y + 1 ) * LandscapeXSize; Idx++ )
+        {
+            int32 WeightSum = 0;
+            for ( int32 LayerIdx = 0; LayerIdx < NumLayers; LayerIdx++ )
+                WeightSum += WeightLayers[ LayerIdx ][ Idx ];
+
+            if ( WeightSum == 0 || WeightSum == 255 )
+                continue;
+
+            // Scale the weights, then give the rounding error to the heaviest layer so the sum is exactly 255
+            int32 NormalizedSum = 0;
+            int32 HeaviestLayerIdx = 0;
+            for ( int32 LayerIdx = 0; LayerIdx < NumLayers; LayerIdx++ )
+            {
+                uint8& Weight = WeightLayers[ LayerIdx ][ Idx ];
+                if ( Weight > WeightLayers[ HeaviestLayerIdx ][ Idx ] )
+                    HeaviestLayerIdx = LayerIdx;
+
+                Weight = (uint8)( ( Weight * 255 + WeightSum / 2 ) / WeightSum );
+                NormalizedSum += Weight;
+            }
+
+            uint8& HeaviestWeight = WeightLayers[ HeaviestLayerIdx ][ Idx ];
+            HeaviestWeight = (uint8)FMath::Clamp( HeaviestWeight + 255 - NormalizedSum, 0, 255 );
+        }
+    }, NumPoints < HAPI_UNREAL_PARALLEL_MESH_MIN_ELEMENTS );
+}
+
 bool FHoudiniLandscapeUtils::CreateLandscapeLayers(
     FHoudiniCookParams& HoudiniCookParams,
     const TArray< const FHoudiniGeoPartObject* >& FoundLayers,
@@ -3454,7 +4399,8 @@ bool FHoudiniLandscapeUtils::CreateLandscapeLayers(
     const int32& LandscapeXSize, const int32& LandscapeYSize,
     const TMap<FString, float>& GlobalMinimums,
     const TMap<FString, float>& GlobalMaximums,
-    TArray<FLandscapeImportLayerInfo>& ImportLayerInfos )
+    TArray<FLandscapeImportLayerInfo>& ImportLayerInfos,
+    TArray<UPackage*>* LayerPackagesToSave )
 {    
     // Verifying HoudiniCookParams validity
     if ( !HoudiniCookParams.HoudiniAsset || !HoudiniCookParams.CookedTemporaryLandscapeLayers )
@@ -3468,6 +4414,9 @@ bool FHoudiniLandscapeUtils::CreateLandscapeLayers(
 
     TArray<UPackage*> CreatedLandscapeLayerPackage;
 
+    // Houdini size of each created layer, layers are resized together once they have all been read
+    TArray<FIntPoint> LayerHoudiniSizes;
+
     // Try to create all the layers
     ELandscapeImportAlphamapType ImportLayerType = ELandscapeImportAlphamapType::Additive;
     for ( TArray<const FHoudiniGeoPartObject *>::TConstIterator IterLayers( FoundLayers ); IterLayers; ++IterLayers )
@@ -3482,11 +4431,10 @@ bool FHoudiniLandscapeUtils::CreateLandscapeLayers(
         if ( LayerGeoPartObject->AssetId == -1 )
             continue;
 
-        TArray< float > FloatLayerData;
         HAPI_VolumeInfo LayerVolumeInfo;
         float LayerMin = 0;
         float LayerMax = 0;
-        if ( !FHoudiniLandscapeUtils::GetHeightfieldData( *LayerGeoPartObject, FloatLayerData, LayerVolumeInfo, LayerMin, LayerMax ) )
+        if ( !FHoudiniLandscapeUtils::GetHeightfieldMinMax( *LayerGeoPartObject, LayerVolumeInfo, LayerMin, LayerMax ) )
             continue;
 
         // No need to create flat layers as Unreal will remove them afterwards..
@@ -3523,15 +4471,18 @@ bool FHoudiniLandscapeUtils::CreateLandscapeLayers(
         if ( !currentLayerInfo.LayerInfo || !Package )
             continue;
 
-        // Convert the float data to uint8
-        // HF masks need their X/Y sizes swapped
-        if ( !FHoudiniLandscapeUtils::ConvertHeightfieldLayerToLandscapeLayer(
-            FloatLayerData, LayerVolumeInfo.yLength, LayerVolumeInfo.xLength,
+        // Read the float data tile by tile and convert it to uint8
+        if ( !FHoudiniLandscapeUtils::GetHeightfieldLayerAsLandscapeLayer(
+            *LayerGeoPartObject,
             LayerMin, LayerMax,
             LandscapeXSize, LandscapeYSize,
-            currentLayerInfo.LayerData ) )
+            currentLayerInfo.LayerData, true ) )
             continue;
 
+        // Keep track of the reused layer info's values, its package only needs saving if they change
+        const FLinearColor PreviousDebugColor = currentLayerInfo.LayerInfo->LayerUsageDebugColor;
+        const bool bPreviousNoWeightBlend = currentLayerInfo.LayerInfo->bNoWeightBlend;
+
         // We will store the data used to convert from Houdini values to int in the DebugColor
         // This is the only way we'll be able to reconvert those values back to their houdini equivalent afterwards...
         // R = Min, G = Max, B = Spacing, A = ?
@@ -3550,16 +4501,59 @@ bool FHoudiniLandscapeUtils::CreateLandscapeLayers(
             currentLayerInfo.LayerInfo->bNoWeightBlend = false;
 
         // Mark the package dirty...
-        //Package->MarkPackageDirty();
+        if ( PreviousDebugColor != currentLayerInfo.LayerInfo->LayerUsageDebugColor
+            || bPreviousNoWeightBlend != currentLayerInfo.LayerInfo->bNoWeightBlend )
+            Package->MarkPackageDirty();
 
-        CreatedLandscapeLayerPackage.Add( Package );
+        // Only save the layer infos that are new or have changed
+        if ( Package->IsDirty() )
+            CreatedLandscapeLayerPackage.Add( Package );
 
         ImportLayerInfos.Add( currentLayerInfo );
+
+        // HF masks need their X/Y sizes swapped
+        LayerHoudiniSizes.Add( FIntPoint( LayerVolumeInfo.yLength, LayerVolumeInfo.xLength ) );
+    }
+
+    // Resize the layers to the landscape size, layers sharing the same size are resampled in one pass
+    TArray<bool> LayerResized;
+    LayerResized.SetNumZeroed( ImportLayerInfos.Num() );
+    for ( int32 LayerIdx = 0; LayerIdx < ImportLayerInfos.Num(); LayerIdx++ )
+    {
+        if ( LayerResized[ LayerIdx ] )
+            continue;
+
+        TArray< TArray< uint8 > * > SameSizeLayers;
+        for ( int32 OtherIdx = LayerIdx; OtherIdx < ImportLayerInfos.Num(); OtherIdx++ )
+        {
+            if ( LayerResized[ OtherIdx ] || LayerHoudiniSizes[ OtherIdx ] != LayerHoudiniSizes[ LayerIdx ] )
+                continue;
+
+            SameSizeLayers.Add( &ImportLayerInfos[ OtherIdx ].LayerData );
+            LayerResized[ OtherIdx ] = true;
+        }
+
+        FHoudiniLandscapeUtils::ResizeLayersDataForLandscape(
+            SameSizeLayers, LayerHoudiniSizes[ LayerIdx ].X, LayerHoudiniSizes[ LayerIdx ].Y,
+            LandscapeXSize, LandscapeYSize );
     }
 
+    // Normalize the weight blended layers together if needed
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings && HoudiniRuntimeSettings->MarshallingLandscapesNormalizeWeightBlendedLayers )
+        NormalizeWeightBlendedLayers( ImportLayerInfos, LandscapeXSize, LandscapeYSize );
+
     // Autosaving the layers prevents them for being deleted with the Asset
-    // Save the packages created for the LayerInfos
-    FEditorFileUtils::PromptForCheckoutAndSave( CreatedLandscapeLayerPackage, true, false );
+    // Save the packages created for the LayerInfos, or let the caller save them with other landscapes' layers
+    if ( LayerPackagesToSave )
+    {
+        for ( UPackage * Package : CreatedLandscapeLayerPackage )
+            LayerPackagesToSave->AddUnique( Package );
+    }
+    else if ( CreatedLandscapeLayerPackage.Num() > 0 )
+    {
+        FEditorFileUtils::PromptForCheckoutAndSave( CreatedLandscapeLayerPackage, true, false );
+    }
 
     return true;
 }
@@ -3584,9 +4578,29 @@ FHoudiniLandscapeUtils::CreateLandscapeLayerInfoObject( FHoudiniCookParams& Houd
     FString PackageName = Path + LayerObjectName.ToString();
     PackageName = UPackageTools::SanitizePackageName( PackageName );
 
-    // See if package exists, if it does, reuse it
+    // See if this asset already cooked that layer, if it did, reuse its package
     bool bCreatedPackage = false;
-    Package = FindPackage( nullptr, *PackageName );
+    Package = nullptr;
+    if ( HoudiniCookParams.CookedTemporaryLandscapeLayers )
+    {
+        for ( auto& CookedLayer : *HoudiniCookParams.CookedTemporaryLandscapeLayers )
+        {
+            UPackage * CookedPackage = CookedLayer.Key.Get();
+            if ( CookedPackage && !CookedPackage->IsPendingKill() && CookedPackage->GetName() == PackageName )
+            {
+                Package = CookedPackage;
+                break;
+            }
+        }
+    }
+
+    // See if package exists in memory or on disk, if it does, reuse it
+    if ( !Package )
+        Package = FindPackage( nullptr, *PackageName );
+
+    if ( ( !Package || Package->IsPendingKill() ) && FPackageName::DoesPackageExist( PackageName ) )
+        Package = LoadPackage( nullptr, *PackageName, LOAD_None );
+
     if ( !Package || Package->IsPendingKill() )
     {
         // We need to create a new package
@@ -3607,6 +4621,10 @@ FHoudiniLandscapeUtils::CreateLandscapeLayerInfoObject( FHoudiniCookParams& Houd
         LayerInfo = (ULandscapeLayerInfoObject*)StaticFindObjectFast(ULandscapeLayerInfoObject::StaticClass(), Package, LayerObjectName);
     }
 
+    // The existing layer info matches, no need to update it or dirty its package
+    if ( LayerInfo && !LayerInfo->IsPendingKill() && LayerInfo->LayerName == FName( LayerName ) )
+        return LayerInfo;
+
     if ( !LayerInfo || LayerInfo->IsPendingKill() )
     {
         // Create a new LandscapeLayerInfoObject in the package
@@ -3879,6 +4897,157 @@ FHoudiniLandscapeUtils::InitDefaultHeightfieldMask(
 }
 
 
+/** Landscape backups are stored as a header followed by one compressed block of values per landscape component. **/
+struct FHoudiniLandscapeBackupHeader
+{
+    uint32 Magic = HAPI_UNREAL_LANDSCAPE_BACKUP_MAGIC;
+    int32 Version = HAPI_UNREAL_LANDSCAPE_BACKUP_VERSION;
+    int32 MinX = 0;
+    int32 MinY = 0;
+    int32 MaxX = 0;
+    int32 MaxY = 0;
+    int32 BlockSizeQuads = 0;
+    FVector Scale = FVector::OneVector;
+    TArray< FString > LayerNames;
+    TArray< FString > LayerInfoPaths;
+
+    int32 GetSizeX() const { return MaxX - MinX + 1; }
+    int32 GetSizeY() const { return MaxY - MinY + 1; }
+    int32 GetNumBlocksX() const { return FMath::Max( 1, ( GetSizeX() - 1 ) / BlockSizeQuads ); }
+    int32 GetNumBlocksY() const { return FMath::Max( 1, ( GetSizeY() - 1 ) / BlockSizeQuads ); }
+
+    // Returns the range of values covered by a block, the last block absorbs the landscape's last row/column
+    void GetBlockRange( int32 BlockIdx, int32& X1, int32& Y1, int32& X2, int32& Y2 ) const
+    {
+        const int32 BlockX = BlockIdx % GetNumBlocksX();
+        const int32 BlockY = BlockIdx / GetNumBlocksX();
+        X1 = BlockX * BlockSizeQuads;
+        Y1 = BlockY * BlockSizeQuads;
+        X2 = ( BlockX == GetNumBlocksX() - 1 ) ? GetSizeX() - 1 : X1 + BlockSizeQuads - 1;
+        Y2 = ( BlockY == GetNumBlocksY() - 1 ) ? GetSizeY() - 1 : Y1 + BlockSizeQuads - 1;
+    }
+
+    friend FArchive& operator<<( FArchive& Ar, FHoudiniLandscapeBackupHeader& Header )
+    {
+        Ar << Header.Magic << Header.Version;
+        Ar << Header.MinX << Header.MinY << Header.MaxX << Header.MaxY << Header.BlockSizeQuads;
+        Ar << Header.Scale << Header.LayerNames << Header.LayerInfoPaths;
+        return Ar;
+    }
+};
+
+/** Splits landscape values in component blocks and compresses them, block per block. **/
+template< typename T >
+static void
+WriteLandscapeBackupBlocks( FArchive& Ar, const FHoudiniLandscapeBackupHeader& Header, const TArray< T >& Values )
+{
+    const int32 NumBlocks = Header.GetNumBlocksX() * Header.GetNumBlocksY();
+    TArray< TArray< uint8 > > CompressedBlocks;
+    TArray< int32 > UncompressedSizes;
+    CompressedBlocks.SetNum( NumBlocks );
+    UncompressedSizes.SetNumZeroed( NumBlocks );
+
+    ParallelFor( NumBlocks, [ & ]( int32 BlockIdx )
+    {
+        int32 X1, Y1, X2, Y2;
+        Header.GetBlockRange( BlockIdx, X1, Y1, X2, Y2 );
+
+        const int32 BlockSizeX = X2 - X1 + 1;
+        TArray< T > BlockValues;
+        BlockValues.SetNumUninitialized( BlockSizeX * ( Y2 - Y1 + 1 ) );
+        for ( int32 Y = Y1; Y <= Y2; Y++ )
+            FMemory::Memcpy( &BlockValues[ ( Y - Y1 ) * BlockSizeX ], &Values[ Y * Header.GetSizeX() + X1 ], BlockSizeX * sizeof( T ) );
+
+        const int32 UncompressedSize = BlockValues.Num() * sizeof( T );
+        int32 CompressedSize = FCompression::CompressMemoryBound( COMPRESS_ZLIB, UncompressedSize );
+        TArray< uint8 > & Compressed = CompressedBlocks[ BlockIdx ];
+        Compressed.SetNumUninitialized( CompressedSize );
+        if ( FCompression::CompressMemory( COMPRESS_ZLIB, Compressed.GetData(), CompressedSize, BlockValues.GetData(), UncompressedSize )
+            && CompressedSize < UncompressedSize )
+        {
+            Compressed.SetNum( CompressedSize, false );
+        }
+        else
+        {
+            // Blocks that can't be compressed are stored as is
+            Compressed.SetNumUninitialized( UncompressedSize );
+            FMemory::Memcpy( Compressed.GetData(), BlockValues.GetData(), UncompressedSize );
+        }
+
+        UncompressedSizes[ BlockIdx ] = UncompressedSize;
+    } );
+
+    for ( int32 BlockIdx = 0; BlockIdx < NumBlocks; BlockIdx++ )
+    {
+        int32 CompressedSize = CompressedBlocks[ BlockIdx ].Num();
+        Ar << UncompressedSizes[ BlockIdx ] << CompressedSize;
+        Ar.Serialize( CompressedBlocks[ BlockIdx ].GetData(), CompressedSize );
+    }
+}
+
+/** Reads landscape values written by WriteLandscapeBackupBlocks, the blocks are decompressed in parallel. **/
+template< typename T >
+static bool
+ReadLandscapeBackupBlocks(
+    const uint8 * FileData, int64 FileSize, int64& Offset,
+    const FHoudiniLandscapeBackupHeader& Header, TArray< T >& Values )
+{
+    const int32 NumBlocks = Header.GetNumBlocksX() * Header.GetNumBlocksY();
+    Values.SetNumUninitialized( Header.GetSizeX() * Header.GetSizeY() );
+
+    // Locate all the blocks first
+    TArray< int64 > BlockOffsets;
+    TArray< int32 > CompressedSizes;
+    for ( int32 BlockIdx = 0; BlockIdx < NumBlocks; BlockIdx++ )
+    {
+        int32 X1, Y1, X2, Y2;
+        Header.GetBlockRange( BlockIdx, X1, Y1, X2, Y2 );
+
+        if ( Offset + 2 * (int64)sizeof( int32 ) > FileSize )
+            return false;
+
+        int32 UncompressedSize = 0;
+        int32 CompressedSize = 0;
+        FMemory::Memcpy( &UncompressedSize, FileData + Offset, sizeof( int32 ) );
+        FMemory::Memcpy( &CompressedSize, FileData + Offset + sizeof( int32 ), sizeof( int32 ) );
+        Offset += 2 * sizeof( int32 );
+
+        if ( UncompressedSize != ( X2 - X1 + 1 ) * ( Y2 - Y1 + 1 ) * (int32)sizeof( T )
+            || CompressedSize <= 0 || Offset + CompressedSize > FileSize )
+            return false;
+
+        BlockOffsets.Add( Offset );
+        CompressedSizes.Add( CompressedSize );
+        Offset += CompressedSize;
+    }
+
+    TArray< bool > BlockRead;
+    BlockRead.SetNumZeroed( NumBlocks );
+    ParallelFor( NumBlocks, [ & ]( int32 BlockIdx )
+    {
+        int32 X1, Y1, X2, Y2;
+        Header.GetBlockRange( BlockIdx, X1, Y1, X2, Y2 );
+
+        const int32 BlockSizeX = X2 - X1 + 1;
+        TArray< T > BlockValues;
+        BlockValues.SetNumUninitialized( BlockSizeX * ( Y2 - Y1 + 1 ) );
+
+        const int32 UncompressedSize = BlockValues.Num() * sizeof( T );
+        const uint8 * BlockData = FileData + BlockOffsets[ BlockIdx ];
+        if ( CompressedSizes[ BlockIdx ] == UncompressedSize )
+            FMemory::Memcpy( BlockValues.GetData(), BlockData, UncompressedSize );
+        else if ( !FCompression::UncompressMemory( COMPRESS_ZLIB, BlockValues.GetData(), UncompressedSize, BlockData, CompressedSizes[ BlockIdx ] ) )
+            return;
+
+        for ( int32 Y = Y1; Y <= Y2; Y++ )
+            FMemory::Memcpy( &Values[ Y * Header.GetSizeX() + X1 ], &BlockValues[ ( Y - Y1 ) * BlockSizeX ], BlockSizeX * sizeof( T ) );
+
+        BlockRead[ BlockIdx ] = true;
+    } );
+
+    return !BlockRead.Contains( false );
+}
+
 bool
 FHoudiniLandscapeUtils::BackupLandscapeToFile(const FString& BaseName, ALandscapeProxy* Landscape)
 {
@@ -3890,26 +5059,149 @@ FHoudiniLandscapeUtils::BackupLandscapeToFile(const FString& BaseName, ALandscap
     if (!LandscapeInfo)
         return false;
 
-    // Save Height data to file
-    //FString HeightSave = TEXT("/Game/HoudiniEngine/Temp/HeightCache.png");    
-    FString HeightSave = BaseName + TEXT("_height.png");
-    LandscapeInfo->ExportHeightmap(HeightSave);
-    Landscape->ReimportHeightmapFilePath = HeightSave;
+    FHoudiniLandscapeBackupHeader Header;
+    if ( !LandscapeInfo->GetLandscapeExtent( Header.MinX, Header.MinY, Header.MaxX, Header.MaxY ) )
+        return false;
+
+    Header.BlockSizeQuads = FMath::Max( 1, Landscape->ComponentSizeQuads );
+    Header.Scale = Landscape->GetActorScale3D();
 
-    // Save each layer to a file
+    TArray< ULandscapeLayerInfoObject * > LayerInfos;
     for ( int LayerIndex = 0; LayerIndex < LandscapeInfo->Layers.Num(); LayerIndex++ )
     {
-        FName CurrentLayerName = LandscapeInfo->Layers[LayerIndex].GetLayerName();
-        //ULandscapeLayerInfoObject* CurrentLayerInfo = LandscapeInfo->GetLayerInfoByName(CurrentLayerName, Landscape);
         ULandscapeLayerInfoObject* CurrentLayerInfo = LandscapeInfo->Layers[LayerIndex].LayerInfoObj;
         if ( !CurrentLayerInfo || CurrentLayerInfo->IsPendingKill() )
             continue;
 
-        FString LayerSave = BaseName + CurrentLayerName.ToString() + TEXT(".png");
-        LandscapeInfo->ExportLayer(CurrentLayerInfo, LayerSave);
+        LayerInfos.Add( CurrentLayerInfo );
+        Header.LayerNames.Add( LandscapeInfo->Layers[LayerIndex].GetLayerName().ToString() );
+        Header.LayerInfoPaths.Add( CurrentLayerInfo->GetPathName() );
+    }
+
+    FBufferArchive Archive;
+    Archive << Header;
+
+    // Save the height data, then each layer's weights
+    FLandscapeEditDataInterface LandscapeEdit( LandscapeInfo );
+    {
+        TArray< uint16 > HeightData;
+        HeightData.SetNumZeroed( Header.GetSizeX() * Header.GetSizeY() );
+        LandscapeEdit.GetHeightDataFast( Header.MinX, Header.MinY, Header.MaxX, Header.MaxY, HeightData.GetData(), 0 );
+        WriteLandscapeBackupBlocks( Archive, Header, HeightData );
+    }
+
+    for ( ULandscapeLayerInfoObject * CurrentLayerInfo : LayerInfos )
+    {
+        TArray< uint8 > LayerData;
+        LayerData.SetNumZeroed( Header.GetSizeX() * Header.GetSizeY() );
+        LandscapeEdit.GetWeightDataFast( CurrentLayerInfo, Header.MinX, Header.MinY, Header.MaxX, Header.MaxY, LayerData.GetData(), 0 );
+        WriteLandscapeBackupBlocks( Archive, Header, LayerData );
+    }
+
+    // The base name can be a content path, convert it to a file on disk
+    FString BackupFile = BaseName;
+    FPackageName::TryConvertLongPackageNameToFilename( BaseName, BackupFile );
+    BackupFile += TEXT( "." );
+    BackupFile += HAPI_UNREAL_LANDSCAPE_BACKUP_EXTENSION;
+
+    if ( !FFileHelper::SaveArrayToFile( Archive, *BackupFile ) )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Could not save the input landscape's backup to %s." ), *BackupFile );
+        return false;
+    }
+
+    // The restore reads the backup from the heightmap's reimport path
+    Landscape->ReimportHeightmapFilePath = BackupFile;
+
+    return true;
+}
+
+bool
+FHoudiniLandscapeUtils::RestoreLandscapeFromBackupFile(
+    ALandscapeProxy* LandscapeProxy, const FString& BackupFile, TArray< ULandscapeLayerInfoObject* >& SourceLayers )
+{
+    ULandscapeInfo* LandscapeInfo = LandscapeProxy ? LandscapeProxy->GetLandscapeInfo() : nullptr;
+    if ( !LandscapeInfo )
+        return false;
+
+    // Map the backup file in memory if the platform allows it, or read it
+    TUniquePtr< IMappedFileHandle > MappedFile( FPlatformFileManager::Get().GetPlatformFile().OpenMapped( *BackupFile ) );
+    TUniquePtr< IMappedFileRegion > MappedRegion;
+    TArray< uint8 > LoadedFile;
+    const uint8 * FileData = nullptr;
+    int64 FileSize = 0;
+    if ( MappedFile.IsValid() )
+    {
+        MappedRegion.Reset( MappedFile->MapRegion() );
+        if ( MappedRegion.IsValid() )
+        {
+            FileData = MappedRegion->GetMappedPtr();
+            FileSize = MappedRegion->GetMappedSize();
+        }
+    }
+
+    if ( !FileData )
+    {
+        if ( !FFileHelper::LoadFileToArray( LoadedFile, *BackupFile ) )
+            return false;
+
+        FileData = LoadedFile.GetData();
+        FileSize = LoadedFile.Num();
+    }
+
+    FHoudiniLandscapeBackupHeader Header;
+    FLargeMemoryReader Reader( FileData, FileSize );
+    Reader << Header;
+    if ( Reader.IsError() || Header.Magic != HAPI_UNREAL_LANDSCAPE_BACKUP_MAGIC
+        || Header.Version != HAPI_UNREAL_LANDSCAPE_BACKUP_VERSION || Header.BlockSizeQuads <= 0
+        || Header.LayerNames.Num() != Header.LayerInfoPaths.Num() )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Could not restore the landscape actor's source data, %s is not a valid backup." ), *BackupFile );
+        return false;
+    }
+
+    int32 MinX, MinY, MaxX, MaxY;
+    if ( !LandscapeInfo->GetLandscapeExtent( MinX, MinY, MaxX, MaxY )
+        || MinX != Header.MinX || MinY != Header.MinY || MaxX != Header.MaxX || MaxY != Header.MaxY )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Could not restore the landscape actor's source data, its extent does not match the backup's." ) );
+        return false;
+    }
+
+    if ( !LandscapeProxy->GetActorScale3D().Equals( Header.Scale ) )
+        HOUDINI_LOG_WARNING( TEXT( "The landscape actor's scale has changed since its source data was backed up." ) );
+
+    int64 Offset = Reader.Tell();
+    TArray< uint16 > HeightData;
+    if ( !ReadLandscapeBackupBlocks( FileData, FileSize, Offset, Header, HeightData ) )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Could not restore the landscape actor's source height data." ) );
+        return false;
+    }
+
+    FHeightmapAccessor<false> HeightmapAccessor( LandscapeInfo );
+    HeightmapAccessor.SetData( MinX, MinY, MaxX, MaxY, HeightData.GetData() );
+
+    for ( int32 LayerIdx = 0; LayerIdx < Header.LayerNames.Num(); LayerIdx++ )
+    {
+        TArray< uint8 > LayerData;
+        if ( !ReadLandscapeBackupBlocks( FileData, FileSize, Offset, Header, LayerData ) )
+        {
+            HOUDINI_LOG_ERROR( TEXT( "Could not restore the landscape actor's source layer data for %s." ), *Header.LayerNames[ LayerIdx ] );
+            return false;
+        }
+
+        ULandscapeLayerInfoObject * CurrentLayerInfo = LoadObject< ULandscapeLayerInfoObject >( nullptr, *Header.LayerInfoPaths[ LayerIdx ] );
+        if ( !CurrentLayerInfo || CurrentLayerInfo->IsPendingKill() )
+        {
+            HOUDINI_LOG_WARNING( TEXT( "Could not find the layer info for %s when restoring the landscape actor's source data." ), *Header.LayerNames[ LayerIdx ] );
+            continue;
+        }
+
+        FAlphamapAccessor<false, false> AlphamapAccessor( LandscapeInfo, CurrentLayerInfo );
+        AlphamapAccessor.SetData( MinX, MinY, MaxX, MaxY, LayerData.GetData(), ELandscapeLayerPaintingRestriction::None );
 
-        // Update the file reimport path on the input landscape for this layer
-        LandscapeInfo->GetLayerEditorSettings(CurrentLayerInfo).ReimportLayerFilePath = LayerSave;
+        SourceLayers.Add( CurrentLayerInfo );
     }
 
     return true;
@@ -3925,31 +5217,40 @@ FHoudiniLandscapeUtils::RestoreLandscapeFromFile( ALandscapeProxy* LandscapeProx
     if (!LandscapeInfo)
         return false;
 
-    // Restore Height data from the backup file
-    FString ReimportFile = LandscapeProxy->ReimportHeightmapFilePath;
-    if ( !ImportLandscapeData(LandscapeInfo, ReimportFile, TEXT("height") ) )
-        HOUDINI_LOG_ERROR(TEXT("Could not restore the landscape actor's source height data."));
-
-    
-    // Restore each layer from the backup file
     TArray< ULandscapeLayerInfoObject* > SourceLayers;
-    for ( int LayerIndex = 0; LayerIndex < LandscapeProxy->EditorLayerSettings.Num(); LayerIndex++ )
+    FString ReimportFile = LandscapeProxy->ReimportHeightmapFilePath;
+    if ( FPaths::GetExtension( ReimportFile ).Equals( HAPI_UNREAL_LANDSCAPE_BACKUP_EXTENSION, ESearchCase::IgnoreCase ) )
     {
-        ULandscapeLayerInfoObject* CurrentLayerInfo = LandscapeProxy->EditorLayerSettings[LayerIndex].LayerInfoObj;
-        if (!CurrentLayerInfo || CurrentLayerInfo->IsPendingKill())
-            continue;
+        // Restore the height and layer data from the binary backup
+        if ( !RestoreLandscapeFromBackupFile( LandscapeProxy, ReimportFile, SourceLayers ) )
+            return false;
+    }
+    else
+    {
+        // Restore Height data from the backup file
+        if ( !ImportLandscapeData(LandscapeInfo, ReimportFile, TEXT("height") ) )
+            HOUDINI_LOG_ERROR(TEXT("Could not restore the landscape actor's source height data."));
+
+        // Restore each layer from the backup file
+        for ( int LayerIndex = 0; LayerIndex < LandscapeProxy->EditorLayerSettings.Num(); LayerIndex++ )
+        {
+            ULandscapeLayerInfoObject* CurrentLayerInfo = LandscapeProxy->EditorLayerSettings[LayerIndex].LayerInfoObj;
+            if (!CurrentLayerInfo || CurrentLayerInfo->IsPendingKill())
+                continue;
 
-        FString CurrentLayerName = CurrentLayerInfo->LayerName.ToString();
-        ReimportFile = LandscapeProxy->EditorLayerSettings[LayerIndex].ReimportLayerFilePath;
+            FString CurrentLayerName = CurrentLayerInfo->LayerName.ToString();
+            ReimportFile = LandscapeProxy->EditorLayerSettings[LayerIndex].ReimportLayerFilePath;
 
-        if (!ImportLandscapeData(LandscapeInfo, ReimportFile, CurrentLayerName, CurrentLayerInfo))
-            HOUDINI_LOG_ERROR( TEXT("Could not restore the landscape actor's source height data.") );
+            if (!ImportLandscapeData(LandscapeInfo, ReimportFile, CurrentLayerName, CurrentLayerInfo))
+                HOUDINI_LOG_ERROR( TEXT("Could not restore the landscape actor's source height data.") );
 
-        SourceLayers.Add( CurrentLayerInfo );
+            SourceLayers.Add( CurrentLayerInfo );
+        }
     }
 
     // Iterate on the landscape info's layer to remove any layer that could have been added by Houdini
-    for (int LayerIndex = 0; LayerIndex < LandscapeInfo->Layers.Num(); LayerIndex++)
+    // Iterate backwards as deleting a layer removes it from the array
+    for (int LayerIndex = LandscapeInfo->Layers.Num() - 1; LayerIndex >= 0; LayerIndex--)
     {
         ULandscapeLayerInfoObject* CurrentLayerInfo = LandscapeInfo->Layers[LayerIndex].LayerInfoObj;
         if ( SourceLayers.Contains( CurrentLayerInfo ) )
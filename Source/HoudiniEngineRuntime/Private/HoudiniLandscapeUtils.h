@@ -36,6 +36,43 @@
 
 struct FHoudiniCookParams;
 
+/** A whole landscape sent as a single heightfield, kept so its volumes can be patched when only some components changed. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeHeightfieldInput
+{
+    /** A layer sent as a heightfield volume and the conversion used for its values. **/
+    struct FLayer
+    {
+        int32 LayerIndex = -1;
+        HAPI_NodeId VolumeNodeId = -1;
+        FLinearColor LayerUsageDebugColor = FLinearColor::White;
+        uint8 IntMin = 0;
+        uint8 IntMax = 0;
+        float LayerMin = 0.0f;
+        float LayerSpacing = 0.0f;
+    };
+
+    void Reset() { *this = FHoudiniLandscapeHeightfieldInput(); }
+
+    bool IsValid() const { return HeightfieldNodeId >= 0 && HeightNodeId >= 0; }
+
+    /** Landscape, materials and transform the heightfield was created from. **/
+    TWeakObjectPtr< ALandscapeProxy > LandscapeProxy;
+    TWeakObjectPtr< UMaterialInterface > LandscapeMaterial;
+    TWeakObjectPtr< UMaterialInterface > LandscapeHoleMaterial;
+    FTransform LandscapeTransform;
+
+    /** Landscape extent in vertices and number of layers when it was sent. **/
+    int32 MinX = 0;
+    int32 MinY = 0;
+    int32 MaxX = 0;
+    int32 MaxY = 0;
+    int32 NumLayers = 0;
+
+    HAPI_NodeId HeightfieldNodeId = -1;
+    HAPI_NodeId HeightNodeId = -1;
+    TArray< FLayer > Layers;
+};
+
 struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
 {
     public:
@@ -62,7 +99,8 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
             const int32& NumSectionPerLandscapeComponent,
             const int32& NumQuadsPerLandscapeSection,
             UMaterialInterface* LandscapeMaterial,
-            UMaterialInterface* LandscapeHoleMaterial );
+            UMaterialInterface* LandscapeHoleMaterial,
+            const bool& bRegisterComponents = true );
 
         // Returns the materials assigned to the heightfield
         static void GetHeightFieldLandscapeMaterials(
@@ -82,7 +120,8 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
             const int32& LandscapeXSize, const int32& LandscapeYSize,
             const TMap<FString, float>& GlobalMinimums,
             const TMap<FString, float>& GlobalMaximums,
-            TArray<FLandscapeImportLayerInfo>& ImportLayerInfos );
+            TArray<FLandscapeImportLayerInfo>& ImportLayerInfos,
+            TArray<UPackage*>* LayerPackagesToSave = nullptr );
 
         /** Updates a reference to a generated landscape by the newly created one **/
         static bool UpdateOldLandscapeReference(
@@ -110,6 +149,18 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
             TMap<FString, float>& GlobalMinimums,
             TMap<FString, float>& GlobalMaximums);
 
+        // Forgets the cached Z ranges of the volumes of the given assets, once their landscapes are released
+        static void ReleaseVolumeZRanges( int32 SessionIndex, const TSet< HAPI_NodeId >& AssetIds );
+
+        // Forgets all the cached Z ranges, volume node ids don't survive a session restart
+        static void ClearVolumeZRanges();
+
+        // Extract the min and max values of a given heightfield, reading its values tile by tile
+        static bool GetHeightfieldMinMax(
+            const FHoudiniGeoPartObject& Heightfield,
+            HAPI_VolumeInfo& VolumeInfo,
+            float& FloatMin, float& FloatMax );
+
         // Extract the float values of a given heightfield
         static bool GetHeightfieldData(
             const FHoudiniGeoPartObject& Heightfield,
@@ -135,6 +186,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
             const int32& LandscapeXSize, const int32& LandscapeYSize,
             TArray< uint8 >& LayerData, const bool& NoResize = false );
 
+        // Reads a heightfield layer tile by tile and converts it to Unreal uint8, without holding all its float values
+        static bool GetHeightfieldLayerAsLandscapeLayer(
+            const FHoudiniGeoPartObject& LayerGeoPartObject,
+            const float& LayerMin, const float& LayerMax,
+            const int32& LandscapeXSize, const int32& LandscapeYSize,
+            TArray< uint8 >& LayerData, const bool& NoResize = false );
 
         // Calculates the closest "unreal friendly" size given a heighfield volume's size
         static bool CalcLandscapeSizeFromHeightfieldSize(
@@ -158,6 +215,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
             const int32& SizeX, const int32& SizeY,
             const int32& NewSizeX, const int32& NewSizeY );
 
+        // Resizes several layers of the same size in one pass so that they fit the Landscape size
+        static bool ResizeLayersDataForLandscape(
+            const TArray< TArray< uint8 > * >& Layers,
+            const int32& SizeX, const int32& SizeY,
+            const int32& NewSizeX, const int32& NewSizeY );
+
         // Checks if a layer's value should be converted in the [0 1] range
         static bool IsUnitLandscapeLayer(
             const FHoudiniGeoPartObject& LayerGeoPartObject );
@@ -167,9 +230,16 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
         //--------------------------------------------------------------------------------------------------
 
 #if WITH_EDITOR
-        // Creates a heightfield from a Landscape
+        // Creates a heightfield from a Landscape, optionally keeping what is needed to patch it later
         static bool CreateHeightfieldFromLandscape(
-            ALandscapeProxy* LandscapeProxy, HAPI_NodeId& CreatedHeightfieldNodeId );
+            ALandscapeProxy* LandscapeProxy, HAPI_NodeId& CreatedHeightfieldNodeId,
+            FHoudiniLandscapeHeightfieldInput* OutHeightfieldInput = nullptr );
+
+        // Patches a heightfield created from a whole Landscape with the data of the given components only
+        // Returns false if the landscape changed in a way that needs the heightfield to be created again
+        static bool UpdateHeightfieldFromLandscapeComponents(
+            const TSet< TWeakObjectPtr< ULandscapeComponent > >& DirtyComponents,
+            FHoudiniLandscapeHeightfieldInput& HeightfieldInput );
 
         // Creates multiple heightfield from an array of Landscape Components
         static bool CreateHeightfieldFromLandscapeComponentArray(
@@ -285,6 +355,10 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
         static bool RestoreLandscapeFromFile(
             ALandscapeProxy* LandscapeProxy );
 
+        // Restores the height and layer data saved in a binary backup by BackupLandscapeToFile
+        static bool RestoreLandscapeFromBackupFile(
+            ALandscapeProxy* LandscapeProxy, const FString& BackupFile, TArray< ULandscapeLayerInfoObject* >& SourceLayers );
+
         static bool ImportLandscapeData(
             ULandscapeInfo* LandscapeInfo, const FString& Filename, const FString& LayerName, ULandscapeLayerInfoObject* LayerInfoObject = nullptr);
 
@@ -300,7 +374,8 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
             TArray<FVector>& LandscapeNormalArray,
             TArray<FVector>& LandscapeUVArray, 
             TArray<FIntPoint>& LandscapeComponentVertexIndicesArray, 
-            TArray<const char *>& LandscapeComponentNameArray,
+            TArray<FString>& LandscapeComponentNames,
+            TArray<int32>& LandscapeComponentNameIndices,
             TArray<FLinearColor>& LandscapeLightmapValues );
 #endif
 
@@ -321,8 +396,10 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
             const HAPI_NodeId& NodeId, const TArray<FIntPoint>& LandscapeComponentVertexIndicesArray );
 
         // Add the Component Name attribute extracted from a landscape
+        // Each point stores the index of its component's name in LandscapeComponentNames
         static bool AddLandscapeComponentNameAttribute(
-            const HAPI_NodeId& NodeId, const TArray<const char *>& LandscapeComponentNameArray );
+            const HAPI_NodeId& NodeId, const TArray<FString>& LandscapeComponentNames,
+            const TArray<int32>& LandscapeComponentNameIndices );
 
         // Add the lightmap color attribute extracted from a landscape
         static bool AddLandscapeLightmapColorAttribute(
@@ -357,10 +434,6 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
             const HAPI_NodeId& NodeId, ALandscapeProxy * LandscapeProxy );
 #endif
 
-        // Helper functions to extract color from a texture
-        static FColor PickVertexColorFromTextureMip(
-            const uint8 * MipBytes, FVector2D & UVCoord, int32 MipWidth, int32 MipHeight);
-
         /*
         // Duplicate a given Landscape. This will create a new package for it. This will also create necessary
         // materials, textures, landscape layers and their corresponding packages.
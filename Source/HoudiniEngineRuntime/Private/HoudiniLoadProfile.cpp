@@ -0,0 +1,185 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "HoudiniLoadProfile.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniAssetComponent.h"
+
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+
+FHoudiniLoadProfile::FHoudiniLoadProfile()
+    : bInProgress( false )
+{
+    for ( int32 PhaseIdx = 0; PhaseIdx < EHoudiniLoadProfilePhase::MAX; ++PhaseIdx )
+    {
+        PhaseSeconds[ PhaseIdx ] = 0.0;
+        PhaseStartTimes[ PhaseIdx ] = 0.0;
+    }
+}
+
+void
+FHoudiniLoadProfile::Start()
+{
+    for ( int32 PhaseIdx = 0; PhaseIdx < EHoudiniLoadProfilePhase::MAX; ++PhaseIdx )
+    {
+        PhaseSeconds[ PhaseIdx ] = 0.0;
+        PhaseStartTimes[ PhaseIdx ] = 0.0;
+    }
+
+    bInProgress = true;
+}
+
+void
+FHoudiniLoadProfile::BeginPhase( EHoudiniLoadProfilePhase::Type Phase )
+{
+    if ( bInProgress )
+        PhaseStartTimes[ Phase ] = FPlatformTime::Seconds();
+}
+
+void
+FHoudiniLoadProfile::EndPhase( EHoudiniLoadProfilePhase::Type Phase )
+{
+    if ( !bInProgress || PhaseStartTimes[ Phase ] <= 0.0 )
+        return;
+
+    PhaseSeconds[ Phase ] += FPlatformTime::Seconds() - PhaseStartTimes[ Phase ];
+    PhaseStartTimes[ Phase ] = 0.0;
+}
+
+void
+FHoudiniLoadProfile::Finish()
+{
+    bInProgress = false;
+}
+
+double
+FHoudiniLoadProfile::GetTotalSeconds() const
+{
+    double TotalSeconds = 0.0;
+    for ( int32 PhaseIdx = 0; PhaseIdx < EHoudiniLoadProfilePhase::MAX; ++PhaseIdx )
+        TotalSeconds += PhaseSeconds[ PhaseIdx ];
+
+    return TotalSeconds;
+}
+
+const TCHAR *
+FHoudiniLoadProfile::GetPhaseName( EHoudiniLoadProfilePhase::Type Phase )
+{
+    switch ( Phase )
+    {
+        case EHoudiniLoadProfilePhase::Deserialization:     return TEXT( "Deserialization" );
+        case EHoudiniLoadProfilePhase::PostLoad:            return TEXT( "Post Load" );
+        case EHoudiniLoadProfilePhase::RenderState:         return TEXT( "Render State" );
+        case EHoudiniLoadProfilePhase::Reinstantiation:     return TEXT( "Reinstantiation" );
+        case EHoudiniLoadProfilePhase::InputUpload:         return TEXT( "Input Upload" );
+        case EHoudiniLoadProfilePhase::Recook:              return TEXT( "Recook" );
+        default:                                            return TEXT( "Unknown" );
+    }
+}
+
+void
+FHoudiniLoadProfile::DumpSlowestComponents( int32 Count )
+{
+    TArray< const UHoudiniAssetComponent * > Components;
+    for ( TObjectIterator< UHoudiniAssetComponent > Iter; Iter; ++Iter )
+    {
+        const UHoudiniAssetComponent * HoudiniAssetComponent = *Iter;
+        if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() || HoudiniAssetComponent->IsTemplate() )
+            continue;
+
+        UWorld * World = HoudiniAssetComponent->GetWorld();
+        if ( !World || World->WorldType != EWorldType::Editor || !HoudiniAssetComponent->GetOwner() )
+            continue;
+
+        if ( HoudiniAssetComponent->GetLoadProfile().GetTotalSeconds() > 0.0 )
+            Components.Add( HoudiniAssetComponent );
+    }
+
+    Components.Sort( []( const UHoudiniAssetComponent & A, const UHoudiniAssetComponent & B )
+    {
+        return A.GetLoadProfile().GetTotalSeconds() > B.GetLoadProfile().GetTotalSeconds();
+    } );
+
+    // Totals of all the loaded components, to see which phase dominates the level load.
+    double TotalPhaseSeconds[ EHoudiniLoadProfilePhase::MAX ] = {};
+    int32 InProgressCount = 0;
+    for ( const UHoudiniAssetComponent * HoudiniAssetComponent : Components )
+    {
+        const FHoudiniLoadProfile & Profile = HoudiniAssetComponent->GetLoadProfile();
+        for ( int32 PhaseIdx = 0; PhaseIdx < EHoudiniLoadProfilePhase::MAX; ++PhaseIdx )
+            TotalPhaseSeconds[ PhaseIdx ] += Profile.PhaseSeconds[ PhaseIdx ];
+
+        if ( Profile.bInProgress )
+            InProgressCount++;
+    }
+
+    FString TotalPhases;
+    double TotalSeconds = 0.0;
+    for ( int32 PhaseIdx = 0; PhaseIdx < EHoudiniLoadProfilePhase::MAX; ++PhaseIdx )
+    {
+        TotalPhases += FString::Printf( TEXT( "  %s %.1f" ),
+            GetPhaseName( (EHoudiniLoadProfilePhase::Type) PhaseIdx ), TotalPhaseSeconds[ PhaseIdx ] * 1000.0 );
+        TotalSeconds += TotalPhaseSeconds[ PhaseIdx ];
+    }
+
+    HOUDINI_LOG_MESSAGE( TEXT( "Houdini actors load cost, %d actors (%d still loading), times in ms:" ),
+        Components.Num(), InProgressCount );
+    HOUDINI_LOG_MESSAGE( TEXT( "    %-32s %9.1f |%s" ), TEXT( "(all actors)" ), TotalSeconds * 1000.0, *TotalPhases );
+
+    for ( int32 ComponentIdx = 0; ComponentIdx < Components.Num() && ComponentIdx < Count; ++ComponentIdx )
+    {
+        const FHoudiniLoadProfile & Profile = Components[ ComponentIdx ]->GetLoadProfile();
+
+        FString Phases;
+        for ( int32 PhaseIdx = 0; PhaseIdx < EHoudiniLoadProfilePhase::MAX; ++PhaseIdx )
+        {
+            Phases += FString::Printf( TEXT( "  %s %.1f" ),
+                GetPhaseName( (EHoudiniLoadProfilePhase::Type) PhaseIdx ), Profile.PhaseSeconds[ PhaseIdx ] * 1000.0 );
+        }
+
+        HOUDINI_LOG_MESSAGE( TEXT( "    %-32s %9.1f |%s%s" ),
+            *Components[ ComponentIdx ]->GetOwner()->GetName(), Profile.GetTotalSeconds() * 1000.0, *Phases,
+            Profile.bInProgress ? TEXT( "  (loading)" ) : TEXT( "" ) );
+    }
+}
+
+FHoudiniLoadProfilePhaseScope::FHoudiniLoadProfilePhaseScope( FHoudiniLoadProfile & InProfile, EHoudiniLoadProfilePhase::Type InPhase )
+    : Profile( InProfile )
+    , Phase( InPhase )
+{
+    Profile.BeginPhase( Phase );
+}
+
+FHoudiniLoadProfilePhaseScope::~FHoudiniLoadProfilePhaseScope()
+{
+    Profile.EndPhase( Phase );
+}
+
+static FAutoConsoleCommand HoudiniLoadProfileDumpCommand(
+    TEXT( "Houdini.Profile.Load" ),
+    TEXT( "Log the load cost of the Houdini actors per phase, slowest first, optionally followed by the number of actors to list." ),
+    FConsoleCommandWithArgsDelegate::CreateLambda( []( const TArray< FString > & Args )
+    {
+        FHoudiniLoadProfile::DumpSlowestComponents( Args.Num() > 0 ? FCString::Atoi( *Args[ 0 ] ) : HAPI_UNREAL_LOAD_PROFILE_DUMP_COUNT );
+    } ) );
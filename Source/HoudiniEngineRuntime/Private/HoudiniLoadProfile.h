@@ -0,0 +1,82 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace EHoudiniLoadProfilePhase
+{
+    /** Phases of the loading of a component whose time is recorded in its load profile. **/
+    enum Type
+    {
+        Deserialization,
+        PostLoad,
+        RenderState,
+        Reinstantiation,
+        InputUpload,
+        Recook,
+        MAX
+    };
+}
+
+/** Time spent in each phase of the loading of a component, from its deserialization to its first cook. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniLoadProfile
+{
+    FHoudiniLoadProfile();
+
+    /** Clear the recorded times and start recording, when the component is loaded. **/
+    void Start();
+
+    /** Mark the beginning and the end of a phase spanning several ticks, ignored once the load is complete. **/
+    void BeginPhase( EHoudiniLoadProfilePhase::Type Phase );
+    void EndPhase( EHoudiniLoadProfilePhase::Type Phase );
+
+    /** Stop recording, once the first cook after the load has been processed. **/
+    void Finish();
+
+    /** Return the time spent in all phases. **/
+    double GetTotalSeconds() const;
+
+    /** Return the display name of a phase. **/
+    static const TCHAR * GetPhaseName( EHoudiniLoadProfilePhase::Type Phase );
+
+    /** Log the components of the editor worlds whose load took the longest, with the time of each phase. **/
+    static void DumpSlowestComponents( int32 Count );
+
+    double PhaseSeconds[ EHoudiniLoadProfilePhase::MAX ];
+    double PhaseStartTimes[ EHoudiniLoadProfilePhase::MAX ];
+
+    /** Is set to true from the deserialization of the component until its first cook has been processed. **/
+    bool bInProgress;
+};
+
+/** Time the enclosing scope as the given phase of a load profile. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniLoadProfilePhaseScope
+{
+    FHoudiniLoadProfilePhaseScope( FHoudiniLoadProfile & InProfile, EHoudiniLoadProfilePhase::Type InPhase );
+    ~FHoudiniLoadProfilePhaseScope();
+
+    FHoudiniLoadProfile & Profile;
+    EHoudiniLoadProfilePhase::Type Phase;
+};
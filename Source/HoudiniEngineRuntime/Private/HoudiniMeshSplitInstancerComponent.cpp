@@ -78,7 +78,6 @@ UHoudiniMeshSplitInstancerComponent::SetInstances( const TArray<FTransform>& Ins
     {
         const FScopedTransaction Transaction( LOCTEXT( "UpdateInstances", "Update Instances" ) );
         GetOwner()->Modify();
-        ClearInstances();
 
         if( InstancedMesh && !InstancedMesh->IsPendingKill() )
         {
@@ -89,20 +88,41 @@ UHoudiniMeshSplitInstancerComponent::SetInstances( const TArray<FTransform>& Ins
                 InstanceColorOverride[ix] = InstancedColors[ix].GetClamped().ToFColor(false);
             }
 
-            for( const FTransform& InstanceTransform : InstanceTransforms )
-            {
-                UStaticMeshComponent* SMC = NewObject< UStaticMeshComponent >(
-                    GetOwner(), UStaticMeshComponent::StaticClass(),
-                    NAME_None, RF_Transactional );
-
-                if ( !SMC || SMC->IsPendingKill() )
-                    continue;
+            // Existing components are reused and updated in place, so they don't need registering again.
+            // Extra ones are destroyed, and the new ones are registered together once they are all set up.
+            Instances.RemoveAll( []( const UStaticMeshComponent* Instance ) { return !Instance || Instance->IsPendingKill(); } );
+            for ( int32 InstIndex = Instances.Num() - 1; InstIndex >= InstanceTransforms.Num(); --InstIndex )
+                Instances[ InstIndex ]->ConditionalBeginDestroy();
+            Instances.SetNum( FMath::Min( Instances.Num(), InstanceTransforms.Num() ) );
 
-                SMC->SetRelativeTransform(InstanceTransform);
-                // Attach created static mesh component to this thing
-                SMC->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
+            TArray< UStaticMeshComponent* > NewInstances;
+            for( int32 InstIndex = 0; InstIndex < InstanceTransforms.Num(); ++InstIndex )
+            {
+                const FTransform& InstanceTransform = InstanceTransforms[ InstIndex ];
+                UStaticMeshComponent* SMC = Instances.IsValidIndex( InstIndex ) ? Instances[ InstIndex ] : nullptr;
+                bool bNewInstance = !SMC;
+                if ( bNewInstance )
+                {
+                    SMC = NewObject< UStaticMeshComponent >(
+                        GetOwner(), UStaticMeshComponent::StaticClass(),
+                        NAME_None, RF_Transactional );
+
+                    if ( !SMC || SMC->IsPendingKill() )
+                        continue;
+
+                    // Attach created static mesh component to this thing
+                    SMC->SetRelativeTransform(InstanceTransform);
+                    SMC->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
+                    NewInstances.Add( SMC );
+                    Instances.Add( SMC );
+                }
+                else
+                {
+                    SMC->SetRelativeTransform(InstanceTransform);
+                }
 
-                SMC->SetStaticMesh(InstancedMesh);
+                if ( SMC->GetStaticMesh() != InstancedMesh )
+                    SMC->SetStaticMesh(InstancedMesh);
                 SMC->SetVisibility(IsVisible());
                 SMC->SetMobility(Mobility);
                 if( OverrideMaterial && !OverrideMaterial->IsPendingKill() )
@@ -111,23 +131,31 @@ UHoudiniMeshSplitInstancerComponent::SetInstances( const TArray<FTransform>& Ins
                     for( int32 Idx = 0; Idx < MeshMaterialCount; ++Idx )
                     SMC->SetMaterial(Idx, OverrideMaterial);
                 }
+                else if ( !bNewInstance )
+                {
+                    SMC->EmptyOverrideMaterials();
+                }
 
                 // If we have override colors, apply them
-                int32 InstIndex = Instances.Num();
                 if( InstanceColorOverride.IsValidIndex(InstIndex) )
                 {
                     MeshPaintHelpers::FillVertexColors(SMC, InstanceColorOverride[InstIndex], FColor::White, true);
                     //FIXME: How to get rid of the warning about fixup vertex colors on load?
                     //SMC->FixupOverrideColorsIfNecessary();
                 }
+                else if ( !bNewInstance )
+                {
+                    // A reused component may still carry the colors of a previous update.
+                    SMC->RemoveInstanceVertexColors();
+                }
+            }
 
+            for ( UStaticMeshComponent* SMC : NewInstances )
                 SMC->RegisterComponent();
-
-                Instances.Add(SMC);
-            }
         }
         else
         {
+            ClearInstances();
             HOUDINI_LOG_ERROR( TEXT( "%s: Null InstancedMesh for split instanced mesh override" ), *GetOwner()->GetName() );
         }
     }
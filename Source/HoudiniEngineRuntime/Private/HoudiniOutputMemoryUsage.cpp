@@ -0,0 +1,144 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "HoudiniOutputMemoryUsage.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniAssetComponent.h"
+
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+
+FHoudiniOutputMemoryUsage::FHoudiniOutputMemoryUsage()
+{
+    for ( int32 CategoryIdx = 0; CategoryIdx < EHoudiniOutputMemoryCategory::MAX; ++CategoryIdx )
+    {
+        CpuBytes[ CategoryIdx ] = 0;
+        GpuBytes[ CategoryIdx ] = 0;
+        ObjectCounts[ CategoryIdx ] = 0;
+    }
+}
+
+void
+FHoudiniOutputMemoryUsage::AddObject( EHoudiniOutputMemoryCategory::Type Category, const UObject * Object )
+{
+    if ( !Object || Object->IsPendingKill() )
+        return;
+
+    bool bAlreadyCounted = false;
+    CountedObjects.Add( Object, &bAlreadyCounted );
+    if ( bAlreadyCounted )
+        return;
+
+    // Resources whose kind of memory isn't known are counted as CPU memory.
+    FResourceSizeEx ResourceSize( EResourceSizeMode::Exclusive );
+    const_cast< UObject * >( Object )->GetResourceSizeEx( ResourceSize );
+
+    CpuBytes[ Category ] += ResourceSize.GetDedicatedSystemMemoryBytes() + ResourceSize.GetUnknownMemoryBytes();
+    GpuBytes[ Category ] += ResourceSize.GetDedicatedVideoMemoryBytes();
+    ObjectCounts[ Category ]++;
+}
+
+uint64
+FHoudiniOutputMemoryUsage::GetTotalBytes() const
+{
+    uint64 TotalBytes = 0;
+    for ( int32 CategoryIdx = 0; CategoryIdx < EHoudiniOutputMemoryCategory::MAX; ++CategoryIdx )
+        TotalBytes += CpuBytes[ CategoryIdx ] + GpuBytes[ CategoryIdx ];
+
+    return TotalBytes;
+}
+
+const TCHAR *
+FHoudiniOutputMemoryUsage::GetCategoryName( EHoudiniOutputMemoryCategory::Type Category )
+{
+    switch ( Category )
+    {
+        case EHoudiniOutputMemoryCategory::StaticMeshes:    return TEXT( "Static Meshes" );
+        case EHoudiniOutputMemoryCategory::Textures:        return TEXT( "Textures" );
+        case EHoudiniOutputMemoryCategory::Materials:       return TEXT( "Materials" );
+        case EHoudiniOutputMemoryCategory::Landscapes:      return TEXT( "Landscapes" );
+        case EHoudiniOutputMemoryCategory::Instancers:      return TEXT( "Instancers" );
+        default:                                            return TEXT( "Unknown" );
+    }
+}
+
+void
+FHoudiniOutputMemoryUsage::DumpLargestComponents( int32 Count )
+{
+    struct FComponentMemoryUsage
+    {
+        const UHoudiniAssetComponent * HoudiniAssetComponent;
+        FHoudiniOutputMemoryUsage MemoryUsage;
+    };
+
+    TArray< FComponentMemoryUsage > ComponentMemoryUsages;
+    uint64 TotalBytes = 0;
+    for ( TObjectIterator< UHoudiniAssetComponent > Iter; Iter; ++Iter )
+    {
+        const UHoudiniAssetComponent * HoudiniAssetComponent = *Iter;
+        if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() || HoudiniAssetComponent->IsTemplate() )
+            continue;
+
+        UWorld * World = HoudiniAssetComponent->GetWorld();
+        if ( !World || World->WorldType != EWorldType::Editor || !HoudiniAssetComponent->GetOwner() )
+            continue;
+
+        FComponentMemoryUsage & ComponentMemoryUsage = ComponentMemoryUsages[ ComponentMemoryUsages.AddDefaulted() ];
+        ComponentMemoryUsage.HoudiniAssetComponent = HoudiniAssetComponent;
+        HoudiniAssetComponent->GetOutputMemoryUsage( ComponentMemoryUsage.MemoryUsage );
+        TotalBytes += ComponentMemoryUsage.MemoryUsage.GetTotalBytes();
+    }
+
+    ComponentMemoryUsages.Sort( []( const FComponentMemoryUsage & A, const FComponentMemoryUsage & B )
+    {
+        return A.MemoryUsage.GetTotalBytes() > B.MemoryUsage.GetTotalBytes();
+    } );
+
+    HOUDINI_LOG_MESSAGE( TEXT( "Houdini actors using the most output memory (%d of %d, %.1f MB in total), CPU / GPU in MB:" ),
+        FMath::Min( Count, ComponentMemoryUsages.Num() ), ComponentMemoryUsages.Num(), TotalBytes / ( 1024.0 * 1024.0 ) );
+
+    for ( int32 ComponentIdx = 0; ComponentIdx < ComponentMemoryUsages.Num() && ComponentIdx < Count; ++ComponentIdx )
+    {
+        const FHoudiniOutputMemoryUsage & MemoryUsage = ComponentMemoryUsages[ ComponentIdx ].MemoryUsage;
+
+        FString Categories;
+        for ( int32 CategoryIdx = 0; CategoryIdx < EHoudiniOutputMemoryCategory::MAX; ++CategoryIdx )
+        {
+            Categories += FString::Printf( TEXT( "  %s %.1f / %.1f" ),
+                GetCategoryName( (EHoudiniOutputMemoryCategory::Type) CategoryIdx ),
+                MemoryUsage.CpuBytes[ CategoryIdx ] / ( 1024.0 * 1024.0 ), MemoryUsage.GpuBytes[ CategoryIdx ] / ( 1024.0 * 1024.0 ) );
+        }
+
+        HOUDINI_LOG_MESSAGE( TEXT( "    %-32s %9.1f |%s" ),
+            *ComponentMemoryUsages[ ComponentIdx ].HoudiniAssetComponent->GetOwner()->GetName(),
+            MemoryUsage.GetTotalBytes() / ( 1024.0 * 1024.0 ), *Categories );
+    }
+}
+
+static FAutoConsoleCommand HoudiniOutputMemoryDumpCommand(
+    TEXT( "Houdini.Memory.Largest" ),
+    TEXT( "Log the Houdini actors whose cooked outputs use the most memory, optionally followed by the number of actors to list." ),
+    FConsoleCommandWithArgsDelegate::CreateLambda( []( const TArray< FString > & Args )
+    {
+        FHoudiniOutputMemoryUsage::DumpLargestComponents( Args.Num() > 0 ? FCString::Atoi( *Args[ 0 ] ) : HAPI_UNREAL_OUTPUT_MEMORY_DUMP_COUNT );
+    } ) );
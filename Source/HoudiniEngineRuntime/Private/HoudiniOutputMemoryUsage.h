@@ -0,0 +1,67 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UObject;
+
+namespace EHoudiniOutputMemoryCategory
+{
+    /** Kinds of cooked outputs whose memory is accounted for per component. **/
+    enum Type
+    {
+        StaticMeshes,
+        Textures,
+        Materials,
+        Landscapes,
+        Instancers,
+        MAX
+    };
+}
+
+/** CPU and GPU memory used by the cooked outputs of one or more components. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniOutputMemoryUsage
+{
+    FHoudiniOutputMemoryUsage();
+
+    /** Account for the resources of an object, objects already accounted for are skipped. **/
+    void AddObject( EHoudiniOutputMemoryCategory::Type Category, const UObject * Object );
+
+    /** Return the CPU and GPU memory used by all categories. **/
+    uint64 GetTotalBytes() const;
+
+    /** Return the display name of a category. **/
+    static const TCHAR * GetCategoryName( EHoudiniOutputMemoryCategory::Type Category );
+
+    /** Log the components of the editor worlds whose outputs use the most memory, for each category. **/
+    static void DumpLargestComponents( int32 Count );
+
+    uint64 CpuBytes[ EHoudiniOutputMemoryCategory::MAX ];
+    uint64 GpuBytes[ EHoudiniOutputMemoryCategory::MAX ];
+    int32 ObjectCounts[ EHoudiniOutputMemoryCategory::MAX ];
+
+    /** Objects accounted for, so that resources shared by several outputs or components are counted once. **/
+    TSet< const UObject * > CountedObjects;
+};
@@ -48,11 +48,164 @@
 #include "HoudiniParamUtils.h"
 #include "HoudiniRuntimeSettings.h"
 
+/** Value cache of the innermost parameter value cache scope active on this thread, if any. **/
+static thread_local FHoudiniScopedParmValueCache * HoudiniEngineThreadParmValueCache = nullptr;
+
+/** Upload batch of the innermost parameter value upload scope active on this thread, if any. **/
+static thread_local FHoudiniScopedParmValueUpload * HoudiniEngineThreadParmValueUpload = nullptr;
+
+/** Copy a range of cached values, return false if the range isn't cached. **/
+template< typename ValueType >
+static bool
+CopyCachedParmValues( HAPI_NodeId NodeId, const TArray< ValueType > & CachedValues, ValueType * Values, int32 Start, int32 Length )
+{
+    if ( !HoudiniEngineThreadParmValueCache || HoudiniEngineThreadParmValueCache->NodeId != NodeId )
+        return false;
+
+    if ( Length <= 0 || Start < 0 || Start + Length > CachedValues.Num() )
+        return false;
+
+    FMemory::Memcpy( Values, &CachedValues[ Start ], Length * sizeof( ValueType ) );
+    return true;
+}
+
+FHoudiniScopedParmValueCache::FHoudiniScopedParmValueCache( HAPI_NodeId InNodeId, const HAPI_NodeInfo & NodeInfo )
+    : NodeId( InNodeId )
+    , bOwnsCache( HoudiniEngineThreadParmValueCache == nullptr )
+{
+    if ( !bOwnsCache )
+        return;
+
+    // Fetch every value and choice list of the node, an empty buffer falls back to per parameter queries.
+    if ( NodeInfo.parmIntValueCount > 0 )
+    {
+        IntValues.SetNumZeroed( NodeInfo.parmIntValueCount );
+        if ( FHoudiniApi::GetParmIntValues(
+            FHoudiniEngine::Get().GetSession(), NodeId, IntValues.GetData(), 0, IntValues.Num() ) != HAPI_RESULT_SUCCESS )
+            IntValues.Empty();
+    }
+
+    if ( NodeInfo.parmFloatValueCount > 0 )
+    {
+        FloatValues.SetNumZeroed( NodeInfo.parmFloatValueCount );
+        if ( FHoudiniApi::GetParmFloatValues(
+            FHoudiniEngine::Get().GetSession(), NodeId, FloatValues.GetData(), 0, FloatValues.Num() ) != HAPI_RESULT_SUCCESS )
+            FloatValues.Empty();
+    }
+
+    TArray< HAPI_StringHandle > StringHandles;
+    if ( NodeInfo.parmStringValueCount > 0 )
+    {
+        StringValues.SetNumZeroed( NodeInfo.parmStringValueCount );
+        if ( FHoudiniApi::GetParmStringValues(
+            FHoudiniEngine::Get().GetSession(), NodeId, false,
+            StringValues.GetData(), 0, StringValues.Num() ) != HAPI_RESULT_SUCCESS )
+            StringValues.Empty();
+
+        StringHandles.Append( StringValues );
+    }
+
+    if ( NodeInfo.parmChoiceCount > 0 )
+    {
+        ChoiceInfos.SetNumZeroed( NodeInfo.parmChoiceCount );
+        if ( FHoudiniApi::GetParmChoiceLists(
+            FHoudiniEngine::Get().GetSession(), NodeId, ChoiceInfos.GetData(), 0, ChoiceInfos.Num() ) != HAPI_RESULT_SUCCESS )
+            ChoiceInfos.Empty();
+
+        for ( const HAPI_ParmChoiceInfo & ChoiceInfo : ChoiceInfos )
+        {
+            StringHandles.Add( ChoiceInfo.valueSH );
+            StringHandles.Add( ChoiceInfo.labelSH );
+        }
+    }
+
+    // Resolve the strings at once too, if a string cache is active.
+    if ( StringHandles.Num() > 0 )
+        FHoudiniEngineString::PrefetchStrings( StringHandles );
+
+    HoudiniEngineThreadParmValueCache = this;
+}
+
+FHoudiniScopedParmValueCache::~FHoudiniScopedParmValueCache()
+{
+    if ( bOwnsCache )
+        HoudiniEngineThreadParmValueCache = nullptr;
+}
+
+/** Upload queued values of each node, one SetValues call per run of contiguous value indices. **/
+template< typename ValueType, typename SetValuesFunction >
+static bool
+UploadQueuedParmValues( TMap< HAPI_NodeId, TMap< int32, ValueType > > & QueuedValues, SetValuesFunction SetValues )
+{
+    bool bSuccess = true;
+    for ( auto & NodeValues : QueuedValues )
+    {
+        NodeValues.Value.KeySort( TLess< int32 >() );
+
+        TArray< ValueType > Run;
+        int32 RunStart = -1;
+        for ( const auto & Value : NodeValues.Value )
+        {
+            if ( Run.Num() > 0 && Value.Key != RunStart + Run.Num() )
+            {
+                bSuccess &= SetValues( NodeValues.Key, Run.GetData(), RunStart, Run.Num() ) == HAPI_RESULT_SUCCESS;
+                Run.Reset();
+            }
+
+            if ( Run.Num() == 0 )
+                RunStart = Value.Key;
+
+            Run.Add( Value.Value );
+        }
+
+        if ( Run.Num() > 0 )
+            bSuccess &= SetValues( NodeValues.Key, Run.GetData(), RunStart, Run.Num() ) == HAPI_RESULT_SUCCESS;
+    }
+
+    QueuedValues.Empty();
+    return bSuccess;
+}
+
+FHoudiniScopedParmValueUpload::FHoudiniScopedParmValueUpload()
+    : bOwnsBatch( HoudiniEngineThreadParmValueUpload == nullptr )
+{
+    if ( bOwnsBatch )
+        HoudiniEngineThreadParmValueUpload = this;
+}
+
+FHoudiniScopedParmValueUpload::~FHoudiniScopedParmValueUpload()
+{
+    if ( bOwnsBatch )
+    {
+        Flush();
+        HoudiniEngineThreadParmValueUpload = nullptr;
+    }
+}
+
+bool
+FHoudiniScopedParmValueUpload::Flush()
+{
+    bool bSuccess = UploadQueuedParmValues( IntValues, []( HAPI_NodeId NodeId, const int32 * Values, int32 Start, int32 Length )
+    {
+        return FHoudiniApi::SetParmIntValues( FHoudiniEngine::Get().GetSession(), NodeId, Values, Start, Length );
+    } );
+
+    bSuccess &= UploadQueuedParmValues( FloatValues, []( HAPI_NodeId NodeId, const float * Values, int32 Start, int32 Length )
+    {
+        return FHoudiniApi::SetParmFloatValues( FHoudiniEngine::Get().GetSession(), NodeId, Values, Start, Length );
+    } );
+
+    return bSuccess;
+}
+
 
 bool 
 FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
     TMap< HAPI_ParmId, class UHoudiniAssetParameter * >& CurrentParameters,
-    TMap< HAPI_ParmId, class UHoudiniAssetParameter * >& NewParameters )
+    TMap< HAPI_ParmId, class UHoudiniAssetParameter * >& NewParameters,
+    uint32 * InOutInterfaceHash, bool * bOutInterfaceChanged,
+    TMap< FString, HAPI_ParmId > * InOutDeferredParameters,
+    const TSet< FString > * ForcedParameterNames )
 {
     if( !FHoudiniEngineUtils::IsValidNodeId( AssetId ) )
     {
@@ -85,15 +238,156 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
                 FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, &ParmInfos[ 0 ], 0,
                 NodeInfo.parmCount ), false );
 
+        // Resolve the names, labels and help of all the parameters at once, parameters read them from the cache.
+        FHoudiniScopedStringCache ScopedStringCache;
+        {
+            TArray< HAPI_StringHandle > ParmStringHandles;
+            ParmStringHandles.Reserve( NodeInfo.parmCount * 3 );
+            for ( const HAPI_ParmInfo & ParmInfo : ParmInfos )
+            {
+                ParmStringHandles.Add( ParmInfo.nameSH );
+                ParmStringHandles.Add( ParmInfo.labelSH );
+                ParmStringHandles.Add( ParmInfo.helpSH );
+            }
+
+            FHoudiniEngineString::PrefetchStrings( ParmStringHandles );
+        }
+
+        // Fetch the values of all the parameters at once, parameters read them from the cache.
+        FHoudiniScopedParmValueCache ScopedParmValueCache( AssetInfo.nodeId, NodeInfo );
+
+        // If the parameter templates haven't changed since the previous build, the current parameters
+        // are found by id and refreshed, without being reconciled or recreated.
+        uint32 InterfaceHash = GetTypeHash( AssetInfo.nodeId );
+        for ( const HAPI_ParmInfo & ParmInfo : ParmInfos )
+            InterfaceHash = HashCombine( InterfaceHash, GetParmTemplateHash( ParmInfo ) );
+
+        const bool bInterfaceUnchanged = InOutInterfaceHash && *InOutInterfaceHash == InterfaceHash && CurrentParameters.Num() > 0;
+        if ( InOutInterfaceHash )
+            *InOutInterfaceHash = InterfaceHash;
+
+        if ( bOutInterfaceChanged )
+            *bOutInterfaceChanged = !bInterfaceUnchanged;
+
+        if ( !bInterfaceUnchanged )
+            FHoudiniEngineUtils::InvalidateParameterLookupIndex( AssetInfo.nodeId );
+
         // Create name lookup cache
         TMap<FString, UHoudiniAssetParameter*> CurrentParametersByName;
-        CurrentParametersByName.Reserve( CurrentParameters.Num() );
-        for( auto& ParmPair : CurrentParameters )
+        if ( !bInterfaceUnchanged )
         {
-            if ( ParmPair.Value && !ParmPair.Value->IsPendingKill() )
-                CurrentParametersByName.Add( ParmPair.Value->GetParameterName(), ParmPair.Value );
+            CurrentParametersByName.Reserve( CurrentParameters.Num() );
+            for( auto& ParmPair : CurrentParameters )
+            {
+                if ( ParmPair.Value && !ParmPair.Value->IsPendingKill() )
+                    CurrentParametersByName.Add( ParmPair.Value->GetParameterName(), ParmPair.Value );
+            }
         }
 
+        // Index of the parameters by id, used to walk up their parents.
+        TMap< HAPI_ParmId, int32 > ParmInfoIndices;
+        ParmInfoIndices.Reserve( NodeInfo.parmCount );
+        for ( int32 ParamIdx = 0; ParamIdx < NodeInfo.parmCount; ++ParamIdx )
+            ParmInfoIndices.Add( ParmInfos[ ParamIdx ].id, ParamIdx );
+
+        // Parameters in inactive folder tabs only get a record, their objects are created once their tab is activated.
+        TSet< HAPI_ParmId > PreviouslyDeferredParmIds;
+        TSet< HAPI_ParmId > DeferredParmIds;
+        if ( InOutDeferredParameters )
+        {
+            for ( const auto & DeferredPair : *InOutDeferredParameters )
+                PreviouslyDeferredParmIds.Add( DeferredPair.Value );
+
+            InOutDeferredParameters->Reset();
+
+            // Active tab of the current folder lists, by name.
+            TMap< FString, int32 > ActiveTabs;
+            for ( const auto & ParmPair : CurrentParameters )
+            {
+                const UHoudiniAssetParameter * HoudiniAssetParameter = ParmPair.Value;
+                if ( HoudiniAssetParameter && !HoudiniAssetParameter->IsPendingKill()
+                    && HoudiniAssetParameter->IsA< UHoudiniAssetParameterFolderList >() )
+                {
+                    ActiveTabs.Add( HoudiniAssetParameter->GetParameterName(), HoudiniAssetParameter->GetActiveChildParameter() );
+                }
+            }
+
+            // Folder list of each folder tab, and whether it is the active one. Tabs are indexed among the visible folders.
+            TMap< HAPI_ParmId, HAPI_ParmId > FolderLists;
+            TSet< HAPI_ParmId > InactiveFolders;
+            for ( int32 ParamIdx = 0; ParamIdx < NodeInfo.parmCount; ++ParamIdx )
+            {
+                const HAPI_ParmInfo & ParmInfo = ParmInfos[ ParamIdx ];
+                if ( ParmInfo.type != HAPI_PARMTYPE_FOLDERLIST )
+                    continue;
+
+                FString FolderListName;
+                FHoudiniEngineString( ParmInfo.nameSH ).ToFString( FolderListName );
+                const int32 ActiveTab = ActiveTabs.FindRef( FolderListName );
+
+                int32 TabIdx = 0;
+                for ( int32 ChildIdx = 0; ChildIdx < ParmInfo.size && ParamIdx + ChildIdx + 1 < NodeInfo.parmCount; ++ChildIdx )
+                {
+                    const HAPI_ParmInfo & FolderParmInfo = ParmInfos[ ParamIdx + ChildIdx + 1 ];
+                    FolderLists.Add( FolderParmInfo.id, ParmInfo.id );
+                    if ( FolderParmInfo.invisible )
+                        continue;
+
+                    if ( TabIdx++ != ActiveTab )
+                        InactiveFolders.Add( FolderParmInfo.id );
+                }
+            }
+
+            // Parents come before their children, a parameter is deferred if its parent is or is an inactive tab.
+            for ( const HAPI_ParmInfo & ParmInfo : ParmInfos )
+            {
+                if ( DeferredParmIds.Contains( ParmInfo.parentId ) || InactiveFolders.Contains( ParmInfo.parentId ) )
+                    DeferredParmIds.Add( ParmInfo.id );
+            }
+
+            // Inputs and the parameters accessed by name are always created, along with their parents. Folder lists
+            // are created with all their tabs, so that tab indices stay the same.
+            for ( const HAPI_ParmInfo & ParmInfo : ParmInfos )
+            {
+                if ( !DeferredParmIds.Contains( ParmInfo.id ) )
+                    continue;
+
+                bool bForced = ( ParmInfo.type == HAPI_PARMTYPE_NODE );
+                if ( !bForced && ForcedParameterNames && ForcedParameterNames->Num() > 0 )
+                {
+                    FString ParmName;
+                    FHoudiniEngineString( ParmInfo.nameSH ).ToFString( ParmName );
+                    bForced = ForcedParameterNames->Contains( ParmName );
+                }
+
+                if ( !bForced )
+                    continue;
+
+                HAPI_ParmId ForcedParmId = ParmInfo.id;
+                while ( DeferredParmIds.Remove( ForcedParmId ) > 0 )
+                {
+                    const int32 * ForcedParmIdx = ParmInfoIndices.Find( ForcedParmId );
+                    if ( !ForcedParmIdx )
+                        break;
+
+                    if ( const HAPI_ParmId * FolderListParmId = FolderLists.Find( ForcedParmId ) )
+                    {
+                        DeferredParmIds.Remove( *FolderListParmId );
+                        for ( const auto & FolderPair : FolderLists )
+                        {
+                            if ( FolderPair.Value == *FolderListParmId )
+                                DeferredParmIds.Remove( FolderPair.Key );
+                        }
+                    }
+
+                    ForcedParmId = ParmInfos[ *ForcedParmIdx ].parentId;
+                }
+            }
+        }
+
+        // Is set to true if parameters are created while the interface is unchanged.
+        bool bCreatedDeferredParameters = false;
+
         // Create properties for parameters.
         for( int32 ParamIdx = 0; ParamIdx < NodeInfo.parmCount; ++ParamIdx )
         {
@@ -107,6 +401,36 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
                 continue;
             }
 
+            if ( bInterfaceUnchanged )
+            {
+                // Same templates, so the same parameters were created for the same ids: refresh them.
+                UHoudiniAssetParameter ** FoundHoudiniAssetParameter = CurrentParameters.Find( ParmInfo.id );
+                if ( FoundHoudiniAssetParameter && *FoundHoudiniAssetParameter && !(*FoundHoudiniAssetParameter)->IsPendingKill() )
+                {
+                    UHoudiniAssetParameter * HoudiniAssetParameter = *FoundHoudiniAssetParameter;
+                    CurrentParameters.Remove( ParmInfo.id );
+
+                    HoudiniAssetParameter->CreateParameter( PrimaryObject, nullptr, AssetInfo.nodeId, ParmInfo );
+                    NewParameters.Add( ParmInfo.id, HoudiniAssetParameter );
+                    continue;
+                }
+
+                // Parameters of a tab that has just been activated are created, the others stay as they were.
+                if ( !PreviouslyDeferredParmIds.Contains( ParmInfo.id ) || DeferredParmIds.Contains( ParmInfo.id ) )
+                {
+                    if ( InOutDeferredParameters && DeferredParmIds.Contains( ParmInfo.id ) )
+                    {
+                        FString DeferredParmName;
+                        FHoudiniEngineString( ParmInfo.nameSH ).ToFString( DeferredParmName );
+                        InOutDeferredParameters->Add( DeferredParmName, ParmInfo.id );
+                    }
+
+                    continue;
+                }
+
+                bCreatedDeferredParameters = true;
+            }
+
             // If parameter is invisible, skip it.
             if( ParmInfo.invisible )
                 continue;
@@ -116,9 +440,8 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
             HAPI_ParmId ParentId = ParmInfo.parentId;
             while( ParentId > 0 && !SkipParm )
             {
-                if( const HAPI_ParmInfo* ParentInfoPtr = ParmInfos.FindByPredicate( [=]( const HAPI_ParmInfo& Info ) {
-                    return Info.id == ParentId;
-                } ) )
+                const int32 * ParentIdx = ParmInfoIndices.Find( ParentId );
+                if( const HAPI_ParmInfo* ParentInfoPtr = ParentIdx ? &ParmInfos[ *ParentIdx ] : nullptr )
                 {
                     if( ParentInfoPtr->invisible && ParentInfoPtr->type == HAPI_PARMTYPE_FOLDER )
                         SkipParm = true;
@@ -234,6 +557,13 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
                 }
             }
 
+            // Parameters of inactive tabs which don't exist yet are only recorded.
+            if ( InOutDeferredParameters && DeferredParmIds.Contains( ParmInfo.id ) )
+            {
+                InOutDeferredParameters->Add( NewParmName, ParmInfo.id );
+                continue;
+            }
+
             switch( ParmInfo.type )
             {
                 case HAPI_PARMTYPE_STRING:
@@ -430,14 +760,116 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
         // Another pass to notify parameters that all children parameters have been assigned
         for( auto& NewParamPair : NewParameters )
         {
-            if (NewParamPair.Value && !NewParamPair.Value->IsPendingKill() )
+            if ( !NewParamPair.Value || NewParamPair.Value->IsPendingKill() )
                 continue;
 
             if( NewParamPair.Value->HasChildParameters() )
                 NewParamPair.Value->NotifyChildParametersCreated();
         }
+
+        // The panel has to show the parameters created for a newly activated tab.
+        if ( bCreatedDeferredParameters && bOutInterfaceChanged )
+            *bOutInterfaceChanged = true;
     }
     return true;
 }
 
+bool
+FHoudiniParamUtils::GetParmIntValues( HAPI_NodeId NodeId, int32 * Values, int32 Start, int32 Length )
+{
+    if ( HoudiniEngineThreadParmValueCache
+        && CopyCachedParmValues( NodeId, HoudiniEngineThreadParmValueCache->IntValues, Values, Start, Length ) )
+        return true;
+
+    return FHoudiniApi::GetParmIntValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, Values, Start, Length ) == HAPI_RESULT_SUCCESS;
+}
+
+bool
+FHoudiniParamUtils::GetParmFloatValues( HAPI_NodeId NodeId, float * Values, int32 Start, int32 Length )
+{
+    if ( HoudiniEngineThreadParmValueCache
+        && CopyCachedParmValues( NodeId, HoudiniEngineThreadParmValueCache->FloatValues, Values, Start, Length ) )
+        return true;
+
+    return FHoudiniApi::GetParmFloatValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, Values, Start, Length ) == HAPI_RESULT_SUCCESS;
+}
+
+bool
+FHoudiniParamUtils::GetParmStringValues( HAPI_NodeId NodeId, HAPI_StringHandle * Values, int32 Start, int32 Length )
+{
+    if ( HoudiniEngineThreadParmValueCache
+        && CopyCachedParmValues( NodeId, HoudiniEngineThreadParmValueCache->StringValues, Values, Start, Length ) )
+        return true;
+
+    return FHoudiniApi::GetParmStringValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, false, Values, Start, Length ) == HAPI_RESULT_SUCCESS;
+}
 
+bool
+FHoudiniParamUtils::GetParmChoiceLists( HAPI_NodeId NodeId, HAPI_ParmChoiceInfo * Choices, int32 Start, int32 Length )
+{
+    if ( HoudiniEngineThreadParmValueCache
+        && CopyCachedParmValues( NodeId, HoudiniEngineThreadParmValueCache->ChoiceInfos, Choices, Start, Length ) )
+        return true;
+
+    return FHoudiniApi::GetParmChoiceLists(
+        FHoudiniEngine::Get().GetSession(), NodeId, Choices, Start, Length ) == HAPI_RESULT_SUCCESS;
+}
+
+bool
+FHoudiniParamUtils::SetParmIntValues( HAPI_NodeId NodeId, const int32 * Values, int32 Start, int32 Length )
+{
+    if ( HoudiniEngineThreadParmValueUpload )
+    {
+        TMap< int32, int32 > & NodeValues = HoudiniEngineThreadParmValueUpload->IntValues.FindOrAdd( NodeId );
+        for ( int32 Idx = 0; Idx < Length; ++Idx )
+            NodeValues.Add( Start + Idx, Values[ Idx ] );
+
+        return true;
+    }
+
+    return FHoudiniApi::SetParmIntValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, Values, Start, Length ) == HAPI_RESULT_SUCCESS;
+}
+
+bool
+FHoudiniParamUtils::SetParmFloatValues( HAPI_NodeId NodeId, const float * Values, int32 Start, int32 Length )
+{
+    if ( HoudiniEngineThreadParmValueUpload )
+    {
+        TMap< int32, float > & NodeValues = HoudiniEngineThreadParmValueUpload->FloatValues.FindOrAdd( NodeId );
+        for ( int32 Idx = 0; Idx < Length; ++Idx )
+            NodeValues.Add( Start + Idx, Values[ Idx ] );
+
+        return true;
+    }
+
+    return FHoudiniApi::SetParmFloatValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, Values, Start, Length ) == HAPI_RESULT_SUCCESS;
+}
+
+bool
+FHoudiniParamUtils::FlushParmValueUploads()
+{
+    return HoudiniEngineThreadParmValueUpload ? HoudiniEngineThreadParmValueUpload->Flush() : true;
+}
+
+uint32
+FHoudiniParamUtils::GetParmTemplateHash( const HAPI_ParmInfo & ParmInfo )
+{
+    const int32 TemplateValues[] =
+    {
+        ParmInfo.id, ParmInfo.parentId, ParmInfo.childIndex, static_cast< int32 >( ParmInfo.type ),
+        ParmInfo.size, ParmInfo.choiceCount, static_cast< int32 >( ParmInfo.rampType ),
+        static_cast< int32 >( ParmInfo.inputNodeType ), ParmInfo.instanceNum,
+        ParmInfo.intValuesIndex, ParmInfo.floatValuesIndex, ParmInfo.stringValuesIndex, ParmInfo.choiceIndex,
+        ParmInfo.invisible ? 1 : 0, ParmInfo.isChildOfMultiParm ? 1 : 0
+    };
+
+    FString ParmName;
+    FHoudiniEngineString( ParmInfo.nameSH ).ToFString( ParmName );
+
+    return HashCombine( FCrc::MemCrc32( TemplateValues, sizeof( TemplateValues ) ), GetTypeHash( ParmName ) );
+}
@@ -34,10 +34,72 @@ struct HOUDINIENGINERUNTIME_API FHoudiniParamUtils
     @CurrentParameters: pre: current & post: invalid parameters
     @NewParameters: new params added to this
 
+    @InOutInterfaceHash: optional hash of the parameter templates of the previous build, updated on return.
+        If it is unchanged, the current parameters are only refreshed, their tree isn't reconciled.
+    @bOutInterfaceChanged: optional, set to true if the parameter tree had to be reconciled.
+    @InOutDeferredParameters: optional, parameters of inactive folder tabs that were not created, by name.
+        Pre: those of the previous build & post: those of this build. Parameters are always created if null.
+    @ForcedParameterNames: optional, parameters that are created even if they are in an inactive folder tab.
+
     On Return: CurrentParameters are the old parameters that are no longer valid, 
         NewParameters are new and re-used parameters.
     */
     static bool Build( HAPI_NodeId AssetId, class UObject* PrimaryObject, 
         TMap< HAPI_ParmId, class UHoudiniAssetParameter * >& CurrentParameters,
-        TMap< HAPI_ParmId, class UHoudiniAssetParameter * >& NewParameters );
+        TMap< HAPI_ParmId, class UHoudiniAssetParameter * >& NewParameters,
+        uint32 * InOutInterfaceHash = nullptr, bool * bOutInterfaceChanged = nullptr,
+        TMap< FString, HAPI_ParmId > * InOutDeferredParameters = nullptr,
+        const TSet< FString > * ForcedParameterNames = nullptr );
+
+    /** Return a hash of the template of a parameter: its id, name, type, layout and visibility. **/
+    static uint32 GetParmTemplateHash( const HAPI_ParmInfo & ParmInfo );
+
+    /** Retrieve parameter values and choice lists of a node, from the value cache of this thread if any. **/
+    static bool GetParmIntValues( HAPI_NodeId NodeId, int32 * Values, int32 Start, int32 Length );
+    static bool GetParmFloatValues( HAPI_NodeId NodeId, float * Values, int32 Start, int32 Length );
+    static bool GetParmStringValues( HAPI_NodeId NodeId, HAPI_StringHandle * Values, int32 Start, int32 Length );
+    static bool GetParmChoiceLists( HAPI_NodeId NodeId, HAPI_ParmChoiceInfo * Choices, int32 Start, int32 Length );
+
+    /** Set int and float parameter values of a node, they are queued if an upload batch is active on this thread. **/
+    static bool SetParmIntValues( HAPI_NodeId NodeId, const int32 * Values, int32 Start, int32 Length );
+    static bool SetParmFloatValues( HAPI_NodeId NodeId, const float * Values, int32 Start, int32 Length );
+
+    /** Upload the values queued by the upload batch active on this thread, if any. **/
+    static bool FlushParmValueUploads();
+};
+
+/** Scope during which the parameter values and choice lists of a node, fetched in bulk, are read from a cache on this thread. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniScopedParmValueCache
+{
+    FHoudiniScopedParmValueCache( HAPI_NodeId InNodeId, const HAPI_NodeInfo & NodeInfo );
+    ~FHoudiniScopedParmValueCache();
+
+    /** Node the values belong to. **/
+    HAPI_NodeId NodeId;
+
+    /** All the int, float and (unevaluated) string values of the node, and all its choice lists. **/
+    TArray< int32 > IntValues;
+    TArray< float > FloatValues;
+    TArray< HAPI_StringHandle > StringValues;
+    TArray< HAPI_ParmChoiceInfo > ChoiceInfos;
+
+    /** Is set to true if this scope installed its cache, false if an outer scope was already active. **/
+    bool bOwnsCache;
+};
+
+/** Scope during which the int and float values set on this thread are queued, then uploaded in contiguous runs. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniScopedParmValueUpload
+{
+    FHoudiniScopedParmValueUpload();
+    ~FHoudiniScopedParmValueUpload();
+
+    /** Upload the queued values, with one call per run of contiguous value indices. **/
+    bool Flush();
+
+    /** Queued values, per node and value index. **/
+    TMap< HAPI_NodeId, TMap< int32, int32 > > IntValues;
+    TMap< HAPI_NodeId, TMap< int32, float > > FloatValues;
+
+    /** Is set to true if this scope installed its batch, false if an outer scope was already active. **/
+    bool bOwnsBatch;
 };
@@ -72,6 +72,9 @@ enum EHoudiniPluginSerializationVersion
     VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_FILE_PARAM_READ_ONLY = 25,
     VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_OUTLINER_INSTANCE_INDEX = 26,
     VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_INPUT_LANDSCAPE_TRANSFORM = 27,
+    VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_COMPACT_PARAMETERS = 28,
+    VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_GEO_PART_TABLE = 29,
+    VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_ASSET_BULK_DATA = 30,
 
     // -----<new versions can be added before this line>-------------------------------------------------
     // - this needs to be the last line (see note below)
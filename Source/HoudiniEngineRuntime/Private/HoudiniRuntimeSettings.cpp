@@ -22,6 +22,7 @@
 */
 
 #include "HoudiniApi.h"
+#include "HoudiniApiTrace.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniEngineUtils.h"
@@ -39,6 +40,15 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
     ServerPipeName = HAPI_UNREAL_SESSION_SERVER_PIPENAME;
     bStartAutomaticServer = HAPI_UNREAL_SESSION_SERVER_AUTOSTART;
     AutomaticServerTimeout = HAPI_UNREAL_SESSION_SERVER_TIMEOUT;
+    bStartSessionAsynchronously = true;
+    SessionHeartbeatInterval = HAPI_UNREAL_SESSION_HEARTBEAT_INTERVAL;
+    bAutomaticSessionRecovery = true;
+    bKeepAutomaticServersRunning = false;
+    CustomSessionLibraryPath = TEXT( "" );
+    CustomSessionInfo = HAPI_UNREAL_SESSION_SERVER_PIPENAME;
+    bCompressCustomSessionTransport = false;
+    CustomSessionCompressionLevel = 6;
+    CookSessionPoolSize = 1;
 
 #if PLATFORM_LINUX
     // Since 4.17, Linux has library conflict, so we need to create an out-of-process session by default
@@ -55,13 +65,41 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
     bEnableCooking = true;
     bUploadTransformsToHoudiniEngine = true;
     bTransformChangeTriggersCooks = false;
+    bTrustSerializedOutputsOnLoad = true;
+    bStaticComponentsInPIE = true;
     bDisplaySlateCookingNotifications = true;
     bCookCurvesOnMouseRelease = false;
+    CurveDragUpdateInterval = HAPI_UNREAL_CURVE_DRAG_UPDATE_INTERVAL;
+    bSliderDragTriggersCooks = true;
+    SliderDragCookInterval = HAPI_UNREAL_SLIDER_DRAG_COOK_INTERVAL;
+    HandleDragUpdateInterval = HAPI_UNREAL_HANDLE_DRAG_UPDATE_INTERVAL;
 
     TemporaryCookFolder = LOCTEXT("Temp", "/Game/HoudiniEngine/Temp");
 
+    CookWaitMode = HRSCWM_AdaptiveBackoff;
+    CookStatusPollLatencyBudget = HAPI_UNREAL_COOK_STATUS_POLL_LATENCY_BUDGET;
+    CookStatusPollMaxInterval = HAPI_UNREAL_COOK_STATUS_POLL_MAX_INTERVAL;
+    SchedulerStallWarningTime = HAPI_UNREAL_SCHEDULER_STALL_WARNING_TIME;
+    bInterruptStaleCooks = true;
+    PostCookTimeBudget = HAPI_UNREAL_POST_COOK_TIME_BUDGET;
+    bShowCookPreview = false;
+    CookPreviewMaxPoints = HAPI_UNREAL_COOK_PREVIEW_MAX_POINTS;
+    bAsyncStaticMeshBuild = true;
+    bCacheInputMeshUploads = true;
+    bInstanceWorldOutlinerSharedMeshes = false;
+    PresetSnapshotCacheSize = HAPI_UNREAL_PRESET_SNAPSHOT_CACHE_SIZE;
+    bShareIdenticalCookOutputs = true;
+    OutputMemoryWarningThresholdMB = HAPI_UNREAL_OUTPUT_MEMORY_WARNING_THRESHOLD_MB;
+
+    // Baking options.
+    bSaveBakedPackagesImmediately = false;
+    BakeMemoryCeilingMB = 0;
+    bShareBakedBlueprints = false;
+    BakeStreamingCellSize = 0.0f;
+
     /** Parameter options. **/
     bTreatRampParametersAsMultiparms = false;
+    bCompactParameterSerialization = true;
 
     /** Collision generation. **/
     CollisionGroupNamePrefix = TEXT( HAPI_UNREAL_GROUP_GEOMETRY_COLLISION );
@@ -86,11 +124,18 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
     MarshallingLandscapesForceMinMaxValues = false;
     MarshallingLandscapesForcedMinValue = -2000.0f;
     MarshallingLandscapesForcedMaxValue = 4553.0f;
+    MarshallingLandscapesResampleFilter = HRSLRF_Bilinear;
+    MarshallingLandscapesNormalizeWeightBlendedLayers = false;
+    MarshallingTextureMaxResolution = 0;
+    MarshallingDataTextureMaxResolution = 0;
+    MarshallingTextureStreamingMips = false;
+    MarshallingDataTextureStreamingMips = false;
 
     /** Geometry scaling. **/
     GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
     TransformScaleFactor = HAPI_UNREAL_SCALE_FACTOR_TRANSLATION;
     ImportAxis = HRSAI_Unreal;
+    ChunkedImportPrimitiveThreshold = HAPI_UNREAL_CHUNKED_IMPORT_PRIMITIVE_THRESHOLD;
 
     /** Generated StaticMesh settings. **/
     bDoubleSidedGeometry = false;
@@ -103,6 +148,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
     bUseMaximumStreamingTexelRatio = false;
     StreamingDistanceMultiplier = 1.0f;
     GeneratedDistanceFieldResolutionScale = 0.0f;
+    AutoLODTriangleBudget = 0;
 
     /** Static Mesh build settings. **/
     bUseFullPrecisionUVs = false;
@@ -125,6 +171,10 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 
     /** Arguments for HAPI_Initialize */
     CookingThreadStackSize = -1;
+    CookingThreadCount = 0;
+    bPreloadAssetLibraries = false;
+    bEnableHapiCallTracing = false;
+    bCookingThreadCountPerSession = false;
 }
 
 UHoudiniRuntimeSettings::~UHoudiniRuntimeSettings()
@@ -274,6 +324,50 @@ UHoudiniRuntimeSettings::PostEditChangeProperty( struct FPropertyChangedEvent &
     }
     else if (Property->GetName() == TEXT("MarshallingSplineResolution"))
         MarshallingSplineResolution = FMath::Clamp(MarshallingSplineResolution, 0.0f, 10000.0f);
+    else if ( Property->GetName() == TEXT( "bEnableHapiCallTracing" ) )
+        FHoudiniApiTrace::SetEnabled( bEnableHapiCallTracing );
+    else if ( Property->GetName() == TEXT( "CustomSessionCompressionLevel" ) )
+        CustomSessionCompressionLevel = FMath::Clamp( CustomSessionCompressionLevel, 1, 9 );
+    else if ( Property->GetName() == TEXT( "CookSessionPoolSize" ) )
+        CookSessionPoolSize = FMath::Clamp( CookSessionPoolSize, 1, HAPI_UNREAL_SESSION_POOL_MAX_SIZE );
+    else if ( Property->GetName() == TEXT( "SessionHeartbeatInterval" ) )
+        SessionHeartbeatInterval = FMath::Clamp( SessionHeartbeatInterval, 0.0f, 60.0f );
+    else if ( Property->GetName() == TEXT( "CookStatusPollLatencyBudget" ) )
+        CookStatusPollLatencyBudget = FMath::Clamp( CookStatusPollLatencyBudget, 0.0f, 60.0f );
+    else if ( Property->GetName() == TEXT( "CookStatusPollMaxInterval" ) )
+        CookStatusPollMaxInterval = FMath::Clamp( CookStatusPollMaxInterval, 0.001f, 10.0f );
+    else if ( Property->GetName() == TEXT( "SchedulerStallWarningTime" ) )
+        SchedulerStallWarningTime = FMath::Clamp( SchedulerStallWarningTime, 0.0f, 3600.0f );
+    else if ( Property->GetName() == TEXT( "CurveDragUpdateInterval" ) )
+        CurveDragUpdateInterval = FMath::Clamp( CurveDragUpdateInterval, 0.0f, 10.0f );
+    else if ( Property->GetName() == TEXT( "SliderDragCookInterval" ) )
+        SliderDragCookInterval = FMath::Clamp( SliderDragCookInterval, 0.0f, 10.0f );
+    else if ( Property->GetName() == TEXT( "HandleDragUpdateInterval" ) )
+        HandleDragUpdateInterval = FMath::Clamp( HandleDragUpdateInterval, 0.0f, 10.0f );
+    else if ( Property->GetName() == TEXT( "PostCookTimeBudget" ) )
+        PostCookTimeBudget = FMath::Clamp( PostCookTimeBudget, 0.0f, 1000.0f );
+    else if ( Property->GetName() == TEXT( "CookPreviewMaxPoints" ) )
+        CookPreviewMaxPoints = FMath::Clamp( CookPreviewMaxPoints, 0, 1000000 );
+    else if ( Property->GetName() == TEXT( "PresetSnapshotCacheSize" ) )
+        PresetSnapshotCacheSize = FMath::Clamp( PresetSnapshotCacheSize, 0, 64 );
+    else if ( Property->GetName() == TEXT( "OutputMemoryWarningThresholdMB" ) )
+        OutputMemoryWarningThresholdMB = FMath::Max( OutputMemoryWarningThresholdMB, 0 );
+    else if ( Property->GetName() == TEXT( "ChunkedImportPrimitiveThreshold" ) )
+        ChunkedImportPrimitiveThreshold = FMath::Max( ChunkedImportPrimitiveThreshold, 0 );
+    else if ( Property->GetName() == TEXT( "AutoLODTriangleBudget" ) )
+        AutoLODTriangleBudget = FMath::Max( AutoLODTriangleBudget, 0 );
+    else if ( Property->GetName() == TEXT( "MarshallingTextureMaxResolution" ) )
+        MarshallingTextureMaxResolution = FMath::Max( MarshallingTextureMaxResolution, 0 );
+    else if ( Property->GetName() == TEXT( "MarshallingDataTextureMaxResolution" ) )
+        MarshallingDataTextureMaxResolution = FMath::Max( MarshallingDataTextureMaxResolution, 0 );
+    else if ( Property->GetName() == TEXT( "CookingThreadCount" ) )
+        CookingThreadCount = FMath::Clamp( CookingThreadCount, 0, HAPI_UNREAL_MAX_COOKING_THREAD_COUNT );
+    else if ( Property->GetName() == TEXT( "CookingThreadStackSize" ) )
+        CookingThreadStackSize = FMath::Max( CookingThreadStackSize, -1 );
+    else if ( Property->GetName() == TEXT( "BakeMemoryCeilingMB" ) )
+        BakeMemoryCeilingMB = FMath::Max( BakeMemoryCeilingMB, 0 );
+    else if ( Property->GetName() == TEXT( "BakeStreamingCellSize" ) )
+        BakeStreamingCellSize = FMath::Max( BakeStreamingCellSize, 0.0f );
 
     if ( Property->GetName() == TEXT( "MarshallingLandscapesForceMinMaxValues" ) )
     {
@@ -429,6 +523,11 @@ UHoudiniRuntimeSettings::UpdateSessionUi()
     SetPropertyReadOnly( TEXT( "ServerPipeName" ), true );
     SetPropertyReadOnly( TEXT( "bStartAutomaticServer" ), true );
     SetPropertyReadOnly( TEXT( "AutomaticServerTimeout" ), true );
+    SetPropertyReadOnly( TEXT( "bKeepAutomaticServersRunning" ), true );
+    SetPropertyReadOnly( TEXT( "CustomSessionLibraryPath" ), true );
+    SetPropertyReadOnly( TEXT( "CustomSessionInfo" ), true );
+    SetPropertyReadOnly( TEXT( "bCompressCustomSessionTransport" ), true );
+    SetPropertyReadOnly( TEXT( "CustomSessionCompressionLevel" ), true );
 
     bool bServerType = false;
 
@@ -449,6 +548,15 @@ UHoudiniRuntimeSettings::UpdateSessionUi()
             break;
         }
 
+        case HRSST_Custom:
+        {
+            SetPropertyReadOnly( TEXT( "CustomSessionLibraryPath" ), false );
+            SetPropertyReadOnly( TEXT( "CustomSessionInfo" ), false );
+            SetPropertyReadOnly( TEXT( "bCompressCustomSessionTransport" ), false );
+            SetPropertyReadOnly( TEXT( "CustomSessionCompressionLevel" ), false );
+            break;
+        }
+
         default:
             break;
     }
@@ -457,6 +565,7 @@ UHoudiniRuntimeSettings::UpdateSessionUi()
     {
         SetPropertyReadOnly( TEXT( "bStartAutomaticServer" ), false );
         SetPropertyReadOnly( TEXT( "AutomaticServerTimeout" ), false );
+        SetPropertyReadOnly( TEXT( "bKeepAutomaticServersRunning" ), false );
     }
 }
 
@@ -47,6 +47,9 @@ enum EHoudiniRuntimeSettingsSessionType
     // Connection to Houdini Engine server via pipe connection.
     HRSST_NamedPipe UMETA( DisplayName = "Named pipe or domain socket" ),
 
+    // Session provided by a custom HAPI implementation library, such as a shared memory transport.
+    HRSST_Custom UMETA( DisplayName = "Custom implementation (shared memory)" ),
+
     HRSST_MAX,
 };
 
@@ -65,6 +68,33 @@ enum EHoudiniRuntimeSettingsRecomputeFlag
     HRSRF_MAX,
 };
 
+UENUM()
+enum EHoudiniRuntimeSettingsCookWaitMode
+{
+    // Poll the cook status continuously, yielding between polls.
+    HRSCWM_Spin UMETA( DisplayName = "Continuous polling" ),
+
+    // Poll the cook status continuously within the latency budget, then back off up to the poll ceiling.
+    HRSCWM_AdaptiveBackoff UMETA( DisplayName = "Adaptive back-off" ),
+
+    HRSCWM_MAX,
+};
+
+UENUM()
+enum EHoudiniRuntimeSettingsLandscapeResampleFilter
+{
+    // Use the closest heightfield sample.
+    HRSLRF_Nearest UMETA( DisplayName = "Nearest" ),
+
+    // Interpolate linearly between the four closest heightfield samples.
+    HRSLRF_Bilinear UMETA( DisplayName = "Bilinear" ),
+
+    // Interpolate with a Catmull-Rom filter over the sixteen closest heightfield samples.
+    HRSLRF_Bicubic UMETA( DisplayName = "Bicubic" ),
+
+    HRSLRF_MAX,
+};
+
 UENUM()
 enum EHoudiniRuntimeSettingsAxisImport
 {
@@ -208,6 +238,46 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY( GlobalConfig, EditAnywhere, Category = Session )
         float AutomaticServerTimeout;
 
+        /** Start the sessions in the background, so that the editor does not wait for Houdini Engine to start. **/
+        /** Commandlets and dedicated servers always start them synchronously. **/
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Session )
+        bool bStartSessionAsynchronously;
+
+        /** Interval, in seconds, at which the schedulers check that their session is alive, 0 to disable. **/
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Session, Meta = ( ClampMin = "0.0", UIMax = "10.0" ) )
+        float SessionHeartbeatInterval;
+
+        /** Restart lost out-of-process sessions, restoring assets from their last cooked state without recooking them. **/
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Session )
+        bool bAutomaticSessionRecovery;
+
+        /** Keep automatically started servers running when the editor closes, and reconnect to them on the next launch. **/
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Session )
+        bool bKeepAutomaticServersRunning;
+
+        /** Path to the custom HAPI implementation library used by custom sessions. **/
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Session )
+        FString CustomSessionLibraryPath;
+
+        /** Connection string handed to the custom implementation, such as the name of its shared memory buffer. **/
+        // Additional sessions of the session pool use the same string with a suffix.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Session )
+        FString CustomSessionInfo;
+
+        /** Ask the custom implementation to compress the geometry and attribute payloads it transfers to remote servers. **/
+        // The level is appended to the session info as ";compression=<level>", see Houdini.ApiTrace.Sessions for the resulting throughput.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Session )
+        bool bCompressCustomSessionTransport;
+
+        /** Compression level requested from the custom implementation, from 1 (fastest) to 9 (smallest). **/
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Session, Meta = ( ClampMin = "1", ClampMax = "9" ) )
+        int32 CustomSessionCompressionLevel;
+
+        /** Number of sessions used to cook independent assets in parallel: Change requires editor restart */
+        // Additional sessions use consecutive ports or suffixed pipe names, and require automatically started servers.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Session, Meta = ( ClampMin = "1", ClampMax = "16" ) )
+        int32 CookSessionPoolSize;
+
     /** Instantiation options. **/
     public:
 
@@ -234,6 +304,16 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
         bool bTransformChangeTriggersCooks;
 
+        // Loaded Houdini Assets display their saved outputs and only create their Houdini node once a parameter
+        // or input is edited. Transform changes and session restarts do not instantiate them until then.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bTrustSerializedOutputsOnLoad;
+
+        // Houdini Assets duplicated into Play In Editor worlds act as static containers of their outputs: they do
+        // not tick, cook, listen to editor events or access the session, the same as baked outputs.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bStaticComponentsInPIE;
+
         // Whether to display instantiation and cooking Slate notifications.
         UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
         bool bDisplaySlateCookingNotifications;
@@ -242,10 +322,113 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
         bool bCookCurvesOnMouseRelease;
 
+        // Minimum time, in seconds, between two cooks of a curve being dragged.
+        // Edits made in between are coalesced and only the latest state is sent. 0 cooks on every move.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking, meta = ( ClampMin = "0.0", UIMax = "1.0" ) )
+        float CurveDragUpdateInterval;
+
+        // Enables preview cooks while a parameter slider is dragged for new Houdini Assets.
+        // When disabled, slider drags only cook on mouse release.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bSliderDragTriggersCooks;
+
+        // Minimum time, in seconds, between two preview cooks of a parameter slider being dragged.
+        // Values set in between are coalesced, the final value is always cooked on mouse release.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking, meta = ( ClampMin = "0.0", UIMax = "1.0" ) )
+        float SliderDragCookInterval;
+
+        // Minimum time, in seconds, between two updates of a transform handle being dragged.
+        // All the parameters bound to the handle are set at once, the final values are always cooked on mouse release.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking, meta = ( ClampMin = "0.0", UIMax = "1.0" ) )
+        float HandleDragUpdateInterval;
+
         // Content folder storing all the temporary cook data
         UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
         FText TemporaryCookFolder;
 
+        // How the cooking thread waits for instantiations and cooks to complete.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        TEnumAsByte< enum EHoudiniRuntimeSettingsCookWaitMode > CookWaitMode;
+
+        // Time in seconds during which a task's cook status is polled continuously before backing off.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking, Meta = ( UIMin = "0.0", UIMax = "1.0" ) )
+        float CookStatusPollLatencyBudget;
+
+        // Maximum time in seconds between two cook status polls when backing off.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking, Meta = ( UIMin = "0.001", UIMax = "1.0" ) )
+        float CookStatusPollMaxInterval;
+
+        // Time in seconds a scheduler task can run before a warning naming its asset is logged, 0 to disable.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking, Meta = ( ClampMin = "0.0", UIMax = "600.0" ) )
+        float SchedulerStallWarningTime;
+
+        // Interrupt a running cook when it is made stale by newer parameter changes, instead of waiting for it.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bInterruptStaleCooks;
+
+        // Time in milliseconds spent per frame on processing cook results, 0 processes them in a single frame.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking, Meta = ( UIMin = "0.0", UIMax = "100.0" ) )
+        float PostCookTimeBudget;
+
+        // Show the points and bounds of the cooked geometry while the outputs of a cook are being created.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bShowCookPreview;
+
+        // Maximum number of points read from the cooked geometry for its preview.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking, Meta = ( EditCondition = "bShowCookPreview", UIMin = "0", UIMax = "100000" ) )
+        int32 CookPreviewMaxPoints;
+
+        // Build generated static meshes on worker threads, meshes keep their previous render data until built.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bAsyncStaticMeshBuild;
+
+        // Upload the geometry of static mesh inputs once per content, inputs sharing it use object merges.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bCacheInputMeshUploads;
+
+        // World outliner inputs upload meshes shared by several actors once, as packed instances on a point per actor.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bInstanceWorldOutlinerSharedMeshes;
+
+        // Number of recently cooked presets whose outputs are kept per asset, switching back to one of them
+        // restores its outputs without cooking if the inputs haven't changed. 0 disables it.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking, Meta = ( ClampMin = "0", UIMax = "16" ) )
+        int32 PresetSnapshotCacheSize;
+
+        // Components of the same asset and parameter preset, without connected inputs, share the static meshes cooked
+        // by the first of them instead of cooking their own.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bShareIdenticalCookOutputs;
+
+        // Warn when the cooked outputs of a component use more memory than this, in MB, CPU and GPU combined.
+        // 0 disables the warning.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking, Meta = ( ClampMin = "0" ) )
+        int32 OutputMemoryWarningThresholdMB;
+
+    /** Baking options. **/
+    public:
+
+        // Save the packages of each baked mesh, with its materials and textures, as soon as it is baked.
+        // Saved meshes are recorded so an interrupted bake reuses them instead of baking them again.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Baking )
+        bool bSaveBakedPackagesImmediately;
+
+        // When the editor uses more physical memory than this, in MB, during a bake, the baked packages are
+        // saved and garbage is collected before baking continues. 0 disables the ceiling.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Baking, Meta = ( ClampMin = "0" ) )
+        int32 BakeMemoryCeilingMB;
+
+        // Houdini actors with the same asset, parameters and output geometry bake to a single blueprint.
+        // Replacing such actors with blueprints places instances of the shared blueprint.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Baking )
+        bool bShareBakedBlueprints;
+
+        // Size in world units of the grid cells Bake To Actors partitions the baked actors into. The actors of each
+        // cell are moved into their own streaming level, so only the cells near the player need to be loaded.
+        // 0 keeps all baked actors in the current level.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Baking, Meta = ( ClampMin = "0.0" ) )
+        float BakeStreamingCellSize;
+
     /** Parameter options. **/
     public:
 
@@ -253,6 +436,11 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY( GlobalConfig, EditAnywhere, Category = Parameters )
         bool bTreatRampParametersAsMultiparms;
 
+        // When saving, only keep the parameter names and rely on the asset preset for their values.
+        // Parameter objects are recreated once the asset is instantiated.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Parameters )
+        bool bCompactParameterSerialization;
+
     /** Collision generation. **/
     public:
 
@@ -343,6 +531,30 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling)
         float MarshallingLandscapesForcedMaxValue;
 
+        // Filter used when heightfields need to be resampled to a valid landscape size.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = GeometryMarshalling )
+        TEnumAsByte< enum EHoudiniRuntimeSettingsLandscapeResampleFilter > MarshallingLandscapesResampleFilter;
+
+        // If true, the weight blended layers of generated Landscapes are normalized together so their weights sum to 1.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = GeometryMarshalling )
+        bool MarshallingLandscapesNormalizeWeightBlendedLayers;
+
+        // Maximum resolution of color textures (diffuse, opacity, emissive) extracted from Houdini materials, 0 for no limit.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = GeometryMarshalling, Meta = ( ClampMin = "0" ) )
+        int32 MarshallingTextureMaxResolution;
+
+        // Maximum resolution of data textures (normal, specular, roughness, metallic) extracted from Houdini materials, 0 for no limit.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = GeometryMarshalling, Meta = ( ClampMin = "0" ) )
+        int32 MarshallingDataTextureMaxResolution;
+
+        // If true, color textures are extracted at power of two resolutions so they get a full mip chain and can be streamed.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = GeometryMarshalling )
+        bool MarshallingTextureStreamingMips;
+
+        // If true, data textures are extracted at power of two resolutions so they get a full mip chain and can be streamed.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = GeometryMarshalling )
+        bool MarshallingDataTextureStreamingMips;
+
     /** Geometry scaling. **/
     public:
 
@@ -358,6 +570,10 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryScalingAndImport )
         TEnumAsByte< enum EHoudiniRuntimeSettingsAxisImport > ImportAxis;
 
+        // Parts with more primitives are imported in chunks, keeping transfer buffers bounded. 0 disables chunked import.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = GeometryScalingAndImport, Meta = ( ClampMin = "0" ) )
+        int32 ChunkedImportPrimitiveThreshold;
+
     /** Generated StaticMesh settings. **/
     public:
 
@@ -401,6 +617,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
             Meta = (DisplayName = "Distance Field Resolution Scale", UIMin = "0.0", UIMax = "100.0"))
             float GeneratedDistanceFieldResolutionScale;
 
+        /** Default triangle budget above which generated meshes get a chain of reduced LODs, 0 disables it. **/
+        UPROPERTY(
+            GlobalConfig, EditAnywhere, Category = GeneratedStaticMeshSettings,
+            Meta = ( DisplayName = "Auto LOD Triangle Budget", ClampMin = "0" ) )
+        int32 AutoLODTriangleBudget;
+
         // Custom walkable slope setting for bodies of new Houdini Assets.
         UPROPERTY(
             GlobalConfig, EditAnywhere, AdvancedDisplay, Category = GeneratedStaticMeshSettings,
@@ -509,12 +731,26 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         // Evaluation thread stack size in bytes.  -1 for default 
         UPROPERTY( GlobalConfig, EditAnywhere, Category = HoudiniEngineInitialization )
             int32 CookingThreadStackSize;
+        // Number of threads used for cooking, 0 to use all the logical cores.
+        // Applies to in-process and automatically started sessions, and requires restarting the session.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = HoudiniEngineInitialization, Meta = ( ClampMin = "0" ) )
+            int32 CookingThreadCount;
+        // If enabled, CookingThreadCount is given to each session of the session pool,
+        // otherwise it is shared evenly between the sessions of the pool.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = HoudiniEngineInitialization )
+            bool bCookingThreadCountPerSession;
         // List of paths to Houdini-compatible .env files (; separated on Windows, : otherwise)
         UPROPERTY( GlobalConfig, EditAnywhere, Category = HoudiniEngineInitialization )
             FString HoudiniEnvironmentFiles;
         // Path to find other OTL/HDA files
         UPROPERTY( GlobalConfig, EditAnywhere, Category = HoudiniEngineInitialization )
             FString OtlSearchPath;
+        // Load the asset libraries found in OtlSearchPath in the background when a session starts
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = HoudiniEngineInitialization )
+            bool bPreloadAssetLibraries;
+        // Record the call count, payload and wall time of every HAPI call, see the Houdini.ApiTrace console commands
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = HoudiniEngineInitialization )
+            bool bEnableHapiCallTracing;
         // Sets HOUDINI_DSO_PATH
         UPROPERTY( GlobalConfig, EditAnywhere, Category = HoudiniEngineInitialization )
             FString DsoSearchPath;
@@ -136,6 +136,7 @@ UHoudiniSplineComponent::Construct(
     bool bInClosedCurve)
 {
     HoudiniGeoPartObject = InHoudiniGeoPartObject;
+    UploadedPositionString.Empty();
 
     ResetCurveDisplayPoints();
     AddDisplayPoints(InCurveDisplayPoints);
@@ -152,6 +153,7 @@ void
 UHoudiniSplineComponent::SetHoudiniGeoPartObject( const FHoudiniGeoPartObject& InHoudiniGeoPartObject )
 {
     HoudiniGeoPartObject = InHoudiniGeoPartObject;
+    UploadedPositionString.Empty();
 }
 
 
@@ -240,11 +242,15 @@ UHoudiniSplineComponent::IsValidCurve() const
     return true;
 }
 
-void
+bool
 UHoudiniSplineComponent::UpdatePoint( int32 PointIndex, const FTransform & Point )
 {
     check( PointIndex >= 0 && PointIndex < CurvePoints.Num() );
+    if ( CurvePoints[ PointIndex ].Equals( Point, 0.0f ) )
+        return false;
+
     CurvePoints[ PointIndex ] = Point;
+    return true;
 }
 
 void
@@ -252,19 +258,28 @@ UHoudiniSplineComponent::UploadControlPoints()
 {
     HAPI_NodeId HostAssetId = -1;
     HAPI_NodeId NodeId = -1;
+    int32 SessionIndex = 0;
     if (HoudiniGeoPartObject.IsValid())
     {
         if ( IsInputCurve() )
         {
             HostAssetId = HoudiniAssetInput->GetConnectedAssetId();
             NodeId = HoudiniGeoPartObject.HapiGeoGetNodeId();
+
+            // Input curves live in the session of the component owning the input.
+            UHoudiniAssetComponent * InputComponent = HoudiniAssetInput->GetHoudiniAssetComponent();
+            if ( InputComponent && !InputComponent->IsPendingKill() )
+                SessionIndex = InputComponent->GetSessionIndex();
         }
         else
         {
             // Grab component we are attached to.
             UHoudiniAssetComponent * AttachedComponent = Cast< UHoudiniAssetComponent >( GetAttachParent() );
             if ( AttachedComponent && !AttachedComponent->IsPendingKill() )
+            {
                 HostAssetId = AttachedComponent->GetAssetId();
+                SessionIndex = AttachedComponent->GetSessionIndex();
+            }
 
             NodeId = HoudiniGeoPartObject.HapiGeoGetNodeId( HostAssetId );
         }
@@ -273,6 +288,8 @@ UHoudiniSplineComponent::UploadControlPoints()
     if ( ( NodeId < 0 ) || ( HostAssetId < 0 ) )
         return;
 
+    FHoudiniScopedSession ScopedSession( SessionIndex );
+
     // Extract positions rotations and scales and upload them to the curve node
     TArray<FVector> Positions;
     GetCurvePositions(Positions);
@@ -302,6 +319,11 @@ UHoudiniSplineComponent::UploadControlPoints()
         FString PositionString = TEXT("");
         FHoudiniEngineUtils::CreatePositionsString(Positions, PositionString);
 
+        // Only positions are sent for asset curves, rotation or scale edits don't need an upload.
+        const FString UploadKey = FString::Printf( TEXT( "%d:%s" ), NodeId, *PositionString );
+        if ( UploadKey.Equals( UploadedPositionString, ESearchCase::CaseSensitive ) )
+            return;
+
         // Get param id.
         HAPI_ParmId ParmId = -1;
         if (FHoudiniApi::GetParmIdFromName(
@@ -319,6 +341,8 @@ UHoudiniSplineComponent::UploadControlPoints()
         {
             return;
         }
+
+        UploadedPositionString = UploadKey;
     }
 }
 
@@ -139,8 +139,8 @@ class HOUDINIENGINERUNTIME_API UHoudiniSplineComponent : public USceneComponent
         /** Return true if this spline is a valid spline. **/
         bool IsValidCurve() const;
 
-        /** Update point at given index with new information. **/
-        void UpdatePoint( int32 PointIndex, const FTransform & Point );
+        /** Update point at given index with new information, return false if the point was left unchanged. **/
+        bool UpdatePoint( int32 PointIndex, const FTransform & Point );
 
         /** Upload changed control points to HAPI. **/
         void UploadControlPoints();
@@ -197,4 +197,7 @@ class HOUDINIENGINERUNTIME_API UHoudiniSplineComponent : public USceneComponent
 
         /** Whether this spline is closed. **/
         bool bClosedCurve;
+
+        /** Node id and positions string last uploaded for this curve, to skip uploads of unchanged positions. **/
+        FString UploadedPositionString;
 };
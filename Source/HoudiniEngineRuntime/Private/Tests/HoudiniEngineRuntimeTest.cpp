@@ -10,6 +10,10 @@
 #include "PropertyEditorModule.h"
 #include "Tests/AutomationCommon.h"
 #include "IDetailsView.h"
+#include "RawMesh.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 #include "HoudiniEngine.h"
 #include "HoudiniAsset.h"
@@ -21,6 +25,10 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngineRuntimeTest.h"
 #include "HoudiniAssetParameterInt.h"
+#include "HoudiniAssetParameterFloat.h"
+#include "HoudiniLandscapeUtils.h"
+#include "HoudiniEngineMaterialUtils.h"
+#include "HoudiniEngineInstancerUtils.h"
 
 
 DEFINE_LOG_CATEGORY_STATIC( LogHoudiniTests, Log, All );
@@ -32,6 +40,48 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeUploadStaticMeshTest, "Ho
 IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeActorTest, "Houdini.Runtime.ActorTest", kTestFlags )
 IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeParamTest, "Houdini.Runtime.ParamTest", kTestFlags )
 IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeBatchTest, "Houdini.Runtime.BatchTest", kTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeVectorConversionTest, "Houdini.Runtime.VectorConversion", kTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeGroupMembershipTest, "Houdini.Runtime.GroupMembership", kTestFlags )
+
+static constexpr int32 kPerfTestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEnginePerfMeshUploadTest, "Houdini.Perf.MeshUpload", kPerfTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEnginePerfMeshBuildTest, "Houdini.Perf.MeshBuild", kPerfTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEnginePerfHeightfieldTest, "Houdini.Perf.HeightfieldRoundTrip", kPerfTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEnginePerfInstancerTest, "Houdini.Perf.Instancer", kPerfTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEnginePerfParameterBuildTest, "Houdini.Perf.ParameterBuild", kPerfTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEnginePerfMaterialTest, "Houdini.Perf.MaterialExtraction", kPerfTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEnginePerfManyActorsTest, "Houdini.Perf.ManyActors", kPerfTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEnginePerfUtilsVectorTest, "Houdini.Perf.Utils.VectorConversion", kPerfTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEnginePerfUtilsTransformTest, "Houdini.Perf.Utils.TransformConversion", kPerfTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEnginePerfUtilsPositionStringTest, "Houdini.Perf.Utils.PositionStrings", kPerfTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEnginePerfUtilsWedgeTransferTest, "Houdini.Perf.Utils.WedgeTransfer", kPerfTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEnginePerfUtilsDegenerateTest, "Houdini.Perf.Utils.DegenerateTriangles", kPerfTestFlags )
+
+/** Grid resolutions of the generated meshes, from 2k to 500k triangles. **/
+static const int32 PerfMeshResolutions[] = { 32, 128, 512 };
+
+/** Sizes of the generated heightfields. **/
+static const int32 PerfHeightfieldSizes[] = { 129, 513, 2049 };
+
+/** Point counts of the generated instancers. **/
+static const int32 PerfInstanceCounts[] = { 10000, 100000, 1000000 };
+
+/** Number of parameters built by the parameter benchmark. **/
+static const int32 PerfParameterCount = 1000;
+
+/** Number of actors spawned by the stress test unless -HoudiniStressCount= is given, and its time limit per phase. **/
+static const int32 PerfStressActorCount = 50;
+static const double PerfStressTimeout = 600.0;
+
+/** Element counts of the conversion helper microbenchmarks. **/
+static const int32 PerfMicroSizes[] = { 1000, 100000, 10000000 };
+
+/** The position strings hold one FString per coordinate once parsed, larger counts only measure the allocator. **/
+static const int32 PerfMicroStringMaxSize = 1000000;
+
+/** Small sizes are repeated until about this many elements went through the helper. **/
+static const int32 PerfMicroElementsPerRun = 10000000;
 
 static float TestTickDelay = 1.0f;
 
@@ -63,7 +113,7 @@ struct FTestCookHandler : public FHoudiniCookParams, public IHoudiniCookHandler
     {
         if( GeoPartObject.HasCustomName() )
         {
-            return GeoPartObject.PartName;
+            return GeoPartObject.GetPartName();
         }
 
         return FString::Printf( TEXT( "test_%d_%d_%d_%d" ),
@@ -330,6 +380,124 @@ void HelperTestMeshEqual( FAutomationTestBase* Test, UStaticMesh* MeshA, UStatic
     }
 }
 
+/** Append benchmark results to the perf CSV, Saved/Automation/HoudiniPerf.csv unless -HoudiniPerfCsv= is given. **/
+void HelperWritePerfResult(
+    FAutomationTestBase* Test,
+    const TCHAR* Benchmark,
+    int32 Size,
+    int32 ItemCount,
+    double Seconds )
+{
+    FString FileName = FPaths::Combine( FPaths::ProjectSavedDir(), TEXT( "Automation" ), TEXT( "HoudiniPerf.csv" ) );
+    FParse::Value( FCommandLine::Get(), TEXT( "HoudiniPerfCsv=" ), FileName );
+
+    FString Csv;
+    if( !IFileManager::Get().FileExists( *FileName ) )
+        Csv = TEXT( "Date,Version,Benchmark,Size,Items,Seconds,ItemsPerSecond\n" );
+
+    Csv += FString::Printf( TEXT( "%s,%d.%d.%d,%s,%d,%d,%.6f,%.1f\n" ),
+        *FDateTime::Now().ToString(),
+        HAPI_VERSION_HOUDINI_MAJOR, HAPI_VERSION_HOUDINI_MINOR, HAPI_VERSION_HOUDINI_BUILD,
+        Benchmark, Size, ItemCount, Seconds, Seconds > 0.0 ? ItemCount / Seconds : 0.0 );
+
+    if( !FFileHelper::SaveStringToFile( Csv, *FileName, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append ) )
+        Test->AddWarning( FString::Printf( TEXT( "Failed writing the perf results to %s" ), *FileName ) );
+
+    UE_LOG( LogHoudiniTests, Display, TEXT( "%s [%d]: %d items in %.3f s" ), Benchmark, Size, ItemCount, Seconds );
+}
+
+/** Time Body over Size elements, repeating small sizes so they are not lost in timer noise. **/
+/** Setup runs untimed before each repetition, for helpers that convert their input in place. **/
+void HelperRunMicroBenchmark(
+    FAutomationTestBase* Test,
+    const TCHAR* Benchmark,
+    int32 Size,
+    TFunctionRef< void() > Setup,
+    TFunctionRef< void() > Body )
+{
+    const int32 Repetitions = FMath::Clamp( PerfMicroElementsPerRun / FMath::Max( Size, 1 ), 1, 1000 );
+
+    // Warm up caches and lazily initialized settings.
+    Setup();
+    Body();
+
+    double Seconds = 0.0;
+    for( int32 Repetition = 0; Repetition < Repetitions; ++Repetition )
+    {
+        Setup();
+        const double StartTime = FPlatformTime::Seconds();
+        Body();
+        Seconds += FPlatformTime::Seconds() - StartTime;
+    }
+
+    HelperWritePerfResult( Test, Benchmark, Size, Size, Seconds / Repetitions );
+}
+
+/** Build a transient wavy grid mesh with Resolution x Resolution quads. **/
+UStaticMesh* HelperCreateGridMesh( int32 Resolution )
+{
+    FRawMesh RawMesh;
+    for( int32 Y = 0; Y <= Resolution; ++Y )
+    {
+        for( int32 X = 0; X <= Resolution; ++X )
+        {
+            RawMesh.VertexPositions.Add( FVector(
+                X * 10.0f, Y * 10.0f, FMath::Sin( X * 0.1f ) * FMath::Cos( Y * 0.1f ) * 50.0f ) );
+        }
+    }
+
+    auto AddWedge = [&]( int32 X, int32 Y )
+    {
+        RawMesh.WedgeIndices.Add( Y * ( Resolution + 1 ) + X );
+        RawMesh.WedgeTexCoords[ 0 ].Add( FVector2D( (float)X / Resolution, (float)Y / Resolution ) );
+    };
+
+    for( int32 Y = 0; Y < Resolution; ++Y )
+    {
+        for( int32 X = 0; X < Resolution; ++X )
+        {
+            AddWedge( X, Y );
+            AddWedge( X + 1, Y );
+            AddWedge( X + 1, Y + 1 );
+            AddWedge( X, Y );
+            AddWedge( X + 1, Y + 1 );
+            AddWedge( X, Y + 1 );
+
+            RawMesh.FaceMaterialIndices.Add( 0 );
+            RawMesh.FaceMaterialIndices.Add( 0 );
+            RawMesh.FaceSmoothingMasks.Add( 1 );
+            RawMesh.FaceSmoothingMasks.Add( 1 );
+        }
+    }
+
+    UStaticMesh* StaticMesh = NewObject<UStaticMesh>( GetTransientPackage(), NAME_None, RF_Transient );
+    FStaticMeshSourceModel* SrcModel = new ( StaticMesh->SourceModels ) FStaticMeshSourceModel();
+    SrcModel->BuildSettings.bRecomputeNormals = true;
+    SrcModel->BuildSettings.bRecomputeTangents = true;
+    SrcModel->BuildSettings.bGenerateLightmapUVs = false;
+    SrcModel->RawMeshBulkData->SaveRawMesh( RawMesh );
+    StaticMesh->StaticMaterials.Add( FStaticMaterial() );
+    StaticMesh->Build( true );
+
+    return StaticMesh;
+}
+
+/** Cook a node and wait for the cook to finish, for benchmarks that must not include the task polling delays. **/
+bool HelperCookNodeBlocking( HAPI_NodeId NodeId )
+{
+    if( FHoudiniApi::CookNode( FHoudiniEngine::Get().GetSession(), NodeId, nullptr ) != HAPI_RESULT_SUCCESS )
+        return false;
+
+    int32 Status = HAPI_STATE_STARTING_COOK;
+    while( FHoudiniApi::GetStatus( FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status ) == HAPI_RESULT_SUCCESS
+        && Status > HAPI_STATE_MAX_READY_STATE )
+    {
+        FPlatformProcess::Sleep( 0.001f );
+    }
+
+    return Status == HAPI_STATE_READY;
+}
+
 bool FHoudiniEngineRuntimeParamTest::RunTest( const FString& Paramters )
 {
     HelperInstantiateAsset( this, TEXT( "/HoudiniEngine/Test/TestParams" ),
@@ -759,4 +927,873 @@ bool FHoudiniEngineRuntimeMeshMarshalTest::RunTest( const FString& Parameters )
     return true;
 }
 
+bool FHoudiniEngineRuntimeVectorConversionTest::RunTest( const FString& Parameters )
+{
+    // Odd count so that the remainder path is exercised as well.
+    const int32 VectorCount = 1000003;
+    const float ScaleFactor = 100.0f;
+
+    FRandomStream RandomStream( 1234 );
+    TArray< FVector > Vectors;
+    Vectors.SetNumUninitialized( VectorCount );
+    for( FVector& Vector : Vectors )
+        Vector = RandomStream.GetUnitVector() * RandomStream.FRandRange( 0.0f, 10.0f );
+
+    // Scalar reference.
+    TArray< FVector > Expected = Vectors;
+    double StartTime = FPlatformTime::Seconds();
+    for( FVector& Vector : Expected )
+    {
+        Vector *= ScaleFactor;
+        Swap( Vector.Y, Vector.Z );
+    }
+    const double ScalarTime = FPlatformTime::Seconds() - StartTime;
+
+    StartTime = FPlatformTime::Seconds();
+    FHoudiniEngineUtils::ScaleAndSwapVectors( Vectors.GetData(), Vectors.Num(), ScaleFactor, true );
+    const double VectorizedTime = FPlatformTime::Seconds() - StartTime;
+
+    for( int32 Index = 0; Index < VectorCount; Index++ )
+    {
+        if( Vectors[ Index ] != Expected[ Index ] )
+        {
+            TestEqual( TEXT( "Converted vectors match" ), Vectors[ Index ], Expected[ Index ] );
+            break;
+        }
+    }
+
+    UE_LOG( LogHoudiniTests, Display, TEXT( "Converted %d vectors: scalar %.3f ms, vectorized %.3f ms (x%.1f)" ),
+        VectorCount, ScalarTime * 1000.0, VectorizedTime * 1000.0, VectorizedTime > 0.0 ? ScalarTime / VectorizedTime : 0.0 );
+
+    // A transform goes through the same axis swap.
+    HAPI_Transform HapiTransform;
+    FMemory::Memzero< HAPI_Transform >( HapiTransform );
+    HapiTransform.position[ 0 ] = 1.0f; HapiTransform.position[ 1 ] = 2.0f; HapiTransform.position[ 2 ] = 3.0f;
+    HapiTransform.rotationQuaternion[ 3 ] = 1.0f;
+    HapiTransform.scale[ 0 ] = 1.0f; HapiTransform.scale[ 1 ] = 2.0f; HapiTransform.scale[ 2 ] = 3.0f;
+
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if( HoudiniRuntimeSettings->ImportAxis == HRSAI_Unreal )
+    {
+        FTransform UnrealTransform;
+        FHoudiniEngineUtils::TranslateHapiTransform( HapiTransform, UnrealTransform );
+
+        const float TransformScaleFactor = HoudiniRuntimeSettings->TransformScaleFactor;
+        TestEqual( TEXT( "Translation" ), UnrealTransform.GetTranslation(), FVector( 1.0f, 3.0f, 2.0f ) * TransformScaleFactor );
+        TestEqual( TEXT( "Scale" ), UnrealTransform.GetScale3D(), FVector( 1.0f, 3.0f, 2.0f ) );
+    }
+
+    // Wedge normals are re-indexed for the winding swap and converted in the same pass.
+    const int32 WedgeCount = 3 * 1000001;
+    TArray< FVector > WedgeNormals;
+    WedgeNormals.SetNumUninitialized( WedgeCount );
+    for( FVector& Normal : WedgeNormals )
+        Normal = RandomStream.GetUnitVector();
+
+    TArray< FVector > ExpectedNormals = WedgeNormals;
+    StartTime = FPlatformTime::Seconds();
+    for( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; WedgeIdx += 3 )
+        ExpectedNormals.SwapMemory( WedgeIdx + 1, WedgeIdx + 2 );
+    for( FVector& Normal : ExpectedNormals )
+        Swap( Normal.Y, Normal.Z );
+    const double ScalarWedgeTime = FPlatformTime::Seconds() - StartTime;
+
+    TArray< FVector > ConvertedNormals;
+    ConvertedNormals.SetNumUninitialized( WedgeCount );
+    StartTime = FPlatformTime::Seconds();
+    FHoudiniEngineUtils::ConvertWedgeVectors(
+        WedgeNormals.GetData(), ConvertedNormals.GetData(), WedgeCount, 1.0f, true, true );
+    const double VectorizedWedgeTime = FPlatformTime::Seconds() - StartTime;
+
+    for( int32 Index = 0; Index < WedgeCount; Index++ )
+    {
+        if( ConvertedNormals[ Index ] != ExpectedNormals[ Index ] )
+        {
+            TestEqual( TEXT( "Converted wedge normals match" ), ConvertedNormals[ Index ], ExpectedNormals[ Index ] );
+            break;
+        }
+    }
+
+    UE_LOG( LogHoudiniTests, Display, TEXT( "Converted %d wedges: scalar %.3f ms, batched %.3f ms (x%.1f)" ),
+        WedgeCount, ScalarWedgeTime * 1000.0, VectorizedWedgeTime * 1000.0,
+        VectorizedWedgeTime > 0.0 ? ScalarWedgeTime / VectorizedWedgeTime : 0.0 );
+
+    // In place conversion, with UVs flipped and colors reinterpreted as well.
+    TArray< FVector > InPlaceNormals = WedgeNormals;
+    FHoudiniEngineUtils::ConvertWedgeVectors(
+        InPlaceNormals.GetData(), InPlaceNormals.GetData(), WedgeCount, 1.0f, true, true );
+    TestTrue( TEXT( "In place wedge normals match" ), InPlaceNormals == ExpectedNormals );
+
+    const FVector2D WedgeUVs[ 3 ] = { FVector2D( 0.0f, 0.25f ), FVector2D( 0.5f, 0.5f ), FVector2D( 1.0f, 0.75f ) };
+    FVector HoudiniUVs[ 3 ];
+    FHoudiniEngineUtils::ConvertWedgeUVs( WedgeUVs, HoudiniUVs, 3, true );
+    TestEqual( TEXT( "UV wedge 1" ), HoudiniUVs[ 1 ], FVector( 1.0f, 0.25f, 0.0f ) );
+    TestEqual( TEXT( "UV wedge 2" ), HoudiniUVs[ 2 ], FVector( 0.5f, 0.5f, 0.0f ) );
+
+    const FColor WedgeColors[ 3 ] = { FColor::Red, FColor::Green, FColor::Blue };
+    FLinearColor HoudiniColors[ 3 ];
+    FHoudiniEngineUtils::ConvertWedgeColors( WedgeColors, HoudiniColors, 3, true );
+    TestEqual( TEXT( "Color wedge 0" ), HoudiniColors[ 0 ], FColor::Red.ReinterpretAsLinear() );
+    TestEqual( TEXT( "Color wedge 1" ), HoudiniColors[ 1 ], FColor::Blue.ReinterpretAsLinear() );
+
+    return true;
+}
+
+/** Check a packed group against the per element membership it was packed from. **/
+static void
+HelperTestGroupMembership(
+    FAutomationTestBase * Test, const TCHAR * Name, const FHoudiniGroupMembership & Group, const TArray< int32 > & Membership )
+{
+    TArray< int32 > ExpectedMembers;
+    TArray< int32 > ExpectedNonMembers;
+    for( int32 ElementIdx = 0; ElementIdx < Membership.Num(); ElementIdx++ )
+    {
+        if( Membership[ ElementIdx ] != 0 )
+            ExpectedMembers.Add( ElementIdx );
+        else
+            ExpectedNonMembers.Add( ElementIdx );
+    }
+
+    Test->TestEqual( FString::Printf( TEXT( "%s: element count" ), Name ), Group.Num(), Membership.Num() );
+
+    for( int32 ElementIdx = 0; ElementIdx < Membership.Num(); ElementIdx++ )
+    {
+        if( Group.IsMember( ElementIdx ) != ( Membership[ ElementIdx ] != 0 ) )
+        {
+            Test->AddError( FString::Printf( TEXT( "%s: membership of element %d" ), Name, ElementIdx ) );
+            break;
+        }
+    }
+
+    Test->TestFalse( FString::Printf( TEXT( "%s: element before the part" ), Name ), Group.IsMember( -1 ) );
+    Test->TestFalse( FString::Printf( TEXT( "%s: element past the part" ), Name ), Group.IsMember( Membership.Num() ) );
+
+    Test->TestEqual( FString::Printf( TEXT( "%s: member count" ), Name ), Group.CountMembers(), ExpectedMembers.Num() );
+    Test->TestEqual( FString::Printf( TEXT( "%s: has members" ), Name ), Group.HasMembers(), ExpectedMembers.Num() > 0 );
+    Test->TestEqual( FString::Printf( TEXT( "%s: first member" ), Name ),
+        Group.FindFirstMember(), ExpectedMembers.Num() > 0 ? ExpectedMembers[ 0 ] : (int32) INDEX_NONE );
+
+    // The bits past the last element of the last word are never visited.
+    TArray< int32 > VisitedMembers;
+    Group.ForEachElement( true, [&]( int32 ElementIdx ) { VisitedMembers.Add( ElementIdx ); } );
+    Test->TestTrue( FString::Printf( TEXT( "%s: visited members" ), Name ), VisitedMembers == ExpectedMembers );
+
+    TArray< int32 > VisitedNonMembers;
+    Group.ForEachElement( false, [&]( int32 ElementIdx ) { VisitedNonMembers.Add( ElementIdx ); } );
+    Test->TestTrue( FString::Printf( TEXT( "%s: visited non members" ), Name ), VisitedNonMembers == ExpectedNonMembers );
+}
+
+bool FHoudiniEngineRuntimeGroupMembershipTest::RunTest( const FString& Parameters )
+{
+    // Not a multiple of 32, so that the last word is partially used.
+    const int32 ElementCount = 97;
+
+    // Members on both sides of each word boundary, and the last element.
+    TArray< int32 > BoundaryMembership;
+    BoundaryMembership.SetNumZeroed( ElementCount );
+    for( int32 ElementIdx : { 0, 31, 32, 33, 63, 64, 95, 96 } )
+        BoundaryMembership[ ElementIdx ] = 1;
+
+    // HAPI flags members with any positive value, not only 1.
+    FRandomStream RandomStream( 1234 );
+    TArray< int32 > RandomMembership;
+    RandomMembership.SetNumUninitialized( ElementCount );
+    for( int32& Member : RandomMembership )
+        Member = RandomStream.RandRange( 0, 3 ) == 0 ? RandomStream.RandRange( 1, 255 ) : 0;
+
+    FHoudiniGroupMembership BoundaryGroup;
+    BoundaryGroup.Pack( BoundaryMembership.GetData(), BoundaryMembership.Num() );
+    HelperTestGroupMembership( this, TEXT( "Boundary group" ), BoundaryGroup, BoundaryMembership );
+
+    FHoudiniGroupMembership RandomGroup;
+    RandomGroup.Pack( RandomMembership.GetData(), RandomMembership.Num() );
+    HelperTestGroupMembership( this, TEXT( "Random group" ), RandomGroup, RandomMembership );
+
+    // Combined groups hold the members of either group.
+    TArray< int32 > CombinedMembership;
+    CombinedMembership.SetNumZeroed( ElementCount );
+    for( int32 ElementIdx = 0; ElementIdx < ElementCount; ElementIdx++ )
+        CombinedMembership[ ElementIdx ] = ( BoundaryMembership[ ElementIdx ] != 0 || RandomMembership[ ElementIdx ] != 0 ) ? 1 : 0;
+
+    FHoudiniGroupMembership CombinedGroup = BoundaryGroup;
+    CombinedGroup.Combine( RandomGroup );
+    HelperTestGroupMembership( this, TEXT( "Combined group" ), CombinedGroup, CombinedMembership );
+
+    FHoudiniGroupMembership InitCombinedGroup;
+    InitCombinedGroup.Init( ElementCount );
+    InitCombinedGroup.Combine( BoundaryGroup );
+    HelperTestGroupMembership( this, TEXT( "Group combined into an empty one" ), InitCombinedGroup, BoundaryMembership );
+
+    // A group without members, and a full group ending exactly on a word boundary.
+    TArray< int32 > NoMembership;
+    NoMembership.SetNumZeroed( ElementCount );
+
+    FHoudiniGroupMembership EmptyGroup;
+    EmptyGroup.Init( ElementCount );
+    HelperTestGroupMembership( this, TEXT( "Empty group" ), EmptyGroup, NoMembership );
+
+    TArray< int32 > FullMembership;
+    FullMembership.Init( 1, 64 );
+
+    FHoudiniGroupMembership FullGroup;
+    FullGroup.Pack( FullMembership.GetData(), FullMembership.Num() );
+    HelperTestGroupMembership( this, TEXT( "Full group" ), FullGroup, FullMembership );
+
+    FullGroup.Reset();
+    TestEqual( TEXT( "Reset group element count" ), FullGroup.Num(), 0 );
+    TestFalse( TEXT( "Reset group has members" ), FullGroup.HasMembers() );
+
+    return true;
+}
+
+bool FHoudiniEnginePerfMeshUploadTest::RunTest( const FString& Parameters )
+{
+    for( int32 Resolution : PerfMeshResolutions )
+    {
+        UStaticMesh* GridMesh = HelperCreateGridMesh( Resolution );
+
+        HAPI_NodeId ConnectedAssetId = -1;
+        TArray< HAPI_NodeId > CreatedNodeIds;
+        const double StartTime = FPlatformTime::Seconds();
+        const bool Ok = FHoudiniEngineUtils::HapiUploadStaticMesh( GridMesh, ConnectedAssetId, CreatedNodeIds );
+        const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+        TestTrue( TEXT( "Upload grid mesh" ), Ok );
+        if( Ok )
+            HelperWritePerfResult( this, TEXT( "MeshUpload" ), Resolution, Resolution * Resolution * 2, Seconds );
+
+        for( HAPI_NodeId NodeId : CreatedNodeIds )
+            FHoudiniEngineUtils::DestroyHoudiniAsset( NodeId );
+    }
+
+    return true;
+}
+
+bool FHoudiniEnginePerfMeshBuildTest::RunTest( const FString& Parameters )
+{
+    HelperInstantiateAsset( this, TEXT( "/HoudiniEngine/Test/InputEcho" ),
+        [=]( FHoudiniEngineTaskInfo InstantiateTaskInfo, UHoudiniAsset* HoudiniAsset )
+    {
+        HAPI_NodeId AssetId = InstantiateTaskInfo.AssetId;
+        if( AssetId < 0 )
+            return;
+
+        for( int32 Resolution : PerfMeshResolutions )
+        {
+            UStaticMesh* GridMesh = HelperCreateGridMesh( Resolution );
+
+            HAPI_NodeId ConnectedAssetId = -1;
+            TArray< HAPI_NodeId > CreatedNodeIds;
+            if( !FHoudiniEngineUtils::HapiUploadStaticMesh( GridMesh, ConnectedAssetId, CreatedNodeIds )
+                || FHoudiniApi::ConnectNodeInput( FHoudiniEngine::Get().GetSession(), AssetId, 0, ConnectedAssetId, 0 ) != HAPI_RESULT_SUCCESS
+                || !HelperCookNodeBlocking( AssetId ) )
+            {
+                AddError( FString::Printf( TEXT( "Failed to cook the %d grid" ), Resolution ) );
+                continue;
+            }
+
+            // Time the download and the mesh build, including the builds deferred to the build queue.
+            FTestCookHandler CookHandler( HoudiniAsset );
+            CookHandler.HoudiniCookManager = &CookHandler;
+            CookHandler.StaticMeshBakeMode = EBakeMode::CookToTemp;
+            TMap< FHoudiniGeoPartObject, UStaticMesh * > StaticMeshesIn;
+            TMap< FHoudiniGeoPartObject, UStaticMesh * > StaticMeshesOut;
+            FTransform AssetTransform;
+
+            const double StartTime = FPlatformTime::Seconds();
+            const bool Ok = FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
+                AssetId, CookHandler, false, false, StaticMeshesIn, StaticMeshesOut, AssetTransform );
+            for( auto& GeoPartSM : StaticMeshesOut )
+                FHoudiniEngine::Get().GetStaticMeshBuildQueue().FinishBuild( GeoPartSM.Value );
+            const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+            TestTrue( TEXT( "Build grid mesh" ), Ok && StaticMeshesOut.Num() > 0 );
+            if( Ok )
+                HelperWritePerfResult( this, TEXT( "MeshBuild" ), Resolution, Resolution * Resolution * 2, Seconds );
+
+            FHoudiniApi::DisconnectNodeInput( FHoudiniEngine::Get().GetSession(), AssetId, 0 );
+            for( HAPI_NodeId NodeId : CreatedNodeIds )
+                FHoudiniEngineUtils::DestroyHoudiniAsset( NodeId );
+        }
+
+        HelperDeleteAsset( this, AssetId );
+    } );
+
+    return true;
+}
+
+bool FHoudiniEnginePerfHeightfieldTest::RunTest( const FString& Parameters )
+{
+    for( int32 Size : PerfHeightfieldSizes )
+    {
+        TArray< float > Heights;
+        Heights.SetNumUninitialized( Size * Size );
+        for( int32 Index = 0; Index < Heights.Num(); ++Index )
+            Heights[ Index ] = FMath::Sin( ( Index % Size ) * 0.05f ) * FMath::Cos( ( Index / Size ) * 0.05f ) * 100.0f;
+
+        const double StartTime = FPlatformTime::Seconds();
+
+        HAPI_NodeId HeightFieldId = -1;
+        HAPI_NodeId HeightId = -1;
+        HAPI_NodeId MaskId = -1;
+        HAPI_NodeId MergeId = -1;
+        if( !FHoudiniLandscapeUtils::CreateHeightfieldInputNode(
+            -1, TEXT( "PerfHeightfield" ), Size, Size, HeightFieldId, HeightId, MaskId, MergeId ) )
+        {
+            AddError( FString::Printf( TEXT( "Failed to create the %d heightfield" ), Size ) );
+            continue;
+        }
+
+        HAPI_VolumeInfo VolumeInfo;
+        FMemory::Memzero< HAPI_VolumeInfo >( VolumeInfo );
+        VolumeInfo.xLength = Size;
+        VolumeInfo.yLength = Size;
+        VolumeInfo.zLength = 1;
+        FHoudiniEngineUtils::TranslateUnrealTransform( FTransform::Identity, VolumeInfo.transform );
+        VolumeInfo.type = HAPI_VOLUMETYPE_HOUDINI;
+        VolumeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+        VolumeInfo.tupleSize = 1;
+        VolumeInfo.tileSize = 1;
+
+        bool Ok = FHoudiniLandscapeUtils::SetHeighfieldData( HeightId, 0, Heights, VolumeInfo, TEXT( "height" ) )
+            && FHoudiniApi::CommitGeo( FHoudiniEngine::Get().GetSession(), HeightId ) == HAPI_RESULT_SUCCESS
+            && HelperCookNodeBlocking( MergeId );
+
+        // Read the height volume back.
+        TArray< float > ReadHeights;
+        HAPI_VolumeInfo ReadVolumeInfo;
+        FMemory::Memzero< HAPI_VolumeInfo >( ReadVolumeInfo );
+        Ok = Ok && FHoudiniApi::GetVolumeInfo( FHoudiniEngine::Get().GetSession(), HeightId, 0, &ReadVolumeInfo ) == HAPI_RESULT_SUCCESS;
+        if( Ok )
+        {
+            ReadHeights.SetNumUninitialized( ReadVolumeInfo.xLength * ReadVolumeInfo.yLength );
+            Ok = FHoudiniApi::GetHeightFieldData(
+                FHoudiniEngine::Get().GetSession(), HeightId, 0, ReadHeights.GetData(), 0, ReadHeights.Num() ) == HAPI_RESULT_SUCCESS;
+        }
+
+        const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+        TestTrue( TEXT( "Heightfield round trip" ), Ok );
+        if( Ok )
+        {
+            TestEqual( TEXT( "Heightfield size" ), ReadHeights.Num(), Heights.Num() );
+            HelperWritePerfResult( this, TEXT( "HeightfieldRoundTrip" ), Size, Size * Size, Seconds );
+        }
+
+        FHoudiniEngineUtils::DestroyHoudiniAsset( HeightFieldId );
+    }
+
+    return true;
+}
+
+bool FHoudiniEnginePerfInstancerTest::RunTest( const FString& Parameters )
+{
+    // Instances are spread over a few objects so that the bucketing is exercised too.
+    const int32 ObjectCount = 4;
+
+    for( int32 InstanceCount : PerfInstanceCounts )
+    {
+        TArray< FTransform > Transforms;
+        Transforms.Reserve( InstanceCount );
+        FRandomStream RandomStream( InstanceCount );
+        for( int32 Index = 0; Index < InstanceCount; ++Index )
+        {
+            Transforms.Add( FTransform(
+                FRotator( 0.0f, RandomStream.FRandRange( 0.0f, 360.0f ), 0.0f ),
+                RandomStream.GetUnitVector() * 10000.0f,
+                FVector( RandomStream.FRandRange( 0.5f, 2.0f ) ) ) );
+        }
+
+        HAPI_NodeId PointsNodeId = -1;
+        if( FHoudiniApi::CreateInputNode( FHoudiniEngine::Get().GetSession(), &PointsNodeId, "PerfInstancer" ) != HAPI_RESULT_SUCCESS
+            || !HelperCookNodeBlocking( PointsNodeId ) )
+        {
+            AddError( TEXT( "Failed to create the instancer points node" ) );
+            return false;
+        }
+
+        double StartTime = FPlatformTime::Seconds();
+        bool Ok = FHoudiniEngineUtils::HapiSetInstancePointTransforms( PointsNodeId, Transforms );
+        const double UploadSeconds = FPlatformTime::Seconds() - StartTime;
+
+        // Time the instancer side: fetching the point transforms and splitting them per instanced object.
+        StartTime = FPlatformTime::Seconds();
+        FHoudiniGeoPartObject PointsPart( PointsNodeId, PointsNodeId, PointsNodeId, 0 );
+        TArray< FTransform > AllTransforms;
+        Ok = Ok && PointsPart.HapiGetInstanceTransforms( AllTransforms );
+
+        TArray< int32 > ObjectIndices;
+        ObjectIndices.SetNumUninitialized( AllTransforms.Num() );
+        for( int32 Index = 0; Index < ObjectIndices.Num(); ++Index )
+            ObjectIndices[ Index ] = Index % ObjectCount;
+
+        TArray< TArray< FTransform > > ObjectTransforms;
+        FHoudiniEngineInstancerUtils::BucketInstanceTransforms( ObjectIndices, ObjectCount, AllTransforms, ObjectTransforms );
+        const double FetchSeconds = FPlatformTime::Seconds() - StartTime;
+
+        TestTrue( TEXT( "Instancer round trip" ), Ok );
+        if( Ok )
+        {
+            TestEqual( TEXT( "Instance count" ), AllTransforms.Num(), InstanceCount );
+            HelperWritePerfResult( this, TEXT( "InstancerUpload" ), InstanceCount, InstanceCount, UploadSeconds );
+            HelperWritePerfResult( this, TEXT( "InstancerFetch" ), InstanceCount, InstanceCount, FetchSeconds );
+        }
+
+        FHoudiniEngineUtils::DestroyHoudiniAsset( FHoudiniEngineUtils::HapiGetParentNodeId( PointsNodeId ) );
+    }
+
+    return true;
+}
+
+bool FHoudiniEnginePerfParameterBuildTest::RunTest( const FString& Parameters )
+{
+    HelperInstantiateAsset( this, TEXT( "/HoudiniEngine/Test/TestParams" ),
+        [=]( FHoudiniEngineTaskInfo InstantiateTaskInfo, UHoudiniAsset* HoudiniAsset )
+    {
+        HAPI_NodeId AssetId = InstantiateTaskInfo.AssetId;
+        if( AssetId < 0 )
+            return;
+
+        // The test asset has far fewer parameters, rebuild its whole interface until enough parameters are built.
+        UTestHoudiniParameterBuilder * Builder = NewObject<UTestHoudiniParameterBuilder>( HelperGetWorld(), TEXT( "PerfParmBuilder" ), RF_Standalone );
+        int32 BuiltCount = 0;
+        const double StartTime = FPlatformTime::Seconds();
+        while( BuiltCount < PerfParameterCount )
+        {
+            TMap< HAPI_ParmId, class UHoudiniAssetParameter * > CurrentParameters;
+            Builder->NewParameters.Empty();
+            if( !FHoudiniParamUtils::Build( AssetId, Builder, CurrentParameters, Builder->NewParameters )
+                || Builder->NewParameters.Num() == 0 )
+            {
+                AddError( TEXT( "Parameter build failed" ) );
+                break;
+            }
+            BuiltCount += Builder->NewParameters.Num();
+        }
+        const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+        if( BuiltCount >= PerfParameterCount )
+            HelperWritePerfResult( this, TEXT( "ParameterBuild" ), PerfParameterCount, BuiltCount, Seconds );
+
+        Builder->ConditionalBeginDestroy();
+        HelperDeleteAsset( this, AssetId );
+    } );
+
+    return true;
+}
+
+bool FHoudiniEnginePerfMaterialTest::RunTest( const FString& Parameters )
+{
+    HelperInstantiateAsset( this, TEXT( "/HoudiniEngine/Test/TestBox" ),
+        [=]( FHoudiniEngineTaskInfo InstantiateTaskInfo, UHoudiniAsset* HoudiniAsset )
+    {
+        HAPI_NodeId AssetId = InstantiateTaskInfo.AssetId;
+        if( AssetId < 0 )
+            return;
+
+        HAPI_AssetInfo AssetInfo;
+        if( !HelperCookNodeBlocking( AssetId )
+            || FHoudiniApi::GetAssetInfo( FHoudiniEngine::Get().GetSession(), AssetId, &AssetInfo ) != HAPI_RESULT_SUCCESS )
+        {
+            AddError( TEXT( "Failed to cook the material asset" ) );
+            HelperDeleteAsset( this, AssetId );
+            return;
+        }
+
+        const double StartTime = FPlatformTime::Seconds();
+        TSet< HAPI_NodeId > UniqueMaterialIds;
+        TSet< HAPI_NodeId > UniqueInstancerMaterialIds;
+        TMap< FHoudiniGeoPartObject, HAPI_NodeId > InstancerMaterialMap;
+        FHoudiniEngineUtils::ExtractUniqueMaterialIds( AssetInfo, UniqueMaterialIds, UniqueInstancerMaterialIds, InstancerMaterialMap );
+
+        FTestCookHandler CookHandler( HoudiniAsset );
+        CookHandler.HoudiniCookManager = &CookHandler;
+        CookHandler.StaticMeshBakeMode = EBakeMode::CookToTemp;
+        TMap< FString, UMaterialInterface * > Materials;
+        FHoudiniEngineMaterialUtils::HapiCreateMaterials(
+            AssetId, CookHandler, AssetInfo, UniqueMaterialIds, UniqueInstancerMaterialIds, Materials, true );
+        const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+        if( Materials.Num() == 0 )
+            AddWarning( TEXT( "The material asset has no Houdini material, only the extraction overhead was measured" ) );
+
+        HelperWritePerfResult( this, TEXT( "MaterialExtraction" ), UniqueMaterialIds.Num(), Materials.Num(), Seconds );
+        HelperDeleteAsset( this, AssetId );
+    } );
+
+    return true;
+}
+
+/** State of the stress test, shared by its latent commands. **/
+struct FHoudiniStressTestState
+{
+    TArray< TWeakObjectPtr< UHoudiniAssetComponent > > Components;
+
+    /** Time at which each component has finished the current phase, 0 while it is still busy. **/
+    TArray< double > FinishTimes;
+
+    /** Is set for the components whose cook of the current phase has been seen in progress. **/
+    TArray< bool > CookStarted;
+
+    double PhaseStartTime = 0.0;
+    uint64 PeakUsedPhysical = 0;
+    FRandomStream Random;
+};
+
+/** Return the given percentile of sorted latencies. **/
+static double HelperGetPercentile( const TArray< double >& SortedLatencies, double Fraction )
+{
+    if( SortedLatencies.Num() == 0 )
+        return 0.0;
+
+    const int32 Index = FMath::Clamp( FMath::CeilToInt( SortedLatencies.Num() * Fraction ) - 1, 0, SortedLatencies.Num() - 1 );
+    return SortedLatencies[ Index ];
+}
+
+/** Wait for every component of the stress test to be done, then report the throughput and latencies of the phase. **/
+static void HelperWaitForStressPhase(
+    FAutomationTestBase* Test,
+    TSharedRef< FHoudiniStressTestState > State,
+    const TCHAR* Benchmark,
+    bool bInitialCook )
+{
+    Test->AddCommand( new FFunctionLatentCommand( [=]()
+    {
+        const double Now = FPlatformTime::Seconds();
+        State->PeakUsedPhysical = FMath::Max< uint64 >( State->PeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical );
+
+        int32 BusyCount = 0;
+        for( int32 Idx = 0; Idx < State->Components.Num(); ++Idx )
+        {
+            UHoudiniAssetComponent* Component = State->Components[ Idx ].Get();
+            if( !Component || State->FinishTimes[ Idx ] > 0.0 )
+                continue;
+
+            if( Component->IsInstantiatingOrCooking() )
+                State->CookStarted[ Idx ] = true;
+
+            // The first phase is done once the first cook has been processed, the next ones once their cook is.
+            const bool bDone = bInitialCook
+                ? Component->HasValidAssetId() && !Component->IsInstantiatingOrCooking() && Component->GetLastCookMetrics().CookSeconds > 0.0f
+                : State->CookStarted[ Idx ] && !Component->IsInstantiatingOrCooking();
+
+            if( bDone )
+                State->FinishTimes[ Idx ] = Now;
+            else
+                BusyCount++;
+        }
+
+        const double Seconds = Now - State->PhaseStartTime;
+        if( BusyCount > 0 && Seconds < PerfStressTimeout )
+            return false;
+
+        if( BusyCount > 0 )
+            Test->AddError( FString::Printf( TEXT( "%s: %d of %d actors did not finish cooking" ), Benchmark, BusyCount, State->Components.Num() ) );
+
+        TArray< double > Latencies;
+        for( double FinishTime : State->FinishTimes )
+        {
+            if( FinishTime > 0.0 )
+                Latencies.Add( FinishTime - State->PhaseStartTime );
+        }
+        Latencies.Sort();
+
+        const int32 ActorCount = State->Components.Num();
+        HelperWritePerfResult( Test, Benchmark, ActorCount, Latencies.Num(), Seconds );
+        HelperWritePerfResult( Test, *FString::Printf( TEXT( "%sLatencyP50" ), Benchmark ), ActorCount, 1, HelperGetPercentile( Latencies, 0.5 ) );
+        HelperWritePerfResult( Test, *FString::Printf( TEXT( "%sLatencyP90" ), Benchmark ), ActorCount, 1, HelperGetPercentile( Latencies, 0.9 ) );
+        HelperWritePerfResult( Test, *FString::Printf( TEXT( "%sLatencyP99" ), Benchmark ), ActorCount, 1, HelperGetPercentile( Latencies, 0.99 ) );
+
+        UE_LOG( LogHoudiniTests, Display, TEXT( "%s [%d]: peak used physical memory %.1f MB" ),
+            Benchmark, ActorCount, State->PeakUsedPhysical / ( 1024.0 * 1024.0 ) );
+
+        return true;
+    } ) );
+}
+
+bool FHoudiniEnginePerfManyActorsTest::RunTest( const FString& Parameters )
+{
+    FString AssetPath = TEXT( "/HoudiniEngine/Test/TestPolyReduce" );
+    int32 ActorCount = PerfStressActorCount;
+    int32 Seed = 0;
+    FParse::Value( FCommandLine::Get(), TEXT( "HoudiniStressHda=" ), AssetPath );
+    FParse::Value( FCommandLine::Get(), TEXT( "HoudiniStressCount=" ), ActorCount );
+    FParse::Value( FCommandLine::Get(), TEXT( "HoudiniStressSeed=" ), Seed );
+
+    UHoudiniAsset* TestAsset = Cast<UHoudiniAsset>( FindAssetUObject( FName( *AssetPath ) ) );
+    if( !TestAsset )
+    {
+        AddError( FString::Printf( TEXT( "Failed to find the Houdini asset %s" ), *AssetPath ) );
+        return false;
+    }
+
+    TSharedRef< FHoudiniStressTestState > State = MakeShareable( new FHoudiniStressTestState() );
+    State->Random.Initialize( Seed );
+    State->PeakUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+    State->PhaseStartTime = FPlatformTime::Seconds();
+
+    // Spawn the actors on a grid, they are instantiated and cooked through the scheduler.
+    const int32 GridSize = FMath::CeilToInt( FMath::Sqrt( (float)ActorCount ) );
+    for( int32 Idx = 0; Idx < ActorCount; ++Idx )
+    {
+        GEditor->ClickLocation = FVector( ( Idx % GridSize ) * 500.0f, ( Idx / GridSize ) * 500.0f, 0.0f );
+        GEditor->ClickPlane = FPlane( GEditor->ClickLocation, FVector::UpVector );
+
+        TArray<AActor*> NewActors = FLevelEditorViewportClient::TryPlacingActorFromObject( HelperGetWorld()->GetLevel( 0 ), TestAsset, true, RF_Transactional, nullptr );
+        AHoudiniAssetActor* Actor = NewActors.Num() > 0 ? Cast<AHoudiniAssetActor>( NewActors[ 0 ] ) : nullptr;
+        if( Actor && Actor->GetHoudiniAssetComponent() )
+            State->Components.Add( Actor->GetHoudiniAssetComponent() );
+    }
+
+    TestEqual( TEXT( "Placed Actors" ), State->Components.Num(), ActorCount );
+    State->FinishTimes.SetNumZeroed( State->Components.Num() );
+    State->CookStarted.SetNumZeroed( State->Components.Num() );
+
+    HelperWaitForStressPhase( this, State, TEXT( "ManyActorsInstantiate" ), true );
+
+    // Randomize the float parameters of every actor at once, the resulting cooks compete for the sessions.
+    AddCommand( new FFunctionLatentCommand( [=]()
+    {
+        for( int32 Idx = 0; Idx < State->Components.Num(); ++Idx )
+        {
+            State->FinishTimes[ Idx ] = 0.0;
+            State->CookStarted[ Idx ] = false;
+
+            UHoudiniAssetComponent* Component = State->Components[ Idx ].Get();
+            if( !Component )
+                continue;
+
+            TMap< FString, UHoudiniAssetParameter * > FloatParameters;
+            Component->CollectAllParametersOfType( UHoudiniAssetParameterFloat::StaticClass(), FloatParameters );
+
+            bool bChanged = false;
+            for( auto& FloatParameter : FloatParameters )
+            {
+                UHoudiniAssetParameterFloat* Parameter = Cast<UHoudiniAssetParameterFloat>( FloatParameter.Value );
+                if( !Parameter )
+                    continue;
+
+                for( int32 TupleIdx = 0; TupleIdx < Parameter->GetTupleSize(); ++TupleIdx )
+                {
+                    const float Value = Parameter->GetValue( TupleIdx ).Get( 0.0f );
+                    const float Range = FMath::Max( FMath::Abs( Value ) * 0.25f, 0.1f );
+                    Parameter->SetValue( Value + State->Random.FRandRange( -Range, Range ), TupleIdx, true, false );
+                    bChanged = true;
+                }
+            }
+
+            // Assets without float parameters are simply recooked.
+            if( !bChanged )
+                Component->StartTaskAssetCookingManual();
+        }
+
+        State->PhaseStartTime = FPlatformTime::Seconds();
+        return true;
+    } ) );
+
+    HelperWaitForStressPhase( this, State, TEXT( "ManyActorsRecook" ), false );
+
+    AddCommand( new FFunctionLatentCommand( [=]()
+    {
+        for( TWeakObjectPtr< UHoudiniAssetComponent >& Component : State->Components )
+        {
+            if( Component.IsValid() && Component->GetOwner() )
+                HelperGetWorld()->EditorDestroyActor( Component->GetOwner(), true );
+        }
+
+        return true;
+    } ) );
+
+    return true;
+}
+
+bool FHoudiniEnginePerfUtilsVectorTest::RunTest( const FString& Parameters )
+{
+    for( int32 Size : PerfMicroSizes )
+    {
+        FRandomStream RandomStream( Size );
+        TArray< float > RawData;
+        RawData.SetNumUninitialized( Size * 3 );
+        for( float& Value : RawData )
+            Value = RandomStream.FRandRange( -100.0f, 100.0f );
+
+        TArray< FVector > Vectors;
+        HelperRunMicroBenchmark( this, TEXT( "Utils.ConvertScaleAndFlipVectorData" ), Size,
+            [&]() { Vectors.Reset(); },
+            [&]() { FHoudiniEngineUtils::ConvertScaleAndFlipVectorData( RawData, Vectors ); } );
+
+        if( Vectors.Num() != Size )
+        {
+            TestEqual( TEXT( "Converted vector count" ), Vectors.Num(), Size );
+            continue;
+        }
+
+        // In place conversion, the source is restored outside of the timed section.
+        HelperRunMicroBenchmark( this, TEXT( "Utils.ConvertScaleAndFlipVectorDataInPlace" ), Size,
+            [&]() { FMemory::Memcpy( Vectors.GetData(), RawData.GetData(), RawData.Num() * sizeof( float ) ); },
+            [&]() { FHoudiniEngineUtils::ConvertScaleAndFlipVectorData( Vectors.GetData(), Vectors.Num() ); } );
+    }
+
+    return true;
+}
+
+bool FHoudiniEnginePerfUtilsTransformTest::RunTest( const FString& Parameters )
+{
+    for( int32 Size : PerfMicroSizes )
+    {
+        FRandomStream RandomStream( Size );
+        TArray< FTransform > UnrealTransforms;
+        UnrealTransforms.SetNumUninitialized( Size );
+        for( FTransform& Transform : UnrealTransforms )
+        {
+            Transform = FTransform(
+                FRotator( RandomStream.FRandRange( -180.0f, 180.0f ), RandomStream.FRandRange( -180.0f, 180.0f ), RandomStream.FRandRange( -180.0f, 180.0f ) ),
+                RandomStream.GetUnitVector() * RandomStream.FRandRange( 0.0f, 10000.0f ),
+                FVector( RandomStream.FRandRange( 0.1f, 10.0f ) ) );
+        }
+
+        TArray< HAPI_Transform > HapiTransforms;
+        HapiTransforms.SetNumUninitialized( Size );
+        HelperRunMicroBenchmark( this, TEXT( "Utils.TranslateUnrealTransform" ), Size,
+            [&]() {},
+            [&]()
+        {
+            for( int32 Idx = 0; Idx < Size; ++Idx )
+                FHoudiniEngineUtils::TranslateUnrealTransform( UnrealTransforms[ Idx ], HapiTransforms[ Idx ] );
+        } );
+
+        HelperRunMicroBenchmark( this, TEXT( "Utils.TranslateHapiTransform" ), Size,
+            [&]() {},
+            [&]()
+        {
+            for( int32 Idx = 0; Idx < Size; ++Idx )
+                FHoudiniEngineUtils::TranslateHapiTransform( HapiTransforms[ Idx ], UnrealTransforms[ Idx ] );
+        } );
+
+        HelperRunMicroBenchmark( this, TEXT( "Utils.TranslateHapiTransforms" ), Size,
+            [&]() {},
+            [&]() { FHoudiniEngineUtils::TranslateHapiTransforms( HapiTransforms.GetData(), Size, UnrealTransforms.GetData() ); } );
+    }
+
+    return true;
+}
+
+bool FHoudiniEnginePerfUtilsPositionStringTest::RunTest( const FString& Parameters )
+{
+    for( int32 Size : PerfMicroSizes )
+    {
+        if( Size > PerfMicroStringMaxSize )
+            continue;
+
+        FRandomStream RandomStream( Size );
+        TArray< FVector > Positions;
+        Positions.SetNumUninitialized( Size );
+        for( FVector& Position : Positions )
+            Position = RandomStream.GetUnitVector() * RandomStream.FRandRange( 0.0f, 10000.0f );
+
+        FString PositionString;
+        HelperRunMicroBenchmark( this, TEXT( "Utils.CreatePositionsString" ), Size,
+            [&]() {},
+            [&]() { FHoudiniEngineUtils::CreatePositionsString( Positions, PositionString ); } );
+
+        TArray< FVector > ParsedPositions;
+        HelperRunMicroBenchmark( this, TEXT( "Utils.ExtractStringPositions" ), Size,
+            [&]() { ParsedPositions.Reset(); },
+            [&]() { FHoudiniEngineUtils::ExtractStringPositions( PositionString, ParsedPositions ); } );
+
+        TestEqual( TEXT( "Round tripped position count" ), ParsedPositions.Num(), Size );
+    }
+
+    return true;
+}
+
+bool FHoudiniEnginePerfUtilsWedgeTransferTest::RunTest( const FString& Parameters )
+{
+    for( int32 Size : PerfMicroSizes )
+    {
+        // Size wedges indexing a third as many points, with a few invalid entries like split primitives produce.
+        const int32 PointCount = FMath::Max( Size / 3, 1 );
+        FRandomStream RandomStream( Size );
+        TArray< int32 > VertexList;
+        VertexList.SetNumUninitialized( Size );
+        for( int32& VertexIdx : VertexList )
+            VertexIdx = RandomStream.FRand() < 0.01f ? -1 : RandomStream.RandHelper( PointCount );
+
+        HAPI_AttributeInfo ColorInfo;
+        FMemory::Memzero< HAPI_AttributeInfo >( ColorInfo );
+        ColorInfo.exists = true;
+        ColorInfo.owner = HAPI_ATTROWNER_POINT;
+        ColorInfo.storage = HAPI_STORAGETYPE_FLOAT;
+        ColorInfo.count = PointCount;
+        ColorInfo.tupleSize = 3;
+
+        HAPI_AttributeInfo UVInfo = ColorInfo;
+        UVInfo.tupleSize = 2;
+
+        TArray< float > ColorData;
+        ColorData.SetNumUninitialized( PointCount * ColorInfo.tupleSize );
+        for( float& Value : ColorData )
+            Value = RandomStream.FRand();
+
+        TArray< float > UVData;
+        UVData.SetNumUninitialized( PointCount * UVInfo.tupleSize );
+        for( float& Value : UVData )
+            Value = RandomStream.FRand();
+
+        TArray< float > ColorVertexData;
+        HelperRunMicroBenchmark( this, TEXT( "Utils.TransferRegularPointAttributesToVertices" ), Size,
+            [&]() { ColorVertexData.Reset(); },
+            [&]() { FHoudiniEngineUtils::TransferRegularPointAttributesToVertices( VertexList, ColorInfo, ColorData, ColorVertexData ); } );
+
+        // Both attributes gathered in a single pass over the vertex list.
+        TArray< float > UVVertexData;
+        ColorVertexData.SetNumUninitialized( Size * ColorInfo.tupleSize );
+        UVVertexData.SetNumUninitialized( Size * UVInfo.tupleSize );
+        TArray< FHoudiniWedgeAttributeTransfer > Transfers;
+        Transfers.Emplace( ColorInfo, ColorData, ColorVertexData.GetData(), ColorInfo.tupleSize );
+        Transfers.Emplace( UVInfo, UVData, UVVertexData.GetData(), UVInfo.tupleSize );
+
+        HelperRunMicroBenchmark( this, TEXT( "Utils.TransferRegularPointAttributesToVerticesMulti" ), Size,
+            [&]() {},
+            [&]() { FHoudiniEngineUtils::TransferRegularPointAttributesToVertices( VertexList, Transfers ); } );
+    }
+
+    return true;
+}
+
+bool FHoudiniEnginePerfUtilsDegenerateTest::RunTest( const FString& Parameters )
+{
+    for( int32 Size : PerfMicroSizes )
+    {
+        // Size triangles over random positions, a few of them collapsed on purpose.
+        FRandomStream RandomStream( Size );
+        FRawMesh RawMesh;
+        RawMesh.VertexPositions.SetNumUninitialized( Size );
+        for( FVector& Position : RawMesh.VertexPositions )
+            Position = RandomStream.GetUnitVector() * RandomStream.FRandRange( 1.0f, 10000.0f );
+
+        int32 ExpectedDegenerateCount = 0;
+        RawMesh.WedgeIndices.SetNumUninitialized( Size * 3 );
+        for( int32 TriangleIdx = 0; TriangleIdx < Size; ++TriangleIdx )
+        {
+            const int32 VertexIdx = RandomStream.RandHelper( Size );
+            const bool bDegenerate = RandomStream.FRand() < 0.01f;
+            RawMesh.WedgeIndices[ TriangleIdx * 3 + 0 ] = VertexIdx;
+            RawMesh.WedgeIndices[ TriangleIdx * 3 + 1 ] = bDegenerate ? VertexIdx : ( VertexIdx + 1 ) % Size;
+            RawMesh.WedgeIndices[ TriangleIdx * 3 + 2 ] = ( VertexIdx + 2 ) % Size;
+            ExpectedDegenerateCount += bDegenerate ? 1 : 0;
+        }
+
+        int32 DegenerateCount = 0;
+        HelperRunMicroBenchmark( this, TEXT( "Utils.CountDegenerateTriangles" ), Size,
+            [&]() {},
+            [&]() { DegenerateCount = FHoudiniEngineUtils::CountDegenerateTriangles( RawMesh ); } );
+
+        // Random positions may coincide, so only a lower bound is known.
+        TestTrue( TEXT( "Degenerate triangles found" ), DegenerateCount >= ExpectedDegenerateCount );
+    }
+
+    return true;
+}
+
 #endif // WITH_EDITOR
\ No newline at end of file
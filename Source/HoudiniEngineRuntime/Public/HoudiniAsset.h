@@ -23,6 +23,7 @@
 
 #pragma once
 #include "UObject/Object.h"
+#include "Serialization/BulkData.h"
 #include "HAPI.h"
 #include "HoudiniAsset.generated.h"
 
@@ -49,8 +50,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
         /** Initialize this asset from given buffer / file. **/
         void CreateAsset( const uint8 * BufferStart, const uint8 * BufferEnd, const FString & InFileName );
 
-        /** Return buffer containing the raw Houdini OTL data. **/
-        const uint8* GetAssetBytes() const;
+        /** Return buffer containing the raw Houdini OTL data, loading it on first use. **/
+        /** Every successful call must be matched by a call to UnlockAssetBytes. **/
+        const uint8 * LockAssetBytes() const;
+
+        /** Release the buffer returned by LockAssetBytes. **/
+        void UnlockAssetBytes() const;
 
         /** Return path of the corresponding OTL/HDA file. **/
         const FString& GetAssetFileName() const;
@@ -58,6 +63,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
         /** Return the size in bytes of raw Houdini OTL data. **/
         uint32 GetAssetBytesCount() const;
 
+        /** Return the hash of the raw Houdini OTL data, computed on first use. **/
+        const FString & GetAssetBytesHash() const;
+
+        /** Compute the hash of the given raw Houdini OTL data, as returned by GetAssetBytesHash. **/
+        static FString ComputeAssetBytesHash( const uint8 * Bytes, uint32 BytesCount );
+
         /** Returns true if this asset contains Houdini logo. **/
         bool IsPreviewHoudiniLogo() const;
 
@@ -95,12 +106,15 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
 
     protected:
 
-        /** Buffer containing raw Houdini OTL data. **/
-        uint8 * AssetBytes;
+        /** Raw Houdini OTL data, stored after the package exports and only loaded when a buffer is needed. **/
+        FByteBulkData AssetBulkData;
 
         /** Field containing the size of raw Houdini OTL data in bytes. **/
         uint32 AssetBytesCount;
 
+        /** Hash of the raw Houdini OTL data, saved with the asset so it does not require loading the data. **/
+        mutable FString AssetBytesHash;
+
         /** Version of the asset file format. **/
         uint32 FileFormatVersion;
 
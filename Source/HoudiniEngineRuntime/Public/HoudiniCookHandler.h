@@ -82,6 +82,8 @@ struct HOUDINIENGINERUNTIME_API FHoudiniCookParams
     /** Cache of the temp cook content packages created by the asset for its Landscape layers		    **/
     /** As packages are unique their are used as the key (we can have multiple package for the same geopartobj  **/
     TMap< TWeakObjectPtr<class UPackage>, FHoudiniGeoPartObject >* CookedTemporaryLandscapeLayers = nullptr;
+    // Materials and textures already duplicated during the current bake, so meshes sharing them bake them once
+    TMap< const class UObject*, class UObject* >* BakedDuplicatesForOriginals = nullptr;
 
     // When cooking in temp mode - folder to create assets in
     FText TempCookFolder;
@@ -91,4 +93,7 @@ struct HOUDINIENGINERUNTIME_API FHoudiniCookParams
     class UObject* IntermediateOuter = nullptr;
 
     int32 GeneratedDistanceFieldResolutionScale = 0;
+
+    // Meshes with more triangles than this get a generated LOD chain, 0 disables it
+    int32 GeneratedAutoLODTriangleBudget = 0;
 };
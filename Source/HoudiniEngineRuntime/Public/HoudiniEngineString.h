@@ -54,6 +54,14 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineString
         bool ToFString( FString & String ) const;
         bool ToFText( FText & Text ) const;
 
+    public:
+
+        /** Resolve the given string ids with a single batch request, ids already resolved in the current string cache are not requested again. **/
+        static bool ToFStringArray( const TArray< int32 > & InStringIds, TArray< FString > & OutStrings );
+
+        /** Resolve the given string ids into the current string cache, so that they can be converted without further requests. **/
+        static bool PrefetchStrings( const TArray< int32 > & InStringIds );
+
     public:
 
         /** Return id of this string. **/
@@ -67,3 +75,16 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineString
         /** Id of the underlying Houdini Engine string. **/
         int32 StringId;
 };
+
+/** Scope during which the strings resolved on this thread are cached, nested scopes share the outermost cache. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniScopedStringCache
+{
+    FHoudiniScopedStringCache();
+    ~FHoudiniScopedStringCache();
+
+    /** Strings resolved in this scope, indexed by string id. **/
+    TMap< int32, FString > Strings;
+
+    /** Is set to true if this scope installed its cache, false if an outer scope was already active. **/
+    bool bOwnsCache;
+};
@@ -41,7 +41,32 @@ namespace EHoudiniEngineTaskType
         AssetCooking,
 
         /** This type is used for asynchronous asset deletion. **/
-        AssetDeletion
+        AssetDeletion,
+
+        /** This type is used to load the asset libraries found in the OTL search path ahead of time. **/
+        AssetLibraryPreload,
+
+        /** This type is used to start the sessions without blocking the editor. **/
+        SessionStartup,
+
+        MAX
+    };
+}
+
+namespace EHoudiniEngineTaskPriority
+{
+    enum Type
+    {
+        /** Tasks resulting from the user editing an asset, executed first. **/
+        Interactive,
+
+        /** Default priority. **/
+        Normal,
+
+        /** Tasks issued for loaded components, deletions and other work nobody is waiting on. **/
+        Background,
+
+        MAX
     };
 }
 
@@ -57,6 +82,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineTask
     /** Type of this task. **/
     EHoudiniEngineTaskType::Type TaskType;
 
+    /** Priority lane this task is scheduled in. **/
+    EHoudiniEngineTaskPriority::Type Priority;
+
+    /** Order within the lane, tasks with a lower key run first and equal keys run in submission order. **/
+    float SortKey;
+
     /** Houdini asset for instantiation. **/
     TWeakObjectPtr< class UHoudiniAsset > Asset;
 
@@ -72,6 +103,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineTask
     /** HAPI name of the asset. **/
     int32 AssetHapiName;
 
+    /** Index of the session, in the session pool, this task is executed in. **/
+    int32 SessionIndex;
+
+    /** Time at which this task was added to the scheduler. **/
+    double QueuedTime;
+
     /** Is set to true if component has been loaded. **/
     bool bLoadedComponent;
 };
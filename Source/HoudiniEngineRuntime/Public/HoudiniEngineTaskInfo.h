@@ -37,7 +37,10 @@ namespace EHoudiniEngineTaskState
         FinishedInstantiationWithErrors,
         FinishedCooking,
         FinishedCookingWithErrors,
-        Aborted
+        Aborted,
+
+        /** The cook was interrupted because it was made stale by newer changes. **/
+        Interrupted
     };
 }
 
@@ -65,6 +68,19 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineTaskInfo
     /** String used for status / progress bar. **/
     FText StatusText;
 
+    /** Number of tasks waiting in each priority lane of the scheduler when this info was reported. **/
+    int32 QueuedTaskCounts[ EHoudiniEngineTaskPriority::MAX ];
+
+    /** Time in seconds the task waited in the scheduler queue before being processed. **/
+    float QueueSeconds;
+
+    /** Time in seconds the scheduler has spent processing the task when this info was reported. **/
+    float ElapsedSeconds;
+
+    /** Number of HAPI calls made for the task and bytes they transferred, counted while HAPI tracing is enabled. **/
+    int32 HapiCallCount;
+    int64 HapiBytes;
+
     /** Is set to true if corresponding task was issued for loaded component. **/
     bool bLoadedComponent;
 };
@@ -56,10 +56,29 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGeoPartObject
     public:
 
         /** Return hash value for this object, used when using this object as a key inside hashing containers. **/
-        uint32 GetTypeHash() const;
+        FORCEINLINE uint32 GetTypeHash() const
+        {
+            return HashCombine( ::GetTypeHash( GetNodeKey() ), ::GetTypeHash( GetSplitKey() ) );
+        }
 
         /** Comparison operator, used by hashing containers. **/
-        bool operator==( const FHoudiniGeoPartObject & HoudiniGeoPartObject ) const;
+        FORCEINLINE bool operator==( const FHoudiniGeoPartObject & HoudiniGeoPartObject ) const
+        {
+            return GetNodeKey() == HoudiniGeoPartObject.GetNodeKey() && GetSplitKey() == HoudiniGeoPartObject.GetSplitKey();
+        }
+
+        /** Object and geo ids packed in a single word. The asset id is not part of the identity of a part, **/
+        /** it is reset when loading while the other ids are kept to match the loaded parts again.          **/
+        FORCEINLINE uint64 GetNodeKey() const
+        {
+            return ( ( uint64 ) ( uint32 ) ObjectId << 32 ) | ( uint32 ) GeoId;
+        }
+
+        /** Part and split ids packed in a single word. **/
+        FORCEINLINE uint64 GetSplitKey() const
+        {
+            return ( ( uint64 ) ( uint32 ) PartId << 32 ) | ( uint32 ) SplitId;
+        }
 
         /** Compare based on object and part name. **/
         bool CompareNames( const FHoudiniGeoPartObject & HoudiniGeoPartObject ) const;
@@ -528,25 +547,35 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGeoPartObject
         bool HasParameters() const;
         bool HasParameters( HAPI_NodeId InAssetId ) const;
 
+        /** Return the interned names as strings, empty if there is none. **/
+        FString GetObjectName() const;
+        FString GetPartName() const;
+        FString GetSplitName() const;
+        FString GetInstancerMaterialName() const;
+        FString GetInstancerAttributeMaterialName() const;
+
     public:
 
         /** Transform of this geo part object. **/
         FTransform TransformMatrix;
 
+        /** The names are interned, copying geo part objects in and out of the output maps does not copy strings. **/
+        /** They are still serialized as strings.                                                                   **/
+
         /** Name of associated object. **/
-        FString ObjectName;
+        FName ObjectName;
 
         /** Name of associated part. **/
-        FString PartName;
+        FName PartName;
 
-        /** Name of group which was used for splitting, empty if there's none. **/
-        FString SplitName;
+        /** Name of group which was used for splitting, none if there's none. **/
+        FName SplitName;
 
         /** Name of the instancer material, if available. **/
-        FString InstancerMaterialName;
+        FName InstancerMaterialName;
 
         /** Name of attribute material, if available. **/
-        FString InstancerAttributeMaterialName;
+        FName InstancerAttributeMaterialName;
 
         /** Id of corresponding HAPI Asset. **/
         HAPI_NodeId AssetId;
@@ -566,6 +595,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGeoPartObject
         /** Path to the corresponding node */
         mutable FString NodePath;
 
+        /** Hash of the geometry content the static mesh of this split was built from, 0 if unknown. Not serialized. **/
+        uint32 GeometryHash;
+
         /** Flags used by geo part object. **/
         union
         {
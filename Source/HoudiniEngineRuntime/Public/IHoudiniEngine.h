@@ -39,6 +39,7 @@ struct FHoudiniEngineTaskInfo;
 struct HAPI_Session;
 struct FHoudiniCookParams;
 class ALandscape;
+class UProceduralMeshComponent;
 
 
 class IHoudiniEngine : public IModuleInterface
@@ -100,4 +101,11 @@ public:
         TMap< FHoudiniGeoPartObject, USceneComponent * >& InstancersOut,
         USceneComponent* ParentComponent,
         FTransform & ComponentTransform ) = 0;
+
+    /** Write the mesh parts of a cooked asset into procedural mesh components, without building static meshes. **/
+    /** Unlike CookNode, this is available in game builds. Reused components are removed from MeshComponentsIn. **/
+    virtual bool CookNodeToMeshComponents(
+        HAPI_NodeId AssetId, USceneComponent * ParentComponent, bool bCreateCollision,
+        TMap< FHoudiniGeoPartObject, UProceduralMeshComponent * > & MeshComponentsIn,
+        TMap< FHoudiniGeoPartObject, UProceduralMeshComponent * > & MeshComponentsOut ) = 0;
 };